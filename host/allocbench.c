@@ -0,0 +1,188 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+    Host build of the allocator benchmark.
+
+    Builds the PMM (src/mem.c, src/memblock.c) and the heap allocators in src/alloc in to an
+    ordinary Linux program, so alloc_benchmark() can be run and profiled without booting.
+    Physical memory is an anonymous mapping described to the PMM by a made up Limine memory map,
+    and the mapping is placed on a 1 GiB boundary so the HHDM offset keeps every physical
+    alignment the PMM hands out. The shims for the bits of the kernel the PMM leans on
+    (kprintf, the serial port, ACPI NUMA info and the timer tick) live here.
+
+    Run with "make allocbench-host".
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <limine.h>
+#include <mem.h>
+#include <cpu.h>
+#include <acpi.h>
+#include <idt.h>
+#include <serial.h>
+#include <allocbench.h>
+
+#define HOST_PHYS_SIZE      (512ULL << 20)
+#define HOST_ALIGN          (1ULL << 30)
+#define HOST_MEMMAP_ENTRIES 4
+
+extern volatile struct limine_memmap_request memmap_request;
+extern volatile struct limine_hhdm_request hhdm_request;
+
+uint32_t bsp_lapic_id = 0;
+uint64_t cpu_count = 1;
+struct cpu_local cpu_locals[MAX_CPUS];
+
+volatile uint64_t kernel_timer_secs = 0;
+
+struct srat_mem_affinity *srat_mem_list[SRAT_MEM_LIST_LEN] = {0};
+uint32_t numa_node_count = 1;
+
+/*
+    A firmware hole and a reserved region split the usable memory, like a real map would.
+*/
+static struct limine_memmap_entry host_entries[HOST_MEMMAP_ENTRIES] = {
+    { 0,            0x100000,                   LIMINE_MEMMAP_RESERVED },
+    { 0x100000,     (256ULL << 20) - 0x100000,  LIMINE_MEMMAP_USABLE },
+    { 256ULL << 20, 2ULL << 20,                 LIMINE_MEMMAP_RESERVED },
+    { 258ULL << 20, HOST_PHYS_SIZE - (258ULL << 20), LIMINE_MEMMAP_USABLE },
+};
+
+static struct limine_memmap_entry *host_entry_list[HOST_MEMMAP_ENTRIES];
+static struct limine_memmap_response host_memmap;
+static struct limine_hhdm_response host_hhdm;
+
+uint32_t acpi_numa_node(uint32_t proximity_domain)
+{
+    (void)proximity_domain;
+    return 0;
+}
+
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id)
+{
+    (void)apic_id;
+    return 0;
+}
+
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node)
+{
+    return from_node == to_node ? 10 : 20;
+}
+
+/*
+    The kernel's %x and %X print a uint64, printf's want a 'l' for that.
+*/
+static void _host_vprintf(const char format[], va_list args)
+{
+    char host_format[512];
+    size_t len = 0;
+
+    for (size_t i = 0; format[i] != '\0' && len < sizeof(host_format) - 2; i++) {
+        if (format[i] == '%' && (format[i + 1] == 'x' || format[i + 1] == 'X')) {
+            host_format[len++] = '%';
+            host_format[len++] = 'l';
+            continue;
+        }
+
+        host_format[len++] = format[i];
+    }
+
+    host_format[len] = '\0';
+    vprintf(host_format, args);
+}
+
+void kprintf(const char format[], ...)
+{
+    va_list args;
+    va_start(args, format);
+    _host_vprintf(format, args);
+    va_end(args);
+}
+
+void write_serial_strf(uint16_t port, const char format[], ...)
+{
+    (void)port;
+
+    va_list args;
+    va_start(args, format);
+    _host_vprintf(format, args);
+    va_end(args);
+}
+
+/*
+    Stands in for the 1 ms timer interrupt that drives kernel_timer_secs.
+*/
+static void *_host_timer(void *pArg)
+{
+    (void)pArg;
+    struct timespec tick = { 0, 1000000 };
+
+    while (true) {
+        nanosleep(&tick, NULL);
+        kernel_timer_secs++;
+    }
+
+    return NULL;
+}
+
+static void _host_memmap_init()
+{
+    uint8_t *pMem = mmap(NULL, HOST_PHYS_SIZE + HOST_ALIGN, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (pMem == MAP_FAILED) {
+        perror("mmap");
+        exit(1);
+    }
+
+    for (int i = 0; i < HOST_MEMMAP_ENTRIES; i++) {
+        host_entry_list[i] = &host_entries[i];
+    }
+
+    host_memmap.entry_count = HOST_MEMMAP_ENTRIES;
+    host_memmap.entries = host_entry_list;
+    host_hhdm.offset = ((uint64_t)pMem + HOST_ALIGN - 1) & ~(HOST_ALIGN - 1);
+
+    memmap_request.response = &host_memmap;
+    hhdm_request.response = &host_hhdm;
+}
+
+int main()
+{
+    cpu_locals[0].self = &cpu_locals[0];
+
+    _host_memmap_init();
+
+    memops_init();
+    kmem_init();
+    kmem_init_deferred();
+    kmem_numa_init();
+
+    pthread_t timer;
+    pthread_create(&timer, NULL, _host_timer, NULL);
+
+    alloc_benchmark();
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+    Host stand-in for src/include/cpu.h, for building the allocators as a Linux program.
+    There's a single CPU and no ring-0, so the GS based per-CPU lookups read a plain
+    variable and the interrupt controls do nothing.
+*/
+#ifndef _BLOREOS_CPU_H
+#define _BLOREOS_CPU_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <str.h>
+
+#define MAX_CPUS    64
+
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[MAX_CPUS];
+
+static inline uint32_t cpu_index()
+{
+    return 0;
+}
+
+static inline uint32_t cpu_node()
+{
+    return cpu_locals[0].node;
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile ("cpuid" : "=a"(*a), "=d"(*d) : "0"(code) : "ebx", "ecx");
+}
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void disable_interrupts()
+{
+}
+
+static inline void enable_interrupts()
+{
+}
+
+static inline bool interrupt_state()
+{
+    return false;
+}
+
+static inline bool set_interrupt_state(bool enabled)
+{
+    (void)enabled;
+    return false;
+}
+
+#endif
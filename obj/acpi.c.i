@@ -0,0 +1,1618 @@
+# 0 "src/acpi.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/acpi.c"
+# 23 "src/acpi.c"
+# 1 "src/include/acpi.h" 1
+# 21 "src/include/acpi.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 22 "src/include/acpi.h" 2
+
+
+# 23 "src/include/acpi.h"
+void acpi_init();
+
+
+struct ioapic
+{
+    char type;
+    char length;
+    char ioapic_id;
+    char reserved;
+    uint32_t ioapic_addr;
+    uint32_t gsi_base;
+} __attribute__((packed));
+
+
+struct iso {
+    char type;
+    char length;
+    uint8_t bus_source;
+    uint8_t irq_source;
+    uint32_t gsi;
+    uint16_t flags;
+} __attribute__((packed));
+
+
+struct sysdesc {
+    char signature[4];
+    uint32_t length;
+    uint8_t revision;
+    uint8_t checksum;
+    char oem_id[6];
+    char oem_table_id[8];
+    uint32_t oem_revision;
+    uint32_t creator_id;
+    uint32_t creator_revision;
+} __attribute__((packed));
+
+struct address_structure
+{
+    uint8_t address_space_id;
+    uint8_t register_bit_width;
+    uint8_t register_bit_offset;
+    uint8_t reserved;
+    uint64_t address;
+} __attribute__((packed));
+
+
+struct hpet
+{
+    struct sysdesc desc;
+    uint8_t hardware_rev_id;
+    uint8_t comparator_count:5;
+    uint8_t counter_size:1;
+    uint8_t reserved:1;
+    uint8_t legacy_replacement:1;
+    uint16_t pci_vendor_id;
+    struct address_structure address;
+    uint8_t hpet_number;
+    uint16_t minimum_tick;
+    uint8_t page_protection;
+} __attribute__((packed));
+
+
+struct mcfg_entry {
+    struct sysdesc desc;
+    char reserved1[8];
+    uint64_t mmio_base;
+    uint16_t segment;
+    uint8_t start;
+    uint8_t end;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+
+struct srat_lapic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint8_t proximity_domain_low;
+    uint8_t apic_id;
+    uint32_t flags;
+    uint8_t sapic_eid;
+    uint8_t proximity_domain_high[3];
+    uint32_t clock_domain;
+} __attribute__((packed));
+
+
+struct srat_mem_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint32_t proximity_domain;
+    uint16_t reserved1;
+    uint64_t base;
+    uint64_t range_length;
+    uint32_t reserved2;
+    uint32_t flags;
+    uint64_t reserved3;
+} __attribute__((packed));
+
+
+struct srat_x2apic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint16_t reserved1;
+    uint32_t proximity_domain;
+    uint32_t x2apic_id;
+    uint32_t flags;
+    uint32_t clock_domain;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+
+struct slit {
+    struct sysdesc desc;
+    uint64_t num_localities;
+    uint8_t entries[];
+} __attribute__((packed));
+# 149 "src/include/acpi.h"
+struct numa_cpu {
+    uint32_t apic_id;
+    uint32_t node;
+};
+
+extern struct ioapic *ioapic_list[];
+extern struct iso *iso_list[];
+extern struct hpet *hpet;
+extern struct mcfg_entry *mcfg;
+extern struct srat_mem_affinity *srat_mem_list[];
+extern uint32_t numa_node_count;
+
+uint32_t acpi_numa_node(uint32_t proximity_domain);
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id);
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node);
+# 24 "src/acpi.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 23 "src/include/mem.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 24 "src/include/mem.h" 2
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 25 "src/acpi.c" 2
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 43 "src/include/cpu.h" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 44 "src/include/cpu.h" 2
+
+
+
+
+
+
+
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 26 "src/acpi.c" 2
+
+
+
+# 1 "src/kernel.h" 1
+# 22 "src/kernel.h"
+# 1 "src/include/queue.h" 1
+# 22 "src/include/queue.h"
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 23 "src/include/queue.h" 2
+
+
+typedef struct {
+    volatile uint32_t read_i;
+    volatile uint32_t write_i;
+    uint32_t *buff;
+    uint32_t len;
+    volatile uint32_t num_items;
+    spinlock_t lock;
+} __attribute__((packed)) CQueue_t;
+
+CQueue_t* cqueue_create(uint32_t len);
+
+# 35 "src/include/queue.h" 3 4
+_Bool 
+# 35 "src/include/queue.h"
+           cqueue_write(CQueue_t *q, uint32_t val);
+uint32_t cqueue_read(CQueue_t *q);
+# 23 "src/kernel.h" 2
+
+void report_cpu_details();
+
+
+static inline void hcf(void)
+{
+    asm("cli");
+    for (;;) {
+        asm("hlt");
+    }
+}
+
+extern CQueue_t *q_keyboard;
+# 30 "src/acpi.c" 2
+# 47 "src/acpi.c"
+struct limine_rsdp_request rsdp_request = {
+    .id = { 0xc7b1dd30df4c8b88, 0x0a82e883a194f07b, 0xc5e77b6b397e7b43, 0x27637845accdcf3c },
+    .revision = 0};
+
+
+struct rsdp {
+    char signature[8];
+    uint8_t checksum;
+    char oemid[6];
+    uint8_t revision;
+    uint32_t rsdt_addr;
+    uint32_t length;
+    uint64_t xsdt_addr;
+    uint8_t ext_checksum;
+    char reserved[3];
+} __attribute__((packed));
+
+
+struct rsdt {
+    char signature[4];
+    uint32_t length;
+    uint8_t revision;
+    uint8_t checksum;
+    char oem_id[6];
+    uint64_t oem_table_id;
+    uint32_t oem_revision;
+    uint32_t creator_id;
+    uint32_t creator_revision;
+    uint32_t entries[];
+} __attribute__((packed));
+
+
+struct xsdt {
+    char signature[4];
+    uint32_t length;
+    uint8_t revision;
+    uint8_t checksum;
+    char oem_id[6];
+    uint64_t oem_table_id;
+    uint32_t oem_revision;
+    uint32_t creator_id;
+    uint32_t creator_revision;
+    uint64_t entries[];
+} __attribute__((packed));
+
+
+struct madt {
+    struct sysdesc desc;
+    uint32_t lapic_addr;
+    uint32_t flags;
+} __attribute__((packed));
+
+struct rsdp *rsdp = 
+# 99 "src/acpi.c" 3 4
+                   ((void *)0)
+# 99 "src/acpi.c"
+                       ;
+struct rsdt *rsdt = 
+# 100 "src/acpi.c" 3 4
+                   ((void *)0)
+# 100 "src/acpi.c"
+                       ;
+struct xsdt *xsdt = 
+# 101 "src/acpi.c" 3 4
+                   ((void *)0)
+# 101 "src/acpi.c"
+                       ;
+struct madt *pMadt = 
+# 102 "src/acpi.c" 3 4
+                    ((void *)0)
+# 102 "src/acpi.c"
+                        ;
+struct hpet *hpet = 
+# 103 "src/acpi.c" 3 4
+                   ((void *)0)
+# 103 "src/acpi.c"
+                       ;
+struct mcfg_entry *mcfg = 
+# 104 "src/acpi.c" 3 4
+                         ((void *)0)
+# 104 "src/acpi.c"
+                             ;
+struct slit *slit = 
+# 105 "src/acpi.c" 3 4
+                   ((void *)0)
+# 105 "src/acpi.c"
+                       ;
+uint32_t entry_size;
+
+
+
+
+struct ioapic *ioapic_list[32] = {0};
+struct iso *iso_list[128] = {0};
+struct srat_mem_affinity *srat_mem_list[64] = {0};
+struct numa_cpu numa_cpu_list[256] = {0};
+uint32_t numa_cpu_count = 0;
+
+
+
+
+
+uint32_t numa_domains[8] = {0};
+uint32_t numa_node_count = 0;
+
+void add_ioapic(struct ioapic *pIOApic)
+{
+    for (int i = 0; i < 32; i++) {
+        if (ioapic_list[i] == 
+# 127 "src/acpi.c" 3 4
+                             ((void *)0)
+# 127 "src/acpi.c"
+                                 ) {
+            ioapic_list[i] = pIOApic;
+            return;
+        }
+    }
+}
+
+void add_iso(struct iso *pIso)
+{
+    for (int i = 0; i < 128; i++) {
+        if (iso_list[i] == 
+# 137 "src/acpi.c" 3 4
+                          ((void *)0)
+# 137 "src/acpi.c"
+                              ) {
+            iso_list[i] = pIso;
+            kprintf("ISO Override: IRQ %d -> GSI %d\n", pIso->irq_source, pIso->gsi);
+            return;
+        }
+    }
+}
+
+
+
+
+
+uint32_t acpi_numa_node(uint32_t proximity_domain)
+{
+    for (uint32_t i = 0; i < numa_node_count; i++) {
+        if (numa_domains[i] == proximity_domain) {
+            return i;
+        }
+    }
+
+    if (numa_node_count == 8) {
+        kprintf("NUMA: Too many proximity domains, domain %d is using node 0.\n", proximity_domain);
+        return 0;
+    }
+
+    numa_domains[numa_node_count] = proximity_domain;
+    return numa_node_count++;
+}
+
+
+
+
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id)
+{
+    for (uint32_t i = 0; i < numa_cpu_count; i++) {
+        if (numa_cpu_list[i].apic_id == apic_id) {
+            return numa_cpu_list[i].node;
+        }
+    }
+
+    return 0;
+}
+
+
+
+
+
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node)
+{
+    if (from_node == to_node) {
+        return 10;
+    }
+
+    if (slit == 
+# 190 "src/acpi.c" 3 4
+               ((void *)0) 
+# 190 "src/acpi.c"
+                    ||
+        numa_domains[from_node] >= slit->num_localities ||
+        numa_domains[to_node] >= slit->num_localities) {
+        return 20;
+    }
+
+    return slit->entries[numa_domains[from_node] * slit->num_localities + numa_domains[to_node]];
+}
+
+void add_numa_cpu(uint32_t apic_id, uint32_t proximity_domain)
+{
+    if (numa_cpu_count == 256) {
+        return;
+    }
+
+    numa_cpu_list[numa_cpu_count].apic_id = apic_id;
+    numa_cpu_list[numa_cpu_count].node = acpi_numa_node(proximity_domain);
+    numa_cpu_count++;
+}
+
+void add_numa_mem(struct srat_mem_affinity *pMem)
+{
+    for (int i = 0; i < 64; i++) {
+        if (srat_mem_list[i] == 
+# 213 "src/acpi.c" 3 4
+                               ((void *)0)
+# 213 "src/acpi.c"
+                                   ) {
+            srat_mem_list[i] = pMem;
+            kprintf("NUMA: Memory 0x%X - 0x%X in node %d\n", pMem->base, pMem->base + pMem->range_length, acpi_numa_node(pMem->proximity_domain));
+            return;
+        }
+    }
+}
+
+
+
+
+void _parse_srat(struct sysdesc *desc)
+{
+
+    char *pItem = (char*)desc + sizeof(struct sysdesc) + 12;
+    char *pEnd = (char*)desc + desc->length;
+
+    while (pItem < pEnd && pItem[1] > 0) {
+        if (*pItem == 0) {
+            struct srat_lapic_affinity *pCpu = (struct srat_lapic_affinity*)pItem;
+
+            if (pCpu->flags & 1) {
+                uint32_t domain = pCpu->proximity_domain_low |
+                    (uint32_t)pCpu->proximity_domain_high[0] << 8 |
+                    (uint32_t)pCpu->proximity_domain_high[1] << 16 |
+                    (uint32_t)pCpu->proximity_domain_high[2] << 24;
+
+                add_numa_cpu(pCpu->apic_id, domain);
+            }
+        } else if (*pItem == 2) {
+            struct srat_x2apic_affinity *pCpu = (struct srat_x2apic_affinity*)pItem;
+
+            if (pCpu->flags & 1) {
+                add_numa_cpu(pCpu->x2apic_id, pCpu->proximity_domain);
+            }
+        } else if (*pItem == 1) {
+            struct srat_mem_affinity *pMem = (struct srat_mem_affinity*)pItem;
+
+            if (pMem->flags & 1) {
+                add_numa_mem(pMem);
+            }
+        }
+
+        pItem += (uint8_t)pItem[1];
+    }
+}
+
+void _parse_madt(struct sysdesc *desc)
+{
+
+    pMadt = (struct madt *)desc;
+
+    kprintf("Start MADT: 0x%X\n", pMadt);
+    kprintf("MADT Length: %d\n", (int)pMadt->desc.length);
+
+
+
+    char *pICLStart = (char *)pMadt + sizeof(struct madt);
+    char *pICLItem = pICLStart;
+
+
+    do
+    {
+
+        if (*pICLItem == 1)
+        {
+            struct ioapic *pIOApic = (struct ioapic *)pICLItem;
+            add_ioapic(pIOApic);
+
+            kprintf("IO APIC ID: %d\n", (int)pIOApic->ioapic_id);
+            kprintf("IO APIC Addr: 0x%X\n", pIOApic->ioapic_addr);
+            kprintf("IO APIC GSI Base: %d\n", pIOApic->gsi_base);
+        }
+        else if (*pICLItem == 2)
+        {
+            struct iso *pIso = (struct iso *)pICLItem;
+            add_iso(pIso);
+        }
+
+
+        if (pICLItem[1] <= 0) {
+
+
+            break;
+        }
+
+        pICLItem += pICLItem[1];
+    } while (pICLItem - pICLStart < pMadt->desc.length);
+}
+# 310 "src/acpi.c"
+void acpi_init()
+{
+    
+# 312 "src/acpi.c" 3 4
+   _Bool 
+# 312 "src/acpi.c"
+        xsdt_enabled = 
+# 312 "src/acpi.c" 3 4
+                       0
+# 312 "src/acpi.c"
+                            ;
+
+    kprintf("Initialzing ACPI...\n");
+
+    rsdp = rsdp_request.response->address;
+    kprintf("RSDP Revision: %d\n", rsdp->revision);
+
+    if (rsdp->revision >= 2) {
+        xsdt_enabled = 
+# 320 "src/acpi.c" 3 4
+                      1
+# 320 "src/acpi.c"
+                          ;
+        xsdt = (struct xsdt*)((uint64_t)rsdp->xsdt_addr + vmm_higher_half_offset);
+        entry_size = (xsdt->length - 36) / 8;
+    } else {
+        rsdt = (struct rsdt*)((uint64_t)rsdp->rsdt_addr + vmm_higher_half_offset);
+        entry_size = (rsdt->length - 36) / 4;
+    }
+
+    kprintf("Entry Size: %d\n", entry_size);
+
+
+    for (uint32_t i = 0; i < entry_size; i++) {
+
+        struct sysdesc *desc = 
+# 333 "src/acpi.c" 3 4
+                              ((void *)0)
+# 333 "src/acpi.c"
+                                  ;
+
+        if (xsdt_enabled) {
+            desc = (struct sysdesc*)((uint64_t)xsdt->entries[i] + vmm_higher_half_offset);
+        } else {
+            desc = (struct sysdesc*)((uint64_t)rsdt->entries[i] + vmm_higher_half_offset);
+        }
+
+        if (memcmp(desc->signature, "HPET", 4) == 0) {
+            hpet = (struct hpet*)desc;
+            continue;
+        }
+
+        if (memcmp(desc->signature, "APIC", 4) == 0) {
+            _parse_madt(desc);
+            continue;
+        }
+
+        if (memcmp(desc->signature, "SRAT", 4) == 0) {
+            _parse_srat(desc);
+            continue;
+        }
+
+        if (memcmp(desc->signature, "SLIT", 4) == 0) {
+            slit = (struct slit*)desc;
+            kprintf("NUMA: SLIT with %lu localities.\n", slit->num_localities);
+            continue;
+        }
+
+        if (memcmp(desc->signature, "MCFG", 4) == 0) {
+            mcfg = (struct mcfg_entry*)desc;
+            kprintf("BAR: 0x%X\n", mcfg->mmio_base);
+            kprintf("Segment: %d\n", mcfg->segment);
+            kprintf("Start: %d\n", mcfg->start);
+            kprintf("End: %d\n", mcfg->end);
+        }
+
+        kprintf("Found ACPI Table: %c%c%c%c\n", desc->signature[0], desc->signature[1], desc->signature[2], desc->signature[3]);
+    }
+
+    if (numa_node_count == 0) {
+
+        numa_node_count = 1;
+    }
+
+    kprintf("NUMA Nodes: %d\n", numa_node_count);
+
+    if (!mcfg) {
+        kprintf("MCFG table not found - MMIO support for PCI not found - quitting.\n");
+        hcf();
+    }
+
+    kprintf("ACPI initialized.\n");
+}
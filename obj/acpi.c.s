@@ -0,0 +1,6819 @@
+	.file	"acpi.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/acpi.c"
+	.p2align 4
+	.globl	add_ioapic
+	.type	add_ioapic, @function
+add_ioapic:
+.LVL0:
+.LFB33:
+	.file 1 "src/acpi.c"
+	.loc 1 125 1 view -0
+	.cfi_startproc
+	.loc 1 126 5 view .LVU1
+.LBB3:
+	.loc 1 126 10 view .LVU2
+	.loc 1 126 23 view .LVU3
+.LBE3:
+	.loc 1 125 1 is_stmt 0 view .LVU4
+	xorl	%eax, %eax
+	leaq	ioapic_list(%rip), %rdx
+	jmp	.L4
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+.LBB4:
+	.loc 1 126 30 is_stmt 1 discriminator 2 view .LVU5
+	.loc 1 126 23 discriminator 2 view .LVU6
+	addq	$1, %rax
+.LVL2:
+	.loc 1 126 23 is_stmt 0 discriminator 2 view .LVU7
+	cmpq	$32, %rax
+	je	.L7
+.LVL3:
+.L4:
+	.loc 1 127 9 is_stmt 1 view .LVU8
+	.loc 1 127 12 is_stmt 0 view .LVU9
+	cmpq	$0, (%rdx,%rax,8)
+	jne	.L2
+	.loc 1 128 13 is_stmt 1 view .LVU10
+	.loc 1 128 28 is_stmt 0 view .LVU11
+	cltq
+	.loc 1 128 28 view .LVU12
+	movq	%rdi, (%rdx,%rax,8)
+	.loc 1 129 13 is_stmt 1 view .LVU13
+	ret
+.LVL4:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 129 13 is_stmt 0 view .LVU14
+.LBE4:
+	.loc 1 132 1 view .LVU15
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	add_ioapic, .-add_ioapic
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"ISO Override: IRQ %d -> GSI %d\n"
+	.text
+	.p2align 4
+	.globl	add_iso
+	.type	add_iso, @function
+add_iso:
+.LVL5:
+.LFB34:
+	.loc 1 135 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 136 5 view .LVU17
+.LBB6:
+	.loc 1 136 10 view .LVU18
+	.loc 1 136 23 view .LVU19
+.LBE6:
+	.loc 1 135 1 is_stmt 0 view .LVU20
+	xorl	%eax, %eax
+	leaq	iso_list(%rip), %rdx
+	jmp	.L10
+.LVL6:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+.LBB7:
+	.loc 1 136 31 is_stmt 1 discriminator 2 view .LVU21
+	.loc 1 136 23 discriminator 2 view .LVU22
+	addq	$1, %rax
+.LVL7:
+	.loc 1 136 23 is_stmt 0 discriminator 2 view .LVU23
+	cmpq	$128, %rax
+	je	.L12
+.LVL8:
+.L10:
+	.loc 1 137 9 is_stmt 1 view .LVU24
+	.loc 1 137 12 is_stmt 0 view .LVU25
+	cmpq	$0, (%rdx,%rax,8)
+	jne	.L9
+	.loc 1 138 13 is_stmt 1 view .LVU26
+	.loc 1 138 25 is_stmt 0 view .LVU27
+	cltq
+	.loc 1 138 25 view .LVU28
+	movq	%rdi, (%rdx,%rax,8)
+	.loc 1 139 13 is_stmt 1 view .LVU29
+	movl	4(%rdi), %edx
+	xorl	%eax, %eax
+.LVL9:
+	.loc 1 139 13 is_stmt 0 view .LVU30
+	movzbl	3(%rdi), %esi
+	leaq	.LC0(%rip), %rdi
+.LVL10:
+	.loc 1 139 13 view .LVU31
+	jmp	kprintf@PLT
+.LVL11:
+.L12:
+	.loc 1 139 13 view .LVU32
+.LBE7:
+	.loc 1 143 1 view .LVU33
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	add_iso, .-add_iso
+	.section	.rodata.str1.8
+	.align 8
+.LC1:
+	.string	"NUMA: Too many proximity domains, domain %d is using node 0.\n"
+	.text
+	.p2align 4
+	.globl	acpi_numa_node
+	.type	acpi_numa_node, @function
+acpi_numa_node:
+.LVL12:
+.LFB35:
+	.loc 1 150 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 151 5 view .LVU35
+.LBB9:
+	.loc 1 151 10 view .LVU36
+	.loc 1 151 28 view .LVU37
+	movl	numa_node_count(%rip), %esi
+	testl	%esi, %esi
+	je	.L19
+	movl	%esi, %ecx
+	xorl	%eax, %eax
+	leaq	numa_domains(%rip), %rdx
+	jmp	.L17
+.LVL13:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.loc 1 151 48 discriminator 2 view .LVU38
+	.loc 1 151 28 discriminator 2 view .LVU39
+	addq	$1, %rax
+.LVL14:
+	.loc 1 151 28 is_stmt 0 discriminator 2 view .LVU40
+	cmpq	%rcx, %rax
+	je	.L25
+.LVL15:
+.L17:
+	.loc 1 152 9 is_stmt 1 view .LVU41
+	.loc 1 152 12 is_stmt 0 view .LVU42
+	cmpl	%edi, (%rdx,%rax,4)
+	jne	.L15
+	movl	%eax, %esi
+.LBE9:
+	.loc 1 164 1 view .LVU43
+	movl	%esi, %eax
+	.loc 1 164 1 view .LVU44
+	ret
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 157 5 is_stmt 1 view .LVU45
+	.loc 1 163 27 is_stmt 0 view .LVU46
+	leal	1(%rsi), %eax
+	.loc 1 157 8 view .LVU47
+	cmpl	$8, %esi
+	je	.L26
+.LVL17:
+.L14:
+	.loc 1 162 5 is_stmt 1 view .LVU48
+	.loc 1 163 27 is_stmt 0 view .LVU49
+	movl	%eax, numa_node_count(%rip)
+	.loc 1 164 1 view .LVU50
+	movl	%esi, %eax
+	.loc 1 162 35 view .LVU51
+	movl	%edi, (%rdx,%rcx,4)
+	.loc 1 163 5 is_stmt 1 view .LVU52
+	.loc 1 164 1 is_stmt 0 view .LVU53
+	ret
+.LVL18:
+.L26:
+	.loc 1 158 9 is_stmt 1 view .LVU54
+	.loc 1 150 1 is_stmt 0 view .LVU55
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 158 9 view .LVU56
+	movl	%edi, %esi
+	leaq	.LC1(%rip), %rdi
+.LVL19:
+	.loc 1 158 9 view .LVU57
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL20:
+	.loc 1 159 9 is_stmt 1 view .LVU58
+	.loc 1 164 1 is_stmt 0 view .LVU59
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL21:
+.L19:
+.LBB10:
+	.loc 1 151 28 view .LVU60
+	movl	$1, %eax
+	xorl	%ecx, %ecx
+	leaq	numa_domains(%rip), %rdx
+	jmp	.L14
+.LBE10:
+	.cfi_endproc
+.LFE35:
+	.size	acpi_numa_node, .-acpi_numa_node
+	.p2align 4
+	.globl	acpi_numa_node_of_apic
+	.type	acpi_numa_node_of_apic, @function
+acpi_numa_node_of_apic:
+.LVL22:
+.LFB36:
+	.loc 1 170 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 171 5 view .LVU62
+.LBB11:
+	.loc 1 171 10 view .LVU63
+	.loc 1 171 28 view .LVU64
+	movl	numa_cpu_count(%rip), %eax
+	testl	%eax, %eax
+	je	.L27
+	xorl	%edx, %edx
+	leaq	numa_cpu_list(%rip), %rcx
+	jmp	.L30
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 171 47 discriminator 2 view .LVU65
+	.loc 1 171 28 discriminator 2 view .LVU66
+	addq	$1, %rdx
+.LVL24:
+	.loc 1 171 28 is_stmt 0 discriminator 2 view .LVU67
+	cmpq	%rax, %rdx
+	je	.L35
+.LVL25:
+.L30:
+	.loc 1 172 9 is_stmt 1 view .LVU68
+	.loc 1 172 12 is_stmt 0 view .LVU69
+	cmpl	%edi, (%rcx,%rdx,8)
+	jne	.L29
+	.loc 1 173 13 is_stmt 1 view .LVU70
+	.loc 1 173 36 is_stmt 0 view .LVU71
+	movl	%edx, %edx
+	.loc 1 173 36 view .LVU72
+	movl	4(%rcx,%rdx,8), %eax
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 173 36 view .LVU73
+.LBE11:
+	.loc 1 177 12 view .LVU74
+	xorl	%eax, %eax
+.LVL27:
+.L27:
+	.loc 1 178 1 view .LVU75
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	acpi_numa_node_of_apic, .-acpi_numa_node_of_apic
+	.p2align 4
+	.globl	acpi_numa_distance
+	.type	acpi_numa_distance, @function
+acpi_numa_distance:
+.LVL28:
+.LFB37:
+	.loc 1 185 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 186 5 view .LVU77
+	.loc 1 186 8 is_stmt 0 view .LVU78
+	cmpl	%esi, %edi
+	je	.L38
+	.loc 1 190 5 is_stmt 1 view .LVU79
+	.loc 1 190 14 is_stmt 0 view .LVU80
+	movq	slit(%rip), %rax
+	.loc 1 190 8 view .LVU81
+	testq	%rax, %rax
+	je	.L39
+	.loc 1 191 21 discriminator 1 view .LVU82
+	movl	%edi, %edi
+	.loc 1 191 21 discriminator 1 view .LVU83
+	leaq	numa_domains(%rip), %r8
+	.loc 1 191 40 discriminator 1 view .LVU84
+	movq	36(%rax), %rcx
+	.loc 1 191 21 discriminator 1 view .LVU85
+	movl	(%r8,%rdi,4), %edx
+	.loc 1 193 16 discriminator 1 view .LVU86
+	movl	$20, %edi
+.LVL29:
+	.loc 1 190 21 discriminator 1 view .LVU87
+	cmpq	%rcx, %rdx
+	jnb	.L36
+	.loc 1 192 21 view .LVU88
+	movl	%esi, %esi
+	.loc 1 192 21 view .LVU89
+	movl	(%r8,%rsi,4), %esi
+.LVL30:
+	.loc 1 191 57 view .LVU90
+	cmpq	%rcx, %rsi
+	jnb	.L36
+	.loc 1 196 5 is_stmt 1 view .LVU91
+	.loc 1 196 50 is_stmt 0 view .LVU92
+	imulq	%rcx, %rdx
+	.loc 1 196 25 view .LVU93
+	addq	%rsi, %rax
+	movzbl	44(%rdx,%rax), %edi
+.L36:
+	.loc 1 197 1 view .LVU94
+	movl	%edi, %eax
+	ret
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 187 16 view .LVU95
+	movl	$10, %edi
+.LVL32:
+	.loc 1 197 1 view .LVU96
+	movl	%edi, %eax
+	ret
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.loc 1 193 16 view .LVU97
+	movl	$20, %edi
+.LVL34:
+	.loc 1 193 16 view .LVU98
+	jmp	.L36
+	.cfi_endproc
+.LFE37:
+	.size	acpi_numa_distance, .-acpi_numa_distance
+	.p2align 4
+	.globl	add_numa_cpu
+	.type	add_numa_cpu, @function
+add_numa_cpu:
+.LVL35:
+.LFB38:
+	.loc 1 200 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 201 5 view .LVU100
+	.loc 1 201 24 is_stmt 0 view .LVU101
+	movl	numa_cpu_count(%rip), %r8d
+	.loc 1 201 8 view .LVU102
+	cmpl	$256, %r8d
+	je	.L55
+	.loc 1 205 5 is_stmt 1 view .LVU103
+	.loc 1 200 1 is_stmt 0 view .LVU104
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 205 43 view .LVU105
+	movl	%r8d, %ebp
+	.loc 1 200 1 view .LVU106
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 205 43 view .LVU107
+	leaq	numa_cpu_list(%rip), %rbx
+	.loc 1 200 1 view .LVU108
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 205 43 view .LVU109
+	movl	%edi, (%rbx,%rbp,8)
+	.loc 1 206 5 is_stmt 1 view .LVU110
+.LVL36:
+.LBB15:
+.LBI15:
+	.loc 1 149 10 view .LVU111
+.LBB16:
+.LBB17:
+	.loc 1 151 28 view .LVU112
+	movl	numa_node_count(%rip), %edi
+.LVL37:
+	.loc 1 151 28 is_stmt 0 view .LVU113
+	testl	%edi, %edi
+	je	.L49
+	movl	%edi, %ecx
+	xorl	%eax, %eax
+	leaq	numa_domains(%rip), %rdx
+	jmp	.L47
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 151 48 is_stmt 1 view .LVU114
+	.loc 1 151 28 view .LVU115
+	addq	$1, %rax
+.LVL39:
+	.loc 1 151 28 is_stmt 0 view .LVU116
+	cmpq	%rcx, %rax
+	je	.L58
+.LVL40:
+.L47:
+	.loc 1 152 9 is_stmt 1 view .LVU117
+	.loc 1 152 12 is_stmt 0 view .LVU118
+	cmpl	(%rdx,%rax,4), %esi
+	jne	.L45
+	movl	%eax, %edi
+.LVL41:
+.L46:
+	.loc 1 152 12 view .LVU119
+.LBE17:
+.LBE16:
+.LBE15:
+	.loc 1 207 19 view .LVU120
+	addl	$1, %r8d
+	.loc 1 206 40 view .LVU121
+	movl	%edi, 4(%rbx,%rbp,8)
+	.loc 1 207 5 is_stmt 1 view .LVU122
+	.loc 1 207 19 is_stmt 0 view .LVU123
+	movl	%r8d, numa_cpu_count(%rip)
+	.loc 1 208 1 view .LVU124
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 208 1 view .LVU125
+	ret
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+.LBB21:
+.LBB19:
+	.loc 1 157 5 is_stmt 1 view .LVU126
+	.loc 1 163 27 is_stmt 0 view .LVU127
+	leal	1(%rdi), %eax
+	.loc 1 157 8 view .LVU128
+	cmpl	$8, %edi
+	je	.L59
+.LVL44:
+.L44:
+	.loc 1 162 5 is_stmt 1 view .LVU129
+	.loc 1 162 35 is_stmt 0 view .LVU130
+	movl	%esi, (%rdx,%rcx,4)
+	.loc 1 163 5 is_stmt 1 view .LVU131
+	.loc 1 163 27 is_stmt 0 view .LVU132
+	movl	%eax, numa_node_count(%rip)
+	jmp	.L46
+.LVL45:
+.L59:
+	.loc 1 158 9 is_stmt 1 view .LVU133
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL46:
+	.loc 1 159 9 view .LVU134
+.LBE19:
+.LBE21:
+	.loc 1 207 19 is_stmt 0 view .LVU135
+	movl	numa_cpu_count(%rip), %r8d
+.LBB22:
+.LBB20:
+	.loc 1 159 16 view .LVU136
+	xorl	%edi, %edi
+	jmp	.L46
+.LVL47:
+.L49:
+.LBB18:
+	.loc 1 151 28 view .LVU137
+	movl	$1, %eax
+	xorl	%ecx, %ecx
+	leaq	numa_domains(%rip), %rdx
+	jmp	.L44
+.LBE18:
+.LBE20:
+.LBE22:
+	.cfi_endproc
+.LFE38:
+	.size	add_numa_cpu, .-add_numa_cpu
+	.section	.rodata.str1.8
+	.align 8
+.LC2:
+	.string	"NUMA: Memory 0x%X - 0x%X in node %d\n"
+	.text
+	.p2align 4
+	.globl	add_numa_mem
+	.type	add_numa_mem, @function
+add_numa_mem:
+.LVL48:
+.LFB39:
+	.loc 1 211 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 212 5 view .LVU139
+.LBB27:
+	.loc 1 212 10 view .LVU140
+	.loc 1 212 23 view .LVU141
+.LBE27:
+	.loc 1 211 1 is_stmt 0 view .LVU142
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 211 1 view .LVU143
+	xorl	%eax, %eax
+	movq	%rdi, %rbx
+	leaq	srat_mem_list(%rip), %rdx
+	jmp	.L67
+.LVL49:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+.LBB39:
+	.loc 1 212 30 is_stmt 1 discriminator 2 view .LVU144
+	.loc 1 212 23 discriminator 2 view .LVU145
+	addq	$1, %rax
+.LVL50:
+	.loc 1 212 23 is_stmt 0 discriminator 2 view .LVU146
+	cmpq	$64, %rax
+	je	.L72
+.LVL51:
+.L67:
+	.loc 1 213 9 is_stmt 1 view .LVU147
+	.loc 1 213 12 is_stmt 0 view .LVU148
+	cmpq	$0, (%rdx,%rax,8)
+	jne	.L61
+	.loc 1 214 13 is_stmt 1 view .LVU149
+.LBB28:
+.LBB29:
+.LBB30:
+	.loc 1 151 28 is_stmt 0 view .LVU150
+	movl	numa_node_count(%rip), %edi
+.LVL52:
+	.loc 1 151 28 view .LVU151
+.LBE30:
+.LBE29:
+.LBE28:
+	.loc 1 214 30 view .LVU152
+	cltq
+	.loc 1 215 13 view .LVU153
+	movl	2(%rbx), %esi
+	.loc 1 214 30 view .LVU154
+	movq	%rbx, (%rdx,%rax,8)
+	.loc 1 215 13 is_stmt 1 view .LVU155
+.LVL53:
+.LBB36:
+.LBI28:
+	.loc 1 149 10 view .LVU156
+.LBB33:
+.LBB31:
+	.loc 1 151 28 view .LVU157
+	testl	%edi, %edi
+	je	.L68
+	.loc 1 151 28 is_stmt 0 view .LVU158
+	movl	%edi, %ecx
+	xorl	%eax, %eax
+.LVL54:
+	.loc 1 151 28 view .LVU159
+	leaq	numa_domains(%rip), %rdx
+	jmp	.L65
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.loc 1 151 48 is_stmt 1 view .LVU160
+	.loc 1 151 28 view .LVU161
+	addq	$1, %rax
+.LVL56:
+	.loc 1 151 28 is_stmt 0 view .LVU162
+	cmpq	%rcx, %rax
+	je	.L73
+.LVL57:
+.L65:
+	.loc 1 152 9 is_stmt 1 view .LVU163
+	.loc 1 152 12 is_stmt 0 view .LVU164
+	cmpl	(%rdx,%rax,4), %esi
+	jne	.L63
+	movl	%eax, %edi
+.LVL58:
+.L64:
+	.loc 1 152 12 view .LVU165
+.LBE31:
+.LBE33:
+.LBE36:
+	.loc 1 215 78 view .LVU166
+	movq	8(%rbx), %rsi
+	.loc 1 215 13 view .LVU167
+	movq	16(%rbx), %rdx
+	movl	%edi, %ecx
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+.LBE39:
+	.loc 1 219 1 view .LVU168
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL59:
+.LBB40:
+	.loc 1 215 13 view .LVU169
+	addq	%rsi, %rdx
+	jmp	kprintf@PLT
+.LVL60:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.cfi_restore_state
+.LBB37:
+.LBB34:
+	.loc 1 157 5 is_stmt 1 view .LVU170
+	.loc 1 163 27 is_stmt 0 view .LVU171
+	leal	1(%rdi), %eax
+	.loc 1 157 8 view .LVU172
+	cmpl	$8, %edi
+	je	.L74
+.LVL61:
+.L62:
+	.loc 1 162 5 is_stmt 1 view .LVU173
+	.loc 1 162 35 is_stmt 0 view .LVU174
+	movl	%esi, (%rdx,%rcx,4)
+	.loc 1 163 5 is_stmt 1 view .LVU175
+	.loc 1 163 27 is_stmt 0 view .LVU176
+	movl	%eax, numa_node_count(%rip)
+	jmp	.L64
+.LVL62:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.loc 1 163 27 view .LVU177
+.LBE34:
+.LBE37:
+.LBE40:
+	.loc 1 219 1 view .LVU178
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL63:
+	.loc 1 219 1 view .LVU179
+	ret
+.LVL64:
+.L74:
+	.cfi_restore_state
+.LBB41:
+.LBB38:
+.LBB35:
+	.loc 1 158 9 is_stmt 1 view .LVU180
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL65:
+	.loc 1 159 9 view .LVU181
+	.loc 1 159 16 is_stmt 0 view .LVU182
+	xorl	%edi, %edi
+	jmp	.L64
+.LVL66:
+.L68:
+.LBB32:
+	.loc 1 151 28 view .LVU183
+	movl	$1, %eax
+.LVL67:
+	.loc 1 151 28 view .LVU184
+	xorl	%ecx, %ecx
+	leaq	numa_domains(%rip), %rdx
+	jmp	.L62
+.LBE32:
+.LBE35:
+.LBE38:
+.LBE41:
+	.cfi_endproc
+.LFE39:
+	.size	add_numa_mem, .-add_numa_mem
+	.p2align 4
+	.globl	_parse_srat
+	.type	_parse_srat, @function
+_parse_srat:
+.LVL68:
+.LFB40:
+	.loc 1 225 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 227 5 view .LVU186
+	.loc 1 225 1 is_stmt 0 view .LVU187
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 227 11 view .LVU188
+	leaq	48(%rdi), %rbx
+.LVL69:
+	.loc 1 228 5 is_stmt 1 view .LVU189
+	.loc 1 225 1 is_stmt 0 view .LVU190
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 228 36 view .LVU191
+	movl	4(%rdi), %eax
+	.loc 1 228 11 view .LVU192
+	leaq	(%rdi,%rax), %rbp
+.LVL70:
+	.loc 1 230 5 is_stmt 1 view .LVU193
+	.loc 1 230 25 view .LVU194
+	cmpq	%rbp, %rbx
+	jb	.L76
+	jmp	.L75
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+.LBB51:
+	.loc 1 232 13 view .LVU195
+	.loc 1 234 13 view .LVU196
+	.loc 1 234 16 is_stmt 0 view .LVU197
+	movl	4(%rbx), %edx
+	andl	$1, %edx
+	jne	.L105
+.LVL72:
+.L78:
+	.loc 1 234 16 view .LVU198
+.LBE51:
+	.loc 1 256 9 is_stmt 1 view .LVU199
+	.loc 1 256 15 is_stmt 0 view .LVU200
+	addq	%rax, %rbx
+.LVL73:
+	.loc 1 230 25 is_stmt 1 view .LVU201
+	cmpq	%rbp, %rbx
+	jnb	.L75
+.L76:
+	.loc 1 230 33 is_stmt 0 discriminator 1 view .LVU202
+	movzbl	1(%rbx), %eax
+	.loc 1 230 25 discriminator 1 view .LVU203
+	testb	%al, %al
+	jle	.L75
+	.loc 1 231 9 is_stmt 1 view .LVU204
+	.loc 1 231 13 is_stmt 0 view .LVU205
+	movzbl	(%rbx), %edx
+	.loc 1 231 12 view .LVU206
+	testb	%dl, %dl
+	je	.L106
+	.loc 1 242 16 is_stmt 1 view .LVU207
+	.loc 1 242 19 is_stmt 0 view .LVU208
+	cmpb	$2, %dl
+	je	.L107
+	.loc 1 248 16 is_stmt 1 view .LVU209
+	.loc 1 248 19 is_stmt 0 view .LVU210
+	cmpb	$1, %dl
+	jne	.L78
+.LBB74:
+	.loc 1 249 13 is_stmt 1 view .LVU211
+.LVL74:
+	.loc 1 251 13 view .LVU212
+	.loc 1 251 16 is_stmt 0 view .LVU213
+	testb	$1, 28(%rbx)
+	je	.L78
+	.loc 1 252 17 is_stmt 1 view .LVU214
+	movq	%rbx, %rdi
+	call	add_numa_mem
+.LVL75:
+.LBE74:
+	.loc 1 256 32 is_stmt 0 view .LVU215
+	movzbl	1(%rbx), %eax
+	.loc 1 256 9 is_stmt 1 view .LVU216
+	.loc 1 256 15 is_stmt 0 view .LVU217
+	addq	%rax, %rbx
+.LVL76:
+	.loc 1 230 25 is_stmt 1 view .LVU218
+	cmpq	%rbp, %rbx
+	jb	.L76
+.LVL77:
+.L75:
+	.loc 1 258 1 is_stmt 0 view .LVU219
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL78:
+	.loc 1 258 1 view .LVU220
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL79:
+	.loc 1 258 1 view .LVU221
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL80:
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	.cfi_restore_state
+.LBB75:
+	.loc 1 243 13 is_stmt 1 view .LVU222
+	.loc 1 245 13 view .LVU223
+	.loc 1 245 16 is_stmt 0 view .LVU224
+	testb	$1, 12(%rbx)
+	je	.L78
+	.loc 1 246 17 is_stmt 1 view .LVU225
+	movl	4(%rbx), %esi
+	movl	8(%rbx), %edi
+	call	add_numa_cpu
+.LVL81:
+.LBE75:
+	.loc 1 256 32 is_stmt 0 view .LVU226
+	movzbl	1(%rbx), %eax
+	jmp	.L78
+.LVL82:
+	.p2align 4,,10
+	.p2align 3
+.L105:
+.LBB76:
+.LBB52:
+	.loc 1 235 17 is_stmt 1 view .LVU227
+	.loc 1 240 17 view .LVU228
+.LBB53:
+.LBI53:
+	.loc 1 199 6 view .LVU229
+.LBB54:
+	.loc 1 201 5 view .LVU230
+	.loc 1 201 24 is_stmt 0 view .LVU231
+	movl	numa_cpu_count(%rip), %r8d
+	.loc 1 201 8 view .LVU232
+	cmpl	$256, %r8d
+	je	.L78
+.LBE54:
+.LBE53:
+	.loc 1 237 21 view .LVU233
+	movzbl	10(%rbx), %esi
+	.loc 1 238 21 view .LVU234
+	movzbl	11(%rbx), %eax
+.LBB69:
+.LBB65:
+	.loc 1 205 43 view .LVU235
+	movl	%r8d, %r13d
+	xorl	%edi, %edi
+.LBB55:
+.LBB56:
+.LBB57:
+	.loc 1 151 28 view .LVU236
+	movl	numa_node_count(%rip), %r9d
+.LBE57:
+.LBE56:
+.LBE55:
+	.loc 1 205 43 view .LVU237
+	leaq	numa_cpu_list(%rip), %r12
+	leaq	numa_domains(%rip), %rcx
+.LBE65:
+.LBE69:
+	.loc 1 238 62 view .LVU238
+	sall	$24, %eax
+	.loc 1 237 62 view .LVU239
+	sall	$16, %esi
+	.loc 1 235 26 view .LVU240
+	orl	%eax, %esi
+	.loc 1 235 39 view .LVU241
+	movzbl	2(%rbx), %eax
+	.loc 1 235 26 view .LVU242
+	orl	%eax, %esi
+	.loc 1 236 21 view .LVU243
+	movzbl	9(%rbx), %eax
+	.loc 1 236 62 view .LVU244
+	sall	$8, %eax
+	.loc 1 235 26 view .LVU245
+	orl	%eax, %esi
+.LBB70:
+.LBB66:
+	.loc 1 205 5 is_stmt 1 view .LVU246
+.LBE66:
+.LBE70:
+	.loc 1 240 17 is_stmt 0 view .LVU247
+	movzbl	3(%rbx), %eax
+	movl	%eax, (%r12,%r13,8)
+.LVL83:
+.LBB71:
+.LBB67:
+	.loc 1 206 5 is_stmt 1 view .LVU248
+.LBB62:
+.LBI55:
+	.loc 1 149 10 view .LVU249
+.LBB59:
+.LBB58:
+	.loc 1 151 28 view .LVU250
+	testl	%r9d, %r9d
+	je	.L79
+	movl	%r9d, %edi
+	xorl	%eax, %eax
+.LVL84:
+	.loc 1 151 28 is_stmt 0 view .LVU251
+	leaq	numa_domains(%rip), %rcx
+	jmp	.L82
+.LVL85:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.loc 1 151 48 is_stmt 1 view .LVU252
+	.loc 1 151 28 view .LVU253
+	addq	$1, %rax
+.LVL86:
+	.loc 1 151 28 is_stmt 0 view .LVU254
+	cmpq	%rdi, %rax
+	je	.L108
+.LVL87:
+.L82:
+	.loc 1 152 9 is_stmt 1 view .LVU255
+	.loc 1 152 12 is_stmt 0 view .LVU256
+	cmpl	(%rcx,%rax,4), %esi
+	jne	.L80
+	movl	%eax, %r9d
+.LVL88:
+.L81:
+	.loc 1 152 12 view .LVU257
+.LBE58:
+.LBE59:
+.LBE62:
+	.loc 1 207 19 view .LVU258
+	addl	$1, %r8d
+	.loc 1 206 40 view .LVU259
+	movl	%r9d, 4(%r12,%r13,8)
+	.loc 1 207 5 is_stmt 1 view .LVU260
+	.loc 1 207 19 is_stmt 0 view .LVU261
+	movl	%r8d, numa_cpu_count(%rip)
+.LBE67:
+.LBE71:
+.LBE52:
+.LBE76:
+	.loc 1 256 32 view .LVU262
+	movzbl	1(%rbx), %eax
+	jmp	.L78
+.LVL89:
+	.p2align 4,,10
+	.p2align 3
+.L108:
+.LBB77:
+.LBB73:
+.LBB72:
+.LBB68:
+.LBB63:
+.LBB60:
+	.loc 1 157 5 is_stmt 1 view .LVU263
+	.loc 1 163 27 is_stmt 0 view .LVU264
+	leal	1(%r9), %edx
+	.loc 1 157 8 view .LVU265
+	cmpl	$8, %r9d
+	je	.L109
+.LVL90:
+.L79:
+	.loc 1 162 5 is_stmt 1 view .LVU266
+	.loc 1 162 35 is_stmt 0 view .LVU267
+	movl	%esi, (%rcx,%rdi,4)
+	.loc 1 163 5 is_stmt 1 view .LVU268
+	.loc 1 163 27 is_stmt 0 view .LVU269
+	movl	%edx, numa_node_count(%rip)
+	jmp	.L81
+.LVL91:
+.L109:
+	.loc 1 158 9 is_stmt 1 view .LVU270
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL92:
+	.loc 1 159 9 view .LVU271
+.LBE60:
+.LBE63:
+	.loc 1 207 19 is_stmt 0 view .LVU272
+	movl	numa_cpu_count(%rip), %r8d
+.LBB64:
+.LBB61:
+	.loc 1 159 16 view .LVU273
+	xorl	%r9d, %r9d
+	jmp	.L81
+.LBE61:
+.LBE64:
+.LBE68:
+.LBE72:
+.LBE73:
+.LBE77:
+	.cfi_endproc
+.LFE40:
+	.size	_parse_srat, .-_parse_srat
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"Start MADT: 0x%X\n"
+.LC4:
+	.string	"MADT Length: %d\n"
+.LC5:
+	.string	"IO APIC ID: %d\n"
+.LC6:
+	.string	"IO APIC Addr: 0x%X\n"
+.LC7:
+	.string	"IO APIC GSI Base: %d\n"
+	.text
+	.p2align 4
+	.globl	_parse_madt
+	.type	_parse_madt, @function
+_parse_madt:
+.LVL93:
+.LFB41:
+	.loc 1 261 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 263 5 view .LVU275
+	.loc 1 261 1 is_stmt 0 view .LVU276
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %rsi
+	.loc 1 265 5 view .LVU277
+	xorl	%eax, %eax
+	.loc 1 261 1 view .LVU278
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	leaq	ioapic_list(%rip), %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	iso_list(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+.LBB86:
+.LBB87:
+.LBB88:
+	.loc 1 139 13 view .LVU279
+	leaq	.LC0(%rip), %rbp
+.LBE88:
+.LBE87:
+.LBE86:
+	.loc 1 261 1 view .LVU280
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB91:
+	.loc 1 282 13 view .LVU281
+	leaq	.LC5(%rip), %rbx
+.LBE91:
+	.loc 1 261 1 view .LVU282
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 263 11 view .LVU283
+	movq	%rdi, pMadt(%rip)
+	.loc 1 265 5 is_stmt 1 view .LVU284
+	leaq	.LC3(%rip), %rdi
+.LVL94:
+	.loc 1 265 5 is_stmt 0 view .LVU285
+	call	kprintf@PLT
+.LVL95:
+	.loc 1 266 5 is_stmt 1 view .LVU286
+	.loc 1 266 50 is_stmt 0 view .LVU287
+	movq	pMadt(%rip), %rax
+	.loc 1 266 5 view .LVU288
+	leaq	.LC4(%rip), %rdi
+	movl	4(%rax), %esi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL96:
+	.loc 1 270 5 is_stmt 1 view .LVU289
+	.loc 1 270 11 is_stmt 0 view .LVU290
+	movq	pMadt(%rip), %rax
+	leaq	44(%rax), %r15
+.LVL97:
+	.loc 1 271 5 is_stmt 1 view .LVU291
+	.loc 1 271 11 is_stmt 0 view .LVU292
+	movq	%r15, %r12
+	jmp	.L119
+.LVL98:
+	.p2align 4,,10
+	.p2align 3
+.L111:
+	.loc 1 286 14 is_stmt 1 view .LVU293
+	.loc 1 286 17 is_stmt 0 view .LVU294
+	cmpb	$2, %al
+	je	.L124
+.L115:
+	.loc 1 293 9 is_stmt 1 view .LVU295
+	.loc 1 293 21 is_stmt 0 view .LVU296
+	movsbq	1(%r12), %rax
+	.loc 1 293 12 view .LVU297
+	testb	%al, %al
+	jle	.L110
+.L125:
+	.loc 1 299 9 is_stmt 1 view .LVU298
+	.loc 1 299 18 is_stmt 0 view .LVU299
+	addq	%rax, %r12
+.LVL99:
+	.loc 1 300 35 is_stmt 1 view .LVU300
+	.loc 1 300 48 is_stmt 0 view .LVU301
+	movq	pMadt(%rip), %rax
+	.loc 1 300 23 view .LVU302
+	movq	%r12, %rdx
+	.loc 1 300 48 view .LVU303
+	movl	4(%rax), %eax
+	.loc 1 300 23 view .LVU304
+	subq	%r15, %rdx
+	.loc 1 300 35 view .LVU305
+	cmpq	%rax, %rdx
+	jge	.L110
+.L119:
+	.loc 1 274 5 is_stmt 1 view .LVU306
+	.loc 1 277 9 view .LVU307
+	.loc 1 277 13 is_stmt 0 view .LVU308
+	movzbl	(%r12), %eax
+	.loc 1 277 12 view .LVU309
+	cmpb	$1, %al
+	jne	.L111
+	.loc 1 277 12 view .LVU310
+	xorl	%eax, %eax
+	jmp	.L114
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+.LBB94:
+.LBB92:
+.LBB93:
+	.loc 1 126 30 is_stmt 1 view .LVU311
+	.loc 1 126 23 view .LVU312
+	addq	$1, %rax
+.LVL101:
+	.loc 1 126 23 is_stmt 0 view .LVU313
+	cmpq	$32, %rax
+	je	.L113
+.LVL102:
+.L114:
+	.loc 1 127 9 is_stmt 1 view .LVU314
+	.loc 1 127 12 is_stmt 0 view .LVU315
+	cmpq	$0, (%r14,%rax,8)
+	jne	.L112
+	.loc 1 128 13 is_stmt 1 view .LVU316
+	.loc 1 128 28 is_stmt 0 view .LVU317
+	cltq
+	.loc 1 128 28 view .LVU318
+	movq	%r12, (%r14,%rax,8)
+	.loc 1 129 13 is_stmt 1 view .LVU319
+.LVL103:
+.L113:
+	.loc 1 129 13 is_stmt 0 view .LVU320
+.LBE93:
+.LBE92:
+	.loc 1 282 13 is_stmt 1 view .LVU321
+	movsbl	2(%r12), %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL104:
+	.loc 1 283 13 view .LVU322
+	movl	4(%r12), %esi
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL105:
+	.loc 1 284 13 view .LVU323
+	movl	8(%r12), %esi
+	xorl	%eax, %eax
+	leaq	.LC7(%rip), %rdi
+	call	kprintf@PLT
+.LVL106:
+.LBE94:
+	.loc 1 293 9 view .LVU324
+	.loc 1 293 21 is_stmt 0 view .LVU325
+	movsbq	1(%r12), %rax
+	.loc 1 293 12 view .LVU326
+	testb	%al, %al
+	jg	.L125
+.L110:
+	.loc 1 301 1 view .LVU327
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL107:
+	.loc 1 301 1 view .LVU328
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+.LVL108:
+	.loc 1 301 1 view .LVU329
+	ret
+.LVL109:
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	.cfi_restore_state
+	.loc 1 301 1 view .LVU330
+	xorl	%eax, %eax
+	jmp	.L117
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L116:
+.LBB95:
+.LBB90:
+.LBB89:
+	.loc 1 136 31 is_stmt 1 view .LVU331
+	.loc 1 136 23 view .LVU332
+	addq	$1, %rax
+.LVL111:
+	.loc 1 136 23 is_stmt 0 view .LVU333
+	cmpq	$128, %rax
+	je	.L115
+.LVL112:
+.L117:
+	.loc 1 137 9 is_stmt 1 view .LVU334
+	.loc 1 137 12 is_stmt 0 view .LVU335
+	cmpq	$0, 0(%r13,%rax,8)
+	jne	.L116
+	.loc 1 138 13 is_stmt 1 view .LVU336
+	.loc 1 138 25 is_stmt 0 view .LVU337
+	cltq
+	.loc 1 139 13 view .LVU338
+	movl	4(%r12), %edx
+	movq	%rbp, %rdi
+	.loc 1 138 25 view .LVU339
+	movq	%r12, 0(%r13,%rax,8)
+	.loc 1 139 13 is_stmt 1 view .LVU340
+	movzbl	3(%r12), %esi
+	xorl	%eax, %eax
+.LVL113:
+	.loc 1 139 13 is_stmt 0 view .LVU341
+	call	kprintf@PLT
+.LVL114:
+	.loc 1 140 13 is_stmt 1 view .LVU342
+	jmp	.L115
+.LBE89:
+.LBE90:
+.LBE95:
+	.cfi_endproc
+.LFE41:
+	.size	_parse_madt, .-_parse_madt
+	.section	.rodata.str1.1
+.LC8:
+	.string	"Initialzing ACPI...\n"
+.LC9:
+	.string	"RSDP Revision: %d\n"
+.LC10:
+	.string	"Entry Size: %d\n"
+.LC11:
+	.string	"HPET"
+.LC12:
+	.string	"APIC"
+.LC13:
+	.string	"SRAT"
+.LC14:
+	.string	"SLIT"
+	.section	.rodata.str1.8
+	.align 8
+.LC15:
+	.string	"NUMA: SLIT with %lu localities.\n"
+	.section	.rodata.str1.1
+.LC16:
+	.string	"MCFG"
+.LC17:
+	.string	"BAR: 0x%X\n"
+.LC18:
+	.string	"Segment: %d\n"
+.LC19:
+	.string	"Start: %d\n"
+.LC20:
+	.string	"End: %d\n"
+.LC21:
+	.string	"Found ACPI Table: %c%c%c%c\n"
+.LC22:
+	.string	"NUMA Nodes: %d\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"MCFG table not found - MMIO support for PCI not found - quitting.\n"
+	.section	.rodata.str1.1
+.LC24:
+	.string	"ACPI initialized.\n"
+	.text
+	.p2align 4
+	.globl	acpi_init
+	.type	acpi_init, @function
+acpi_init:
+.LFB42:
+	.loc 1 311 1 view -0
+	.cfi_startproc
+	.loc 1 312 4 view .LVU344
+.LVL115:
+	.loc 1 314 5 view .LVU345
+	.loc 1 311 1 is_stmt 0 view .LVU346
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 314 5 view .LVU347
+	xorl	%eax, %eax
+	leaq	.LC8(%rip), %rdi
+	.loc 1 311 1 view .LVU348
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 314 5 view .LVU349
+	call	kprintf@PLT
+.LVL116:
+	.loc 1 316 5 is_stmt 1 view .LVU350
+	.loc 1 316 33 is_stmt 0 view .LVU351
+	movq	40+rsdp_request(%rip), %rax
+	.loc 1 317 5 view .LVU352
+	leaq	.LC9(%rip), %rdi
+	.loc 1 316 33 view .LVU353
+	movq	8(%rax), %rax
+	.loc 1 317 5 view .LVU354
+	movzbl	15(%rax), %esi
+	.loc 1 316 10 view .LVU355
+	movq	%rax, rsdp(%rip)
+	.loc 1 317 5 is_stmt 1 view .LVU356
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL117:
+	.loc 1 319 5 view .LVU357
+	.loc 1 319 13 is_stmt 0 view .LVU358
+	movq	rsdp(%rip), %rax
+	.loc 1 319 8 view .LVU359
+	cmpb	$1, 15(%rax)
+	jbe	.L127
+	.loc 1 320 9 is_stmt 1 view .LVU360
+.LVL118:
+	.loc 1 321 9 view .LVU361
+	.loc 1 321 57 is_stmt 0 view .LVU362
+	movq	vmm_higher_half_offset(%rip), %rdx
+	addq	24(%rax), %rdx
+	.loc 1 320 22 view .LVU363
+	movl	$1, %r13d
+	.loc 1 322 36 view .LVU364
+	movl	4(%rdx), %esi
+	.loc 1 321 14 view .LVU365
+	movq	%rdx, xsdt(%rip)
+	.loc 1 322 9 is_stmt 1 view .LVU366
+	.loc 1 322 36 is_stmt 0 view .LVU367
+	subl	$36, %esi
+	.loc 1 322 42 view .LVU368
+	shrl	$3, %esi
+.LVL119:
+.L128:
+	.loc 1 328 5 view .LVU369
+	xorl	%eax, %eax
+	leaq	.LC10(%rip), %rdi
+	movl	%esi, entry_size(%rip)
+.LVL120:
+	.loc 1 328 5 is_stmt 1 view .LVU370
+.LBB100:
+	.loc 1 331 19 is_stmt 0 view .LVU371
+	xorl	%ebp, %ebp
+.LBE100:
+	.loc 1 328 5 view .LVU372
+	call	kprintf@PLT
+.LVL121:
+	.loc 1 331 5 is_stmt 1 view .LVU373
+.LBB107:
+	.loc 1 331 10 view .LVU374
+	.loc 1 331 28 view .LVU375
+	movl	entry_size(%rip), %eax
+	leaq	.LC11(%rip), %r12
+.LBB101:
+	.loc 1 346 13 is_stmt 0 view .LVU376
+	leaq	.LC12(%rip), %r14
+	.loc 1 351 13 view .LVU377
+	leaq	.LC13(%rip), %r15
+.LBE101:
+	.loc 1 331 28 view .LVU378
+	testl	%eax, %eax
+	jne	.L129
+	jmp	.L140
+.LVL122:
+	.p2align 4,,10
+	.p2align 3
+.L147:
+.LBB102:
+	.loc 1 336 13 is_stmt 1 view .LVU379
+	.loc 1 336 65 is_stmt 0 view .LVU380
+	movq	xsdt(%rip), %rdx
+	addq	36(%rdx,%rax,8), %rbx
+.LVL123:
+.L133:
+	.loc 1 341 9 is_stmt 1 view .LVU381
+	.loc 1 341 13 is_stmt 0 view .LVU382
+	movl	$4, %edx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+.LVL124:
+	.loc 1 341 12 view .LVU383
+	testl	%eax, %eax
+	jne	.L134
+	.loc 1 342 13 is_stmt 1 discriminator 1 view .LVU384
+	.loc 1 342 18 is_stmt 0 discriminator 1 view .LVU385
+	movq	%rbx, hpet(%rip)
+	.loc 1 343 13 is_stmt 1 discriminator 1 view .LVU386
+.L135:
+	.loc 1 343 13 is_stmt 0 discriminator 1 view .LVU387
+.LBE102:
+	.loc 1 331 43 is_stmt 1 discriminator 2 view .LVU388
+	addl	$1, %ebp
+.LVL125:
+	.loc 1 331 28 discriminator 2 view .LVU389
+	cmpl	entry_size(%rip), %ebp
+	jnb	.L140
+.LVL126:
+.L129:
+.LBB103:
+	.loc 1 333 9 view .LVU390
+	.loc 1 335 9 view .LVU391
+	.loc 1 336 65 is_stmt 0 view .LVU392
+	movq	vmm_higher_half_offset(%rip), %rbx
+	.loc 1 336 61 view .LVU393
+	movl	%ebp, %eax
+	.loc 1 335 12 view .LVU394
+	testb	%r13b, %r13b
+	jne	.L147
+	.loc 1 338 13 is_stmt 1 view .LVU395
+	.loc 1 338 38 is_stmt 0 view .LVU396
+	movq	rsdt(%rip), %rdx
+	movl	36(%rdx,%rax,4), %eax
+	.loc 1 338 65 view .LVU397
+	addq	%rax, %rbx
+.LVL127:
+	.loc 1 338 65 view .LVU398
+	jmp	.L133
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	.loc 1 346 9 is_stmt 1 view .LVU399
+	.loc 1 346 13 is_stmt 0 view .LVU400
+	movl	$4, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+.LVL128:
+	.loc 1 346 12 view .LVU401
+	testl	%eax, %eax
+	je	.L148
+	.loc 1 351 9 is_stmt 1 view .LVU402
+	.loc 1 351 13 is_stmt 0 view .LVU403
+	movl	$4, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+.LVL129:
+	.loc 1 351 12 view .LVU404
+	testl	%eax, %eax
+	je	.L149
+	.loc 1 356 9 is_stmt 1 view .LVU405
+	.loc 1 356 13 is_stmt 0 view .LVU406
+	movl	$4, %edx
+	leaq	.LC14(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+.LVL130:
+	.loc 1 356 12 view .LVU407
+	testl	%eax, %eax
+	je	.L150
+	.loc 1 362 9 is_stmt 1 view .LVU408
+	.loc 1 362 13 is_stmt 0 view .LVU409
+	movl	$4, %edx
+	leaq	.LC16(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp@PLT
+.LVL131:
+	.loc 1 362 12 view .LVU410
+	testl	%eax, %eax
+	je	.L151
+.L139:
+	.loc 1 370 9 is_stmt 1 view .LVU411
+	movsbl	2(%rbx), %ecx
+	movsbl	1(%rbx), %edx
+	xorl	%eax, %eax
+.LBE103:
+	.loc 1 331 43 is_stmt 0 view .LVU412
+	addl	$1, %ebp
+.LVL132:
+.LBB104:
+	.loc 1 370 9 view .LVU413
+	movsbl	(%rbx), %esi
+	movsbl	3(%rbx), %r8d
+	leaq	.LC21(%rip), %rdi
+	call	kprintf@PLT
+.LVL133:
+.LBE104:
+	.loc 1 331 43 is_stmt 1 view .LVU414
+	.loc 1 331 28 view .LVU415
+	cmpl	entry_size(%rip), %ebp
+	jb	.L129
+.LVL134:
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	.loc 1 331 28 is_stmt 0 view .LVU416
+.LBE107:
+	.loc 1 373 5 is_stmt 1 view .LVU417
+	.loc 1 373 25 is_stmt 0 view .LVU418
+	movl	numa_node_count(%rip), %esi
+	.loc 1 373 8 view .LVU419
+	testl	%esi, %esi
+	jne	.L131
+	.loc 1 375 9 is_stmt 1 view .LVU420
+	.loc 1 375 25 is_stmt 0 view .LVU421
+	movl	$1, numa_node_count(%rip)
+	movl	$1, %esi
+.L131:
+	.loc 1 378 5 is_stmt 1 view .LVU422
+	xorl	%eax, %eax
+	leaq	.LC22(%rip), %rdi
+	call	kprintf@PLT
+.LVL135:
+	.loc 1 380 5 view .LVU423
+	.loc 1 380 8 is_stmt 0 view .LVU424
+	cmpq	$0, mcfg(%rip)
+	je	.L152
+	.loc 1 385 5 is_stmt 1 view .LVU425
+	.loc 1 386 1 is_stmt 0 view .LVU426
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 385 5 view .LVU427
+	leaq	.LC24(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 386 1 view .LVU428
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+.LVL136:
+	.loc 1 386 1 view .LVU429
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 385 5 view .LVU430
+	jmp	kprintf@PLT
+.LVL137:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.cfi_restore_state
+.LBB108:
+.LBB105:
+	.loc 1 347 13 is_stmt 1 discriminator 1 view .LVU431
+	movq	%rbx, %rdi
+	call	_parse_madt
+.LVL138:
+	.loc 1 348 13 discriminator 1 view .LVU432
+	jmp	.L135
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	.loc 1 352 13 discriminator 1 view .LVU433
+	movq	%rbx, %rdi
+	call	_parse_srat
+.LVL139:
+	.loc 1 353 13 discriminator 1 view .LVU434
+	jmp	.L135
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.loc 1 357 13 discriminator 1 view .LVU435
+	.loc 1 358 13 is_stmt 0 discriminator 1 view .LVU436
+	movq	36(%rbx), %rsi
+	leaq	.LC15(%rip), %rdi
+	.loc 1 357 18 discriminator 1 view .LVU437
+	movq	%rbx, slit(%rip)
+	.loc 1 358 13 is_stmt 1 discriminator 1 view .LVU438
+	call	kprintf@PLT
+.LVL140:
+	.loc 1 359 13 discriminator 1 view .LVU439
+	jmp	.L135
+.LVL141:
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	.loc 1 359 13 is_stmt 0 discriminator 1 view .LVU440
+.LBE105:
+.LBE108:
+	.loc 1 324 9 is_stmt 1 view .LVU441
+	.loc 1 324 31 is_stmt 0 view .LVU442
+	movl	16(%rax), %eax
+	.loc 1 324 57 view .LVU443
+	addq	vmm_higher_half_offset(%rip), %rax
+	.loc 1 312 9 view .LVU444
+	xorl	%r13d, %r13d
+	.loc 1 325 36 view .LVU445
+	movl	4(%rax), %esi
+	.loc 1 324 14 view .LVU446
+	movq	%rax, rsdt(%rip)
+	.loc 1 325 9 is_stmt 1 view .LVU447
+	.loc 1 325 36 is_stmt 0 view .LVU448
+	subl	$36, %esi
+	.loc 1 325 42 view .LVU449
+	shrl	$2, %esi
+	jmp	.L128
+.LVL142:
+	.p2align 4,,10
+	.p2align 3
+.L151:
+.LBB109:
+.LBB106:
+	.loc 1 363 13 is_stmt 1 view .LVU450
+	.loc 1 364 13 is_stmt 0 view .LVU451
+	movq	44(%rbx), %rsi
+	leaq	.LC17(%rip), %rdi
+	.loc 1 363 18 view .LVU452
+	movq	%rbx, mcfg(%rip)
+	.loc 1 364 13 is_stmt 1 view .LVU453
+	call	kprintf@PLT
+.LVL143:
+	.loc 1 365 13 view .LVU454
+	.loc 1 365 42 is_stmt 0 view .LVU455
+	movq	mcfg(%rip), %rax
+	.loc 1 365 13 view .LVU456
+	leaq	.LC18(%rip), %rdi
+	movzwl	52(%rax), %esi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL144:
+	.loc 1 366 13 is_stmt 1 view .LVU457
+	.loc 1 366 40 is_stmt 0 view .LVU458
+	movq	mcfg(%rip), %rax
+	.loc 1 366 13 view .LVU459
+	leaq	.LC19(%rip), %rdi
+	movzbl	54(%rax), %esi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL145:
+	.loc 1 367 13 is_stmt 1 view .LVU460
+	.loc 1 367 38 is_stmt 0 view .LVU461
+	movq	mcfg(%rip), %rax
+	.loc 1 367 13 view .LVU462
+	leaq	.LC20(%rip), %rdi
+	movzbl	55(%rax), %esi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL146:
+	jmp	.L139
+.LVL147:
+.L152:
+	.loc 1 367 13 view .LVU463
+.LBE106:
+.LBE109:
+	.loc 1 381 9 is_stmt 1 view .LVU464
+	leaq	.LC23(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL148:
+	.loc 1 382 9 view .LVU465
+.LBB110:
+.LBI110:
+	.file 2 "src/kernel.h"
+	.loc 2 27 20 view .LVU466
+.LBB111:
+	.loc 2 29 5 view .LVU467
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.L142:
+	.loc 2 30 5 view .LVU468
+	.loc 2 31 9 view .LVU469
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 2 30 5 view .LVU470
+#NO_APP
+	jmp	.L142
+.LBE111:
+.LBE110:
+	.cfi_endproc
+.LFE42:
+	.size	acpi_init, .-acpi_init
+	.globl	numa_node_count
+	.bss
+	.align 4
+	.type	numa_node_count, @object
+	.size	numa_node_count, 4
+numa_node_count:
+	.zero	4
+	.globl	numa_domains
+	.align 32
+	.type	numa_domains, @object
+	.size	numa_domains, 32
+numa_domains:
+	.zero	32
+	.globl	numa_cpu_count
+	.align 4
+	.type	numa_cpu_count, @object
+	.size	numa_cpu_count, 4
+numa_cpu_count:
+	.zero	4
+	.globl	numa_cpu_list
+	.align 32
+	.type	numa_cpu_list, @object
+	.size	numa_cpu_list, 2048
+numa_cpu_list:
+	.zero	2048
+	.globl	srat_mem_list
+	.align 32
+	.type	srat_mem_list, @object
+	.size	srat_mem_list, 512
+srat_mem_list:
+	.zero	512
+	.globl	iso_list
+	.align 32
+	.type	iso_list, @object
+	.size	iso_list, 1024
+iso_list:
+	.zero	1024
+	.globl	ioapic_list
+	.align 32
+	.type	ioapic_list, @object
+	.size	ioapic_list, 256
+ioapic_list:
+	.zero	256
+	.globl	entry_size
+	.align 4
+	.type	entry_size, @object
+	.size	entry_size, 4
+entry_size:
+	.zero	4
+	.globl	slit
+	.align 8
+	.type	slit, @object
+	.size	slit, 8
+slit:
+	.zero	8
+	.globl	mcfg
+	.align 8
+	.type	mcfg, @object
+	.size	mcfg, 8
+mcfg:
+	.zero	8
+	.globl	hpet
+	.align 8
+	.type	hpet, @object
+	.size	hpet, 8
+hpet:
+	.zero	8
+	.globl	pMadt
+	.align 8
+	.type	pMadt, @object
+	.size	pMadt, 8
+pMadt:
+	.zero	8
+	.globl	xsdt
+	.align 8
+	.type	xsdt, @object
+	.size	xsdt, 8
+xsdt:
+	.zero	8
+	.globl	rsdt
+	.align 8
+	.type	rsdt, @object
+	.size	rsdt, 8
+rsdt:
+	.zero	8
+	.globl	rsdp
+	.align 8
+	.type	rsdp, @object
+	.size	rsdp, 8
+rsdp:
+	.zero	8
+	.globl	rsdp_request
+	.data
+	.align 32
+	.type	rsdp_request, @object
+	.size	rsdp_request, 48
+rsdp_request:
+	.quad	-4057218587309601912
+	.quad	757423339400917115
+	.quad	-4186241628161279165
+	.quad	2838244430820790076
+	.quad	0
+	.zero	8
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "src/include/acpi.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "src/include/limine.h"
+	.file 7 "src/include/mem.h"
+	.file 8 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x13d3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2c
+	.long	.LASF123
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xf
+	.long	.LASF6
+	.byte	0x3
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xf
+	.long	.LASF7
+	.byte	0x3
+	.byte	0x31
+	.byte	0x1c
+	.long	0x69
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xf
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x34
+	.byte	0x16
+	.long	0x7c
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0xf
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x37
+	.byte	0x1b
+	.long	0x8f
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0xc
+	.byte	0x4
+	.byte	0x1a
+	.long	0xf1
+	.uleb128 0x1
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x1c
+	.byte	0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1d
+	.byte	0xa
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x1e
+	.byte	0xa
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x1f
+	.byte	0xa
+	.long	0xf1
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x20
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x70
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF19
+	.uleb128 0x2e
+	.long	0xf1
+	.uleb128 0x2f
+	.string	"iso"
+	.byte	0xa
+	.byte	0x4
+	.byte	0x25
+	.byte	0x8
+	.long	0x158
+	.uleb128 0x1
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x26
+	.byte	0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x27
+	.byte	0xa
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x28
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x29
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x24
+	.string	"gsi"
+	.byte	0x2a
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xe
+	.long	0x5d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x24
+	.byte	0x4
+	.byte	0x2f
+	.long	0x1da
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x30
+	.byte	0xa
+	.long	0x1da
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x31
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x32
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x33
+	.byte	0xd
+	.long	0x4a
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x34
+	.byte	0xa
+	.long	0x1ea
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x35
+	.byte	0xa
+	.long	0x1fa
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x36
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x37
+	.byte	0xe
+	.long	0x70
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x38
+	.byte	0xe
+	.long	0x70
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0xf1
+	.long	0x1ea
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	0xf1
+	.long	0x1fa
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	0xf1
+	.long	0x20a
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF33
+	.byte	0xc
+	.byte	0x4
+	.byte	0x3b
+	.long	0x258
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x3d
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x3e
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x3f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x40
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x41
+	.byte	0xe
+	.long	0x83
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF38
+	.byte	0x38
+	.byte	0x4
+	.byte	0x45
+	.long	0x2f4
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x47
+	.byte	0x14
+	.long	0x158
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0x4a
+	.byte	0x24
+	.uleb128 0x11
+	.long	.LASF41
+	.byte	0x49
+	.long	0x4a
+	.byte	0x5
+	.value	0x128
+	.uleb128 0x11
+	.long	.LASF42
+	.byte	0x4a
+	.long	0x4a
+	.byte	0x1
+	.value	0x12d
+	.uleb128 0x11
+	.long	.LASF16
+	.byte	0x4b
+	.long	0x4a
+	.byte	0x1
+	.value	0x12e
+	.uleb128 0x11
+	.long	.LASF43
+	.byte	0x4c
+	.long	0x4a
+	.byte	0x1
+	.value	0x12f
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x4
+	.byte	0x4d
+	.byte	0xe
+	.long	0x5d
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x1e
+	.long	0x20a
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x4
+	.byte	0x4f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x4
+	.byte	0x50
+	.byte	0xe
+	.long	0x5d
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x4
+	.byte	0x51
+	.byte	0xd
+	.long	0x4a
+	.byte	0x37
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF48
+	.byte	0x3c
+	.byte	0x4
+	.byte	0x55
+	.long	0x35b
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x56
+	.byte	0x14
+	.long	0x158
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x4
+	.byte	0x57
+	.byte	0xa
+	.long	0x1fa
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x4
+	.byte	0x58
+	.byte	0xe
+	.long	0x83
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x4
+	.byte	0x59
+	.byte	0xe
+	.long	0x5d
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xd
+	.long	0x4a
+	.byte	0x36
+	.uleb128 0x24
+	.string	"end"
+	.byte	0x5b
+	.byte	0xd
+	.long	0x4a
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xe
+	.long	0x70
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF54
+	.byte	0x10
+	.byte	0x4
+	.byte	0x60
+	.long	0x3d0
+	.uleb128 0x1
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x61
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x62
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x4
+	.byte	0x63
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x4
+	.byte	0x64
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x65
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x4
+	.byte	0x66
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x4
+	.byte	0x67
+	.byte	0xd
+	.long	0x3d0
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x4
+	.byte	0x68
+	.byte	0xe
+	.long	0x70
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	0x4a
+	.long	0x3e0
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF60
+	.byte	0x28
+	.byte	0x4
+	.byte	0x6c
+	.long	0x462
+	.uleb128 0x1
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x6d
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x6e
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x4
+	.byte	0x6f
+	.byte	0xe
+	.long	0x70
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x4
+	.byte	0x70
+	.byte	0xe
+	.long	0x5d
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x4
+	.byte	0x71
+	.byte	0xe
+	.long	0x83
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x4
+	.byte	0x72
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x4
+	.byte	0x73
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x74
+	.byte	0xe
+	.long	0x70
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x4
+	.byte	0x75
+	.byte	0xe
+	.long	0x83
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF65
+	.byte	0x18
+	.byte	0x4
+	.byte	0x79
+	.long	0x4d7
+	.uleb128 0x1
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x7a
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x7b
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x4
+	.byte	0x7c
+	.byte	0xe
+	.long	0x5d
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x4
+	.byte	0x7d
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x4
+	.byte	0x7e
+	.byte	0xe
+	.long	0x70
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x7f
+	.byte	0xe
+	.long	0x70
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x4
+	.byte	0x80
+	.byte	0xe
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x4
+	.byte	0x81
+	.byte	0xe
+	.long	0x70
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0x2c
+	.byte	0x4
+	.byte	0x85
+	.long	0x50b
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x86
+	.byte	0x14
+	.long	0x158
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x4
+	.byte	0x87
+	.byte	0xe
+	.long	0x83
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x4
+	.byte	0x88
+	.byte	0xd
+	.long	0x50b
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x4
+	.long	0x4a
+	.long	0x51a
+	.uleb128 0x18
+	.long	0x8f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF70
+	.byte	0x8
+	.byte	0x4
+	.byte	0x95
+	.long	0x541
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x4
+	.byte	0x96
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x4
+	.byte	0x97
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	0x54c
+	.long	0x54c
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0xd
+	.long	.LASF72
+	.byte	0x4
+	.byte	0x9a
+	.byte	0x17
+	.long	0x541
+	.uleb128 0x4
+	.long	0x568
+	.long	0x568
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x5
+	.long	0xfd
+	.uleb128 0xd
+	.long	.LASF73
+	.byte	0x4
+	.byte	0x9b
+	.byte	0x14
+	.long	0x55d
+	.uleb128 0xd
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x9c
+	.byte	0x15
+	.long	0x585
+	.uleb128 0x5
+	.long	0x258
+	.uleb128 0xd
+	.long	.LASF74
+	.byte	0x4
+	.byte	0x9d
+	.byte	0x1b
+	.long	0x596
+	.uleb128 0x5
+	.long	0x2f4
+	.uleb128 0x4
+	.long	0x5a6
+	.long	0x5a6
+	.uleb128 0x19
+	.byte	0
+	.uleb128 0x5
+	.long	0x3e0
+	.uleb128 0xd
+	.long	.LASF75
+	.byte	0x4
+	.byte	0x9e
+	.byte	0x22
+	.long	0x59b
+	.uleb128 0xd
+	.long	.LASF76
+	.byte	0x4
+	.byte	0x9f
+	.byte	0x11
+	.long	0x70
+	.uleb128 0xf
+	.long	.LASF77
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x8f
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF78
+	.uleb128 0x7
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF79
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xf1
+	.uleb128 0x4
+	.long	0x83
+	.long	0x5f4
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	0xf8
+	.uleb128 0x25
+	.long	.LASF80
+	.byte	0x10
+	.value	0x1d5
+	.long	0x620
+	.uleb128 0x12
+	.long	.LASF26
+	.value	0x1d6
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF37
+	.value	0x1d7
+	.byte	0xc
+	.long	0x5dd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF81
+	.byte	0x30
+	.value	0x1da
+	.long	0x654
+	.uleb128 0x31
+	.string	"id"
+	.byte	0x6
+	.value	0x1db
+	.byte	0xe
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF26
+	.value	0x1dc
+	.byte	0xe
+	.long	0x83
+	.byte	0x20
+	.uleb128 0x12
+	.long	.LASF82
+	.value	0x1dd
+	.byte	0x23
+	.long	0x654
+	.byte	0x28
+	.byte	0
+	.uleb128 0x5
+	.long	0x5f9
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF83
+	.uleb128 0xd
+	.long	.LASF84
+	.byte	0x7
+	.byte	0xb2
+	.byte	0x11
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF85
+	.byte	0x2f
+	.byte	0x1c
+	.long	0x620
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rsdp_request
+	.uleb128 0x6
+	.long	.LASF86
+	.byte	0x24
+	.byte	0x1
+	.byte	0x34
+	.long	0x703
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x35
+	.byte	0xa
+	.long	0x1fa
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x36
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x1
+	.byte	0x37
+	.byte	0xa
+	.long	0x1ea
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x38
+	.byte	0xd
+	.long	0x4a
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x1
+	.byte	0x39
+	.byte	0xe
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x1
+	.byte	0x3a
+	.byte	0xe
+	.long	0x70
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xe
+	.long	0x83
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xd
+	.long	0x4a
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xa
+	.long	0x703
+	.byte	0x21
+	.byte	0
+	.uleb128 0x4
+	.long	0xf1
+	.long	0x713
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF91
+	.byte	0x24
+	.byte	0x1
+	.byte	0x41
+	.long	0x7a2
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x42
+	.byte	0xa
+	.long	0x1da
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x1
+	.byte	0x43
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x44
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x45
+	.byte	0xd
+	.long	0x4a
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x46
+	.byte	0xa
+	.long	0x1ea
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x47
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x48
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x49
+	.byte	0xe
+	.long	0x70
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x4a
+	.byte	0xe
+	.long	0x70
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x1
+	.byte	0x4b
+	.byte	0xe
+	.long	0x7a2
+	.byte	0x24
+	.byte	0
+	.uleb128 0x4
+	.long	0x70
+	.long	0x7b1
+	.uleb128 0x18
+	.long	0x8f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF92
+	.byte	0x24
+	.byte	0x1
+	.byte	0x4f
+	.long	0x840
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x50
+	.byte	0xa
+	.long	0x1da
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x1
+	.byte	0x51
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x1
+	.byte	0x52
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x53
+	.byte	0xd
+	.long	0x4a
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x54
+	.byte	0xa
+	.long	0x1ea
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x55
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x56
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x57
+	.byte	0xe
+	.long	0x70
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x58
+	.byte	0xe
+	.long	0x70
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x1
+	.byte	0x59
+	.byte	0xe
+	.long	0x840
+	.byte	0x24
+	.byte	0
+	.uleb128 0x4
+	.long	0x83
+	.long	0x84f
+	.uleb128 0x18
+	.long	0x8f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF93
+	.byte	0x2c
+	.byte	0x1
+	.byte	0x5d
+	.long	0x883
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x14
+	.long	0x158
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x1
+	.byte	0x5f
+	.byte	0xe
+	.long	0x70
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x1
+	.byte	0x60
+	.byte	0xe
+	.long	0x70
+	.byte	0x28
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF86
+	.byte	0x63
+	.byte	0xe
+	.long	0x898
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rsdp
+	.uleb128 0x5
+	.long	0x681
+	.uleb128 0x9
+	.long	.LASF91
+	.byte	0x64
+	.byte	0xe
+	.long	0x8b2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rsdt
+	.uleb128 0x5
+	.long	0x713
+	.uleb128 0x9
+	.long	.LASF92
+	.byte	0x65
+	.byte	0xe
+	.long	0x8cc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	xsdt
+	.uleb128 0x5
+	.long	0x7b1
+	.uleb128 0x9
+	.long	.LASF95
+	.byte	0x66
+	.byte	0xe
+	.long	0x8e6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pMadt
+	.uleb128 0x5
+	.long	0x84f
+	.uleb128 0x1a
+	.long	0x579
+	.byte	0x67
+	.byte	0xe
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hpet
+	.uleb128 0x1a
+	.long	0x58a
+	.byte	0x68
+	.byte	0x14
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mcfg
+	.uleb128 0x9
+	.long	.LASF67
+	.byte	0x69
+	.byte	0xe
+	.long	0x922
+	.uleb128 0x9
+	.byte	0x3
+	.quad	slit
+	.uleb128 0x5
+	.long	0x4d7
+	.uleb128 0x9
+	.long	.LASF96
+	.byte	0x6a
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	entry_size
+	.uleb128 0x4
+	.long	0x54c
+	.long	0x94c
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x1b
+	.long	0x551
+	.byte	0x6f
+	.byte	0x10
+	.long	0x93c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	ioapic_list
+	.uleb128 0x4
+	.long	0x568
+	.long	0x971
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x1b
+	.long	0x56d
+	.byte	0x70
+	.byte	0xd
+	.long	0x961
+	.uleb128 0x9
+	.byte	0x3
+	.quad	iso_list
+	.uleb128 0x4
+	.long	0x5a6
+	.long	0x996
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1b
+	.long	0x5ab
+	.byte	0x71
+	.byte	0x1b
+	.long	0x986
+	.uleb128 0x9
+	.byte	0x3
+	.quad	srat_mem_list
+	.uleb128 0x4
+	.long	0x51a
+	.long	0x9bb
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF97
+	.byte	0x72
+	.byte	0x11
+	.long	0x9ab
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numa_cpu_list
+	.uleb128 0x9
+	.long	.LASF98
+	.byte	0x73
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numa_cpu_count
+	.uleb128 0x4
+	.long	0x70
+	.long	0x9f5
+	.uleb128 0x8
+	.long	0x8f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF99
+	.byte	0x79
+	.byte	0xa
+	.long	0x9e5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numa_domains
+	.uleb128 0x1a
+	.long	0x5b7
+	.byte	0x7a
+	.byte	0xa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numa_node_count
+	.uleb128 0x32
+	.long	.LASF119
+	.byte	0x7
+	.byte	0xe3
+	.byte	0x5
+	.long	0x3c
+	.long	0xa3b
+	.uleb128 0x13
+	.long	0xa3b
+	.uleb128 0x13
+	.long	0xa3b
+	.uleb128 0x13
+	.long	0x5c3
+	.byte	0
+	.uleb128 0x5
+	.long	0xa40
+	.uleb128 0x33
+	.uleb128 0x34
+	.long	.LASF113
+	.byte	0x8
+	.byte	0x30
+	.byte	0x6
+	.long	0xa54
+	.uleb128 0x13
+	.long	0x5f4
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF124
+	.byte	0x1
+	.value	0x136
+	.byte	0x6
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd3a
+	.uleb128 0x14
+	.long	.LASF100
+	.value	0x138
+	.byte	0x9
+	.long	0x659
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x15
+	.long	.LLRL47
+	.long	0xc61
+	.uleb128 0x37
+	.string	"i"
+	.byte	0x1
+	.value	0x14b
+	.byte	0x13
+	.long	0x70
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1c
+	.long	.LLRL49
+	.uleb128 0x14
+	.long	.LASF39
+	.value	0x14d
+	.byte	0x19
+	.long	0xd3a
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.quad	.LVL124
+	.long	0xa1b
+	.long	0xadf
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL128
+	.long	0xa1b
+	.long	0xb02
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL129
+	.long	0xa1b
+	.long	0xb25
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL130
+	.long	0xa1b
+	.long	0xb4f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL131
+	.long	0xa1b
+	.long	0xb79
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL133
+	.long	0xa41
+	.long	0xb98
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL138
+	.long	0xd3f
+	.long	0xbb0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL139
+	.long	0xedf
+	.long	0xbc8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL140
+	.long	0xa41
+	.long	0xbe7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL143
+	.long	0xa41
+	.long	0xc06
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL144
+	.long	0xa41
+	.long	0xc25
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL145
+	.long	0xa41
+	.long	0xc44
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL146
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	0x1263
+	.quad	.LBI110
+	.byte	.LVU466
+	.quad	.LBB110
+	.quad	.LBE110-.LBB110
+	.byte	0x1
+	.value	0x17e
+	.byte	0x9
+	.uleb128 0x3
+	.quad	.LVL116
+	.long	0xa41
+	.long	0xca2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL117
+	.long	0xa41
+	.long	0xcc1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL121
+	.long	0xa41
+	.long	0xce0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL135
+	.long	0xa41
+	.long	0xcff
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x39
+	.quad	.LVL137
+	.long	0xa41
+	.long	0xd1e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL148
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x158
+	.uleb128 0x3a
+	.long	.LASF105
+	.byte	0x1
+	.value	0x104
+	.byte	0x6
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xedf
+	.uleb128 0x3b
+	.long	.LASF39
+	.byte	0x1
+	.value	0x104
+	.byte	0x22
+	.long	0xd3a
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x14
+	.long	.LASF101
+	.value	0x10e
+	.byte	0xb
+	.long	0x5df
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x14
+	.long	.LASF102
+	.value	0x10f
+	.byte	0xb
+	.long	0x5df
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x15
+	.long	.LLRL44
+	.long	0xe49
+	.uleb128 0x26
+	.long	.LASF103
+	.value	0x117
+	.byte	0x1c
+	.long	0x54c
+	.uleb128 0x3c
+	.long	0x1242
+	.quad	.LBB92
+	.quad	.LBE92-.LBB92
+	.byte	0x1
+	.value	0x118
+	.byte	0xd
+	.long	0xdf6
+	.uleb128 0x1d
+	.long	0x124c
+	.uleb128 0x3d
+	.long	0x1257
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.uleb128 0xb
+	.long	0x1258
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL104
+	.long	0xa41
+	.long	0xe0e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL105
+	.long	0xa41
+	.long	0xe2d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL106
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LLRL42
+	.long	0xe9d
+	.uleb128 0x26
+	.long	.LASF104
+	.value	0x120
+	.byte	0x19
+	.long	0x568
+	.uleb128 0x3e
+	.long	0x1206
+	.long	.LLRL42
+	.byte	0x1
+	.value	0x121
+	.byte	0xd
+	.uleb128 0x1d
+	.long	0x1210
+	.uleb128 0x1e
+	.long	0x121b
+	.long	.LLRL42
+	.uleb128 0xb
+	.long	0x121c
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xa
+	.quad	.LVL114
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL95
+	.long	0xa41
+	.long	0xec3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL96
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF106
+	.byte	0xe0
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1059
+	.uleb128 0x16
+	.long	.LASF39
+	.byte	0xe0
+	.byte	0x22
+	.long	0xd3a
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xe
+	.long	.LASF107
+	.byte	0xe3
+	.byte	0xb
+	.long	0x5df
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xe
+	.long	.LASF108
+	.byte	0xe4
+	.byte	0xb
+	.long	0x5df
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x15
+	.long	.LLRL27
+	.long	0xfe9
+	.uleb128 0xe
+	.long	.LASF109
+	.byte	0xe8
+	.byte	0x29
+	.long	0x1059
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1c
+	.long	.LLRL29
+	.uleb128 0xe
+	.long	.LASF110
+	.byte	0xeb
+	.byte	0x1a
+	.long	0x70
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1f
+	.long	0x1122
+	.quad	.LBI53
+	.byte	.LVU229
+	.long	.LLRL31
+	.byte	0xf0
+	.byte	0x11
+	.uleb128 0xc
+	.long	0x1137
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xc
+	.long	0x112c
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1f
+	.long	0x11de
+	.quad	.LBI55
+	.byte	.LVU249
+	.long	.LLRL34
+	.byte	0xce
+	.byte	0x2a
+	.uleb128 0x1d
+	.long	0x11ef
+	.uleb128 0x17
+	.long	0x11fa
+	.long	.LLRL35
+	.long	0xfca
+	.uleb128 0xb
+	.long	0x11fb
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL92
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.quad	.LBB75
+	.quad	.LBE75-.LBB75
+	.long	0x101f
+	.uleb128 0xe
+	.long	.LASF109
+	.byte	0xf3
+	.byte	0x2a
+	.long	0x105e
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x40
+	.quad	.LVL81
+	.long	0x1122
+	.byte	0
+	.uleb128 0x28
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.uleb128 0xe
+	.long	.LASF111
+	.byte	0xf9
+	.byte	0x27
+	.long	0x5a6
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xa
+	.quad	.LVL75
+	.long	0x1063
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x35b
+	.uleb128 0x5
+	.long	0x462
+	.uleb128 0x27
+	.long	.LASF112
+	.byte	0xd2
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1122
+	.uleb128 0x16
+	.long	.LASF111
+	.byte	0xd2
+	.byte	0x2d
+	.long	0x5a6
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1c
+	.long	.LLRL18
+	.uleb128 0x29
+	.string	"i"
+	.byte	0xd4
+	.byte	0xe
+	.long	0x3c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x41
+	.long	0x11de
+	.quad	.LBI28
+	.byte	.LVU156
+	.long	.LLRL20
+	.byte	0x1
+	.byte	0xd7
+	.byte	0xd
+	.long	0x1105
+	.uleb128 0xc
+	.long	0x11ef
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x17
+	.long	0x11fa
+	.long	.LLRL22
+	.long	0x10e9
+	.uleb128 0xb
+	.long	0x11fb
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL65
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.quad	.LVL60
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF114
+	.byte	0xc7
+	.long	0x1143
+	.uleb128 0x10
+	.long	.LASF56
+	.byte	0xc7
+	.byte	0x1c
+	.long	0x70
+	.uleb128 0x10
+	.long	.LASF61
+	.byte	0xc7
+	.byte	0x2e
+	.long	0x70
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF117
+	.byte	0xb8
+	.byte	0x9
+	.long	0x4a
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x118b
+	.uleb128 0x16
+	.long	.LASF115
+	.byte	0xb8
+	.byte	0x25
+	.long	0x70
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x16
+	.long	.LASF116
+	.byte	0xb8
+	.byte	0x39
+	.long	0x70
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF118
+	.byte	0xa9
+	.byte	0xa
+	.long	0x70
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11de
+	.uleb128 0x42
+	.long	.LASF56
+	.byte	0x1
+	.byte	0xa9
+	.byte	0x2a
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x28
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x29
+	.string	"i"
+	.byte	0xab
+	.byte	0x13
+	.long	0x70
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF120
+	.byte	0x1
+	.byte	0x95
+	.byte	0xa
+	.long	0x70
+	.byte	0x1
+	.long	0x1206
+	.uleb128 0x10
+	.long	.LASF61
+	.byte	0x95
+	.byte	0x22
+	.long	0x70
+	.uleb128 0x21
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x97
+	.byte	0x13
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF121
+	.byte	0x86
+	.long	0x1242
+	.uleb128 0x10
+	.long	.LASF104
+	.byte	0x86
+	.byte	0x1a
+	.long	0x568
+	.uleb128 0x21
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x88
+	.byte	0xe
+	.long	0x3c
+	.uleb128 0x2a
+	.quad	.LVL11
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF122
+	.byte	0x7c
+	.long	0x1263
+	.uleb128 0x10
+	.long	.LASF103
+	.byte	0x7c
+	.byte	0x20
+	.long	0x54c
+	.uleb128 0x21
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x7e
+	.byte	0xe
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.string	"hcf"
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x23
+	.long	0x1242
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12a6
+	.uleb128 0x45
+	.long	0x124c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1e
+	.long	0x1257
+	.long	.LLRL0
+	.uleb128 0xb
+	.long	0x1258
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x1206
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12e6
+	.uleb128 0xc
+	.long	0x1210
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1e
+	.long	0x121b
+	.long	.LLRL3
+	.uleb128 0xb
+	.long	0x121c
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x11de
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x134c
+	.uleb128 0xc
+	.long	0x11ef
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x17
+	.long	0x11fa
+	.long	.LLRL6
+	.long	0x1329
+	.uleb128 0xb
+	.long	0x11fb
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL20
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.long	0x1122
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xc
+	.long	0x112c
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xc
+	.long	0x1137
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1f
+	.long	0x11de
+	.quad	.LBI15
+	.byte	.LVU111
+	.long	.LLRL13
+	.byte	0xce
+	.byte	0x2a
+	.uleb128 0xc
+	.long	0x11ef
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x17
+	.long	0x11fa
+	.long	.LLRL15
+	.long	0x13b9
+	.uleb128 0xb
+	.long	0x11fb
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL46
+	.long	0xa41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0xd
+	.uleb128 0xb
+	.uleb128 0x6b
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS46:
+	.uleb128 .LVU345
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU369
+	.uleb128 .LVU370
+	.uleb128 .LVU429
+	.uleb128 .LVU431
+	.uleb128 .LVU440
+	.uleb128 .LVU440
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU375
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU413
+	.uleb128 .LVU413
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU416
+	.uleb128 .LVU431
+	.uleb128 .LVU440
+	.uleb128 .LVU450
+	.uleb128 .LVU463
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU379
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU390
+	.uleb128 .LVU391
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU416
+	.uleb128 .LVU431
+	.uleb128 .LVU440
+	.uleb128 .LVU450
+	.uleb128 .LVU463
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU291
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU292
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU328
+	.uleb128 .LVU330
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU311
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU313
+	.uleb128 .LVU314
+	.uleb128 .LVU320
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU331
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU333
+	.uleb128 .LVU334
+	.uleb128 .LVU341
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU189
+	.uleb128 .LVU220
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU193
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU228
+	.uleb128 .LVU248
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x26
+	.byte	0x73
+	.sleb128 9
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x24
+	.byte	0x73
+	.sleb128 10
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x40
+	.byte	0x24
+	.byte	0x21
+	.byte	0x73
+	.sleb128 11
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x24
+	.byte	0x21
+	.byte	0x73
+	.sleb128 2
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU229
+	.uleb128 .LVU248
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x26
+	.byte	0x73
+	.sleb128 9
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x24
+	.byte	0x73
+	.sleb128 10
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x40
+	.byte	0x24
+	.byte	0x21
+	.byte	0x73
+	.sleb128 11
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x24
+	.byte	0x21
+	.byte	0x73
+	.sleb128 2
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU229
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU257
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 3
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0xd
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0xd
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU254
+	.uleb128 .LVU255
+	.uleb128 .LVU257
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU223
+	.uleb128 .LVU227
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU212
+	.uleb128 .LVU218
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU141
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+	.uleb128 .LVU147
+	.uleb128 .LVU159
+	.uleb128 .LVU183
+	.uleb128 .LVU184
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU156
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+	.uleb128 .LVU177
+	.uleb128 .LVU180
+	.uleb128 .LVU181
+	.uleb128 .LVU183
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU157
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU183
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU67
+	.uleb128 .LVU68
+	.uleb128 .LVU73
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU14
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU19
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU24
+	.uleb128 .LVU30
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU37
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU40
+	.uleb128 .LVU41
+	.uleb128 .LVU45
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU111
+	.uleb128 .LVU119
+	.uleb128 .LVU126
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU112
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB7-.Ltext0
+	.uleb128 .LBE7-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0
+.LLRL13:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF108:
+	.string	"pEnd"
+.LASF59:
+	.string	"clock_domain"
+.LASF98:
+	.string	"numa_cpu_count"
+.LASF72:
+	.string	"ioapic_list"
+.LASF77:
+	.string	"size_t"
+.LASF27:
+	.string	"checksum"
+.LASF60:
+	.string	"srat_mem_affinity"
+.LASF11:
+	.string	"uint64_t"
+.LASF85:
+	.string	"rsdp_request"
+.LASF26:
+	.string	"revision"
+.LASF34:
+	.string	"address_space_id"
+.LASF96:
+	.string	"entry_size"
+.LASF13:
+	.string	"type"
+.LASF80:
+	.string	"limine_rsdp_response"
+.LASF54:
+	.string	"srat_lapic_affinity"
+.LASF122:
+	.string	"add_ioapic"
+.LASF75:
+	.string	"srat_mem_list"
+.LASF105:
+	.string	"_parse_madt"
+.LASF50:
+	.string	"mmio_base"
+.LASF106:
+	.string	"_parse_srat"
+.LASF15:
+	.string	"ioapic_id"
+.LASF82:
+	.string	"response"
+.LASF78:
+	.string	"long long int"
+.LASF2:
+	.string	"signed char"
+.LASF17:
+	.string	"ioapic_addr"
+.LASF118:
+	.string	"acpi_numa_node_of_apic"
+.LASF4:
+	.string	"long int"
+.LASF89:
+	.string	"xsdt_addr"
+.LASF74:
+	.string	"mcfg"
+.LASF70:
+	.string	"numa_cpu"
+.LASF45:
+	.string	"hpet_number"
+.LASF95:
+	.string	"pMadt"
+.LASF7:
+	.string	"uint16_t"
+.LASF36:
+	.string	"register_bit_offset"
+.LASF51:
+	.string	"segment"
+.LASF25:
+	.string	"signature"
+.LASF104:
+	.string	"pIso"
+.LASF16:
+	.string	"reserved"
+.LASF88:
+	.string	"rsdt_addr"
+.LASF123:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF76:
+	.string	"numa_node_count"
+.LASF32:
+	.string	"creator_revision"
+.LASF93:
+	.string	"madt"
+.LASF10:
+	.string	"unsigned int"
+.LASF18:
+	.string	"gsi_base"
+.LASF30:
+	.string	"oem_revision"
+.LASF113:
+	.string	"kprintf"
+.LASF12:
+	.string	"long unsigned int"
+.LASF61:
+	.string	"proximity_domain"
+.LASF31:
+	.string	"creator_id"
+.LASF8:
+	.string	"short unsigned int"
+.LASF68:
+	.string	"num_localities"
+.LASF63:
+	.string	"range_length"
+.LASF87:
+	.string	"oemid"
+.LASF57:
+	.string	"sapic_eid"
+.LASF84:
+	.string	"vmm_higher_half_offset"
+.LASF43:
+	.string	"legacy_replacement"
+.LASF97:
+	.string	"numa_cpu_list"
+.LASF100:
+	.string	"xsdt_enabled"
+.LASF81:
+	.string	"limine_rsdp_request"
+.LASF21:
+	.string	"bus_source"
+.LASF62:
+	.string	"base"
+.LASF47:
+	.string	"page_protection"
+.LASF99:
+	.string	"numa_domains"
+.LASF69:
+	.string	"entries"
+.LASF79:
+	.string	"long double"
+.LASF37:
+	.string	"address"
+.LASF120:
+	.string	"acpi_numa_node"
+.LASF112:
+	.string	"add_numa_mem"
+.LASF28:
+	.string	"oem_id"
+.LASF44:
+	.string	"pci_vendor_id"
+.LASF39:
+	.string	"desc"
+.LASF73:
+	.string	"iso_list"
+.LASF101:
+	.string	"pICLStart"
+.LASF58:
+	.string	"proximity_domain_high"
+.LASF46:
+	.string	"minimum_tick"
+.LASF41:
+	.string	"comparator_count"
+.LASF115:
+	.string	"from_node"
+.LASF117:
+	.string	"acpi_numa_distance"
+.LASF90:
+	.string	"ext_checksum"
+.LASF67:
+	.string	"slit"
+.LASF116:
+	.string	"to_node"
+.LASF83:
+	.string	"_Bool"
+.LASF94:
+	.string	"lapic_addr"
+.LASF5:
+	.string	"unsigned char"
+.LASF35:
+	.string	"register_bit_width"
+.LASF71:
+	.string	"node"
+.LASF3:
+	.string	"short int"
+.LASF102:
+	.string	"pICLItem"
+.LASF103:
+	.string	"pIOApic"
+.LASF24:
+	.string	"sysdesc"
+.LASF92:
+	.string	"xsdt"
+.LASF66:
+	.string	"x2apic_id"
+.LASF55:
+	.string	"proximity_domain_low"
+.LASF20:
+	.string	"ioapic"
+.LASF56:
+	.string	"apic_id"
+.LASF40:
+	.string	"hardware_rev_id"
+.LASF111:
+	.string	"pMem"
+.LASF9:
+	.string	"uint32_t"
+.LASF65:
+	.string	"srat_x2apic_affinity"
+.LASF14:
+	.string	"length"
+.LASF19:
+	.string	"char"
+.LASF38:
+	.string	"hpet"
+.LASF107:
+	.string	"pItem"
+.LASF114:
+	.string	"add_numa_cpu"
+.LASF119:
+	.string	"memcmp"
+.LASF86:
+	.string	"rsdp"
+.LASF91:
+	.string	"rsdt"
+.LASF33:
+	.string	"address_structure"
+.LASF29:
+	.string	"oem_table_id"
+.LASF48:
+	.string	"mcfg_entry"
+.LASF121:
+	.string	"add_iso"
+.LASF6:
+	.string	"uint8_t"
+.LASF124:
+	.string	"acpi_init"
+.LASF23:
+	.string	"flags"
+.LASF110:
+	.string	"domain"
+.LASF22:
+	.string	"irq_source"
+.LASF49:
+	.string	"reserved1"
+.LASF53:
+	.string	"reserved2"
+.LASF64:
+	.string	"reserved3"
+.LASF52:
+	.string	"start"
+.LASF42:
+	.string	"counter_size"
+.LASF109:
+	.string	"pCpu"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/acpi.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
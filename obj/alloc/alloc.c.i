@@ -0,0 +1,1931 @@
+# 0 "src/alloc/alloc.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/alloc/alloc.c"
+# 18 "src/alloc/alloc.c"
+# 1 "src/include/alloc.h" 1
+# 21 "src/include/alloc.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 22 "src/include/alloc.h" 2
+# 39 "src/include/alloc.h"
+
+# 39 "src/include/alloc.h"
+void *malloc(size_t size);
+void free(void *ptr);
+void *realloc(void *ptr, size_t size);
+void *calloc(size_t count, size_t size);
+void *aligned_alloc(size_t alignment, size_t size);
+void alloc_profile_report();
+void alloc_profile_report_serial();
+
+
+void alloc_cpu_cache_drain();
+# 19 "src/alloc/alloc.c" 2
+# 1 "src/include/bump.h" 1
+# 21 "src/include/bump.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/bump.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "src/include/bump.h" 2
+
+
+
+
+
+
+
+
+# 30 "src/include/bump.h"
+struct ArenaChunk {
+    struct ArenaChunk *pNext;
+    size_t pages;
+};
+
+
+
+
+struct Arena {
+    struct ArenaChunk *pChunks;
+    uint8_t *pCursor;
+    uint8_t *pEnd;
+    size_t chunk_pages;
+};
+
+void arena_init(struct Arena *pArena, size_t chunk_pages);
+void *arena_alloc(struct Arena *pArena, size_t size);
+void arena_reset(struct Arena *pArena);
+void arena_destroy(struct Arena *pArena);
+
+void *bump_malloc(size_t size);
+void bump_free(void *ptr);
+# 20 "src/alloc/alloc.c" 2
+# 1 "src/include/slob.h" 1
+# 21 "src/include/slob.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/slob.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/slob.h" 2
+
+void slob_init();
+void *slob_malloc(size_t size);
+void slob_free(void *ptr);
+size_t slob_usable_size(void *ptr);
+
+# 28 "src/include/slob.h" 3 4
+_Bool 
+# 28 "src/include/slob.h"
+    slob_grow_in_place(void *ptr, size_t size);
+# 21 "src/alloc/alloc.c" 2
+# 1 "src/include/slab.h" 1
+# 21 "src/include/slab.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/slab.h" 2
+# 43 "src/include/slab.h"
+struct SlabCache;
+
+void slab_init();
+void *slab_malloc(size_t size);
+void slab_free(void *ptr);
+size_t slab_usable_size(void *ptr);
+int slab_size_class(size_t size);
+int slab_object_class(void *ptr, uint32_t *pOwner);
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner);
+void slab_free_batch(void **ppObjects, uint32_t count);
+
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject));
+void *kmem_cache_alloc(struct SlabCache *pCache);
+void kmem_cache_free(struct SlabCache *pCache, void *ptr);
+void kmem_cache_report();
+# 22 "src/alloc/alloc.c" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 23 "src/alloc/alloc.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 24 "src/alloc/alloc.c" 2
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 43 "src/include/cpu.h" 2
+# 51 "src/include/cpu.h"
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 25 "src/alloc/alloc.c" 2
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 26 "src/alloc/alloc.c" 2
+# 1 "src/include/serial.h" 1
+# 27 "src/alloc/alloc.c" 2
+# 1 "src/include/math.h" 1
+# 28 "src/alloc/alloc.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 467 "/usr/include/features.h" 3 4
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 468 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 29 "src/alloc/alloc.c" 2
+# 129 "src/alloc/alloc.c"
+
+# 129 "src/alloc/alloc.c"
+struct CpuClassCache {
+    uint32_t count;
+    void *objects[32];
+};
+
+struct CpuCache {
+    struct CpuClassCache classes[14];
+    uint32_t remote_count;
+    void *remote[32];
+} __attribute__((aligned(64)));
+
+static struct CpuCache cpu_caches[64];
+
+
+static void *remote_inbox[64][14];
+
+
+
+
+static void _cpu_cache_flush(struct CpuClassCache *pCache, uint32_t count)
+{
+    slab_free_batch(pCache->objects, count);
+
+    pCache->count -= count;
+    memmove(pCache->objects, pCache->objects + count, pCache->count * sizeof(void*));
+}
+
+
+
+
+
+static void _cpu_cache_refill(uint32_t cpu, int class, struct CpuClassCache *pCache)
+{
+    void *pList = __atomic_exchange_n(&remote_inbox[cpu][class], 
+# 162 "src/alloc/alloc.c" 3 4
+                                                                ((void *)0)
+# 162 "src/alloc/alloc.c"
+                                                                    , 2);
+
+    while (pList != 
+# 164 "src/alloc/alloc.c" 3 4
+                   ((void *)0)
+# 164 "src/alloc/alloc.c"
+                       ) {
+        void *pNext = *(void**)pList;
+
+        if (pCache->count == 32) {
+            _cpu_cache_flush(pCache, 16);
+        }
+
+        pCache->objects[pCache->count++] = pList;
+        pList = pNext;
+    }
+
+    if (pCache->count == 0) {
+        pCache->count = slab_alloc_batch(class, pCache->objects, 16, cpu);
+    }
+}
+
+
+
+
+
+static void _cpu_cache_flush_remote(struct CpuCache *pCpuCache)
+{
+    for (uint32_t i = 0; i < pCpuCache->remote_count; i++) {
+        void *pFirst = pCpuCache->remote[i];
+        if (pFirst == 
+# 188 "src/alloc/alloc.c" 3 4
+                     ((void *)0)
+# 188 "src/alloc/alloc.c"
+                         ) {
+            continue;
+        }
+
+        uint32_t owner;
+        int class = slab_object_class(pFirst, &owner);
+        void *pLast = pFirst;
+
+        for (uint32_t j = i + 1; j < pCpuCache->remote_count; j++) {
+            void *ptr = pCpuCache->remote[j];
+            uint32_t other_owner;
+
+            if (ptr != 
+# 200 "src/alloc/alloc.c" 3 4
+                      ((void *)0) 
+# 200 "src/alloc/alloc.c"
+                           && slab_object_class(ptr, &other_owner) == class && other_owner == owner) {
+                *(void**)pLast = ptr;
+                pLast = ptr;
+                pCpuCache->remote[j] = 
+# 203 "src/alloc/alloc.c" 3 4
+                                      ((void *)0)
+# 203 "src/alloc/alloc.c"
+                                          ;
+            }
+        }
+
+        void **ppInbox = &remote_inbox[owner][class];
+        void *pHead = __atomic_load_n(ppInbox, 0);
+
+        do {
+            *(void**)pLast = pHead;
+        } while (!__atomic_compare_exchange_n(ppInbox, &pHead, pFirst, 
+# 212 "src/alloc/alloc.c" 3 4
+                                                                      1
+# 212 "src/alloc/alloc.c"
+                                                                          , 3, 0));
+    }
+
+    pCpuCache->remote_count = 0;
+}
+
+static void *_heap_malloc(size_t size)
+{
+    int class = slab_size_class(size);
+    if (class < 0) {
+        return slab_malloc(size);
+    }
+
+    
+# 225 "src/alloc/alloc.c" 3 4
+   _Bool 
+# 225 "src/alloc/alloc.c"
+        istate = set_interrupt_state(
+# 225 "src/alloc/alloc.c" 3 4
+                                     0
+# 225 "src/alloc/alloc.c"
+                                          );
+
+    uint32_t cpu = cpu_index();
+    struct CpuClassCache *pCache = &cpu_caches[cpu].classes[class];
+
+    if (pCache->count == 0) {
+        _cpu_cache_refill(cpu, class, pCache);
+    }
+
+    void *ptr = 
+# 234 "src/alloc/alloc.c" 3 4
+               ((void *)0)
+# 234 "src/alloc/alloc.c"
+                   ;
+    if (pCache->count > 0) {
+        ptr = pCache->objects[--pCache->count];
+    }
+
+    set_interrupt_state(istate);
+
+    if (ptr == 
+# 241 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 241 "src/alloc/alloc.c"
+                  ) {
+        kprintf("Allocation of %lu bytes failed.\n", size);
+    }
+
+    return ptr;
+}
+
+static void _heap_free(void *ptr)
+{
+    uint32_t owner;
+    int class = slab_object_class(ptr, &owner);
+    if (class < 0) {
+        slab_free(ptr);
+        return;
+    }
+
+    
+# 257 "src/alloc/alloc.c" 3 4
+   _Bool 
+# 257 "src/alloc/alloc.c"
+        istate = set_interrupt_state(
+# 257 "src/alloc/alloc.c" 3 4
+                                     0
+# 257 "src/alloc/alloc.c"
+                                          );
+
+    uint32_t cpu = cpu_index();
+    struct CpuCache *pCpuCache = &cpu_caches[cpu];
+
+    if (owner == cpu) {
+        struct CpuClassCache *pCache = &pCpuCache->classes[class];
+
+        if (pCache->count == 32) {
+            _cpu_cache_flush(pCache, 16);
+        }
+
+        pCache->objects[pCache->count++] = ptr;
+    } else {
+        pCpuCache->remote[pCpuCache->remote_count++] = ptr;
+
+        if (pCpuCache->remote_count == 32) {
+            _cpu_cache_flush_remote(pCpuCache);
+        }
+    }
+
+    set_interrupt_state(istate);
+}
+
+static inline size_t _heap_usable_size(void *ptr)
+{
+    return slab_usable_size(ptr);
+}
+
+static inline 
+# 286 "src/alloc/alloc.c" 3 4
+             _Bool 
+# 286 "src/alloc/alloc.c"
+                  _heap_grow_in_place(void *ptr, size_t size)
+{
+
+    (void)ptr;
+    (void)size;
+    return 
+# 291 "src/alloc/alloc.c" 3 4
+          0
+# 291 "src/alloc/alloc.c"
+               ;
+}
+
+
+
+
+
+static void *_heap_zalloc(size_t size)
+{
+    if (size > 2048) {
+        return kalloc_zone(size, 0x2);
+    }
+
+    void *ptr = _heap_malloc(size);
+    if (ptr != 
+# 305 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 305 "src/alloc/alloc.c"
+                  ) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+
+
+
+
+
+static void *_heap_aligned_alloc(size_t alignment, size_t size)
+{
+    if (alignment <= 16) {
+        return _heap_malloc(size);
+    }
+
+    size_t class_size = 1ULL << (64 - __builtin_clzl(((size) > (alignment) ? (size) : (alignment)) - 1));
+
+    if (class_size <= 2048) {
+        return _heap_malloc(class_size);
+    }
+
+    if (alignment <= 4096) {
+        return kalloc(size);
+    }
+
+    return kalloc_huge(size, __builtin_ctzl(alignment / 4096));
+}
+
+
+
+
+
+void alloc_cpu_cache_drain()
+{
+    
+# 341 "src/alloc/alloc.c" 3 4
+   _Bool 
+# 341 "src/alloc/alloc.c"
+        istate = set_interrupt_state(
+# 341 "src/alloc/alloc.c" 3 4
+                                     0
+# 341 "src/alloc/alloc.c"
+                                          );
+
+    uint32_t cpu = cpu_index();
+    struct CpuCache *pCpuCache = &cpu_caches[cpu];
+
+    _cpu_cache_flush_remote(pCpuCache);
+
+    for (int class = 0; class < 14; class++) {
+        struct CpuClassCache *pCache = &pCpuCache->classes[class];
+
+        _cpu_cache_flush(pCache, pCache->count);
+
+        void *pList = __atomic_exchange_n(&remote_inbox[cpu][class], 
+# 353 "src/alloc/alloc.c" 3 4
+                                                                    ((void *)0)
+# 353 "src/alloc/alloc.c"
+                                                                        , 2);
+        while (pList != 
+# 354 "src/alloc/alloc.c" 3 4
+                       ((void *)0)
+# 354 "src/alloc/alloc.c"
+                           ) {
+            void *pNext = *(void**)pList;
+            slab_free(pList);
+            pList = pNext;
+        }
+    }
+
+    set_interrupt_state(istate);
+}
+# 545 "src/alloc/alloc.c"
+void alloc_profile_report()
+{
+    kprintf("Heap profiling is off, define ALLOC_PROFILE in alloc.h to turn it on.\n");
+}
+
+void alloc_profile_report_serial()
+{
+    alloc_profile_report();
+}
+
+
+
+
+
+static inline void *_malloc_from(size_t size, void *pCaller)
+{
+    void *ptr = _heap_malloc(size);
+
+
+
+
+    (void)pCaller;
+
+
+    return ptr;
+}
+
+void *malloc(size_t size)
+{
+    return _malloc_from(size, __builtin_return_address(0));
+}
+
+void free(void *ptr)
+{
+    if (ptr == 
+# 579 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 579 "src/alloc/alloc.c"
+                  ) {
+        return;
+    }
+
+
+
+
+
+    _heap_free(ptr);
+}
+
+
+
+
+
+
+void *realloc(void *ptr, size_t size)
+{
+    void *pCaller = __builtin_return_address(0);
+
+    if (ptr == 
+# 599 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 599 "src/alloc/alloc.c"
+                  ) {
+        return _malloc_from(size, pCaller);
+    }
+
+    if (size == 0) {
+        free(ptr);
+        return 
+# 605 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 605 "src/alloc/alloc.c"
+                  ;
+    }
+
+    size_t usable = _heap_usable_size(ptr);
+
+    if (usable == 0) {
+        kprintf("realloc isn't supported by this heap.\n");
+        return 
+# 612 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 612 "src/alloc/alloc.c"
+                  ;
+    }
+
+    if (size <= usable) {
+        return ptr;
+    }
+
+    if (_heap_grow_in_place(ptr, size)) {
+
+
+
+
+        return ptr;
+    }
+
+    void *pNew = _malloc_from(size, pCaller);
+    if (pNew == 
+# 628 "src/alloc/alloc.c" 3 4
+               ((void *)0)
+# 628 "src/alloc/alloc.c"
+                   ) {
+        return 
+# 629 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 629 "src/alloc/alloc.c"
+                  ;
+    }
+
+    memcpy(pNew, ptr, usable);
+    free(ptr);
+
+    return pNew;
+}
+
+
+
+
+void *calloc(size_t count, size_t size)
+{
+    size_t total;
+
+    if (__builtin_mul_overflow(count, size, &total)) {
+        kprintf("calloc of %lu x %lu bytes overflows.\n", count, size);
+        return 
+# 647 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 647 "src/alloc/alloc.c"
+                  ;
+    }
+
+    void *ptr = _heap_zalloc(total);
+
+
+
+
+
+    return ptr;
+}
+
+
+
+
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        kprintf("Alignment of %lu isn't a power of two.\n", alignment);
+        return 
+# 667 "src/alloc/alloc.c" 3 4
+              ((void *)0)
+# 667 "src/alloc/alloc.c"
+                  ;
+    }
+
+    void *ptr = _heap_aligned_alloc(alignment, size);
+
+
+
+
+
+    return ptr;
+}
@@ -0,0 +1,8256 @@
+	.file	"alloc.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc/alloc.c"
+	.p2align 4
+	.type	_cpu_cache_flush_remote, @function
+_cpu_cache_flush_remote:
+.LVL0:
+.LFB34:
+	.file 1 "src/alloc/alloc.c"
+	.loc 1 185 1 view -0
+	.cfi_startproc
+	.loc 1 186 5 view .LVU1
+.LBB58:
+	.loc 1 186 10 view .LVU2
+	.loc 1 186 28 view .LVU3
+.LBE58:
+	.loc 1 185 1 is_stmt 0 view .LVU4
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdi, %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	xorl	%ebx, %ebx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+.LBB71:
+.LBB59:
+	.loc 1 193 21 view .LVU5
+	leaq	40(%rsp), %rax
+	movq	%rax, 24(%rsp)
+.LBB60:
+.LBB61:
+	.loc 1 200 31 view .LVU6
+	leaq	44(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.LBE61:
+.LBE60:
+.LBE59:
+	.loc 1 186 28 view .LVU7
+	movl	3696(%rdi), %eax
+	testl	%eax, %eax
+	jne	.L2
+	jmp	.L4
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+.LBB68:
+	.loc 1 189 13 is_stmt 1 discriminator 1 view .LVU8
+.LBE68:
+	.loc 1 186 56 discriminator 1 view .LVU9
+	.loc 1 186 28 discriminator 1 view .LVU10
+	cmpl	3696(%r15), %ebx
+	jnb	.L4
+.LVL2:
+.L2:
+.LBB69:
+	.loc 1 187 9 view .LVU11
+	.loc 1 187 15 is_stmt 0 view .LVU12
+	movl	%ebx, %eax
+.LBB65:
+	.loc 1 196 23 view .LVU13
+	addl	$1, %ebx
+.LVL3:
+	.loc 1 196 23 view .LVU14
+.LBE65:
+	.loc 1 187 15 view .LVU15
+	movq	3704(%r15,%rax,8), %r12
+.LVL4:
+	.loc 1 188 9 is_stmt 1 view .LVU16
+	.loc 1 188 12 is_stmt 0 view .LVU17
+	testq	%r12, %r12
+	je	.L25
+	.loc 1 192 9 is_stmt 1 view .LVU18
+	.loc 1 193 9 view .LVU19
+	.loc 1 193 21 is_stmt 0 view .LVU20
+	movq	24(%rsp), %rsi
+	movq	%r12, %rdi
+	call	slab_object_class@PLT
+.LVL5:
+	movl	%eax, 4(%rsp)
+.LVL6:
+	.loc 1 194 9 is_stmt 1 view .LVU21
+	.loc 1 196 9 view .LVU22
+.LBB66:
+	.loc 1 196 14 view .LVU23
+	.loc 1 196 36 view .LVU24
+	cmpl	3696(%r15), %ebx
+	jnb	.L13
+	movq	%r12, 16(%rsp)
+	.loc 1 196 23 is_stmt 0 view .LVU25
+	movl	%ebx, %r14d
+	jmp	.L9
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 196 64 is_stmt 1 discriminator 2 view .LVU26
+	addl	$1, %r14d
+.LVL8:
+	.loc 1 196 36 discriminator 2 view .LVU27
+	cmpl	3696(%r15), %r14d
+	jnb	.L5
+.LVL9:
+.L9:
+.LBB62:
+	.loc 1 197 13 view .LVU28
+	.loc 1 197 19 is_stmt 0 view .LVU29
+	movl	%r14d, %ecx
+	leaq	456(%rcx), %rbp
+	movq	56(%r15,%rbp,8), %r13
+.LVL10:
+	.loc 1 198 13 is_stmt 1 view .LVU30
+	.loc 1 200 13 view .LVU31
+	.loc 1 200 16 is_stmt 0 view .LVU32
+	testq	%r13, %r13
+	je	.L8
+	.loc 1 200 31 discriminator 1 view .LVU33
+	movq	8(%rsp), %rsi
+	movq	%r13, %rdi
+	call	slab_object_class@PLT
+.LVL11:
+	.loc 1 200 28 discriminator 1 view .LVU34
+	movl	4(%rsp), %esi
+	cmpl	%esi, %eax
+	jne	.L8
+	.loc 1 200 77 discriminator 2 view .LVU35
+	movl	40(%rsp), %eax
+	cmpl	%eax, 44(%rsp)
+	jne	.L8
+	.loc 1 201 17 is_stmt 1 view .LVU36
+	.loc 1 201 32 is_stmt 0 view .LVU37
+	movq	16(%rsp), %rax
+.LBE62:
+	.loc 1 196 64 view .LVU38
+	addl	$1, %r14d
+.LVL12:
+.LBB63:
+	.loc 1 203 38 view .LVU39
+	movq	%r13, 16(%rsp)
+.LVL13:
+	.loc 1 201 32 view .LVU40
+	movq	%r13, (%rax)
+	.loc 1 202 17 is_stmt 1 view .LVU41
+.LVL14:
+	.loc 1 203 17 view .LVU42
+	.loc 1 203 17 is_stmt 0 view .LVU43
+.LBE63:
+	.loc 1 196 64 is_stmt 1 view .LVU44
+	.loc 1 196 36 view .LVU45
+.LBB64:
+	.loc 1 203 38 is_stmt 0 view .LVU46
+	movq	$0, 56(%r15,%rbp,8)
+.LBE64:
+	.loc 1 196 36 view .LVU47
+	cmpl	3696(%r15), %r14d
+	jb	.L9
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.loc 1 196 36 view .LVU48
+.LBE66:
+	.loc 1 207 9 is_stmt 1 view .LVU49
+	.loc 1 207 16 is_stmt 0 view .LVU50
+	movl	40(%rsp), %edx
+	movslq	4(%rsp), %rbp
+	leaq	remote_inbox(%rip), %rdi
+	leaq	0(,%rdx,8), %rax
+	subq	%rdx, %rax
+	leaq	0(%rbp,%rax,2), %rax
+	leaq	(%rdi,%rax,8), %rdx
+.LVL16:
+	.loc 1 208 9 is_stmt 1 view .LVU51
+	.loc 1 208 23 is_stmt 0 view .LVU52
+	movq	(%rdx), %rax
+.LVL17:
+.L11:
+	.loc 1 210 9 is_stmt 1 discriminator 1 view .LVU53
+	.loc 1 211 13 discriminator 1 view .LVU54
+	.loc 1 211 28 is_stmt 0 discriminator 1 view .LVU55
+	movq	16(%rsp), %rdi
+	movq	%rax, (%rdi)
+	.loc 1 212 18 is_stmt 1 discriminator 1 view .LVU56
+	.loc 1 212 19 is_stmt 0 discriminator 1 view .LVU57
+	lock cmpxchgq	%r12, (%rdx)
+.LVL18:
+	.loc 1 212 18 discriminator 1 view .LVU58
+	jne	.L11
+	.loc 1 189 13 is_stmt 1 view .LVU59
+.LVL19:
+	.loc 1 189 13 is_stmt 0 view .LVU60
+.LBE69:
+	.loc 1 186 56 is_stmt 1 view .LVU61
+	.loc 1 186 28 view .LVU62
+	cmpl	3696(%r15), %ebx
+	jb	.L2
+.LVL20:
+.L4:
+	.loc 1 186 28 is_stmt 0 view .LVU63
+.LBE71:
+	.loc 1 215 5 is_stmt 1 view .LVU64
+	.loc 1 215 29 is_stmt 0 view .LVU65
+	movl	$0, 3696(%r15)
+	.loc 1 216 1 view .LVU66
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+.LVL21:
+	.loc 1 216 1 view .LVU67
+	ret
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+.LBB72:
+.LBB70:
+.LBB67:
+	.loc 1 196 36 view .LVU68
+	movq	%r12, 16(%rsp)
+	jmp	.L5
+.LBE67:
+.LBE70:
+.LBE72:
+	.cfi_endproc
+.LFE34:
+	.size	_cpu_cache_flush_remote, .-_cpu_cache_flush_remote
+	.p2align 4
+	.type	_heap_free, @function
+_heap_free:
+.LVL23:
+.LFB36:
+	.loc 1 249 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 250 5 view .LVU70
+	.loc 1 251 5 view .LVU71
+	.loc 1 249 1 is_stmt 0 view .LVU72
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 251 17 view .LVU73
+	leaq	28(%rsp), %rsi
+	call	slab_object_class@PLT
+.LVL24:
+	.loc 1 252 5 is_stmt 1 view .LVU74
+	.loc 1 252 8 is_stmt 0 view .LVU75
+	testl	%eax, %eax
+	js	.L35
+	.loc 1 257 4 is_stmt 1 view .LVU76
+.LVL25:
+.LBB98:
+.LBI98:
+	.file 2 "src/include/cpu.h"
+	.loc 2 310 19 view .LVU77
+.LBB99:
+	.loc 2 312 4 view .LVU78
+.LBB100:
+.LBI100:
+	.loc 2 294 19 view .LVU79
+.LBB101:
+	.loc 2 296 5 view .LVU80
+	.loc 2 298 5 view .LVU81
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %r12
+	
+# 0 "" 2
+.LVL26:
+	.loc 2 304 5 view .LVU82
+	.loc 2 304 19 is_stmt 0 view .LVU83
+#NO_APP
+	andl	$512, %r12d
+.LVL27:
+	.loc 2 304 19 view .LVU84
+.LBE101:
+.LBE100:
+	.loc 2 314 5 is_stmt 1 view .LVU85
+	.loc 2 317 9 view .LVU86
+.LBB102:
+.LBI102:
+	.loc 2 284 20 view .LVU87
+.LBB103:
+	.loc 2 286 5 view .LVU88
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE103:
+.LBE102:
+	.loc 2 320 5 view .LVU89
+.LVL28:
+	.loc 2 320 5 is_stmt 0 view .LVU90
+.LBE99:
+.LBE98:
+	.loc 1 259 5 is_stmt 1 view .LVU91
+.LBB104:
+.LBI104:
+	.loc 2 68 24 view .LVU92
+.LBB105:
+	.loc 2 70 5 view .LVU93
+	.loc 2 71 5 view .LVU94
+#APP
+# 71 "src/include/cpu.h" 1
+	movl %gs:8, %ecx
+# 0 "" 2
+.LVL29:
+	.loc 2 72 5 view .LVU95
+	.loc 2 72 5 is_stmt 0 view .LVU96
+#NO_APP
+.LBE105:
+.LBE104:
+	.loc 1 260 5 is_stmt 1 view .LVU97
+	movl	%ecx, %r14d
+	movq	%r14, %rdx
+	salq	$5, %rdx
+	subq	%r14, %rdx
+	movq	%rdx, %rdi
+	salq	$7, %rdi
+.LVL30:
+	.loc 1 262 5 view .LVU98
+	.loc 1 262 8 is_stmt 0 view .LVU99
+	cmpl	%ecx, 28(%rsp)
+	je	.L36
+	.loc 1 271 9 is_stmt 1 view .LVU100
+	.loc 1 271 36 is_stmt 0 view .LVU101
+	leaq	cpu_caches(%rip), %rsi
+	.loc 1 271 54 view .LVU102
+	salq	$4, %rdx
+	.loc 1 271 36 view .LVU103
+	addq	%rsi, %rdi
+.LVL31:
+	.loc 1 271 36 view .LVU104
+	movl	3696(%rdi), %eax
+.LVL32:
+	.loc 1 271 50 view .LVU105
+	leal	1(%rax), %ecx
+	.loc 1 271 54 view .LVU106
+	leaq	456(%rax,%rdx), %rax
+	.loc 1 271 50 view .LVU107
+	movl	%ecx, 3696(%rdi)
+	.loc 1 271 54 view .LVU108
+	movq	%rbp, 56(%rsi,%rax,8)
+	.loc 1 273 9 is_stmt 1 view .LVU109
+	.loc 1 273 12 is_stmt 0 view .LVU110
+	cmpl	$32, %ecx
+	je	.L37
+.LVL33:
+.L31:
+	.loc 1 278 5 is_stmt 1 view .LVU111
+.LBB106:
+.LBI106:
+	.loc 2 310 19 view .LVU112
+.LBB107:
+	.loc 2 312 4 view .LVU113
+.LBB108:
+.LBI108:
+	.loc 2 294 19 view .LVU114
+.LBB109:
+	.loc 2 296 5 view .LVU115
+	.loc 2 298 5 view .LVU116
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %rax
+	
+# 0 "" 2
+.LVL34:
+	.loc 2 304 5 view .LVU117
+	.loc 2 304 5 is_stmt 0 view .LVU118
+#NO_APP
+.LBE109:
+.LBE108:
+	.loc 2 314 5 is_stmt 1 view .LVU119
+	.loc 2 314 8 is_stmt 0 view .LVU120
+	testq	%r12, %r12
+	jne	.L38
+	.loc 2 317 9 is_stmt 1 view .LVU121
+.LBB110:
+.LBI110:
+	.loc 2 284 20 view .LVU122
+.LBB111:
+	.loc 2 286 5 view .LVU123
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE111:
+.LBE110:
+	.loc 2 320 5 view .LVU124
+.LVL35:
+	.loc 2 320 5 is_stmt 0 view .LVU125
+.LBE107:
+.LBE106:
+	.loc 1 279 1 view .LVU126
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL36:
+	.loc 1 279 1 view .LVU127
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL37:
+	.loc 1 279 1 view .LVU128
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL38:
+	.loc 1 279 1 view .LVU129
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.cfi_restore_state
+.LBB115:
+.LBB114:
+	.loc 2 315 9 is_stmt 1 view .LVU130
+.LBB112:
+.LBI112:
+	.loc 2 289 20 view .LVU131
+.LBB113:
+	.loc 2 291 5 view .LVU132
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE113:
+.LBE112:
+.LBE114:
+.LBE115:
+	.loc 1 279 1 is_stmt 0 view .LVU133
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL40:
+	.loc 1 279 1 view .LVU134
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL41:
+	.loc 1 279 1 view .LVU135
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL42:
+	.loc 1 279 1 view .LVU136
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.cfi_restore_state
+.LBB116:
+	.loc 1 263 9 is_stmt 1 view .LVU137
+	.loc 1 265 9 view .LVU138
+	.loc 1 265 19 is_stmt 0 view .LVU139
+	movslq	%eax, %rbx
+	leaq	cpu_caches(%rip), %r13
+	movq	%rbx, %rax
+	.loc 1 265 19 view .LVU140
+	salq	$5, %rax
+.LVL44:
+	.loc 1 265 19 view .LVU141
+	addq	%rbx, %rax
+	salq	$3, %rax
+	leaq	(%rax,%rdi), %r15
+	addq	%r13, %r15
+	movl	(%r15), %edx
+	.loc 1 265 12 view .LVU142
+	cmpl	$32, %edx
+	je	.L39
+.LVL45:
+.L30:
+	.loc 1 269 9 is_stmt 1 view .LVU143
+	.loc 1 269 38 is_stmt 0 view .LVU144
+	movq	%r14, %rax
+	movq	%rbx, %rcx
+	leal	1(%rdx), %edi
+	salq	$5, %rax
+	salq	$5, %rcx
+	subq	%r14, %rax
+	addq	%rbx, %rcx
+	movq	%rax, %rsi
+	.loc 1 269 42 view .LVU145
+	salq	$4, %rax
+	.loc 1 269 38 view .LVU146
+	salq	$7, %rsi
+	.loc 1 269 42 view .LVU147
+	addq	%rcx, %rax
+	.loc 1 269 38 view .LVU148
+	leaq	(%rsi,%rcx,8), %rsi
+	.loc 1 269 42 view .LVU149
+	addq	%rdx, %rax
+	.loc 1 269 38 view .LVU150
+	movl	%edi, 0(%r13,%rsi)
+	.loc 1 269 42 view .LVU151
+	movq	%rbp, 8(%r13,%rax,8)
+.LBE116:
+	jmp	.L31
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 274 13 is_stmt 1 view .LVU152
+	call	_cpu_cache_flush_remote
+.LVL47:
+	.loc 1 274 13 is_stmt 0 view .LVU153
+	jmp	.L31
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 253 9 is_stmt 1 view .LVU154
+	movq	%rbp, %rdi
+	call	slab_free@PLT
+.LVL49:
+	.loc 1 254 9 view .LVU155
+	.loc 1 279 1 is_stmt 0 view .LVU156
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL50:
+	.loc 1 279 1 view .LVU157
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL51:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.cfi_restore_state
+.LBB121:
+	.loc 1 266 13 is_stmt 1 view .LVU158
+.LBB117:
+.LBI117:
+	.loc 1 148 13 view .LVU159
+.LBB118:
+	.loc 1 150 5 view .LVU160
+	.loc 1 150 27 is_stmt 0 view .LVU161
+	leaq	8(%rdi,%rax), %rdi
+.LVL52:
+	.loc 1 150 5 view .LVU162
+	movl	$16, %esi
+	.loc 1 150 27 view .LVU163
+	addq	%r13, %rdi
+	.loc 1 150 5 view .LVU164
+	movq	%rdi, 8(%rsp)
+	call	slab_free_batch@PLT
+.LVL53:
+	.loc 1 152 5 is_stmt 1 view .LVU165
+	.loc 1 152 19 is_stmt 0 view .LVU166
+	movl	(%r15), %eax
+	.loc 1 153 5 view .LVU167
+	movq	8(%rsp), %rdi
+	.loc 1 152 19 view .LVU168
+	subl	$16, %eax
+	.loc 1 153 5 view .LVU169
+	leaq	128(%rdi), %rsi
+	leaq	0(,%rax,8), %rdx
+	.loc 1 152 19 view .LVU170
+	movl	%eax, (%r15)
+	.loc 1 153 5 is_stmt 1 view .LVU171
+	call	memmove@PLT
+.LVL54:
+.LBE118:
+.LBE117:
+	.loc 1 269 31 is_stmt 0 view .LVU172
+	movl	(%r15), %edx
+.LBB120:
+.LBB119:
+	.loc 1 154 1 view .LVU173
+	jmp	.L30
+.LBE119:
+.LBE120:
+.LBE121:
+	.cfi_endproc
+.LFE36:
+	.size	_heap_free, .-_heap_free
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Allocation of %lu bytes failed.\n"
+	.text
+	.p2align 4
+	.type	_heap_malloc, @function
+_heap_malloc:
+.LVL55:
+.LFB35:
+	.loc 1 219 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 220 5 view .LVU175
+	.loc 1 219 1 is_stmt 0 view .LVU176
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 220 17 view .LVU177
+	call	slab_size_class@PLT
+.LVL56:
+	.loc 1 221 5 is_stmt 1 view .LVU178
+	.loc 1 221 8 is_stmt 0 view .LVU179
+	testl	%eax, %eax
+	js	.L56
+	movl	%eax, %edi
+	.loc 1 225 4 is_stmt 1 view .LVU180
+.LVL57:
+.LBB143:
+.LBI143:
+	.loc 2 310 19 view .LVU181
+.LBB144:
+	.loc 2 312 4 view .LVU182
+.LBB145:
+.LBI145:
+	.loc 2 294 19 view .LVU183
+.LBB146:
+	.loc 2 296 5 view .LVU184
+	.loc 2 298 5 view .LVU185
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %r9
+	
+# 0 "" 2
+.LVL58:
+	.loc 2 304 5 view .LVU186
+	.loc 2 304 19 is_stmt 0 view .LVU187
+#NO_APP
+	andl	$512, %r9d
+.LVL59:
+	.loc 2 304 19 view .LVU188
+.LBE146:
+.LBE145:
+	.loc 2 314 5 is_stmt 1 view .LVU189
+	.loc 2 317 9 view .LVU190
+.LBB147:
+.LBI147:
+	.loc 2 284 20 view .LVU191
+.LBB148:
+	.loc 2 286 5 view .LVU192
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE148:
+.LBE147:
+	.loc 2 320 5 view .LVU193
+.LVL60:
+	.loc 2 320 5 is_stmt 0 view .LVU194
+.LBE144:
+.LBE143:
+	.loc 1 227 5 is_stmt 1 view .LVU195
+.LBB149:
+.LBI149:
+	.loc 2 68 24 view .LVU196
+.LBB150:
+	.loc 2 70 5 view .LVU197
+	.loc 2 71 5 view .LVU198
+#APP
+# 71 "src/include/cpu.h" 1
+	movl %gs:8, %r10d
+# 0 "" 2
+.LVL61:
+	.loc 2 72 5 view .LVU199
+	.loc 2 72 5 is_stmt 0 view .LVU200
+#NO_APP
+.LBE150:
+.LBE149:
+	.loc 1 228 5 is_stmt 1 view .LVU201
+	.loc 1 230 5 view .LVU202
+	.loc 1 230 15 is_stmt 0 view .LVU203
+	movl	%r10d, %r15d
+	movslq	%eax, %r8
+	leaq	cpu_caches(%rip), %r12
+	movq	%r15, %r14
+	movq	%r8, %rcx
+	salq	$5, %r14
+	salq	$5, %rcx
+	subq	%r15, %r14
+	addq	%r8, %rcx
+	movq	%r14, %rdx
+	leaq	0(,%rcx,8), %rsi
+	salq	$7, %rdx
+	leaq	(%rsi,%rdx), %rbp
+	addq	%r12, %rbp
+	movl	0(%rbp), %eax
+.LVL62:
+	.loc 1 230 8 view .LVU204
+	testl	%eax, %eax
+	je	.L57
+.LVL63:
+.L48:
+	.loc 1 236 9 is_stmt 1 view .LVU205
+	.loc 1 236 13 is_stmt 0 view .LVU206
+	movq	%r15, %rdx
+	movq	%r8, %rcx
+	.loc 1 236 31 view .LVU207
+	subl	$1, %eax
+	.loc 1 236 13 view .LVU208
+	salq	$5, %rdx
+	salq	$5, %rcx
+	subq	%r15, %rdx
+	addq	%r8, %rcx
+	movq	%rdx, %rsi
+	salq	$4, %rdx
+	salq	$7, %rsi
+	addq	%rcx, %rdx
+	leaq	(%rsi,%rcx,8), %rsi
+	addq	%rax, %rdx
+	movl	%eax, (%r12,%rsi)
+	movq	8(%r12,%rdx,8), %rax
+.LVL64:
+	.loc 1 239 5 is_stmt 1 view .LVU209
+.LBB151:
+.LBI151:
+	.loc 2 310 19 view .LVU210
+.LBB152:
+	.loc 2 312 4 view .LVU211
+.LBB153:
+.LBI153:
+	.loc 2 294 19 view .LVU212
+.LBB154:
+	.loc 2 296 5 view .LVU213
+	.loc 2 298 5 view .LVU214
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %rdx
+	
+# 0 "" 2
+.LVL65:
+	.loc 2 304 5 view .LVU215
+	.loc 2 304 5 is_stmt 0 view .LVU216
+#NO_APP
+.LBE154:
+.LBE153:
+	.loc 2 314 5 is_stmt 1 view .LVU217
+	.loc 2 314 8 is_stmt 0 view .LVU218
+	testq	%r9, %r9
+	jne	.L58
+	.loc 2 317 9 is_stmt 1 view .LVU219
+.LBB156:
+.LBI156:
+	.loc 2 284 20 view .LVU220
+.LBB157:
+	.loc 2 286 5 view .LVU221
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.L52:
+.LBE157:
+.LBE156:
+	.loc 2 320 5 view .LVU222
+.LVL66:
+	.loc 2 320 5 is_stmt 0 view .LVU223
+.LBE152:
+.LBE151:
+	.loc 1 241 5 is_stmt 1 view .LVU224
+	.loc 1 241 8 is_stmt 0 view .LVU225
+	testq	%rax, %rax
+	je	.L50
+	.loc 1 246 1 view .LVU226
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.cfi_restore_state
+.LBB168:
+.LBB165:
+	.loc 2 315 9 is_stmt 1 view .LVU227
+.LBB159:
+.LBI159:
+	.loc 2 289 20 view .LVU228
+.LBB160:
+	.loc 2 291 5 view .LVU229
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+	.loc 2 292 1 is_stmt 0 view .LVU230
+#NO_APP
+	jmp	.L52
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.loc 2 292 1 view .LVU231
+.LBE160:
+.LBE159:
+.LBE165:
+.LBE168:
+	.loc 1 231 9 is_stmt 1 view .LVU232
+.LBB169:
+.LBI169:
+	.loc 1 160 13 view .LVU233
+.LBB170:
+	.loc 1 162 5 view .LVU234
+	.loc 1 162 39 is_stmt 0 view .LVU235
+	leaq	0(,%r15,8), %rax
+	.loc 1 162 19 view .LVU236
+	xorl	%ebx, %ebx
+	.loc 1 162 39 view .LVU237
+	subq	%r15, %rax
+	leaq	(%r8,%rax,2), %r11
+	.loc 1 162 19 view .LVU238
+	leaq	remote_inbox(%rip), %rax
+	xchgq	(%rax,%r11,8), %rbx
+.LVL69:
+	.loc 1 164 5 is_stmt 1 view .LVU239
+	.loc 1 164 18 view .LVU240
+	testq	%rbx, %rbx
+	je	.L47
+.LBB171:
+.LBB172:
+.LBB173:
+	.loc 1 150 27 is_stmt 0 view .LVU241
+	leaq	8(%rsi,%rdx), %rsi
+	.loc 1 153 5 view .LVU242
+	movq	%r13, 32(%rsp)
+	movq	%r14, %r13
+.LVL70:
+	.loc 1 153 5 view .LVU243
+	movq	%rbp, %r14
+	.loc 1 150 27 view .LVU244
+	addq	%r12, %rsi
+	.loc 1 153 5 view .LVU245
+	movq	%r15, 56(%rsp)
+	movq	%rbx, %rbp
+	movq	%rcx, %r15
+	leaq	128(%rsi), %rax
+	movl	%edi, 40(%rsp)
+	movq	%rax, 16(%rsp)
+	movq	%r9, 24(%rsp)
+	movq	%rsi, 8(%rsp)
+	movl	%r10d, 44(%rsp)
+	movq	%r8, 48(%rsp)
+	jmp	.L46
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 153 5 view .LVU246
+.LBE173:
+.LBE172:
+	.loc 1 171 9 is_stmt 1 view .LVU247
+	.loc 1 171 38 is_stmt 0 view .LVU248
+	leal	1(%rax), %edx
+	movl	%edx, (%r14)
+	.loc 1 171 42 view .LVU249
+	movq	%r13, %rdx
+	salq	$4, %rdx
+	addq	%r15, %rdx
+	addq	%rdx, %rax
+	movq	%rbx, 8(%r12,%rax,8)
+	.loc 1 172 9 is_stmt 1 view .LVU250
+.LVL72:
+	.loc 1 172 9 is_stmt 0 view .LVU251
+.LBE171:
+	.loc 1 164 18 is_stmt 1 view .LVU252
+	testq	%rbp, %rbp
+	je	.L59
+.LVL73:
+.L46:
+.LBB178:
+	.loc 1 165 9 view .LVU253
+	.loc 1 167 19 is_stmt 0 view .LVU254
+	movl	(%r14), %eax
+	movq	%rbp, %rbx
+	.loc 1 165 15 view .LVU255
+	movq	0(%rbp), %rbp
+.LVL74:
+	.loc 1 167 9 is_stmt 1 view .LVU256
+	.loc 1 167 12 is_stmt 0 view .LVU257
+	cmpl	$32, %eax
+	jne	.L45
+	.loc 1 168 13 is_stmt 1 view .LVU258
+.LVL75:
+.LBB176:
+.LBI172:
+	.loc 1 148 13 view .LVU259
+.LBB174:
+	.loc 1 150 5 view .LVU260
+	movq	8(%rsp), %rdi
+	movl	$16, %esi
+	call	slab_free_batch@PLT
+.LVL76:
+	.loc 1 152 5 view .LVU261
+	.loc 1 152 19 is_stmt 0 view .LVU262
+	movl	(%r14), %eax
+	.loc 1 153 5 view .LVU263
+	movq	16(%rsp), %rsi
+	movq	8(%rsp), %rdi
+	.loc 1 152 19 view .LVU264
+	leal	-16(%rax), %edx
+	movl	%edx, (%r14)
+	.loc 1 153 5 is_stmt 1 view .LVU265
+	salq	$3, %rdx
+	call	memmove@PLT
+.LVL77:
+.LBE174:
+.LBE176:
+	.loc 1 171 31 is_stmt 0 view .LVU266
+	movl	(%r14), %eax
+.LBB177:
+.LBB175:
+	.loc 1 154 1 view .LVU267
+	jmp	.L45
+.LVL78:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 154 1 view .LVU268
+.LBE175:
+.LBE177:
+.LBE178:
+	movl	40(%rsp), %edi
+	movq	24(%rsp), %r9
+	movq	32(%rsp), %r13
+	movl	44(%rsp), %r10d
+	movq	48(%rsp), %r8
+	movq	56(%rsp), %r15
+.LVL79:
+.L47:
+	.loc 1 175 5 is_stmt 1 view .LVU269
+	.loc 1 175 15 is_stmt 0 view .LVU270
+	movq	%r8, %rcx
+	movq	%r15, %rdx
+	salq	$5, %rcx
+	salq	$5, %rdx
+	addq	%r8, %rcx
+	subq	%r15, %rdx
+	salq	$3, %rcx
+	salq	$7, %rdx
+	leaq	(%rcx,%rdx), %rbx
+	addq	%r12, %rbx
+	movl	(%rbx), %eax
+	.loc 1 175 8 view .LVU271
+	testl	%eax, %eax
+	jne	.L48
+	.loc 1 176 55 view .LVU272
+	leaq	8(%rcx,%rdx), %rsi
+	.loc 1 176 25 view .LVU273
+	movl	%r10d, %ecx
+	movl	$16, %edx
+	movq	%r8, 16(%rsp)
+	.loc 1 176 55 view .LVU274
+	addq	%r12, %rsi
+	movq	%r9, 8(%rsp)
+	.loc 1 176 9 is_stmt 1 view .LVU275
+	.loc 1 176 25 is_stmt 0 view .LVU276
+	call	slab_alloc_batch@PLT
+.LVL80:
+.LBE170:
+.LBE169:
+	.loc 1 235 8 view .LVU277
+	movq	8(%rsp), %r9
+	movq	16(%rsp), %r8
+	testl	%eax, %eax
+.LBB180:
+.LBB179:
+	.loc 1 176 23 view .LVU278
+	movl	%eax, (%rbx)
+.LVL81:
+	.loc 1 176 23 view .LVU279
+.LBE179:
+.LBE180:
+	.loc 1 234 5 is_stmt 1 view .LVU280
+	.loc 1 235 5 view .LVU281
+	.loc 1 235 8 is_stmt 0 view .LVU282
+	jne	.L48
+	.loc 1 239 5 is_stmt 1 view .LVU283
+.LVL82:
+.LBB181:
+	.loc 2 310 19 view .LVU284
+.LBB166:
+	.loc 2 312 4 view .LVU285
+.LBB162:
+	.loc 2 294 19 view .LVU286
+.LBB155:
+	.loc 2 296 5 view .LVU287
+	.loc 2 298 5 view .LVU288
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %rax
+	
+# 0 "" 2
+.LVL83:
+	.loc 2 304 5 view .LVU289
+	.loc 2 304 5 is_stmt 0 view .LVU290
+#NO_APP
+.LBE155:
+.LBE162:
+	.loc 2 314 5 is_stmt 1 view .LVU291
+	.loc 2 314 8 is_stmt 0 view .LVU292
+	testq	%r9, %r9
+	je	.L49
+	.loc 2 315 9 is_stmt 1 view .LVU293
+.LBB163:
+	.loc 2 289 20 view .LVU294
+.LBB161:
+	.loc 2 291 5 view .LVU295
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE161:
+.LBE163:
+	.loc 2 320 5 view .LVU296
+.LVL84:
+	.loc 2 320 5 is_stmt 0 view .LVU297
+.LBE166:
+.LBE181:
+	.loc 1 241 5 is_stmt 1 view .LVU298
+.L50:
+	.loc 1 242 9 view .LVU299
+	movq	%r13, %rsi
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+	call	kprintf@PLT
+.LVL85:
+	.loc 1 246 1 is_stmt 0 view .LVU300
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 242 9 view .LVU301
+	xorl	%eax, %eax
+	.loc 1 246 1 view .LVU302
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL86:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+.LBB182:
+.LBB167:
+	.loc 2 317 9 is_stmt 1 view .LVU303
+.LBB164:
+	.loc 2 284 20 view .LVU304
+.LBB158:
+	.loc 2 286 5 view .LVU305
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE158:
+.LBE164:
+	.loc 2 320 5 view .LVU306
+.LVL87:
+	.loc 2 320 5 is_stmt 0 view .LVU307
+.LBE167:
+.LBE182:
+	.loc 1 241 5 is_stmt 1 view .LVU308
+	jmp	.L50
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 222 9 view .LVU309
+	.loc 1 246 1 is_stmt 0 view .LVU310
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 56
+	.loc 1 222 16 view .LVU311
+	movq	%r13, %rdi
+	.loc 1 246 1 view .LVU312
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+.LVL89:
+	.loc 1 246 1 view .LVU313
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 222 16 view .LVU314
+	jmp	slab_malloc@PLT
+.LVL90:
+	.loc 1 222 16 view .LVU315
+	.cfi_endproc
+.LFE35:
+	.size	_heap_malloc, .-_heap_malloc
+	.p2align 4
+	.globl	alloc_cpu_cache_drain
+	.type	alloc_cpu_cache_drain, @function
+alloc_cpu_cache_drain:
+.LFB41:
+	.loc 1 340 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 341 4 view .LVU317
+.LVL91:
+.LBB204:
+.LBI204:
+	.loc 2 310 19 view .LVU318
+.LBB205:
+	.loc 2 312 4 view .LVU319
+.LBB206:
+.LBI206:
+	.loc 2 294 19 view .LVU320
+.LBB207:
+	.loc 2 296 5 view .LVU321
+	.loc 2 298 5 view .LVU322
+.LBE207:
+.LBE206:
+.LBE205:
+.LBE204:
+	.loc 1 340 1 is_stmt 0 view .LVU323
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+.LBB213:
+.LBB212:
+.LBB209:
+.LBB208:
+	.loc 2 298 5 view .LVU324
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %r15
+	
+# 0 "" 2
+.LVL92:
+	.loc 2 304 5 is_stmt 1 view .LVU325
+	.loc 2 304 19 is_stmt 0 view .LVU326
+#NO_APP
+	andl	$512, %r15d
+.LVL93:
+	.loc 2 304 19 view .LVU327
+	movq	%r15, 8(%rsp)
+.LVL94:
+	.loc 2 304 19 view .LVU328
+.LBE208:
+.LBE209:
+	.loc 2 314 5 is_stmt 1 view .LVU329
+	.loc 2 317 9 view .LVU330
+.LBB210:
+.LBI210:
+	.loc 2 284 20 view .LVU331
+.LBB211:
+	.loc 2 286 5 view .LVU332
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE211:
+.LBE210:
+	.loc 2 320 5 view .LVU333
+.LVL95:
+	.loc 2 320 5 is_stmt 0 view .LVU334
+.LBE212:
+.LBE213:
+	.loc 1 343 5 is_stmt 1 view .LVU335
+.LBB214:
+.LBI214:
+	.loc 2 68 24 view .LVU336
+.LBB215:
+	.loc 2 70 5 view .LVU337
+	.loc 2 71 5 view .LVU338
+#APP
+# 71 "src/include/cpu.h" 1
+	movl %gs:8, %r13d
+# 0 "" 2
+.LVL96:
+	.loc 2 72 5 view .LVU339
+	.loc 2 72 5 is_stmt 0 view .LVU340
+#NO_APP
+.LBE215:
+.LBE214:
+	.loc 1 344 5 is_stmt 1 view .LVU341
+	movl	%r13d, %r13d
+	.loc 1 344 22 is_stmt 0 view .LVU342
+	leaq	cpu_caches(%rip), %rbp
+.LBB216:
+.LBB217:
+	.loc 1 353 23 view .LVU343
+	xorl	%r14d, %r14d
+	movq	%r13, %rbx
+	leaq	0(,%r13,8), %r12
+	salq	$5, %rbx
+	subq	%r13, %r12
+	subq	%r13, %rbx
+	salq	$4, %r12
+	leaq	3696+cpu_caches(%rip), %r13
+.LVL97:
+	.loc 1 353 23 view .LVU344
+	salq	$7, %rbx
+.LBE217:
+.LBE216:
+	.loc 1 344 22 view .LVU345
+	addq	%rbx, %rbp
+.LVL98:
+	.loc 1 346 5 is_stmt 1 view .LVU346
+	addq	%rbx, %r13
+	movq	%rbp, %rdi
+	call	_cpu_cache_flush_remote
+.LVL99:
+	.loc 1 348 5 view .LVU347
+.LBB224:
+	.loc 1 348 10 view .LVU348
+	.loc 1 348 31 view .LVU349
+	leaq	remote_inbox(%rip), %rax
+	addq	%rax, %r12
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+.LBB223:
+	.loc 1 349 9 view .LVU350
+	.loc 1 351 9 view .LVU351
+	movl	0(%rbp), %ebx
+.LVL101:
+.LBB218:
+.LBI218:
+	.loc 1 148 13 view .LVU352
+.LBB219:
+	.loc 1 150 5 view .LVU353
+	.loc 1 150 27 is_stmt 0 view .LVU354
+	leaq	8(%rbp), %r15
+	.loc 1 150 5 view .LVU355
+	movq	%r15, %rdi
+	movl	%ebx, %esi
+	call	slab_free_batch@PLT
+.LVL102:
+	.loc 1 152 5 is_stmt 1 view .LVU356
+	.loc 1 152 19 is_stmt 0 view .LVU357
+	movl	0(%rbp), %edx
+	.loc 1 153 5 view .LVU358
+	leaq	(%r15,%rbx,8), %rsi
+	movq	%r15, %rdi
+	.loc 1 152 19 view .LVU359
+	subl	%ebx, %edx
+.LBE219:
+.LBE218:
+	.loc 1 353 23 view .LVU360
+	movq	%r14, %rbx
+.LVL103:
+.LBB221:
+.LBB220:
+	.loc 1 152 19 view .LVU361
+	movl	%edx, 0(%rbp)
+	.loc 1 153 5 is_stmt 1 view .LVU362
+	salq	$3, %rdx
+	call	memmove@PLT
+.LVL104:
+	.loc 1 153 5 is_stmt 0 view .LVU363
+.LBE220:
+.LBE221:
+	.loc 1 353 9 is_stmt 1 view .LVU364
+	.loc 1 353 23 is_stmt 0 view .LVU365
+	xchgq	(%r12), %rbx
+.LVL105:
+	.loc 1 354 9 is_stmt 1 view .LVU366
+	.loc 1 354 22 view .LVU367
+	testq	%rbx, %rbx
+	je	.L64
+	.p2align 4,,10
+	.p2align 3
+.L61:
+.LBB222:
+	.loc 1 355 13 view .LVU368
+	movq	%rbx, %rdi
+	.loc 1 355 19 is_stmt 0 view .LVU369
+	movq	(%rbx), %rbx
+.LVL106:
+	.loc 1 356 13 is_stmt 1 view .LVU370
+	call	slab_free@PLT
+.LVL107:
+	.loc 1 357 13 view .LVU371
+	.loc 1 357 13 is_stmt 0 view .LVU372
+.LBE222:
+	.loc 1 354 22 is_stmt 1 view .LVU373
+	testq	%rbx, %rbx
+	jne	.L61
+.LVL108:
+.L64:
+	.loc 1 354 22 is_stmt 0 view .LVU374
+.LBE223:
+	.loc 1 348 42 is_stmt 1 view .LVU375
+	.loc 1 348 31 view .LVU376
+	addq	$264, %rbp
+	.loc 1 348 31 is_stmt 0 view .LVU377
+	addq	$8, %r12
+	cmpq	%r13, %rbp
+	jne	.L62
+.LBE224:
+	.loc 1 361 5 is_stmt 1 view .LVU378
+.LVL109:
+.LBB225:
+.LBI225:
+	.loc 2 310 19 view .LVU379
+.LBB226:
+	.loc 2 312 4 view .LVU380
+.LBB227:
+.LBI227:
+	.loc 2 294 19 view .LVU381
+.LBB228:
+	.loc 2 296 5 view .LVU382
+	.loc 2 298 5 view .LVU383
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %rax
+	
+# 0 "" 2
+.LVL110:
+	.loc 2 304 5 view .LVU384
+	.loc 2 304 5 is_stmt 0 view .LVU385
+#NO_APP
+.LBE228:
+.LBE227:
+	.loc 2 314 5 is_stmt 1 view .LVU386
+	.loc 2 314 8 is_stmt 0 view .LVU387
+	cmpq	$0, 8(%rsp)
+	je	.L65
+	.loc 2 315 9 is_stmt 1 view .LVU388
+.LBB229:
+.LBI229:
+	.loc 2 289 20 view .LVU389
+.LBB230:
+	.loc 2 291 5 view .LVU390
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE230:
+.LBE229:
+.LBE226:
+.LBE225:
+	.loc 1 362 1 is_stmt 0 view .LVU391
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL111:
+	.loc 1 362 1 view .LVU392
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 362 1 view .LVU393
+	ret
+.LVL112:
+.L65:
+	.cfi_restore_state
+.LBB234:
+.LBB233:
+	.loc 2 317 9 is_stmt 1 view .LVU394
+.LBB231:
+.LBI231:
+	.loc 2 284 20 view .LVU395
+.LBB232:
+	.loc 2 286 5 view .LVU396
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE232:
+.LBE231:
+	.loc 2 320 5 view .LVU397
+.LVL113:
+	.loc 2 320 5 is_stmt 0 view .LVU398
+.LBE233:
+.LBE234:
+	.loc 1 362 1 view .LVU399
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL114:
+	.loc 1 362 1 view .LVU400
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 362 1 view .LVU401
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	alloc_cpu_cache_drain, .-alloc_cpu_cache_drain
+	.section	.rodata.str1.8
+	.align 8
+.LC1:
+	.string	"Heap profiling is off, define ALLOC_PROFILE in alloc.h to turn it on.\n"
+	.text
+	.p2align 4
+	.globl	alloc_profile_report
+	.type	alloc_profile_report, @function
+alloc_profile_report:
+.LFB42:
+	.loc 1 546 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 547 5 view .LVU403
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	jmp	kprintf@PLT
+.LVL115:
+	.cfi_endproc
+.LFE42:
+	.size	alloc_profile_report, .-alloc_profile_report
+	.p2align 4
+	.globl	alloc_profile_report_serial
+	.type	alloc_profile_report_serial, @function
+alloc_profile_report_serial:
+.LFB51:
+	.cfi_startproc
+	.loc 1 550 6 view .LVU404
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	jmp	kprintf@PLT
+	.cfi_endproc
+.LFE51:
+	.size	alloc_profile_report_serial, .-alloc_profile_report_serial
+	.p2align 4
+	.globl	malloc
+	.type	malloc, @function
+malloc:
+.LVL116:
+.LFB45:
+	.loc 1 573 1 view -0
+	.cfi_startproc
+	.loc 1 574 5 view .LVU406
+.LBB235:
+.LBI235:
+	.loc 1 559 21 view .LVU407
+.LBB236:
+	.loc 1 561 5 view .LVU408
+	.loc 1 561 17 is_stmt 0 view .LVU409
+	jmp	_heap_malloc
+.LVL117:
+	.loc 1 561 17 view .LVU410
+.LBE236:
+.LBE235:
+	.cfi_endproc
+.LFE45:
+	.size	malloc, .-malloc
+	.p2align 4
+	.globl	free
+	.type	free, @function
+free:
+.LVL118:
+.LFB46:
+	.loc 1 578 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 579 5 view .LVU412
+	.loc 1 579 8 is_stmt 0 view .LVU413
+	testq	%rdi, %rdi
+	je	.L75
+	.loc 1 587 5 is_stmt 1 view .LVU414
+	jmp	_heap_free
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.loc 1 588 1 is_stmt 0 view .LVU415
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	free, .-free
+	.section	.rodata.str1.8
+	.align 8
+.LC2:
+	.string	"realloc isn't supported by this heap.\n"
+	.text
+	.p2align 4
+	.globl	realloc
+	.type	realloc, @function
+realloc:
+.LVL120:
+.LFB47:
+	.loc 1 596 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 597 5 view .LVU417
+	.loc 1 599 5 view .LVU418
+	.loc 1 596 1 is_stmt 0 view .LVU419
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 599 8 view .LVU420
+	testq	%rdi, %rdi
+	je	.L88
+	movq	%rdi, %rbx
+	.loc 1 603 5 is_stmt 1 view .LVU421
+	.loc 1 603 8 is_stmt 0 view .LVU422
+	testq	%rsi, %rsi
+	je	.L89
+	.loc 1 608 5 is_stmt 1 view .LVU423
+.LVL121:
+.LBB237:
+.LBI237:
+	.loc 1 281 22 view .LVU424
+.LBB238:
+	.loc 1 283 5 view .LVU425
+	.loc 1 283 12 is_stmt 0 view .LVU426
+	call	slab_usable_size@PLT
+.LVL122:
+	.loc 1 283 12 view .LVU427
+	movq	%rax, %r12
+.LVL123:
+	.loc 1 283 12 view .LVU428
+.LBE238:
+.LBE237:
+	.loc 1 610 5 is_stmt 1 view .LVU429
+	.loc 1 610 8 is_stmt 0 view .LVU430
+	testq	%rax, %rax
+	je	.L90
+	.loc 1 615 5 is_stmt 1 view .LVU431
+	movq	%rbx, %r13
+	.loc 1 615 8 is_stmt 0 view .LVU432
+	cmpq	%rbp, %rax
+	jb	.L91
+.LVL124:
+.L77:
+	.loc 1 636 1 view .LVU433
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%r13, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL125:
+	.loc 1 636 1 view .LVU434
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL126:
+	.loc 1 636 1 view .LVU435
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL127:
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.cfi_restore_state
+	.loc 1 619 5 is_stmt 1 view .LVU436
+	.loc 1 627 5 view .LVU437
+.LBB239:
+.LBI239:
+	.loc 1 559 21 view .LVU438
+.LBB240:
+	.loc 1 561 5 view .LVU439
+	.loc 1 561 17 is_stmt 0 view .LVU440
+	movq	%rbp, %rdi
+	call	_heap_malloc
+.LVL128:
+	.loc 1 561 17 view .LVU441
+	movq	%rax, %r13
+.LVL129:
+	.loc 1 566 5 is_stmt 1 view .LVU442
+	.loc 1 569 5 view .LVU443
+	.loc 1 569 5 is_stmt 0 view .LVU444
+.LBE240:
+.LBE239:
+	.loc 1 628 5 is_stmt 1 view .LVU445
+	.loc 1 628 8 is_stmt 0 view .LVU446
+	testq	%rax, %rax
+	je	.L80
+	.loc 1 632 5 is_stmt 1 view .LVU447
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	%rax, %rdi
+	call	memcpy@PLT
+.LVL130:
+	.loc 1 633 5 view .LVU448
+.LBB241:
+.LBI241:
+	.loc 1 577 6 view .LVU449
+.LBB242:
+	.loc 1 579 5 view .LVU450
+	.loc 1 587 5 view .LVU451
+	movq	%rbx, %rdi
+	call	_heap_free
+.LVL131:
+	.loc 1 587 5 is_stmt 0 view .LVU452
+.LBE242:
+.LBE241:
+	.loc 1 635 5 is_stmt 1 view .LVU453
+	.loc 1 636 1 is_stmt 0 view .LVU454
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	movq	%r13, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL132:
+	.loc 1 636 1 view .LVU455
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL133:
+	.loc 1 636 1 view .LVU456
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+.LVL134:
+	.loc 1 636 1 view .LVU457
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+.LVL135:
+	.loc 1 636 1 view .LVU458
+	ret
+.LVL136:
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.cfi_restore_state
+	.loc 1 604 9 is_stmt 1 view .LVU459
+.LBB243:
+.LBI243:
+	.loc 1 577 6 view .LVU460
+.LBB244:
+	.loc 1 579 5 view .LVU461
+	.loc 1 587 5 view .LVU462
+	call	_heap_free
+.LVL137:
+	.loc 1 587 5 is_stmt 0 view .LVU463
+.LBE244:
+.LBE243:
+	.loc 1 605 9 is_stmt 1 view .LVU464
+.L80:
+	.loc 1 605 15 is_stmt 0 view .LVU465
+	xorl	%r13d, %r13d
+	jmp	.L77
+.LVL138:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.loc 1 600 9 is_stmt 1 view .LVU466
+.LBB245:
+.LBI245:
+	.loc 1 559 21 view .LVU467
+.LBB246:
+	.loc 1 561 5 view .LVU468
+.LBE246:
+.LBE245:
+	.loc 1 636 1 is_stmt 0 view .LVU469
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LBB249:
+.LBB247:
+	.loc 1 561 17 view .LVU470
+	movq	%rsi, %rdi
+.LVL139:
+	.loc 1 561 17 view .LVU471
+.LBE247:
+.LBE249:
+	.loc 1 636 1 view .LVU472
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+.LBB250:
+.LBB248:
+	.loc 1 561 17 view .LVU473
+	jmp	_heap_malloc
+.LVL140:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.cfi_restore_state
+	.loc 1 561 17 view .LVU474
+.LBE248:
+.LBE250:
+	.loc 1 611 9 is_stmt 1 view .LVU475
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+.LVL141:
+	.loc 1 611 9 is_stmt 0 view .LVU476
+	call	kprintf@PLT
+.LVL142:
+	.loc 1 612 9 is_stmt 1 view .LVU477
+	.loc 1 612 15 is_stmt 0 view .LVU478
+	jmp	.L80
+	.cfi_endproc
+.LFE47:
+	.size	realloc, .-realloc
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"calloc of %lu x %lu bytes overflows.\n"
+	.text
+	.p2align 4
+	.globl	calloc
+	.type	calloc, @function
+calloc:
+.LVL143:
+.LFB48:
+	.loc 1 642 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 643 5 view .LVU480
+	.loc 1 645 5 view .LVU481
+	.loc 1 642 1 is_stmt 0 view .LVU482
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 645 9 view .LVU483
+	movq	%rdi, %rax
+	.loc 1 642 1 view .LVU484
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 645 9 view .LVU485
+	mulq	%rsi
+	jo	.L94
+	movq	%rax, %rbp
+	.loc 1 650 5 is_stmt 1 view .LVU486
+.LVL144:
+.LBB253:
+.LBI253:
+	.loc 1 298 14 view .LVU487
+.LBB254:
+	.loc 1 300 5 view .LVU488
+	.loc 1 300 8 is_stmt 0 view .LVU489
+	cmpq	$2048, %rax
+	ja	.L104
+	.loc 1 304 5 is_stmt 1 view .LVU490
+	.loc 1 304 17 is_stmt 0 view .LVU491
+	movq	%rax, %rdi
+.LVL145:
+	.loc 1 304 17 view .LVU492
+	call	_heap_malloc
+.LVL146:
+	.loc 1 304 17 view .LVU493
+	movq	%rax, %rbx
+.LVL147:
+	.loc 1 305 5 is_stmt 1 view .LVU494
+	.loc 1 305 8 is_stmt 0 view .LVU495
+	testq	%rax, %rax
+	je	.L98
+	.loc 1 306 9 is_stmt 1 view .LVU496
+	movq	%rbp, %rdx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	memset@PLT
+.LVL148:
+	.loc 1 306 9 is_stmt 0 view .LVU497
+.LBE254:
+.LBE253:
+	.loc 1 657 1 view .LVU498
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+.LVL149:
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.cfi_restore_state
+.LBB258:
+.LBB255:
+	.loc 1 301 9 is_stmt 1 view .LVU499
+.LBE255:
+.LBE258:
+	.loc 1 657 1 is_stmt 0 view .LVU500
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LBB259:
+.LBB256:
+	.loc 1 301 16 view .LVU501
+	movl	$2, %esi
+.LVL150:
+	.loc 1 301 16 view .LVU502
+	movq	%rax, %rdi
+.LVL151:
+	.loc 1 301 16 view .LVU503
+.LBE256:
+.LBE259:
+	.loc 1 657 1 view .LVU504
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LBB260:
+.LBB257:
+	.loc 1 301 16 view .LVU505
+	jmp	kalloc_zone@PLT
+.LVL152:
+.L94:
+	.cfi_restore_state
+	.loc 1 301 16 view .LVU506
+.LBE257:
+.LBE260:
+	.loc 1 646 9 is_stmt 1 view .LVU507
+	movq	%rsi, %rdx
+	xorl	%eax, %eax
+	movq	%rdi, %rsi
+.LVL153:
+	.loc 1 646 9 is_stmt 0 view .LVU508
+	leaq	.LC3(%rip), %rdi
+.LVL154:
+	.loc 1 646 9 view .LVU509
+	call	kprintf@PLT
+.LVL155:
+	.loc 1 647 9 is_stmt 1 view .LVU510
+.L98:
+	.loc 1 647 15 is_stmt 0 view .LVU511
+	xorl	%ebx, %ebx
+	.loc 1 657 1 view .LVU512
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE48:
+	.size	calloc, .-calloc
+	.section	.rodata.str1.8
+	.align 8
+.LC4:
+	.string	"Alignment of %lu isn't a power of two.\n"
+	.text
+	.p2align 4
+	.globl	aligned_alloc
+	.type	aligned_alloc, @function
+aligned_alloc:
+.LVL156:
+.LFB49:
+	.loc 1 664 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 665 5 view .LVU514
+	.loc 1 664 1 is_stmt 0 view .LVU515
+	movq	%rdi, %rax
+	.loc 1 665 8 view .LVU516
+	testq	%rdi, %rdi
+	je	.L106
+	.loc 1 665 51 discriminator 1 view .LVU517
+	leaq	-1(%rdi), %rdx
+	.loc 1 665 24 discriminator 1 view .LVU518
+	testq	%rdi, %rdx
+	jne	.L106
+	movq	%rsi, %rdi
+.LVL157:
+	.loc 1 670 5 is_stmt 1 view .LVU519
+.LBB263:
+.LBI263:
+	.loc 1 316 14 view .LVU520
+.LBB264:
+	.loc 1 318 5 view .LVU521
+	.loc 1 318 8 is_stmt 0 view .LVU522
+	cmpq	$16, %rax
+	jbe	.L118
+	.loc 1 322 5 is_stmt 1 view .LVU523
+	.loc 1 322 85 is_stmt 0 view .LVU524
+	cmpq	%rsi, %rax
+	movq	%rsi, %rdx
+	cmovnb	%rax, %rdx
+	.loc 1 322 39 view .LVU525
+	subq	$1, %rdx
+	.loc 1 322 37 view .LVU526
+	bsrq	%rdx, %rdx
+	leal	1(%rdx), %ecx
+	.loc 1 322 12 view .LVU527
+	movl	$1, %edx
+	salq	%cl, %rdx
+.LVL158:
+	.loc 1 324 5 is_stmt 1 view .LVU528
+	.loc 1 324 8 is_stmt 0 view .LVU529
+	cmpq	$2048, %rdx
+	jbe	.L119
+	.loc 1 328 5 is_stmt 1 view .LVU530
+	.loc 1 328 8 is_stmt 0 view .LVU531
+	cmpq	$4096, %rax
+	jbe	.L120
+	.loc 1 332 5 is_stmt 1 view .LVU532
+	.loc 1 332 30 is_stmt 0 view .LVU533
+	shrq	$12, %rax
+.LVL159:
+	.loc 1 332 30 view .LVU534
+	xorl	%esi, %esi
+.LVL160:
+	.loc 1 332 30 view .LVU535
+	rep bsfq	%rax, %rsi
+	.loc 1 332 12 view .LVU536
+	jmp	kalloc_huge@PLT
+.LVL161:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	.loc 1 332 12 view .LVU537
+.LBE264:
+.LBE263:
+	.loc 1 666 9 is_stmt 1 view .LVU538
+	.loc 1 664 1 is_stmt 0 view .LVU539
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 666 9 view .LVU540
+	movq	%rax, %rsi
+.LVL162:
+	.loc 1 666 9 view .LVU541
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+.LVL163:
+	.loc 1 666 9 view .LVU542
+	call	kprintf@PLT
+.LVL164:
+	.loc 1 667 9 is_stmt 1 view .LVU543
+	.loc 1 677 1 is_stmt 0 view .LVU544
+	xorl	%eax, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL165:
+	.p2align 4,,10
+	.p2align 3
+.L119:
+.LBB266:
+.LBB265:
+	.loc 1 325 9 is_stmt 1 view .LVU545
+	.loc 1 325 16 is_stmt 0 view .LVU546
+	movq	%rdx, %rdi
+.LVL166:
+.L118:
+	.loc 1 325 16 view .LVU547
+	jmp	_heap_malloc
+.LVL167:
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	.loc 1 329 9 is_stmt 1 view .LVU548
+	.loc 1 329 16 is_stmt 0 view .LVU549
+	jmp	kalloc@PLT
+.LVL168:
+	.loc 1 329 16 view .LVU550
+.LBE265:
+.LBE266:
+	.cfi_endproc
+.LFE49:
+	.size	aligned_alloc, .-aligned_alloc
+	.local	remote_inbox
+	.comm	remote_inbox,7168,32
+	.local	cpu_caches
+	.comm	cpu_caches,253952,64
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 5 "src/include/mem.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "src/include/slab.h"
+	.file 8 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x13fe
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x30
+	.long	.LASF79
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x1d
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x7
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x1d
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x17
+	.long	0x77
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF10
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x1d
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x91
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF13
+	.uleb128 0x32
+	.byte	0x8
+	.uleb128 0x25
+	.long	0x98
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x33
+	.long	0x9f
+	.uleb128 0x13
+	.long	0xa6
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF15
+	.uleb128 0x34
+	.long	.LASF80
+	.value	0x108
+	.byte	0x1
+	.byte	0x81
+	.byte	0x8
+	.long	0xde
+	.uleb128 0x1e
+	.long	.LASF16
+	.byte	0x82
+	.byte	0xe
+	.long	0x85
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF17
+	.byte	0x83
+	.byte	0xb
+	.long	0xde
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1f
+	.long	0x98
+	.long	0xee
+	.uleb128 0x17
+	.long	0x41
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF81
+	.value	0xf80
+	.byte	0x40
+	.byte	0x1
+	.byte	0x86
+	.byte	0x8
+	.long	0x124
+	.uleb128 0x1e
+	.long	.LASF18
+	.byte	0x87
+	.byte	0x1a
+	.long	0x124
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF19
+	.byte	0x88
+	.byte	0xe
+	.long	0x85
+	.value	0xe70
+	.uleb128 0x26
+	.long	.LASF20
+	.byte	0x89
+	.byte	0xb
+	.long	0xde
+	.value	0xe78
+	.byte	0
+	.uleb128 0x1f
+	.long	0xb7
+	.long	0x134
+	.uleb128 0x17
+	.long	0x41
+	.byte	0xd
+	.byte	0
+	.uleb128 0x36
+	.long	0xee
+	.byte	0x40
+	.long	0x145
+	.uleb128 0x17
+	.long	0x41
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF21
+	.byte	0x8c
+	.byte	0x18
+	.long	0x134
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cpu_caches
+	.uleb128 0x1f
+	.long	0x98
+	.long	0x170
+	.uleb128 0x17
+	.long	0x41
+	.byte	0x3f
+	.uleb128 0x17
+	.long	0x41
+	.byte	0xd
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF22
+	.byte	0x8f
+	.byte	0xe
+	.long	0x15a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	remote_inbox
+	.uleb128 0x8
+	.long	.LASF23
+	.byte	0x5
+	.byte	0xc0
+	.byte	0x7
+	.long	0x98
+	.long	0x1a0
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x6b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF24
+	.byte	0x5
+	.byte	0xbc
+	.byte	0x7
+	.long	0x98
+	.long	0x1b6
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x98
+	.long	0x1d6
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0x48
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF26
+	.byte	0x5
+	.byte	0xc1
+	.byte	0x7
+	.long	0x98
+	.long	0x1f1
+	.uleb128 0x2
+	.long	0x35
+	.uleb128 0x2
+	.long	0x85
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x30
+	.byte	0x8
+	.long	0x35
+	.long	0x207
+	.uleb128 0x2
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.long	0x98
+	.long	0x227
+	.uleb128 0x2
+	.long	0x9a
+	.uleb128 0x2
+	.long	0x22c
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x13
+	.long	0x231
+	.uleb128 0x25
+	.long	0x227
+	.uleb128 0x37
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x7
+	.byte	0x33
+	.byte	0xa
+	.long	0x85
+	.long	0x257
+	.uleb128 0x2
+	.long	0x48
+	.uleb128 0x2
+	.long	0x257
+	.uleb128 0x2
+	.long	0x85
+	.uleb128 0x2
+	.long	0x85
+	.byte	0
+	.uleb128 0x13
+	.long	0x98
+	.uleb128 0x8
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x2e
+	.byte	0x7
+	.long	0x98
+	.long	0x272
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x31
+	.byte	0x5
+	.long	0x48
+	.long	0x288
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x30
+	.long	0x29a
+	.uleb128 0x2
+	.long	0xab
+	.uleb128 0x38
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x98
+	.long	0x2ba
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0x227
+	.uleb128 0x2
+	.long	0x35
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x34
+	.long	0x2d0
+	.uleb128 0x2
+	.long	0x257
+	.uleb128 0x2
+	.long	0x85
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x32
+	.byte	0x5
+	.long	0x48
+	.long	0x2eb
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0x2eb
+	.byte	0
+	.uleb128 0x13
+	.long	0x85
+	.uleb128 0x20
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x2f
+	.long	0x301
+	.uleb128 0x2
+	.long	0x98
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF39
+	.value	0x297
+	.long	0x98
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x41a
+	.uleb128 0x14
+	.long	.LASF37
+	.value	0x297
+	.byte	0x1c
+	.long	0x35
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x14
+	.long	.LASF38
+	.value	0x297
+	.byte	0x2e
+	.long	0x35
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x19
+	.string	"ptr"
+	.value	0x29e
+	.byte	0xb
+	.long	0x98
+	.uleb128 0xd
+	.long	0xafc
+	.quad	.LBI263
+	.byte	.LVU520
+	.long	.LLRL85
+	.byte	0x1
+	.value	0x29e
+	.byte	0x11
+	.long	0x3f7
+	.uleb128 0x3
+	.long	0xb1b
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x3
+	.long	0xb0e
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x4
+	.long	.LLRL85
+	.uleb128 0x6
+	.long	0xb28
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x39
+	.quad	.LVL161
+	.long	0x185
+	.long	0x3db
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x22
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x12
+	.byte	0x28
+	.value	0x6
+	.byte	0x13
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2f
+	.value	0x12
+	.byte	0x30
+	.byte	0x16
+	.byte	0x12
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x28
+	.value	0x9
+	.byte	0x31
+	.byte	0x25
+	.byte	0x16
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x16
+	.byte	0x2f
+	.value	0xfff1
+	.byte	0x13
+	.byte	0x96
+	.byte	0
+	.uleb128 0x27
+	.quad	.LVL167
+	.long	0xe4c
+	.uleb128 0x27
+	.quad	.LVL168
+	.long	0x1a0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL164
+	.long	0x288
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF40
+	.value	0x281
+	.long	0x98
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53a
+	.uleb128 0x14
+	.long	.LASF16
+	.value	0x281
+	.byte	0x15
+	.long	0x35
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x14
+	.long	.LASF38
+	.value	0x281
+	.byte	0x23
+	.long	0x35
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x10
+	.long	.LASF41
+	.byte	0x1
+	.value	0x283
+	.byte	0xc
+	.long	0x35
+	.uleb128 0x19
+	.string	"ptr"
+	.value	0x28a
+	.byte	0xb
+	.long	0x98
+	.uleb128 0xd
+	.long	0xb36
+	.quad	.LBI253
+	.byte	.LVU487
+	.long	.LLRL80
+	.byte	0x1
+	.value	0x28a
+	.byte	0x11
+	.long	0x510
+	.uleb128 0x3
+	.long	0xb48
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x4
+	.long	.LLRL80
+	.uleb128 0x6
+	.long	0xb55
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0xa
+	.quad	.LVL146
+	.long	0xe4c
+	.long	0x4cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL148
+	.long	0x1b6
+	.long	0x4f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL152
+	.long	0x1d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL155
+	.long	0x288
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF42
+	.value	0x253
+	.long	0x98
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x76b
+	.uleb128 0x3a
+	.string	"ptr"
+	.byte	0x1
+	.value	0x253
+	.byte	0x15
+	.long	0x98
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x14
+	.long	.LASF38
+	.value	0x253
+	.byte	0x21
+	.long	0x35
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x10
+	.long	.LASF43
+	.byte	0x1
+	.value	0x255
+	.byte	0xb
+	.long	0x98
+	.uleb128 0xb
+	.long	.LASF44
+	.value	0x260
+	.byte	0xc
+	.long	0x35
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0xb
+	.long	.LASF45
+	.value	0x273
+	.byte	0xb
+	.long	0x98
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x9
+	.long	0xb8e
+	.quad	.LBI237
+	.byte	.LVU424
+	.quad	.LBB237
+	.quad	.LBE237-.LBB237
+	.byte	0x1
+	.value	0x260
+	.byte	0x15
+	.long	0x601
+	.uleb128 0x3
+	.long	0xba0
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x5
+	.quad	.LVL122
+	.long	0x1f1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x80b
+	.quad	.LBI239
+	.byte	.LVU438
+	.quad	.LBB239
+	.quad	.LBE239-.LBB239
+	.byte	0x1
+	.value	0x273
+	.byte	0x12
+	.long	0x65b
+	.uleb128 0xe
+	.long	0x82a
+	.uleb128 0x3
+	.long	0x81d
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x6
+	.long	0x837
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x5
+	.quad	.LVL128
+	.long	0xe4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x76b
+	.quad	.LBI241
+	.byte	.LVU449
+	.quad	.LBB241
+	.quad	.LBE241-.LBB241
+	.byte	0x1
+	.value	0x279
+	.byte	0x5
+	.long	0x6a3
+	.uleb128 0x3
+	.long	0x779
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x5
+	.quad	.LVL131
+	.long	0xbad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x76b
+	.quad	.LBI243
+	.byte	.LVU460
+	.quad	.LBB243
+	.quad	.LBE243-.LBB243
+	.byte	0x1
+	.value	0x25c
+	.byte	0x9
+	.long	0x6dc
+	.uleb128 0xe
+	.long	0x779
+	.uleb128 0x21
+	.quad	.LVL137
+	.long	0xbad
+	.byte	0
+	.uleb128 0xd
+	.long	0x80b
+	.quad	.LBI245
+	.byte	.LVU467
+	.long	.LLRL76
+	.byte	0x1
+	.value	0x258
+	.byte	0x10
+	.long	0x72b
+	.uleb128 0xe
+	.long	0x82a
+	.uleb128 0x3
+	.long	0x81d
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x4
+	.long	.LLRL76
+	.uleb128 0x3b
+	.long	0x837
+	.uleb128 0x1
+	.byte	0x5d
+	.uleb128 0x15
+	.quad	.LVL140
+	.long	0xe4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL130
+	.long	0x207
+	.long	0x74f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL142
+	.long	0x288
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF46
+	.byte	0x1
+	.value	0x241
+	.byte	0x6
+	.byte	0x1
+	.long	0x786
+	.uleb128 0x22
+	.string	"ptr"
+	.value	0x241
+	.byte	0x11
+	.long	0x98
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF47
+	.value	0x23c
+	.long	0x98
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x80b
+	.uleb128 0x14
+	.long	.LASF38
+	.value	0x23c
+	.byte	0x15
+	.long	0x35
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x3d
+	.long	0x80b
+	.quad	.LBI235
+	.byte	.LVU407
+	.quad	.LBB235
+	.quad	.LBE235-.LBB235
+	.byte	0x1
+	.value	0x23e
+	.byte	0xc
+	.uleb128 0xe
+	.long	0x82a
+	.uleb128 0x3
+	.long	0x81d
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xf
+	.long	0x837
+	.uleb128 0x15
+	.quad	.LVL117
+	.long	0xe4c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF54
+	.byte	0x1
+	.value	0x22f
+	.byte	0x15
+	.long	0x98
+	.byte	0x3
+	.long	0x844
+	.uleb128 0x11
+	.long	.LASF38
+	.byte	0x1
+	.value	0x22f
+	.byte	0x29
+	.long	0x35
+	.uleb128 0x11
+	.long	.LASF43
+	.byte	0x1
+	.value	0x22f
+	.byte	0x35
+	.long	0x98
+	.uleb128 0x19
+	.string	"ptr"
+	.value	0x231
+	.byte	0xb
+	.long	0x98
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF82
+	.byte	0x1
+	.value	0x226
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF83
+	.byte	0x1
+	.value	0x221
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x40
+	.long	.LASF84
+	.byte	0x1
+	.value	0x153
+	.byte	0x6
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaf2
+	.uleb128 0xb
+	.long	.LASF48
+	.value	0x155
+	.byte	0x9
+	.long	0xb0
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x41
+	.string	"cpu"
+	.byte	0x1
+	.value	0x157
+	.byte	0xe
+	.long	0x85
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xb
+	.long	.LASF49
+	.value	0x158
+	.byte	0x16
+	.long	0xaf2
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x23
+	.long	.LLRL57
+	.long	0x989
+	.uleb128 0xb
+	.long	.LASF50
+	.value	0x15c
+	.byte	0xe
+	.long	0x48
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x4
+	.long	.LLRL59
+	.uleb128 0x10
+	.long	.LASF51
+	.byte	0x1
+	.value	0x15d
+	.byte	0x1f
+	.long	0xaf7
+	.uleb128 0xb
+	.long	.LASF52
+	.value	0x161
+	.byte	0xf
+	.long	0x98
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x42
+	.quad	.LBB222
+	.quad	.LBE222-.LBB222
+	.long	0x92d
+	.uleb128 0xb
+	.long	.LASF53
+	.value	0x163
+	.byte	0x13
+	.long	0x98
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x21
+	.quad	.LVL107
+	.long	0x2f0
+	.byte	0
+	.uleb128 0x28
+	.long	0x12f6
+	.quad	.LBI218
+	.byte	.LVU352
+	.long	.LLRL61
+	.value	0x15f
+	.byte	0x9
+	.uleb128 0x3
+	.long	0x130b
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xe
+	.long	0x1300
+	.uleb128 0xa
+	.quad	.LVL102
+	.long	0x2ba
+	.long	0x972
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL104
+	.long	0x29a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x1317
+	.quad	.LBI204
+	.byte	.LVU318
+	.long	.LLRL51
+	.byte	0x1
+	.value	0x155
+	.byte	0x12
+	.long	0xa12
+	.uleb128 0x3
+	.long	0x1329
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x4
+	.long	.LLRL51
+	.uleb128 0x6
+	.long	0x1336
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0xd
+	.long	0x1344
+	.quad	.LBI206
+	.byte	.LVU320
+	.long	.LLRL54
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0x9f0
+	.uleb128 0x4
+	.long	.LLRL54
+	.uleb128 0x6
+	.long	0x1356
+	.long	.LLST55
+	.long	.LVUS55
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x136b
+	.quad	.LBI210
+	.byte	.LVU331
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.value	0x13d
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x1372
+	.quad	.LBI214
+	.byte	.LVU336
+	.quad	.LBB214
+	.quad	.LBE214-.LBB214
+	.byte	0x1
+	.value	0x157
+	.byte	0x14
+	.long	0xa46
+	.uleb128 0x6
+	.long	0x1383
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0xd
+	.long	0x1317
+	.quad	.LBI225
+	.byte	.LVU379
+	.long	.LLRL64
+	.byte	0x1
+	.value	0x169
+	.byte	0x5
+	.long	0xadd
+	.uleb128 0xe
+	.long	0x1329
+	.uleb128 0x4
+	.long	.LLRL64
+	.uleb128 0xf
+	.long	0x1336
+	.uleb128 0x9
+	.long	0x1344
+	.quad	.LBI227
+	.byte	.LVU381
+	.quad	.LBB227
+	.quad	.LBE227-.LBB227
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0xa9b
+	.uleb128 0xf
+	.long	0x1356
+	.byte	0
+	.uleb128 0x12
+	.long	0x1364
+	.quad	.LBI229
+	.byte	.LVU389
+	.quad	.LBB229
+	.quad	.LBE229-.LBB229
+	.value	0x13b
+	.uleb128 0x12
+	.long	0x136b
+	.quad	.LBI231
+	.byte	.LVU395
+	.quad	.LBB231
+	.quad	.LBE231-.LBB231
+	.value	0x13d
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL99
+	.long	0x1179
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xee
+	.uleb128 0x13
+	.long	0xb7
+	.uleb128 0x16
+	.long	.LASF55
+	.byte	0x1
+	.value	0x13c
+	.byte	0xe
+	.long	0x98
+	.byte	0x1
+	.long	0xb36
+	.uleb128 0x11
+	.long	.LASF37
+	.byte	0x1
+	.value	0x13c
+	.byte	0x29
+	.long	0x35
+	.uleb128 0x11
+	.long	.LASF38
+	.byte	0x1
+	.value	0x13c
+	.byte	0x3b
+	.long	0x35
+	.uleb128 0x10
+	.long	.LASF56
+	.byte	0x1
+	.value	0x142
+	.byte	0xc
+	.long	0x35
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF57
+	.byte	0x1
+	.value	0x12a
+	.byte	0xe
+	.long	0x98
+	.byte	0x1
+	.long	0xb62
+	.uleb128 0x11
+	.long	.LASF38
+	.byte	0x1
+	.value	0x12a
+	.byte	0x22
+	.long	0x35
+	.uleb128 0x19
+	.string	"ptr"
+	.value	0x130
+	.byte	0xb
+	.long	0x98
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF58
+	.byte	0x1
+	.value	0x11e
+	.byte	0x13
+	.long	0xb0
+	.byte	0x3
+	.long	0xb8e
+	.uleb128 0x22
+	.string	"ptr"
+	.value	0x11e
+	.byte	0x2d
+	.long	0x98
+	.uleb128 0x11
+	.long	.LASF38
+	.byte	0x1
+	.value	0x11e
+	.byte	0x39
+	.long	0x35
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF59
+	.byte	0x1
+	.value	0x119
+	.byte	0x16
+	.long	0x35
+	.byte	0x3
+	.long	0xbad
+	.uleb128 0x22
+	.string	"ptr"
+	.value	0x119
+	.byte	0x2e
+	.long	0x98
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF61
+	.byte	0xf8
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe4c
+	.uleb128 0x43
+	.string	"ptr"
+	.byte	0x1
+	.byte	0xf8
+	.byte	0x1e
+	.long	0x98
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x18
+	.long	.LASF60
+	.byte	0xfa
+	.byte	0xe
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xc
+	.long	.LASF50
+	.byte	0xfb
+	.byte	0x9
+	.long	0x48
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.long	.LASF48
+	.value	0x101
+	.byte	0x9
+	.long	0xb0
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x19
+	.string	"cpu"
+	.value	0x103
+	.byte	0xe
+	.long	0x85
+	.uleb128 0xb
+	.long	.LASF49
+	.value	0x104
+	.byte	0x16
+	.long	0xaf2
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x23
+	.long	.LLRL22
+	.long	0xcab
+	.uleb128 0x10
+	.long	.LASF51
+	.byte	0x1
+	.value	0x107
+	.byte	0x1f
+	.long	0xaf7
+	.uleb128 0x28
+	.long	0x12f6
+	.quad	.LBI117
+	.byte	.LVU159
+	.long	.LLRL23
+	.value	0x10a
+	.byte	0xd
+	.uleb128 0x44
+	.long	0x130b
+	.byte	0x10
+	.uleb128 0xe
+	.long	0x1300
+	.uleb128 0xa
+	.quad	.LVL53
+	.long	0x2ba
+	.long	0xc88
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL54
+	.long	0x29a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x80
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x1317
+	.quad	.LBI98
+	.byte	.LVU77
+	.quad	.LBB98
+	.quad	.LBE98-.LBB98
+	.byte	0x1
+	.value	0x101
+	.byte	0x12
+	.long	0xd40
+	.uleb128 0x3
+	.long	0x1329
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x6
+	.long	0x1336
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x9
+	.long	0x1344
+	.quad	.LBI100
+	.byte	.LVU79
+	.quad	.LBB100
+	.quad	.LBE100-.LBB100
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0xd1f
+	.uleb128 0x6
+	.long	0x1356
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x12
+	.long	0x136b
+	.quad	.LBI102
+	.byte	.LVU87
+	.quad	.LBB102
+	.quad	.LBE102-.LBB102
+	.value	0x13d
+	.byte	0
+	.uleb128 0x9
+	.long	0x1372
+	.quad	.LBI104
+	.byte	.LVU92
+	.quad	.LBB104
+	.quad	.LBE104-.LBB104
+	.byte	0x1
+	.value	0x103
+	.byte	0x14
+	.long	0xd6c
+	.uleb128 0xf
+	.long	0x1383
+	.byte	0
+	.uleb128 0xd
+	.long	0x1317
+	.quad	.LBI106
+	.byte	.LVU112
+	.long	.LLRL20
+	.byte	0x1
+	.value	0x116
+	.byte	0x5
+	.long	0xe0b
+	.uleb128 0x3
+	.long	0x1329
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x4
+	.long	.LLRL20
+	.uleb128 0xf
+	.long	0x1336
+	.uleb128 0x9
+	.long	0x1344
+	.quad	.LBI108
+	.byte	.LVU114
+	.quad	.LBB108
+	.quad	.LBE108-.LBB108
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0xdc9
+	.uleb128 0xf
+	.long	0x1356
+	.byte	0
+	.uleb128 0x12
+	.long	0x136b
+	.quad	.LBI110
+	.byte	.LVU122
+	.quad	.LBB110
+	.quad	.LBE110-.LBB110
+	.value	0x13d
+	.uleb128 0x12
+	.long	0x1364
+	.quad	.LBI112
+	.byte	.LVU131
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.value	0x13b
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL24
+	.long	0x2d0
+	.long	0xe2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL47
+	.long	0x1179
+	.uleb128 0x5
+	.quad	.LVL49
+	.long	0x2f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF85
+	.byte	0x1
+	.byte	0xda
+	.byte	0xe
+	.long	0x98
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1179
+	.uleb128 0x2a
+	.long	.LASF38
+	.byte	0xda
+	.byte	0x22
+	.long	0x35
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xc
+	.long	.LASF50
+	.byte	0xdc
+	.byte	0x9
+	.long	0x48
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xc
+	.long	.LASF48
+	.byte	0xe1
+	.byte	0x9
+	.long	0xb0
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1a
+	.string	"cpu"
+	.byte	0xe3
+	.byte	0xe
+	.long	0x85
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xc
+	.long	.LASF51
+	.byte	0xe4
+	.byte	0x1b
+	.long	0xaf7
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0xea
+	.byte	0xb
+	.long	0x98
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x2b
+	.long	0x1317
+	.quad	.LBI143
+	.byte	.LVU181
+	.quad	.LBB143
+	.quad	.LBE143-.LBB143
+	.byte	0xe1
+	.byte	0x12
+	.long	0xf73
+	.uleb128 0x3
+	.long	0x1329
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.long	0x1336
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x9
+	.long	0x1344
+	.quad	.LBI145
+	.byte	.LVU183
+	.quad	.LBB145
+	.quad	.LBE145-.LBB145
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0xf52
+	.uleb128 0x6
+	.long	0x1356
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x12
+	.long	0x136b
+	.quad	.LBI147
+	.byte	.LVU191
+	.quad	.LBB147
+	.quad	.LBE147-.LBB147
+	.value	0x13d
+	.byte	0
+	.uleb128 0x2b
+	.long	0x1372
+	.quad	.LBI149
+	.byte	.LVU196
+	.quad	.LBB149
+	.quad	.LBE149-.LBB149
+	.byte	0xe3
+	.byte	0x14
+	.long	0xfa5
+	.uleb128 0x6
+	.long	0x1383
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x2c
+	.long	0x1317
+	.quad	.LBI151
+	.byte	.LVU210
+	.long	.LLRL34
+	.byte	0xef
+	.byte	0x5
+	.long	0x101c
+	.uleb128 0xe
+	.long	0x1329
+	.uleb128 0x4
+	.long	.LLRL34
+	.uleb128 0xf
+	.long	0x1336
+	.uleb128 0xd
+	.long	0x1344
+	.quad	.LBI153
+	.byte	.LVU212
+	.long	.LLRL35
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0xff2
+	.uleb128 0x4
+	.long	.LLRL35
+	.uleb128 0xf
+	.long	0x1356
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x136b
+	.quad	.LBI156
+	.byte	.LVU220
+	.long	.LLRL36
+	.value	0x13d
+	.uleb128 0x2d
+	.long	0x1364
+	.quad	.LBI159
+	.byte	.LVU228
+	.long	.LLRL37
+	.value	0x13b
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x12af
+	.quad	.LBI169
+	.byte	.LVU233
+	.long	.LLRL38
+	.byte	0xe7
+	.byte	0x9
+	.long	0x1126
+	.uleb128 0x3
+	.long	0x12d0
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x3
+	.long	0x12c5
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x3
+	.long	0x12b9
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x4
+	.long	.LLRL38
+	.uleb128 0x6
+	.long	0x12db
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x46
+	.long	0x12e7
+	.long	.LLRL43
+	.long	0x10f5
+	.uleb128 0x6
+	.long	0x12e8
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x47
+	.long	0x12f6
+	.quad	.LBI172
+	.byte	.LVU259
+	.long	.LLRL45
+	.byte	0x1
+	.byte	0xa8
+	.byte	0xd
+	.uleb128 0x3
+	.long	0x130b
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x3
+	.long	0x1300
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0xa
+	.quad	.LVL76
+	.long	0x2ba
+	.long	0x10d5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL77
+	.long	0x29a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL80
+	.long	0x232
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x18
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.byte	0x8
+	.byte	0x21
+	.byte	0x1e
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x24
+	.byte	0x22
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL56
+	.long	0x272
+	.long	0x113e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL85
+	.long	0x288
+	.long	0x1163
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL90
+	.long	0x25c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF62
+	.byte	0xb8
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12af
+	.uleb128 0x2a
+	.long	.LASF49
+	.byte	0xb8
+	.byte	0x36
+	.long	0xaf2
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	.LLRL1
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0xba
+	.byte	0x13
+	.long	0x85
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x4
+	.long	.LLRL3
+	.uleb128 0xc
+	.long	.LASF63
+	.byte	0xbb
+	.byte	0xf
+	.long	0x98
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x18
+	.long	.LASF60
+	.byte	0xc0
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xc
+	.long	.LASF50
+	.byte	0xc1
+	.byte	0xd
+	.long	0x48
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xc
+	.long	.LASF64
+	.byte	0xc2
+	.byte	0xf
+	.long	0x98
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xc
+	.long	.LASF65
+	.byte	0xcf
+	.byte	0x10
+	.long	0x257
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xc
+	.long	.LASF66
+	.byte	0xd0
+	.byte	0xf
+	.long	0x98
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x23
+	.long	.LLRL9
+	.long	0x1290
+	.uleb128 0x1a
+	.string	"j"
+	.byte	0xc4
+	.byte	0x17
+	.long	0x85
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4
+	.long	.LLRL11
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0xc5
+	.byte	0x13
+	.long	0x98
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x18
+	.long	.LASF67
+	.byte	0xc6
+	.byte	0x16
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x5
+	.quad	.LVL11
+	.long	0x2d0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL5
+	.long	0x2d0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF68
+	.byte	0xa0
+	.long	0x12f6
+	.uleb128 0x48
+	.string	"cpu"
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x28
+	.long	0x85
+	.uleb128 0x1c
+	.long	.LASF50
+	.byte	0xa0
+	.byte	0x31
+	.long	0x48
+	.uleb128 0x1c
+	.long	.LASF51
+	.byte	0xa0
+	.byte	0x4e
+	.long	0xaf7
+	.uleb128 0x24
+	.long	.LASF52
+	.byte	0x1
+	.byte	0xa2
+	.byte	0xb
+	.long	0x98
+	.uleb128 0x49
+	.uleb128 0x24
+	.long	.LASF53
+	.byte	0x1
+	.byte	0xa5
+	.byte	0xf
+	.long	0x98
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF69
+	.byte	0x94
+	.long	0x1317
+	.uleb128 0x1c
+	.long	.LASF51
+	.byte	0x94
+	.byte	0x34
+	.long	0xaf7
+	.uleb128 0x1c
+	.long	.LASF16
+	.byte	0x94
+	.byte	0x45
+	.long	0x85
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF70
+	.byte	0x2
+	.value	0x136
+	.byte	0x13
+	.long	0xb0
+	.byte	0x3
+	.long	0x1344
+	.uleb128 0x11
+	.long	.LASF71
+	.byte	0x2
+	.value	0x136
+	.byte	0x2c
+	.long	0xb0
+	.uleb128 0x10
+	.long	.LASF72
+	.byte	0x2
+	.value	0x138
+	.byte	0x9
+	.long	0xb0
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF73
+	.byte	0x2
+	.value	0x126
+	.byte	0x13
+	.long	0xb0
+	.byte	0x3
+	.long	0x1364
+	.uleb128 0x10
+	.long	.LASF74
+	.byte	0x2
+	.value	0x128
+	.byte	0x13
+	.long	0x41
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF75
+	.value	0x121
+	.uleb128 0x2f
+	.long	.LASF76
+	.value	0x11c
+	.uleb128 0x4b
+	.long	.LASF77
+	.byte	0x2
+	.byte	0x44
+	.byte	0x18
+	.long	0x85
+	.byte	0x3
+	.long	0x1390
+	.uleb128 0x24
+	.long	.LASF78
+	.byte	0x2
+	.byte	0x46
+	.byte	0xe
+	.long	0x85
+	.byte	0
+	.uleb128 0x4c
+	.long	0x84d
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13c7
+	.uleb128 0x15
+	.quad	.LVL115
+	.long	0x288
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.long	0x76b
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3
+	.long	0x779
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x15
+	.quad	.LVL119
+	.long	0xbad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS83:
+	.uleb128 0
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL164-1-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 0
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU520
+	.uleb128 .LVU535
+	.uleb128 .LVU535
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU545
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU520
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU537
+	.uleb128 .LVU545
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU528
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU545
+	.uleb128 .LVU547
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL161-1-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x57
+	.byte	0x31
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x12
+	.byte	0x28
+	.value	0x6
+	.byte	0x13
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2f
+	.value	0x1a
+	.byte	0x30
+	.byte	0x16
+	.byte	0x12
+	.byte	0xe
+	.quad	0x8000000000000000
+	.byte	0x1a
+	.byte	0x28
+	.value	0x9
+	.byte	0x31
+	.byte	0x24
+	.byte	0x16
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x16
+	.byte	0x2f
+	.value	0xffe9
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x57
+	.byte	0x31
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x12
+	.byte	0x28
+	.value	0x6
+	.byte	0x13
+	.byte	0x8
+	.byte	0x40
+	.byte	0x2f
+	.value	0x1a
+	.byte	0x30
+	.byte	0x16
+	.byte	0x12
+	.byte	0xe
+	.quad	0x8000000000000000
+	.byte	0x1a
+	.byte	0x28
+	.value	0x9
+	.byte	0x31
+	.byte	0x24
+	.byte	0x16
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x16
+	.byte	0x2f
+	.value	0xffe9
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL155-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL155-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL155-1-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU487
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU497
+	.uleb128 .LVU499
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL146-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU494
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU436
+	.uleb128 .LVU436
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU436
+	.uleb128 .LVU436
+	.uleb128 .LVU456
+	.uleb128 .LVU456
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU428
+	.uleb128 .LVU433
+	.uleb128 .LVU436
+	.uleb128 .LVU441
+	.uleb128 .LVU441
+	.uleb128 .LVU457
+	.uleb128 .LVU474
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU444
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU459
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL130-1-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU424
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU428
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU438
+	.uleb128 .LVU444
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU442
+	.uleb128 .LVU444
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU449
+	.uleb128 .LVU452
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU467
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU407
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU334
+	.uleb128 .LVU350
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU340
+	.uleb128 .LVU344
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU346
+	.uleb128 .LVU350
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU349
+	.uleb128 .LVU350
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU366
+	.uleb128 .LVU370
+	.uleb128 .LVU370
+	.uleb128 .LVU371
+	.uleb128 .LVU372
+	.uleb128 .LVU392
+	.uleb128 .LVU394
+	.uleb128 .LVU400
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU370
+	.uleb128 .LVU374
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU352
+	.uleb128 .LVU361
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU318
+	.uleb128 .LVU334
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU328
+	.uleb128 .LVU350
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU325
+	.uleb128 .LVU327
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU339
+	.uleb128 .LVU340
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-1-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU74
+	.uleb128 .LVU105
+	.uleb128 .LVU137
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU152
+	.uleb128 .LVU154
+	.uleb128 .LVU155
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU90
+	.uleb128 .LVU128
+	.uleb128 .LVU130
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU98
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU129
+	.uleb128 .LVU130
+	.uleb128 .LVU136
+	.uleb128 .LVU137
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x14
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x24
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x14
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x24
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x14
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x24
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x14
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x24
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x14
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x37
+	.byte	0x24
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU77
+	.uleb128 .LVU90
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU84
+	.uleb128 .LVU128
+	.uleb128 .LVU130
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU112
+	.uleb128 .LVU125
+	.uleb128 .LVU130
+	.uleb128 .LVU135
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU178
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU205
+	.uleb128 .LVU231
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+	.uleb128 .LVU309
+	.uleb128 .LVU315
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU194
+	.uleb128 .LVU205
+	.uleb128 .LVU231
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x5
+	.byte	0x79
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x5
+	.byte	0x79
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU200
+	.uleb128 .LVU205
+	.uleb128 .LVU231
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU202
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU205
+	.uleb128 .LVU231
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x24
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x24
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2a
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -84
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU205
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU231
+	.uleb128 .LVU281
+	.uleb128 .LVU299
+	.uleb128 .LVU303
+	.uleb128 .LVU309
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU181
+	.uleb128 .LVU194
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU188
+	.uleb128 .LVU205
+	.uleb128 .LVU231
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x5
+	.byte	0x79
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x5
+	.byte	0x79
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU233
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x24
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x2a
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -84
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU233
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU233
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU269
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU239
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU269
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU246
+	.uleb128 .LVU253
+	.uleb128 .LVU256
+	.uleb128 .LVU269
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU259
+	.uleb128 .LVU268
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU259
+	.uleb128 .LVU268
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2a
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x108
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -84
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0xa
+	.value	0xf80
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	cpu_caches
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU63
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU16
+	.uleb128 .LVU63
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU21
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU63
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU22
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU40
+	.uleb128 .LVU42
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU63
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU51
+	.uleb128 .LVU63
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU53
+	.uleb128 .LVU60
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU48
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU26
+	.uleb128 .LVU28
+	.uleb128 .LVU30
+	.uleb128 .LVU48
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL119-1-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB213-.Ltext0
+	.uleb128 .LBE213-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB224-.Ltext0
+	.uleb128 .LBE224-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB223-.Ltext0
+	.uleb128 .LBE223-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB218-.Ltext0
+	.uleb128 .LBE218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB245-.Ltext0
+	.uleb128 .LBE245-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB249-.Ltext0
+	.uleb128 .LBE249-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB250-.Ltext0
+	.uleb128 .LBE250-.Ltext0
+	.byte	0
+.LLRL80:
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB258-.Ltext0
+	.uleb128 .LBE258-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB259-.Ltext0
+	.uleb128 .LBE259-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB260-.Ltext0
+	.uleb128 .LBE260-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF16:
+	.string	"count"
+.LASF47:
+	.string	"malloc"
+.LASF53:
+	.string	"pNext"
+.LASF8:
+	.string	"size_t"
+.LASF18:
+	.string	"classes"
+.LASF23:
+	.string	"kalloc_huge"
+.LASF56:
+	.string	"class_size"
+.LASF27:
+	.string	"slab_usable_size"
+.LASF57:
+	.string	"_heap_zalloc"
+.LASF26:
+	.string	"kalloc_zone"
+.LASF46:
+	.string	"free"
+.LASF22:
+	.string	"remote_inbox"
+.LASF4:
+	.string	"long long int"
+.LASF6:
+	.string	"signed char"
+.LASF69:
+	.string	"_cpu_cache_flush"
+.LASF84:
+	.string	"alloc_cpu_cache_drain"
+.LASF43:
+	.string	"pCaller"
+.LASF30:
+	.string	"slab_malloc"
+.LASF72:
+	.string	"state"
+.LASF2:
+	.string	"long int"
+.LASF28:
+	.string	"memcpy"
+.LASF73:
+	.string	"interrupt_state"
+.LASF31:
+	.string	"slab_size_class"
+.LASF68:
+	.string	"_cpu_cache_refill"
+.LASF76:
+	.string	"disable_interrupts"
+.LASF64:
+	.string	"pLast"
+.LASF85:
+	.string	"_heap_malloc"
+.LASF48:
+	.string	"istate"
+.LASF34:
+	.string	"slab_free_batch"
+.LASF79:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"unsigned int"
+.LASF77:
+	.string	"cpu_index"
+.LASF3:
+	.string	"long unsigned int"
+.LASF61:
+	.string	"_heap_free"
+.LASF82:
+	.string	"alloc_profile_report_serial"
+.LASF38:
+	.string	"size"
+.LASF11:
+	.string	"short unsigned int"
+.LASF49:
+	.string	"pCpuCache"
+.LASF70:
+	.string	"set_interrupt_state"
+.LASF75:
+	.string	"enable_interrupts"
+.LASF54:
+	.string	"_malloc_from"
+.LASF35:
+	.string	"slab_object_class"
+.LASF41:
+	.string	"total"
+.LASF39:
+	.string	"aligned_alloc"
+.LASF80:
+	.string	"CpuClassCache"
+.LASF17:
+	.string	"objects"
+.LASF29:
+	.string	"slab_alloc_batch"
+.LASF63:
+	.string	"pFirst"
+.LASF5:
+	.string	"long double"
+.LASF58:
+	.string	"_heap_grow_in_place"
+.LASF81:
+	.string	"CpuCache"
+.LASF83:
+	.string	"alloc_profile_report"
+.LASF45:
+	.string	"pNew"
+.LASF50:
+	.string	"class"
+.LASF37:
+	.string	"alignment"
+.LASF66:
+	.string	"pHead"
+.LASF59:
+	.string	"_heap_usable_size"
+.LASF15:
+	.string	"_Bool"
+.LASF10:
+	.string	"unsigned char"
+.LASF55:
+	.string	"_heap_aligned_alloc"
+.LASF7:
+	.string	"short int"
+.LASF19:
+	.string	"remote_count"
+.LASF65:
+	.string	"ppInbox"
+.LASF12:
+	.string	"uint32_t"
+.LASF51:
+	.string	"pCache"
+.LASF36:
+	.string	"slab_free"
+.LASF71:
+	.string	"enabled"
+.LASF60:
+	.string	"owner"
+.LASF20:
+	.string	"remote"
+.LASF14:
+	.string	"char"
+.LASF24:
+	.string	"kalloc"
+.LASF78:
+	.string	"index"
+.LASF67:
+	.string	"other_owner"
+.LASF62:
+	.string	"_cpu_cache_flush_remote"
+.LASF44:
+	.string	"usable"
+.LASF52:
+	.string	"pList"
+.LASF25:
+	.string	"memset"
+.LASF40:
+	.string	"calloc"
+.LASF32:
+	.string	"memmove"
+.LASF9:
+	.string	"uint8_t"
+.LASF74:
+	.string	"flags"
+.LASF33:
+	.string	"kprintf"
+.LASF21:
+	.string	"cpu_caches"
+.LASF42:
+	.string	"realloc"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc/alloc.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1490 @@
+# 0 "src/alloc/allocbench.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/alloc/allocbench.c"
+# 37 "src/alloc/allocbench.c"
+# 1 "src/include/allocbench.h" 1
+# 30 "src/include/allocbench.h"
+void alloc_benchmark();
+# 38 "src/alloc/allocbench.c" 2
+# 1 "src/include/alloc.h" 1
+# 21 "src/include/alloc.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 22 "src/include/alloc.h" 2
+# 39 "src/include/alloc.h"
+
+# 39 "src/include/alloc.h"
+void *malloc(size_t size);
+void free(void *ptr);
+void *realloc(void *ptr, size_t size);
+void *calloc(size_t count, size_t size);
+void *aligned_alloc(size_t alignment, size_t size);
+void alloc_profile_report();
+void alloc_profile_report_serial();
+
+
+void alloc_cpu_cache_drain();
+# 39 "src/alloc/allocbench.c" 2
+# 1 "src/include/slab.h" 1
+# 21 "src/include/slab.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/slab.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "src/include/slab.h" 2
+# 43 "src/include/slab.h"
+
+# 43 "src/include/slab.h"
+struct SlabCache;
+
+void slab_init();
+void *slab_malloc(size_t size);
+void slab_free(void *ptr);
+size_t slab_usable_size(void *ptr);
+int slab_size_class(size_t size);
+int slab_object_class(void *ptr, uint32_t *pOwner);
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner);
+void slab_free_batch(void **ppObjects, uint32_t count);
+
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject));
+void *kmem_cache_alloc(struct SlabCache *pCache);
+void kmem_cache_free(struct SlabCache *pCache, void *ptr);
+void kmem_cache_report();
+# 40 "src/alloc/allocbench.c" 2
+# 1 "src/include/slob.h" 1
+# 21 "src/include/slob.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/slob.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/slob.h" 2
+
+void slob_init();
+void *slob_malloc(size_t size);
+void slob_free(void *ptr);
+size_t slob_usable_size(void *ptr);
+
+# 28 "src/include/slob.h" 3 4
+_Bool 
+# 28 "src/include/slob.h"
+    slob_grow_in_place(void *ptr, size_t size);
+# 41 "src/alloc/allocbench.c" 2
+# 1 "src/include/bump.h" 1
+# 21 "src/include/bump.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/bump.h" 2
+# 30 "src/include/bump.h"
+struct ArenaChunk {
+    struct ArenaChunk *pNext;
+    size_t pages;
+};
+
+
+
+
+struct Arena {
+    struct ArenaChunk *pChunks;
+    uint8_t *pCursor;
+    uint8_t *pEnd;
+    size_t chunk_pages;
+};
+
+void arena_init(struct Arena *pArena, size_t chunk_pages);
+void *arena_alloc(struct Arena *pArena, size_t size);
+void arena_reset(struct Arena *pArena);
+void arena_destroy(struct Arena *pArena);
+
+void *bump_malloc(size_t size);
+void bump_free(void *ptr);
+# 42 "src/alloc/allocbench.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 43 "src/alloc/allocbench.c" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 44 "src/alloc/allocbench.c" 2
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 43 "src/include/cpu.h" 2
+# 51 "src/include/cpu.h"
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 45 "src/alloc/allocbench.c" 2
+# 1 "src/include/idt.h" 1
+# 22 "src/include/idt.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/idt.h" 2
+
+
+
+
+
+
+
+struct idt_entry
+{
+    uint16_t base_low;
+    uint16_t selector;
+    uint8_t ist;
+    uint8_t flags;
+    uint16_t base_mid;
+    uint32_t base_high;
+    uint32_t reserved;
+} __attribute__((packed));
+
+struct idt_ptr
+{
+    uint16_t limit;
+    uint64_t base;
+} __attribute__((packed));
+
+struct idt_frame {
+    uint64_t rip;
+    uint64_t cs;
+    uint64_t flags;
+    uint64_t rsp;
+    uint64_t ss;
+};
+
+void idt_init();
+
+extern volatile uint64_t kernel_timer_secs;
+# 46 "src/alloc/allocbench.c" 2
+# 1 "src/include/math.h" 1
+# 47 "src/alloc/allocbench.c" 2
+
+struct BenchAllocator {
+    const char *pName;
+    void *(*alloc)(size_t size);
+    void (*free)(void *ptr);
+};
+
+struct BenchState {
+    void *pSlots[1024];
+    size_t sizes[1024];
+    uint32_t *pLatencies;
+    uint32_t ops;
+    uint64_t live_bytes;
+    uint64_t peak_live_bytes;
+    uint64_t start_free_pages;
+    uint64_t peak_used_pages;
+    uint64_t seed;
+};
+
+static struct Arena bench_arena;
+
+static void *_bench_arena_alloc(size_t size)
+{
+    return arena_alloc(&bench_arena, size);
+}
+
+static void _bench_arena_free(void *ptr)
+{
+    (void)ptr;
+}
+
+static const struct BenchAllocator bench_allocators[] = {
+    { "malloc", malloc, free },
+    { "slab", slab_malloc, slab_free },
+    { "slob", slob_malloc, slob_free },
+    { "arena", _bench_arena_alloc, _bench_arena_free },
+};
+
+
+
+
+static uint64_t _bench_rand(struct BenchState *pState)
+{
+    uint64_t x = pState->seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    pState->seed = x;
+    return x;
+}
+
+
+
+
+static size_t _bench_size(struct BenchState *pState)
+{
+    uint64_t r = _bench_rand(pState);
+    uint32_t pick = r % 100;
+
+    r >>= 8;
+    if (pick < 90) {
+        return 8 + r % 248;
+    } else if (pick < 99) {
+        return 256 + r % 1792;
+    }
+    return 2048 + r % 14336;
+}
+
+
+
+
+static uint64_t _bench_free_pages()
+{
+    struct kmem_stats stats;
+    kmem_get_stats(&stats);
+    return stats.free_pages + stats.pcp_pages + stats.zero_pool_pages;
+}
+
+static void _bench_alloc(const struct BenchAllocator *pAlloc, struct BenchState *pState, uint32_t slot, size_t size)
+{
+    uint64_t start = rdtsc();
+    void *ptr = pAlloc->alloc(size);
+    uint64_t end = rdtsc();
+
+    pState->pLatencies[pState->ops++] = (uint32_t)((end - start) < (0xffffffffU) ? (end - start) : (0xffffffffU));
+    if (ptr == 
+# 132 "src/alloc/allocbench.c" 3 4
+              ((void *)0)
+# 132 "src/alloc/allocbench.c"
+                  ) {
+        return;
+    }
+
+
+    *(volatile uint8_t*)ptr = 0;
+
+    pState->pSlots[slot] = ptr;
+    pState->sizes[slot] = size;
+    pState->live_bytes += size;
+
+    if (pState->live_bytes > pState->peak_live_bytes) {
+        pState->peak_live_bytes = pState->live_bytes;
+
+        uint64_t free_pages = _bench_free_pages();
+        uint64_t used = pState->start_free_pages > free_pages ? pState->start_free_pages - free_pages : 0;
+        pState->peak_used_pages = ((pState->peak_used_pages) > (used) ? (pState->peak_used_pages) : (used));
+    }
+}
+
+static void _bench_free(const struct BenchAllocator *pAlloc, struct BenchState *pState, uint32_t slot)
+{
+    uint64_t start = rdtsc();
+    pAlloc->free(pState->pSlots[slot]);
+    uint64_t end = rdtsc();
+
+    pState->pLatencies[pState->ops++] = (uint32_t)((end - start) < (0xffffffffU) ? (end - start) : (0xffffffffU));
+    pState->live_bytes -= pState->sizes[slot];
+    pState->pSlots[slot] = 
+# 160 "src/alloc/allocbench.c" 3 4
+                          ((void *)0)
+# 160 "src/alloc/allocbench.c"
+                              ;
+}
+
+static void _bench_random(const struct BenchAllocator *pAlloc, struct BenchState *pState)
+{
+    while (pState->ops < 20000) {
+        uint32_t slot = _bench_rand(pState) % 1024;
+
+        if (pState->pSlots[slot] != 
+# 168 "src/alloc/allocbench.c" 3 4
+                                   ((void *)0)
+# 168 "src/alloc/allocbench.c"
+                                       ) {
+            _bench_free(pAlloc, pState, slot);
+        } else {
+            _bench_alloc(pAlloc, pState, slot, _bench_size(pState));
+        }
+    }
+}
+
+static void _bench_fifo(const struct BenchAllocator *pAlloc, struct BenchState *pState)
+{
+    uint32_t head = 0;
+
+
+    while (pState->ops + 2 <= 20000) {
+        uint32_t slot = head % 256;
+
+
+        if (pState->pSlots[slot] != 
+# 185 "src/alloc/allocbench.c" 3 4
+                                   ((void *)0)
+# 185 "src/alloc/allocbench.c"
+                                       ) {
+            _bench_free(pAlloc, pState, slot);
+        }
+
+        _bench_alloc(pAlloc, pState, slot, _bench_size(pState));
+        head++;
+    }
+}
+
+static void _bench_aging(const struct BenchAllocator *pAlloc, struct BenchState *pState)
+{
+    uint32_t round = 0;
+
+    while (pState->ops + 1024 * 2 <= 20000) {
+        for (uint32_t slot = round & 1; slot < 1024; slot += 2) {
+            if (pState->pSlots[slot] != 
+# 200 "src/alloc/allocbench.c" 3 4
+                                       ((void *)0)
+# 200 "src/alloc/allocbench.c"
+                                           ) {
+                _bench_free(pAlloc, pState, slot);
+            }
+        }
+
+
+        for (uint32_t slot = 0; slot < 1024; slot++) {
+            if (pState->pSlots[slot] == 
+# 207 "src/alloc/allocbench.c" 3 4
+                                       ((void *)0)
+# 207 "src/alloc/allocbench.c"
+                                           ) {
+                _bench_alloc(pAlloc, pState, slot, _bench_size(pState) + round * 16);
+            }
+        }
+
+        round++;
+    }
+}
+
+
+
+
+static void _bench_sort(uint32_t *pValues, uint32_t count)
+{
+
+    static const uint32_t gaps[] = { 8929, 3905, 1750, 701, 301, 132, 57, 23, 10, 4, 1 };
+
+    for (size_t g = 0; g < sizeof(gaps) / sizeof(gaps[0]); g++) {
+        uint32_t gap = gaps[g];
+
+        for (uint32_t i = gap; i < count; i++) {
+            uint32_t value = pValues[i];
+            uint32_t j = i;
+
+            while (j >= gap && pValues[j - gap] > value) {
+                pValues[j] = pValues[j - gap];
+                j -= gap;
+            }
+
+            pValues[j] = value;
+        }
+    }
+}
+
+
+
+
+static uint64_t _bench_tsc_per_ms()
+{
+    uint64_t timeout = rdtsc() + (1ULL << 32);
+    uint64_t tick = kernel_timer_secs;
+
+    while (kernel_timer_secs == tick) {
+        if (rdtsc() > timeout) {
+            return 0;
+        }
+    }
+
+    uint64_t start = rdtsc();
+    tick = kernel_timer_secs;
+
+    while (kernel_timer_secs < tick + 10) {
+        if (rdtsc() > timeout) {
+            return 0;
+        }
+    }
+
+    return (rdtsc() - start) / 10;
+}
+
+static void _bench_run(const struct BenchAllocator *pAlloc, struct BenchState *pState, const char *pScenario,
+    void (*scenario)(const struct BenchAllocator*, struct BenchState*), uint64_t tsc_per_ms)
+{
+    memset(pState->pSlots, 0, sizeof(pState->pSlots));
+    pState->ops = 0;
+    pState->live_bytes = 0;
+    pState->peak_live_bytes = 0;
+    pState->peak_used_pages = 0;
+    pState->seed = 0x2545F4914F6CDD1DULL;
+    pState->start_free_pages = _bench_free_pages();
+
+    scenario(pAlloc, pState);
+
+    for (uint32_t slot = 0; slot < 1024; slot++) {
+        if (pState->pSlots[slot] != 
+# 281 "src/alloc/allocbench.c" 3 4
+                                   ((void *)0)
+# 281 "src/alloc/allocbench.c"
+                                       ) {
+            pAlloc->free(pState->pSlots[slot]);
+            pState->pSlots[slot] = 
+# 283 "src/alloc/allocbench.c" 3 4
+                                  ((void *)0)
+# 283 "src/alloc/allocbench.c"
+                                      ;
+        }
+    }
+
+    arena_destroy(&bench_arena);
+
+    uint64_t cycles = 0;
+    for (uint32_t i = 0; i < pState->ops; i++) {
+        cycles += pState->pLatencies[i];
+    }
+
+    _bench_sort(pState->pLatencies, pState->ops);
+
+    kprintf("%s %s: ", pAlloc->pName, pScenario);
+    if (tsc_per_ms > 0 && cycles > 0) {
+        kprintf("%lu ops/s, ", pState->ops * tsc_per_ms * 1000 / cycles);
+    } else {
+        kprintf("%lu cycles/op, ", cycles / ((pState->ops) > (1) ? (pState->ops) : (1)));
+    }
+
+    kprintf("p50 %d p90 %d p99 %d cycles, ",
+        pState->pLatencies[pState->ops / 2],
+        pState->pLatencies[pState->ops * 9 / 10],
+        pState->pLatencies[pState->ops * 99 / 100]);
+
+    uint64_t used_bytes = pState->peak_used_pages * 4096;
+    if (used_bytes > 0) {
+        kprintf("%lu percent of %lu KB used live\n",
+            ((pState->peak_live_bytes * 100 / used_bytes) < (100) ? (pState->peak_live_bytes * 100 / used_bytes) : (100)), used_bytes / 1024);
+    } else {
+
+        kprintf("no new pages used\n");
+    }
+}
+
+
+
+
+void alloc_benchmark()
+{
+    static struct BenchState state;
+
+    state.pLatencies = kpalloc((((20000 * sizeof(uint32_t)) + (4096) - 1) / (4096)));
+    if (state.pLatencies == 
+# 326 "src/alloc/allocbench.c" 3 4
+                           ((void *)0)
+# 326 "src/alloc/allocbench.c"
+                               ) {
+        kprintf("Allocator benchmark couldn't allocate its buffers.\n");
+        return;
+    }
+
+    arena_init(&bench_arena, 0);
+
+
+    slob_init();
+    uint64_t tsc_per_ms = _bench_tsc_per_ms();
+
+    kprintf("Allocator benchmark, %d ops per scenario:\n", 20000);
+
+    for (size_t i = 0; i < sizeof(bench_allocators) / sizeof(bench_allocators[0]); i++) {
+        const struct BenchAllocator *pAlloc = &bench_allocators[i];
+
+        _bench_run(pAlloc, &state, "random", _bench_random, tsc_per_ms);
+        _bench_run(pAlloc, &state, "fifo", _bench_fifo, tsc_per_ms);
+        _bench_run(pAlloc, &state, "aging", _bench_aging, tsc_per_ms);
+    }
+
+    kfree(state.pLatencies);
+}
@@ -0,0 +1,8354 @@
+	.file	"allocbench.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc/allocbench.c"
+	.p2align 4
+	.type	_bench_arena_free, @function
+_bench_arena_free:
+.LVL0:
+.LFB31:
+	.file 1 "src/alloc/allocbench.c"
+	.loc 1 74 1 view -0
+	.cfi_startproc
+	.loc 1 75 5 view .LVU1
+	.loc 1 76 1 is_stmt 0 view .LVU2
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	_bench_arena_free, .-_bench_arena_free
+	.p2align 4
+	.type	_bench_free, @function
+_bench_free:
+.LVL1:
+.LFB36:
+	.loc 1 153 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 154 5 view .LVU4
+.LBB26:
+.LBI26:
+	.file 2 "src/include/cpu.h"
+	.loc 2 162 24 view .LVU5
+.LBB27:
+	.loc 2 164 5 view .LVU6
+	.loc 2 165 5 view .LVU7
+.LBE27:
+.LBE26:
+	.loc 1 153 1 is_stmt 0 view .LVU8
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r8
+	movl	%edx, %ecx
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 153 1 view .LVU9
+	movq	%rsi, %rbx
+.LBB30:
+.LBB28:
+	.loc 2 165 5 view .LVU10
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL2:
+	.loc 2 166 5 is_stmt 1 view .LVU11
+	.loc 2 166 35 is_stmt 0 view .LVU12
+#NO_APP
+	movl	%eax, %eax
+	.loc 2 166 28 view .LVU13
+	salq	$32, %rdx
+.LVL3:
+	.loc 2 166 28 view .LVU14
+	leaq	(%rsi,%rcx,8), %r12
+	.loc 2 166 35 view .LVU15
+	orq	%rax, %rdx
+.LBE28:
+.LBE30:
+	.loc 1 155 5 view .LVU16
+	movq	(%r12), %rdi
+.LVL4:
+.LBB31:
+.LBB29:
+	.loc 2 166 35 view .LVU17
+	movq	%rdx, %rbp
+.LVL5:
+	.loc 2 166 35 view .LVU18
+.LBE29:
+.LBE31:
+	.loc 1 155 5 is_stmt 1 view .LVU19
+	call	*16(%r8)
+.LVL6:
+	.loc 1 156 5 view .LVU20
+.LBB32:
+.LBI32:
+	.loc 2 162 24 view .LVU21
+.LBB33:
+	.loc 2 164 5 view .LVU22
+	.loc 2 165 5 view .LVU23
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL7:
+	.loc 2 166 5 view .LVU24
+	.loc 2 166 28 is_stmt 0 view .LVU25
+#NO_APP
+	salq	$32, %rdx
+.LVL8:
+	.loc 2 166 35 view .LVU26
+	movl	%eax, %eax
+	.loc 2 166 35 view .LVU27
+.LBE33:
+.LBE32:
+	.loc 1 158 41 view .LVU28
+	movl	$4294967294, %ecx
+.LBB35:
+.LBB34:
+	.loc 2 166 35 view .LVU29
+	orq	%rax, %rdx
+.LVL9:
+	.loc 2 166 35 view .LVU30
+.LBE34:
+.LBE35:
+	.loc 1 158 5 is_stmt 1 view .LVU31
+	.loc 1 158 57 is_stmt 0 view .LVU32
+	movq	%rdx, %rax
+	.loc 1 158 41 view .LVU33
+	subl	%ebp, %edx
+.LVL10:
+	.loc 1 158 57 view .LVU34
+	subq	%rbp, %rax
+.LVL11:
+	.loc 1 158 41 view .LVU35
+	cmpq	%rax, %rcx
+	movl	$-1, %eax
+	.loc 1 158 11 view .LVU36
+	movq	16384(%rbx), %rcx
+	.loc 1 158 41 view .LVU37
+	cmovb	%eax, %edx
+	.loc 1 158 30 view .LVU38
+	movl	16392(%rbx), %eax
+	.loc 1 158 35 view .LVU39
+	leal	1(%rax), %esi
+	movl	%esi, 16392(%rbx)
+	.loc 1 158 39 view .LVU40
+	movl	%edx, (%rcx,%rax,4)
+	.loc 1 159 5 is_stmt 1 view .LVU41
+	.loc 1 159 24 is_stmt 0 view .LVU42
+	movq	8192(%r12), %rax
+	subq	%rax, 16400(%rbx)
+	.loc 1 160 5 is_stmt 1 view .LVU43
+	.loc 1 160 26 is_stmt 0 view .LVU44
+	movq	$0, (%r12)
+	.loc 1 161 1 view .LVU45
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LVL12:
+	.loc 1 161 1 view .LVU46
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL13:
+	.loc 1 161 1 view .LVU47
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	_bench_free, .-_bench_free
+	.p2align 4
+	.type	_bench_free_pages, @function
+_bench_free_pages:
+.LFB34:
+	.loc 1 119 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 120 5 view .LVU49
+	.loc 1 121 5 view .LVU50
+	.loc 1 119 1 is_stmt 0 view .LVU51
+	subq	$824, %rsp
+	.cfi_def_cfa_offset 832
+	.loc 1 121 5 view .LVU52
+	leaq	8(%rsp), %rdi
+	call	kmem_get_stats@PLT
+.LVL14:
+	.loc 1 122 5 is_stmt 1 view .LVU53
+	.loc 1 122 29 is_stmt 0 view .LVU54
+	movq	24(%rsp), %rax
+	addq	16(%rsp), %rax
+	.loc 1 122 47 view .LVU55
+	addq	32(%rsp), %rax
+	.loc 1 123 1 view .LVU56
+	addq	$824, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	_bench_free_pages, .-_bench_free_pages
+	.p2align 4
+	.type	_bench_alloc, @function
+_bench_alloc:
+.LVL15:
+.LFB35:
+	.loc 1 126 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 127 5 view .LVU58
+.LBB36:
+.LBI36:
+	.loc 2 162 24 view .LVU59
+.LBB37:
+	.loc 2 164 5 view .LVU60
+	.loc 2 165 5 view .LVU61
+.LBE37:
+.LBE36:
+	.loc 1 126 1 is_stmt 0 view .LVU62
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdi, %r8
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rcx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+.LBB40:
+.LBB38:
+	.loc 2 165 5 view .LVU63
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL16:
+	.loc 2 166 5 is_stmt 1 view .LVU64
+	.loc 2 166 28 is_stmt 0 view .LVU65
+#NO_APP
+	salq	$32, %rdx
+.LVL17:
+	.loc 2 166 35 view .LVU66
+	movl	%eax, %eax
+	.loc 2 166 35 view .LVU67
+.LBE38:
+.LBE40:
+	.loc 1 128 17 view .LVU68
+	movq	%rcx, %rdi
+.LVL18:
+.LBB41:
+.LBB39:
+	.loc 2 166 35 view .LVU69
+	orq	%rax, %rdx
+	movq	%rdx, %r13
+.LVL19:
+	.loc 2 166 35 view .LVU70
+.LBE39:
+.LBE41:
+	.loc 1 128 5 is_stmt 1 view .LVU71
+	.loc 1 128 17 is_stmt 0 view .LVU72
+	call	*8(%r8)
+.LVL20:
+	.loc 1 128 17 view .LVU73
+	movq	%rax, %rcx
+.LVL21:
+	.loc 1 129 5 is_stmt 1 view .LVU74
+.LBB42:
+.LBI42:
+	.loc 2 162 24 view .LVU75
+.LBB43:
+	.loc 2 164 5 view .LVU76
+	.loc 2 165 5 view .LVU77
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL22:
+	.loc 2 166 5 view .LVU78
+	.loc 2 166 28 is_stmt 0 view .LVU79
+#NO_APP
+	salq	$32, %rdx
+.LVL23:
+	.loc 2 166 35 view .LVU80
+	movl	%eax, %eax
+	.loc 2 166 35 view .LVU81
+.LBE43:
+.LBE42:
+	.loc 1 131 41 view .LVU82
+	movl	$4294967294, %esi
+.LBB45:
+.LBB44:
+	.loc 2 166 35 view .LVU83
+	orq	%rax, %rdx
+.LVL24:
+	.loc 2 166 35 view .LVU84
+.LBE44:
+.LBE45:
+	.loc 1 131 5 is_stmt 1 view .LVU85
+	.loc 1 131 57 is_stmt 0 view .LVU86
+	movq	%rdx, %rax
+	.loc 1 131 41 view .LVU87
+	subl	%r13d, %edx
+.LVL25:
+	.loc 1 131 57 view .LVU88
+	subq	%r13, %rax
+.LVL26:
+	.loc 1 131 41 view .LVU89
+	cmpq	%rax, %rsi
+	movl	$-1, %eax
+	.loc 1 131 11 view .LVU90
+	movq	16384(%rbx), %rsi
+	.loc 1 131 41 view .LVU91
+	cmovb	%eax, %edx
+	.loc 1 131 30 view .LVU92
+	movl	16392(%rbx), %eax
+	.loc 1 131 35 view .LVU93
+	leal	1(%rax), %edi
+	movl	%edi, 16392(%rbx)
+	.loc 1 131 39 view .LVU94
+	movl	%edx, (%rsi,%rax,4)
+	.loc 1 132 5 is_stmt 1 view .LVU95
+	.loc 1 132 8 is_stmt 0 view .LVU96
+	testq	%rcx, %rcx
+	je	.L9
+	.loc 1 137 5 is_stmt 1 view .LVU97
+	.loc 1 137 29 is_stmt 0 view .LVU98
+	movb	$0, (%rcx)
+	.loc 1 139 5 is_stmt 1 view .LVU99
+	.loc 1 140 25 is_stmt 0 view .LVU100
+	movq	%r12, 8192(%rbx,%rbp,8)
+	.loc 1 141 24 view .LVU101
+	addq	16400(%rbx), %r12
+.LVL27:
+	.loc 1 139 26 view .LVU102
+	movq	%rcx, (%rbx,%rbp,8)
+	.loc 1 140 5 is_stmt 1 view .LVU103
+	.loc 1 141 5 view .LVU104
+	.loc 1 141 24 is_stmt 0 view .LVU105
+	movq	%r12, 16400(%rbx)
+	.loc 1 143 5 is_stmt 1 view .LVU106
+	.loc 1 143 8 is_stmt 0 view .LVU107
+	cmpq	%r12, 16408(%rbx)
+	jb	.L18
+.LVL28:
+.L9:
+	.loc 1 150 1 view .LVU108
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL29:
+	.loc 1 150 1 view .LVU109
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL30:
+	.loc 1 150 1 view .LVU110
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+.LVL31:
+	.loc 1 150 1 view .LVU111
+	ret
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_restore_state
+.LBB46:
+	.loc 1 144 9 is_stmt 1 view .LVU112
+	.loc 1 144 33 is_stmt 0 view .LVU113
+	movq	%r12, 16408(%rbx)
+	.loc 1 146 9 is_stmt 1 view .LVU114
+	.loc 1 146 31 is_stmt 0 view .LVU115
+	xorl	%eax, %eax
+	call	_bench_free_pages
+.LVL33:
+	.loc 1 147 9 is_stmt 1 view .LVU116
+	.loc 1 147 31 is_stmt 0 view .LVU117
+	movq	16416(%rbx), %rcx
+	.loc 1 147 103 view .LVU118
+	movq	%rcx, %rdx
+	subq	%rax, %rdx
+	cmpq	%rcx, %rax
+	movl	$0, %eax
+.LVL34:
+	.loc 1 147 103 view .LVU119
+	cmovnb	%rax, %rdx
+.LVL35:
+	.loc 1 148 9 is_stmt 1 view .LVU120
+	.loc 1 148 99 is_stmt 0 view .LVU121
+	movq	16424(%rbx), %rax
+	cmpq	%rdx, %rax
+	cmovb	%rdx, %rax
+	.loc 1 148 33 view .LVU122
+	movq	%rax, 16424(%rbx)
+.LBE46:
+	.loc 1 150 1 view .LVU123
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL36:
+	.loc 1 150 1 view .LVU124
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+.LVL37:
+	.loc 1 150 1 view .LVU125
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	_bench_alloc, .-_bench_alloc
+	.p2align 4
+	.type	_bench_random, @function
+_bench_random:
+.LVL38:
+.LFB37:
+	.loc 1 164 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 165 5 view .LVU127
+	.loc 1 165 24 view .LVU128
+	cmpl	$19999, 16392(%rsi)
+	ja	.L29
+	.loc 1 164 1 is_stmt 0 view .LVU129
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB54:
+.LBB55:
+.LBB56:
+	.loc 1 104 23 view .LVU130
+	movabsq	$2951479051793528259, %rbp
+.LBE56:
+.LBE55:
+.LBE54:
+	.loc 1 164 1 view .LVU131
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	jmp	.L26
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L33:
+.LBB69:
+	.loc 1 169 13 is_stmt 1 view .LVU132
+	movl	%edi, %edx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+.LVL40:
+	.loc 1 169 13 is_stmt 0 view .LVU133
+	call	_bench_free
+.LVL41:
+	.loc 1 169 13 view .LVU134
+.LBE69:
+	.loc 1 165 24 is_stmt 1 view .LVU135
+	cmpl	$19999, 16392(%r12)
+	ja	.L32
+.LVL42:
+.L26:
+.LBB70:
+	.loc 1 166 9 view .LVU136
+.LBB63:
+.LBI63:
+	.loc 1 88 17 view .LVU137
+.LBB64:
+	.loc 1 90 5 view .LVU138
+	.loc 1 90 14 is_stmt 0 view .LVU139
+	movq	16432(%r12), %rax
+.LVL43:
+	.loc 1 91 5 is_stmt 1 view .LVU140
+	.loc 1 91 12 is_stmt 0 view .LVU141
+	movq	%rax, %rdx
+	salq	$13, %rdx
+	.loc 1 91 7 view .LVU142
+	xorq	%rdx, %rax
+.LVL44:
+	.loc 1 92 5 is_stmt 1 view .LVU143
+	.loc 1 92 12 is_stmt 0 view .LVU144
+	movq	%rax, %rdx
+	shrq	$7, %rdx
+	.loc 1 92 7 view .LVU145
+	xorq	%rdx, %rax
+.LVL45:
+	.loc 1 93 5 is_stmt 1 view .LVU146
+	.loc 1 93 12 is_stmt 0 view .LVU147
+	movq	%rax, %rdx
+	salq	$17, %rdx
+	.loc 1 93 7 view .LVU148
+	xorq	%rdx, %rax
+.LVL46:
+	.loc 1 94 5 is_stmt 1 view .LVU149
+.LBE64:
+.LBE63:
+	.loc 1 166 18 is_stmt 0 view .LVU150
+	movl	%eax, %edi
+.LBB66:
+.LBB65:
+	.loc 1 94 18 view .LVU151
+	movq	%rax, 16432(%r12)
+	.loc 1 95 5 is_stmt 1 view .LVU152
+.LVL47:
+	.loc 1 95 5 is_stmt 0 view .LVU153
+.LBE65:
+.LBE66:
+	.loc 1 166 18 view .LVU154
+	andl	$1023, %edi
+.LVL48:
+	.loc 1 168 9 is_stmt 1 view .LVU155
+	.loc 1 168 27 is_stmt 0 view .LVU156
+	movl	%edi, %edx
+	.loc 1 168 12 view .LVU157
+	cmpq	$0, (%r12,%rdx,8)
+	jne	.L33
+	.loc 1 171 13 is_stmt 1 view .LVU158
+.LVL49:
+.LBB67:
+.LBI55:
+	.loc 1 101 15 view .LVU159
+.LBB61:
+	.loc 1 103 5 view .LVU160
+.LBB57:
+.LBI57:
+	.loc 1 88 17 view .LVU161
+.LBB58:
+	.loc 1 90 5 view .LVU162
+	.loc 1 91 5 view .LVU163
+	.loc 1 91 12 is_stmt 0 view .LVU164
+	movq	%rax, %rsi
+	salq	$13, %rsi
+	.loc 1 91 7 view .LVU165
+	xorq	%rax, %rsi
+.LVL50:
+	.loc 1 92 5 is_stmt 1 view .LVU166
+	.loc 1 92 12 is_stmt 0 view .LVU167
+	movq	%rsi, %rax
+	shrq	$7, %rax
+	.loc 1 92 7 view .LVU168
+	xorq	%rax, %rsi
+.LVL51:
+	.loc 1 93 5 is_stmt 1 view .LVU169
+	.loc 1 93 12 is_stmt 0 view .LVU170
+	movq	%rsi, %rax
+	salq	$17, %rax
+	.loc 1 93 7 view .LVU171
+	xorq	%rax, %rsi
+.LVL52:
+	.loc 1 94 5 is_stmt 1 view .LVU172
+.LBE58:
+.LBE57:
+	.loc 1 104 23 is_stmt 0 view .LVU173
+	movq	%rsi, %rdx
+	.loc 1 106 7 view .LVU174
+	movq	%rsi, %rcx
+.LBB60:
+.LBB59:
+	.loc 1 94 18 view .LVU175
+	movq	%rsi, 16432(%r12)
+	.loc 1 95 5 is_stmt 1 view .LVU176
+.LVL53:
+	.loc 1 95 5 is_stmt 0 view .LVU177
+.LBE59:
+.LBE60:
+	.loc 1 104 5 is_stmt 1 view .LVU178
+	.loc 1 104 23 is_stmt 0 view .LVU179
+	shrq	$2, %rdx
+	.loc 1 106 7 view .LVU180
+	shrq	$8, %rcx
+	.loc 1 104 23 view .LVU181
+	movq	%rdx, %rax
+	mulq	%rbp
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rsi, %rax
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$2, %rdx
+	subq	%rdx, %rax
+.LVL54:
+	.loc 1 106 5 is_stmt 1 view .LVU182
+	.loc 1 107 5 view .LVU183
+	.loc 1 107 8 is_stmt 0 view .LVU184
+	cmpq	$89, %rax
+	jbe	.L34
+	.loc 1 109 12 is_stmt 1 view .LVU185
+	.loc 1 109 15 is_stmt 0 view .LVU186
+	cmpq	$99, %rax
+	je	.L25
+	.loc 1 110 9 is_stmt 1 view .LVU187
+	.loc 1 110 24 is_stmt 0 view .LVU188
+	movabsq	$2635249153387078838, %rax
+.LVL55:
+	.loc 1 110 24 view .LVU189
+	shrq	$16, %rsi
+.LVL56:
+	.loc 1 110 24 view .LVU190
+	mulq	%rsi
+.LVL57:
+	.loc 1 110 24 view .LVU191
+	leaq	0(,%rdx,8), %r8
+	subq	%rdx, %r8
+	salq	$8, %r8
+	subq	%r8, %rcx
+.LVL58:
+	.loc 1 110 20 view .LVU192
+	addq	$256, %rcx
+.L24:
+.LVL59:
+	.loc 1 110 20 view .LVU193
+.LBE61:
+.LBE67:
+	.loc 1 171 13 view .LVU194
+	movl	%edi, %edx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+.LVL60:
+	.loc 1 171 13 view .LVU195
+	call	_bench_alloc
+.LVL61:
+	.loc 1 171 13 view .LVU196
+.LBE70:
+	.loc 1 165 24 is_stmt 1 view .LVU197
+	cmpl	$19999, 16392(%r12)
+	jbe	.L26
+.L32:
+	.loc 1 174 1 is_stmt 0 view .LVU198
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LVL62:
+	.loc 1 174 1 view .LVU199
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL63:
+	.loc 1 174 1 view .LVU200
+	ret
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+.LBB71:
+.LBB68:
+.LBB62:
+	.loc 1 108 9 is_stmt 1 view .LVU201
+	.loc 1 108 22 is_stmt 0 view .LVU202
+	movabsq	$2380225041768974403, %rax
+.LVL65:
+	.loc 1 108 22 view .LVU203
+	shrq	$11, %rsi
+.LVL66:
+	.loc 1 108 22 view .LVU204
+	mulq	%rsi
+.LVL67:
+	.loc 1 108 22 view .LVU205
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	salq	$5, %rax
+	subq	%rdx, %rax
+	salq	$3, %rax
+	subq	%rax, %rcx
+.LVL68:
+	.loc 1 108 18 view .LVU206
+	addq	$8, %rcx
+	jmp	.L24
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 112 5 is_stmt 1 view .LVU207
+	.loc 1 112 21 is_stmt 0 view .LVU208
+	movabsq	$2635249153387079094, %rax
+.LVL70:
+	.loc 1 112 21 view .LVU209
+	shrq	$19, %rsi
+.LVL71:
+	.loc 1 112 21 view .LVU210
+	mulq	%rsi
+.LVL72:
+	.loc 1 112 21 view .LVU211
+	leaq	0(,%rdx,8), %rax
+	subq	%rdx, %rax
+	salq	$11, %rax
+	subq	%rax, %rcx
+.LVL73:
+	.loc 1 112 17 view .LVU212
+	addq	$2048, %rcx
+	jmp	.L24
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 112 17 view .LVU213
+	ret
+.LBE62:
+.LBE68:
+.LBE71:
+	.cfi_endproc
+.LFE37:
+	.size	_bench_random, .-_bench_random
+	.p2align 4
+	.type	_bench_arena_alloc, @function
+_bench_arena_alloc:
+.LVL75:
+.LFB30:
+	.loc 1 69 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 70 5 view .LVU215
+	.loc 1 69 1 is_stmt 0 view .LVU216
+	movq	%rdi, %rsi
+	.loc 1 70 12 view .LVU217
+	leaq	bench_arena(%rip), %rdi
+.LVL76:
+	.loc 1 70 12 view .LVU218
+	jmp	arena_alloc@PLT
+.LVL77:
+	.loc 1 70 12 view .LVU219
+	.cfi_endproc
+.LFE30:
+	.size	_bench_arena_alloc, .-_bench_arena_alloc
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%s %s: "
+.LC1:
+	.string	"%lu ops/s, "
+.LC2:
+	.string	"%lu cycles/op, "
+.LC3:
+	.string	"p50 %d p90 %d p99 %d cycles, "
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"%lu percent of %lu KB used live\n"
+	.section	.rodata.str1.1
+.LC5:
+	.string	"no new pages used\n"
+	.text
+	.p2align 4
+	.type	_bench_run.constprop.0, @function
+_bench_run.constprop.0:
+.LVL78:
+.LFB44:
+	.loc 1 267 13 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 270 5 view .LVU221
+	.loc 1 267 13 is_stmt 0 view .LVU222
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	.loc 1 270 5 view .LVU223
+	movl	$8192, %edx
+.LVL79:
+	.loc 1 267 13 view .LVU224
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 270 5 view .LVU225
+	leaq	state.1(%rip), %r12
+	.loc 1 267 13 view .LVU226
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	.loc 1 270 5 view .LVU227
+	movq	%r12, %rdi
+.LVL80:
+	.loc 1 267 13 view .LVU228
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 267 13 view .LVU229
+	movq	%rsi, (%rsp)
+	.loc 1 270 5 view .LVU230
+	xorl	%esi, %esi
+.LVL81:
+	.loc 1 270 5 view .LVU231
+	call	memset@PLT
+.LVL82:
+	.loc 1 271 5 is_stmt 1 view .LVU232
+	.loc 1 275 18 is_stmt 0 view .LVU233
+	movabsq	$2685821657736338717, %rax
+	.loc 1 271 17 view .LVU234
+	movl	$0, 16392+state.1(%rip)
+	.loc 1 272 5 is_stmt 1 view .LVU235
+	.loc 1 275 18 is_stmt 0 view .LVU236
+	movq	%rax, 16432+state.1(%rip)
+	.loc 1 276 32 view .LVU237
+	xorl	%eax, %eax
+	.loc 1 272 24 view .LVU238
+	movq	$0, 16400+state.1(%rip)
+	.loc 1 273 5 is_stmt 1 view .LVU239
+	.loc 1 273 29 is_stmt 0 view .LVU240
+	movq	$0, 16408+state.1(%rip)
+	.loc 1 274 5 is_stmt 1 view .LVU241
+	.loc 1 274 29 is_stmt 0 view .LVU242
+	movq	$0, 16424+state.1(%rip)
+	.loc 1 275 5 is_stmt 1 view .LVU243
+	.loc 1 276 5 view .LVU244
+	.loc 1 276 32 is_stmt 0 view .LVU245
+	call	_bench_free_pages
+.LVL83:
+	.loc 1 278 5 view .LVU246
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	.loc 1 276 30 view .LVU247
+	movq	%rax, 16416+state.1(%rip)
+	.loc 1 278 5 is_stmt 1 view .LVU248
+	call	*%r13
+.LVL84:
+	.loc 1 280 5 view .LVU249
+.LBB82:
+	.loc 1 280 10 view .LVU250
+	.loc 1 280 34 view .LVU251
+	leaq	8192(%r12), %r13
+.LVL85:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 281 9 view .LVU252
+	.loc 1 281 27 is_stmt 0 view .LVU253
+	movq	(%r12), %rdi
+	.loc 1 281 12 view .LVU254
+	testq	%rdi, %rdi
+	je	.L37
+	.loc 1 282 13 is_stmt 1 view .LVU255
+	call	*16(%rbx)
+.LVL86:
+	.loc 1 283 13 view .LVU256
+	.loc 1 283 34 is_stmt 0 view .LVU257
+	movq	$0, (%r12)
+.L37:
+	.loc 1 280 46 is_stmt 1 view .LVU258
+.LVL87:
+	.loc 1 280 34 view .LVU259
+	addq	$8, %r12
+.LVL88:
+	.loc 1 280 34 is_stmt 0 view .LVU260
+	cmpq	%r12, %r13
+	jne	.L38
+.LBE82:
+	.loc 1 287 5 is_stmt 1 view .LVU261
+	leaq	bench_arena(%rip), %rdi
+	call	arena_destroy@PLT
+.LVL89:
+	.loc 1 289 5 view .LVU262
+	.loc 1 290 5 view .LVU263
+.LBB83:
+	.loc 1 290 10 view .LVU264
+	.loc 1 290 28 view .LVU265
+	.loc 1 290 36 is_stmt 0 view .LVU266
+	movl	16392+state.1(%rip), %r13d
+.LBE83:
+	.loc 1 297 20 view .LVU267
+	testq	%rbp, %rbp
+.LBB84:
+	.loc 1 291 25 view .LVU268
+	movq	16384+state.1(%rip), %r8
+.LBE84:
+	.loc 1 297 20 view .LVU269
+	setne	%sil
+.LBB85:
+	.loc 1 290 28 view .LVU270
+	testl	%r13d, %r13d
+	je	.L39
+	movl	%r13d, %edx
+	movq	%r8, %rax
+.LBE85:
+	.loc 1 289 14 view .LVU271
+	xorl	%r12d, %r12d
+.LVL90:
+	.loc 1 289 14 view .LVU272
+	leaq	(%r8,%rdx,4), %rcx
+.LVL91:
+.L40:
+.LBB86:
+	.loc 1 291 9 is_stmt 1 view .LVU273
+	.loc 1 291 37 is_stmt 0 view .LVU274
+	movl	(%rax), %edx
+	.loc 1 290 28 view .LVU275
+	addq	$4, %rax
+.LVL92:
+	.loc 1 291 16 view .LVU276
+	addq	%rdx, %r12
+.LVL93:
+	.loc 1 290 44 is_stmt 1 view .LVU277
+	.loc 1 290 28 view .LVU278
+	cmpq	%rax, %rcx
+	jne	.L40
+.LBE86:
+	.loc 1 297 34 is_stmt 0 view .LVU279
+	testq	%r12, %r12
+	setne	%al
+	.loc 1 297 24 view .LVU280
+	andl	%esi, %eax
+	movl	%eax, %r15d
+.LVL94:
+.L41:
+	.loc 1 294 5 is_stmt 1 view .LVU281
+.LBB87:
+.LBI87:
+	.loc 1 219 13 view .LVU282
+.LBB88:
+	.loc 1 222 5 view .LVU283
+	.loc 1 224 5 view .LVU284
+.LBB89:
+	.loc 1 224 10 view .LVU285
+	.loc 1 224 26 view .LVU286
+	movq	%r12, 8(%rsp)
+	leaq	gaps.0(%rip), %rax
+	leaq	44(%rax), %r14
+.LVL95:
+	.p2align 4,,10
+	.p2align 3
+.L43:
+.LBB90:
+	.loc 1 225 9 view .LVU287
+	.loc 1 225 18 is_stmt 0 view .LVU288
+	movl	(%rax), %edi
+.LVL96:
+	.loc 1 227 9 is_stmt 1 view .LVU289
+.LBB91:
+	.loc 1 227 14 view .LVU290
+	.loc 1 227 34 view .LVU291
+	cmpl	%r13d, %edi
+	jnb	.L49
+	movl	%edi, %ecx
+.LBE91:
+	.loc 1 225 18 is_stmt 0 view .LVU292
+	movl	%edi, %r11d
+	leaq	(%r8,%rcx,4), %r12
+.LVL97:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+.LBB96:
+.LBB92:
+	.loc 1 228 13 is_stmt 1 view .LVU293
+	.loc 1 228 22 is_stmt 0 view .LVU294
+	movl	(%r12), %r10d
+.LVL98:
+	.loc 1 229 13 is_stmt 1 view .LVU295
+	.loc 1 231 13 view .LVU296
+	.loc 1 231 29 view .LVU297
+	.loc 1 228 37 is_stmt 0 view .LVU298
+	movq	%r12, %rcx
+	.loc 1 231 29 view .LVU299
+	movl	%r11d, %edx
+	cmpl	%edi, %r11d
+	jnb	.L45
+.LVL99:
+	.loc 1 231 29 view .LVU300
+	jmp	.L46
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 232 17 is_stmt 1 view .LVU301
+	.loc 1 232 28 is_stmt 0 view .LVU302
+	movl	%esi, (%rcx)
+	.loc 1 233 17 is_stmt 1 view .LVU303
+.LVL101:
+	.loc 1 231 29 view .LVU304
+	cmpl	%edi, %edx
+	jb	.L54
+.L45:
+	.loc 1 231 29 is_stmt 0 view .LVU305
+	movl	%edx, %ecx
+	.loc 1 231 42 view .LVU306
+	subl	%edi, %edx
+.LVL102:
+	.loc 1 231 42 view .LVU307
+	movl	%edx, %esi
+	.loc 1 232 24 view .LVU308
+	leaq	(%r8,%rcx,4), %rcx
+.LVL103:
+	.loc 1 231 39 view .LVU309
+	leaq	(%r8,%rsi,4), %r9
+	movl	(%r9), %esi
+	.loc 1 231 29 view .LVU310
+	cmpl	%esi, %r10d
+	jb	.L47
+.LVL104:
+.L46:
+	.loc 1 236 13 is_stmt 1 view .LVU311
+.LBE92:
+	.loc 1 227 44 is_stmt 0 view .LVU312
+	addl	$1, %r11d
+.LVL105:
+.LBB93:
+	.loc 1 236 24 view .LVU313
+	movl	%r10d, (%rcx)
+.LBE93:
+	.loc 1 227 44 is_stmt 1 view .LVU314
+.LVL106:
+	.loc 1 227 34 view .LVU315
+	addq	$4, %r12
+	cmpl	%r11d, %r13d
+	jne	.L48
+.LVL107:
+.L49:
+	.loc 1 227 34 is_stmt 0 view .LVU316
+.LBE96:
+.LBE90:
+	.loc 1 224 61 is_stmt 1 view .LVU317
+	.loc 1 224 26 view .LVU318
+	addq	$4, %rax
+	cmpq	%rax, %r14
+	jne	.L43
+.LBE89:
+.LBE88:
+.LBE87:
+	.loc 1 296 5 is_stmt 0 view .LVU319
+	movq	(%rbx), %rsi
+	movq	(%rsp), %rdx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+.LVL108:
+.LBB103:
+.LBB101:
+.LBB99:
+	.loc 1 296 5 view .LVU320
+	movq	8(%rsp), %r12
+.LVL109:
+	.loc 1 296 5 view .LVU321
+.LBE99:
+.LBE101:
+.LBE103:
+	.loc 1 296 5 is_stmt 1 view .LVU322
+	call	kprintf@PLT
+.LVL110:
+	.loc 1 297 5 view .LVU323
+	.loc 1 297 8 is_stmt 0 view .LVU324
+	testb	%r15b, %r15b
+	jne	.L67
+	.loc 1 300 9 is_stmt 1 view .LVU325
+	.loc 1 300 82 is_stmt 0 view .LVU326
+	movl	16392+state.1(%rip), %eax
+	movl	$1, %edx
+	.loc 1 300 9 view .LVU327
+	leaq	.LC2(%rip), %rdi
+	.loc 1 300 82 view .LVU328
+	testl	%eax, %eax
+	cmove	%edx, %eax
+	.loc 1 300 9 view .LVU329
+	xorl	%edx, %edx
+	.loc 1 300 82 view .LVU330
+	movl	%eax, %ecx
+	.loc 1 300 9 view .LVU331
+	movq	%r12, %rax
+	divq	%rcx
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL111:
+.L51:
+	.loc 1 303 5 is_stmt 1 view .LVU332
+	.loc 1 306 34 is_stmt 0 view .LVU333
+	movl	16392+state.1(%rip), %eax
+	.loc 1 306 15 view .LVU334
+	movq	16384+state.1(%rip), %rcx
+	.loc 1 305 44 view .LVU335
+	movl	$3435973837, %esi
+	.loc 1 306 45 view .LVU336
+	imull	$99, %eax, %edx
+	imulq	$1374389535, %rdx, %rdx
+	shrq	$37, %rdx
+	.loc 1 303 5 view .LVU337
+	movl	(%rcx,%rdx,4), %edi
+	.loc 1 305 44 view .LVU338
+	leal	(%rax,%rax,8), %edx
+	.loc 1 304 40 view .LVU339
+	shrl	%eax
+	.loc 1 305 44 view .LVU340
+	imulq	%rsi, %rdx
+	.loc 1 303 5 view .LVU341
+	movl	(%rcx,%rax,4), %esi
+	xorl	%eax, %eax
+	.loc 1 305 44 view .LVU342
+	shrq	$35, %rdx
+	.loc 1 303 5 view .LVU343
+	movl	(%rcx,%rdx,4), %edx
+	movl	%edi, %ecx
+	leaq	.LC3(%rip), %rdi
+	call	kprintf@PLT
+.LVL112:
+	.loc 1 308 5 is_stmt 1 view .LVU344
+	.loc 1 309 5 view .LVU345
+	.loc 1 309 8 is_stmt 0 view .LVU346
+	movq	16424+state.1(%rip), %rcx
+	salq	$12, %rcx
+.LVL113:
+	.loc 1 309 8 view .LVU347
+	je	.L52
+	.loc 1 310 9 is_stmt 1 view .LVU348
+	.loc 1 311 39 is_stmt 0 view .LVU349
+	movq	16408+state.1(%rip), %rax
+	.loc 1 311 45 view .LVU350
+	xorl	%edx, %edx
+	.loc 1 310 9 view .LVU351
+	movq	%rcx, %rdi
+	shrq	$10, %rdi
+	.loc 1 311 39 view .LVU352
+	leaq	(%rax,%rax,4), %rax
+	leaq	(%rax,%rax,4), %rax
+	salq	$2, %rax
+	.loc 1 311 45 view .LVU353
+	divq	%rcx
+	.loc 1 310 9 view .LVU354
+	movl	$100, %edx
+	cmpq	%rdx, %rax
+	cmovbe	%rax, %rdx
+	.loc 1 316 1 view .LVU355
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 310 9 view .LVU356
+	xorl	%eax, %eax
+	.loc 1 316 1 view .LVU357
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL114:
+	.loc 1 316 1 view .LVU358
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL115:
+	.loc 1 310 9 view .LVU359
+	movq	%rdx, %rsi
+	.loc 1 316 1 view .LVU360
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	.loc 1 310 9 view .LVU361
+	movq	%rdi, %rdx
+	.loc 1 316 1 view .LVU362
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	.loc 1 310 9 view .LVU363
+	leaq	.LC4(%rip), %rdi
+	.loc 1 316 1 view .LVU364
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 310 9 view .LVU365
+	jmp	kprintf@PLT
+.LVL116:
+.L67:
+	.cfi_restore_state
+	.loc 1 298 9 is_stmt 1 view .LVU366
+	.loc 1 298 38 is_stmt 0 view .LVU367
+	movl	16392+state.1(%rip), %eax
+	.loc 1 298 9 view .LVU368
+	xorl	%edx, %edx
+	leaq	.LC1(%rip), %rdi
+	.loc 1 298 57 view .LVU369
+	imulq	%rbp, %rax
+	imulq	$1000, %rax, %rax
+	.loc 1 298 9 view .LVU370
+	divq	%r12
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL117:
+	jmp	.L51
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+.LBB104:
+.LBB102:
+.LBB100:
+.LBB98:
+.LBB97:
+.LBB94:
+	.loc 1 231 39 view .LVU371
+	movq	%r9, %rcx
+	.loc 1 236 13 is_stmt 1 view .LVU372
+.LBE94:
+	.loc 1 227 44 is_stmt 0 view .LVU373
+	addl	$1, %r11d
+.LVL119:
+	.loc 1 227 34 view .LVU374
+	addq	$4, %r12
+.LBB95:
+	.loc 1 236 24 view .LVU375
+	movl	%r10d, (%rcx)
+.LBE95:
+	.loc 1 227 44 is_stmt 1 view .LVU376
+.LVL120:
+	.loc 1 227 34 view .LVU377
+	cmpl	%r11d, %r13d
+	jne	.L48
+	.loc 1 227 34 is_stmt 0 view .LVU378
+	jmp	.L49
+.LVL121:
+.L52:
+	.loc 1 227 34 view .LVU379
+.LBE97:
+.LBE98:
+.LBE100:
+.LBE102:
+.LBE104:
+	.loc 1 314 9 is_stmt 1 view .LVU380
+	.loc 1 316 1 is_stmt 0 view .LVU381
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 314 9 view .LVU382
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 316 1 view .LVU383
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL122:
+	.loc 1 316 1 view .LVU384
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL123:
+	.loc 1 316 1 view .LVU385
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 314 9 view .LVU386
+	jmp	kprintf@PLT
+.LVL124:
+.L39:
+	.cfi_restore_state
+	.loc 1 294 5 view .LVU387
+	xorl	%r15d, %r15d
+	.loc 1 289 14 view .LVU388
+	xorl	%r12d, %r12d
+.LVL125:
+	.loc 1 289 14 view .LVU389
+	jmp	.L41
+	.cfi_endproc
+.LFE44:
+	.size	_bench_run.constprop.0, .-_bench_run.constprop.0
+	.p2align 4
+	.type	_bench_aging, @function
+_bench_aging:
+.LVL126:
+.LFB39:
+	.loc 1 195 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 196 5 view .LVU391
+	.loc 1 198 5 view .LVU392
+	.loc 1 198 35 view .LVU393
+	.loc 1 198 24 is_stmt 0 view .LVU394
+	movl	16392(%rsi), %eax
+	addl	$2048, %eax
+	.loc 1 198 35 view .LVU395
+	cmpl	$20000, %eax
+	ja	.L82
+	.loc 1 195 1 view .LVU396
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB111:
+.LBB112:
+.LBB113:
+	.loc 1 104 23 view .LVU397
+	movabsq	$2951479051793528259, %r12
+.LBE113:
+.LBE112:
+.LBE111:
+	.loc 1 195 1 view .LVU398
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 196 14 view .LVU399
+	movl	$0, 12(%rsp)
+.LVL127:
+.L77:
+	.loc 1 199 9 is_stmt 1 view .LVU400
+.LBB124:
+	.loc 1 199 14 view .LVU401
+	.loc 1 199 23 is_stmt 0 view .LVU402
+	movl	12(%rsp), %ebp
+	andl	$1, %ebp
+.LVL128:
+	.loc 1 199 46 is_stmt 1 view .LVU403
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.loc 1 200 13 view .LVU404
+	.loc 1 200 31 is_stmt 0 view .LVU405
+	movl	%ebp, %eax
+	.loc 1 200 16 view .LVU406
+	cmpq	$0, (%r14,%rax,8)
+	je	.L70
+	.loc 1 201 17 is_stmt 1 view .LVU407
+	movl	%ebp, %edx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	_bench_free
+.LVL129:
+.L70:
+	.loc 1 199 59 discriminator 2 view .LVU408
+	addl	$2, %ebp
+.LVL130:
+	.loc 1 199 46 discriminator 2 view .LVU409
+	cmpl	$1023, %ebp
+	jbe	.L71
+.LBE124:
+.LBB125:
+	.loc 1 208 80 is_stmt 0 view .LVU410
+	movl	12(%rsp), %ebp
+.LVL131:
+	.loc 1 208 80 view .LVU411
+	xorl	%r15d, %r15d
+.LBB121:
+.LBB118:
+	.loc 1 108 22 view .LVU412
+	movabsq	$2380225041768974403, %r13
+.LBE118:
+.LBE121:
+	.loc 1 208 80 view .LVU413
+	sall	$4, %ebp
+	jmp	.L76
+.LVL132:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+	.loc 1 206 50 is_stmt 1 discriminator 2 view .LVU414
+	.loc 1 206 38 discriminator 2 view .LVU415
+	addq	$1, %r15
+.LVL133:
+	.loc 1 206 38 is_stmt 0 discriminator 2 view .LVU416
+	cmpq	$1024, %r15
+	je	.L85
+.LVL134:
+.L76:
+	.loc 1 207 13 is_stmt 1 view .LVU417
+	.loc 1 207 16 is_stmt 0 view .LVU418
+	cmpq	$0, (%r14,%r15,8)
+	jne	.L72
+	.loc 1 208 17 is_stmt 1 view .LVU419
+.LVL135:
+.LBB122:
+.LBI112:
+	.loc 1 101 15 view .LVU420
+.LBB119:
+	.loc 1 103 5 view .LVU421
+.LBB114:
+.LBI114:
+	.loc 1 88 17 view .LVU422
+.LBB115:
+	.loc 1 90 5 view .LVU423
+	.loc 1 90 14 is_stmt 0 view .LVU424
+	movq	16432(%r14), %rcx
+.LVL136:
+	.loc 1 91 5 is_stmt 1 view .LVU425
+	.loc 1 91 12 is_stmt 0 view .LVU426
+	movq	%rcx, %rax
+	salq	$13, %rax
+	.loc 1 91 7 view .LVU427
+	xorq	%rax, %rcx
+.LVL137:
+	.loc 1 92 5 is_stmt 1 view .LVU428
+	.loc 1 92 12 is_stmt 0 view .LVU429
+	movq	%rcx, %rax
+	shrq	$7, %rax
+	.loc 1 92 7 view .LVU430
+	xorq	%rax, %rcx
+.LVL138:
+	.loc 1 93 5 is_stmt 1 view .LVU431
+	.loc 1 93 12 is_stmt 0 view .LVU432
+	movq	%rcx, %rax
+	salq	$17, %rax
+	.loc 1 93 7 view .LVU433
+	xorq	%rax, %rcx
+.LVL139:
+	.loc 1 94 5 is_stmt 1 view .LVU434
+.LBE115:
+.LBE114:
+	.loc 1 104 23 is_stmt 0 view .LVU435
+	movq	%rcx, %rdx
+	.loc 1 106 7 view .LVU436
+	movq	%rcx, %rdi
+.LBB117:
+.LBB116:
+	.loc 1 94 18 view .LVU437
+	movq	%rcx, 16432(%r14)
+	.loc 1 95 5 is_stmt 1 view .LVU438
+.LVL140:
+	.loc 1 95 5 is_stmt 0 view .LVU439
+.LBE116:
+.LBE117:
+	.loc 1 104 5 is_stmt 1 view .LVU440
+	.loc 1 104 23 is_stmt 0 view .LVU441
+	shrq	$2, %rdx
+	.loc 1 106 7 view .LVU442
+	shrq	$8, %rdi
+	.loc 1 104 23 view .LVU443
+	movq	%rdx, %rax
+	mulq	%r12
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rcx, %rax
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$2, %rdx
+	subq	%rdx, %rax
+.LVL141:
+	.loc 1 106 5 is_stmt 1 view .LVU444
+	.loc 1 107 5 view .LVU445
+	.loc 1 107 8 is_stmt 0 view .LVU446
+	cmpq	$89, %rax
+	jbe	.L86
+	.loc 1 109 12 is_stmt 1 view .LVU447
+	.loc 1 109 15 is_stmt 0 view .LVU448
+	cmpq	$99, %rax
+	je	.L75
+	.loc 1 110 9 is_stmt 1 view .LVU449
+	.loc 1 110 24 is_stmt 0 view .LVU450
+	movabsq	$2635249153387078838, %rax
+.LVL142:
+	.loc 1 110 24 view .LVU451
+	shrq	$16, %rcx
+.LVL143:
+	.loc 1 110 24 view .LVU452
+	mulq	%rcx
+.LVL144:
+	.loc 1 110 24 view .LVU453
+	leaq	0(,%rdx,8), %r9
+	subq	%rdx, %r9
+	salq	$8, %r9
+	subq	%r9, %rdi
+.LVL145:
+	.loc 1 110 20 view .LVU454
+	leaq	256(%rdi), %rcx
+.L74:
+.LVL146:
+	.loc 1 110 20 view .LVU455
+.LBE119:
+.LBE122:
+	.loc 1 208 17 view .LVU456
+	movl	%r15d, %edx
+	addq	%rbp, %rcx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	_bench_alloc
+.LVL147:
+	.loc 1 206 50 is_stmt 1 view .LVU457
+	.loc 1 206 38 view .LVU458
+	addq	$1, %r15
+.LVL148:
+	.loc 1 206 38 is_stmt 0 view .LVU459
+	cmpq	$1024, %r15
+	jne	.L76
+.LVL149:
+.L85:
+	.loc 1 206 38 view .LVU460
+.LBE125:
+	.loc 1 212 9 is_stmt 1 view .LVU461
+	.loc 1 198 35 view .LVU462
+	.loc 1 198 24 is_stmt 0 view .LVU463
+	movl	16392(%r14), %eax
+	.loc 1 212 14 view .LVU464
+	addl	$1, 12(%rsp)
+.LVL150:
+	.loc 1 198 24 view .LVU465
+	addl	$2048, %eax
+	.loc 1 198 35 view .LVU466
+	cmpl	$20000, %eax
+	jbe	.L77
+	.loc 1 214 1 view .LVU467
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL151:
+	.loc 1 214 1 view .LVU468
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL152:
+	.loc 1 214 1 view .LVU469
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL153:
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	.cfi_restore_state
+.LBB126:
+.LBB123:
+.LBB120:
+	.loc 1 108 9 is_stmt 1 view .LVU470
+	.loc 1 108 22 is_stmt 0 view .LVU471
+	shrq	$11, %rcx
+	movq	%rcx, %rax
+.LVL154:
+	.loc 1 108 22 view .LVU472
+	mulq	%r13
+.LVL155:
+	.loc 1 108 22 view .LVU473
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	salq	$5, %rax
+	subq	%rdx, %rax
+	salq	$3, %rax
+	subq	%rax, %rdi
+.LVL156:
+	.loc 1 108 18 view .LVU474
+	leaq	8(%rdi), %rcx
+	jmp	.L74
+.LVL157:
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.loc 1 112 5 is_stmt 1 view .LVU475
+	.loc 1 112 21 is_stmt 0 view .LVU476
+	movabsq	$2635249153387079094, %rax
+.LVL158:
+	.loc 1 112 21 view .LVU477
+	shrq	$19, %rcx
+.LVL159:
+	.loc 1 112 21 view .LVU478
+	mulq	%rcx
+.LVL160:
+	.loc 1 112 21 view .LVU479
+	leaq	0(,%rdx,8), %rax
+	subq	%rdx, %rax
+	salq	$11, %rax
+	subq	%rax, %rdi
+.LVL161:
+	.loc 1 112 17 view .LVU480
+	leaq	2048(%rdi), %rcx
+	jmp	.L74
+.LVL162:
+.L82:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 112 17 view .LVU481
+	ret
+.LBE120:
+.LBE123:
+.LBE126:
+	.cfi_endproc
+.LFE39:
+	.size	_bench_aging, .-_bench_aging
+	.p2align 4
+	.type	_bench_fifo, @function
+_bench_fifo:
+.LVL163:
+.LFB38:
+	.loc 1 177 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 178 5 view .LVU483
+	.loc 1 181 5 view .LVU484
+	.loc 1 181 28 view .LVU485
+	.loc 1 181 24 is_stmt 0 view .LVU486
+	movl	16392(%rsi), %eax
+	addl	$2, %eax
+	.loc 1 181 28 view .LVU487
+	cmpl	$20000, %eax
+	ja	.L96
+	.loc 1 177 1 view .LVU488
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+.LBB132:
+.LBB133:
+.LBB134:
+	.loc 1 108 22 view .LVU489
+	movabsq	$2380225041768974403, %r13
+.LBE134:
+.LBE133:
+.LBE132:
+	.loc 1 177 1 view .LVU490
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB145:
+.LBB142:
+.LBB139:
+	.loc 1 104 23 view .LVU491
+	movabsq	$2951479051793528259, %r12
+.LBE139:
+.LBE142:
+.LBE145:
+	.loc 1 177 1 view .LVU492
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 178 14 view .LVU493
+	xorl	%ebx, %ebx
+	.loc 1 177 1 view .LVU494
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	jmp	.L93
+.LVL164:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+.LBB146:
+.LBB143:
+.LBB140:
+	.loc 1 109 12 is_stmt 1 view .LVU495
+	.loc 1 109 15 is_stmt 0 view .LVU496
+	cmpq	$99, %rax
+	je	.L92
+	.loc 1 110 9 is_stmt 1 view .LVU497
+	.loc 1 110 24 is_stmt 0 view .LVU498
+	movabsq	$2635249153387078838, %rax
+.LVL165:
+	.loc 1 110 24 view .LVU499
+	shrq	$16, %rsi
+.LVL166:
+	.loc 1 110 24 view .LVU500
+	mulq	%rsi
+.LVL167:
+	.loc 1 110 24 view .LVU501
+	leaq	0(,%rdx,8), %rdi
+	subq	%rdx, %rdi
+	salq	$8, %rdi
+	subq	%rdi, %rcx
+.LVL168:
+	.loc 1 110 20 view .LVU502
+	addq	$256, %rcx
+.L91:
+.LVL169:
+	.loc 1 110 20 view .LVU503
+.LBE140:
+.LBE143:
+	.loc 1 189 9 view .LVU504
+	movl	%r15d, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	.loc 1 190 13 view .LVU505
+	addl	$1, %ebx
+.LVL170:
+	.loc 1 189 9 view .LVU506
+	call	_bench_alloc
+.LVL171:
+	.loc 1 190 9 is_stmt 1 view .LVU507
+	.loc 1 190 9 is_stmt 0 view .LVU508
+.LBE146:
+	.loc 1 181 28 is_stmt 1 view .LVU509
+	.loc 1 181 24 is_stmt 0 view .LVU510
+	movl	16392(%r14), %eax
+	addl	$2, %eax
+	.loc 1 181 28 view .LVU511
+	cmpl	$20000, %eax
+	ja	.L99
+.LVL172:
+.L93:
+.LBB147:
+	.loc 1 182 9 is_stmt 1 view .LVU512
+	.loc 1 182 18 is_stmt 0 view .LVU513
+	movzbl	%bl, %eax
+	.loc 1 185 12 view .LVU514
+	cmpq	$0, (%r14,%rax,8)
+	.loc 1 182 18 view .LVU515
+	movq	%rax, %r15
+.LVL173:
+	.loc 1 185 9 is_stmt 1 view .LVU516
+	.loc 1 185 12 is_stmt 0 view .LVU517
+	je	.L89
+	.loc 1 186 13 is_stmt 1 view .LVU518
+	movl	%eax, %edx
+	movq	%r14, %rsi
+	movq	%rbp, %rdi
+	call	_bench_free
+.LVL174:
+.L89:
+	.loc 1 189 9 view .LVU519
+.LBB144:
+.LBI133:
+	.loc 1 101 15 view .LVU520
+.LBB141:
+	.loc 1 103 5 view .LVU521
+.LBB135:
+.LBI135:
+	.loc 1 88 17 view .LVU522
+.LBB136:
+	.loc 1 90 5 view .LVU523
+	.loc 1 90 14 is_stmt 0 view .LVU524
+	movq	16432(%r14), %rsi
+.LVL175:
+	.loc 1 91 5 is_stmt 1 view .LVU525
+	.loc 1 91 12 is_stmt 0 view .LVU526
+	movq	%rsi, %rax
+	salq	$13, %rax
+	.loc 1 91 7 view .LVU527
+	xorq	%rax, %rsi
+.LVL176:
+	.loc 1 92 5 is_stmt 1 view .LVU528
+	.loc 1 92 12 is_stmt 0 view .LVU529
+	movq	%rsi, %rax
+	shrq	$7, %rax
+	.loc 1 92 7 view .LVU530
+	xorq	%rax, %rsi
+.LVL177:
+	.loc 1 93 5 is_stmt 1 view .LVU531
+	.loc 1 93 12 is_stmt 0 view .LVU532
+	movq	%rsi, %rax
+	salq	$17, %rax
+	.loc 1 93 7 view .LVU533
+	xorq	%rax, %rsi
+.LVL178:
+	.loc 1 94 5 is_stmt 1 view .LVU534
+.LBE136:
+.LBE135:
+	.loc 1 104 23 is_stmt 0 view .LVU535
+	movq	%rsi, %rdx
+	.loc 1 106 7 view .LVU536
+	movq	%rsi, %rcx
+.LBB138:
+.LBB137:
+	.loc 1 94 18 view .LVU537
+	movq	%rsi, 16432(%r14)
+	.loc 1 95 5 is_stmt 1 view .LVU538
+.LVL179:
+	.loc 1 95 5 is_stmt 0 view .LVU539
+.LBE137:
+.LBE138:
+	.loc 1 104 5 is_stmt 1 view .LVU540
+	.loc 1 104 23 is_stmt 0 view .LVU541
+	shrq	$2, %rdx
+	.loc 1 106 7 view .LVU542
+	shrq	$8, %rcx
+	.loc 1 104 23 view .LVU543
+	movq	%rdx, %rax
+	mulq	%r12
+	movq	%rdx, %rax
+	andq	$-4, %rdx
+	shrq	$2, %rax
+	addq	%rax, %rdx
+	movq	%rsi, %rax
+	leaq	(%rdx,%rdx,4), %rdx
+	salq	$2, %rdx
+	subq	%rdx, %rax
+.LVL180:
+	.loc 1 106 5 is_stmt 1 view .LVU544
+	.loc 1 107 5 view .LVU545
+	.loc 1 107 8 is_stmt 0 view .LVU546
+	cmpq	$89, %rax
+	ja	.L90
+	.loc 1 108 9 is_stmt 1 view .LVU547
+	.loc 1 108 22 is_stmt 0 view .LVU548
+	shrq	$11, %rsi
+	movq	%rsi, %rax
+.LVL181:
+	.loc 1 108 22 view .LVU549
+	mulq	%r13
+.LVL182:
+	.loc 1 108 22 view .LVU550
+	shrq	$2, %rdx
+	movq	%rdx, %rax
+	salq	$5, %rax
+	subq	%rdx, %rax
+	salq	$3, %rax
+	subq	%rax, %rcx
+.LVL183:
+	.loc 1 108 18 view .LVU551
+	addq	$8, %rcx
+	jmp	.L91
+.LVL184:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	.loc 1 112 5 is_stmt 1 view .LVU552
+	.loc 1 112 21 is_stmt 0 view .LVU553
+	movabsq	$2635249153387079094, %rax
+.LVL185:
+	.loc 1 112 21 view .LVU554
+	shrq	$19, %rsi
+.LVL186:
+	.loc 1 112 21 view .LVU555
+	mulq	%rsi
+.LVL187:
+	.loc 1 112 21 view .LVU556
+	leaq	0(,%rdx,8), %rax
+	subq	%rdx, %rax
+	salq	$11, %rax
+	subq	%rax, %rcx
+.LVL188:
+	.loc 1 112 17 view .LVU557
+	addq	$2048, %rcx
+	jmp	.L91
+.LVL189:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.loc 1 112 17 view .LVU558
+.LBE141:
+.LBE144:
+.LBE147:
+	.loc 1 192 1 view .LVU559
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL190:
+	.loc 1 192 1 view .LVU560
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL191:
+	.loc 1 192 1 view .LVU561
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL192:
+	.loc 1 192 1 view .LVU562
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+.LVL193:
+	.loc 1 192 1 view .LVU563
+	ret
+.LVL194:
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.loc 1 192 1 view .LVU564
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	_bench_fifo, .-_bench_fifo
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"Allocator benchmark couldn't allocate its buffers.\n"
+	.align 8
+.LC7:
+	.string	"Allocator benchmark, %d ops per scenario:\n"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"random"
+.LC9:
+	.string	"fifo"
+.LC10:
+	.string	"aging"
+	.text
+	.p2align 4
+	.globl	alloc_benchmark
+	.type	alloc_benchmark, @function
+alloc_benchmark:
+.LFB43:
+	.loc 1 322 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 323 5 view .LVU566
+	.loc 1 325 5 view .LVU567
+	.loc 1 322 1 is_stmt 0 view .LVU568
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 325 24 view .LVU569
+	movl	$20, %edi
+	.loc 1 322 1 view .LVU570
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 325 24 view .LVU571
+	call	kpalloc@PLT
+.LVL195:
+	.loc 1 325 22 view .LVU572
+	movq	%rax, 16384+state.1(%rip)
+	.loc 1 326 5 is_stmt 1 view .LVU573
+	.loc 1 326 8 is_stmt 0 view .LVU574
+	testq	%rax, %rax
+	je	.L112
+	.loc 1 331 5 is_stmt 1 view .LVU575
+	xorl	%esi, %esi
+	leaq	bench_arena(%rip), %rdi
+	call	arena_init@PLT
+.LVL196:
+	.loc 1 334 5 view .LVU576
+	xorl	%eax, %eax
+	call	slob_init@PLT
+.LVL197:
+	.loc 1 335 5 view .LVU577
+.LBB162:
+.LBI162:
+	.loc 1 244 17 view .LVU578
+.LBB163:
+	.loc 1 246 5 view .LVU579
+.LBB164:
+.LBI164:
+	.loc 2 162 24 view .LVU580
+.LBB165:
+	.loc 2 164 5 view .LVU581
+	.loc 2 165 5 view .LVU582
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL198:
+	.loc 2 166 5 view .LVU583
+	.loc 2 166 35 is_stmt 0 view .LVU584
+#NO_APP
+	movl	%eax, %eax
+	.loc 2 166 28 view .LVU585
+	salq	$32, %rdx
+.LBE165:
+.LBE164:
+	.loc 1 247 14 view .LVU586
+	movq	kernel_timer_secs(%rip), %rsi
+.LBB167:
+.LBB166:
+	.loc 2 166 35 view .LVU587
+	orq	%rax, %rdx
+.LBE166:
+.LBE167:
+	.loc 1 246 14 view .LVU588
+	movabsq	$4294967296, %rax
+	leaq	(%rdx,%rax), %rcx
+.LVL199:
+	.loc 1 247 5 is_stmt 1 view .LVU589
+	.loc 1 249 5 view .LVU590
+	.loc 1 249 11 is_stmt 0 view .LVU591
+	jmp	.L102
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.loc 1 250 9 is_stmt 1 view .LVU592
+.LBB168:
+.LBI168:
+	.loc 2 162 24 view .LVU593
+.LBB169:
+	.loc 2 164 5 view .LVU594
+	.loc 2 165 5 view .LVU595
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL200:
+	.loc 2 166 5 view .LVU596
+	.loc 2 166 28 is_stmt 0 view .LVU597
+#NO_APP
+	salq	$32, %rdx
+	.loc 2 166 35 view .LVU598
+	movl	%eax, %eax
+	orq	%rax, %rdx
+.LBE169:
+.LBE168:
+	.loc 1 250 12 view .LVU599
+	cmpq	%rdx, %rcx
+	jb	.L109
+.L102:
+	.loc 1 249 30 is_stmt 1 view .LVU600
+	movq	kernel_timer_secs(%rip), %rax
+	cmpq	%rax, %rsi
+	je	.L104
+	.loc 1 255 5 view .LVU601
+.LBB170:
+.LBI170:
+	.loc 2 162 24 view .LVU602
+.LBB171:
+	.loc 2 164 5 view .LVU603
+	.loc 2 165 5 view .LVU604
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+#NO_APP
+.LBE171:
+.LBE170:
+	.loc 1 256 10 is_stmt 0 view .LVU605
+	movq	kernel_timer_secs(%rip), %rsi
+.LVL201:
+.LBB175:
+.LBB172:
+	.loc 2 165 5 view .LVU606
+	movl	%edx, %edi
+	movl	%eax, %r8d
+.LVL202:
+	.loc 2 166 5 is_stmt 1 view .LVU607
+	.loc 2 166 5 is_stmt 0 view .LVU608
+.LBE172:
+.LBE175:
+	.loc 1 256 5 is_stmt 1 view .LVU609
+	.loc 1 258 5 view .LVU610
+	.loc 1 258 37 is_stmt 0 view .LVU611
+	addq	$10, %rsi
+.LVL203:
+	.loc 1 258 11 view .LVU612
+	jmp	.L105
+.LVL204:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+	.loc 1 259 9 is_stmt 1 view .LVU613
+.LBB176:
+.LBI176:
+	.loc 2 162 24 view .LVU614
+.LBB177:
+	.loc 2 164 5 view .LVU615
+	.loc 2 165 5 view .LVU616
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL205:
+	.loc 2 166 5 view .LVU617
+	.loc 2 166 28 is_stmt 0 view .LVU618
+#NO_APP
+	salq	$32, %rdx
+	.loc 2 166 35 view .LVU619
+	movl	%eax, %eax
+	orq	%rax, %rdx
+.LBE177:
+.LBE176:
+	.loc 1 259 12 view .LVU620
+	cmpq	%rdx, %rcx
+	jb	.L109
+.L105:
+	.loc 1 258 30 is_stmt 1 view .LVU621
+	movq	kernel_timer_secs(%rip), %rax
+	cmpq	%rsi, %rax
+	jb	.L106
+	.loc 1 264 5 view .LVU622
+.LBB178:
+.LBI178:
+	.loc 2 162 24 view .LVU623
+.LBB179:
+	.loc 2 164 5 view .LVU624
+	.loc 2 165 5 view .LVU625
+#APP
+# 165 "src/include/cpu.h" 1
+	rdtsc
+# 0 "" 2
+.LVL206:
+	.loc 2 166 5 view .LVU626
+	.loc 2 166 28 is_stmt 0 view .LVU627
+#NO_APP
+	salq	$32, %rdx
+	.loc 2 166 35 view .LVU628
+	movl	%eax, %eax
+.LBE179:
+.LBE178:
+.LBB181:
+.LBB173:
+	.loc 2 166 28 view .LVU629
+	salq	$32, %rdi
+.LVL207:
+	.loc 2 166 28 view .LVU630
+.LBE173:
+.LBE181:
+.LBB182:
+.LBB180:
+	.loc 2 166 35 view .LVU631
+	orq	%rax, %rdx
+.LBE180:
+.LBE182:
+.LBB183:
+.LBB174:
+	orq	%r8, %rdi
+.LBE174:
+.LBE183:
+	.loc 1 264 30 view .LVU632
+	movabsq	$-3689348814741910323, %rax
+	.loc 1 264 21 view .LVU633
+	subq	%rdi, %rdx
+	.loc 1 264 30 view .LVU634
+	mulq	%rdx
+	shrq	$3, %rdx
+	movq	%rdx, %rbp
+	jmp	.L103
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	.loc 1 251 20 view .LVU635
+	xorl	%ebp, %ebp
+.L103:
+.LVL209:
+	.loc 1 251 20 view .LVU636
+.LBE163:
+.LBE162:
+	.loc 1 337 5 is_stmt 1 view .LVU637
+	movl	$20000, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	leaq	bench_allocators(%rip), %rbx
+	leaq	_bench_random(%rip), %r14
+	call	kprintf@PLT
+.LVL210:
+	.loc 1 339 5 view .LVU638
+.LBB184:
+	.loc 1 339 10 view .LVU639
+	.loc 1 339 26 view .LVU640
+	leaq	96(%rbx), %r15
+	leaq	.LC8(%rip), %r13
+	leaq	_bench_fifo(%rip), %r12
+.LVL211:
+.L107:
+.LBB185:
+	.loc 1 340 9 discriminator 3 view .LVU641
+	.loc 1 342 9 discriminator 3 view .LVU642
+	movq	%rbx, %rdi
+	movq	%rbp, %rcx
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	call	_bench_run.constprop.0
+.LVL212:
+	.loc 1 343 9 discriminator 3 view .LVU643
+	movq	%rbx, %rdi
+	movq	%rbp, %rcx
+	movq	%r12, %rdx
+	leaq	.LC9(%rip), %rsi
+	call	_bench_run.constprop.0
+.LVL213:
+	.loc 1 344 9 discriminator 3 view .LVU644
+	movq	%rbx, %rdi
+	movq	%rbp, %rcx
+	leaq	_bench_aging(%rip), %rdx
+	leaq	.LC10(%rip), %rsi
+.LBE185:
+	.loc 1 339 26 is_stmt 0 discriminator 3 view .LVU645
+	addq	$24, %rbx
+.LVL214:
+.LBB186:
+	.loc 1 344 9 discriminator 3 view .LVU646
+	call	_bench_run.constprop.0
+.LVL215:
+	.loc 1 344 9 discriminator 3 view .LVU647
+.LBE186:
+	.loc 1 339 85 is_stmt 1 discriminator 3 view .LVU648
+	.loc 1 339 26 discriminator 3 view .LVU649
+	cmpq	%r15, %rbx
+	jne	.L107
+.LBE184:
+	.loc 1 347 5 view .LVU650
+	movq	16384+state.1(%rip), %rdi
+	.loc 1 348 1 is_stmt 0 view .LVU651
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL216:
+	.loc 1 348 1 view .LVU652
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL217:
+	.loc 1 348 1 view .LVU653
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 347 5 view .LVU654
+	jmp	kfree@PLT
+.LVL218:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.cfi_restore_state
+	.loc 1 327 9 is_stmt 1 view .LVU655
+	.loc 1 348 1 is_stmt 0 view .LVU656
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	.loc 1 327 9 view .LVU657
+	leaq	.LC6(%rip), %rdi
+	.loc 1 348 1 view .LVU658
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 327 9 view .LVU659
+	jmp	kprintf@PLT
+.LVL219:
+	.cfi_endproc
+.LFE43:
+	.size	alloc_benchmark, .-alloc_benchmark
+	.section	.rodata
+	.align 32
+	.type	gaps.0, @object
+	.size	gaps.0, 44
+gaps.0:
+	.long	8929
+	.long	3905
+	.long	1750
+	.long	701
+	.long	301
+	.long	132
+	.long	57
+	.long	23
+	.long	10
+	.long	4
+	.long	1
+	.local	state.1
+	.comm	state.1,16440,32
+	.section	.rodata.str1.1
+.LC11:
+	.string	"malloc"
+.LC12:
+	.string	"slab"
+.LC13:
+	.string	"slob"
+.LC14:
+	.string	"arena"
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	bench_allocators, @object
+	.size	bench_allocators, 96
+bench_allocators:
+	.quad	.LC11
+	.quad	malloc
+	.quad	free
+	.quad	.LC12
+	.quad	slab_malloc
+	.quad	slab_free
+	.quad	.LC13
+	.quad	slob_malloc
+	.quad	slob_free
+	.quad	.LC14
+	.quad	_bench_arena_alloc
+	.quad	_bench_arena_free
+	.local	bench_arena
+	.comm	bench_arena,32,32
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 5 "src/include/bump.h"
+	.file 6 "src/include/mem.h"
+	.file 7 "src/include/slob.h"
+	.file 8 "src/include/slab.h"
+	.file 9 "src/include/alloc.h"
+	.file 10 "src/include/str.h"
+	.file 11 "src/include/idt.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x13a2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2d
+	.long	.LASF110
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x19
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x9
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x19
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x17
+	.long	0x77
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF10
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x19
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x96
+	.uleb128 0x14
+	.long	0x85
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF13
+	.uleb128 0x19
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x37
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x2f
+	.long	0x9d
+	.uleb128 0x1e
+	.long	.LASF17
+	.byte	0x10
+	.byte	0x5
+	.byte	0x1e
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x18
+	.long	0xd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x20
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0xae
+	.uleb128 0x1e
+	.long	.LASF18
+	.byte	0x20
+	.byte	0x5
+	.byte	0x26
+	.long	0x11b
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x27
+	.byte	0x18
+	.long	0xd5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x28
+	.byte	0xe
+	.long	0x11b
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x29
+	.byte	0xe
+	.long	0x11b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xc
+	.long	0x35
+	.byte	0x18
+	.byte	0
+	.uleb128 0xa
+	.long	0x6b
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF23
+	.uleb128 0x14
+	.long	0x122
+	.uleb128 0xa
+	.long	0x129
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF24
+	.uleb128 0x25
+	.long	.LASF25
+	.value	0x328
+	.byte	0x6
+	.byte	0x97
+	.long	0x240
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x98
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x99
+	.byte	0xe
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x9a
+	.byte	0xe
+	.long	0x9d
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x9b
+	.byte	0xe
+	.long	0x9d
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x6
+	.byte	0x9c
+	.byte	0xe
+	.long	0x9d
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x9d
+	.byte	0xe
+	.long	0x9d
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x9e
+	.byte	0xe
+	.long	0x240
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x6
+	.byte	0x9f
+	.byte	0xe
+	.long	0x9d
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x6
+	.byte	0xa0
+	.byte	0xe
+	.long	0x9d
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x6
+	.byte	0xa1
+	.byte	0xe
+	.long	0x9d
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x6
+	.byte	0xa2
+	.byte	0xe
+	.long	0x9d
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x6
+	.byte	0xa3
+	.byte	0xe
+	.long	0x9d
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x6
+	.byte	0xa4
+	.byte	0xe
+	.long	0x9d
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x6
+	.byte	0xa5
+	.byte	0xe
+	.long	0x9d
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x6
+	.byte	0xa6
+	.byte	0xe
+	.long	0x9d
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x6
+	.byte	0xa7
+	.byte	0xe
+	.long	0x9d
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x6
+	.byte	0xa8
+	.byte	0xe
+	.long	0x9d
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x6
+	.byte	0xa9
+	.byte	0xe
+	.long	0x250
+	.byte	0x90
+	.uleb128 0xd
+	.long	.LASF44
+	.byte	0x6
+	.byte	0xaa
+	.byte	0xe
+	.long	0x260
+	.value	0x290
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x250
+	.uleb128 0x15
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x260
+	.uleb128 0x15
+	.long	0x41
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x270
+	.uleb128 0x15
+	.long	0x41
+	.byte	0x12
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF74
+	.byte	0xb
+	.byte	0x39
+	.byte	0x1a
+	.long	0xa9
+	.uleb128 0x1e
+	.long	.LASF45
+	.byte	0x18
+	.byte	0x1
+	.byte	0x30
+	.long	0x2b0
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x1
+	.byte	0x31
+	.byte	0x11
+	.long	0x12e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x32
+	.byte	0xd
+	.long	0x2c4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x33
+	.byte	0xc
+	.long	0x2d4
+	.byte	0x10
+	.byte	0
+	.uleb128 0x14
+	.long	0x27c
+	.uleb128 0x32
+	.long	0x120
+	.long	0x2c4
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xa
+	.long	0x2b5
+	.uleb128 0x26
+	.long	0x2d4
+	.uleb128 0x4
+	.long	0x120
+	.byte	0
+	.uleb128 0xa
+	.long	0x2c9
+	.uleb128 0x25
+	.long	.LASF49
+	.value	0x4038
+	.byte	0x1
+	.byte	0x36
+	.long	0x364
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x37
+	.byte	0xb
+	.long	0x364
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x38
+	.byte	0xc
+	.long	0x373
+	.value	0x2000
+	.uleb128 0xd
+	.long	.LASF52
+	.byte	0x1
+	.byte	0x39
+	.byte	0xf
+	.long	0x382
+	.value	0x4000
+	.uleb128 0x33
+	.string	"ops"
+	.byte	0x1
+	.byte	0x3a
+	.byte	0xe
+	.long	0x85
+	.value	0x4008
+	.uleb128 0xd
+	.long	.LASF53
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xe
+	.long	0x9d
+	.value	0x4010
+	.uleb128 0xd
+	.long	.LASF54
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xe
+	.long	0x9d
+	.value	0x4018
+	.uleb128 0xd
+	.long	.LASF55
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xe
+	.long	0x9d
+	.value	0x4020
+	.uleb128 0xd
+	.long	.LASF56
+	.byte	0x1
+	.byte	0x3e
+	.byte	0xe
+	.long	0x9d
+	.value	0x4028
+	.uleb128 0xd
+	.long	.LASF57
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xe
+	.long	0x9d
+	.value	0x4030
+	.byte	0
+	.uleb128 0xf
+	.long	0x120
+	.long	0x373
+	.uleb128 0x27
+	.long	0x41
+	.byte	0
+	.uleb128 0xf
+	.long	0x35
+	.long	0x382
+	.uleb128 0x27
+	.long	0x41
+	.byte	0
+	.uleb128 0xa
+	.long	0x85
+	.uleb128 0x1a
+	.long	.LASF58
+	.byte	0x42
+	.byte	0x15
+	.long	0xda
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bench_arena
+	.uleb128 0xf
+	.long	0x2b0
+	.long	0x3ac
+	.uleb128 0x15
+	.long	0x41
+	.byte	0x3
+	.byte	0
+	.uleb128 0x14
+	.long	0x39c
+	.uleb128 0x1a
+	.long	.LASF59
+	.byte	0x4e
+	.byte	0x24
+	.long	0x3ac
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bench_allocators
+	.uleb128 0xe
+	.long	.LASF62
+	.byte	0x5
+	.byte	0x30
+	.long	0x3d7
+	.uleb128 0x4
+	.long	0x3d7
+	.byte	0
+	.uleb128 0xa
+	.long	0xda
+	.uleb128 0x11
+	.long	.LASF60
+	.byte	0x6
+	.byte	0xe1
+	.long	0x120
+	.long	0x3fb
+	.uleb128 0x4
+	.long	0x120
+	.uleb128 0x4
+	.long	0x48
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF61
+	.byte	0x5
+	.byte	0x2e
+	.long	0x120
+	.long	0x415
+	.uleb128 0x4
+	.long	0x3d7
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF63
+	.byte	0x7
+	.byte	0x1a
+	.long	0x426
+	.uleb128 0x4
+	.long	0x120
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF64
+	.byte	0x7
+	.byte	0x19
+	.long	0x120
+	.long	0x43b
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF65
+	.byte	0x8
+	.byte	0x2f
+	.long	0x44c
+	.uleb128 0x4
+	.long	0x120
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF66
+	.byte	0x8
+	.byte	0x2e
+	.long	0x120
+	.long	0x461
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x28
+	.long	0x472
+	.uleb128 0x4
+	.long	0x120
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF67
+	.byte	0x9
+	.byte	0x27
+	.long	0x120
+	.long	0x487
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF68
+	.byte	0x6
+	.byte	0xca
+	.long	0x498
+	.uleb128 0x4
+	.long	0x498
+	.byte	0
+	.uleb128 0xa
+	.long	0x13a
+	.uleb128 0xe
+	.long	.LASF69
+	.byte	0x6
+	.byte	0xd6
+	.long	0x4ae
+	.uleb128 0x4
+	.long	0x120
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF111
+	.byte	0x7
+	.byte	0x18
+	.byte	0x6
+	.long	0x4bc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF70
+	.byte	0x5
+	.byte	0x2d
+	.long	0x4d2
+	.uleb128 0x4
+	.long	0x3d7
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF71
+	.byte	0xa
+	.byte	0x30
+	.long	0x4e4
+	.uleb128 0x4
+	.long	0x12e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF72
+	.byte	0x6
+	.byte	0xbd
+	.long	0x120
+	.long	0x4f9
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF112
+	.byte	0x1
+	.value	0x141
+	.byte	0x6
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84f
+	.uleb128 0x36
+	.long	.LASF73
+	.byte	0x1
+	.value	0x143
+	.byte	0x1e
+	.long	0x2d9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.1
+	.uleb128 0x29
+	.long	.LASF75
+	.value	0x14f
+	.byte	0xe
+	.long	0x9d
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1f
+	.quad	.LBB184
+	.quad	.LBE184-.LBB184
+	.long	0x642
+	.uleb128 0x37
+	.string	"i"
+	.byte	0x1
+	.value	0x153
+	.byte	0x11
+	.long	0x35
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x5
+	.long	.LLRL104
+	.uleb128 0x29
+	.long	.LASF76
+	.value	0x154
+	.byte	0x26
+	.long	0x84f
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x7
+	.quad	.LVL212
+	.long	0x111e
+	.long	0x5bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x20
+	.long	0x86e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.1
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL213
+	.long	0x111e
+	.long	0x5fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x20
+	.long	0x86e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.1
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL215
+	.long	0x111e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_bench_aging
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x20
+	.long	0x86e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0x8f0
+	.quad	.LBI162
+	.byte	.LVU578
+	.quad	.LBB162
+	.quad	.LBE162-.LBB162
+	.value	0x14f
+	.byte	0x1b
+	.long	0x7b8
+	.uleb128 0x2
+	.long	0x901
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x2
+	.long	0x90d
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x2
+	.long	0x919
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0xc
+	.long	0x10f4
+	.quad	.LBI164
+	.byte	.LVU580
+	.long	.LLRL90
+	.byte	0xf6
+	.byte	0x18
+	.long	0x6c7
+	.uleb128 0x5
+	.long	.LLRL90
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	0x10f4
+	.quad	.LBI168
+	.byte	.LVU593
+	.quad	.LBB168
+	.quad	.LBE168-.LBB168
+	.byte	0x1
+	.byte	0xfa
+	.byte	0xd
+	.long	0x707
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.uleb128 0xc
+	.long	0x10f4
+	.quad	.LBI170
+	.byte	.LVU602
+	.long	.LLRL95
+	.byte	0xff
+	.byte	0x16
+	.long	0x740
+	.uleb128 0x5
+	.long	.LLRL95
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0x10f4
+	.quad	.LBI176
+	.byte	.LVU614
+	.quad	.LBB176
+	.quad	.LBE176-.LBB176
+	.value	0x103
+	.byte	0xd
+	.long	0x780
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x39
+	.long	0x10f4
+	.quad	.LBI178
+	.byte	.LVU623
+	.long	.LLRL100
+	.byte	0x1
+	.value	0x108
+	.byte	0xd
+	.uleb128 0x5
+	.long	.LLRL100
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL195
+	.long	0x4e4
+	.long	0x7cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x44
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL196
+	.long	0x4bc
+	.long	0x7f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bench_arena
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL197
+	.long	0x4ae
+	.uleb128 0x7
+	.quad	.LVL210
+	.long	0x4d2
+	.long	0x826
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4e20
+	.byte	0
+	.uleb128 0x3a
+	.quad	.LVL218
+	.long	0x49d
+	.uleb128 0x22
+	.quad	.LVL219
+	.long	0x4d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2b0
+	.uleb128 0x3b
+	.long	.LASF83
+	.byte	0x1
+	.value	0x10b
+	.byte	0xd
+	.byte	0x1
+	.long	0x8d6
+	.uleb128 0x16
+	.long	.LASF76
+	.value	0x10b
+	.byte	0x35
+	.long	0x84f
+	.uleb128 0x16
+	.long	.LASF77
+	.value	0x10b
+	.byte	0x50
+	.long	0x8d6
+	.uleb128 0x16
+	.long	.LASF78
+	.value	0x10b
+	.byte	0x64
+	.long	0x12e
+	.uleb128 0x16
+	.long	.LASF79
+	.value	0x10c
+	.byte	0xc
+	.long	0x8eb
+	.uleb128 0x16
+	.long	.LASF75
+	.value	0x10c
+	.byte	0x52
+	.long	0x9d
+	.uleb128 0x23
+	.long	.LASF80
+	.value	0x121
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x23
+	.long	.LASF81
+	.value	0x134
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x3c
+	.long	0x8c8
+	.uleb128 0x23
+	.long	.LASF82
+	.value	0x118
+	.byte	0x13
+	.long	0x85
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x3d
+	.string	"i"
+	.byte	0x1
+	.value	0x122
+	.byte	0x13
+	.long	0x85
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2d9
+	.uleb128 0x26
+	.long	0x8eb
+	.uleb128 0x4
+	.long	0x84f
+	.uleb128 0x4
+	.long	0x8d6
+	.byte	0
+	.uleb128 0xa
+	.long	0x8db
+	.uleb128 0x2b
+	.long	.LASF84
+	.byte	0x1
+	.byte	0xf4
+	.byte	0x11
+	.long	0x9d
+	.byte	0x1
+	.long	0x926
+	.uleb128 0x13
+	.long	.LASF85
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x13
+	.long	.LASF86
+	.byte	0x1
+	.byte	0xf7
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x13
+	.long	.LASF87
+	.byte	0x1
+	.byte	0xff
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF88
+	.byte	0x1
+	.byte	0xdb
+	.byte	0xd
+	.byte	0x1
+	.long	0x99d
+	.uleb128 0x1b
+	.long	.LASF89
+	.byte	0xdb
+	.byte	0x23
+	.long	0x382
+	.uleb128 0x1b
+	.long	.LASF90
+	.byte	0xdb
+	.byte	0x35
+	.long	0x85
+	.uleb128 0x1a
+	.long	.LASF91
+	.byte	0xde
+	.byte	0x1b
+	.long	0x9ad
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gaps.0
+	.uleb128 0x17
+	.uleb128 0x10
+	.string	"g"
+	.byte	0x1
+	.byte	0xe0
+	.byte	0x11
+	.long	0x35
+	.uleb128 0x17
+	.uleb128 0x10
+	.string	"gap"
+	.byte	0x1
+	.byte	0xe1
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x17
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x1
+	.byte	0xe3
+	.byte	0x17
+	.long	0x85
+	.uleb128 0x17
+	.uleb128 0x13
+	.long	.LASF92
+	.byte	0x1
+	.byte	0xe4
+	.byte	0x16
+	.long	0x85
+	.uleb128 0x10
+	.string	"j"
+	.byte	0x1
+	.byte	0xe5
+	.byte	0x16
+	.long	0x85
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x91
+	.long	0x9ad
+	.uleb128 0x15
+	.long	0x41
+	.byte	0xa
+	.byte	0
+	.uleb128 0x14
+	.long	0x99d
+	.uleb128 0x18
+	.long	.LASF94
+	.byte	0xc2
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb05
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0xc2
+	.byte	0x37
+	.long	0x84f
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0xc2
+	.byte	0x52
+	.long	0x8d6
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xb
+	.long	.LASF93
+	.byte	0xc4
+	.byte	0xe
+	.long	0x85
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x1f
+	.quad	.LBB124
+	.quad	.LBE124-.LBB124
+	.long	0xa50
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0xc7
+	.byte	0x17
+	.long	0x85
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x12
+	.quad	.LVL129
+	.long	0xd7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LLRL64
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0xce
+	.byte	0x17
+	.long	0x85
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xc
+	.long	0x101b
+	.quad	.LBI112
+	.byte	.LVU420
+	.long	.LLRL66
+	.byte	0xd0
+	.byte	0x34
+	.long	0xae3
+	.uleb128 0x8
+	.long	0x102a
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x5
+	.long	.LLRL66
+	.uleb128 0x2
+	.long	0x1035
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x2
+	.long	0x103f
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1c
+	.long	0x104c
+	.quad	.LBI114
+	.byte	.LVU422
+	.long	.LLRL70
+	.byte	0x67
+	.byte	0x12
+	.uleb128 0x8
+	.long	0x105b
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x5
+	.long	.LLRL70
+	.uleb128 0x2
+	.long	0x1066
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL147
+	.long	0xe67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF95
+	.byte	0xb0
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc33
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0xb0
+	.byte	0x36
+	.long	0x84f
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0xb0
+	.byte	0x51
+	.long	0x8d6
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0xb
+	.long	.LASF96
+	.byte	0xb2
+	.byte	0xe
+	.long	0x85
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x5
+	.long	.LLRL77
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0xb6
+	.byte	0x12
+	.long	0x85
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0xc
+	.long	0x101b
+	.quad	.LBI133
+	.byte	.LVU520
+	.long	.LLRL79
+	.byte	0xbd
+	.byte	0x9
+	.long	0xbed
+	.uleb128 0x8
+	.long	0x102a
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x5
+	.long	.LLRL79
+	.uleb128 0x2
+	.long	0x1035
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x2
+	.long	0x103f
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1c
+	.long	0x104c
+	.quad	.LBI135
+	.byte	.LVU522
+	.long	.LLRL83
+	.byte	0x67
+	.byte	0x12
+	.uleb128 0x8
+	.long	0x105b
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x5
+	.long	.LLRL83
+	.uleb128 0x2
+	.long	0x1066
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL171
+	.long	0xe67
+	.long	0xc11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL174
+	.long	0xd7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF97
+	.byte	0xa3
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd7b
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0xa3
+	.byte	0x38
+	.long	0x84f
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0xa3
+	.byte	0x53
+	.long	0x8d6
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x5
+	.long	.LLRL28
+	.uleb128 0xb
+	.long	.LASF82
+	.byte	0xa6
+	.byte	0x12
+	.long	0x85
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xc
+	.long	0x101b
+	.quad	.LBI55
+	.byte	.LVU159
+	.long	.LLRL30
+	.byte	0xab
+	.byte	0xd
+	.long	0xd08
+	.uleb128 0x8
+	.long	0x102a
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x5
+	.long	.LLRL30
+	.uleb128 0x2
+	.long	0x1035
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x2
+	.long	0x103f
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1c
+	.long	0x104c
+	.quad	.LBI57
+	.byte	.LVU161
+	.long	.LLRL34
+	.byte	0x67
+	.byte	0x12
+	.uleb128 0x8
+	.long	0x105b
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x5
+	.long	.LLRL34
+	.uleb128 0x2
+	.long	0x1066
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x104c
+	.quad	.LBI63
+	.byte	.LVU137
+	.long	.LLRL37
+	.byte	0xa6
+	.byte	0x19
+	.long	0xd41
+	.uleb128 0x8
+	.long	0x105b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x5
+	.long	.LLRL37
+	.uleb128 0x2
+	.long	0x1066
+	.long	.LLST39
+	.long	.LVUS39
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL41
+	.long	0xd7b
+	.long	0xd5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x12
+	.quad	.LVL61
+	.long	0xe67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF98
+	.byte	0x1
+	.byte	0x98
+	.byte	0xd
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe67
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0x98
+	.byte	0x36
+	.long	0x84f
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x98
+	.byte	0x51
+	.long	0x8d6
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	.LASF82
+	.byte	0x98
+	.byte	0x62
+	.long	0x85
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xb
+	.long	.LASF87
+	.byte	0x9a
+	.byte	0xe
+	.long	0x9d
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x24
+	.string	"end"
+	.byte	0x9c
+	.byte	0xe
+	.long	0x9d
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xc
+	.long	0x10f4
+	.quad	.LBI26
+	.byte	.LVU5
+	.long	.LLRL5
+	.byte	0x9a
+	.byte	0x16
+	.long	0xe31
+	.uleb128 0x5
+	.long	.LLRL5
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x10f4
+	.quad	.LBI32
+	.byte	.LVU21
+	.long	.LLRL8
+	.byte	0x9c
+	.byte	0x14
+	.uleb128 0x5
+	.long	.LLRL8
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF99
+	.byte	0x7d
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfd4
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0x7d
+	.byte	0x37
+	.long	0x84f
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x7d
+	.byte	0x52
+	.long	0x8d6
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	.LASF82
+	.byte	0x7d
+	.byte	0x63
+	.long	0x85
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	.LASF100
+	.byte	0x7d
+	.byte	0x70
+	.long	0x35
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.long	.LASF87
+	.byte	0x7f
+	.byte	0xe
+	.long	0x9d
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x24
+	.string	"ptr"
+	.byte	0x80
+	.byte	0xb
+	.long	0x120
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x24
+	.string	"end"
+	.byte	0x81
+	.byte	0xe
+	.long	0x9d
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1f
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.long	0xf51
+	.uleb128 0xb
+	.long	.LASF27
+	.byte	0x92
+	.byte	0x12
+	.long	0x9d
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xb
+	.long	.LASF101
+	.byte	0x93
+	.byte	0x12
+	.long	0x9d
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x21
+	.quad	.LVL33
+	.long	0xfd4
+	.byte	0
+	.uleb128 0xc
+	.long	0x10f4
+	.quad	.LBI36
+	.byte	.LVU59
+	.long	.LLRL18
+	.byte	0x7f
+	.byte	0x16
+	.long	0xf8a
+	.uleb128 0x5
+	.long	.LLRL18
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x10f4
+	.quad	.LBI42
+	.byte	.LVU75
+	.long	.LLRL21
+	.byte	0x81
+	.byte	0x14
+	.long	0xfc3
+	.uleb128 0x5
+	.long	.LLRL21
+	.uleb128 0x2
+	.long	0x1105
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x2
+	.long	0x1111
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.quad	.LVL20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF102
+	.byte	0x1
+	.byte	0x76
+	.byte	0x11
+	.long	0x9d
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x101b
+	.uleb128 0x1a
+	.long	.LASF103
+	.byte	0x78
+	.byte	0x17
+	.long	0x13a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -824
+	.uleb128 0x12
+	.quad	.LVL14
+	.long	0x487
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -824
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF105
+	.byte	0x65
+	.byte	0xf
+	.long	0x35
+	.long	0x104c
+	.uleb128 0x1b
+	.long	.LASF77
+	.byte	0x65
+	.byte	0x2e
+	.long	0x8d6
+	.uleb128 0x10
+	.string	"r"
+	.byte	0x1
+	.byte	0x67
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x13
+	.long	.LASF104
+	.byte	0x1
+	.byte	0x68
+	.byte	0xe
+	.long	0x85
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF106
+	.byte	0x58
+	.byte	0x11
+	.long	0x9d
+	.long	0x1071
+	.uleb128 0x1b
+	.long	.LASF77
+	.byte	0x58
+	.byte	0x30
+	.long	0x8d6
+	.uleb128 0x10
+	.string	"x"
+	.byte	0x1
+	.byte	0x5a
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF107
+	.byte	0x49
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x109c
+	.uleb128 0x42
+	.string	"ptr"
+	.byte	0x1
+	.byte	0x49
+	.byte	0x25
+	.long	0x120
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF113
+	.byte	0x1
+	.byte	0x44
+	.byte	0xe
+	.long	0x120
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10f4
+	.uleb128 0x6
+	.long	.LASF100
+	.byte	0x44
+	.byte	0x28
+	.long	0x35
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x22
+	.quad	.LVL77
+	.long	0x3fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bench_arena
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF108
+	.byte	0x2
+	.byte	0xa2
+	.byte	0x18
+	.long	0x9d
+	.byte	0x3
+	.long	0x111e
+	.uleb128 0x10
+	.string	"low"
+	.byte	0x2
+	.byte	0xa4
+	.byte	0xe
+	.long	0x85
+	.uleb128 0x13
+	.long	.LASF109
+	.byte	0x2
+	.byte	0xa4
+	.byte	0x13
+	.long	0x85
+	.byte	0
+	.uleb128 0x44
+	.long	0x854
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x8
+	.long	0x862
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x8
+	.long	0x87a
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x8
+	.long	0x886
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x8
+	.long	0x892
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.long	0x89e
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x2
+	.long	0x8aa
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x45
+	.long	0x86e
+	.uleb128 0xa
+	.byte	0x3
+	.quad	state.1
+	.byte	0x9f
+	.uleb128 0x46
+	.long	0x8b6
+	.quad	.LBB82
+	.quad	.LBE82-.LBB82
+	.long	0x11ba
+	.uleb128 0x2
+	.long	0x8bb
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x47
+	.long	0x8c8
+	.long	.LLRL48
+	.long	0x11d5
+	.uleb128 0x2
+	.long	0x8c9
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x48
+	.long	0x926
+	.quad	.LBI87
+	.byte	.LVU282
+	.long	.LLRL50
+	.byte	0x1
+	.value	0x126
+	.byte	0x5
+	.long	0x1279
+	.uleb128 0x8
+	.long	0x93e
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x8
+	.long	0x933
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x5
+	.long	.LLRL50
+	.uleb128 0x1d
+	.long	0x95e
+	.long	.LLRL50
+	.uleb128 0x2
+	.long	0x95f
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x1d
+	.long	0x969
+	.long	.LLRL54
+	.uleb128 0x2
+	.long	0x96a
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1d
+	.long	0x976
+	.long	.LLRL56
+	.uleb128 0x2
+	.long	0x977
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1d
+	.long	0x981
+	.long	.LLRL58
+	.uleb128 0x2
+	.long	0x982
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x2
+	.long	0x98e
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL82
+	.long	0x3dc
+	.long	0x129d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2000
+	.byte	0
+	.uleb128 0x21
+	.quad	.LVL83
+	.long	0xfd4
+	.uleb128 0x49
+	.quad	.LVL84
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.long	0x12c7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL89
+	.long	0x3c6
+	.long	0x12e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bench_arena
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL110
+	.long	0x4d2
+	.long	0x130d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL111
+	.long	0x4d2
+	.long	0x132c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL112
+	.long	0x4d2
+	.long	0x134b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x4a
+	.quad	.LVL116
+	.long	0x4d2
+	.long	0x136a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL117
+	.long	0x4d2
+	.long	0x1389
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL124
+	.long	0x4d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x80
+	.uleb128 0x13
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 1023
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS86:
+	.uleb128 .LVU636
+	.uleb128 .LVU653
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU640
+	.uleb128 .LVU641
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU642
+	.uleb128 .LVU646
+	.uleb128 .LVU646
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU652
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL215-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU589
+	.uleb128 .LVU636
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU590
+	.uleb128 .LVU606
+	.uleb128 .LVU610
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU635
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -10
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU608
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 .LVU630
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x78
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x15
+	.byte	0x75
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x78
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU583
+	.uleb128 .LVU584
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU583
+	.uleb128 .LVU584
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU596
+	.uleb128 .LVU597
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU596
+	.uleb128 .LVU597
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU607
+	.uleb128 .LVU608
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU607
+	.uleb128 .LVU608
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU617
+	.uleb128 .LVU618
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU617
+	.uleb128 .LVU618
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU392
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU465
+	.uleb128 .LVU470
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU403
+	.uleb128 .LVU411
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU414
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU416
+	.uleb128 .LVU417
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU459
+	.uleb128 .LVU470
+	.uleb128 .LVU481
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU420
+	.uleb128 .LVU455
+	.uleb128 .LVU470
+	.uleb128 .LVU481
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 .LVU445
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU455
+	.uleb128 .LVU470
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU481
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU444
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU453
+	.uleb128 .LVU470
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU473
+	.uleb128 .LVU475
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU479
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU422
+	.uleb128 .LVU439
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU425
+	.uleb128 .LVU439
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU484
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU560
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LFE38-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU495
+	.uleb128 .LVU512
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU563
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU495
+	.uleb128 .LVU503
+	.uleb128 .LVU520
+	.uleb128 .LVU558
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU495
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU539
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU558
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU495
+	.uleb128 .LVU499
+	.uleb128 .LVU499
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU501
+	.uleb128 .LVU544
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU552
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU556
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU522
+	.uleb128 .LVU539
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU525
+	.uleb128 .LVU539
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE37-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU134
+	.uleb128 .LVU155
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU159
+	.uleb128 .LVU193
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU177
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU201
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 16432
+	.byte	0x6
+	.byte	0x38
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU182
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU191
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU205
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU211
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 16432
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU161
+	.uleb128 .LVU177
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU163
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU177
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU137
+	.uleb128 .LVU153
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU140
+	.uleb128 .LVU153
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU47
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU30
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU35
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU11
+	.uleb128 .LVU18
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU24
+	.uleb128 .LVU30
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2000
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2000
+	.byte	0x4
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU70
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU111
+	.uleb128 .LVU112
+	.uleb128 .LVU125
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU74
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU116
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU84
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU89
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU116
+	.uleb128 .LVU119
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU120
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU64
+	.uleb128 .LVU70
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU78
+	.uleb128 .LVU84
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU263
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU281
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU345
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU366
+	.uleb128 .LVU379
+	.uleb128 .LVU387
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0xd
+	.byte	0x3
+	.quad	state.1+16424
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL124-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU251
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU260
+	.uleb128 .LVU260
+	.uleb128 .LVU272
+	.uleb128 .LVU387
+	.uleb128 .LVU389
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0xf
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	state.1
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	state.1
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	state.1+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x11
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3
+	.quad	state.1+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU265
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU278
+	.uleb128 .LVU387
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU282
+	.uleb128 .LVU321
+	.uleb128 .LVU371
+	.uleb128 .LVU379
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU282
+	.uleb128 .LVU321
+	.uleb128 .LVU371
+	.uleb128 .LVU379
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.1+16384
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.1+16384
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU286
+	.uleb128 .LVU287
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU289
+	.uleb128 .LVU320
+	.uleb128 .LVU371
+	.uleb128 .LVU379
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU291
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU316
+	.uleb128 .LVU371
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU379
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU295
+	.uleb128 .LVU316
+	.uleb128 .LVU371
+	.uleb128 .LVU379
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU296
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU301
+	.uleb128 .LVU304
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU309
+	.uleb128 .LVU371
+	.uleb128 .LVU379
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB31-.Ltext0
+	.uleb128 .LBE31-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0
+.LLRL54:
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB92-.Ltext0
+	.uleb128 .LBE92-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB93-.Ltext0
+	.uleb128 .LBE93-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF19:
+	.string	"pChunks"
+.LASF90:
+	.string	"count"
+.LASF67:
+	.string	"malloc"
+.LASF106:
+	.string	"_bench_rand"
+.LASF15:
+	.string	"pNext"
+.LASF41:
+	.string	"desc_chunks"
+.LASF50:
+	.string	"pSlots"
+.LASF29:
+	.string	"zero_pool_pages"
+.LASF8:
+	.string	"size_t"
+.LASF105:
+	.string	"_bench_size"
+.LASF14:
+	.string	"uint64_t"
+.LASF111:
+	.string	"slob_init"
+.LASF16:
+	.string	"pages"
+.LASF98:
+	.string	"_bench_free"
+.LASF26:
+	.string	"total_pages"
+.LASF48:
+	.string	"free"
+.LASF20:
+	.string	"pCursor"
+.LASF17:
+	.string	"ArenaChunk"
+.LASF58:
+	.string	"bench_arena"
+.LASF4:
+	.string	"long long int"
+.LASF6:
+	.string	"signed char"
+.LASF69:
+	.string	"kfree"
+.LASF18:
+	.string	"Arena"
+.LASF86:
+	.string	"tick"
+.LASF33:
+	.string	"allocs"
+.LASF66:
+	.string	"slab_malloc"
+.LASF78:
+	.string	"pScenario"
+.LASF73:
+	.string	"state"
+.LASF2:
+	.string	"long int"
+.LASF38:
+	.string	"compact_pages_migrated"
+.LASF103:
+	.string	"stats"
+.LASF83:
+	.string	"_bench_run"
+.LASF84:
+	.string	"_bench_tsc_per_ms"
+.LASF63:
+	.string	"slob_free"
+.LASF22:
+	.string	"chunk_pages"
+.LASF64:
+	.string	"slob_malloc"
+.LASF46:
+	.string	"pName"
+.LASF34:
+	.string	"frees"
+.LASF31:
+	.string	"zero_pool_misses"
+.LASF94:
+	.string	"_bench_aging"
+.LASF62:
+	.string	"arena_destroy"
+.LASF36:
+	.string	"compact_runs"
+.LASF99:
+	.string	"_bench_alloc"
+.LASF92:
+	.string	"value"
+.LASF110:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF28:
+	.string	"pcp_pages"
+.LASF13:
+	.string	"unsigned int"
+.LASF91:
+	.string	"gaps"
+.LASF21:
+	.string	"pEnd"
+.LASF57:
+	.string	"seed"
+.LASF113:
+	.string	"_bench_arena_alloc"
+.LASF3:
+	.string	"long unsigned int"
+.LASF85:
+	.string	"timeout"
+.LASF43:
+	.string	"free_runs"
+.LASF54:
+	.string	"peak_live_bytes"
+.LASF52:
+	.string	"pLatencies"
+.LASF104:
+	.string	"pick"
+.LASF100:
+	.string	"size"
+.LASF11:
+	.string	"short unsigned int"
+.LASF37:
+	.string	"compact_successes"
+.LASF56:
+	.string	"peak_used_pages"
+.LASF59:
+	.string	"bench_allocators"
+.LASF82:
+	.string	"slot"
+.LASF74:
+	.string	"kernel_timer_secs"
+.LASF70:
+	.string	"arena_init"
+.LASF55:
+	.string	"start_free_pages"
+.LASF5:
+	.string	"long double"
+.LASF42:
+	.string	"largest_free_run"
+.LASF88:
+	.string	"_bench_sort"
+.LASF76:
+	.string	"pAlloc"
+.LASF44:
+	.string	"free_blocks"
+.LASF32:
+	.string	"zone_free_pages"
+.LASF72:
+	.string	"kpalloc"
+.LASF101:
+	.string	"used"
+.LASF112:
+	.string	"alloc_benchmark"
+.LASF27:
+	.string	"free_pages"
+.LASF24:
+	.string	"_Bool"
+.LASF10:
+	.string	"unsigned char"
+.LASF77:
+	.string	"pState"
+.LASF53:
+	.string	"live_bytes"
+.LASF7:
+	.string	"short int"
+.LASF80:
+	.string	"cycles"
+.LASF61:
+	.string	"arena_alloc"
+.LASF40:
+	.string	"desc_pages"
+.LASF93:
+	.string	"round"
+.LASF107:
+	.string	"_bench_arena_free"
+.LASF96:
+	.string	"head"
+.LASF12:
+	.string	"uint32_t"
+.LASF65:
+	.string	"slab_free"
+.LASF108:
+	.string	"rdtsc"
+.LASF23:
+	.string	"char"
+.LASF45:
+	.string	"BenchAllocator"
+.LASF97:
+	.string	"_bench_random"
+.LASF109:
+	.string	"high"
+.LASF47:
+	.string	"alloc"
+.LASF102:
+	.string	"_bench_free_pages"
+.LASF79:
+	.string	"scenario"
+.LASF95:
+	.string	"_bench_fifo"
+.LASF25:
+	.string	"kmem_stats"
+.LASF60:
+	.string	"memset"
+.LASF68:
+	.string	"kmem_get_stats"
+.LASF9:
+	.string	"uint8_t"
+.LASF89:
+	.string	"pValues"
+.LASF81:
+	.string	"used_bytes"
+.LASF71:
+	.string	"kprintf"
+.LASF35:
+	.string	"alloc_failures"
+.LASF51:
+	.string	"sizes"
+.LASF39:
+	.string	"color_pages"
+.LASF87:
+	.string	"start"
+.LASF30:
+	.string	"zero_pool_hits"
+.LASF49:
+	.string	"BenchState"
+.LASF75:
+	.string	"tsc_per_ms"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc/allocbench.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
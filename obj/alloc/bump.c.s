@@ -0,0 +1,2606 @@
+	.file	"bump.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc/bump.c"
+	.p2align 4
+	.globl	arena_init
+	.type	arena_init, @function
+arena_init:
+.LVL0:
+.LFB2:
+	.file 1 "src/alloc/bump.c"
+	.loc 1 82 1 view -0
+	.cfi_startproc
+	.loc 1 83 5 view .LVU1
+	.loc 1 86 53 is_stmt 0 view .LVU2
+	testq	%rsi, %rsi
+	movl	$4, %eax
+	.loc 1 83 21 view .LVU3
+	movq	$0, (%rdi)
+	.loc 1 84 5 is_stmt 1 view .LVU4
+	.loc 1 86 53 is_stmt 0 view .LVU5
+	cmove	%rax, %rsi
+.LVL1:
+	.loc 1 84 21 view .LVU6
+	movq	$0, 8(%rdi)
+	.loc 1 85 5 is_stmt 1 view .LVU7
+	.loc 1 85 18 is_stmt 0 view .LVU8
+	movq	$0, 16(%rdi)
+	.loc 1 86 5 is_stmt 1 view .LVU9
+	.loc 1 86 25 is_stmt 0 view .LVU10
+	movq	%rsi, 24(%rdi)
+	.loc 1 87 1 view .LVU11
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	arena_init, .-arena_init
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Arena allocation of %lu bytes failed.\n"
+	.text
+	.p2align 4
+	.globl	arena_alloc
+	.type	arena_alloc, @function
+arena_alloc:
+.LVL2:
+.LFB3:
+	.loc 1 93 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 94 5 view .LVU13
+	.loc 1 93 1 is_stmt 0 view .LVU14
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	.loc 1 94 38 view .LVU15
+	movl	$1, %eax
+	.loc 1 93 1 view .LVU16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 94 38 view .LVU17
+	testq	%rsi, %rsi
+	.loc 1 96 39 view .LVU18
+	movq	16(%rdi), %rdx
+	.loc 1 94 38 view .LVU19
+	cmovne	%rsi, %rax
+	movq	%rax, %rbx
+	.loc 1 96 47 view .LVU20
+	movq	8(%rdi), %rax
+	.loc 1 94 53 view .LVU21
+	addq	$15, %rbx
+	.loc 1 94 10 view .LVU22
+	andq	$-16, %rbx
+.LVL3:
+	.loc 1 96 5 is_stmt 1 view .LVU23
+	.loc 1 96 39 is_stmt 0 view .LVU24
+	subq	%rax, %rdx
+	.loc 1 96 8 view .LVU25
+	cmpq	%rbx, %rdx
+	jnb	.L15
+	.loc 1 102 5 is_stmt 1 view .LVU26
+	.loc 1 102 100 is_stmt 0 view .LVU27
+	leaq	4111(%rbx), %r12
+	.loc 1 104 24 view .LVU28
+	movq	24(%rdi), %rax
+	.loc 1 102 12 view .LVU29
+	shrq	$12, %r12
+.LVL4:
+	.loc 1 104 5 is_stmt 1 view .LVU30
+	.loc 1 104 8 is_stmt 0 view .LVU31
+	cmpq	%r12, %rax
+	jnb	.L7
+	.loc 1 104 47 discriminator 1 view .LVU32
+	movq	(%rdi), %r13
+	.loc 1 104 38 discriminator 1 view .LVU33
+	testq	%r13, %r13
+	je	.L7
+.LBB20:
+	.loc 1 106 9 is_stmt 1 view .LVU34
+.LVL5:
+.LBB21:
+.LBI21:
+	.loc 1 45 27 view .LVU35
+.LBB22:
+	.loc 1 47 5 view .LVU36
+	.loc 1 47 53 is_stmt 0 view .LVU37
+	movq	%r12, %rdi
+.LVL6:
+	.loc 1 47 53 view .LVU38
+	call	kpalloc@PLT
+.LVL7:
+	.loc 1 48 5 is_stmt 1 view .LVU39
+	.loc 1 48 8 is_stmt 0 view .LVU40
+	testq	%rax, %rax
+	je	.L16
+	.loc 1 52 5 is_stmt 1 view .LVU41
+	.loc 1 58 30 is_stmt 0 view .LVU42
+	movq	0(%r13), %rdx
+	.loc 1 52 19 view .LVU43
+	movq	%r12, 8(%rax)
+	.loc 1 54 5 is_stmt 1 view .LVU44
+	.loc 1 58 9 view .LVU45
+	.loc 1 58 23 is_stmt 0 view .LVU46
+	movq	%rdx, (%rax)
+	.loc 1 59 9 is_stmt 1 view .LVU47
+	.loc 1 59 22 is_stmt 0 view .LVU48
+	movq	%rax, 0(%r13)
+.LVL8:
+	.loc 1 59 22 view .LVU49
+.LBE22:
+.LBE21:
+	.loc 1 107 9 is_stmt 1 view .LVU50
+	.loc 1 112 9 view .LVU51
+	.loc 1 112 33 is_stmt 0 view .LVU52
+	addq	$16, %rax
+.LVL9:
+.L4:
+	.loc 1 112 33 view .LVU53
+.LBE20:
+	.loc 1 126 1 view .LVU54
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL10:
+	.loc 1 126 1 view .LVU55
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL11:
+	.loc 1 126 1 view .LVU56
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.cfi_restore_state
+	.loc 1 115 5 is_stmt 1 view .LVU57
+	.loc 1 115 33 is_stmt 0 view .LVU58
+	cmpq	%r12, %rax
+	cmovnb	%rax, %r12
+.LVL13:
+.LBB23:
+.LBI23:
+	.loc 1 45 27 is_stmt 1 view .LVU59
+.LBB24:
+	.loc 1 47 5 view .LVU60
+	.loc 1 47 53 is_stmt 0 view .LVU61
+	movq	%r12, %rdi
+.LVL14:
+	.loc 1 47 53 view .LVU62
+	call	kpalloc@PLT
+.LVL15:
+	movq	%rax, %rdx
+.LVL16:
+	.loc 1 48 5 is_stmt 1 view .LVU63
+	.loc 1 48 8 is_stmt 0 view .LVU64
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 52 5 is_stmt 1 view .LVU65
+	.loc 1 52 19 is_stmt 0 view .LVU66
+	movq	%r12, 8(%rax)
+	.loc 1 54 5 is_stmt 1 view .LVU67
+	.loc 1 55 9 view .LVU68
+	.loc 1 55 23 is_stmt 0 view .LVU69
+	movq	0(%rbp), %rax
+.LVL17:
+	.loc 1 55 23 view .LVU70
+.LBE24:
+.LBE23:
+	.loc 1 123 53 view .LVU71
+	salq	$12, %r12
+.LVL18:
+.LBB27:
+.LBB25:
+	.loc 1 55 23 view .LVU72
+	movq	%rax, (%rdx)
+	.loc 1 56 9 is_stmt 1 view .LVU73
+.LBE25:
+.LBE27:
+	.loc 1 121 14 is_stmt 0 view .LVU74
+	leaq	16(%rdx), %rax
+.LBB28:
+.LBB26:
+	.loc 1 56 25 view .LVU75
+	movq	%rdx, 0(%rbp)
+.LVL19:
+	.loc 1 56 25 view .LVU76
+.LBE26:
+.LBE28:
+	.loc 1 116 5 is_stmt 1 view .LVU77
+	.loc 1 121 5 view .LVU78
+	.loc 1 122 5 view .LVU79
+	.loc 1 122 27 is_stmt 0 view .LVU80
+	addq	%rax, %rbx
+.LVL20:
+	.loc 1 123 37 view .LVU81
+	addq	%r12, %rdx
+.LVL21:
+	.loc 1 122 27 view .LVU82
+	movq	%rbx, 8(%rbp)
+	.loc 1 123 5 is_stmt 1 view .LVU83
+	.loc 1 123 37 is_stmt 0 view .LVU84
+	movq	%rdx, 16(%rbp)
+	.loc 1 125 5 is_stmt 1 view .LVU85
+	.loc 1 126 1 is_stmt 0 view .LVU86
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL22:
+	.loc 1 126 1 view .LVU87
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+.LBB29:
+	.loc 1 97 9 is_stmt 1 view .LVU88
+	.loc 1 98 9 view .LVU89
+	.loc 1 98 25 is_stmt 0 view .LVU90
+	addq	%rax, %rbx
+.LVL24:
+	.loc 1 98 25 view .LVU91
+	movq	%rbx, 8(%rdi)
+	.loc 1 99 9 is_stmt 1 view .LVU92
+.LBE29:
+	.loc 1 126 1 is_stmt 0 view .LVU93
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.cfi_restore_state
+	.loc 1 116 5 is_stmt 1 view .LVU94
+	.loc 1 117 9 view .LVU95
+	xorl	%eax, %eax
+	movq	%rbx, %rsi
+	leaq	.LC0(%rip), %rdi
+	call	kprintf@PLT
+.LVL26:
+	.loc 1 118 9 view .LVU96
+.LBB30:
+	.loc 1 109 19 is_stmt 0 view .LVU97
+	xorl	%eax, %eax
+	jmp	.L4
+.LVL27:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 107 9 is_stmt 1 view .LVU98
+	.loc 1 108 13 view .LVU99
+	movq	%rbx, %rsi
+	leaq	.LC0(%rip), %rdi
+	call	kprintf@PLT
+.LVL28:
+	.loc 1 109 13 view .LVU100
+	.loc 1 109 19 is_stmt 0 view .LVU101
+	xorl	%eax, %eax
+	jmp	.L4
+.LBE30:
+	.cfi_endproc
+.LFE3:
+	.size	arena_alloc, .-arena_alloc
+	.p2align 4
+	.globl	arena_reset
+	.type	arena_reset, @function
+arena_reset:
+.LVL29:
+.LFB4:
+	.loc 1 133 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 134 5 view .LVU103
+	.loc 1 133 1 is_stmt 0 view .LVU104
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 134 24 view .LVU105
+	movq	(%rdi), %rbp
+.LVL30:
+	.loc 1 135 5 is_stmt 1 view .LVU106
+	.loc 1 135 8 is_stmt 0 view .LVU107
+	testq	%rbp, %rbp
+	je	.L18
+	.loc 1 139 5 view .LVU108
+	movq	0(%rbp), %rbx
+	movq	%rdi, %r12
+	.loc 1 139 5 is_stmt 1 view .LVU109
+.LVL31:
+.LBB31:
+.LBI31:
+	.loc 1 68 13 view .LVU110
+.LBB32:
+	.loc 1 70 5 view .LVU111
+	.loc 1 70 19 view .LVU112
+	testq	%rbx, %rbx
+	je	.L20
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+.LBB33:
+	.loc 1 71 9 view .LVU113
+	movq	%rbx, %rdi
+	.loc 1 71 28 is_stmt 0 view .LVU114
+	movq	(%rbx), %rbx
+.LVL33:
+	.loc 1 72 9 is_stmt 1 view .LVU115
+	call	kfree@PLT
+.LVL34:
+	.loc 1 73 9 view .LVU116
+	.loc 1 73 9 is_stmt 0 view .LVU117
+.LBE33:
+	.loc 1 70 19 is_stmt 1 view .LVU118
+	testq	%rbx, %rbx
+	jne	.L21
+.LVL35:
+.L20:
+	.loc 1 70 19 is_stmt 0 view .LVU119
+.LBE32:
+.LBE31:
+	.loc 1 140 5 is_stmt 1 view .LVU120
+	.loc 1 142 40 is_stmt 0 view .LVU121
+	leaq	16(%rbp), %rax
+	.loc 1 140 19 view .LVU122
+	movq	$0, 0(%rbp)
+	.loc 1 142 5 is_stmt 1 view .LVU123
+	.loc 1 142 40 is_stmt 0 view .LVU124
+	movq	%rax, 8(%r12)
+	.loc 1 143 5 is_stmt 1 view .LVU125
+	.loc 1 143 53 is_stmt 0 view .LVU126
+	movq	8(%rbp), %rax
+	salq	$12, %rax
+	.loc 1 143 37 view .LVU127
+	addq	%rax, %rbp
+.LVL36:
+	.loc 1 143 37 view .LVU128
+	movq	%rbp, 16(%r12)
+.LVL37:
+.L18:
+	.loc 1 144 1 view .LVU129
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	arena_reset, .-arena_reset
+	.p2align 4
+	.globl	arena_destroy
+	.type	arena_destroy, @function
+arena_destroy:
+.LVL38:
+.LFB5:
+	.loc 1 151 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 152 5 view .LVU131
+	.loc 1 151 1 is_stmt 0 view .LVU132
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 152 5 view .LVU133
+	movq	(%rdi), %rbx
+.LVL39:
+.LBB34:
+.LBI34:
+	.loc 1 68 13 is_stmt 1 view .LVU134
+.LBB35:
+	.loc 1 70 5 view .LVU135
+	.loc 1 70 19 view .LVU136
+	testq	%rbx, %rbx
+	je	.L31
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+.LBB36:
+	.loc 1 71 9 view .LVU137
+	movq	%rbx, %rdi
+	.loc 1 71 28 is_stmt 0 view .LVU138
+	movq	(%rbx), %rbx
+.LVL41:
+	.loc 1 72 9 is_stmt 1 view .LVU139
+	call	kfree@PLT
+.LVL42:
+	.loc 1 73 9 view .LVU140
+	.loc 1 73 9 is_stmt 0 view .LVU141
+.LBE36:
+	.loc 1 70 19 is_stmt 1 view .LVU142
+	testq	%rbx, %rbx
+	jne	.L32
+.LVL43:
+.L31:
+	.loc 1 70 19 is_stmt 0 view .LVU143
+.LBE35:
+.LBE34:
+	.loc 1 153 5 is_stmt 1 view .LVU144
+	movq	24(%rbp), %rax
+.LVL44:
+.LBB37:
+.LBI37:
+	.loc 1 81 6 view .LVU145
+.LBB38:
+	.loc 1 83 5 view .LVU146
+	.loc 1 86 53 is_stmt 0 view .LVU147
+	movl	$4, %edx
+	.loc 1 83 21 view .LVU148
+	movq	$0, 0(%rbp)
+	.loc 1 84 5 is_stmt 1 view .LVU149
+	.loc 1 84 21 is_stmt 0 view .LVU150
+	movq	$0, 8(%rbp)
+	.loc 1 85 5 is_stmt 1 view .LVU151
+	.loc 1 86 53 is_stmt 0 view .LVU152
+	testq	%rax, %rax
+	.loc 1 85 18 view .LVU153
+	movq	$0, 16(%rbp)
+	.loc 1 86 5 is_stmt 1 view .LVU154
+	.loc 1 86 53 is_stmt 0 view .LVU155
+	cmove	%rdx, %rax
+.LVL45:
+	.loc 1 86 25 view .LVU156
+	movq	%rax, 24(%rbp)
+.LVL46:
+	.loc 1 86 25 view .LVU157
+.LBE38:
+.LBE37:
+	.loc 1 154 1 view .LVU158
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL47:
+	.loc 1 154 1 view .LVU159
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	arena_destroy, .-arena_destroy
+	.p2align 4
+	.globl	bump_malloc
+	.type	bump_malloc, @function
+bump_malloc:
+.LVL48:
+.LFB6:
+	.loc 1 157 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 158 5 view .LVU161
+	.loc 1 157 1 is_stmt 0 view .LVU162
+	movq	%rdi, %rsi
+	.loc 1 158 12 view .LVU163
+	leaq	bump_arena(%rip), %rdi
+.LVL49:
+	.loc 1 158 12 view .LVU164
+	jmp	arena_alloc
+.LVL50:
+	.loc 1 158 12 view .LVU165
+	.cfi_endproc
+.LFE6:
+	.size	bump_malloc, .-bump_malloc
+	.p2align 4
+	.globl	bump_free
+	.type	bump_free, @function
+bump_free:
+.LVL51:
+.LFB7:
+	.loc 1 162 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 163 5 view .LVU167
+	.loc 1 165 1 is_stmt 0 view .LVU168
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	bump_free, .-bump_free
+	.data
+	.align 32
+	.type	bump_arena, @object
+	.size	bump_arena, 32
+bump_arena:
+	.zero	24
+	.quad	4
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "src/include/bump.h"
+	.file 5 "src/include/mem.h"
+	.file 6 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x5df
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF36
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0xd
+	.long	.LASF8
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0xd
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x2e
+	.byte	0x17
+	.long	0x77
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF10
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0xe
+	.long	.LASF15
+	.byte	0x10
+	.byte	0x1e
+	.long	0xb0
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x1f
+	.byte	0x18
+	.long	0xb0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x20
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x8c
+	.uleb128 0xe
+	.long	.LASF16
+	.byte	0x20
+	.byte	0x26
+	.long	0xf1
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x27
+	.byte	0x18
+	.long	0xb0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF18
+	.byte	0x28
+	.byte	0xe
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x29
+	.byte	0xe
+	.long	0xf1
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x2a
+	.byte	0xc
+	.long	0x35
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0x6b
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF21
+	.uleb128 0x1a
+	.long	0xf8
+	.uleb128 0x7
+	.long	0xff
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF22
+	.uleb128 0x1b
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x27
+	.byte	0x15
+	.long	0xb5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bump_arena
+	.uleb128 0xf
+	.long	.LASF23
+	.byte	0x5
+	.byte	0xd6
+	.long	0x137
+	.uleb128 0xb
+	.long	0xf6
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF38
+	.byte	0x5
+	.byte	0xbd
+	.byte	0x7
+	.long	0xf6
+	.long	0x14d
+	.uleb128 0xb
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x30
+	.long	0x15f
+	.uleb128 0xb
+	.long	0x104
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF25
+	.byte	0xa1
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18a
+	.uleb128 0x1e
+	.string	"ptr"
+	.byte	0x1
+	.byte	0xa1
+	.byte	0x16
+	.long	0xf6
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF30
+	.byte	0x9c
+	.long	0xf6
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e0
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x9c
+	.byte	0x1a
+	.long	0x35
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1f
+	.quad	.LVL50
+	.long	0x351
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bump_arena
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF26
+	.byte	0x96
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ac
+	.uleb128 0x6
+	.long	.LASF28
+	.byte	0x96
+	.byte	0x22
+	.long	0x2ac
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x11
+	.long	0x552
+	.quad	.LBI34
+	.byte	.LVU134
+	.quad	.LBB34
+	.quad	.LBE34-.LBB34
+	.byte	0x98
+	.byte	0x5
+	.long	0x271
+	.uleb128 0x2
+	.long	0x55f
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x12
+	.long	0x56a
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.uleb128 0x8
+	.long	0x56b
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x13
+	.quad	.LVL42
+	.long	0x126
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x52e
+	.quad	.LBI37
+	.byte	.LVU145
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.byte	0x99
+	.uleb128 0x2
+	.long	0x546
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	0x53b
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xb5
+	.uleb128 0xc
+	.long	.LASF29
+	.byte	0x84
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x351
+	.uleb128 0x6
+	.long	.LASF28
+	.byte	0x84
+	.byte	0x20
+	.long	0x2ac
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x9
+	.long	.LASF32
+	.byte	0x86
+	.byte	0x18
+	.long	0xb0
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x14
+	.long	0x552
+	.quad	.LBI31
+	.byte	.LVU110
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.byte	0x8b
+	.uleb128 0x2
+	.long	0x55f
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x12
+	.long	0x56a
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0x8
+	.long	0x56b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x13
+	.quad	.LVL34
+	.long	0x126
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF31
+	.byte	0x5c
+	.long	0xf6
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x52e
+	.uleb128 0x6
+	.long	.LASF28
+	.byte	0x5c
+	.byte	0x21
+	.long	0x2ac
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x5c
+	.byte	0x30
+	.long	0x35
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.long	.LASF33
+	.byte	0x66
+	.byte	0xc
+	.long	0x35
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x9
+	.long	.LASF32
+	.byte	0x73
+	.byte	0x18
+	.long	0xb0
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x79
+	.byte	0xe
+	.long	0xf1
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x20
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.long	0x3f9
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x61
+	.byte	0xf
+	.long	0xf6
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x21
+	.long	.LLRL6
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF32
+	.byte	0x6a
+	.byte	0x1c
+	.long	0xb0
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x11
+	.long	0x578
+	.quad	.LBI21
+	.byte	.LVU35
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.byte	0x6a
+	.byte	0x25
+	.long	0x482
+	.uleb128 0x2
+	.long	0x59f
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x2
+	.long	0x594
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2
+	.long	0x589
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x8
+	.long	0x5aa
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xa
+	.quad	.LVL7
+	.long	0x137
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL28
+	.long	0x14d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x578
+	.quad	.LBI23
+	.byte	.LVU59
+	.long	.LLRL12
+	.byte	0x1
+	.byte	0x73
+	.byte	0x21
+	.long	0x50c
+	.uleb128 0x2
+	.long	0x59f
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2
+	.long	0x594
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2
+	.long	0x589
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x23
+	.long	.LLRL12
+	.uleb128 0x8
+	.long	0x5aa
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xa
+	.quad	.LVL15
+	.long	0x137
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL26
+	.long	0x14d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF34
+	.byte	0x1
+	.byte	0x51
+	.byte	0x6
+	.byte	0x1
+	.long	0x552
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x51
+	.byte	0x1f
+	.long	0x2ac
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x51
+	.byte	0x2e
+	.long	0x35
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF39
+	.byte	0x1
+	.byte	0x44
+	.byte	0xd
+	.byte	0x1
+	.long	0x578
+	.uleb128 0x5
+	.long	.LASF32
+	.byte	0x44
+	.byte	0x33
+	.long	0xb0
+	.uleb128 0x26
+	.uleb128 0x16
+	.long	.LASF13
+	.byte	0x47
+	.byte	0x1c
+	.long	0xb0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF40
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0xb0
+	.byte	0x1
+	.long	0x5b6
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x2d
+	.byte	0x3a
+	.long	0x2ac
+	.uleb128 0x5
+	.long	.LASF35
+	.byte	0x2d
+	.byte	0x55
+	.long	0xb0
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x2d
+	.byte	0x63
+	.long	0x35
+	.uleb128 0x16
+	.long	.LASF32
+	.byte	0x2f
+	.byte	0x18
+	.long	0xb0
+	.byte	0
+	.uleb128 0x28
+	.long	0x52e
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x29
+	.long	0x53b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.long	0x546
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU134
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU139
+	.uleb128 .LVU143
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU145
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU157
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 24
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU145
+	.uleb128 .LVU157
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU106
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x6
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU110
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU115
+	.uleb128 .LVU119
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU88
+	.uleb128 .LVU88
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x12
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x74
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU30
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU88
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 4111
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x19
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x100f
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 4111
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x19
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x100f
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 4111
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU76
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU88
+	.uleb128 .LVU94
+	.uleb128 .LVU98
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU79
+	.uleb128 .LVU88
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU89
+	.uleb128 .LVU94
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU49
+	.uleb128 .LVU53
+	.uleb128 .LVU98
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU35
+	.uleb128 .LVU49
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU35
+	.uleb128 .LVU49
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU49
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU39
+	.uleb128 .LVU49
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU59
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 8
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU59
+	.uleb128 .LVU76
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU76
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU63
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU76
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF13:
+	.string	"pNext"
+.LASF8:
+	.string	"size_t"
+.LASF20:
+	.string	"chunk_pages"
+.LASF30:
+	.string	"bump_malloc"
+.LASF39:
+	.string	"_arena_free_chunks"
+.LASF25:
+	.string	"bump_free"
+.LASF11:
+	.string	"short unsigned int"
+.LASF37:
+	.string	"bump_arena"
+.LASF40:
+	.string	"_arena_add_chunk"
+.LASF23:
+	.string	"kfree"
+.LASF27:
+	.string	"size"
+.LASF18:
+	.string	"pCursor"
+.LASF38:
+	.string	"kpalloc"
+.LASF3:
+	.string	"long unsigned int"
+.LASF34:
+	.string	"arena_init"
+.LASF32:
+	.string	"pChunk"
+.LASF28:
+	.string	"pArena"
+.LASF10:
+	.string	"unsigned char"
+.LASF12:
+	.string	"unsigned int"
+.LASF26:
+	.string	"arena_destroy"
+.LASF21:
+	.string	"char"
+.LASF9:
+	.string	"uint8_t"
+.LASF15:
+	.string	"ArenaChunk"
+.LASF14:
+	.string	"pages"
+.LASF4:
+	.string	"long long int"
+.LASF16:
+	.string	"Arena"
+.LASF33:
+	.string	"needed"
+.LASF7:
+	.string	"short int"
+.LASF36:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF29:
+	.string	"arena_reset"
+.LASF2:
+	.string	"long int"
+.LASF24:
+	.string	"kprintf"
+.LASF5:
+	.string	"long double"
+.LASF31:
+	.string	"arena_alloc"
+.LASF6:
+	.string	"signed char"
+.LASF35:
+	.string	"pPrev"
+.LASF22:
+	.string	"_Bool"
+.LASF17:
+	.string	"pChunks"
+.LASF19:
+	.string	"pEnd"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc/bump.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1391 @@
+# 0 "src/alloc/slab.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/alloc/slab.c"
+# 35 "src/alloc/slab.c"
+# 1 "src/include/slab.h" 1
+# 21 "src/include/slab.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 22 "src/include/slab.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 23 "src/include/slab.h" 2
+# 43 "src/include/slab.h"
+
+# 43 "src/include/slab.h"
+struct SlabCache;
+
+void slab_init();
+void *slab_malloc(size_t size);
+void slab_free(void *ptr);
+size_t slab_usable_size(void *ptr);
+int slab_size_class(size_t size);
+int slab_object_class(void *ptr, uint32_t *pOwner);
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner);
+void slab_free_batch(void **ppObjects, uint32_t count);
+
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject));
+void *kmem_cache_alloc(struct SlabCache *pCache);
+void kmem_cache_free(struct SlabCache *pCache, void *ptr);
+void kmem_cache_report();
+# 36 "src/alloc/slab.c" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 37 "src/alloc/slab.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 24 "src/include/mem.h" 2
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 38 "src/alloc/slab.c" 2
+# 1 "src/include/math.h" 1
+# 39 "src/alloc/slab.c" 2
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 40 "src/alloc/slab.c" 2
+
+
+struct Slab {
+    struct Slab *pNext;
+    struct Slab *pPrev;
+    struct SlabCache *pCache;
+    void *pFree;
+    uint32_t inuse;
+    uint32_t capacity;
+    uint32_t owner;
+};
+
+struct SlabCache {
+    spinlock_t lock;
+    size_t object_size;
+    uint32_t slab_pages;
+    uint32_t objects_per_slab;
+    uint32_t objects_offset;
+    size_t stride;
+    uint32_t free_offset;
+    const char *pName;
+    void (*ctor)(void *pObject);
+    struct Slab *pPartial;
+    struct Slab *pFull;
+    struct Slab *pEmpty;
+    uint32_t num_empty;
+    uint32_t num_slabs;
+    uint64_t allocs;
+    uint64_t frees;
+    struct SlabCache *pNextCache;
+};
+# 84 "src/alloc/slab.c"
+static struct SlabCache size_classes[] = {
+    { .object_size = 16, .slab_pages = 1 },
+    { .object_size = 32, .slab_pages = 1 },
+    { .object_size = 48, .slab_pages = 1 },
+    { .object_size = 64, .slab_pages = 1 },
+    { .object_size = 96, .slab_pages = 1 },
+    { .object_size = 128, .slab_pages = 1 },
+    { .object_size = 192, .slab_pages = 1 },
+    { .object_size = 256, .slab_pages = 1 },
+    { .object_size = 384, .slab_pages = 2 },
+    { .object_size = 512, .slab_pages = 2 },
+    { .object_size = 768, .slab_pages = 4 },
+    { .object_size = 1024, .slab_pages = 4 },
+    { .object_size = 1536, .slab_pages = 8 },
+    { .object_size = 2048, .slab_pages = 8 },
+};
+
+_Static_assert(sizeof(size_classes) / sizeof(size_classes[0]) == 14, "SLAB_NUM_CLASSES is out of date");
+
+
+
+
+static uint8_t size_class_index[2048 / 16];
+
+static 
+# 108 "src/alloc/slab.c" 3 4
+      _Bool 
+# 108 "src/alloc/slab.c"
+           _slab_ready = 
+# 108 "src/alloc/slab.c" 3 4
+                         0
+# 108 "src/alloc/slab.c"
+                              ;
+
+
+static struct SlabCache *pNamedCaches = 
+# 111 "src/alloc/slab.c" 3 4
+                                       ((void *)0)
+# 111 "src/alloc/slab.c"
+                                           ;
+static spinlock_t named_caches_lock;
+
+
+
+
+static inline void _slab_list_push(struct Slab **ppList, struct Slab *pSlab)
+{
+    pSlab->pPrev = 
+# 119 "src/alloc/slab.c" 3 4
+                  ((void *)0)
+# 119 "src/alloc/slab.c"
+                      ;
+    pSlab->pNext = *ppList;
+
+    if (*ppList != 
+# 122 "src/alloc/slab.c" 3 4
+                  ((void *)0)
+# 122 "src/alloc/slab.c"
+                      ) {
+        (*ppList)->pPrev = pSlab;
+    }
+
+    *ppList = pSlab;
+}
+
+
+
+
+static inline void _slab_list_remove(struct Slab **ppList, struct Slab *pSlab)
+{
+    if (pSlab->pPrev != 
+# 134 "src/alloc/slab.c" 3 4
+                       ((void *)0)
+# 134 "src/alloc/slab.c"
+                           ) {
+        pSlab->pPrev->pNext = pSlab->pNext;
+    } else {
+        *ppList = pSlab->pNext;
+    }
+
+    if (pSlab->pNext != 
+# 140 "src/alloc/slab.c" 3 4
+                       ((void *)0)
+# 140 "src/alloc/slab.c"
+                           ) {
+        pSlab->pNext->pPrev = pSlab->pPrev;
+    }
+}
+
+
+
+
+
+static struct Slab* _slab_create(struct SlabCache *pCache)
+{
+    uint8_t *pPages = kpalloc(pCache->slab_pages);
+    if (pPages == 
+# 152 "src/alloc/slab.c" 3 4
+                 ((void *)0)
+# 152 "src/alloc/slab.c"
+                     ) {
+        return 
+# 153 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 153 "src/alloc/slab.c"
+                  ;
+    }
+
+    struct Slab *pSlab = (struct Slab*)pPages;
+    pSlab->pCache = pCache;
+    pSlab->inuse = 0;
+    pSlab->owner = 0;
+    pSlab->capacity = pCache->objects_per_slab;
+    pSlab->pFree = 
+# 161 "src/alloc/slab.c" 3 4
+                  ((void *)0)
+# 161 "src/alloc/slab.c"
+                      ;
+
+
+    uint8_t *pObjects = pPages + pCache->objects_offset;
+    for (uint32_t i = pSlab->capacity; i > 0; i--) {
+        uint8_t *pObject = pObjects + (i - 1) * pCache->stride;
+
+        if (pCache->ctor != 
+# 168 "src/alloc/slab.c" 3 4
+                           ((void *)0)
+# 168 "src/alloc/slab.c"
+                               ) {
+            pCache->ctor(pObject);
+        }
+
+        *(void**)(pObject + pCache->free_offset) = pSlab->pFree;
+        pSlab->pFree = pObject;
+    }
+
+    for (uint32_t i = 0; i < pCache->slab_pages; i++) {
+        struct page *pPage = kmem_page(pPages + i * 4096);
+        pPage->flags |= 0x02;
+        pPage->pOwner = pSlab;
+    }
+
+    pCache->num_slabs++;
+    return pSlab;
+}
+
+
+
+
+static void _slab_destroy(struct SlabCache *pCache, struct Slab *pSlab)
+{
+    uint8_t *pPages = (uint8_t*)pSlab;
+
+    for (uint32_t i = 0; i < pCache->slab_pages; i++) {
+        struct page *pPage = kmem_page(pPages + i * 4096);
+        pPage->flags &= ~0x02;
+        pPage->pOwner = 
+# 196 "src/alloc/slab.c" 3 4
+                       ((void *)0)
+# 196 "src/alloc/slab.c"
+                           ;
+    }
+
+    pCache->num_slabs--;
+    kfree(pSlab);
+}
+
+
+
+
+
+static void* _slab_take(struct SlabCache *pCache, struct Slab **ppSlab)
+{
+    struct Slab *pSlab = pCache->pPartial;
+
+    if (pSlab == 
+# 211 "src/alloc/slab.c" 3 4
+                ((void *)0)
+# 211 "src/alloc/slab.c"
+                    ) {
+        pSlab = pCache->pEmpty;
+
+        if (pSlab != 
+# 214 "src/alloc/slab.c" 3 4
+                    ((void *)0)
+# 214 "src/alloc/slab.c"
+                        ) {
+            _slab_list_remove(&pCache->pEmpty, pSlab);
+            pCache->num_empty--;
+        } else {
+            pSlab = _slab_create(pCache);
+
+            if (pSlab == 
+# 220 "src/alloc/slab.c" 3 4
+                        ((void *)0)
+# 220 "src/alloc/slab.c"
+                            ) {
+                return 
+# 221 "src/alloc/slab.c" 3 4
+                      ((void *)0)
+# 221 "src/alloc/slab.c"
+                          ;
+            }
+        }
+
+        _slab_list_push(&pCache->pPartial, pSlab);
+    }
+
+    uint8_t *pObject = pSlab->pFree;
+    pSlab->pFree = *(void**)(pObject + pCache->free_offset);
+    pSlab->inuse++;
+    pCache->allocs++;
+
+    if (pSlab->inuse == pSlab->capacity) {
+        _slab_list_remove(&pCache->pPartial, pSlab);
+        _slab_list_push(&pCache->pFull, pSlab);
+    }
+
+    *ppSlab = pSlab;
+    return pObject;
+}
+
+
+
+
+static void* _slab_cache_alloc(struct SlabCache *pCache)
+{
+    struct Slab *pSlab;
+
+    spinlock_lock(&pCache->lock);
+    void *ptr = _slab_take(pCache, &pSlab);
+    spinlock_unlock(&pCache->lock);
+
+    return ptr;
+}
+
+
+
+
+
+
+static void _slab_put(struct Slab *pSlab, void *ptr)
+{
+    struct SlabCache *pCache = pSlab->pCache;
+
+    *(void**)((uint8_t*)ptr + pCache->free_offset) = pSlab->pFree;
+    pSlab->pFree = ptr;
+    pCache->frees++;
+
+    if (pSlab->inuse == pSlab->capacity) {
+        _slab_list_remove(&pCache->pFull, pSlab);
+        _slab_list_push(&pCache->pPartial, pSlab);
+    }
+
+    pSlab->inuse--;
+
+    if (pSlab->inuse == 0) {
+        _slab_list_remove(&pCache->pPartial, pSlab);
+
+        if (pCache->num_empty < 2) {
+            _slab_list_push(&pCache->pEmpty, pSlab);
+            pCache->num_empty++;
+        } else {
+            _slab_destroy(pCache, pSlab);
+        }
+    }
+}
+
+
+
+
+static void _slab_cache_free(struct Slab *pSlab, void *ptr)
+{
+    struct SlabCache *pCache = pSlab->pCache;
+
+    spinlock_lock(&pCache->lock);
+    _slab_put(pSlab, ptr);
+    spinlock_unlock(&pCache->lock);
+}
+
+
+
+
+void slab_init()
+{
+    if (_slab_ready) {
+        return;
+    }
+
+    uint32_t class = 0;
+
+    for (uint32_t i = 0; i < 14; i++) {
+        struct SlabCache *pCache = &size_classes[i];
+        size_t size = pCache->object_size;
+
+        pCache->stride = size;
+        pCache->objects_offset = (size & (size - 1)) == 0 ? ((((((sizeof(struct Slab)) + (16) - 1) / (16)) * (16)) + (size) - 1) / (size)) * (size) : (((sizeof(struct Slab)) + (16) - 1) / (16)) * (16);
+        pCache->objects_per_slab = (pCache->slab_pages * 4096 - pCache->objects_offset) / size;
+    }
+
+    for (uint32_t i = 0; i < 2048 / 16; i++) {
+        while (size_classes[class].object_size < (i + 1) * 16) {
+            class++;
+        }
+
+        size_class_index[i] = class;
+    }
+
+    _slab_ready = 
+# 328 "src/alloc/slab.c" 3 4
+                 1
+# 328 "src/alloc/slab.c"
+                     ;
+}
+
+
+
+
+
+void *slab_malloc(size_t size)
+{
+    if (!_slab_ready) {
+        slab_init();
+    }
+
+    if (size > 2048) {
+        return kalloc(size);
+    }
+
+    struct SlabCache *pCache = &size_classes[slab_size_class(size)];
+    void *ptr = _slab_cache_alloc(pCache);
+
+    if (ptr == 
+# 348 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 348 "src/alloc/slab.c"
+                  ) {
+        kprintf("Slab allocation of %lu bytes failed.\n", size);
+    }
+
+    return ptr;
+}
+
+
+
+
+
+void slab_free(void *ptr)
+{
+    if (ptr == 
+# 361 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 361 "src/alloc/slab.c"
+                  ) {
+        return;
+    }
+
+    struct page *pPage = kmem_page(ptr);
+
+
+    if (pPage == 
+# 368 "src/alloc/slab.c" 3 4
+                ((void *)0)
+# 368 "src/alloc/slab.c"
+                    ) {
+        kprintf("Slab: Free of unallocated address 0x%X ignored.\n", ptr);
+        return;
+    }
+
+    if (pPage->flags & 0x02) {
+        _slab_cache_free((struct Slab*)pPage->pOwner, ptr);
+    } else {
+        kfree(ptr);
+    }
+}
+
+
+
+
+int slab_size_class(size_t size)
+{
+    if (size > 2048) {
+        return -1;
+    }
+
+    return size_class_index[(((size) > (1) ? (size) : (1)) - 1) / 16];
+}
+
+
+
+
+
+int slab_object_class(void *ptr, uint32_t *pOwner)
+{
+    struct page *pPage = kmem_page(ptr);
+
+    if (pPage == 
+# 400 "src/alloc/slab.c" 3 4
+                ((void *)0) 
+# 400 "src/alloc/slab.c"
+                     || !(pPage->flags & 0x02)) {
+        return -1;
+    }
+
+    struct Slab *pSlab = (struct Slab*)pPage->pOwner;
+    if (pSlab->pCache < size_classes || pSlab->pCache >= size_classes + 14) {
+
+        return -1;
+    }
+
+    *pOwner = pSlab->owner;
+
+    return pSlab->pCache - size_classes;
+}
+
+
+
+
+
+
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner)
+{
+    if (!_slab_ready) {
+        slab_init();
+    }
+
+    struct SlabCache *pCache = &size_classes[class];
+    struct Slab *pSlab;
+    uint32_t taken = 0;
+
+    spinlock_lock(&pCache->lock);
+
+    while (taken < count) {
+        void *ptr = _slab_take(pCache, &pSlab);
+        if (ptr == 
+# 434 "src/alloc/slab.c" 3 4
+                  ((void *)0)
+# 434 "src/alloc/slab.c"
+                      ) {
+            break;
+        }
+
+        pSlab->owner = owner;
+        ppObjects[taken++] = ptr;
+    }
+
+    spinlock_unlock(&pCache->lock);
+
+    return taken;
+}
+
+
+
+
+void slab_free_batch(void **ppObjects, uint32_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    struct SlabCache *pCache = ((struct Slab*)kmem_page(ppObjects[0])->pOwner)->pCache;
+
+    spinlock_lock(&pCache->lock);
+
+    for (uint32_t i = 0; i < count; i++) {
+        _slab_put((struct Slab*)kmem_page(ppObjects[i])->pOwner, ppObjects[i]);
+    }
+
+    spinlock_unlock(&pCache->lock);
+}
+
+
+
+
+
+size_t slab_usable_size(void *ptr)
+{
+    struct page *pPage = kmem_page(ptr);
+
+    if (pPage == 
+# 475 "src/alloc/slab.c" 3 4
+                ((void *)0)
+# 475 "src/alloc/slab.c"
+                    ) {
+        return 0;
+    }
+
+    if (pPage->flags & 0x02) {
+        return ((struct Slab*)pPage->pOwner)->pCache->object_size;
+    }
+
+    return (size_t)pPage->pages_allocated * 4096;
+}
+
+
+
+
+
+
+
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject))
+{
+    align = ((align) > (8) ? (align) : (8));
+    if ((align & (align - 1)) != 0) {
+        align = 1ULL << (64 - __builtin_clzl(align));
+    }
+
+    struct SlabCache *pCache = slab_malloc(sizeof(struct SlabCache));
+    if (pCache == 
+# 500 "src/alloc/slab.c" 3 4
+                 ((void *)0)
+# 500 "src/alloc/slab.c"
+                     ) {
+        return 
+# 501 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 501 "src/alloc/slab.c"
+                  ;
+    }
+
+    memset(pCache, 0, sizeof(struct SlabCache));
+    pCache->pName = pName;
+    pCache->ctor = ctor;
+    pCache->object_size = size;
+
+
+    if (ctor != 
+# 510 "src/alloc/slab.c" 3 4
+               ((void *)0)
+# 510 "src/alloc/slab.c"
+                   ) {
+        pCache->free_offset = (((size) + (sizeof(void*)) - 1) / (sizeof(void*))) * (sizeof(void*));
+        pCache->stride = (((pCache->free_offset + sizeof(void*)) + (align) - 1) / (align)) * (align);
+    } else {
+        pCache->stride = (((((size) > (sizeof(void*)) ? (size) : (sizeof(void*)))) + (align) - 1) / (align)) * (align);
+    }
+
+    pCache->objects_offset = ((((((sizeof(struct Slab)) + (16) - 1) / (16)) * (16)) + (align) - 1) / (align)) * (align);
+
+
+    pCache->slab_pages = 1;
+    while ((pCache->slab_pages * 4096 - pCache->objects_offset) / pCache->stride < 8 &&
+        pCache->slab_pages < 16) {
+        pCache->slab_pages *= 2;
+    }
+
+    if (pCache->slab_pages * 4096 < pCache->objects_offset + pCache->stride) {
+        kprintf("Slab cache %s: objects of %lu bytes are too big.\n", pName, size);
+        slab_free(pCache);
+        return 
+# 529 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 529 "src/alloc/slab.c"
+                  ;
+    }
+
+    pCache->objects_per_slab = (pCache->slab_pages * 4096 - pCache->objects_offset) / pCache->stride;
+
+    spinlock_lock(&named_caches_lock);
+    pCache->pNextCache = pNamedCaches;
+    pNamedCaches = pCache;
+    spinlock_unlock(&named_caches_lock);
+
+    return pCache;
+}
+
+
+
+
+void *kmem_cache_alloc(struct SlabCache *pCache)
+{
+    void *ptr = _slab_cache_alloc(pCache);
+
+    if (ptr == 
+# 549 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 549 "src/alloc/slab.c"
+                  ) {
+        kprintf("Slab cache %s: allocation failed.\n", pCache->pName);
+    }
+
+    return ptr;
+}
+
+
+
+
+void kmem_cache_free(struct SlabCache *pCache, void *ptr)
+{
+    if (ptr == 
+# 561 "src/alloc/slab.c" 3 4
+              ((void *)0)
+# 561 "src/alloc/slab.c"
+                  ) {
+        return;
+    }
+
+    struct page *pPage = kmem_page(ptr);
+
+    if (pPage == 
+# 567 "src/alloc/slab.c" 3 4
+                ((void *)0) 
+# 567 "src/alloc/slab.c"
+                     || !(pPage->flags & 0x02) || ((struct Slab*)pPage->pOwner)->pCache != pCache) {
+        kprintf("Slab cache %s: 0x%X doesn't belong to it.\n", pCache->pName, ptr);
+        return;
+    }
+
+    _slab_cache_free((struct Slab*)pPage->pOwner, ptr);
+}
+
+
+
+
+static void _kmem_cache_print(struct SlabCache *pCache)
+{
+    if (pCache->pName != 
+# 580 "src/alloc/slab.c" 3 4
+                        ((void *)0)
+# 580 "src/alloc/slab.c"
+                            ) {
+        kprintf("%s", pCache->pName);
+    } else {
+        kprintf("size-%lu", pCache->object_size);
+    }
+
+    kprintf(": %lu bytes, %lu active, %d slabs of %d, %lu allocs, %lu frees\n",
+        pCache->object_size, pCache->allocs - pCache->frees, pCache->num_slabs,
+        pCache->objects_per_slab, pCache->allocs, pCache->frees);
+}
+
+
+
+
+void kmem_cache_report()
+{
+    for (uint32_t i = 0; i < 14; i++) {
+        _kmem_cache_print(&size_classes[i]);
+    }
+
+    spinlock_lock(&named_caches_lock);
+
+    for (struct SlabCache *pCache = pNamedCaches; pCache != 
+# 602 "src/alloc/slab.c" 3 4
+                                                           ((void *)0)
+# 602 "src/alloc/slab.c"
+                                                               ; pCache = pCache->pNextCache) {
+        _kmem_cache_print(pCache);
+    }
+
+    spinlock_unlock(&named_caches_lock);
+}
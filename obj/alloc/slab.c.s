@@ -0,0 +1,9219 @@
+	.file	"slab.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc/slab.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%s"
+.LC1:
+	.string	"size-%lu"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	": %lu bytes, %lu active, %d slabs of %d, %lu allocs, %lu frees\n"
+	.text
+	.p2align 4
+	.type	_kmem_cache_print, @function
+_kmem_cache_print:
+.LVL0:
+.LFB21:
+	.file 1 "src/alloc/slab.c"
+	.loc 1 579 1 view -0
+	.cfi_startproc
+	.loc 1 580 5 view .LVU1
+	.loc 1 579 1 is_stmt 0 view .LVU2
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 580 15 view .LVU3
+	movq	48(%rdi), %rsi
+	.loc 1 579 1 view .LVU4
+	movq	%rdi, %rbx
+	.loc 1 580 8 view .LVU5
+	testq	%rsi, %rsi
+	je	.L2
+	.loc 1 581 9 is_stmt 1 view .LVU6
+	leaq	.LC0(%rip), %rdi
+.LVL1:
+	.loc 1 581 9 is_stmt 0 view .LVU7
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL2:
+.L3:
+	.loc 1 586 5 is_stmt 1 view .LVU8
+	movq	104(%rbx), %rax
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movq	96(%rbx), %r9
+	leaq	.LC2(%rip), %rdi
+	movl	92(%rbx), %ecx
+	movq	8(%rbx), %rsi
+	pushq	%rax
+	.cfi_def_cfa_offset 32
+	movq	%r9, %rdx
+	movl	20(%rbx), %r8d
+	subq	%rax, %rdx
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL3:
+	.loc 1 589 1 is_stmt 0 view .LVU9
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rdx
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL4:
+	.loc 1 589 1 view .LVU10
+	ret
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.cfi_restore_state
+	.loc 1 583 9 is_stmt 1 view .LVU11
+	movq	8(%rdi), %rsi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	call	kprintf@PLT
+.LVL6:
+	jmp	.L3
+	.cfi_endproc
+.LFE21:
+	.size	_kmem_cache_print, .-_kmem_cache_print
+	.p2align 4
+	.type	_slab_take, @function
+_slab_take:
+.LVL7:
+.LFB6:
+	.loc 1 208 1 view -0
+	.cfi_startproc
+	.loc 1 209 5 view .LVU13
+	.loc 1 208 1 is_stmt 0 view .LVU14
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 209 18 view .LVU15
+	movq	64(%rdi), %rbx
+.LVL8:
+	.loc 1 211 5 is_stmt 1 view .LVU16
+	.loc 1 211 8 is_stmt 0 view .LVU17
+	testq	%rbx, %rbx
+	je	.L48
+.LVL9:
+.L7:
+	.loc 1 228 5 is_stmt 1 view .LVU18
+	.loc 1 228 14 is_stmt 0 view .LVU19
+	movq	24(%rbx), %rdx
+.LVL10:
+	.loc 1 229 5 is_stmt 1 view .LVU20
+	.loc 1 229 46 is_stmt 0 view .LVU21
+	movl	40(%rbp), %eax
+	.loc 1 229 20 view .LVU22
+	movq	(%rdx,%rax), %rax
+	.loc 1 229 18 view .LVU23
+	movq	%rax, 24(%rbx)
+	.loc 1 230 5 is_stmt 1 view .LVU24
+	.loc 1 230 17 is_stmt 0 view .LVU25
+	movl	32(%rbx), %eax
+	addl	$1, %eax
+	movl	%eax, 32(%rbx)
+	.loc 1 231 5 is_stmt 1 view .LVU26
+	.loc 1 231 19 is_stmt 0 view .LVU27
+	addq	$1, 96(%rbp)
+	.loc 1 233 5 is_stmt 1 view .LVU28
+	.loc 1 233 8 is_stmt 0 view .LVU29
+	cmpl	36(%rbx), %eax
+	je	.L49
+.L21:
+	.loc 1 238 5 is_stmt 1 view .LVU30
+	.loc 1 238 13 is_stmt 0 view .LVU31
+	movq	%rbx, (%r12)
+	.loc 1 239 5 is_stmt 1 view .LVU32
+.LVL11:
+.L6:
+	.loc 1 240 1 is_stmt 0 view .LVU33
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rdx, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL12:
+	.loc 1 240 1 view .LVU34
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL13:
+	.loc 1 240 1 view .LVU35
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+	.loc 1 234 9 is_stmt 1 view .LVU36
+.LBB64:
+.LBI64:
+	.loc 1 132 20 view .LVU37
+.LBB65:
+	.loc 1 134 5 view .LVU38
+	.loc 1 134 14 is_stmt 0 view .LVU39
+	movq	8(%rbx), %rax
+	.loc 1 135 36 view .LVU40
+	movq	(%rbx), %rcx
+	.loc 1 134 8 view .LVU41
+	testq	%rax, %rax
+	je	.L22
+	.loc 1 135 9 is_stmt 1 view .LVU42
+	.loc 1 135 29 is_stmt 0 view .LVU43
+	movq	%rcx, (%rax)
+.L23:
+	.loc 1 140 5 is_stmt 1 view .LVU44
+	.loc 1 140 14 is_stmt 0 view .LVU45
+	movq	(%rbx), %rax
+	.loc 1 140 8 view .LVU46
+	testq	%rax, %rax
+	je	.L24
+	.loc 1 141 9 is_stmt 1 view .LVU47
+	.loc 1 141 36 is_stmt 0 view .LVU48
+	movq	8(%rbx), %rcx
+	.loc 1 141 29 view .LVU49
+	movq	%rcx, 8(%rax)
+.L24:
+.LVL15:
+	.loc 1 141 29 view .LVU50
+.LBE65:
+.LBE64:
+	.loc 1 235 9 is_stmt 1 view .LVU51
+.LBB67:
+.LBI67:
+	.loc 1 117 20 view .LVU52
+.LBB68:
+	.loc 1 119 5 view .LVU53
+	.loc 1 119 18 is_stmt 0 view .LVU54
+	movq	$0, 8(%rbx)
+	.loc 1 120 5 is_stmt 1 view .LVU55
+	.loc 1 120 20 is_stmt 0 view .LVU56
+	movq	72(%rbp), %rax
+	.loc 1 120 18 view .LVU57
+	movq	%rax, (%rbx)
+	.loc 1 122 5 is_stmt 1 view .LVU58
+	.loc 1 122 8 is_stmt 0 view .LVU59
+	testq	%rax, %rax
+	je	.L25
+	.loc 1 123 9 is_stmt 1 view .LVU60
+	.loc 1 123 26 is_stmt 0 view .LVU61
+	movq	%rbx, 8(%rax)
+.L25:
+	.loc 1 126 5 is_stmt 1 view .LVU62
+	.loc 1 126 13 is_stmt 0 view .LVU63
+	movq	%rbx, 72(%rbp)
+	.loc 1 127 1 view .LVU64
+	jmp	.L21
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 127 1 view .LVU65
+.LBE68:
+.LBE67:
+	.loc 1 212 9 is_stmt 1 view .LVU66
+	.loc 1 212 15 is_stmt 0 view .LVU67
+	movq	80(%rdi), %rbx
+.LVL17:
+	.loc 1 214 9 is_stmt 1 view .LVU68
+	.loc 1 214 12 is_stmt 0 view .LVU69
+	testq	%rbx, %rbx
+	je	.L8
+	.loc 1 215 13 is_stmt 1 view .LVU70
+.LVL18:
+.LBB69:
+.LBI69:
+	.loc 1 132 20 view .LVU71
+.LBB70:
+	.loc 1 134 5 view .LVU72
+	.loc 1 134 14 is_stmt 0 view .LVU73
+	movq	8(%rbx), %rax
+	.loc 1 135 36 view .LVU74
+	movq	(%rbx), %rdx
+	.loc 1 134 8 view .LVU75
+	testq	%rax, %rax
+	je	.L9
+	.loc 1 135 9 is_stmt 1 view .LVU76
+	.loc 1 135 29 is_stmt 0 view .LVU77
+	movq	%rdx, (%rax)
+.L10:
+	.loc 1 140 5 is_stmt 1 view .LVU78
+	.loc 1 140 14 is_stmt 0 view .LVU79
+	movq	(%rbx), %rax
+	.loc 1 140 8 view .LVU80
+	testq	%rax, %rax
+	je	.L11
+	.loc 1 141 9 is_stmt 1 view .LVU81
+	.loc 1 141 36 is_stmt 0 view .LVU82
+	movq	8(%rbx), %rdx
+	.loc 1 141 29 view .LVU83
+	movq	%rdx, 8(%rax)
+.L11:
+.LVL19:
+	.loc 1 141 29 view .LVU84
+.LBE70:
+.LBE69:
+	.loc 1 216 13 is_stmt 1 view .LVU85
+	.loc 1 216 30 is_stmt 0 view .LVU86
+	subl	$1, 88(%rbp)
+.LVL20:
+.L12:
+	.loc 1 225 9 is_stmt 1 view .LVU87
+.LBB72:
+.LBI72:
+	.loc 1 117 20 view .LVU88
+.LBB73:
+	.loc 1 119 5 view .LVU89
+	.loc 1 119 18 is_stmt 0 view .LVU90
+	movq	$0, 8(%rbx)
+	.loc 1 120 5 is_stmt 1 view .LVU91
+	.loc 1 120 20 is_stmt 0 view .LVU92
+	movq	64(%rbp), %rax
+	.loc 1 120 18 view .LVU93
+	movq	%rax, (%rbx)
+	.loc 1 122 5 is_stmt 1 view .LVU94
+	.loc 1 122 8 is_stmt 0 view .LVU95
+	testq	%rax, %rax
+	je	.L20
+	.loc 1 123 9 is_stmt 1 view .LVU96
+	.loc 1 123 26 is_stmt 0 view .LVU97
+	movq	%rbx, 8(%rax)
+.L20:
+	.loc 1 126 5 is_stmt 1 view .LVU98
+	.loc 1 126 13 is_stmt 0 view .LVU99
+	movq	%rbx, 64(%rbp)
+	.loc 1 127 1 view .LVU100
+	jmp	.L7
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 127 1 view .LVU101
+.LBE73:
+.LBE72:
+.LBB74:
+.LBB71:
+	.loc 1 137 9 is_stmt 1 view .LVU102
+	.loc 1 137 17 is_stmt 0 view .LVU103
+	movq	%rdx, 80(%rdi)
+	jmp	.L10
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 137 17 view .LVU104
+.LBE71:
+.LBE74:
+.LBB75:
+.LBB66:
+	.loc 1 137 9 is_stmt 1 view .LVU105
+	.loc 1 137 17 is_stmt 0 view .LVU106
+	movq	%rcx, 64(%rbp)
+	jmp	.L23
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 137 17 view .LVU107
+.LBE66:
+.LBE75:
+	.loc 1 218 13 is_stmt 1 view .LVU108
+.LBB76:
+.LBI76:
+	.loc 1 149 21 view .LVU109
+.LBB77:
+	.loc 1 151 5 view .LVU110
+	.loc 1 151 23 is_stmt 0 view .LVU111
+	movl	16(%rdi), %edi
+.LVL24:
+	.loc 1 151 23 view .LVU112
+	call	kpalloc@PLT
+.LVL25:
+	.loc 1 151 23 view .LVU113
+	movq	%rax, %rbx
+.LVL26:
+	.loc 1 152 5 is_stmt 1 view .LVU114
+	.loc 1 152 8 is_stmt 0 view .LVU115
+	testq	%rax, %rax
+	je	.L26
+	.loc 1 156 5 is_stmt 1 view .LVU116
+.LVL27:
+	.loc 1 157 5 view .LVU117
+	.loc 1 157 19 is_stmt 0 view .LVU118
+	movq	%rbp, 16(%rax)
+	.loc 1 158 5 is_stmt 1 view .LVU119
+	.loc 1 164 40 is_stmt 0 view .LVU120
+	movl	24(%rbp), %r14d
+	.loc 1 158 18 view .LVU121
+	movl	$0, 32(%rax)
+	.loc 1 159 5 is_stmt 1 view .LVU122
+	.loc 1 159 18 is_stmt 0 view .LVU123
+	movl	$0, 40(%rax)
+	.loc 1 160 5 is_stmt 1 view .LVU124
+	.loc 1 160 29 is_stmt 0 view .LVU125
+	movl	20(%rbp), %eax
+.LVL28:
+	.loc 1 161 18 view .LVU126
+	movq	$0, 24(%rbx)
+	.loc 1 160 21 view .LVU127
+	movl	%eax, 36(%rbx)
+	.loc 1 161 5 is_stmt 1 view .LVU128
+	.loc 1 164 5 view .LVU129
+.LVL29:
+	.loc 1 165 5 view .LVU130
+.LBB78:
+	.loc 1 165 10 view .LVU131
+	.loc 1 165 42 view .LVU132
+	leal	-1(%rax), %r15d
+	testl	%eax, %eax
+	je	.L19
+.LVL30:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+.LBB79:
+	.loc 1 166 9 view .LVU133
+	.loc 1 166 47 is_stmt 0 view .LVU134
+	movq	32(%rbp), %r13
+	.loc 1 168 19 view .LVU135
+	movq	56(%rbp), %rax
+	.loc 1 166 47 view .LVU136
+	imulq	%r15, %r13
+	.loc 1 166 18 view .LVU137
+	addq	%r14, %r13
+	addq	%rbx, %r13
+.LVL31:
+	.loc 1 168 9 is_stmt 1 view .LVU138
+	.loc 1 168 12 is_stmt 0 view .LVU139
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 169 13 is_stmt 1 view .LVU140
+	movq	%r13, %rdi
+	call	*%rax
+.LVL32:
+.L17:
+	.loc 1 172 9 view .LVU141
+	.loc 1 172 57 is_stmt 0 view .LVU142
+	movq	24(%rbx), %rdx
+	.loc 1 172 35 view .LVU143
+	movl	40(%rbp), %eax
+	.loc 1 172 50 view .LVU144
+	movq	%rdx, 0(%r13,%rax)
+	.loc 1 173 9 is_stmt 1 view .LVU145
+	.loc 1 173 22 is_stmt 0 view .LVU146
+	movq	%r13, 24(%rbx)
+.LBE79:
+	.loc 1 165 48 is_stmt 1 view .LVU147
+.LVL33:
+	.loc 1 165 42 view .LVU148
+	subq	$1, %r15
+.LVL34:
+	.loc 1 165 42 is_stmt 0 view .LVU149
+	jnb	.L18
+.LVL35:
+.L19:
+	.loc 1 165 42 view .LVU150
+.LBE78:
+.LBB80:
+	.loc 1 176 28 is_stmt 1 view .LVU151
+	movl	16(%rbp), %eax
+	.loc 1 176 19 is_stmt 0 view .LVU152
+	xorl	%r13d, %r13d
+	.loc 1 176 28 view .LVU153
+	testl	%eax, %eax
+	je	.L16
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+.LBB81:
+	.loc 1 177 9 is_stmt 1 view .LVU154
+	.loc 1 177 51 is_stmt 0 view .LVU155
+	movl	%r13d, %edi
+.LBE81:
+	.loc 1 176 51 view .LVU156
+	addl	$1, %r13d
+.LVL37:
+.LBB82:
+	.loc 1 177 51 view .LVU157
+	sall	$12, %edi
+.LVL38:
+	.loc 1 177 47 view .LVU158
+	addq	%rbx, %rdi
+	.loc 1 177 30 view .LVU159
+	call	kmem_page@PLT
+.LVL39:
+	.loc 1 178 9 is_stmt 1 view .LVU160
+	.loc 1 178 22 is_stmt 0 view .LVU161
+	orw	$2, 24(%rax)
+	.loc 1 179 9 is_stmt 1 view .LVU162
+	.loc 1 179 23 is_stmt 0 view .LVU163
+	movq	%rbx, (%rax)
+.LBE82:
+	.loc 1 176 51 is_stmt 1 view .LVU164
+.LVL40:
+	.loc 1 176 28 view .LVU165
+	cmpl	16(%rbp), %r13d
+	jb	.L15
+.LVL41:
+.L16:
+	.loc 1 176 28 is_stmt 0 view .LVU166
+.LBE80:
+	.loc 1 182 5 is_stmt 1 view .LVU167
+	.loc 1 182 22 is_stmt 0 view .LVU168
+	addl	$1, 92(%rbp)
+	.loc 1 183 5 is_stmt 1 view .LVU169
+.LVL42:
+	.loc 1 183 5 is_stmt 0 view .LVU170
+.LBE77:
+.LBE76:
+	.loc 1 220 13 is_stmt 1 view .LVU171
+	jmp	.L12
+.LVL43:
+.L26:
+	.loc 1 221 23 is_stmt 0 view .LVU172
+	xorl	%edx, %edx
+.LVL44:
+	.loc 1 221 23 view .LVU173
+	jmp	.L6
+	.cfi_endproc
+.LFE6:
+	.size	_slab_take, .-_slab_take
+	.p2align 4
+	.type	_slab_put, @function
+_slab_put:
+.LVL45:
+.LFB8:
+	.loc 1 262 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 263 5 view .LVU175
+	.loc 1 262 1 is_stmt 0 view .LVU176
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 263 23 view .LVU177
+	movq	16(%rdi), %r12
+.LVL46:
+	.loc 1 265 5 is_stmt 1 view .LVU178
+	.loc 1 262 1 is_stmt 0 view .LVU179
+	movq	%rdi, %rbx
+	.loc 1 265 59 view .LVU180
+	movq	24(%rdi), %rdx
+	.loc 1 269 14 view .LVU181
+	movl	32(%rdi), %ebp
+	.loc 1 265 37 view .LVU182
+	movl	40(%r12), %eax
+	.loc 1 265 52 view .LVU183
+	movq	%rdx, (%rsi,%rax)
+	.loc 1 266 5 is_stmt 1 view .LVU184
+	.loc 1 266 18 is_stmt 0 view .LVU185
+	movq	%rsi, 24(%rdi)
+	.loc 1 267 5 is_stmt 1 view .LVU186
+	.loc 1 267 18 is_stmt 0 view .LVU187
+	addq	$1, 104(%r12)
+	.loc 1 269 5 is_stmt 1 view .LVU188
+	.loc 1 269 8 is_stmt 0 view .LVU189
+	cmpl	36(%rdi), %ebp
+	je	.L79
+.L51:
+	.loc 1 274 5 is_stmt 1 view .LVU190
+	.loc 1 274 17 is_stmt 0 view .LVU191
+	subl	$1, %ebp
+	movl	%ebp, 32(%rbx)
+	.loc 1 276 5 is_stmt 1 view .LVU192
+	.loc 1 276 8 is_stmt 0 view .LVU193
+	jne	.L50
+	.loc 1 277 9 is_stmt 1 view .LVU194
+.LVL47:
+.LBB95:
+.LBI95:
+	.loc 1 132 20 view .LVU195
+.LBB96:
+	.loc 1 134 5 view .LVU196
+	.loc 1 134 14 is_stmt 0 view .LVU197
+	movq	8(%rbx), %rax
+	.loc 1 135 36 view .LVU198
+	movq	(%rbx), %rdx
+	.loc 1 134 8 view .LVU199
+	testq	%rax, %rax
+	je	.L57
+	.loc 1 135 9 is_stmt 1 view .LVU200
+	.loc 1 135 29 is_stmt 0 view .LVU201
+	movq	%rdx, (%rax)
+.L58:
+	.loc 1 140 5 is_stmt 1 view .LVU202
+	.loc 1 140 14 is_stmt 0 view .LVU203
+	movq	(%rbx), %rax
+	.loc 1 140 8 view .LVU204
+	testq	%rax, %rax
+	je	.L59
+	.loc 1 141 9 is_stmt 1 view .LVU205
+	.loc 1 141 36 is_stmt 0 view .LVU206
+	movq	8(%rbx), %rdx
+	.loc 1 141 29 view .LVU207
+	movq	%rdx, 8(%rax)
+.L59:
+.LVL48:
+	.loc 1 141 29 view .LVU208
+.LBE96:
+.LBE95:
+	.loc 1 279 9 is_stmt 1 view .LVU209
+	.loc 1 279 19 is_stmt 0 view .LVU210
+	movl	88(%r12), %eax
+	.loc 1 279 12 view .LVU211
+	cmpl	$1, %eax
+	ja	.L80
+	.loc 1 280 13 is_stmt 1 view .LVU212
+.LVL49:
+.LBB98:
+.LBI98:
+	.loc 1 117 20 view .LVU213
+.LBB99:
+	.loc 1 119 5 view .LVU214
+	.loc 1 119 18 is_stmt 0 view .LVU215
+	movq	$0, 8(%rbx)
+	.loc 1 120 5 is_stmt 1 view .LVU216
+	.loc 1 120 20 is_stmt 0 view .LVU217
+	movq	80(%r12), %rdx
+	.loc 1 120 18 view .LVU218
+	movq	%rdx, (%rbx)
+	.loc 1 122 5 is_stmt 1 view .LVU219
+	.loc 1 122 8 is_stmt 0 view .LVU220
+	testq	%rdx, %rdx
+	je	.L62
+	.loc 1 123 9 is_stmt 1 view .LVU221
+	.loc 1 123 26 is_stmt 0 view .LVU222
+	movq	%rbx, 8(%rdx)
+.L62:
+	.loc 1 126 5 is_stmt 1 view .LVU223
+.LBE99:
+.LBE98:
+	.loc 1 281 30 is_stmt 0 view .LVU224
+	addl	$1, %eax
+.LBB101:
+.LBB100:
+	.loc 1 126 13 view .LVU225
+	movq	%rbx, 80(%r12)
+.LVL50:
+	.loc 1 126 13 view .LVU226
+.LBE100:
+.LBE101:
+	.loc 1 281 13 is_stmt 1 view .LVU227
+	.loc 1 281 30 is_stmt 0 view .LVU228
+	movl	%eax, 88(%r12)
+.LVL51:
+.L50:
+	.loc 1 286 1 view .LVU229
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LVL52:
+	.loc 1 286 1 view .LVU230
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL53:
+	.loc 1 286 1 view .LVU231
+	ret
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.cfi_restore_state
+	.loc 1 270 9 is_stmt 1 view .LVU232
+.LBB102:
+.LBI102:
+	.loc 1 132 20 view .LVU233
+.LBB103:
+	.loc 1 134 5 view .LVU234
+	.loc 1 134 14 is_stmt 0 view .LVU235
+	movq	8(%rdi), %rax
+	.loc 1 135 36 view .LVU236
+	movq	(%rdi), %rdx
+	.loc 1 134 8 view .LVU237
+	testq	%rax, %rax
+	je	.L52
+	.loc 1 135 9 is_stmt 1 view .LVU238
+	.loc 1 135 29 is_stmt 0 view .LVU239
+	movq	%rdx, (%rax)
+.L53:
+	.loc 1 140 5 is_stmt 1 view .LVU240
+	.loc 1 140 14 is_stmt 0 view .LVU241
+	movq	(%rbx), %rax
+	.loc 1 140 8 view .LVU242
+	testq	%rax, %rax
+	je	.L54
+	.loc 1 141 9 is_stmt 1 view .LVU243
+	.loc 1 141 36 is_stmt 0 view .LVU244
+	movq	8(%rbx), %rdx
+	.loc 1 141 29 view .LVU245
+	movq	%rdx, 8(%rax)
+.L54:
+.LVL55:
+	.loc 1 141 29 view .LVU246
+.LBE103:
+.LBE102:
+	.loc 1 271 9 is_stmt 1 view .LVU247
+.LBB105:
+.LBI105:
+	.loc 1 117 20 view .LVU248
+.LBB106:
+	.loc 1 119 5 view .LVU249
+	.loc 1 119 18 is_stmt 0 view .LVU250
+	movq	$0, 8(%rbx)
+	.loc 1 120 5 is_stmt 1 view .LVU251
+	.loc 1 120 20 is_stmt 0 view .LVU252
+	movq	64(%r12), %rax
+	.loc 1 120 18 view .LVU253
+	movq	%rax, (%rbx)
+	.loc 1 122 5 is_stmt 1 view .LVU254
+	.loc 1 122 8 is_stmt 0 view .LVU255
+	testq	%rax, %rax
+	je	.L55
+	.loc 1 123 9 is_stmt 1 view .LVU256
+	.loc 1 123 26 is_stmt 0 view .LVU257
+	movq	%rbx, 8(%rax)
+.L55:
+	.loc 1 126 5 is_stmt 1 view .LVU258
+	.loc 1 126 13 is_stmt 0 view .LVU259
+	movq	%rbx, 64(%r12)
+	.loc 1 127 1 view .LVU260
+	jmp	.L51
+.LVL56:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.loc 1 127 1 view .LVU261
+.LBE106:
+.LBE105:
+.LBB107:
+.LBB108:
+.LBB109:
+	.loc 1 193 28 is_stmt 1 view .LVU262
+	movl	16(%r12), %eax
+	testl	%eax, %eax
+	je	.L63
+.LVL57:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+.LBB110:
+	.loc 1 194 9 view .LVU263
+	.loc 1 194 51 is_stmt 0 view .LVU264
+	movl	%ebp, %edi
+.LBE110:
+	.loc 1 193 51 view .LVU265
+	addl	$1, %ebp
+.LVL58:
+.LBB111:
+	.loc 1 194 51 view .LVU266
+	sall	$12, %edi
+.LVL59:
+	.loc 1 194 47 view .LVU267
+	addq	%rbx, %rdi
+	.loc 1 194 30 view .LVU268
+	call	kmem_page@PLT
+.LVL60:
+	.loc 1 195 9 is_stmt 1 view .LVU269
+	.loc 1 195 22 is_stmt 0 view .LVU270
+	andw	$-3, 24(%rax)
+	.loc 1 196 9 is_stmt 1 view .LVU271
+	.loc 1 196 23 is_stmt 0 view .LVU272
+	movq	$0, (%rax)
+.LBE111:
+	.loc 1 193 51 is_stmt 1 view .LVU273
+.LVL61:
+	.loc 1 193 28 view .LVU274
+	cmpl	16(%r12), %ebp
+	jb	.L61
+.LVL62:
+.L63:
+	.loc 1 193 28 is_stmt 0 view .LVU275
+.LBE109:
+	.loc 1 199 5 is_stmt 1 view .LVU276
+	.loc 1 199 22 is_stmt 0 view .LVU277
+	subl	$1, 92(%r12)
+	.loc 1 200 5 is_stmt 1 view .LVU278
+	movq	%rbx, %rdi
+.LBE108:
+.LBE107:
+	.loc 1 286 1 is_stmt 0 view .LVU279
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LVL63:
+	.loc 1 286 1 view .LVU280
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL64:
+.LBB113:
+.LBB112:
+	.loc 1 200 5 view .LVU281
+	jmp	kfree@PLT
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.cfi_restore_state
+	.loc 1 200 5 view .LVU282
+.LBE112:
+.LBE113:
+.LBB114:
+.LBB97:
+	.loc 1 137 9 is_stmt 1 view .LVU283
+	.loc 1 137 17 is_stmt 0 view .LVU284
+	movq	%rdx, 64(%r12)
+	jmp	.L58
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.loc 1 137 17 view .LVU285
+.LBE97:
+.LBE114:
+.LBB115:
+.LBB104:
+	.loc 1 137 9 is_stmt 1 view .LVU286
+	.loc 1 137 17 is_stmt 0 view .LVU287
+	movq	%rdx, 72(%r12)
+	jmp	.L53
+.LBE104:
+.LBE115:
+	.cfi_endproc
+.LFE8:
+	.size	_slab_put, .-_slab_put
+	.p2align 4
+	.type	slab_init.part.0, @function
+slab_init.part.0:
+.LFB23:
+	.loc 1 303 6 is_stmt 1 view -0
+	.cfi_startproc
+.LVL67:
+.LBB116:
+	.loc 1 311 28 view .LVU289
+	leaq	8+size_classes(%rip), %rcx
+	leaq	1680(%rcx), %rdi
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+.LBB117:
+	.loc 1 312 9 view .LVU290
+	.loc 1 313 9 view .LVU291
+	.loc 1 313 16 is_stmt 0 view .LVU292
+	movq	(%rcx), %rsi
+.LVL69:
+	.loc 1 315 9 is_stmt 1 view .LVU293
+	.loc 1 316 32 is_stmt 0 view .LVU294
+	movl	$48, %edx
+	.loc 1 316 48 view .LVU295
+	leaq	-1(%rsi), %rax
+	.loc 1 315 24 view .LVU296
+	movq	%rsi, 24(%rcx)
+	.loc 1 316 9 is_stmt 1 view .LVU297
+	.loc 1 316 32 is_stmt 0 view .LVU298
+	testq	%rsi, %rax
+	jne	.L82
+	.loc 1 316 125 view .LVU299
+	leaq	47(%rsi), %rax
+	.loc 1 316 130 view .LVU300
+	xorl	%edx, %edx
+	divq	%rsi
+	.loc 1 316 32 view .LVU301
+	movl	%eax, %edx
+	imull	%esi, %edx
+.L82:
+	.loc 1 317 56 view .LVU302
+	movl	8(%rcx), %eax
+	.loc 1 316 32 view .LVU303
+	movl	%edx, 16(%rcx)
+	.loc 1 317 9 is_stmt 1 view .LVU304
+.LBE117:
+	.loc 1 311 28 is_stmt 0 view .LVU305
+	addq	$120, %rcx
+.LVL70:
+.LBB118:
+	.loc 1 317 56 view .LVU306
+	sall	$12, %eax
+	.loc 1 317 63 view .LVU307
+	subl	%edx, %eax
+	.loc 1 317 89 view .LVU308
+	xorl	%edx, %edx
+	divq	%rsi
+	.loc 1 317 34 view .LVU309
+	movl	%eax, -108(%rcx)
+.LBE118:
+	.loc 1 311 35 is_stmt 1 view .LVU310
+.LVL71:
+	.loc 1 311 28 view .LVU311
+	cmpq	%rdi, %rcx
+	jne	.L83
+	leaq	size_class_index(%rip), %r8
+	movl	$16, %esi
+.LVL72:
+	.loc 1 311 28 is_stmt 0 view .LVU312
+.LBE116:
+	.loc 1 309 14 view .LVU313
+	xorl	%ecx, %ecx
+.LVL73:
+	.loc 1 309 14 view .LVU314
+	xorl	%edx, %edx
+	leaq	size_classes(%rip), %rdi
+	jmp	.L84
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+.LBB119:
+	.loc 1 322 13 is_stmt 1 view .LVU315
+	.loc 1 322 18 is_stmt 0 view .LVU316
+	leal	1(%rcx), %edx
+	movq	%rdx, %rcx
+.LVL75:
+	.loc 1 321 48 is_stmt 1 view .LVU317
+.L84:
+	.loc 1 321 48 view .LVU318
+	.loc 1 321 35 is_stmt 0 view .LVU319
+	movq	%rdx, %rax
+	salq	$4, %rax
+	subq	%rdx, %rax
+	.loc 1 321 48 view .LVU320
+	cmpq	%rsi, 8(%rdi,%rax,8)
+	jb	.L85
+	.loc 1 325 9 is_stmt 1 view .LVU321
+	.loc 1 320 28 is_stmt 0 view .LVU322
+	addq	$16, %rsi
+	.loc 1 325 29 view .LVU323
+	movb	%cl, (%r8)
+	.loc 1 320 42 is_stmt 1 view .LVU324
+.LVL76:
+	.loc 1 320 28 view .LVU325
+	addq	$1, %r8
+.LVL77:
+	.loc 1 320 28 is_stmt 0 view .LVU326
+	cmpq	$2064, %rsi
+	jne	.L84
+.LBE119:
+	.loc 1 328 5 is_stmt 1 view .LVU327
+	.loc 1 328 17 is_stmt 0 view .LVU328
+	movb	$1, _slab_ready(%rip)
+	.loc 1 329 1 view .LVU329
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	slab_init.part.0, .-slab_init.part.0
+	.p2align 4
+	.globl	slab_init
+	.type	slab_init, @function
+slab_init:
+.LFB10:
+	.loc 1 304 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 305 5 view .LVU331
+	.loc 1 305 8 is_stmt 0 view .LVU332
+	cmpb	$0, _slab_ready(%rip)
+	jne	.L92
+	xorl	%eax, %eax
+	jmp	slab_init.part.0
+.LVL78:
+.L92:
+	.loc 1 329 1 view .LVU333
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	slab_init, .-slab_init
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"Slab allocation of %lu bytes failed.\n"
+	.text
+	.p2align 4
+	.globl	slab_malloc
+	.type	slab_malloc, @function
+slab_malloc:
+.LVL79:
+.LFB11:
+	.loc 1 336 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 337 5 view .LVU335
+	.loc 1 336 1 is_stmt 0 view .LVU336
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 337 8 view .LVU337
+	cmpb	$0, _slab_ready(%rip)
+	je	.L101
+.LVL80:
+.L95:
+	.loc 1 341 5 is_stmt 1 view .LVU338
+	.loc 1 341 8 is_stmt 0 view .LVU339
+	cmpq	$2048, %rbp
+	ja	.L102
+.LVL81:
+.LBB135:
+.LBI135:
+	.loc 1 335 7 is_stmt 1 view .LVU340
+.LBB136:
+	.loc 1 345 5 view .LVU341
+.LBB137:
+.LBI137:
+	.loc 1 383 5 view .LVU342
+.LBB138:
+	.loc 1 385 5 view .LVU343
+	.loc 1 389 5 view .LVU344
+	.loc 1 389 53 is_stmt 0 view .LVU345
+	testq	%rbp, %rbp
+	movl	$1, %eax
+.LBE138:
+.LBE137:
+	.loc 1 345 23 view .LVU346
+	leaq	size_class_index(%rip), %rdx
+.LBB140:
+.LBB139:
+	.loc 1 389 53 view .LVU347
+	cmovne	%rbp, %rax
+	.loc 1 389 60 view .LVU348
+	subq	$1, %rax
+	.loc 1 389 65 view .LVU349
+	shrq	$4, %rax
+.LBE139:
+.LBE140:
+	.loc 1 345 23 view .LVU350
+	movzbl	(%rdx,%rax), %edx
+	movq	%rdx, %rax
+	salq	$4, %rax
+	subq	%rdx, %rax
+	leaq	size_classes(%rip), %rdx
+	leaq	(%rdx,%rax,8), %rbx
+.LVL82:
+	.loc 1 346 5 is_stmt 1 view .LVU351
+.LBB141:
+.LBI141:
+	.loc 1 245 14 view .LVU352
+.LBB142:
+	.loc 1 247 5 view .LVU353
+	.loc 1 249 5 view .LVU354
+.LBB143:
+.LBI143:
+	.file 2 "src/include/atomic.h"
+	.loc 2 27 20 view .LVU355
+.LBB144:
+	.loc 2 29 12 is_stmt 0 view .LVU356
+	movl	$1, %edx
+.LVL83:
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	.loc 2 31 5 is_stmt 1 view .LVU357
+	.loc 2 29 12 view .LVU358
+	movl	%edx, %eax
+	xchgb	(%rbx), %al
+	testb	%al, %al
+	jne	.L97
+.LVL84:
+	.loc 2 29 12 is_stmt 0 view .LVU359
+.LBE144:
+.LBE143:
+	.loc 1 250 5 is_stmt 1 view .LVU360
+	.loc 1 250 17 is_stmt 0 view .LVU361
+	leaq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	_slab_take
+.LVL85:
+.LBB145:
+.LBB146:
+	.loc 2 36 5 view .LVU362
+.LBE146:
+.LBE145:
+	.loc 1 250 17 view .LVU363
+	movq	%rax, %r12
+.LVL86:
+	.loc 1 251 5 is_stmt 1 view .LVU364
+.LBB148:
+.LBI145:
+	.loc 2 34 20 view .LVU365
+.LBB147:
+	.loc 2 36 5 view .LVU366
+	movb	$0, (%rbx)
+.LVL87:
+	.loc 2 36 5 is_stmt 0 view .LVU367
+.LBE147:
+.LBE148:
+	.loc 1 253 5 is_stmt 1 view .LVU368
+	.loc 1 253 5 is_stmt 0 view .LVU369
+.LBE142:
+.LBE141:
+	.loc 1 348 5 is_stmt 1 view .LVU370
+	.loc 1 348 8 is_stmt 0 view .LVU371
+	testq	%rax, %rax
+	je	.L103
+.LBE136:
+.LBE135:
+	.loc 1 353 1 view .LVU372
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	movq	%r12, %rax
+	.loc 1 353 1 view .LVU373
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LVL88:
+	.loc 1 353 1 view .LVU374
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL89:
+	.loc 1 353 1 view .LVU375
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.cfi_restore_state
+	.loc 1 342 9 is_stmt 1 view .LVU376
+	.loc 1 353 1 is_stmt 0 view .LVU377
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	.loc 1 342 16 view .LVU378
+	movq	%rbp, %rdi
+	.loc 1 353 1 view .LVU379
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL91:
+	.loc 1 353 1 view .LVU380
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	.loc 1 342 16 view .LVU381
+	jmp	kalloc@PLT
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	.cfi_restore_state
+	.loc 1 338 9 is_stmt 1 view .LVU382
+.LBB150:
+.LBI150:
+	.loc 1 303 6 view .LVU383
+.LBB151:
+	.loc 1 305 5 view .LVU384
+	xorl	%eax, %eax
+	call	slab_init.part.0
+.LVL93:
+	.loc 1 305 5 is_stmt 0 view .LVU385
+	jmp	.L95
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.loc 1 305 5 view .LVU386
+.LBE151:
+.LBE150:
+.LBB152:
+.LBB149:
+	.loc 1 349 9 is_stmt 1 view .LVU387
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+.LVL95:
+	.loc 1 349 9 is_stmt 0 view .LVU388
+	leaq	.LC3(%rip), %rdi
+	call	kprintf@PLT
+.LVL96:
+	.loc 1 349 9 view .LVU389
+.LBE149:
+.LBE152:
+	.loc 1 353 1 view .LVU390
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%r12, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL97:
+	.loc 1 353 1 view .LVU391
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	slab_malloc, .-slab_malloc
+	.section	.rodata.str1.8
+	.align 8
+.LC4:
+	.string	"Slab: Free of unallocated address 0x%X ignored.\n"
+	.text
+	.p2align 4
+	.globl	slab_free
+	.type	slab_free, @function
+slab_free:
+.LVL98:
+.LFB12:
+	.loc 1 360 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 361 5 view .LVU393
+	.loc 1 361 8 is_stmt 0 view .LVU394
+	testq	%rdi, %rdi
+	je	.L114
+	.loc 1 360 1 view .LVU395
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	.loc 1 365 5 is_stmt 1 view .LVU396
+	.loc 1 360 1 is_stmt 0 view .LVU397
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 365 26 view .LVU398
+	call	kmem_page@PLT
+.LVL99:
+	.loc 1 368 5 is_stmt 1 view .LVU399
+	.loc 1 368 8 is_stmt 0 view .LVU400
+	testq	%rax, %rax
+	je	.L117
+	.loc 1 373 5 is_stmt 1 view .LVU401
+	.loc 1 373 8 is_stmt 0 view .LVU402
+	testb	$2, 24(%rax)
+	je	.L107
+	.loc 1 374 9 is_stmt 1 view .LVU403
+	.loc 1 374 45 is_stmt 0 view .LVU404
+	movq	(%rax), %rdi
+.LVL100:
+.LBB161:
+.LBI161:
+	.loc 1 291 13 is_stmt 1 view .LVU405
+.LBB162:
+	.loc 1 293 5 view .LVU406
+	.loc 1 295 5 view .LVU407
+.LBB163:
+.LBI163:
+	.loc 2 27 20 view .LVU408
+.LBB164:
+	.loc 2 29 12 is_stmt 0 view .LVU409
+	movl	$1, %edx
+	.loc 2 29 37 view .LVU410
+	movq	16(%rdi), %rbx
+.LVL101:
+	.p2align 4,,10
+	.p2align 3
+.L108:
+	.loc 2 31 5 is_stmt 1 view .LVU411
+	.loc 2 29 12 view .LVU412
+	movl	%edx, %eax
+	xchgb	(%rbx), %al
+	testb	%al, %al
+	jne	.L108
+.LVL102:
+	.loc 2 29 12 is_stmt 0 view .LVU413
+.LBE164:
+.LBE163:
+	.loc 1 296 5 is_stmt 1 view .LVU414
+	movq	%rbp, %rsi
+	call	_slab_put
+.LVL103:
+	.loc 1 297 5 view .LVU415
+.LBB165:
+.LBI165:
+	.loc 2 34 20 view .LVU416
+.LBB166:
+	.loc 2 36 5 view .LVU417
+	movb	$0, (%rbx)
+.LVL104:
+	.loc 2 36 5 is_stmt 0 view .LVU418
+.LBE166:
+.LBE165:
+.LBE162:
+.LBE161:
+	.loc 1 378 1 view .LVU419
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL105:
+	.loc 1 378 1 view .LVU420
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL106:
+	.loc 1 378 1 view .LVU421
+	ret
+.LVL107:
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	.cfi_restore_state
+	.loc 1 376 9 is_stmt 1 view .LVU422
+	.loc 1 378 1 is_stmt 0 view .LVU423
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 376 9 view .LVU424
+	movq	%rbp, %rdi
+	.loc 1 378 1 view .LVU425
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL108:
+	.loc 1 376 9 view .LVU426
+	jmp	kfree@PLT
+.LVL109:
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	.loc 1 376 9 view .LVU427
+	ret
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+.LBB167:
+.LBI167:
+	.loc 1 359 6 is_stmt 1 view .LVU428
+.LBB168:
+	.loc 1 369 9 view .LVU429
+.LBE168:
+.LBE167:
+	.loc 1 378 1 is_stmt 0 view .LVU430
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+.LBB171:
+.LBB169:
+	.loc 1 369 9 view .LVU431
+	movq	%rbp, %rsi
+	leaq	.LC4(%rip), %rdi
+.LBE169:
+.LBE171:
+	.loc 1 378 1 view .LVU432
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL111:
+.LBB172:
+.LBB170:
+	.loc 1 369 9 view .LVU433
+	jmp	kprintf@PLT
+.LVL112:
+	.loc 1 369 9 view .LVU434
+.LBE170:
+.LBE172:
+	.cfi_endproc
+.LFE12:
+	.size	slab_free, .-slab_free
+	.p2align 4
+	.globl	slab_size_class
+	.type	slab_size_class, @function
+slab_size_class:
+.LVL113:
+.LFB13:
+	.loc 1 384 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 385 5 view .LVU436
+	.loc 1 385 8 is_stmt 0 view .LVU437
+	cmpq	$2048, %rdi
+	ja	.L120
+	.loc 1 389 5 is_stmt 1 view .LVU438
+	.loc 1 389 53 is_stmt 0 view .LVU439
+	testq	%rdi, %rdi
+	movl	$1, %eax
+	cmove	%rax, %rdi
+.LVL114:
+	.loc 1 389 28 view .LVU440
+	leaq	size_class_index(%rip), %rax
+	.loc 1 389 60 view .LVU441
+	subq	$1, %rdi
+	.loc 1 389 65 view .LVU442
+	shrq	$4, %rdi
+	.loc 1 389 28 view .LVU443
+	movzbl	(%rax,%rdi), %eax
+	ret
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L120:
+	.loc 1 386 16 view .LVU444
+	movl	$-1, %eax
+	.loc 1 390 1 view .LVU445
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	slab_size_class, .-slab_size_class
+	.p2align 4
+	.globl	slab_object_class
+	.type	slab_object_class, @function
+slab_object_class:
+.LVL116:
+.LFB14:
+	.loc 1 397 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 398 5 view .LVU447
+	.loc 1 397 1 is_stmt 0 view .LVU448
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 397 1 view .LVU449
+	movq	%rsi, %rbx
+	.loc 1 398 26 view .LVU450
+	call	kmem_page@PLT
+.LVL117:
+	.loc 1 400 5 is_stmt 1 view .LVU451
+	.loc 1 400 8 is_stmt 0 view .LVU452
+	testq	%rax, %rax
+	je	.L125
+	.loc 1 400 22 discriminator 1 view .LVU453
+	testb	$2, 24(%rax)
+	je	.L125
+	.loc 1 404 5 is_stmt 1 view .LVU454
+	.loc 1 404 18 is_stmt 0 view .LVU455
+	movq	(%rax), %rcx
+.LVL118:
+	.loc 1 405 5 is_stmt 1 view .LVU456
+	.loc 1 405 8 is_stmt 0 view .LVU457
+	leaq	size_classes(%rip), %rdx
+	.loc 1 405 14 view .LVU458
+	movq	16(%rcx), %rax
+.LVL119:
+	.loc 1 405 38 view .LVU459
+	cmpq	%rdx, %rax
+	jb	.L125
+	leaq	1680(%rdx), %rsi
+	cmpq	%rsi, %rax
+	jnb	.L125
+	.loc 1 410 5 is_stmt 1 view .LVU460
+	.loc 1 410 20 is_stmt 0 view .LVU461
+	movl	40(%rcx), %ecx
+.LVL120:
+	.loc 1 412 26 view .LVU462
+	subq	%rdx, %rax
+	sarq	$3, %rax
+	.loc 1 410 13 view .LVU463
+	movl	%ecx, (%rbx)
+	.loc 1 412 5 is_stmt 1 view .LVU464
+	.loc 1 412 26 is_stmt 0 view .LVU465
+	imull	$-286331153, %eax, %eax
+	.loc 1 413 1 view .LVU466
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL121:
+	.loc 1 413 1 view .LVU467
+	ret
+.LVL122:
+	.p2align 4,,10
+	.p2align 3
+.L125:
+	.cfi_restore_state
+	.loc 1 401 16 view .LVU468
+	movl	$-1, %eax
+	.loc 1 413 1 view .LVU469
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL123:
+	.loc 1 413 1 view .LVU470
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	slab_object_class, .-slab_object_class
+	.p2align 4
+	.globl	slab_alloc_batch
+	.type	slab_alloc_batch, @function
+slab_alloc_batch:
+.LVL124:
+.LFB15:
+	.loc 1 421 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 422 5 view .LVU472
+	.loc 1 421 1 is_stmt 0 view .LVU473
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%edi, %r9d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%ecx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 422 8 view .LVU474
+	cmpb	$0, _slab_ready(%rip)
+	je	.L139
+.LVL125:
+.L128:
+	.loc 1 426 5 is_stmt 1 view .LVU475
+	.loc 1 426 23 is_stmt 0 view .LVU476
+	movslq	%r9d, %rdi
+	leaq	size_classes(%rip), %rdx
+	movq	%rdi, %rax
+	salq	$4, %rax
+	subq	%rdi, %rax
+	leaq	(%rdx,%rax,8), %rbx
+.LVL126:
+	.loc 1 427 5 is_stmt 1 view .LVU477
+	.loc 1 428 5 view .LVU478
+	.loc 1 430 5 view .LVU479
+.LBB180:
+.LBI180:
+	.loc 2 27 20 view .LVU480
+.LBB181:
+	.loc 2 29 5 view .LVU481
+	.loc 2 29 12 is_stmt 0 view .LVU482
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L129:
+	.loc 2 31 5 is_stmt 1 view .LVU483
+	.loc 2 29 12 view .LVU484
+	movl	%edx, %eax
+	xchgb	(%rbx), %al
+	testb	%al, %al
+	jne	.L129
+.LVL127:
+	.loc 2 29 12 is_stmt 0 view .LVU485
+.LBE181:
+.LBE180:
+	.loc 1 432 18 is_stmt 1 view .LVU486
+	testl	%ebp, %ebp
+	je	.L130
+	.loc 1 428 14 is_stmt 0 view .LVU487
+	xorl	%r15d, %r15d
+	leaq	8(%rsp), %r13
+	jmp	.L131
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L140:
+.LBB182:
+	.loc 1 438 9 is_stmt 1 view .LVU488
+	.loc 1 438 22 is_stmt 0 view .LVU489
+	movq	8(%rsp), %rdx
+	.loc 1 439 24 view .LVU490
+	addl	$1, %r15d
+.LVL129:
+	.loc 1 439 24 view .LVU491
+.LBE182:
+	.loc 1 432 18 view .LVU492
+	addq	$8, %r14
+.LBB183:
+	.loc 1 438 22 view .LVU493
+	movl	%r12d, 40(%rdx)
+	.loc 1 439 9 is_stmt 1 view .LVU494
+.LVL130:
+	.loc 1 439 28 is_stmt 0 view .LVU495
+	movq	%rax, -8(%r14)
+	.loc 1 439 28 view .LVU496
+.LBE183:
+	.loc 1 432 18 is_stmt 1 view .LVU497
+	cmpl	%r15d, %ebp
+	je	.L130
+.LVL131:
+.L131:
+.LBB184:
+	.loc 1 433 9 view .LVU498
+	.loc 1 433 21 is_stmt 0 view .LVU499
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	_slab_take
+.LVL132:
+	.loc 1 434 9 is_stmt 1 view .LVU500
+	.loc 1 434 12 is_stmt 0 view .LVU501
+	testq	%rax, %rax
+	jne	.L140
+.LBE184:
+	movl	%r15d, %ebp
+.LVL133:
+.L130:
+	.loc 1 442 5 is_stmt 1 view .LVU502
+.LBB185:
+.LBI185:
+	.loc 2 34 20 view .LVU503
+.LBB186:
+	.loc 2 36 5 view .LVU504
+.LBE186:
+.LBE185:
+	.loc 1 445 1 is_stmt 0 view .LVU505
+	movl	%ebp, %eax
+.LBB188:
+.LBB187:
+	.loc 2 36 5 view .LVU506
+	movb	$0, (%rbx)
+.LVL134:
+	.loc 2 36 5 view .LVU507
+.LBE187:
+.LBE188:
+	.loc 1 444 5 is_stmt 1 view .LVU508
+	.loc 1 445 1 is_stmt 0 view .LVU509
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL135:
+	.loc 1 445 1 view .LVU510
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL136:
+	.loc 1 445 1 view .LVU511
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL137:
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	.cfi_restore_state
+	.loc 1 423 9 is_stmt 1 view .LVU512
+.LBB189:
+.LBI189:
+	.loc 1 303 6 view .LVU513
+.LBB190:
+	.loc 1 305 5 view .LVU514
+	xorl	%eax, %eax
+	call	slab_init.part.0
+.LVL138:
+	.loc 1 305 5 is_stmt 0 view .LVU515
+	jmp	.L128
+.LBE190:
+.LBE189:
+	.cfi_endproc
+.LFE15:
+	.size	slab_alloc_batch, .-slab_alloc_batch
+	.p2align 4
+	.globl	slab_free_batch
+	.type	slab_free_batch, @function
+slab_free_batch:
+.LVL139:
+.LFB16:
+	.loc 1 451 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 452 5 view .LVU517
+	.loc 1 452 8 is_stmt 0 view .LVU518
+	testl	%esi, %esi
+	jne	.L154
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	.loc 1 451 1 view .LVU519
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%esi, %ebp
+	.loc 1 456 5 is_stmt 1 view .LVU520
+	.loc 1 451 1 is_stmt 0 view .LVU521
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 456 47 view .LVU522
+	movq	(%rdi), %rdi
+.LVL140:
+	.loc 1 456 47 view .LVU523
+	call	kmem_page@PLT
+.LVL141:
+	.loc 1 458 5 is_stmt 1 view .LVU524
+.LBB196:
+.LBI196:
+	.loc 2 27 20 view .LVU525
+.LBB197:
+	.loc 2 29 5 view .LVU526
+	.loc 2 29 12 is_stmt 0 view .LVU527
+	movl	$1, %edx
+.LBE197:
+.LBE196:
+	.loc 1 456 23 view .LVU528
+	movq	(%rax), %rax
+.LVL142:
+.LBB199:
+.LBB198:
+	.loc 2 29 37 view .LVU529
+	movq	16(%rax), %r12
+.LVL143:
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	.loc 2 31 5 is_stmt 1 view .LVU530
+	.loc 2 29 12 view .LVU531
+	movl	%edx, %eax
+	xchgb	(%r12), %al
+	testb	%al, %al
+	jne	.L143
+	movl	%ebp, %ebp
+	.loc 2 29 12 is_stmt 0 view .LVU532
+	leaq	(%rbx,%rbp,8), %r13
+.LVL144:
+	.p2align 4,,10
+	.p2align 3
+.L144:
+	.loc 2 29 12 view .LVU533
+.LBE198:
+.LBE199:
+.LBB200:
+	.loc 1 461 9 is_stmt 1 discriminator 3 view .LVU534
+	movq	(%rbx), %rbp
+	.loc 1 460 28 is_stmt 0 discriminator 3 view .LVU535
+	addq	$8, %rbx
+.LVL145:
+	.loc 1 461 33 discriminator 3 view .LVU536
+	movq	%rbp, %rdi
+	call	kmem_page@PLT
+.LVL146:
+	.loc 1 461 9 discriminator 3 view .LVU537
+	movq	%rbp, %rsi
+	movq	(%rax), %rdi
+	call	_slab_put
+.LVL147:
+	.loc 1 460 38 is_stmt 1 discriminator 3 view .LVU538
+	.loc 1 460 28 discriminator 3 view .LVU539
+	cmpq	%r13, %rbx
+	jne	.L144
+.LBE200:
+	.loc 1 464 5 view .LVU540
+.LVL148:
+.LBB201:
+.LBI201:
+	.loc 2 34 20 view .LVU541
+.LBB202:
+	.loc 2 36 5 view .LVU542
+	movb	$0, (%r12)
+.LVL149:
+	.loc 2 36 5 is_stmt 0 view .LVU543
+.LBE202:
+.LBE201:
+	.loc 1 465 1 view .LVU544
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+.LVL150:
+	.loc 1 465 1 view .LVU545
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	slab_free_batch, .-slab_free_batch
+	.p2align 4
+	.globl	slab_usable_size
+	.type	slab_usable_size, @function
+slab_usable_size:
+.LVL151:
+.LFB17:
+	.loc 1 472 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 473 5 view .LVU547
+	.loc 1 472 1 is_stmt 0 view .LVU548
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 473 26 view .LVU549
+	call	kmem_page@PLT
+.LVL152:
+	.loc 1 475 5 is_stmt 1 view .LVU550
+	.loc 1 475 8 is_stmt 0 view .LVU551
+	testq	%rax, %rax
+	je	.L158
+	.loc 1 479 5 is_stmt 1 view .LVU552
+	.loc 1 479 8 is_stmt 0 view .LVU553
+	testb	$2, 24(%rax)
+	jne	.L160
+	.loc 1 483 5 is_stmt 1 view .LVU554
+	.loc 1 483 12 is_stmt 0 view .LVU555
+	movl	8(%rax), %eax
+.LVL153:
+	.loc 1 484 1 view .LVU556
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 483 43 view .LVU557
+	salq	$12, %rax
+	.loc 1 484 1 view .LVU558
+	ret
+.LVL154:
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	.cfi_restore_state
+	.loc 1 480 9 is_stmt 1 view .LVU559
+	.loc 1 480 45 is_stmt 0 view .LVU560
+	movq	(%rax), %rax
+.LVL155:
+	.loc 1 480 53 view .LVU561
+	movq	16(%rax), %rax
+	movq	8(%rax), %rax
+	.loc 1 484 1 view .LVU562
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL156:
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	.cfi_restore_state
+	.loc 1 476 16 view .LVU563
+	xorl	%eax, %eax
+.LVL157:
+	.loc 1 484 1 view .LVU564
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	slab_usable_size, .-slab_usable_size
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"Slab cache %s: objects of %lu bytes are too big.\n"
+	.text
+	.p2align 4
+	.globl	kmem_cache_create
+	.type	kmem_cache_create, @function
+kmem_cache_create:
+.LVL158:
+.LFB18:
+	.loc 1 493 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 494 5 view .LVU566
+	.loc 1 494 11 is_stmt 0 view .LVU567
+	movl	$8, %eax
+	.loc 1 493 1 view .LVU568
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	movq	%rcx, %r14
+	.loc 1 494 11 view .LVU569
+	cmpq	%rax, %rdx
+	.loc 1 493 1 view .LVU570
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	.loc 1 494 11 view .LVU571
+	cmovnb	%rdx, %rax
+	.loc 1 493 1 view .LVU572
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	.loc 1 494 11 view .LVU573
+	movq	%rax, %r13
+.LVL159:
+	.loc 1 495 5 is_stmt 1 view .LVU574
+	.loc 1 495 25 is_stmt 0 view .LVU575
+	subq	$1, %rax
+.LVL160:
+	.loc 1 493 1 view .LVU576
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 493 1 view .LVU577
+	movq	%rsi, %rbx
+	.loc 1 495 8 view .LVU578
+	testq	%r13, %rax
+	je	.L162
+	.loc 1 496 9 is_stmt 1 view .LVU579
+	.loc 1 496 29 is_stmt 0 view .LVU580
+	bsrq	%r13, %r13
+.LVL161:
+	.loc 1 496 29 view .LVU581
+	leal	1(%r13), %ecx
+.LVL162:
+	.loc 1 496 15 view .LVU582
+	movl	$1, %r13d
+	salq	%cl, %r13
+.LVL163:
+.L162:
+	.loc 1 499 5 is_stmt 1 view .LVU583
+	.loc 1 499 32 is_stmt 0 view .LVU584
+	movl	$120, %edi
+.LVL164:
+	.loc 1 499 32 view .LVU585
+	call	slab_malloc
+.LVL165:
+	.loc 1 499 32 view .LVU586
+	movq	%rax, %r12
+.LVL166:
+	.loc 1 500 5 is_stmt 1 view .LVU587
+	.loc 1 500 8 is_stmt 0 view .LVU588
+	testq	%rax, %rax
+	je	.L163
+	.loc 1 504 5 is_stmt 1 view .LVU589
+	movl	$120, %edx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	memset@PLT
+.LVL167:
+	.loc 1 505 5 view .LVU590
+	.loc 1 505 19 is_stmt 0 view .LVU591
+	movq	%rbp, 48(%r12)
+	.loc 1 506 5 is_stmt 1 view .LVU592
+	.loc 1 506 18 is_stmt 0 view .LVU593
+	movq	%r14, 56(%r12)
+	.loc 1 507 5 is_stmt 1 view .LVU594
+	.loc 1 507 25 is_stmt 0 view .LVU595
+	movq	%rbx, 8(%r12)
+	.loc 1 510 5 is_stmt 1 view .LVU596
+	.loc 1 510 8 is_stmt 0 view .LVU597
+	testq	%r14, %r14
+	je	.L164
+	.loc 1 511 9 is_stmt 1 view .LVU598
+	.loc 1 511 58 is_stmt 0 view .LVU599
+	leal	7(%rbx), %eax
+	.loc 1 512 92 view .LVU600
+	xorl	%edx, %edx
+	.loc 1 511 82 view .LVU601
+	andl	$-8, %eax
+	.loc 1 512 76 view .LVU602
+	leal	7(%rax), %edi
+	.loc 1 511 29 view .LVU603
+	movl	%eax, 40(%r12)
+	.loc 1 512 9 is_stmt 1 view .LVU604
+	.loc 1 512 76 is_stmt 0 view .LVU605
+	addq	%r13, %rdi
+	.loc 1 512 92 view .LVU606
+	movq	%rdi, %rax
+	divq	%r13
+	subq	%rdx, %rdi
+.L165:
+	.loc 1 517 95 view .LVU607
+	leaq	47(%r13), %rax
+	.loc 1 517 100 view .LVU608
+	xorl	%edx, %edx
+	movq	%rdi, 32(%r12)
+	.loc 1 517 5 is_stmt 1 view .LVU609
+	.loc 1 521 19 is_stmt 0 view .LVU610
+	movl	$1, %esi
+	.loc 1 517 100 view .LVU611
+	divq	%r13
+	.loc 1 521 65 view .LVU612
+	xorl	%edx, %edx
+	.loc 1 517 28 view .LVU613
+	movl	%eax, %r8d
+	.loc 1 521 39 view .LVU614
+	movl	$4096, %eax
+	.loc 1 517 28 view .LVU615
+	imull	%r13d, %r8d
+	.loc 1 521 39 view .LVU616
+	subl	%r8d, %eax
+	.loc 1 517 28 view .LVU617
+	movl	%r8d, 24(%r12)
+	.loc 1 520 5 is_stmt 1 view .LVU618
+	.loc 1 521 5 view .LVU619
+	.loc 1 521 86 view .LVU620
+	.loc 1 521 65 is_stmt 0 view .LVU621
+	divq	%rdi
+	.loc 1 521 86 view .LVU622
+	cmpq	$7, %rax
+	jbe	.L166
+	jmp	.L187
+	.p2align 4,,10
+	.p2align 3
+.L188:
+	cmpl	$15, %esi
+	ja	.L173
+.L166:
+	.loc 1 523 9 is_stmt 1 view .LVU623
+	movl	%esi, %ecx
+	.loc 1 521 65 is_stmt 0 view .LVU624
+	xorl	%edx, %edx
+	.loc 1 523 28 view .LVU625
+	addl	%esi, %esi
+	.loc 1 521 86 is_stmt 1 view .LVU626
+	.loc 1 521 32 is_stmt 0 view .LVU627
+	sall	$13, %ecx
+	.loc 1 521 39 view .LVU628
+	movl	%ecx, %eax
+	subl	%r8d, %eax
+	.loc 1 521 65 view .LVU629
+	divq	%rdi
+	.loc 1 521 86 view .LVU630
+	cmpq	$7, %rax
+	jbe	.L188
+.L173:
+	movl	%esi, 16(%r12)
+.L167:
+	.loc 1 526 5 is_stmt 1 view .LVU631
+	.loc 1 526 60 is_stmt 0 view .LVU632
+	addq	%rdi, %r8
+	.loc 1 526 8 view .LVU633
+	cmpq	%r8, %rcx
+	jb	.L189
+	.loc 1 532 5 is_stmt 1 view .LVU634
+	.loc 1 532 30 is_stmt 0 view .LVU635
+	movl	%eax, 20(%r12)
+	.loc 1 534 5 is_stmt 1 view .LVU636
+.LVL168:
+.LBB207:
+.LBI207:
+	.loc 2 27 20 view .LVU637
+.LBB208:
+	.loc 2 29 5 view .LVU638
+	.loc 2 29 12 is_stmt 0 view .LVU639
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	.loc 2 31 5 is_stmt 1 view .LVU640
+	.loc 2 29 12 view .LVU641
+	movl	%edx, %eax
+	xchgb	named_caches_lock(%rip), %al
+	testb	%al, %al
+	jne	.L171
+.LVL169:
+	.loc 2 29 12 is_stmt 0 view .LVU642
+.LBE208:
+.LBE207:
+	.loc 1 535 5 is_stmt 1 view .LVU643
+	.loc 1 535 24 is_stmt 0 view .LVU644
+	movq	pNamedCaches(%rip), %rax
+	.loc 1 536 18 view .LVU645
+	movq	%r12, pNamedCaches(%rip)
+	.loc 1 535 24 view .LVU646
+	movq	%rax, 112(%r12)
+	.loc 1 536 5 is_stmt 1 view .LVU647
+	.loc 1 537 5 view .LVU648
+.LVL170:
+.LBB209:
+.LBI209:
+	.loc 2 34 20 view .LVU649
+.LBB210:
+	.loc 2 36 5 view .LVU650
+.LBE210:
+.LBE209:
+	.loc 1 540 1 is_stmt 0 view .LVU651
+	movq	%r12, %rax
+.LBB212:
+.LBB211:
+	.loc 2 36 5 view .LVU652
+	movb	$0, named_caches_lock(%rip)
+.LVL171:
+	.loc 2 36 5 view .LVU653
+.LBE211:
+.LBE212:
+	.loc 1 539 5 is_stmt 1 view .LVU654
+	.loc 1 540 1 is_stmt 0 view .LVU655
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 40
+.LVL172:
+	.loc 1 540 1 view .LVU656
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 32
+.LVL173:
+	.loc 1 540 1 view .LVU657
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 24
+.LVL174:
+	.loc 1 540 1 view .LVU658
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 16
+.LVL175:
+	.loc 1 540 1 view .LVU659
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 8
+.LVL176:
+	.loc 1 540 1 view .LVU660
+	ret
+.LVL177:
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.cfi_restore_state
+	.loc 1 514 9 is_stmt 1 view .LVU661
+	.loc 1 514 64 is_stmt 0 view .LVU662
+	movl	$8, %eax
+	cmpq	%rax, %rbx
+	cmovnb	%rbx, %rax
+	.loc 1 514 110 view .LVU663
+	xorl	%edx, %edx
+	.loc 1 514 94 view .LVU664
+	leaq	-1(%r13,%rax), %rdi
+	.loc 1 514 110 view .LVU665
+	movq	%rdi, %rax
+	divq	%r13
+	subq	%rdx, %rdi
+	jmp	.L165
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	.loc 1 527 9 is_stmt 1 view .LVU666
+	leaq	.LC5(%rip), %rdi
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL178:
+	.loc 1 528 9 view .LVU667
+	movq	%r12, %rdi
+	call	slab_free
+.LVL179:
+	.loc 1 529 9 view .LVU668
+.L163:
+	.loc 1 501 15 is_stmt 0 view .LVU669
+	xorl	%r12d, %r12d
+.LVL180:
+	.loc 1 540 1 view .LVU670
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 40
+.LVL181:
+	.loc 1 540 1 view .LVU671
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 32
+.LVL182:
+	.loc 1 540 1 view .LVU672
+	movq	%r12, %rax
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 16
+.LVL183:
+	.loc 1 540 1 view .LVU673
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 8
+.LVL184:
+	.loc 1 540 1 view .LVU674
+	ret
+.LVL185:
+	.p2align 4,,10
+	.p2align 3
+.L187:
+	.cfi_restore_state
+	.loc 1 520 24 view .LVU675
+	movl	$1, 16(%r12)
+	movl	$4096, %ecx
+	jmp	.L167
+	.cfi_endproc
+.LFE18:
+	.size	kmem_cache_create, .-kmem_cache_create
+	.section	.rodata.str1.8
+	.align 8
+.LC6:
+	.string	"Slab cache %s: allocation failed.\n"
+	.text
+	.p2align 4
+	.globl	kmem_cache_alloc
+	.type	kmem_cache_alloc, @function
+kmem_cache_alloc:
+.LVL186:
+.LFB19:
+	.loc 1 546 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 547 5 view .LVU677
+	.loc 1 546 1 is_stmt 0 view .LVU678
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB219:
+.LBB220:
+.LBB221:
+.LBB222:
+	.loc 2 29 12 view .LVU679
+	movl	$1, %edx
+.LBE222:
+.LBE221:
+.LBE220:
+.LBE219:
+	.loc 1 546 1 view .LVU680
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+.LVL187:
+.LBB232:
+.LBI219:
+	.loc 1 245 14 is_stmt 1 view .LVU681
+.LBB230:
+	.loc 1 247 5 view .LVU682
+	.loc 1 249 5 view .LVU683
+.LBB224:
+.LBI221:
+	.loc 2 27 20 view .LVU684
+.LBE224:
+.LBE230:
+.LBE232:
+	.loc 1 546 1 is_stmt 0 view .LVU685
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.p2align 4,,10
+	.p2align 3
+.L191:
+.LBB233:
+.LBB231:
+.LBB225:
+.LBB223:
+	.loc 2 31 5 is_stmt 1 view .LVU686
+	.loc 2 29 12 view .LVU687
+	movl	%edx, %eax
+	xchgb	(%rbx), %al
+	testb	%al, %al
+	jne	.L191
+.LVL188:
+	.loc 2 29 12 is_stmt 0 view .LVU688
+.LBE223:
+.LBE225:
+	.loc 1 250 5 is_stmt 1 view .LVU689
+	.loc 1 250 17 is_stmt 0 view .LVU690
+	leaq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+.LVL189:
+	.loc 1 250 17 view .LVU691
+	call	_slab_take
+.LVL190:
+.LBB226:
+.LBB227:
+	.loc 2 36 5 view .LVU692
+.LBE227:
+.LBE226:
+	.loc 1 250 17 view .LVU693
+	movq	%rax, %rbp
+.LVL191:
+	.loc 1 251 5 is_stmt 1 view .LVU694
+.LBB229:
+.LBI226:
+	.loc 2 34 20 view .LVU695
+.LBB228:
+	.loc 2 36 5 view .LVU696
+	movb	$0, (%rbx)
+.LVL192:
+	.loc 2 36 5 is_stmt 0 view .LVU697
+.LBE228:
+.LBE229:
+	.loc 1 253 5 is_stmt 1 view .LVU698
+	.loc 1 253 5 is_stmt 0 view .LVU699
+.LBE231:
+.LBE233:
+	.loc 1 549 5 is_stmt 1 view .LVU700
+	.loc 1 549 8 is_stmt 0 view .LVU701
+	testq	%rax, %rax
+	je	.L195
+	.loc 1 554 1 view .LVU702
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax
+	.loc 1 554 1 view .LVU703
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL193:
+	.loc 1 554 1 view .LVU704
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+.LVL194:
+	.p2align 4,,10
+	.p2align 3
+.L195:
+	.cfi_restore_state
+	.loc 1 550 9 is_stmt 1 view .LVU705
+	movq	48(%rbx), %rsi
+	xorl	%eax, %eax
+.LVL195:
+	.loc 1 550 9 is_stmt 0 view .LVU706
+	leaq	.LC6(%rip), %rdi
+	call	kprintf@PLT
+.LVL196:
+	.loc 1 553 5 is_stmt 1 view .LVU707
+	.loc 1 554 1 is_stmt 0 view .LVU708
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL197:
+	.loc 1 554 1 view .LVU709
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL198:
+	.loc 1 554 1 view .LVU710
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	kmem_cache_alloc, .-kmem_cache_alloc
+	.section	.rodata.str1.8
+	.align 8
+.LC7:
+	.string	"Slab cache %s: 0x%X doesn't belong to it.\n"
+	.text
+	.p2align 4
+	.globl	kmem_cache_free
+	.type	kmem_cache_free, @function
+kmem_cache_free:
+.LVL199:
+.LFB20:
+	.loc 1 560 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 561 5 view .LVU712
+	.loc 1 561 8 is_stmt 0 view .LVU713
+	testq	%rsi, %rsi
+	je	.L212
+	.loc 1 560 1 view .LVU714
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	.loc 1 565 5 is_stmt 1 view .LVU715
+	.loc 1 560 1 is_stmt 0 view .LVU716
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	.loc 1 565 26 view .LVU717
+	movq	%rsi, %rdi
+.LVL200:
+	.loc 1 560 1 view .LVU718
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 565 26 view .LVU719
+	call	kmem_page@PLT
+.LVL201:
+	.loc 1 567 5 is_stmt 1 view .LVU720
+	.loc 1 567 8 is_stmt 0 view .LVU721
+	testq	%rax, %rax
+	je	.L198
+	.loc 1 567 22 discriminator 1 view .LVU722
+	testb	$2, 24(%rax)
+	je	.L198
+	.loc 1 567 71 discriminator 2 view .LVU723
+	movq	(%rax), %rdi
+	.loc 1 567 48 discriminator 2 view .LVU724
+	cmpq	%rbx, 16(%rdi)
+	je	.L199
+.L198:
+	.loc 1 568 9 is_stmt 1 view .LVU725
+	movq	48(%rbx), %rsi
+	.loc 1 573 1 is_stmt 0 view .LVU726
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 568 9 view .LVU727
+	movq	%rbp, %rdx
+	xorl	%eax, %eax
+.LVL202:
+	.loc 1 573 1 view .LVU728
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL203:
+	.loc 1 568 9 view .LVU729
+	leaq	.LC7(%rip), %rdi
+	.loc 1 573 1 view .LVU730
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL204:
+	.loc 1 568 9 view .LVU731
+	jmp	kprintf@PLT
+.LVL205:
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.cfi_restore_state
+.LBB240:
+.LBB241:
+.LBB242:
+.LBB243:
+	.loc 2 29 12 view .LVU732
+	movl	$1, %edx
+.LVL206:
+	.p2align 4,,10
+	.p2align 3
+.L200:
+	.loc 2 31 5 is_stmt 1 view .LVU733
+	.loc 2 29 12 view .LVU734
+	movl	%edx, %eax
+	xchgb	(%rbx), %al
+	testb	%al, %al
+	jne	.L200
+.LBE243:
+.LBE242:
+	.loc 1 296 5 view .LVU735
+	movq	%rbp, %rsi
+	call	_slab_put
+.LVL207:
+	.loc 1 297 5 view .LVU736
+.LBB244:
+.LBI244:
+	.loc 2 34 20 view .LVU737
+.LBB245:
+	.loc 2 36 5 view .LVU738
+	movb	$0, (%rbx)
+.LVL208:
+	.loc 2 36 5 is_stmt 0 view .LVU739
+.LBE245:
+.LBE244:
+.LBE241:
+.LBE240:
+	.loc 1 573 1 view .LVU740
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL209:
+	.loc 1 573 1 view .LVU741
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL210:
+	.loc 1 573 1 view .LVU742
+	ret
+.LVL211:
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	.loc 1 573 1 view .LVU743
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	kmem_cache_free, .-kmem_cache_free
+	.p2align 4
+	.globl	kmem_cache_report
+	.type	kmem_cache_report, @function
+kmem_cache_report:
+.LFB22:
+	.loc 1 595 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 596 5 view .LVU745
+.LBB252:
+	.loc 1 596 10 view .LVU746
+.LVL212:
+	.loc 1 596 28 view .LVU747
+.LBE252:
+	.loc 1 595 1 is_stmt 0 view .LVU748
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	leaq	size_classes(%rip), %rbx
+	leaq	1680(%rbx), %rbp
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LVL213:
+	.p2align 4,,10
+	.p2align 3
+.L216:
+.LBB253:
+	.loc 1 597 9 is_stmt 1 discriminator 3 view .LVU749
+	movq	%rbx, %rdi
+	.loc 1 596 28 is_stmt 0 discriminator 3 view .LVU750
+	addq	$120, %rbx
+.LVL214:
+	.loc 1 597 9 discriminator 3 view .LVU751
+	call	_kmem_cache_print
+.LVL215:
+	.loc 1 596 35 is_stmt 1 discriminator 3 view .LVU752
+	.loc 1 596 28 discriminator 3 view .LVU753
+	cmpq	%rbp, %rbx
+	jne	.L216
+.LBE253:
+.LBB254:
+.LBB255:
+	.loc 2 29 12 is_stmt 0 view .LVU754
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	.loc 2 31 5 is_stmt 1 view .LVU755
+	.loc 2 29 12 view .LVU756
+	movl	%edx, %eax
+	xchgb	named_caches_lock(%rip), %al
+	testb	%al, %al
+	jne	.L217
+.LBE255:
+.LBE254:
+	.loc 1 602 5 view .LVU757
+.LBB256:
+	.loc 1 602 10 view .LVU758
+	.loc 1 602 28 is_stmt 0 view .LVU759
+	movq	pNamedCaches(%rip), %rbx
+.LVL216:
+	.loc 1 602 58 is_stmt 1 view .LVU760
+	testq	%rbx, %rbx
+	je	.L218
+	.p2align 4,,10
+	.p2align 3
+.L219:
+	.loc 1 603 9 discriminator 3 view .LVU761
+	movq	%rbx, %rdi
+	call	_kmem_cache_print
+.LVL217:
+	.loc 1 602 73 discriminator 3 view .LVU762
+	movq	112(%rbx), %rbx
+.LVL218:
+	.loc 1 602 58 discriminator 3 view .LVU763
+	testq	%rbx, %rbx
+	jne	.L219
+.L218:
+	.loc 1 602 58 is_stmt 0 discriminator 3 view .LVU764
+.LBE256:
+	.loc 1 606 5 is_stmt 1 view .LVU765
+.LVL219:
+.LBB257:
+.LBI257:
+	.loc 2 34 20 view .LVU766
+.LBB258:
+	.loc 2 36 5 view .LVU767
+	movb	$0, named_caches_lock(%rip)
+.LVL220:
+	.loc 2 36 5 is_stmt 0 view .LVU768
+.LBE258:
+.LBE257:
+	.loc 1 607 1 view .LVU769
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL221:
+	.loc 1 607 1 view .LVU770
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	kmem_cache_report, .-kmem_cache_report
+	.local	named_caches_lock
+	.comm	named_caches_lock,1,1
+	.local	pNamedCaches
+	.comm	pNamedCaches,8,8
+	.local	_slab_ready
+	.comm	_slab_ready,1,1
+	.local	size_class_index
+	.comm	size_class_index,128,32
+	.data
+	.align 32
+	.type	size_classes, @object
+	.size	size_classes, 1680
+size_classes:
+	.zero	8
+	.quad	16
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	32
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	48
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	64
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	96
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	128
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	192
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	256
+	.long	1
+	.zero	100
+	.zero	8
+	.quad	384
+	.long	2
+	.zero	100
+	.zero	8
+	.quad	512
+	.long	2
+	.zero	100
+	.zero	8
+	.quad	768
+	.long	4
+	.zero	100
+	.zero	8
+	.quad	1024
+	.long	4
+	.zero	100
+	.zero	8
+	.quad	1536
+	.long	8
+	.zero	100
+	.zero	8
+	.quad	2048
+	.long	8
+	.zero	100
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 5 "src/include/mem.h"
+	.file 6 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1721
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x38
+	.long	.LASF97
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x12
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x7
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x12
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x17
+	.long	0x77
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF10
+	.uleb128 0x12
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x31
+	.byte	0x1c
+	.long	0x8a
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x12
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x9d
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF14
+	.uleb128 0x12
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x37
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x3a
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0x3b
+	.long	0xb2
+	.uleb128 0x8
+	.long	0xb9
+	.uleb128 0x3c
+	.long	.LASF98
+	.byte	0x20
+	.byte	0x20
+	.byte	0x5
+	.byte	0x79
+	.byte	0x8
+	.long	0x12d
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x7a
+	.byte	0xb
+	.long	0xb0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x7b
+	.byte	0xe
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x7c
+	.byte	0xe
+	.long	0x91
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x7d
+	.byte	0xe
+	.long	0x91
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x7e
+	.byte	0xe
+	.long	0x91
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x7f
+	.byte	0xe
+	.long	0x7e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x80
+	.byte	0xe
+	.long	0x91
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF24
+	.uleb128 0x3d
+	.byte	0x1
+	.byte	0x2
+	.byte	0x17
+	.byte	0x9
+	.long	0x14b
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x2
+	.byte	0x18
+	.byte	0xd
+	.long	0x6b
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF26
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0x134
+	.uleb128 0x27
+	.long	.LASF34
+	.byte	0x30
+	.byte	0x2a
+	.long	0x1be
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x12
+	.long	0x1be
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x12
+	.long	0x1be
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x17
+	.long	0x2ac
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x2e
+	.byte	0xb
+	.long	0xb0
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x2f
+	.byte	0xe
+	.long	0x91
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x30
+	.byte	0xe
+	.long	0x91
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x1
+	.byte	0x31
+	.byte	0xe
+	.long	0x91
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x157
+	.uleb128 0x27
+	.long	.LASF35
+	.byte	0x78
+	.byte	0x34
+	.long	0x2ac
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x35
+	.byte	0x10
+	.long	0x14b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x36
+	.byte	0xc
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x37
+	.byte	0xe
+	.long	0x91
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x1
+	.byte	0x38
+	.byte	0xe
+	.long	0x91
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x1
+	.byte	0x39
+	.byte	0xe
+	.long	0x91
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x1
+	.byte	0x3a
+	.byte	0xc
+	.long	0x3c
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xe
+	.long	0x91
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x11
+	.long	0xbe
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xc
+	.long	0x2bc
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x12
+	.long	0x1be
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF45
+	.byte	0x1
+	.byte	0x3f
+	.byte	0x12
+	.long	0x1be
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF46
+	.byte	0x1
+	.byte	0x40
+	.byte	0x12
+	.long	0x1be
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x41
+	.byte	0xe
+	.long	0x91
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x42
+	.byte	0xe
+	.long	0x91
+	.byte	0x5c
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x43
+	.byte	0xe
+	.long	0xa4
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x44
+	.byte	0xe
+	.long	0xa4
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x45
+	.byte	0x17
+	.long	0x2ac
+	.byte	0x70
+	.byte	0
+	.uleb128 0x8
+	.long	0x1c3
+	.uleb128 0x3e
+	.long	0x2bc
+	.uleb128 0xd
+	.long	0xb0
+	.byte	0
+	.uleb128 0x8
+	.long	0x2b1
+	.uleb128 0x28
+	.long	0x1c3
+	.long	0x2d1
+	.uleb128 0x29
+	.long	0x2e
+	.byte	0xd
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF52
+	.byte	0x54
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	size_classes
+	.uleb128 0x28
+	.long	0x6b
+	.long	0x2f6
+	.uleb128 0x29
+	.long	0x2e
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF53
+	.byte	0x6a
+	.byte	0x10
+	.long	0x2e6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	size_class_index
+	.uleb128 0x15
+	.long	.LASF54
+	.byte	0x6c
+	.byte	0xc
+	.long	0x12d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_slab_ready
+	.uleb128 0x15
+	.long	.LASF55
+	.byte	0x6f
+	.byte	0x1a
+	.long	0x2ac
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pNamedCaches
+	.uleb128 0x15
+	.long	.LASF56
+	.byte	0x70
+	.byte	0x13
+	.long	0x14b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	named_caches_lock
+	.uleb128 0x1a
+	.long	.LASF57
+	.byte	0xe1
+	.byte	0x7
+	.long	0xb0
+	.long	0x369
+	.uleb128 0xd
+	.long	0xb0
+	.uleb128 0xd
+	.long	0x48
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF60
+	.byte	0x5
+	.byte	0xd6
+	.long	0x37a
+	.uleb128 0xd
+	.long	0xb0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF58
+	.byte	0xcf
+	.byte	0xe
+	.long	0x38f
+	.long	0x38f
+	.uleb128 0xd
+	.long	0xb0
+	.byte	0
+	.uleb128 0x8
+	.long	0xc3
+	.uleb128 0x1a
+	.long	.LASF59
+	.byte	0xbd
+	.byte	0x7
+	.long	0xb0
+	.long	0x3a9
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF61
+	.byte	0x6
+	.byte	0x30
+	.long	0x3bb
+	.uleb128 0xd
+	.long	0xbe
+	.uleb128 0x3f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF62
+	.byte	0xbc
+	.byte	0x7
+	.long	0xb0
+	.long	0x3d0
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF99
+	.byte	0x1
+	.value	0x252
+	.byte	0x6
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4af
+	.uleb128 0x2b
+	.long	.LLRL115
+	.long	0x420
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x254
+	.byte	0x13
+	.long	0x91
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x5
+	.quad	.LVL215
+	.long	0x4af
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -120
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LBB256
+	.quad	.LBE256-.LBB256
+	.long	0x45e
+	.uleb128 0x9
+	.long	.LASF29
+	.value	0x25a
+	.byte	0x1c
+	.long	0x2ac
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x5
+	.quad	.LVL217
+	.long	0x4af
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x12d9
+	.quad	.LBB254
+	.quad	.LBE254-.LBB254
+	.value	0x258
+	.long	0x47f
+	.uleb128 0x13
+	.long	0x12e6
+	.byte	0
+	.uleb128 0x2d
+	.long	0x12ba
+	.quad	.LBI257
+	.byte	.LVU766
+	.quad	.LBB257
+	.quad	.LBE257-.LBB257
+	.value	0x25e
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST118
+	.long	.LVUS118
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF81
+	.value	0x242
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53a
+	.uleb128 0x6
+	.long	.LASF29
+	.value	0x242
+	.byte	0x31
+	.long	0x2ac
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xe
+	.quad	.LVL2
+	.long	0x3a9
+	.long	0x4ff
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL3
+	.long	0x3a9
+	.long	0x51e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL6
+	.long	0x3a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF69
+	.value	0x22f
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x661
+	.uleb128 0x6
+	.long	.LASF29
+	.value	0x22f
+	.byte	0x28
+	.long	0x2ac
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x1c
+	.string	"ptr"
+	.value	0x22f
+	.byte	0x36
+	.long	0xb0
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x9
+	.long	.LASF63
+	.value	0x235
+	.byte	0x12
+	.long	0x38f
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x22
+	.long	0xd0d
+	.quad	.LBB240
+	.quad	.LBE240-.LBB240
+	.value	0x23c
+	.long	0x626
+	.uleb128 0x13
+	.long	0xd27
+	.uleb128 0x13
+	.long	0xd1b
+	.uleb128 0xf
+	.long	0xd33
+	.uleb128 0x22
+	.long	0x12d9
+	.quad	.LBB242
+	.quad	.LBE242-.LBB242
+	.value	0x127
+	.long	0x5de
+	.uleb128 0x13
+	.long	0x12e6
+	.byte	0
+	.uleb128 0xa
+	.long	0x12ba
+	.quad	.LBI244
+	.byte	.LVU737
+	.quad	.LBB244
+	.quad	.LBE244-.LBB244
+	.value	0x129
+	.byte	0x5
+	.long	0x611
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL207
+	.long	0xd40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL201
+	.long	0x37a
+	.long	0x63e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL205
+	.long	0x3a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF64
+	.value	0x221
+	.byte	0x7
+	.long	0xb0
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x76f
+	.uleb128 0x6
+	.long	.LASF29
+	.value	0x221
+	.byte	0x2a
+	.long	0x2ac
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x1b
+	.string	"ptr"
+	.value	0x223
+	.byte	0xb
+	.long	0xb0
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0xb
+	.long	0xf0b
+	.quad	.LBI219
+	.byte	.LVU681
+	.long	.LLRL104
+	.value	0x223
+	.byte	0x11
+	.long	0x753
+	.uleb128 0x1
+	.long	0xf1a
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x1d
+	.long	.LLRL104
+	.uleb128 0x30
+	.long	0xf26
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	0xf31
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x18
+	.long	0x12d9
+	.quad	.LBI221
+	.byte	.LVU684
+	.long	.LLRL107
+	.byte	0xf9
+	.byte	0x5
+	.long	0x711
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x18
+	.long	0x12ba
+	.quad	.LBI226
+	.byte	.LVU695
+	.long	.LLRL109
+	.byte	0xfb
+	.byte	0x5
+	.long	0x737
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST110
+	.long	.LVUS110
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL190
+	.long	0xf3d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL196
+	.long	0x3a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF65
+	.value	0x1ec
+	.byte	0x13
+	.long	0x2ac
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8ca
+	.uleb128 0x6
+	.long	.LASF42
+	.value	0x1ec
+	.byte	0x31
+	.long	0xbe
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x6
+	.long	.LASF66
+	.value	0x1ec
+	.byte	0x3f
+	.long	0x3c
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x1ec
+	.byte	0x4c
+	.long	0x3c
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x6
+	.long	.LASF43
+	.value	0x1ec
+	.byte	0x5a
+	.long	0x2bc
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x9
+	.long	.LASF29
+	.value	0x1f3
+	.byte	0x17
+	.long	0x2ac
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0xa
+	.long	0x12d9
+	.quad	.LBI207
+	.byte	.LVU637
+	.quad	.LBB207
+	.quad	.LBE207-.LBB207
+	.value	0x216
+	.byte	0x5
+	.long	0x828
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0xb
+	.long	0x12ba
+	.quad	.LBI209
+	.byte	.LVU649
+	.long	.LLRL100
+	.value	0x219
+	.byte	0x5
+	.long	0x84f
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST101
+	.long	.LVUS101
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL165
+	.long	0xc87
+	.long	0x867
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x78
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL167
+	.long	0x34a
+	.long	0x88a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x78
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL178
+	.long	0x3a9
+	.long	0x8b5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL179
+	.long	0xc60
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF68
+	.value	0x1d7
+	.byte	0x8
+	.long	0x3c
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x92a
+	.uleb128 0x1c
+	.string	"ptr"
+	.value	0x1d7
+	.byte	0x1f
+	.long	0xb0
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x9
+	.long	.LASF63
+	.value	0x1d9
+	.byte	0x12
+	.long	0x38f
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x5
+	.quad	.LVL152
+	.long	0x37a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF70
+	.value	0x1c2
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa3f
+	.uleb128 0x6
+	.long	.LASF71
+	.value	0x1c2
+	.byte	0x1d
+	.long	0xa3f
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x6
+	.long	.LASF72
+	.value	0x1c2
+	.byte	0x31
+	.long	0x91
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x9
+	.long	.LASF29
+	.value	0x1c8
+	.byte	0x17
+	.long	0x2ac
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x2c
+	.quad	.LBB200
+	.quad	.LBE200-.LBB200
+	.long	0x9d7
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x1cc
+	.byte	0x13
+	.long	0x91
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0xe
+	.quad	.LVL146
+	.long	0x37a
+	.long	0x9c2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL147
+	.long	0xd40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x12d9
+	.quad	.LBI196
+	.byte	.LVU525
+	.long	.LLRL88
+	.value	0x1ca
+	.byte	0x5
+	.long	0x9fe
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.uleb128 0xa
+	.long	0x12ba
+	.quad	.LBI201
+	.byte	.LVU541
+	.quad	.LBB201
+	.quad	.LBE201-.LBB201
+	.value	0x1d0
+	.byte	0x5
+	.long	0xa31
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL141
+	.long	0x37a
+	.byte	0
+	.uleb128 0x8
+	.long	0xb0
+	.uleb128 0x17
+	.long	.LASF73
+	.value	0x1a4
+	.byte	0xa
+	.long	0x91
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbb6
+	.uleb128 0x6
+	.long	.LASF74
+	.value	0x1a4
+	.byte	0x1f
+	.long	0x48
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x6
+	.long	.LASF71
+	.value	0x1a4
+	.byte	0x2d
+	.long	0xa3f
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x6
+	.long	.LASF72
+	.value	0x1a4
+	.byte	0x41
+	.long	0x91
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x6
+	.long	.LASF33
+	.value	0x1a4
+	.byte	0x51
+	.long	0x91
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x9
+	.long	.LASF29
+	.value	0x1aa
+	.byte	0x17
+	.long	0x2ac
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x41
+	.long	.LASF75
+	.byte	0x1
+	.value	0x1ab
+	.byte	0x12
+	.long	0x1be
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x9
+	.long	.LASF76
+	.value	0x1ac
+	.byte	0xe
+	.long	0x91
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x2b
+	.long	.LLRL81
+	.long	0xb27
+	.uleb128 0x1b
+	.string	"ptr"
+	.value	0x1b1
+	.byte	0xf
+	.long	0xb0
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x5
+	.quad	.LVL132
+	.long	0xf3d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x12d9
+	.quad	.LBI180
+	.byte	.LVU480
+	.quad	.LBB180
+	.quad	.LBE180-.LBB180
+	.value	0x1ae
+	.byte	0x5
+	.long	0xb5a
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST80
+	.long	.LVUS80
+	.byte	0
+	.uleb128 0xb
+	.long	0x12ba
+	.quad	.LBI185
+	.byte	.LVU503
+	.long	.LLRL83
+	.value	0x1ba
+	.byte	0x5
+	.long	0xb81
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.uleb128 0x2d
+	.long	0xcbc
+	.quad	.LBI189
+	.byte	.LVU513
+	.quad	.LBB189
+	.quad	.LBE189-.LBB189
+	.value	0x1a7
+	.byte	0x9
+	.uleb128 0xf
+	.long	0xcca
+	.uleb128 0x1e
+	.quad	.LVL138
+	.long	0x12f3
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF77
+	.value	0x18c
+	.byte	0x5
+	.long	0x48
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc3e
+	.uleb128 0x1c
+	.string	"ptr"
+	.value	0x18c
+	.byte	0x1d
+	.long	0xb0
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x6
+	.long	.LASF17
+	.value	0x18c
+	.byte	0x2c
+	.long	0xc3e
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x9
+	.long	.LASF63
+	.value	0x18e
+	.byte	0x12
+	.long	0x38f
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x9
+	.long	.LASF75
+	.value	0x194
+	.byte	0x12
+	.long	0x1be
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x5
+	.quad	.LVL117
+	.long	0x37a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x91
+	.uleb128 0x31
+	.long	.LASF78
+	.value	0x17f
+	.byte	0x5
+	.long	0x48
+	.long	0xc60
+	.uleb128 0x23
+	.long	.LASF66
+	.value	0x17f
+	.byte	0x1c
+	.long	0x3c
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF79
+	.byte	0x1
+	.value	0x167
+	.byte	0x6
+	.byte	0x1
+	.long	0xc87
+	.uleb128 0x32
+	.string	"ptr"
+	.value	0x167
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x14
+	.long	.LASF63
+	.value	0x16d
+	.byte	0x12
+	.long	0x38f
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF80
+	.value	0x14f
+	.byte	0x7
+	.long	0xb0
+	.long	0xcbc
+	.uleb128 0x23
+	.long	.LASF66
+	.value	0x14f
+	.byte	0x1a
+	.long	0x3c
+	.uleb128 0x14
+	.long	.LASF29
+	.value	0x159
+	.byte	0x17
+	.long	0x2ac
+	.uleb128 0x24
+	.string	"ptr"
+	.value	0x15a
+	.byte	0xb
+	.long	0xb0
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF100
+	.byte	0x1
+	.value	0x12f
+	.byte	0x6
+	.byte	0x1
+	.long	0xd0d
+	.uleb128 0x14
+	.long	.LASF74
+	.value	0x135
+	.byte	0xe
+	.long	0x91
+	.uleb128 0x33
+	.long	0xd00
+	.uleb128 0x24
+	.string	"i"
+	.value	0x137
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x11
+	.uleb128 0x14
+	.long	.LASF29
+	.value	0x138
+	.byte	0x1b
+	.long	0x2ac
+	.uleb128 0x14
+	.long	.LASF66
+	.value	0x139
+	.byte	0x10
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.string	"i"
+	.value	0x140
+	.byte	0x13
+	.long	0x91
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF85
+	.byte	0x1
+	.value	0x123
+	.byte	0xd
+	.byte	0x1
+	.long	0xd40
+	.uleb128 0x23
+	.long	.LASF75
+	.value	0x123
+	.byte	0x2b
+	.long	0x1be
+	.uleb128 0x32
+	.string	"ptr"
+	.value	0x123
+	.byte	0x38
+	.long	0xb0
+	.uleb128 0x14
+	.long	.LASF29
+	.value	0x125
+	.byte	0x17
+	.long	0x2ac
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF82
+	.value	0x105
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf0b
+	.uleb128 0x6
+	.long	.LASF75
+	.value	0x105
+	.byte	0x24
+	.long	0x1be
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1c
+	.string	"ptr"
+	.value	0x105
+	.byte	0x31
+	.long	0xb0
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x9
+	.long	.LASF29
+	.value	0x107
+	.byte	0x17
+	.long	0x2ac
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xb
+	.long	0x126e
+	.quad	.LBI95
+	.byte	.LVU195
+	.long	.LLRL27
+	.value	0x115
+	.byte	0x9
+	.long	0xdcd
+	.uleb128 0x1
+	.long	0x1287
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1
+	.long	0x127b
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0xb
+	.long	0x1294
+	.quad	.LBI98
+	.byte	.LVU213
+	.long	.LLRL30
+	.value	0x118
+	.byte	0xd
+	.long	0xe01
+	.uleb128 0x1
+	.long	0x12ad
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1
+	.long	0x12a1
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0xb
+	.long	0x126e
+	.quad	.LBI102
+	.byte	.LVU233
+	.long	.LLRL33
+	.value	0x10e
+	.byte	0x9
+	.long	0xe35
+	.uleb128 0x1
+	.long	0x1287
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x127b
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0xa
+	.long	0x1294
+	.quad	.LBI105
+	.byte	.LVU248
+	.quad	.LBB105
+	.quad	.LBE105-.LBB105
+	.value	0x10f
+	.byte	0x9
+	.long	0xe75
+	.uleb128 0x1
+	.long	0x12ad
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0x12a1
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0x45
+	.long	0x11b4
+	.long	.LLRL38
+	.byte	0x1
+	.value	0x11b
+	.byte	0xd
+	.uleb128 0x13
+	.long	0x11cd
+	.uleb128 0x13
+	.long	0x11c1
+	.uleb128 0x1d
+	.long	.LLRL38
+	.uleb128 0xf
+	.long	0x11d9
+	.uleb128 0x1f
+	.long	0x11e4
+	.quad	.LBB109
+	.quad	.LBE109-.LBB109
+	.long	0xef3
+	.uleb128 0x4
+	.long	0x11e5
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x25
+	.long	0x11ee
+	.long	.LLRL40
+	.uleb128 0x4
+	.long	0x11ef
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x5
+	.quad	.LVL60
+	.long	0x37a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xd
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x3c
+	.byte	0x24
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL65
+	.long	0x369
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF88
+	.byte	0xf5
+	.byte	0xe
+	.long	0xb0
+	.long	0xf3d
+	.uleb128 0xc
+	.long	.LASF29
+	.byte	0x1
+	.byte	0xf5
+	.byte	0x32
+	.long	0x2ac
+	.uleb128 0x10
+	.long	.LASF75
+	.byte	0xf7
+	.byte	0x12
+	.long	0x1be
+	.uleb128 0x20
+	.string	"ptr"
+	.byte	0xfa
+	.byte	0xb
+	.long	0xb0
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF101
+	.byte	0x1
+	.byte	0xcf
+	.byte	0xe
+	.long	0xb0
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11aa
+	.uleb128 0x35
+	.long	.LASF29
+	.byte	0xcf
+	.byte	0x2b
+	.long	0x2ac
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x35
+	.long	.LASF83
+	.byte	0xcf
+	.byte	0x41
+	.long	0x11aa
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x36
+	.long	.LASF75
+	.byte	0xd1
+	.byte	0x12
+	.long	0x1be
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x36
+	.long	.LASF84
+	.byte	0xe4
+	.byte	0xe
+	.long	0x11af
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x18
+	.long	0x126e
+	.quad	.LBI64
+	.byte	.LVU37
+	.long	.LLRL5
+	.byte	0xea
+	.byte	0x9
+	.long	0xfde
+	.uleb128 0x1
+	.long	0x1287
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x127b
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x26
+	.long	0x1294
+	.quad	.LBI67
+	.byte	.LVU52
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.byte	0xeb
+	.byte	0x9
+	.long	0x101d
+	.uleb128 0x1
+	.long	0x12ad
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x12a1
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x18
+	.long	0x126e
+	.quad	.LBI69
+	.byte	.LVU71
+	.long	.LLRL10
+	.byte	0xd7
+	.byte	0xd
+	.long	0x1050
+	.uleb128 0x1
+	.long	0x1287
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0x127b
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x26
+	.long	0x1294
+	.quad	.LBI72
+	.byte	.LVU88
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.byte	0xe1
+	.byte	0x9
+	.long	0x108f
+	.uleb128 0x1
+	.long	0x12ad
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x12a1
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0x47
+	.long	0x11fd
+	.quad	.LBI76
+	.byte	.LVU109
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.byte	0x1
+	.byte	0xda
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x120c
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x4
+	.long	0x1218
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.long	0x1223
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x4
+	.long	0x122e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1f
+	.long	0x1239
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.long	0x113e
+	.uleb128 0x4
+	.long	0x123e
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x37
+	.long	0x1247
+	.quad	.LBB79
+	.quad	.LBE79-.LBB79
+	.uleb128 0x4
+	.long	0x1248
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x48
+	.quad	.LVL32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1255
+	.quad	.LBB80
+	.quad	.LBE80-.LBB80
+	.long	0x119b
+	.uleb128 0x4
+	.long	0x1256
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x25
+	.long	0x125f
+	.long	.LLRL22
+	.uleb128 0x4
+	.long	0x1260
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x5
+	.quad	.LVL39
+	.long	0x37a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xd
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x3c
+	.byte	0x24
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL25
+	.long	0x394
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x1be
+	.uleb128 0x8
+	.long	0x6b
+	.uleb128 0x19
+	.long	.LASF86
+	.byte	0x1
+	.byte	0xbd
+	.byte	0xd
+	.byte	0x1
+	.long	0x11fd
+	.uleb128 0xc
+	.long	.LASF29
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x2d
+	.long	0x2ac
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x42
+	.long	0x1be
+	.uleb128 0x10
+	.long	.LASF87
+	.byte	0xbf
+	.byte	0xe
+	.long	0x11af
+	.uleb128 0x11
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xc1
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x11
+	.uleb128 0x10
+	.long	.LASF63
+	.byte	0xc2
+	.byte	0x16
+	.long	0x38f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF89
+	.byte	0x95
+	.byte	0x15
+	.long	0x1be
+	.long	0x126e
+	.uleb128 0xc
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x95
+	.byte	0x34
+	.long	0x2ac
+	.uleb128 0x10
+	.long	.LASF87
+	.byte	0x97
+	.byte	0xe
+	.long	0x11af
+	.uleb128 0x10
+	.long	.LASF75
+	.byte	0x9c
+	.byte	0x12
+	.long	0x1be
+	.uleb128 0x10
+	.long	.LASF90
+	.byte	0xa4
+	.byte	0xe
+	.long	0x11af
+	.uleb128 0x33
+	.long	0x1255
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xa5
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x11
+	.uleb128 0x10
+	.long	.LASF84
+	.byte	0xa6
+	.byte	0x12
+	.long	0x11af
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xb0
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x11
+	.uleb128 0x10
+	.long	.LASF63
+	.byte	0xb1
+	.byte	0x16
+	.long	0x38f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x84
+	.byte	0x14
+	.byte	0x3
+	.long	0x1294
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x84
+	.byte	0x34
+	.long	0x11aa
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x1
+	.byte	0x84
+	.byte	0x49
+	.long	0x1be
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF93
+	.byte	0x1
+	.byte	0x75
+	.byte	0x14
+	.byte	0x3
+	.long	0x12ba
+	.uleb128 0xc
+	.long	.LASF92
+	.byte	0x1
+	.byte	0x75
+	.byte	0x32
+	.long	0x11aa
+	.uleb128 0xc
+	.long	.LASF75
+	.byte	0x1
+	.byte	0x75
+	.byte	0x47
+	.long	0x1be
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF94
+	.byte	0x2
+	.byte	0x22
+	.byte	0x14
+	.byte	0x3
+	.long	0x12d4
+	.uleb128 0xc
+	.long	.LASF95
+	.byte	0x2
+	.byte	0x22
+	.byte	0x30
+	.long	0x12d4
+	.byte	0
+	.uleb128 0x8
+	.long	0x14b
+	.uleb128 0x19
+	.long	.LASF96
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.long	0x12f3
+	.uleb128 0xc
+	.long	.LASF95
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x12d4
+	.byte	0
+	.uleb128 0x21
+	.long	0xcbc
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x138a
+	.uleb128 0x4
+	.long	0xcca
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1f
+	.long	0xcd6
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.long	0x1366
+	.uleb128 0x4
+	.long	0xcdb
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x25
+	.long	0xce5
+	.long	.LLRL44
+	.uleb128 0x4
+	.long	0xce6
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x4
+	.long	0xcf2
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0xd00
+	.quad	.LBB119
+	.quad	.LBE119-.LBB119
+	.uleb128 0x4
+	.long	0xd01
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	0xcbc
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13b8
+	.uleb128 0xf
+	.long	0xcca
+	.uleb128 0x49
+	.quad	.LVL78
+	.long	0x12f3
+	.byte	0
+	.uleb128 0x21
+	.long	0xc87
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1581
+	.uleb128 0x1
+	.long	0xc97
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0xf
+	.long	0xca3
+	.uleb128 0xf
+	.long	0xcaf
+	.uleb128 0xb
+	.long	0xc87
+	.quad	.LBI135
+	.byte	.LVU340
+	.long	.LLRL49
+	.value	0x14f
+	.byte	0x7
+	.long	0x1533
+	.uleb128 0x1
+	.long	0xc97
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x1d
+	.long	.LLRL49
+	.uleb128 0x4
+	.long	0xca3
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x4
+	.long	0xcaf
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xb
+	.long	0xc43
+	.quad	.LBI137
+	.byte	.LVU342
+	.long	.LLRL53
+	.value	0x159
+	.byte	0x2e
+	.long	0x1456
+	.uleb128 0x1
+	.long	0xc53
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0xa
+	.long	0xf0b
+	.quad	.LBI141
+	.byte	.LVU352
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.value	0x15a
+	.byte	0x11
+	.long	0x1510
+	.uleb128 0x1
+	.long	0xf1a
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x30
+	.long	0xf26
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	0xf31
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x26
+	.long	0x12d9
+	.quad	.LBI143
+	.byte	.LVU355
+	.quad	.LBB143
+	.quad	.LBE143-.LBB143
+	.byte	0xf9
+	.byte	0x5
+	.long	0x14cf
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.uleb128 0x18
+	.long	0x12ba
+	.quad	.LBI145
+	.byte	.LVU365
+	.long	.LLRL58
+	.byte	0xfb
+	.byte	0x5
+	.long	0x14f5
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL85
+	.long	0xf3d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL96
+	.long	0x3a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0xcbc
+	.quad	.LBI150
+	.byte	.LVU383
+	.quad	.LBB150
+	.quad	.LBE150-.LBB150
+	.value	0x152
+	.byte	0x9
+	.long	0x156b
+	.uleb128 0xf
+	.long	0xcca
+	.uleb128 0x1e
+	.quad	.LVL93
+	.long	0x12f3
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL92
+	.long	0x3bb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	0xc60
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16ff
+	.uleb128 0x1
+	.long	0xc6e
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x4
+	.long	0xc7a
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xa
+	.long	0xd0d
+	.quad	.LBI161
+	.byte	.LVU405
+	.quad	.LBB161
+	.quad	.LBE161-.LBB161
+	.value	0x176
+	.byte	0x9
+	.long	0x167d
+	.uleb128 0x1
+	.long	0xd27
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x1
+	.long	0xd1b
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x4
+	.long	0xd33
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xa
+	.long	0x12d9
+	.quad	.LBI163
+	.byte	.LVU408
+	.quad	.LBB163
+	.quad	.LBE163-.LBB163
+	.value	0x127
+	.byte	0x5
+	.long	0x1635
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0xa
+	.long	0x12ba
+	.quad	.LBI165
+	.byte	.LVU416
+	.quad	.LBB165
+	.quad	.LBE165-.LBB165
+	.value	0x129
+	.byte	0x5
+	.long	0x1668
+	.uleb128 0x1
+	.long	0x12c7
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL103
+	.long	0xd40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xc60
+	.quad	.LBI167
+	.byte	.LVU428
+	.long	.LLRL67
+	.value	0x167
+	.byte	0x6
+	.long	0x16d1
+	.uleb128 0x1
+	.long	0xc6e
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x1d
+	.long	.LLRL67
+	.uleb128 0xf
+	.long	0xc7a
+	.uleb128 0x16
+	.quad	.LVL112
+	.long	0x3a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL99
+	.long	0x37a
+	.long	0x16e9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL109
+	.long	0x369
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.long	0xc43
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0xc53
+	.long	.LLST69
+	.long	.LVUS69
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS116:
+	.uleb128 .LVU747
+	.uleb128 .LVU749
+	.uleb128 .LVU749
+	.uleb128 .LVU751
+	.uleb128 .LVU751
+	.uleb128 .LVU752
+	.uleb128 .LVU752
+	.uleb128 .LVU753
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x16
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL215-1-.Ltext0
+	.uleb128 0x16
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-1-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x16
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes+120
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU760
+	.uleb128 .LVU770
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU766
+	.uleb128 .LVU768
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	named_caches_lock
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU718
+	.uleb128 .LVU718
+	.uleb128 .LVU729
+	.uleb128 .LVU729
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU743
+	.uleb128 .LVU743
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU720
+	.uleb128 .LVU720
+	.uleb128 .LVU731
+	.uleb128 .LVU731
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU742
+	.uleb128 .LVU742
+	.uleb128 .LVU743
+	.uleb128 .LVU743
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL201-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL201-1-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL205-1-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU720
+	.uleb128 .LVU728
+	.uleb128 .LVU732
+	.uleb128 .LVU733
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU737
+	.uleb128 .LVU739
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS102:
+	.uleb128 0
+	.uleb128 .LVU691
+	.uleb128 .LVU691
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 .LVU705
+	.uleb128 .LVU705
+	.uleb128 .LVU709
+	.uleb128 .LVU709
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU699
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU681
+	.uleb128 .LVU691
+	.uleb128 .LVU691
+	.uleb128 .LVU699
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU694
+	.uleb128 .LVU699
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU684
+	.uleb128 .LVU688
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU695
+	.uleb128 .LVU697
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 0
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU656
+	.uleb128 .LVU656
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU574
+	.uleb128 .LVU574
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU581
+	.uleb128 .LVU581
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU659
+	.uleb128 .LVU661
+	.uleb128 .LVU673
+	.uleb128 .LVU675
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS97:
+	.uleb128 0
+	.uleb128 .LVU582
+	.uleb128 .LVU582
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU674
+	.uleb128 .LVU674
+	.uleb128 .LVU675
+	.uleb128 .LVU675
+	.uleb128 0
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU587
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU670
+	.uleb128 .LVU675
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL167-1-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU637
+	.uleb128 .LVU642
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	named_caches_lock
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU649
+	.uleb128 .LVU653
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	named_caches_lock
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 0
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 0
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL152-1-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU550
+	.uleb128 .LVU556
+	.uleb128 .LVU559
+	.uleb128 .LVU561
+	.uleb128 .LVU563
+	.uleb128 .LVU564
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 0
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL141-1-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU524
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU545
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU533
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU539
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU525
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU533
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS76:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS77:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 0
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU477
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU512
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x18
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x3f
+	.byte	0x1e
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU479
+	.uleb128 .LVU488
+	.uleb128 .LVU488
+	.uleb128 .LVU491
+	.uleb128 .LVU491
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU502
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU488
+	.uleb128 .LVU498
+	.uleb128 .LVU500
+	.uleb128 .LVU502
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU480
+	.uleb128 .LVU485
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x16
+	.byte	0x79
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x78
+	.byte	0x1e
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU503
+	.uleb128 .LVU507
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x17
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x78
+	.byte	0x1e
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 0
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL117-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU451
+	.uleb128 .LVU459
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU456
+	.uleb128 .LVU462
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-1-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU178
+	.uleb128 .LVU231
+	.uleb128 .LVU232
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU195
+	.uleb128 .LVU208
+	.uleb128 .LVU282
+	.uleb128 .LVU285
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU195
+	.uleb128 .LVU208
+	.uleb128 .LVU282
+	.uleb128 .LVU285
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU213
+	.uleb128 .LVU226
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU213
+	.uleb128 .LVU226
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 80
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU233
+	.uleb128 .LVU246
+	.uleb128 .LVU285
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU233
+	.uleb128 .LVU246
+	.uleb128 .LVU285
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 72
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 72
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU248
+	.uleb128 .LVU261
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU248
+	.uleb128 .LVU261
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU261
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU269
+	.uleb128 .LVU275
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU16
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU114
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU20
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU65
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU37
+	.uleb128 .LVU50
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU37
+	.uleb128 .LVU50
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU52
+	.uleb128 .LVU65
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU52
+	.uleb128 .LVU65
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 72
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU71
+	.uleb128 .LVU84
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU71
+	.uleb128 .LVU84
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 80
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU88
+	.uleb128 .LVU101
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU88
+	.uleb128 .LVU101
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 64
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU109
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU114
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU117
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU172
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU130
+	.uleb128 .LVU172
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU138
+	.uleb128 .LVU150
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU150
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU160
+	.uleb128 .LVU166
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU315
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU311
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x16
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes+8
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x16
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes+128
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU291
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU314
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x29
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes+8
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x78
+	.byte	0x1e
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x29
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	size_classes+128
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x78
+	.byte	0x1e
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU293
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU314
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -120
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU315
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0xd
+	.byte	0x78
+	.sleb128 0
+	.byte	0x3
+	.quad	size_class_index
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0xf
+	.byte	0x78
+	.sleb128 0
+	.byte	0x3
+	.quad	size_class_index
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL93-1-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU340
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU376
+	.uleb128 .LVU386
+	.uleb128 .LVU389
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU351
+	.uleb128 .LVU374
+	.uleb128 .LVU386
+	.uleb128 .LVU389
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU369
+	.uleb128 .LVU376
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU389
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU342
+	.uleb128 .LVU345
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU352
+	.uleb128 .LVU369
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU364
+	.uleb128 .LVU369
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU355
+	.uleb128 .LVU357
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x43
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x31
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x3
+	.quad	size_class_index
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x78
+	.byte	0x1e
+	.byte	0x3
+	.quad	size_classes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU365
+	.uleb128 .LVU367
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL99-1-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU399
+	.uleb128 .LVU411
+	.uleb128 .LVU422
+	.uleb128 .LVU427
+	.uleb128 .LVU428
+	.uleb128 .LVU434
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU405
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU422
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU405
+	.uleb128 .LVU415
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU407
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU420
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU408
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU413
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU416
+	.uleb128 .LVU418
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU428
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU440
+	.uleb128 .LVU440
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE13-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB95-.Ltext0
+	.uleb128 .LBE95-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB199-.Ltext0
+	.uleb128 .LBE199-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB212-.Ltext0
+	.uleb128 .LBE212-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB232-.Ltext0
+	.uleb128 .LBE232-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB224-.Ltext0
+	.uleb128 .LBE224-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB226-.Ltext0
+	.uleb128 .LBE226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0
+.LLRL115:
+	.byte	0x4
+	.uleb128 .LBB252-.Ltext0
+	.uleb128 .LBE252-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF48:
+	.string	"num_slabs"
+.LASF32:
+	.string	"capacity"
+.LASF27:
+	.string	"pNext"
+.LASF81:
+	.string	"_kmem_cache_print"
+.LASF8:
+	.string	"size_t"
+.LASF15:
+	.string	"uint64_t"
+.LASF52:
+	.string	"size_classes"
+.LASF58:
+	.string	"kmem_page"
+.LASF68:
+	.string	"slab_usable_size"
+.LASF94:
+	.string	"spinlock_unlock"
+.LASF69:
+	.string	"kmem_cache_free"
+.LASF99:
+	.string	"kmem_cache_report"
+.LASF53:
+	.string	"size_class_index"
+.LASF4:
+	.string	"long long int"
+.LASF6:
+	.string	"signed char"
+.LASF64:
+	.string	"kmem_cache_alloc"
+.LASF49:
+	.string	"allocs"
+.LASF80:
+	.string	"slab_malloc"
+.LASF75:
+	.string	"pSlab"
+.LASF3:
+	.string	"long int"
+.LASF26:
+	.string	"spinlock_t"
+.LASF65:
+	.string	"kmem_cache_create"
+.LASF51:
+	.string	"pNextCache"
+.LASF11:
+	.string	"uint16_t"
+.LASF60:
+	.string	"kfree"
+.LASF63:
+	.string	"pPage"
+.LASF78:
+	.string	"slab_size_class"
+.LASF42:
+	.string	"pName"
+.LASF50:
+	.string	"frees"
+.LASF72:
+	.string	"count"
+.LASF86:
+	.string	"_slab_destroy"
+.LASF76:
+	.string	"taken"
+.LASF67:
+	.string	"align"
+.LASF70:
+	.string	"slab_free_batch"
+.LASF97:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF14:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF98:
+	.string	"page"
+.LASF89:
+	.string	"_slab_create"
+.LASF56:
+	.string	"named_caches_lock"
+.LASF66:
+	.string	"size"
+.LASF12:
+	.string	"short unsigned int"
+.LASF45:
+	.string	"pFull"
+.LASF83:
+	.string	"ppSlab"
+.LASF35:
+	.string	"SlabCache"
+.LASF92:
+	.string	"ppList"
+.LASF43:
+	.string	"ctor"
+.LASF77:
+	.string	"slab_object_class"
+.LASF73:
+	.string	"slab_alloc_batch"
+.LASF17:
+	.string	"pOwner"
+.LASF5:
+	.string	"long double"
+.LASF31:
+	.string	"inuse"
+.LASF85:
+	.string	"_slab_cache_free"
+.LASF91:
+	.string	"_slab_list_remove"
+.LASF71:
+	.string	"ppObjects"
+.LASF21:
+	.string	"lru_prev"
+.LASF44:
+	.string	"pPartial"
+.LASF59:
+	.string	"kpalloc"
+.LASF101:
+	.string	"_slab_take"
+.LASF74:
+	.string	"class"
+.LASF38:
+	.string	"objects_per_slab"
+.LASF20:
+	.string	"lru_next"
+.LASF61:
+	.string	"kprintf"
+.LASF82:
+	.string	"_slab_put"
+.LASF24:
+	.string	"_Bool"
+.LASF18:
+	.string	"pages_allocated"
+.LASF10:
+	.string	"unsigned char"
+.LASF95:
+	.string	"pLock"
+.LASF41:
+	.string	"free_offset"
+.LASF7:
+	.string	"short int"
+.LASF96:
+	.string	"spinlock_lock"
+.LASF84:
+	.string	"pObject"
+.LASF100:
+	.string	"slab_init"
+.LASF90:
+	.string	"pObjects"
+.LASF40:
+	.string	"stride"
+.LASF54:
+	.string	"_slab_ready"
+.LASF13:
+	.string	"uint32_t"
+.LASF29:
+	.string	"pCache"
+.LASF79:
+	.string	"slab_free"
+.LASF33:
+	.string	"owner"
+.LASF16:
+	.string	"char"
+.LASF47:
+	.string	"num_empty"
+.LASF34:
+	.string	"Slab"
+.LASF62:
+	.string	"kalloc"
+.LASF93:
+	.string	"_slab_list_push"
+.LASF23:
+	.string	"index"
+.LASF87:
+	.string	"pPages"
+.LASF37:
+	.string	"slab_pages"
+.LASF30:
+	.string	"pFree"
+.LASF36:
+	.string	"object_size"
+.LASF57:
+	.string	"memset"
+.LASF39:
+	.string	"objects_offset"
+.LASF9:
+	.string	"uint8_t"
+.LASF22:
+	.string	"flags"
+.LASF46:
+	.string	"pEmpty"
+.LASF28:
+	.string	"pPrev"
+.LASF25:
+	.string	"lock"
+.LASF88:
+	.string	"_slab_cache_alloc"
+.LASF19:
+	.string	"refcount"
+.LASF55:
+	.string	"pNamedCaches"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc/slab.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
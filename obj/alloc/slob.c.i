@@ -0,0 +1,976 @@
+# 0 "src/alloc/slob.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/alloc/slob.c"
+# 26 "src/alloc/slob.c"
+# 1 "src/include/slob.h" 1
+# 21 "src/include/slob.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 22 "src/include/slob.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/slob.h" 2
+
+
+# 24 "src/include/slob.h"
+void slob_init();
+void *slob_malloc(size_t size);
+void slob_free(void *ptr);
+size_t slob_usable_size(void *ptr);
+
+# 28 "src/include/slob.h" 3 4
+_Bool 
+# 28 "src/include/slob.h"
+    slob_grow_in_place(void *ptr, size_t size);
+# 27 "src/alloc/slob.c" 2
+# 1 "src/include/str.h" 1
+# 21 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 22 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 28 "src/alloc/slob.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 29 "src/alloc/slob.c" 2
+# 1 "src/include/math.h" 1
+# 30 "src/alloc/slob.c" 2
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 31 "src/alloc/slob.c" 2
+
+
+
+struct SlobEntry {
+    struct SlobEntry *pNext;
+    size_t length;
+};
+
+
+struct SlobHeader {
+    uint64_t length;
+} __attribute__((packed));
+
+
+
+
+
+
+
+static uint8_t _init = 0;
+struct SlobEntry *pHead = 0;
+spinlock_t slob_lock = {0};
+
+
+
+
+
+void _slob_insert(void *pBlock, size_t length)
+{
+    struct SlobEntry *pEntry = (struct SlobEntry*)pBlock;
+    struct SlobEntry *pPrev = 0;
+    struct SlobEntry *pNext = pHead;
+
+    while (pNext != 0 && pNext < pEntry) {
+        pPrev = pNext;
+        pNext = pNext->pNext;
+    }
+
+    pEntry->length = length;
+    pEntry->pNext = pNext;
+
+
+    if (pNext != 0 && (uint8_t*)pEntry + pEntry->length == (uint8_t*)pNext) {
+        pEntry->length += pNext->length;
+        pEntry->pNext = pNext->pNext;
+    }
+
+
+    if (pPrev != 0 && (uint8_t*)pPrev + pPrev->length == (uint8_t*)pEntry) {
+        pPrev->length += pEntry->length;
+        pPrev->pNext = pEntry->pNext;
+    } else if (pPrev != 0) {
+        pPrev->pNext = pEntry;
+    } else {
+        pHead = pEntry;
+    }
+}
+
+
+
+
+
+
+# 93 "src/alloc/slob.c" 3 4
+_Bool 
+# 93 "src/alloc/slob.c"
+    _slob_grow(size_t length)
+{
+    uint64_t numPages = (((((length) + (4096) - 1) / (4096))) > (64) ? ((((length) + (4096) - 1) / (4096))) : (64));
+
+    void *pChunk = kpalloc(numPages);
+    if (pChunk == 
+# 98 "src/alloc/slob.c" 3 4
+                 ((void *)0)
+# 98 "src/alloc/slob.c"
+                     ) {
+        return 
+# 99 "src/alloc/slob.c" 3 4
+              0
+# 99 "src/alloc/slob.c"
+                   ;
+    }
+
+    _slob_insert(pChunk, numPages * 4096);
+    return 
+# 103 "src/alloc/slob.c" 3 4
+          1
+# 103 "src/alloc/slob.c"
+              ;
+}
+
+
+
+
+
+void slob_init()
+{
+    spinlock_lock(&slob_lock);
+
+    if (_init == 0) {
+        _init = 1;
+        _slob_grow(0);
+    }
+
+    spinlock_unlock(&slob_lock);
+}
+
+
+
+
+
+
+void *slob_malloc(size_t size)
+{
+    if (_init == 0) {
+        slob_init();
+    }
+
+    uint64_t totalSize = (((sizeof(struct SlobHeader) + size) + (sizeof(struct SlobEntry)) - 1) / (sizeof(struct SlobEntry))) * (sizeof(struct SlobEntry));
+
+    spinlock_lock(&slob_lock);
+
+    while (
+# 137 "src/alloc/slob.c" 3 4
+          1
+# 137 "src/alloc/slob.c"
+              ) {
+        struct SlobEntry *pPrev = 0;
+        struct SlobEntry *pNext = pHead;
+
+        while (pNext != 0 && pNext->length < totalSize) {
+            pPrev = pNext;
+            pNext = pNext->pNext;
+        }
+
+        if (pNext == 0) {
+
+            if (!_slob_grow(totalSize)) {
+                break;
+            }
+
+            continue;
+        }
+
+        uint8_t *pBlock;
+
+        if (pNext->length - totalSize < sizeof(struct SlobEntry)) {
+
+            totalSize = pNext->length;
+            pBlock = (uint8_t*)pNext;
+
+            if (pPrev != 0) {
+                pPrev->pNext = pNext->pNext;
+            } else {
+                pHead = pNext->pNext;
+            }
+        } else {
+            pNext->length -= totalSize;
+            pBlock = (uint8_t*)pNext + pNext->length;
+        }
+
+        spinlock_unlock(&slob_lock);
+
+        struct SlobHeader *pHeader = (struct SlobHeader*)pBlock;
+        pHeader->length = totalSize;
+
+
+        return pBlock + sizeof(struct SlobHeader);
+    }
+
+    spinlock_unlock(&slob_lock);
+
+    kprintf("No memory available!\n");
+    return 0;
+}
+
+
+
+
+
+void slob_free(void *ptr)
+{
+    if (ptr == 0) {
+        return;
+    }
+
+
+    struct SlobHeader *pHeader = (struct SlobHeader*)((uint8_t*)ptr - sizeof(struct SlobHeader));
+
+    spinlock_lock(&slob_lock);
+    _slob_insert(pHeader, pHeader->length);
+    spinlock_unlock(&slob_lock);
+}
+
+
+
+
+size_t slob_usable_size(void *ptr)
+{
+    struct SlobHeader *pHeader = (struct SlobHeader*)((uint8_t*)ptr - sizeof(struct SlobHeader));
+    return pHeader->length - sizeof(struct SlobHeader);
+}
+
+
+
+
+
+
+# 218 "src/alloc/slob.c" 3 4
+_Bool 
+# 218 "src/alloc/slob.c"
+    slob_grow_in_place(void *ptr, size_t size)
+{
+    struct SlobHeader *pHeader = (struct SlobHeader*)((uint8_t*)ptr - sizeof(struct SlobHeader));
+    uint64_t totalSize = (((sizeof(struct SlobHeader) + size) + (sizeof(struct SlobEntry)) - 1) / (sizeof(struct SlobEntry))) * (sizeof(struct SlobEntry));
+
+    if (totalSize <= pHeader->length) {
+        return 
+# 224 "src/alloc/slob.c" 3 4
+              1
+# 224 "src/alloc/slob.c"
+                  ;
+    }
+
+    uint64_t extra = totalSize - pHeader->length;
+    struct SlobEntry *pEnd = (struct SlobEntry*)((uint8_t*)pHeader + pHeader->length);
+
+    spinlock_lock(&slob_lock);
+
+    struct SlobEntry *pPrev = 0;
+    struct SlobEntry *pNext = pHead;
+
+    while (pNext != 0 && pNext < pEnd) {
+        pPrev = pNext;
+        pNext = pNext->pNext;
+    }
+
+    if (pNext != pEnd || pNext->length < extra) {
+        spinlock_unlock(&slob_lock);
+        return 
+# 242 "src/alloc/slob.c" 3 4
+              0
+# 242 "src/alloc/slob.c"
+                   ;
+    }
+
+    struct SlobEntry *pFollowing = pNext->pNext;
+    size_t remaining = pNext->length - extra;
+
+    if (remaining < sizeof(struct SlobEntry)) {
+
+        pHeader->length += pNext->length;
+    } else {
+
+        pNext = (struct SlobEntry*)((uint8_t*)pEnd + extra);
+        pNext->length = remaining;
+        pNext->pNext = pFollowing;
+        pFollowing = pNext;
+        pHeader->length = totalSize;
+    }
+
+    if (pPrev != 0) {
+        pPrev->pNext = pFollowing;
+    } else {
+        pHead = pFollowing;
+    }
+
+    spinlock_unlock(&slob_lock);
+    return 
+# 267 "src/alloc/slob.c" 3 4
+          1
+# 267 "src/alloc/slob.c"
+              ;
+}
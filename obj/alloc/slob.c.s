@@ -0,0 +1,3679 @@
+	.file	"slob.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc/slob.c"
+	.p2align 4
+	.globl	_slob_insert
+	.type	_slob_insert, @function
+_slob_insert:
+.LVL0:
+.LFB2:
+	.file 1 "src/alloc/slob.c"
+	.loc 1 59 1 view -0
+	.cfi_startproc
+	.loc 1 60 5 view .LVU1
+	.loc 1 61 5 view .LVU2
+	.loc 1 62 5 view .LVU3
+	.loc 1 62 23 is_stmt 0 view .LVU4
+	movq	pHead(%rip), %rax
+.LVL1:
+	.loc 1 64 5 is_stmt 1 view .LVU5
+	.loc 1 64 23 view .LVU6
+	cmpq	%rdi, %rax
+	jnb	.L2
+	testq	%rax, %rax
+	je	.L2
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 65 9 view .LVU7
+	.loc 1 66 9 view .LVU8
+	movq	%rax, %rdx
+	.loc 1 66 15 is_stmt 0 view .LVU9
+	movq	(%rax), %rax
+.LVL3:
+	.loc 1 64 23 is_stmt 1 view .LVU10
+	testq	%rax, %rax
+	je	.L5
+	cmpq	%rdi, %rax
+	jb	.L3
+.L5:
+	.loc 1 69 5 view .LVU11
+	.loc 1 69 20 is_stmt 0 view .LVU12
+	movq	%rsi, 8(%rdi)
+	.loc 1 70 5 is_stmt 1 view .LVU13
+	.loc 1 70 19 is_stmt 0 view .LVU14
+	movq	%rax, (%rdi)
+	.loc 1 73 5 is_stmt 1 view .LVU15
+	.loc 1 73 8 is_stmt 0 view .LVU16
+	testq	%rax, %rax
+	je	.L9
+	.loc 1 73 40 view .LVU17
+	leaq	(%rdi,%rsi), %rcx
+	.loc 1 73 20 view .LVU18
+	cmpq	%rcx, %rax
+	je	.L25
+.L9:
+	.loc 1 79 46 discriminator 1 view .LVU19
+	movq	8(%rdx), %rax
+.LVL4:
+	.loc 1 79 39 discriminator 1 view .LVU20
+	leaq	(%rdx,%rax), %rcx
+	.loc 1 79 20 discriminator 1 view .LVU21
+	cmpq	%rcx, %rdi
+	je	.L26
+.LVL5:
+.L10:
+	.loc 1 82 12 is_stmt 1 view .LVU22
+	.loc 1 83 9 view .LVU23
+	.loc 1 83 22 is_stmt 0 view .LVU24
+	movq	%rdi, (%rdx)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.loc 1 80 9 is_stmt 1 view .LVU25
+	.loc 1 80 23 is_stmt 0 view .LVU26
+	addq	8(%rdi), %rax
+	movq	%rax, 8(%rdx)
+	.loc 1 81 9 is_stmt 1 view .LVU27
+	.loc 1 81 30 is_stmt 0 view .LVU28
+	movq	(%rdi), %rax
+	.loc 1 81 22 view .LVU29
+	movq	%rax, (%rdx)
+	ret
+.LVL6:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 74 9 is_stmt 1 view .LVU30
+	.loc 1 74 24 is_stmt 0 view .LVU31
+	addq	8(%rax), %rsi
+.LVL7:
+	.loc 1 75 30 view .LVU32
+	movq	(%rax), %rax
+.LVL8:
+	.loc 1 74 24 view .LVU33
+	movq	%rsi, 8(%rdi)
+.LVL9:
+	.loc 1 75 9 is_stmt 1 view .LVU34
+	.loc 1 75 23 is_stmt 0 view .LVU35
+	movq	%rax, (%rdi)
+.LVL10:
+	.loc 1 79 5 is_stmt 1 view .LVU36
+	.loc 1 79 46 is_stmt 0 view .LVU37
+	movq	8(%rdx), %rax
+	.loc 1 79 39 view .LVU38
+	leaq	(%rdx,%rax), %rcx
+	.loc 1 79 20 view .LVU39
+	cmpq	%rcx, %rdi
+	jne	.L10
+	jmp	.L26
+.LVL11:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 69 5 is_stmt 1 view .LVU40
+	.loc 1 69 20 is_stmt 0 view .LVU41
+	movq	%rsi, 8(%rdi)
+	.loc 1 70 5 is_stmt 1 view .LVU42
+	.loc 1 70 19 is_stmt 0 view .LVU43
+	movq	%rax, (%rdi)
+	.loc 1 73 5 is_stmt 1 view .LVU44
+	.loc 1 73 8 is_stmt 0 view .LVU45
+	testq	%rax, %rax
+	je	.L7
+	.loc 1 73 40 view .LVU46
+	leaq	(%rdi,%rsi), %rdx
+	.loc 1 73 20 view .LVU47
+	cmpq	%rdx, %rax
+	je	.L27
+.LVL12:
+.L7:
+	.loc 1 82 12 is_stmt 1 view .LVU48
+	.loc 1 85 9 view .LVU49
+	.loc 1 85 15 is_stmt 0 view .LVU50
+	movq	%rdi, pHead(%rip)
+.LVL13:
+	.loc 1 87 1 view .LVU51
+	ret
+.LVL14:
+.L27:
+	.loc 1 74 9 is_stmt 1 view .LVU52
+	.loc 1 74 24 is_stmt 0 view .LVU53
+	addq	8(%rax), %rsi
+.LVL15:
+	.loc 1 75 30 view .LVU54
+	movq	(%rax), %rax
+.LVL16:
+	.loc 1 74 24 view .LVU55
+	movq	%rsi, 8(%rdi)
+.LVL17:
+	.loc 1 75 9 is_stmt 1 view .LVU56
+	.loc 1 75 23 is_stmt 0 view .LVU57
+	movq	%rax, (%rdi)
+	.loc 1 79 5 is_stmt 1 view .LVU58
+	jmp	.L7
+	.cfi_endproc
+.LFE2:
+	.size	_slob_insert, .-_slob_insert
+	.p2align 4
+	.globl	_slob_grow
+	.type	_slob_grow, @function
+_slob_grow:
+.LVL18:
+.LFB3:
+	.loc 1 94 1 view -0
+	.cfi_startproc
+	.loc 1 95 5 view .LVU60
+	.loc 1 95 47 is_stmt 0 view .LVU61
+	addq	$4095, %rdi
+.LVL19:
+	.loc 1 94 1 view .LVU62
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 95 109 view .LVU63
+	movl	$64, %eax
+	movq	%rdi, %rbx
+	shrq	$12, %rbx
+	cmpq	$266239, %rdi
+	cmovbe	%rax, %rbx
+.LVL20:
+	.loc 1 97 5 is_stmt 1 view .LVU64
+	.loc 1 97 20 is_stmt 0 view .LVU65
+	movq	%rbx, %rdi
+.LVL21:
+	.loc 1 97 20 view .LVU66
+	call	kpalloc@PLT
+.LVL22:
+	movq	%rax, %rdi
+.LVL23:
+	.loc 1 98 5 is_stmt 1 view .LVU67
+	xorl	%eax, %eax
+.LVL24:
+	.loc 1 98 8 is_stmt 0 view .LVU68
+	testq	%rdi, %rdi
+	je	.L28
+	.loc 1 102 5 is_stmt 1 view .LVU69
+	movq	%rbx, %rsi
+	salq	$12, %rsi
+	call	_slob_insert
+.LVL25:
+	.loc 1 103 5 view .LVU70
+	.loc 1 103 11 is_stmt 0 view .LVU71
+	movl	$1, %eax
+.L28:
+	.loc 1 104 1 view .LVU72
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL26:
+	.loc 1 104 1 view .LVU73
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	_slob_grow, .-_slob_grow
+	.p2align 4
+	.globl	slob_init
+	.type	slob_init, @function
+slob_init:
+.LFB4:
+	.loc 1 111 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 112 5 view .LVU75
+.LBB21:
+.LBI21:
+	.file 2 "src/include/atomic.h"
+	.loc 2 27 20 view .LVU76
+.LVL27:
+.LBB22:
+	.loc 2 29 12 is_stmt 0 view .LVU77
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 2 31 5 is_stmt 1 view .LVU78
+	.loc 2 29 12 view .LVU79
+	movl	%edx, %eax
+	xchgb	slob_lock(%rip), %al
+	testb	%al, %al
+	jne	.L37
+.LVL28:
+	.loc 2 29 12 is_stmt 0 view .LVU80
+.LBE22:
+.LBE21:
+	.loc 1 114 5 is_stmt 1 view .LVU81
+	.loc 1 114 8 is_stmt 0 view .LVU82
+	cmpb	$0, _init(%rip)
+	je	.L49
+	.loc 1 119 5 is_stmt 1 view .LVU83
+.LVL29:
+.LBB23:
+.LBI23:
+	.loc 2 34 20 view .LVU84
+.LBB24:
+	.loc 2 36 5 view .LVU85
+	movb	$0, slob_lock(%rip)
+.LVL30:
+	.loc 2 36 5 is_stmt 0 view .LVU86
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBE24:
+.LBE23:
+	.loc 1 115 9 is_stmt 1 view .LVU87
+	.loc 1 111 1 is_stmt 0 view .LVU88
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB26:
+.LBB27:
+	.loc 1 97 20 view .LVU89
+	movl	$64, %edi
+.LBE27:
+.LBE26:
+	.loc 1 115 15 view .LVU90
+	movb	$1, _init(%rip)
+	.loc 1 116 9 is_stmt 1 view .LVU91
+.LVL31:
+.LBB29:
+.LBI26:
+	.loc 1 93 5 view .LVU92
+.LBB28:
+	.loc 1 95 5 view .LVU93
+	.loc 1 97 5 view .LVU94
+	.loc 1 97 20 is_stmt 0 view .LVU95
+	call	kpalloc@PLT
+.LVL32:
+	movq	%rax, %rdi
+.LVL33:
+	.loc 1 98 5 is_stmt 1 view .LVU96
+	.loc 1 98 8 is_stmt 0 view .LVU97
+	testq	%rax, %rax
+	je	.L39
+	.loc 1 102 5 is_stmt 1 view .LVU98
+	movl	$262144, %esi
+	call	_slob_insert
+.LVL34:
+	.loc 1 103 5 view .LVU99
+.L39:
+	.loc 1 103 5 is_stmt 0 view .LVU100
+.LBE28:
+.LBE29:
+	.loc 1 119 5 is_stmt 1 view .LVU101
+.LBB30:
+	.loc 2 34 20 view .LVU102
+.LBB25:
+	.loc 2 36 5 view .LVU103
+	movb	$0, slob_lock(%rip)
+.LVL35:
+	.loc 2 36 5 is_stmt 0 view .LVU104
+.LBE25:
+.LBE30:
+	.loc 1 120 1 view .LVU105
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	slob_init, .-slob_init
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"No memory available!\n"
+	.text
+	.p2align 4
+	.globl	slob_malloc
+	.type	slob_malloc, @function
+slob_malloc:
+.LVL36:
+.LFB5:
+	.loc 1 128 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 5 view .LVU107
+	.loc 1 129 8 is_stmt 0 view .LVU108
+	cmpb	$0, _init(%rip)
+	.loc 1 128 1 view .LVU109
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 129 8 view .LVU110
+	je	.L74
+.LVL37:
+.L51:
+	.loc 1 133 5 is_stmt 1 view .LVU111
+	.loc 1 133 92 is_stmt 0 view .LVU112
+	addq	$23, %rbp
+.LVL38:
+.LBB40:
+.LBB41:
+	.loc 2 29 12 view .LVU113
+	movl	$1, %edx
+.LBE41:
+.LBE40:
+	.loc 1 133 14 view .LVU114
+	andq	$-16, %rbp
+.LVL39:
+	.loc 1 135 5 is_stmt 1 view .LVU115
+.LBB43:
+.LBI40:
+	.loc 2 27 20 view .LVU116
+	.p2align 4,,10
+	.p2align 3
+.L52:
+.LBB42:
+	.loc 2 31 5 view .LVU117
+	.loc 2 29 12 view .LVU118
+	movl	%edx, %eax
+	xchgb	slob_lock(%rip), %al
+	testb	%al, %al
+	jne	.L52
+.LVL40:
+.L60:
+	.loc 2 29 12 is_stmt 0 view .LVU119
+.LBE42:
+.LBE43:
+	.loc 1 137 5 is_stmt 1 view .LVU120
+.LBB44:
+	.loc 1 138 9 view .LVU121
+	.loc 1 139 9 view .LVU122
+	.loc 1 139 27 is_stmt 0 view .LVU123
+	movq	pHead(%rip), %rax
+.LVL41:
+	.loc 1 141 9 is_stmt 1 view .LVU124
+	.loc 1 141 27 view .LVU125
+	.loc 1 138 27 is_stmt 0 view .LVU126
+	xorl	%ecx, %ecx
+	.loc 1 141 27 view .LVU127
+	testq	%rax, %rax
+	jne	.L53
+	jmp	.L54
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 142 13 is_stmt 1 view .LVU128
+	.loc 1 143 13 view .LVU129
+	.loc 1 143 19 is_stmt 0 view .LVU130
+	movq	(%rax), %rdx
+.LVL43:
+	.loc 1 141 27 is_stmt 1 view .LVU131
+	movq	%rax, %rcx
+	testq	%rdx, %rdx
+	je	.L54
+	.loc 1 143 19 is_stmt 0 view .LVU132
+	movq	%rdx, %rax
+.LVL44:
+.L53:
+	.loc 1 141 35 discriminator 1 view .LVU133
+	movq	8(%rax), %rdx
+	.loc 1 141 27 discriminator 1 view .LVU134
+	cmpq	%rbp, %rdx
+	jb	.L55
+	.loc 1 155 9 is_stmt 1 view .LVU135
+	.loc 1 157 9 view .LVU136
+	.loc 1 157 27 is_stmt 0 view .LVU137
+	movq	%rdx, %rsi
+	subq	%rbp, %rsi
+	.loc 1 157 12 view .LVU138
+	cmpq	$15, %rsi
+	ja	.L61
+	.loc 1 159 13 is_stmt 1 view .LVU139
+.LVL45:
+	.loc 1 160 13 view .LVU140
+	.loc 1 162 13 view .LVU141
+	.loc 1 143 19 is_stmt 0 view .LVU142
+	movq	(%rax), %rsi
+	.loc 1 162 16 view .LVU143
+	testq	%rcx, %rcx
+	je	.L62
+	.loc 1 163 17 is_stmt 1 view .LVU144
+	.loc 1 163 30 is_stmt 0 view .LVU145
+	movq	%rsi, (%rcx)
+.L64:
+	.loc 1 141 35 view .LVU146
+	movq	%rdx, %rbp
+	jmp	.L63
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 146 9 is_stmt 1 view .LVU147
+	.loc 1 148 13 view .LVU148
+.LBB45:
+.LBI45:
+	.loc 1 93 5 view .LVU149
+.LBB46:
+	.loc 1 95 5 view .LVU150
+	.loc 1 95 47 is_stmt 0 view .LVU151
+	leaq	4095(%rbp), %rax
+	.loc 1 95 109 view .LVU152
+	movq	%rax, %r12
+	shrq	$12, %r12
+	cmpq	$266239, %rax
+	movl	$64, %eax
+	cmovbe	%rax, %r12
+.LVL47:
+	.loc 1 97 5 is_stmt 1 view .LVU153
+	.loc 1 97 20 is_stmt 0 view .LVU154
+	movq	%r12, %rdi
+	call	kpalloc@PLT
+.LVL48:
+	movq	%rax, %rbx
+.LVL49:
+	.loc 1 98 5 is_stmt 1 view .LVU155
+	.loc 1 98 8 is_stmt 0 view .LVU156
+	testq	%rax, %rax
+	je	.L75
+	.loc 1 102 5 is_stmt 1 view .LVU157
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	salq	$12, %rsi
+	call	_slob_insert
+.LVL50:
+	.loc 1 103 5 view .LVU158
+	.loc 1 103 5 is_stmt 0 view .LVU159
+.LBE46:
+.LBE45:
+	jmp	.L60
+.LVL51:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.loc 1 168 13 is_stmt 1 view .LVU160
+	.loc 1 168 27 is_stmt 0 view .LVU161
+	movq	%rsi, 8(%rax)
+	.loc 1 169 13 is_stmt 1 view .LVU162
+	.loc 1 169 20 is_stmt 0 view .LVU163
+	addq	%rsi, %rax
+.LVL52:
+.L63:
+	.loc 1 172 9 is_stmt 1 view .LVU164
+.LBB47:
+.LBI47:
+	.loc 2 34 20 view .LVU165
+.LBB48:
+	.loc 2 36 5 view .LVU166
+.LBE48:
+.LBE47:
+	.loc 1 178 23 is_stmt 0 view .LVU167
+	leaq	8(%rax), %rbx
+.LBB50:
+.LBB49:
+	.loc 2 36 5 view .LVU168
+	movb	$0, slob_lock(%rip)
+.LVL53:
+	.loc 2 36 5 view .LVU169
+.LBE49:
+.LBE50:
+	.loc 1 174 9 is_stmt 1 view .LVU170
+	.loc 1 175 9 view .LVU171
+	.loc 1 175 25 is_stmt 0 view .LVU172
+	movq	%rbp, (%rax)
+	.loc 1 178 9 is_stmt 1 view .LVU173
+.LBE44:
+	.loc 1 185 1 is_stmt 0 view .LVU174
+	movq	%rbx, %rax
+.LVL54:
+	.loc 1 185 1 view .LVU175
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL55:
+	.loc 1 185 1 view .LVU176
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL56:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.cfi_restore_state
+	.loc 1 130 9 is_stmt 1 view .LVU177
+	xorl	%eax, %eax
+	call	slob_init
+.LVL57:
+	.loc 1 130 9 is_stmt 0 view .LVU178
+	jmp	.L51
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.loc 1 181 5 is_stmt 1 view .LVU179
+.LBB51:
+.LBI51:
+	.loc 2 34 20 view .LVU180
+.LBB52:
+	.loc 2 36 5 view .LVU181
+.LBE52:
+.LBE51:
+	.loc 1 183 5 is_stmt 0 view .LVU182
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+.LBB54:
+.LBB53:
+	.loc 2 36 5 view .LVU183
+	movb	$0, slob_lock(%rip)
+.LVL59:
+	.loc 2 36 5 view .LVU184
+.LBE53:
+.LBE54:
+	.loc 1 183 5 is_stmt 1 view .LVU185
+	call	kprintf@PLT
+.LVL60:
+	.loc 1 184 5 view .LVU186
+	.loc 1 185 1 is_stmt 0 view .LVU187
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL61:
+	.loc 1 185 1 view .LVU188
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 185 1 view .LVU189
+	ret
+.LVL63:
+.L62:
+	.cfi_restore_state
+.LBB55:
+	.loc 1 165 17 is_stmt 1 view .LVU190
+	.loc 1 165 23 is_stmt 0 view .LVU191
+	movq	%rsi, pHead(%rip)
+	jmp	.L64
+.LBE55:
+	.cfi_endproc
+.LFE5:
+	.size	slob_malloc, .-slob_malloc
+	.p2align 4
+	.globl	slob_free
+	.type	slob_free, @function
+slob_free:
+.LVL64:
+.LFB6:
+	.loc 1 192 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 5 view .LVU193
+	.loc 1 193 8 is_stmt 0 view .LVU194
+	testq	%rdi, %rdi
+	je	.L76
+	.loc 1 198 5 is_stmt 1 view .LVU195
+	.loc 1 198 24 is_stmt 0 view .LVU196
+	leaq	-8(%rdi), %rcx
+.LVL65:
+	.loc 1 200 5 is_stmt 1 view .LVU197
+.LBB60:
+.LBI60:
+	.loc 2 27 20 view .LVU198
+.LBB61:
+	.loc 2 29 12 is_stmt 0 view .LVU199
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 2 31 5 is_stmt 1 view .LVU200
+	.loc 2 29 12 view .LVU201
+	movl	%edx, %eax
+	xchgb	slob_lock(%rip), %al
+	testb	%al, %al
+	jne	.L78
+.LVL66:
+	.loc 2 29 12 is_stmt 0 view .LVU202
+.LBE61:
+.LBE60:
+	.loc 1 201 5 is_stmt 1 view .LVU203
+	movq	-8(%rdi), %rsi
+	movq	%rcx, %rdi
+.LVL67:
+	.loc 1 201 5 is_stmt 0 view .LVU204
+	call	_slob_insert
+.LVL68:
+	.loc 1 202 5 is_stmt 1 view .LVU205
+.LBB62:
+.LBI62:
+	.loc 2 34 20 view .LVU206
+.LBB63:
+	.loc 2 36 5 view .LVU207
+	movb	$0, slob_lock(%rip)
+.LVL69:
+.L76:
+	.loc 2 36 5 is_stmt 0 view .LVU208
+.LBE63:
+.LBE62:
+	.loc 1 203 1 view .LVU209
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	slob_free, .-slob_free
+	.p2align 4
+	.globl	slob_usable_size
+	.type	slob_usable_size, @function
+slob_usable_size:
+.LVL70:
+.LFB7:
+	.loc 1 209 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 210 5 view .LVU211
+	.loc 1 211 5 view .LVU212
+	.loc 1 211 28 is_stmt 0 view .LVU213
+	movq	-8(%rdi), %rax
+	subq	$8, %rax
+	.loc 1 212 1 view .LVU214
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	slob_usable_size, .-slob_usable_size
+	.p2align 4
+	.globl	slob_grow_in_place
+	.type	slob_grow_in_place, @function
+slob_grow_in_place:
+.LVL71:
+.LFB8:
+	.loc 1 219 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 220 5 view .LVU216
+	.loc 1 221 5 view .LVU217
+	.loc 1 221 92 is_stmt 0 view .LVU218
+	addq	$23, %rsi
+.LVL72:
+	.loc 1 223 29 view .LVU219
+	movq	-8(%rdi), %r8
+	.loc 1 221 14 view .LVU220
+	andq	$-16, %rsi
+.LVL73:
+	.loc 1 223 5 is_stmt 1 view .LVU221
+	.loc 1 223 8 is_stmt 0 view .LVU222
+	cmpq	%rsi, %r8
+	jb	.L109
+	.loc 1 224 15 view .LVU223
+	movl	$1, %eax
+	.loc 1 268 1 view .LVU224
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	.loc 1 227 5 is_stmt 1 view .LVU225
+.LVL74:
+	.loc 1 228 5 view .LVU226
+	.loc 1 228 23 is_stmt 0 view .LVU227
+	leaq	-8(%rdi,%r8), %rdx
+.LVL75:
+	.loc 1 230 5 is_stmt 1 view .LVU228
+.LBB70:
+.LBI70:
+	.loc 2 27 20 view .LVU229
+.LBB71:
+	.loc 2 29 12 is_stmt 0 view .LVU230
+	movl	$1, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	.loc 2 31 5 is_stmt 1 view .LVU231
+	.loc 2 29 12 view .LVU232
+	movl	%ecx, %eax
+	xchgb	slob_lock(%rip), %al
+	testb	%al, %al
+	jne	.L86
+.LVL76:
+	.loc 2 29 12 is_stmt 0 view .LVU233
+.LBE71:
+.LBE70:
+	.loc 1 232 5 is_stmt 1 view .LVU234
+	.loc 1 233 5 view .LVU235
+	.loc 1 233 23 is_stmt 0 view .LVU236
+	movq	pHead(%rip), %rax
+.LVL77:
+	.loc 1 235 5 is_stmt 1 view .LVU237
+	.loc 1 235 23 view .LVU238
+	testq	%rax, %rax
+	je	.L97
+	cmpq	%rdx, %rax
+	jnb	.L97
+.LVL78:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.loc 1 236 9 view .LVU239
+	.loc 1 237 9 view .LVU240
+	movq	%rax, %rcx
+	.loc 1 237 15 is_stmt 0 view .LVU241
+	movq	(%rax), %rax
+.LVL79:
+	.loc 1 235 23 is_stmt 1 view .LVU242
+	testq	%rax, %rax
+	je	.L87
+	cmpq	%rdx, %rax
+	jb	.L88
+.LVL80:
+.L87:
+	.loc 1 240 5 view .LVU243
+	.loc 1 240 8 is_stmt 0 view .LVU244
+	cmpq	%rax, %rdx
+	jne	.L90
+	.loc 1 227 14 discriminator 1 view .LVU245
+	movq	%rsi, %r9
+	.loc 1 240 31 discriminator 1 view .LVU246
+	movq	8(%rdx), %rax
+.LVL81:
+	.loc 1 227 14 discriminator 1 view .LVU247
+	subq	%r8, %r9
+	.loc 1 240 23 discriminator 1 view .LVU248
+	cmpq	%r9, %rax
+	jb	.L90
+	.loc 1 245 5 is_stmt 1 view .LVU249
+	.loc 1 246 12 is_stmt 0 view .LVU250
+	subq	%rsi, %r8
+.LVL82:
+	.loc 1 245 23 view .LVU251
+	movq	(%rdx), %r10
+.LVL83:
+	.loc 1 246 5 is_stmt 1 view .LVU252
+	.loc 1 246 12 is_stmt 0 view .LVU253
+	addq	%rax, %r8
+.LVL84:
+	.loc 1 248 5 is_stmt 1 view .LVU254
+	.loc 1 248 8 is_stmt 0 view .LVU255
+	cmpq	$15, %r8
+	jbe	.L110
+	.loc 1 253 9 is_stmt 1 view .LVU256
+	.loc 1 253 15 is_stmt 0 view .LVU257
+	addq	%r9, %rdx
+.LVL85:
+	.loc 1 254 9 is_stmt 1 view .LVU258
+	.loc 1 254 23 is_stmt 0 view .LVU259
+	movq	%r8, 8(%rdx)
+	.loc 1 255 9 is_stmt 1 view .LVU260
+	.loc 1 255 22 is_stmt 0 view .LVU261
+	movq	%r10, (%rdx)
+	.loc 1 256 9 is_stmt 1 view .LVU262
+.LVL86:
+	.loc 1 257 9 view .LVU263
+	.loc 1 255 22 is_stmt 0 view .LVU264
+	movq	%rdx, %r10
+.LVL87:
+.L94:
+	.loc 1 250 25 view .LVU265
+	movq	%rsi, -8(%rdi)
+	.loc 1 260 5 is_stmt 1 view .LVU266
+	.loc 1 260 8 is_stmt 0 view .LVU267
+	testq	%rcx, %rcx
+	je	.L95
+	.loc 1 261 9 is_stmt 1 view .LVU268
+	.loc 1 261 22 is_stmt 0 view .LVU269
+	movq	%r10, (%rcx)
+.L96:
+	.loc 1 266 5 is_stmt 1 view .LVU270
+.LVL88:
+.LBB72:
+.LBI72:
+	.loc 2 34 20 view .LVU271
+.LBB73:
+	.loc 2 36 5 view .LVU272
+.LBE73:
+.LBE72:
+	.loc 1 224 15 is_stmt 0 view .LVU273
+	movl	$1, %eax
+.LBB75:
+.LBB74:
+	.loc 2 36 5 view .LVU274
+	movb	$0, slob_lock(%rip)
+.LVL89:
+	.loc 2 36 5 view .LVU275
+.LBE74:
+.LBE75:
+	.loc 1 267 5 is_stmt 1 view .LVU276
+	.loc 1 268 1 is_stmt 0 view .LVU277
+	ret
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.loc 1 241 9 is_stmt 1 view .LVU278
+.LBB76:
+.LBI76:
+	.loc 2 34 20 view .LVU279
+.LBB77:
+	.loc 2 36 5 view .LVU280
+.LBE77:
+.LBE76:
+	.loc 1 242 15 is_stmt 0 view .LVU281
+	xorl	%eax, %eax
+.LBB79:
+.LBB78:
+	.loc 2 36 5 view .LVU282
+	movb	$0, slob_lock(%rip)
+.LVL91:
+	.loc 2 36 5 view .LVU283
+.LBE78:
+.LBE79:
+	.loc 1 242 9 is_stmt 1 view .LVU284
+	.loc 1 242 15 is_stmt 0 view .LVU285
+	ret
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L110:
+	.loc 1 250 9 is_stmt 1 view .LVU286
+	.loc 1 250 25 is_stmt 0 view .LVU287
+	addq	-8(%rdi), %rax
+	movq	%rax, %rsi
+.LVL93:
+	.loc 1 250 25 view .LVU288
+	jmp	.L94
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	.loc 1 263 9 is_stmt 1 view .LVU289
+	.loc 1 263 15 is_stmt 0 view .LVU290
+	movq	%r10, pHead(%rip)
+	jmp	.L96
+.LVL95:
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	.loc 1 232 23 view .LVU291
+	xorl	%ecx, %ecx
+	jmp	.L87
+	.cfi_endproc
+.LFE8:
+	.size	slob_grow_in_place, .-slob_grow_in_place
+	.globl	slob_lock
+	.bss
+	.type	slob_lock, @object
+	.size	slob_lock, 1
+slob_lock:
+	.zero	1
+	.globl	pHead
+	.align 8
+	.type	pHead, @object
+	.size	pHead, 8
+pHead:
+	.zero	8
+	.local	_init
+	.comm	_init,1,1
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 5 "src/include/mem.h"
+	.file 6 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7c1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF46
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2
+	.uleb128 0x9
+	.long	.LASF8
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF7
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x17
+	.long	0x77
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF10
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x37
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x1b
+	.long	0x9a
+	.uleb128 0x5
+	.long	0xa1
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF15
+	.uleb128 0x1c
+	.byte	0x1
+	.byte	0x2
+	.byte	0x17
+	.byte	0x9
+	.long	0xc9
+	.uleb128 0xa
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x18
+	.byte	0xd
+	.long	0x6b
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0xb2
+	.uleb128 0x11
+	.long	.LASF20
+	.byte	0x10
+	.byte	0x22
+	.long	0xfb
+	.uleb128 0xa
+	.long	.LASF18
+	.byte	0x1
+	.byte	0x23
+	.byte	0x17
+	.long	0xfb
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x1
+	.byte	0x24
+	.byte	0xc
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xd5
+	.uleb128 0x11
+	.long	.LASF21
+	.byte	0x8
+	.byte	0x28
+	.long	0x119
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x1
+	.byte	0x29
+	.byte	0xe
+	.long	0x8c
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x32
+	.byte	0x10
+	.long	0x6b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_init
+	.uleb128 0x12
+	.long	.LASF22
+	.byte	0x33
+	.byte	0x13
+	.long	0xfb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pHead
+	.uleb128 0x12
+	.long	.LASF23
+	.byte	0x34
+	.byte	0xc
+	.long	0xc9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	slob_lock
+	.uleb128 0x1e
+	.long	.LASF48
+	.byte	0x6
+	.byte	0x30
+	.byte	0x6
+	.long	0x16c
+	.uleb128 0x13
+	.long	0xa6
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF36
+	.byte	0x5
+	.byte	0xbd
+	.byte	0x7
+	.long	0x98
+	.long	0x182
+	.uleb128 0x13
+	.long	0x35
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0xda
+	.byte	0x5
+	.long	0xab
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d7
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0xda
+	.byte	0x1e
+	.long	0x98
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.long	.LASF33
+	.byte	0xda
+	.byte	0x2a
+	.long	0x35
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0xdc
+	.byte	0x18
+	.long	0x2d7
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0xdd
+	.byte	0xe
+	.long	0x8c
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0xe3
+	.byte	0xe
+	.long	0x8c
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0xe4
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0xe8
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0xe9
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0xf5
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0xf6
+	.byte	0xc
+	.long	0x35
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x6
+	.long	0x73a
+	.quad	.LBI70
+	.byte	.LVU229
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0xe6
+	.byte	0x5
+	.long	0x28d
+	.uleb128 0x2
+	.long	0x744
+	.long	.LLST43
+	.long	.LVUS43
+	.byte	0
+	.uleb128 0x21
+	.long	0x71e
+	.quad	.LBI72
+	.byte	.LVU271
+	.long	.LLRL44
+	.byte	0x1
+	.value	0x10a
+	.byte	0x5
+	.long	0x2b5
+	.uleb128 0x2
+	.long	0x728
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0xd
+	.long	0x71e
+	.quad	.LBI76
+	.byte	.LVU279
+	.long	.LLRL46
+	.byte	0xf1
+	.uleb128 0x2
+	.long	0x728
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x100
+	.uleb128 0xb
+	.long	.LASF32
+	.byte	0xd0
+	.byte	0x8
+	.long	0x35
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x31e
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0xd0
+	.byte	0x1f
+	.long	0x98
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0xd2
+	.byte	0x18
+	.long	0x2d7
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF40
+	.byte	0xbf
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3da
+	.uleb128 0x22
+	.string	"ptr"
+	.byte	0x1
+	.byte	0xbf
+	.byte	0x16
+	.long	0x98
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0xc6
+	.byte	0x18
+	.long	0x2d7
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.long	0x73a
+	.quad	.LBI60
+	.byte	.LVU198
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.byte	0xc8
+	.byte	0x5
+	.long	0x393
+	.uleb128 0x2
+	.long	0x744
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.uleb128 0x6
+	.long	0x71e
+	.quad	.LBI62
+	.byte	.LVU206
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.byte	0xca
+	.byte	0x5
+	.long	0x3c5
+	.uleb128 0x2
+	.long	0x728
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL68
+	.long	0x6a7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF34
+	.byte	0x7f
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x58b
+	.uleb128 0xc
+	.long	.LASF33
+	.byte	0x7f
+	.byte	0x1a
+	.long	0x35
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x85
+	.byte	0xe
+	.long	0x8c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x23
+	.long	.LLRL17
+	.long	0x518
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x8a
+	.byte	0x1b
+	.long	0xfb
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x8b
+	.byte	0x1b
+	.long	0xfb
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x9b
+	.byte	0x12
+	.long	0x58b
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0xae
+	.byte	0x1c
+	.long	0x2d7
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x6
+	.long	0x673
+	.quad	.LBI45
+	.byte	.LVU149
+	.quad	.LBB45
+	.quad	.LBE45-.LBB45
+	.byte	0x94
+	.byte	0x12
+	.long	0x4f6
+	.uleb128 0x2
+	.long	0x684
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.long	0x690
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x8
+	.long	0x69b
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xe
+	.quad	.LVL48
+	.long	0x16c
+	.long	0x4d9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL50
+	.long	0x6a7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x3c
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x71e
+	.quad	.LBI47
+	.byte	.LVU165
+	.long	.LLRL25
+	.byte	0xac
+	.uleb128 0x2
+	.long	0x728
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x73a
+	.quad	.LBI40
+	.byte	.LVU116
+	.long	.LLRL15
+	.byte	0x87
+	.long	0x53d
+	.uleb128 0x2
+	.long	0x744
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0xf
+	.long	0x71e
+	.quad	.LBI51
+	.byte	.LVU180
+	.long	.LLRL27
+	.byte	0xb5
+	.long	0x562
+	.uleb128 0x2
+	.long	0x728
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL57
+	.long	0x590
+	.uleb128 0x7
+	.quad	.LVL60
+	.long	0x159
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x6b
+	.uleb128 0x25
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x6e
+	.byte	0x6
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x673
+	.uleb128 0x6
+	.long	0x73a
+	.quad	.LBI21
+	.byte	.LVU76
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.byte	0x70
+	.byte	0x5
+	.long	0x5e0
+	.uleb128 0x2
+	.long	0x744
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0xf
+	.long	0x71e
+	.quad	.LBI23
+	.byte	.LVU84
+	.long	.LLRL8
+	.byte	0x77
+	.long	0x605
+	.uleb128 0x2
+	.long	0x728
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0xd
+	.long	0x673
+	.quad	.LBI26
+	.byte	.LVU92
+	.long	.LLRL10
+	.byte	0x74
+	.uleb128 0x2
+	.long	0x684
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x26
+	.long	.LLRL10
+	.uleb128 0x27
+	.long	0x690
+	.byte	0x40
+	.uleb128 0x8
+	.long	0x69b
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xe
+	.quad	.LVL32
+	.long	0x16c
+	.long	0x655
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL34
+	.long	0x6a7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3e
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x5
+	.long	0xab
+	.byte	0x1
+	.long	0x6a7
+	.uleb128 0x10
+	.long	.LASF19
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x16
+	.long	.LASF38
+	.byte	0x5f
+	.byte	0xe
+	.long	0x8c
+	.uleb128 0x16
+	.long	.LASF39
+	.byte	0x61
+	.byte	0xb
+	.long	0x98
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF41
+	.byte	0x3a
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x71e
+	.uleb128 0x29
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x3a
+	.byte	0x19
+	.long	0x98
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.long	.LASF19
+	.byte	0x3a
+	.byte	0x28
+	.long	0x35
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x3c
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x3d
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x3e
+	.byte	0x17
+	.long	0xfb
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF44
+	.byte	0x22
+	.long	0x735
+	.uleb128 0x10
+	.long	.LASF43
+	.byte	0x2
+	.byte	0x22
+	.byte	0x30
+	.long	0x735
+	.byte	0
+	.uleb128 0x5
+	.long	0xc9
+	.uleb128 0x17
+	.long	.LASF45
+	.byte	0x1b
+	.long	0x751
+	.uleb128 0x10
+	.long	.LASF43
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x735
+	.byte	0
+	.uleb128 0x2a
+	.long	0x673
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	0x684
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.long	0x690
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x8
+	.long	0x69b
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xe
+	.quad	.LVL22
+	.long	0x16c
+	.long	0x7a7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL25
+	.long	0x6a7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3c
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -23
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU217
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU221
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU278
+	.uleb128 .LVU278
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x17
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x17
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU226
+	.uleb128 .LVU251
+	.uleb128 .LVU278
+	.uleb128 .LVU286
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU228
+	.uleb128 .LVU258
+	.uleb128 .LVU278
+	.uleb128 .LVU289
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU235
+	.uleb128 .LVU239
+	.uleb128 .LVU240
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU237
+	.uleb128 .LVU247
+	.uleb128 .LVU258
+	.uleb128 .LVU265
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU252
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU278
+	.uleb128 .LVU286
+	.uleb128 .LVU291
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU254
+	.uleb128 .LVU278
+	.uleb128 .LVU286
+	.uleb128 .LVU291
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU230
+	.uleb128 .LVU233
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU271
+	.uleb128 .LVU275
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU279
+	.uleb128 .LVU283
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE7-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU197
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU208
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU199
+	.uleb128 .LVU202
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU206
+	.uleb128 .LVU208
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -23
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL57-1-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU115
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU177
+	.uleb128 .LVU179
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x17
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU122
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU147
+	.uleb128 .LVU160
+	.uleb128 .LVU177
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU124
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU147
+	.uleb128 .LVU160
+	.uleb128 .LVU164
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU141
+	.uleb128 .LVU147
+	.uleb128 .LVU164
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU171
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU149
+	.uleb128 .LVU159
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU153
+	.uleb128 .LVU160
+	.uleb128 .LVU179
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 .LVU190
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x37
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x17
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x17
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854509569
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU155
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU159
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU180
+	.uleb128 .LVU184
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU77
+	.uleb128 .LVU80
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU84
+	.uleb128 .LVU86
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	slob_lock
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU92
+	.uleb128 .LVU100
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU96
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU100
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU5
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+	.uleb128 .LVU30
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU40
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pHead
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pHead
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 -4095
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU64
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x2d
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x8
+	.byte	0x40
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854509569
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU67
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF18:
+	.string	"pNext"
+.LASF16:
+	.string	"spinlock_t"
+.LASF42:
+	.string	"pEntry"
+.LASF47:
+	.string	"_init"
+.LASF8:
+	.string	"size_t"
+.LASF31:
+	.string	"slob_grow_in_place"
+.LASF40:
+	.string	"slob_free"
+.LASF34:
+	.string	"slob_malloc"
+.LASF35:
+	.string	"pBlock"
+.LASF44:
+	.string	"spinlock_unlock"
+.LASF37:
+	.string	"_slob_grow"
+.LASF32:
+	.string	"slob_usable_size"
+.LASF13:
+	.string	"uint64_t"
+.LASF41:
+	.string	"_slob_insert"
+.LASF29:
+	.string	"pFollowing"
+.LASF30:
+	.string	"remaining"
+.LASF33:
+	.string	"size"
+.LASF21:
+	.string	"SlobHeader"
+.LASF36:
+	.string	"kpalloc"
+.LASF3:
+	.string	"long unsigned int"
+.LASF28:
+	.string	"pPrev"
+.LASF39:
+	.string	"pChunk"
+.LASF27:
+	.string	"pEnd"
+.LASF10:
+	.string	"unsigned char"
+.LASF22:
+	.string	"pHead"
+.LASF38:
+	.string	"numPages"
+.LASF49:
+	.string	"slob_init"
+.LASF12:
+	.string	"unsigned int"
+.LASF48:
+	.string	"kprintf"
+.LASF14:
+	.string	"char"
+.LASF9:
+	.string	"uint8_t"
+.LASF45:
+	.string	"spinlock_lock"
+.LASF46:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF4:
+	.string	"long long int"
+.LASF26:
+	.string	"extra"
+.LASF20:
+	.string	"SlobEntry"
+.LASF7:
+	.string	"short int"
+.LASF23:
+	.string	"slob_lock"
+.LASF2:
+	.string	"long int"
+.LASF43:
+	.string	"pLock"
+.LASF5:
+	.string	"long double"
+.LASF6:
+	.string	"signed char"
+.LASF25:
+	.string	"totalSize"
+.LASF11:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"lock"
+.LASF15:
+	.string	"_Bool"
+.LASF19:
+	.string	"length"
+.LASF24:
+	.string	"pHeader"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc/slob.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
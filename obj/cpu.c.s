@@ -0,0 +1,2185 @@
+	.file	"cpu.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/cpu.c"
+	.p2align 4
+	.globl	cpu_local_init
+	.type	cpu_local_init, @function
+cpu_local_init:
+.LVL0:
+.LFB32:
+	.file 1 "src/cpu.c"
+	.loc 1 45 1 view -0
+	.cfi_startproc
+	.loc 1 46 5 view .LVU1
+	.loc 1 49 5 view .LVU2
+	.loc 1 45 1 is_stmt 0 view .LVU3
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 49 5 view .LVU4
+	movl	$1, %eax
+	.loc 1 45 1 view .LVU5
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 49 5 view .LVU6
+#APP
+# 49 "src/cpu.c" 1
+	cpuid
+# 0 "" 2
+.LVL1:
+	.loc 1 55 5 is_stmt 1 view .LVU7
+	.loc 1 55 23 is_stmt 0 view .LVU8
+#NO_APP
+	movl	%edi, %ebp
+	leaq	cpu_locals(%rip), %rax
+	.loc 1 58 28 view .LVU9
+	shrl	$24, %ebx
+.LVL2:
+	.loc 1 55 23 view .LVU10
+	salq	$6, %rbp
+	addq	%rax, %rbp
+.LVL3:
+	.loc 1 56 5 is_stmt 1 view .LVU11
+	.loc 1 57 19 is_stmt 0 view .LVU12
+	movl	%edi, 8(%rbp)
+	.loc 1 58 28 view .LVU13
+	movl	%ebx, %edi
+.LVL4:
+	.loc 1 56 18 view .LVU14
+	movq	%rbp, 0(%rbp)
+	.loc 1 57 5 is_stmt 1 view .LVU15
+	.loc 1 58 5 view .LVU16
+	.loc 1 58 22 is_stmt 0 view .LVU17
+	movl	%ebx, 12(%rbp)
+	.loc 1 59 5 is_stmt 1 view .LVU18
+	.loc 1 59 20 is_stmt 0 view .LVU19
+	call	acpi_numa_node_of_apic@PLT
+.LVL5:
+.LBB8:
+.LBB9:
+	.file 2 "src/include/cpu.h"
+	.loc 2 173 48 view .LVU20
+	movq	%rbp, %rdx
+	.loc 2 171 5 view .LVU21
+	movl	$-1073741567, %ecx
+.LBE9:
+.LBE8:
+	.loc 1 59 18 view .LVU22
+	movl	%eax, 16(%rbp)
+	.loc 1 61 5 is_stmt 1 view .LVU23
+.LVL6:
+.LBB11:
+.LBI8:
+	.loc 2 169 20 view .LVU24
+.LBB10:
+	.loc 2 171 5 view .LVU25
+	.loc 2 173 48 is_stmt 0 view .LVU26
+	shrq	$32, %rdx
+	.loc 2 171 5 view .LVU27
+	movl	%ebp, %eax
+#APP
+# 171 "src/include/cpu.h" 1
+	wrmsr
+# 0 "" 2
+.LVL7:
+	.loc 2 171 5 view .LVU28
+#NO_APP
+.LBE10:
+.LBE11:
+	.loc 1 62 1 view .LVU29
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL8:
+	.loc 1 62 1 view .LVU30
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	cpu_local_init, .-cpu_local_init
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Waking up...\n"
+.LC1:
+	.string	"LAPIC ID: %d\n"
+.LC2:
+	.string	"Processor ID: %d\n"
+.LC3:
+	.string	"Cores Online: %d\n"
+	.text
+	.p2align 4
+	.globl	_cpu_awake
+	.type	_cpu_awake, @function
+_cpu_awake:
+.LVL9:
+.LFB33:
+	.loc 1 68 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 77 5 view .LVU32
+	.loc 1 68 1 is_stmt 0 view .LVU33
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 77 20 view .LVU34
+	movl	$1, %esi
+	.loc 1 68 1 view .LVU35
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 77 20 view .LVU36
+	lock xaddq	%rsi, _cpus_awake(%rip)
+.LVL10:
+.LBB20:
+.LBI20:
+	.loc 1 44 6 is_stmt 1 view .LVU37
+.LBB21:
+	.loc 1 46 5 view .LVU38
+	.loc 1 49 5 view .LVU39
+	movl	$1, %eax
+#APP
+# 49 "src/cpu.c" 1
+	cpuid
+# 0 "" 2
+	.loc 1 55 23 is_stmt 0 view .LVU40
+#NO_APP
+	movl	%esi, %ebp
+	.loc 1 49 5 view .LVU41
+	movl	%ebx, %edi
+.LVL11:
+	.loc 1 55 5 is_stmt 1 view .LVU42
+	.loc 1 55 23 is_stmt 0 view .LVU43
+	leaq	cpu_locals(%rip), %rax
+	salq	$6, %rbp
+	.loc 1 58 28 view .LVU44
+	shrl	$24, %edi
+	.loc 1 55 23 view .LVU45
+	addq	%rax, %rbp
+.LVL12:
+	.loc 1 56 5 is_stmt 1 view .LVU46
+	.loc 1 56 18 is_stmt 0 view .LVU47
+	movq	%rbp, 0(%rbp)
+	.loc 1 57 5 is_stmt 1 view .LVU48
+	.loc 1 57 19 is_stmt 0 view .LVU49
+	movl	%esi, 8(%rbp)
+	.loc 1 58 5 is_stmt 1 view .LVU50
+	.loc 1 58 22 is_stmt 0 view .LVU51
+	movl	%edi, 12(%rbp)
+	.loc 1 59 5 is_stmt 1 view .LVU52
+	.loc 1 59 20 is_stmt 0 view .LVU53
+	call	acpi_numa_node_of_apic@PLT
+.LVL13:
+.LBB22:
+.LBB23:
+	.loc 2 173 48 view .LVU54
+	movq	%rbp, %rdx
+	.loc 2 171 5 view .LVU55
+	movl	$-1073741567, %ecx
+.LBE23:
+.LBE22:
+	.loc 1 59 18 view .LVU56
+	movl	%eax, 16(%rbp)
+	.loc 1 61 5 is_stmt 1 view .LVU57
+.LVL14:
+.LBB25:
+.LBI22:
+	.loc 2 169 20 view .LVU58
+.LBB24:
+	.loc 2 171 5 view .LVU59
+	.loc 2 173 48 is_stmt 0 view .LVU60
+	shrq	$32, %rdx
+	.loc 2 171 5 view .LVU61
+	movl	%ebp, %eax
+#APP
+# 171 "src/include/cpu.h" 1
+	wrmsr
+# 0 "" 2
+.LVL15:
+	.loc 2 171 5 view .LVU62
+#NO_APP
+.LBE24:
+.LBE25:
+.LBE21:
+.LBE20:
+	.loc 1 80 5 is_stmt 1 view .LVU63
+	xorl	%eax, %eax
+	call	kmem_init_deferred@PLT
+.LVL16:
+	.loc 1 82 5 view .LVU64
+	xorl	%eax, %eax
+	call	lapic_init@PLT
+.LVL17:
+	.loc 1 84 5 view .LVU65
+.LBB26:
+.LBI26:
+	.file 3 "src/include/atomic.h"
+	.loc 3 27 20 view .LVU66
+.LBB27:
+	.loc 3 29 12 is_stmt 0 view .LVU67
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.loc 3 31 5 is_stmt 1 view .LVU68
+	.loc 3 29 12 view .LVU69
+	movl	%edx, %eax
+	xchgb	_cpu_lock(%rip), %al
+	testb	%al, %al
+	jne	.L5
+.LBE27:
+.LBE26:
+	.loc 1 85 5 view .LVU70
+	leaq	.LC0(%rip), %rdi
+	call	kprintf@PLT
+.LVL18:
+	.loc 1 86 5 view .LVU71
+	movl	4(%r12), %esi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	call	kprintf@PLT
+.LVL19:
+	.loc 1 87 5 view .LVU72
+	movl	(%r12), %esi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	call	kprintf@PLT
+.LVL20:
+	.loc 1 89 5 view .LVU73
+	movq	_cpus_awake(%rip), %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL21:
+	.loc 1 90 5 view .LVU74
+.LBB28:
+.LBI28:
+	.loc 3 34 20 view .LVU75
+.LBB29:
+	.loc 3 36 5 view .LVU76
+	movb	$0, _cpu_lock(%rip)
+.LVL22:
+	.loc 3 36 5 is_stmt 0 view .LVU77
+.LBE29:
+.LBE28:
+	.loc 1 91 5 is_stmt 1 view .LVU78
+#APP
+# 91 "src/cpu.c" 1
+	hlt
+# 0 "" 2
+	.loc 1 92 1 is_stmt 0 view .LVU79
+#NO_APP
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL23:
+	.loc 1 92 1 view .LVU80
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	_cpu_awake, .-_cpu_awake
+	.section	.rodata.str1.1
+.LC4:
+	.string	"BSP LAPIC ID: %d\n"
+.LC5:
+	.string	"CPU Count: %d\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC6:
+	.string	"Only the first %d CPU cores will be used.\n"
+	.text
+	.p2align 4
+	.globl	cpu_init
+	.type	cpu_init, @function
+cpu_init:
+.LFB34:
+	.loc 1 95 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 96 5 view .LVU82
+	.loc 1 95 1 is_stmt 0 view .LVU83
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 96 31 view .LVU84
+	movq	40+smp_request(%rip), %rax
+	.loc 1 99 5 view .LVU85
+	leaq	.LC4(%rip), %rdi
+	.loc 1 96 40 view .LVU86
+	movl	12(%rax), %esi
+	.loc 1 97 28 view .LVU87
+	movq	40+smp_request(%rip), %rax
+	.loc 1 97 15 view .LVU88
+	movq	16(%rax), %rax
+	.loc 1 96 18 view .LVU89
+	movl	%esi, bsp_lapic_id(%rip)
+	.loc 1 97 5 is_stmt 1 view .LVU90
+	.loc 1 97 15 is_stmt 0 view .LVU91
+	movq	%rax, cpu_count(%rip)
+	.loc 1 99 5 is_stmt 1 view .LVU92
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL24:
+	.loc 1 100 5 view .LVU93
+	movq	cpu_count(%rip), %rsi
+	xorl	%eax, %eax
+	leaq	.LC5(%rip), %rdi
+	call	kprintf@PLT
+.LVL25:
+	.loc 1 102 5 view .LVU94
+	.loc 1 102 8 is_stmt 0 view .LVU95
+	cmpq	$64, cpu_count(%rip)
+	ja	.L11
+	.loc 1 125 5 is_stmt 1 view .LVU96
+	xorl	%eax, %eax
+	.loc 1 126 1 is_stmt 0 view .LVU97
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 125 5 view .LVU98
+	jmp	kmem_init_deferred@PLT
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+	.loc 1 103 9 is_stmt 1 view .LVU99
+	xorl	%eax, %eax
+	movl	$64, %esi
+	leaq	.LC6(%rip), %rdi
+	call	kprintf@PLT
+.LVL27:
+	.loc 1 104 9 view .LVU100
+	.loc 1 125 5 is_stmt 0 view .LVU101
+	xorl	%eax, %eax
+	.loc 1 104 19 view .LVU102
+	movq	$64, cpu_count(%rip)
+	.loc 1 125 5 is_stmt 1 view .LVU103
+	.loc 1 126 1 is_stmt 0 view .LVU104
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 125 5 view .LVU105
+	jmp	kmem_init_deferred@PLT
+.LVL28:
+	.cfi_endproc
+.LFE34:
+	.size	cpu_init, .-cpu_init
+	.globl	_cpu_lock
+	.bss
+	.type	_cpu_lock, @object
+	.size	_cpu_lock, 1
+_cpu_lock:
+	.zero	1
+	.globl	_cpus_awake
+	.data
+	.align 8
+	.type	_cpus_awake, @object
+	.size	_cpus_awake, 8
+_cpus_awake:
+	.quad	1
+	.globl	cpu_locals
+	.bss
+	.align 64
+	.type	cpu_locals, @object
+	.size	cpu_locals, 4096
+cpu_locals:
+	.zero	4096
+	.globl	cpu_count
+	.align 8
+	.type	cpu_count, @object
+	.size	cpu_count, 8
+cpu_count:
+	.zero	8
+	.globl	bsp_lapic_id
+	.align 4
+	.type	bsp_lapic_id, @object
+	.size	bsp_lapic_id, 4
+bsp_lapic_id:
+	.zero	4
+	.globl	smp_request
+	.data
+	.align 32
+	.type	smp_request, @object
+	.size	smp_request, 56
+smp_request:
+	.quad	-4057218587309601912
+	.quad	757423339400917115
+	.quad	-7663301919357827714
+	.quad	-6866270404442688544
+	.quad	0
+	.zero	8
+	.quad	0
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 5 "src/include/limine.h"
+	.file 6 "src/include/lapic.h"
+	.file 7 "src/include/mem.h"
+	.file 8 "src/include/str.h"
+	.file 9 "src/include/acpi.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x6b8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF50
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x9
+	.long	.LASF7
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x70
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x37
+	.byte	0x1b
+	.long	0x88
+	.uleb128 0x16
+	.long	0x77
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x1e
+	.long	.LASF51
+	.byte	0x40
+	.byte	0x40
+	.byte	0x2
+	.byte	0x33
+	.byte	0x8
+	.long	0xe0
+	.uleb128 0x8
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x34
+	.byte	0x17
+	.long	0xe0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x35
+	.byte	0xe
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x36
+	.byte	0xe
+	.long	0x64
+	.byte	0xc
+	.uleb128 0x8
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x37
+	.byte	0xe
+	.long	0x64
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0xd
+	.long	.LASF18
+	.byte	0x3a
+	.byte	0x11
+	.long	0x64
+	.uleb128 0xd
+	.long	.LASF19
+	.byte	0x3b
+	.byte	0x11
+	.long	0x77
+	.uleb128 0x1f
+	.long	0x9d
+	.byte	0x40
+	.long	0x10c
+	.uleb128 0x17
+	.long	0x88
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF20
+	.byte	0x3c
+	.byte	0x19
+	.long	0xfb
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF21
+	.uleb128 0x20
+	.long	0x117
+	.uleb128 0x21
+	.long	0x77
+	.long	0x133
+	.uleb128 0x17
+	.long	0x88
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	0x11e
+	.uleb128 0x22
+	.long	.LASF22
+	.byte	0x5
+	.value	0x130
+	.byte	0x10
+	.long	0x145
+	.uleb128 0x4
+	.long	0x14a
+	.uleb128 0x23
+	.long	0x155
+	.uleb128 0xe
+	.long	0x155
+	.byte	0
+	.uleb128 0x4
+	.long	0x15a
+	.uleb128 0xf
+	.long	.LASF27
+	.byte	0x20
+	.value	0x136
+	.long	0x1a8
+	.uleb128 0x1
+	.long	.LASF23
+	.value	0x137
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF16
+	.value	0x138
+	.byte	0xe
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF24
+	.value	0x139
+	.byte	0xe
+	.long	0x77
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF25
+	.value	0x13a
+	.byte	0x19
+	.long	0x138
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF26
+	.value	0x13b
+	.byte	0xe
+	.long	0x77
+	.byte	0x18
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF28
+	.byte	0x20
+	.value	0x13e
+	.long	0x1f6
+	.uleb128 0x1
+	.long	.LASF29
+	.value	0x13f
+	.byte	0xe
+	.long	0x77
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF30
+	.value	0x140
+	.byte	0xe
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF18
+	.value	0x141
+	.byte	0xe
+	.long	0x64
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF19
+	.value	0x142
+	.byte	0xe
+	.long	0x77
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF31
+	.value	0x143
+	.byte	0x1f
+	.long	0x1f6
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x155
+	.uleb128 0xf
+	.long	.LASF32
+	.byte	0x38
+	.value	0x16f
+	.long	0x23c
+	.uleb128 0x24
+	.string	"id"
+	.byte	0x5
+	.value	0x170
+	.byte	0xe
+	.long	0x123
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF29
+	.value	0x171
+	.byte	0xe
+	.long	0x77
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF33
+	.value	0x172
+	.byte	0x22
+	.long	0x241
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF30
+	.value	0x173
+	.byte	0xe
+	.long	0x77
+	.byte	0x30
+	.byte	0
+	.uleb128 0x16
+	.long	0x1fb
+	.uleb128 0x4
+	.long	0x1a8
+	.uleb128 0x25
+	.byte	0x1
+	.byte	0x3
+	.byte	0x17
+	.byte	0x9
+	.long	0x25d
+	.uleb128 0x8
+	.long	.LASF34
+	.byte	0x3
+	.byte	0x18
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF35
+	.byte	0x3
+	.byte	0x19
+	.byte	0x3
+	.long	0x246
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF36
+	.uleb128 0x10
+	.long	.LASF37
+	.byte	0x1b
+	.byte	0x24
+	.long	0x23c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	smp_request
+	.uleb128 0x11
+	.long	0xe5
+	.byte	0x20
+	.byte	0xa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bsp_lapic_id
+	.uleb128 0x11
+	.long	0xf0
+	.byte	0x21
+	.byte	0xa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cpu_count
+	.uleb128 0x11
+	.long	0x10c
+	.byte	0x23
+	.byte	0x12
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cpu_locals
+	.uleb128 0x10
+	.long	.LASF38
+	.byte	0x25
+	.byte	0x13
+	.long	0x83
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_cpus_awake
+	.uleb128 0x10
+	.long	.LASF39
+	.byte	0x26
+	.byte	0xc
+	.long	0x25d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_cpu_lock
+	.uleb128 0x26
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x30
+	.byte	0x6
+	.long	0x2f5
+	.uleb128 0xe
+	.long	0x133
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x17
+	.long	0x302
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF41
+	.byte	0x7
+	.byte	0xb9
+	.long	0x30f
+	.uleb128 0x12
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF52
+	.byte	0x9
+	.byte	0xa2
+	.byte	0xa
+	.long	0x64
+	.long	0x325
+	.uleb128 0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF53
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x6
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c1
+	.uleb128 0x6
+	.quad	.LVL24
+	.long	0x2e2
+	.long	0x362
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL25
+	.long	0x2e2
+	.long	0x381
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL26
+	.long	0x302
+	.uleb128 0x6
+	.quad	.LVL27
+	.long	0x2e2
+	.long	0x3b3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL28
+	.long	0x302
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF54
+	.byte	0x1
+	.byte	0x43
+	.byte	0x6
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x581
+	.uleb128 0x2a
+	.long	.LASF55
+	.byte	0x1
+	.byte	0x43
+	.byte	0x29
+	.long	0x155
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x13
+	.long	0x581
+	.quad	.LBI20
+	.byte	.LVU37
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.byte	0x4d
+	.long	0x494
+	.uleb128 0x5
+	.long	0x58e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.long	0x59a
+	.uleb128 0xa
+	.long	0x5a4
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x7
+	.long	0x5ae
+	.uleb128 0x7
+	.long	0x5b8
+	.uleb128 0xa
+	.long	0x5c2
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x1a
+	.long	0x604
+	.quad	.LBI22
+	.byte	.LVU58
+	.long	.LLRL10
+	.long	0x47d
+	.uleb128 0x5
+	.long	0x61b
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x5
+	.long	0x60f
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL13
+	.long	0x30f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 0
+	.byte	0x48
+	.byte	0x25
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x5ec
+	.quad	.LBI26
+	.byte	.LVU66
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.byte	0x54
+	.long	0x4bd
+	.uleb128 0x2b
+	.long	0x5f7
+	.byte	0
+	.uleb128 0x13
+	.long	0x5cf
+	.quad	.LBI28
+	.byte	.LVU75
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.byte	0x5a
+	.long	0x4ee
+	.uleb128 0x5
+	.long	0x5da
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL16
+	.long	0x302
+	.uleb128 0x1b
+	.quad	.LVL17
+	.long	0x2f5
+	.uleb128 0x6
+	.quad	.LVL18
+	.long	0x2e2
+	.long	0x527
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL19
+	.long	0x2e2
+	.long	0x546
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL20
+	.long	0x2e2
+	.long	0x565
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL21
+	.long	0x2e2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF43
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x6
+	.byte	0x1
+	.long	0x5cf
+	.uleb128 0xb
+	.long	.LASF15
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x1e
+	.long	0x64
+	.uleb128 0xc
+	.string	"eax"
+	.byte	0xe
+	.long	0x64
+	.uleb128 0xc
+	.string	"ebx"
+	.byte	0x13
+	.long	0x64
+	.uleb128 0xc
+	.string	"ecx"
+	.byte	0x18
+	.long	0x64
+	.uleb128 0xc
+	.string	"edx"
+	.byte	0x1d
+	.long	0x64
+	.uleb128 0x2d
+	.long	.LASF44
+	.byte	0x1
+	.byte	0x37
+	.byte	0x17
+	.long	0xe0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF46
+	.byte	0x3
+	.byte	0x22
+	.long	0x5e7
+	.uleb128 0xb
+	.long	.LASF45
+	.byte	0x3
+	.byte	0x22
+	.byte	0x30
+	.long	0x5e7
+	.byte	0
+	.uleb128 0x4
+	.long	0x25d
+	.uleb128 0x15
+	.long	.LASF47
+	.byte	0x3
+	.byte	0x1b
+	.long	0x604
+	.uleb128 0xb
+	.long	.LASF45
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x5e7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF48
+	.byte	0x2
+	.byte	0xa9
+	.long	0x628
+	.uleb128 0xb
+	.long	.LASF49
+	.byte	0x2
+	.byte	0xa9
+	.byte	0x27
+	.long	0x64
+	.uleb128 0x2e
+	.string	"val"
+	.byte	0x2
+	.byte	0xa9
+	.byte	0x38
+	.long	0x77
+	.byte	0
+	.uleb128 0x2f
+	.long	0x581
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x5
+	.long	0x58e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	0x59a
+	.uleb128 0xa
+	.long	0x5a4
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	0x5ae
+	.uleb128 0x7
+	.long	0x5b8
+	.uleb128 0xa
+	.long	0x5c2
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1a
+	.long	0x604
+	.quad	.LBI8
+	.byte	.LVU24
+	.long	.LLRL3
+	.long	0x6a6
+	.uleb128 0x5
+	.long	0x61b
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x5
+	.long	0x60f
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL5
+	.long	0x30f
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 46
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 61
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU37
+	.uleb128 .LVU54
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU42
+	.uleb128 .LVU62
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU46
+	.uleb128 .LVU62
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU58
+	.uleb128 .LVU62
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU58
+	.uleb128 .LVU62
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0xc0000101
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_cpu_lock
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU7
+	.uleb128 .LVU10
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU11
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x16
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x36
+	.byte	0x24
+	.byte	0x3
+	.quad	cpu_locals
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU24
+	.uleb128 .LVU28
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU24
+	.uleb128 .LVU28
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0xc0000101
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF35:
+	.string	"spinlock_t"
+.LASF37:
+	.string	"smp_request"
+.LASF29:
+	.string	"revision"
+.LASF55:
+	.string	"smp_info"
+.LASF24:
+	.string	"reserved"
+.LASF46:
+	.string	"spinlock_unlock"
+.LASF27:
+	.string	"limine_smp_info"
+.LASF6:
+	.string	"short unsigned int"
+.LASF53:
+	.string	"cpu_init"
+.LASF10:
+	.string	"uint64_t"
+.LASF42:
+	.string	"kprintf"
+.LASF18:
+	.string	"bsp_lapic_id"
+.LASF25:
+	.string	"goto_address"
+.LASF32:
+	.string	"limine_smp_request"
+.LASF47:
+	.string	"spinlock_lock"
+.LASF5:
+	.string	"unsigned char"
+.LASF41:
+	.string	"kmem_init_deferred"
+.LASF40:
+	.string	"lapic_init"
+.LASF39:
+	.string	"_cpu_lock"
+.LASF11:
+	.string	"long unsigned int"
+.LASF48:
+	.string	"write_msr"
+.LASF43:
+	.string	"cpu_local_init"
+.LASF34:
+	.string	"lock"
+.LASF22:
+	.string	"limine_goto_address"
+.LASF28:
+	.string	"limine_smp_response"
+.LASF3:
+	.string	"short int"
+.LASF19:
+	.string	"cpu_count"
+.LASF14:
+	.string	"self"
+.LASF51:
+	.string	"cpu_local"
+.LASF9:
+	.string	"unsigned int"
+.LASF30:
+	.string	"flags"
+.LASF21:
+	.string	"char"
+.LASF7:
+	.string	"uint8_t"
+.LASF33:
+	.string	"response"
+.LASF54:
+	.string	"_cpu_awake"
+.LASF50:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF12:
+	.string	"long long int"
+.LASF20:
+	.string	"cpu_locals"
+.LASF15:
+	.string	"index"
+.LASF16:
+	.string	"lapic_id"
+.LASF52:
+	.string	"acpi_numa_node_of_apic"
+.LASF17:
+	.string	"node"
+.LASF8:
+	.string	"uint32_t"
+.LASF4:
+	.string	"long int"
+.LASF45:
+	.string	"pLock"
+.LASF13:
+	.string	"long double"
+.LASF2:
+	.string	"signed char"
+.LASF31:
+	.string	"cpus"
+.LASF38:
+	.string	"_cpus_awake"
+.LASF23:
+	.string	"processor_id"
+.LASF36:
+	.string	"_Bool"
+.LASF26:
+	.string	"extra_argument"
+.LASF49:
+	.string	"msr_id"
+.LASF44:
+	.string	"pLocal"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/cpu.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
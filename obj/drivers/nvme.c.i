@@ -0,0 +1,269 @@
+# 0 "src/drivers/nvme.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/drivers/nvme.c"
+# 19 "src/drivers/nvme.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 20 "src/drivers/nvme.c" 2
+# 1 "src/include/pci.h" 1
+# 31 "src/include/pci.h"
+
+# 31 "src/include/pci.h"
+struct pci_device {
+    uint8_t class_code;
+    uint8_t sub_class_code;
+    uint8_t bus;
+    uint8_t device;
+    uint8_t function;
+    uint8_t prog_if;
+    const char* description;
+    uint64_t address;
+    uint32_t header_type;
+};
+
+extern struct pci_device *pci_devices[];
+extern uint8_t pci_device_cnt;
+
+void pci_init();
+struct pci_device* pci_find_device(uint8_t class, uint8_t subclass);
+
+uint32_t pci_device_read(struct pci_device *dev, uint32_t offset, uint8_t size);
+void pci_device_write(struct pci_device *dev, uint32_t offset, uint8_t size, uint32_t val);
+# 21 "src/drivers/nvme.c" 2
+# 1 "src/include/nvme.h" 1
+# 21 "src/include/nvme.h"
+void nvme_init();
+# 22 "src/drivers/nvme.c" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 23 "src/drivers/nvme.c" 2
+# 1 "src/kernel.h" 1
+# 22 "src/kernel.h"
+# 1 "src/include/queue.h" 1
+# 21 "src/include/queue.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "src/include/queue.h" 2
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 23 "src/include/queue.h" 2
+
+
+typedef struct {
+    volatile uint32_t read_i;
+    volatile uint32_t write_i;
+    uint32_t *buff;
+    uint32_t len;
+    volatile uint32_t num_items;
+    spinlock_t lock;
+} __attribute__((packed)) CQueue_t;
+
+CQueue_t* cqueue_create(uint32_t len);
+
+# 35 "src/include/queue.h" 3 4
+_Bool 
+# 35 "src/include/queue.h"
+           cqueue_write(CQueue_t *q, uint32_t val);
+uint32_t cqueue_read(CQueue_t *q);
+# 23 "src/kernel.h" 2
+
+void report_cpu_details();
+
+
+static inline void hcf(void)
+{
+    asm("cli");
+    for (;;) {
+        asm("hlt");
+    }
+}
+
+extern CQueue_t *q_keyboard;
+# 24 "src/drivers/nvme.c" 2
+
+void nvme_init()
+{
+    struct pci_device* dev = pci_find_device(0x01, 0x08);
+    if (dev == 
+# 28 "src/drivers/nvme.c" 3 4
+              ((void *)0)
+# 28 "src/drivers/nvme.c"
+                  ) {
+        kprintf("NVME: Controller not found.\n");
+        return;
+    }
+
+    kprintf("NVME Header Type: 0x%X\n", dev->header_type);
+
+
+
+
+
+    uint32_t bar0 = pci_device_read(dev, 0x10, 4);
+    pci_device_write(dev, 0x10, 4, ~0);
+    uint32_t size_low = pci_device_read(dev, 0x10, 4);
+    pci_device_write(dev, 0x10, 4, bar0);
+
+
+
+
+
+    if (bar0 & 1) {
+
+        kprintf("**FATAL**: BAR0 in the NVME controller should be memory space.");
+    } else {
+
+        kprintf("NVME: Memory Space BAR0 verified.\n");
+    }
+
+
+
+
+    if ((bar0 & 0b111) == 0b100) {
+        kprintf("BAR0 is 64-bit.\n");
+    }
+
+
+    uint32_t base_high = pci_device_read(dev, 0x10 + 4, 4);
+    kprintf("NVME Base High: 0x%X\n", base_high);
+
+
+    uint32_t base_low = bar0 & 0xfffffff0;
+
+
+    uint64_t bar0_base_addr = base_low;
+    bar0_base_addr |= ((uint64_t)base_high << 32);
+
+
+
+    size_t length = ~(size_low & ~0b1111) + 1;
+    kprintf("BAR0 Length: %lu\n", length);
+
+
+
+
+
+    kprintf("NVME: Initialized.\n");
+}
@@ -0,0 +1,1215 @@
+	.file	"nvme.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/drivers/nvme.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"NVME: Controller not found.\n"
+.LC1:
+	.string	"NVME Header Type: 0x%X\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"**FATAL**: BAR0 in the NVME controller should be memory space."
+	.align 8
+.LC3:
+	.string	"NVME: Memory Space BAR0 verified.\n"
+	.section	.rodata.str1.1
+.LC4:
+	.string	"BAR0 is 64-bit.\n"
+.LC5:
+	.string	"NVME Base High: 0x%X\n"
+.LC6:
+	.string	"BAR0 Length: %lu\n"
+.LC7:
+	.string	"NVME: Initialized.\n"
+	.text
+	.p2align 4
+	.globl	nvme_init
+	.type	nvme_init, @function
+nvme_init:
+.LFB3:
+	.file 1 "src/drivers/nvme.c"
+	.loc 1 26 1 view -0
+	.cfi_startproc
+	.loc 1 27 5 view .LVU1
+	.loc 1 26 1 is_stmt 0 view .LVU2
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 27 30 view .LVU3
+	movl	$1, %edi
+	movl	$8, %esi
+	.loc 1 26 1 view .LVU4
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 27 30 view .LVU5
+	call	pci_find_device@PLT
+.LVL0:
+	.loc 1 28 5 is_stmt 1 view .LVU6
+	.loc 1 29 9 is_stmt 0 view .LVU7
+	leaq	.LC0(%rip), %rdi
+	.loc 1 28 8 view .LVU8
+	testq	%rax, %rax
+	je	.L7
+	.loc 1 33 5 view .LVU9
+	movl	24(%rax), %esi
+	movq	%rax, %rbx
+	.loc 1 33 5 is_stmt 1 view .LVU10
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+.LVL1:
+	.loc 1 33 5 is_stmt 0 view .LVU11
+	call	kprintf@PLT
+.LVL2:
+	.loc 1 39 5 is_stmt 1 view .LVU12
+	.loc 1 39 21 is_stmt 0 view .LVU13
+	movl	$4, %edx
+	movl	$16, %esi
+	movq	%rbx, %rdi
+	call	pci_device_read@PLT
+.LVL3:
+	.loc 1 40 5 view .LVU14
+	movl	$-1, %ecx
+	movl	$4, %edx
+	movq	%rbx, %rdi
+	movl	$16, %esi
+	.loc 1 39 21 view .LVU15
+	movl	%eax, %ebp
+.LVL4:
+	.loc 1 40 5 is_stmt 1 view .LVU16
+	call	pci_device_write@PLT
+.LVL5:
+	.loc 1 41 5 view .LVU17
+	.loc 1 41 25 is_stmt 0 view .LVU18
+	movl	$4, %edx
+	movl	$16, %esi
+	movq	%rbx, %rdi
+	call	pci_device_read@PLT
+.LVL6:
+	.loc 1 42 5 view .LVU19
+	movl	%ebp, %ecx
+	movl	$4, %edx
+	movq	%rbx, %rdi
+	movl	$16, %esi
+	.loc 1 41 25 view .LVU20
+	movl	%eax, %r12d
+.LVL7:
+	.loc 1 42 5 is_stmt 1 view .LVU21
+	call	pci_device_write@PLT
+.LVL8:
+	.loc 1 48 5 view .LVU22
+	.loc 1 48 8 is_stmt 0 view .LVU23
+	testb	$1, %bpl
+	jne	.L9
+	.loc 1 53 9 is_stmt 1 view .LVU24
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 59 15 is_stmt 0 view .LVU25
+	andl	$7, %ebp
+.LVL9:
+	.loc 1 53 9 view .LVU26
+	call	kprintf@PLT
+.LVL10:
+	.loc 1 59 5 is_stmt 1 view .LVU27
+	.loc 1 59 8 is_stmt 0 view .LVU28
+	cmpl	$4, %ebp
+	je	.L10
+.L5:
+	.loc 1 64 5 is_stmt 1 view .LVU29
+	.loc 1 64 26 is_stmt 0 view .LVU30
+	movl	$4, %edx
+	movl	$20, %esi
+	movq	%rbx, %rdi
+	call	pci_device_read@PLT
+.LVL11:
+	.loc 1 65 5 view .LVU31
+	leaq	.LC5(%rip), %rdi
+	.loc 1 64 26 view .LVU32
+	movl	%eax, %esi
+.LVL12:
+	.loc 1 65 5 is_stmt 1 view .LVU33
+	xorl	%eax, %eax
+.LVL13:
+	.loc 1 65 5 is_stmt 0 view .LVU34
+	call	kprintf@PLT
+.LVL14:
+	.loc 1 68 5 is_stmt 1 view .LVU35
+	.loc 1 71 5 view .LVU36
+	.loc 1 72 5 view .LVU37
+	.loc 1 76 5 view .LVU38
+	.loc 1 77 5 view .LVU39
+	.loc 1 76 32 is_stmt 0 view .LVU40
+	movl	%r12d, %esi
+	.loc 1 77 5 view .LVU41
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 76 32 view .LVU42
+	andl	$-16, %esi
+	.loc 1 76 12 view .LVU43
+	negl	%esi
+.LVL15:
+	.loc 1 77 5 view .LVU44
+	call	kprintf@PLT
+.LVL16:
+	.loc 1 83 5 is_stmt 1 view .LVU45
+	leaq	.LC7(%rip), %rdi
+.LVL17:
+.L7:
+	.loc 1 84 1 is_stmt 0 view .LVU46
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	.loc 1 83 5 view .LVU47
+	xorl	%eax, %eax
+	.loc 1 84 1 view .LVU48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	.loc 1 83 5 view .LVU49
+	jmp	kprintf@PLT
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.cfi_restore_state
+	.loc 1 50 9 is_stmt 1 view .LVU50
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 59 15 is_stmt 0 view .LVU51
+	andl	$7, %ebp
+.LVL19:
+	.loc 1 50 9 view .LVU52
+	call	kprintf@PLT
+.LVL20:
+	.loc 1 59 5 is_stmt 1 view .LVU53
+	.loc 1 59 8 is_stmt 0 view .LVU54
+	cmpl	$4, %ebp
+	jne	.L5
+.L10:
+	.loc 1 60 9 is_stmt 1 view .LVU55
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL21:
+	jmp	.L5
+	.cfi_endproc
+.LFE3:
+	.size	nvme_init, .-nvme_init
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 3 "src/include/pci.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3d1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xc
+	.long	.LASF35
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x6
+	.long	.LASF7
+	.byte	0x2
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.long	.LASF8
+	.byte	0x2
+	.byte	0x34
+	.byte	0x16
+	.long	0x70
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x6
+	.long	.LASF10
+	.byte	0x2
+	.byte	0x37
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0xe
+	.long	.LASF36
+	.byte	0x20
+	.byte	0x3
+	.byte	0x1f
+	.byte	0x8
+	.long	0x105
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x20
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x21
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0xf
+	.string	"bus"
+	.byte	0x3
+	.byte	0x22
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x23
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x24
+	.byte	0xd
+	.long	0x4a
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x25
+	.byte	0xd
+	.long	0x4a
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x26
+	.byte	0x11
+	.long	0x105
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x27
+	.byte	0xe
+	.long	0x77
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x28
+	.byte	0xe
+	.long	0x64
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.long	0x111
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF20
+	.uleb128 0x10
+	.long	0x10a
+	.uleb128 0x8
+	.long	0x8a
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF22
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF23
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x3
+	.byte	0x32
+	.long	0x155
+	.uleb128 0x4
+	.long	0x116
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x4a
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF26
+	.byte	0x31
+	.byte	0xa
+	.long	0x64
+	.long	0x174
+	.uleb128 0x4
+	.long	0x116
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x4a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x30
+	.long	0x186
+	.uleb128 0x4
+	.long	0x105
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF27
+	.byte	0x2f
+	.byte	0x14
+	.long	0x116
+	.long	0x1a0
+	.uleb128 0x4
+	.long	0x4a
+	.uleb128 0x4
+	.long	0x4a
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x19
+	.byte	0x6
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x13
+	.string	"dev"
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x18
+	.long	0x116
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	.LASF29
+	.byte	0x27
+	.byte	0xe
+	.long	0x64
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x7
+	.long	.LASF30
+	.byte	0x29
+	.byte	0xe
+	.long	0x64
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x7
+	.long	.LASF31
+	.byte	0x40
+	.byte	0xe
+	.long	0x64
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xb
+	.long	.LASF32
+	.byte	0x44
+	.long	0x64
+	.uleb128 0xb
+	.long	.LASF33
+	.byte	0x47
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF34
+	.byte	0x4c
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.quad	.LVL0
+	.long	0x186
+	.long	0x24a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL2
+	.long	0x174
+	.long	0x269
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL3
+	.long	0x155
+	.long	0x28b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL5
+	.long	0x135
+	.long	0x2b3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL6
+	.long	0x155
+	.long	0x2d5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL8
+	.long	0x135
+	.long	0x2fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL10
+	.long	0x174
+	.long	0x31c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL11
+	.long	0x155
+	.long	0x33e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL14
+	.long	0x174
+	.long	0x35d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x2
+	.quad	.LVL16
+	.long	0x174
+	.long	0x38c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL18
+	.long	0x174
+	.uleb128 0x2
+	.quad	.LVL20
+	.long	0x174
+	.long	0x3b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL21
+	.long	0x174
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 .LVU6
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU46
+	.uleb128 .LVU50
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU16
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU26
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU21
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU46
+	.uleb128 .LVU50
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU35
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU39
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0xd
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0xd
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF21:
+	.string	"size_t"
+.LASF16:
+	.string	"prog_if"
+.LASF27:
+	.string	"pci_find_device"
+.LASF10:
+	.string	"uint64_t"
+.LASF25:
+	.string	"kprintf"
+.LASF31:
+	.string	"base_high"
+.LASF17:
+	.string	"description"
+.LASF5:
+	.string	"unsigned char"
+.LASF30:
+	.string	"size_low"
+.LASF18:
+	.string	"address"
+.LASF11:
+	.string	"long unsigned int"
+.LASF26:
+	.string	"pci_device_read"
+.LASF6:
+	.string	"short unsigned int"
+.LASF19:
+	.string	"header_type"
+.LASF29:
+	.string	"bar0"
+.LASF28:
+	.string	"nvme_init"
+.LASF33:
+	.string	"bar0_base_addr"
+.LASF13:
+	.string	"sub_class_code"
+.LASF9:
+	.string	"unsigned int"
+.LASF36:
+	.string	"pci_device"
+.LASF20:
+	.string	"char"
+.LASF7:
+	.string	"uint8_t"
+.LASF32:
+	.string	"base_low"
+.LASF35:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF24:
+	.string	"pci_device_write"
+.LASF22:
+	.string	"long long int"
+.LASF3:
+	.string	"short int"
+.LASF8:
+	.string	"uint32_t"
+.LASF4:
+	.string	"long int"
+.LASF23:
+	.string	"long double"
+.LASF14:
+	.string	"device"
+.LASF2:
+	.string	"signed char"
+.LASF12:
+	.string	"class_code"
+.LASF34:
+	.string	"length"
+.LASF15:
+	.string	"function"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/drivers/nvme.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1041 @@
+# 0 "src/drivers/ps2.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/drivers/ps2.c"
+# 18 "src/drivers/ps2.c"
+# 1 "src/include/ps2.h" 1
+# 21 "src/include/ps2.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 22 "src/include/ps2.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/ps2.h" 2
+
+
+
+
+
+
+
+# 29 "src/include/ps2.h"
+typedef struct KeyEvent {
+    uint8_t scan_code;
+    uint8_t event_type;
+    char ascii;
+    
+# 33 "src/include/ps2.h" 3 4
+   _Bool 
+# 33 "src/include/ps2.h"
+        is_control;
+} KeyEvent_t;
+
+extern KeyEvent_t* scancode_map[];
+
+uint8_t ps2_read();
+uint8_t ps2_read_no_wait();
+void ps2_init();
+# 19 "src/drivers/ps2.c" 2
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 43 "src/include/cpu.h" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 44 "src/include/cpu.h" 2
+
+
+
+
+
+
+
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 20 "src/drivers/ps2.c" 2
+# 1 "src/include/lapic.h" 1
+# 23 "src/include/lapic.h"
+void lapic_init();
+void lapic_eoi();
+void lapic_raiseint(uint32_t lapic_id, uint32_t vector);
+
+extern uint32_t lapic_id;
+# 21 "src/drivers/ps2.c" 2
+# 1 "src/include/idt.h" 1
+# 22 "src/include/idt.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/idt.h" 2
+
+
+
+
+
+
+
+struct idt_entry
+{
+    uint16_t base_low;
+    uint16_t selector;
+    uint8_t ist;
+    uint8_t flags;
+    uint16_t base_mid;
+    uint32_t base_high;
+    uint32_t reserved;
+} __attribute__((packed));
+
+struct idt_ptr
+{
+    uint16_t limit;
+    uint64_t base;
+} __attribute__((packed));
+
+struct idt_frame {
+    uint64_t rip;
+    uint64_t cs;
+    uint64_t flags;
+    uint64_t rsp;
+    uint64_t ss;
+};
+
+void idt_init();
+
+extern volatile uint64_t kernel_timer_secs;
+# 22 "src/drivers/ps2.c" 2
+# 1 "src/include/ioapic.h" 1
+# 22 "src/include/ioapic.h"
+# 1 "src/include/acpi.h" 1
+# 23 "src/include/acpi.h"
+void acpi_init();
+
+
+struct ioapic
+{
+    char type;
+    char length;
+    char ioapic_id;
+    char reserved;
+    uint32_t ioapic_addr;
+    uint32_t gsi_base;
+} __attribute__((packed));
+
+
+struct iso {
+    char type;
+    char length;
+    uint8_t bus_source;
+    uint8_t irq_source;
+    uint32_t gsi;
+    uint16_t flags;
+} __attribute__((packed));
+
+
+struct sysdesc {
+    char signature[4];
+    uint32_t length;
+    uint8_t revision;
+    uint8_t checksum;
+    char oem_id[6];
+    char oem_table_id[8];
+    uint32_t oem_revision;
+    uint32_t creator_id;
+    uint32_t creator_revision;
+} __attribute__((packed));
+
+struct address_structure
+{
+    uint8_t address_space_id;
+    uint8_t register_bit_width;
+    uint8_t register_bit_offset;
+    uint8_t reserved;
+    uint64_t address;
+} __attribute__((packed));
+
+
+struct hpet
+{
+    struct sysdesc desc;
+    uint8_t hardware_rev_id;
+    uint8_t comparator_count:5;
+    uint8_t counter_size:1;
+    uint8_t reserved:1;
+    uint8_t legacy_replacement:1;
+    uint16_t pci_vendor_id;
+    struct address_structure address;
+    uint8_t hpet_number;
+    uint16_t minimum_tick;
+    uint8_t page_protection;
+} __attribute__((packed));
+
+
+struct mcfg_entry {
+    struct sysdesc desc;
+    char reserved1[8];
+    uint64_t mmio_base;
+    uint16_t segment;
+    uint8_t start;
+    uint8_t end;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+
+struct srat_lapic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint8_t proximity_domain_low;
+    uint8_t apic_id;
+    uint32_t flags;
+    uint8_t sapic_eid;
+    uint8_t proximity_domain_high[3];
+    uint32_t clock_domain;
+} __attribute__((packed));
+
+
+struct srat_mem_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint32_t proximity_domain;
+    uint16_t reserved1;
+    uint64_t base;
+    uint64_t range_length;
+    uint32_t reserved2;
+    uint32_t flags;
+    uint64_t reserved3;
+} __attribute__((packed));
+
+
+struct srat_x2apic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint16_t reserved1;
+    uint32_t proximity_domain;
+    uint32_t x2apic_id;
+    uint32_t flags;
+    uint32_t clock_domain;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+
+struct slit {
+    struct sysdesc desc;
+    uint64_t num_localities;
+    uint8_t entries[];
+} __attribute__((packed));
+# 149 "src/include/acpi.h"
+struct numa_cpu {
+    uint32_t apic_id;
+    uint32_t node;
+};
+
+extern struct ioapic *ioapic_list[];
+extern struct iso *iso_list[];
+extern struct hpet *hpet;
+extern struct mcfg_entry *mcfg;
+extern struct srat_mem_affinity *srat_mem_list[];
+extern uint32_t numa_node_count;
+
+uint32_t acpi_numa_node(uint32_t proximity_domain);
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id);
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node);
+# 23 "src/include/ioapic.h" 2
+
+
+
+
+
+
+
+void ioapic_write(struct ioapic *pApic, const uint8_t offset, const uint32_t val);
+uint32_t ioapic_read(struct ioapic *pApic, const uint8_t offset);
+
+void ioapic_redirect_irq(uint32_t lapic_id, uint8_t vector, uint8_t irq, 
+# 33 "src/include/ioapic.h" 3 4
+                                                                        _Bool 
+# 33 "src/include/ioapic.h"
+                                                                             status);
+# 23 "src/drivers/ps2.c" 2
+# 32 "src/drivers/ps2.c"
+KeyEvent_t key_map[] = {
+
+    { .scan_code = 2, .event_type = 0, .ascii = '1' },
+    { .scan_code = 130, .event_type = 1, .ascii = '1' },
+    { .scan_code = 3, .event_type = 0, .ascii = '2' },
+    { .scan_code = 131, .event_type = 1, .ascii = '2' },
+    { .scan_code = 4, .event_type = 0, .ascii = '3' },
+    { .scan_code = 132, .event_type = 1, .ascii = '3' },
+    { .scan_code = 5, .event_type = 0, .ascii = '4' },
+    { .scan_code = 133, .event_type = 1, .ascii = '4' },
+    { .scan_code = 6, .event_type = 0, .ascii = '5' },
+    { .scan_code = 134, .event_type = 1, .ascii = '5' },
+    { .scan_code = 7, .event_type = 0, .ascii = '6' },
+    { .scan_code = 135, .event_type = 1, .ascii = '6' },
+    { .scan_code = 8, .event_type = 0, .ascii = '7' },
+    { .scan_code = 136, .event_type = 1, .ascii = '7' },
+    { .scan_code = 9, .event_type = 0, .ascii = '8' },
+    { .scan_code = 137, .event_type = 1, .ascii = '8' },
+    { .scan_code = 10, .event_type = 0, .ascii = '9' },
+    { .scan_code = 138, .event_type = 1, .ascii = '9' },
+    { .scan_code = 11, .event_type = 0, .ascii = '0' },
+    { .scan_code = 139, .event_type = 1, .ascii = '0' },
+    { .scan_code = 12, .event_type = 0, .ascii = '-' },
+    { .scan_code = 140, .event_type = 1, .ascii = '-' },
+    { .scan_code = 13, .event_type = 0, .ascii = '=' },
+    { .scan_code = 141, .event_type = 1, .ascii = '=' },
+
+
+    { .scan_code = 16, .event_type = 0, .ascii = 'q' },
+    { .scan_code = 144, .event_type = 1, .ascii = 'q' },
+    { .scan_code = 17, .event_type = 0, .ascii = 'w' },
+    { .scan_code = 145, .event_type = 1, .ascii = 'w' },
+    { .scan_code = 18, .event_type = 0, .ascii = 'e' },
+    { .scan_code = 146, .event_type = 1, .ascii = 'e' },
+    { .scan_code = 19, .event_type = 0, .ascii = 'r' },
+    { .scan_code = 147, .event_type = 1, .ascii = 'r' },
+    { .scan_code = 20, .event_type = 0, .ascii = 't' },
+    { .scan_code = 148, .event_type = 1, .ascii = 't' },
+    { .scan_code = 21, .event_type = 0, .ascii = 'y' },
+    { .scan_code = 149, .event_type = 1, .ascii = 'y' },
+    { .scan_code = 22, .event_type = 0, .ascii = 'u' },
+    { .scan_code = 150, .event_type = 1, .ascii = 'u' },
+    { .scan_code = 23, .event_type = 0, .ascii = 'i' },
+    { .scan_code = 151, .event_type = 1, .ascii = 'i' },
+    { .scan_code = 24, .event_type = 0, .ascii = 'o' },
+    { .scan_code = 152, .event_type = 1, .ascii = 'o' },
+    { .scan_code = 25, .event_type = 0, .ascii = 'p' },
+    { .scan_code = 153, .event_type = 1, .ascii = 'p' },
+    { .scan_code = 26, .event_type = 0, .ascii = '[' },
+    { .scan_code = 154, .event_type = 1, .ascii = '[' },
+    { .scan_code = 27, .event_type = 0, .ascii = ']' },
+    { .scan_code = 155, .event_type = 1, .ascii = ']' },
+
+
+    { .scan_code = 30, .event_type = 0, .ascii = 'a' },
+    { .scan_code = 158, .event_type = 1, .ascii = 'a' },
+    { .scan_code = 31, .event_type = 0, .ascii = 's' },
+    { .scan_code = 159, .event_type = 1, .ascii = 's' },
+    { .scan_code = 32, .event_type = 0, .ascii = 'd' },
+    { .scan_code = 160, .event_type = 1, .ascii = 'd' },
+    { .scan_code = 33, .event_type = 0, .ascii = 'f' },
+    { .scan_code = 161, .event_type = 1, .ascii = 'f' },
+    { .scan_code = 34, .event_type = 0, .ascii = 'g' },
+    { .scan_code = 162, .event_type = 1, .ascii = 'g' },
+    { .scan_code = 35, .event_type = 0, .ascii = 'h' },
+    { .scan_code = 163, .event_type = 1, .ascii = 'h' },
+    { .scan_code = 36, .event_type = 0, .ascii = 'j' },
+    { .scan_code = 164, .event_type = 1, .ascii = 'j' },
+    { .scan_code = 37, .event_type = 0, .ascii = 'k' },
+    { .scan_code = 165, .event_type = 1, .ascii = 'k' },
+    { .scan_code = 38, .event_type = 0, .ascii = 'l' },
+    { .scan_code = 166, .event_type = 1, .ascii = 'l' },
+    { .scan_code = 39, .event_type = 0, .ascii = ';' },
+    { .scan_code = 167, .event_type = 1, .ascii = ';' },
+    { .scan_code = 40, .event_type = 0, .ascii = '\'' },
+    { .scan_code = 168, .event_type = 1, .ascii = '\'' },
+
+
+    { .scan_code = 43, .event_type = 0, .ascii = '#' },
+    { .scan_code = 171, .event_type = 1, .ascii = '#' },
+    { .scan_code = 57, .event_type = 0, .ascii = ' ' },
+    { .scan_code = 185, .event_type = 1, .ascii = ' ' },
+    { .scan_code = 53, .event_type = 0, .ascii = '/' },
+    { .scan_code = 181, .event_type = 1, .ascii = '/' },
+    { .scan_code = 41, .event_type = 0, .ascii = '`' },
+    { .scan_code = 169, .event_type = 1, .ascii = '`' },
+
+
+    { .scan_code = 44, .event_type = 0, .ascii = 'z' },
+    { .scan_code = 172, .event_type = 1, .ascii = 'z' },
+    { .scan_code = 45, .event_type = 0, .ascii = 'x' },
+    { .scan_code = 173, .event_type = 1, .ascii = 'x' },
+    { .scan_code = 46, .event_type = 0, .ascii = 'c' },
+    { .scan_code = 174, .event_type = 1, .ascii = 'c' },
+    { .scan_code = 47, .event_type = 0, .ascii = 'v' },
+    { .scan_code = 175, .event_type = 1, .ascii = 'v' },
+    { .scan_code = 48, .event_type = 0, .ascii = 'b' },
+    { .scan_code = 176, .event_type = 1, .ascii = 'b' },
+    { .scan_code = 49, .event_type = 0, .ascii = 'n' },
+    { .scan_code = 177, .event_type = 1, .ascii = 'n' },
+    { .scan_code = 50, .event_type = 0, .ascii = 'm' },
+    { .scan_code = 178, .event_type = 1, .ascii = 'm' },
+    { .scan_code = 51, .event_type = 0, .ascii = ',' },
+    { .scan_code = 179, .event_type = 1, .ascii = ',' },
+    { .scan_code = 52, .event_type = 0, .ascii = '.' },
+    { .scan_code = 180, .event_type = 1, .ascii = '.' },
+
+
+    { .scan_code = 71, .event_type = 0, .ascii = '7' },
+    { .scan_code = 199, .event_type = 1, .ascii = '7' },
+    { .scan_code = 72, .event_type = 0, .ascii = '8' },
+    { .scan_code = 200, .event_type = 1, .ascii = '8' },
+    { .scan_code = 73, .event_type = 0, .ascii = '9' },
+    { .scan_code = 201, .event_type = 1, .ascii = '9' },
+    { .scan_code = 75, .event_type = 0, .ascii = '4' },
+    { .scan_code = 203, .event_type = 1, .ascii = '4' },
+    { .scan_code = 76, .event_type = 0, .ascii = '5' },
+    { .scan_code = 204, .event_type = 1, .ascii = '5' },
+    { .scan_code = 77, .event_type = 0, .ascii = '6' },
+    { .scan_code = 205, .event_type = 1, .ascii = '6' },
+    { .scan_code = 79, .event_type = 0, .ascii = '1' },
+    { .scan_code = 207, .event_type = 1, .ascii = '1' },
+    { .scan_code = 80, .event_type = 0, .ascii = '2' },
+    { .scan_code = 208, .event_type = 1, .ascii = '2' },
+    { .scan_code = 81, .event_type = 0, .ascii = '3' },
+    { .scan_code = 209, .event_type = 1, .ascii = '3' },
+    { .scan_code = 82, .event_type = 0, .ascii = '0' },
+    { .scan_code = 210, .event_type = 1, .ascii = '0' },
+    { .scan_code = 83, .event_type = 0, .ascii = '.' },
+    { .scan_code = 211, .event_type = 1, .ascii = '.' },
+    { .scan_code = 224, .event_type = 1, .ascii = '/' },
+    { .scan_code = 55, .event_type = 0, .ascii = '*' },
+    { .scan_code = 183, .event_type = 1, .ascii = '*' },
+    { .scan_code = 74, .event_type = 0, .ascii = '-' },
+    { .scan_code = 202, .event_type = 1, .ascii = '-' },
+    { .scan_code = 78, .event_type = 0, .ascii = '+' },
+    { .scan_code = 206, .event_type = 1, .ascii = '+' },
+    { .scan_code = 69, .event_type = 0, .ascii = 0 },
+    { .scan_code = 197, .event_type = 1, .ascii = 0 },
+
+
+    { .scan_code = 28, .event_type = 0, .ascii = '\n', .is_control = 
+# 173 "src/drivers/ps2.c" 3 4
+                                                                    1 
+# 173 "src/drivers/ps2.c"
+                                                                         },
+    { .scan_code = 156, .event_type = 1, .ascii = 0, .is_control = 
+# 174 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 174 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 14, .event_type = 0, .ascii = 0, .is_control = 
+# 175 "src/drivers/ps2.c" 3 4
+                                                                 1 
+# 175 "src/drivers/ps2.c"
+                                                                      },
+    { .scan_code = 142, .event_type = 1, .ascii = 0, .is_control = 
+# 176 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 176 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 42, .event_type = 0, .ascii = 0, .is_control = 
+# 177 "src/drivers/ps2.c" 3 4
+                                                                 1 
+# 177 "src/drivers/ps2.c"
+                                                                      },
+    { .scan_code = 170, .event_type = 1, .ascii = 0, .is_control = 
+# 178 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 178 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 54, .event_type = 0, .ascii = 0, .is_control = 
+# 179 "src/drivers/ps2.c" 3 4
+                                                                 1 
+# 179 "src/drivers/ps2.c"
+                                                                      },
+    { .scan_code = 182, .event_type = 1, .ascii = 0, .is_control = 
+# 180 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 180 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 29, .event_type = 0, .ascii = 0, .is_control = 
+# 181 "src/drivers/ps2.c" 3 4
+                                                                 1 
+# 181 "src/drivers/ps2.c"
+                                                                      },
+    { .scan_code = 157, .event_type = 1, .ascii = 0, .is_control = 
+# 182 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 182 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 56, .event_type = 0, .ascii = 0, .is_control = 
+# 183 "src/drivers/ps2.c" 3 4
+                                                                 1 
+# 183 "src/drivers/ps2.c"
+                                                                      },
+    { .scan_code = 184, .event_type = 1, .ascii = 0, .is_control = 
+# 184 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 184 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 15, .event_type = 0, .ascii = '\t', .is_control = 
+# 185 "src/drivers/ps2.c" 3 4
+                                                                    1 
+# 185 "src/drivers/ps2.c"
+                                                                         },
+    { .scan_code = 143, .event_type = 1, .ascii = 0, .is_control = 
+# 186 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 186 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 1, .event_type = 0, .ascii = 0, .is_control = 
+# 187 "src/drivers/ps2.c" 3 4
+                                                                1 
+# 187 "src/drivers/ps2.c"
+                                                                     },
+    { .scan_code = 129, .event_type = 1, .ascii = 0, .is_control = 
+# 188 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 188 "src/drivers/ps2.c"
+                                                                       },
+    { .scan_code = 58, .event_type = 0, .ascii = 0, .is_control = 
+# 189 "src/drivers/ps2.c" 3 4
+                                                                 1 
+# 189 "src/drivers/ps2.c"
+                                                                      },
+    { .scan_code = 186, .event_type = 1, .ascii = 0, .is_control = 
+# 190 "src/drivers/ps2.c" 3 4
+                                                                  1 
+# 190 "src/drivers/ps2.c"
+                                                                       },
+};
+
+
+KeyEvent_t* scancode_map[256] = {0};
+
+uint8_t ps2_read()
+{
+
+    while ((inb((uint16_t)0x64) & 1) == 0);
+
+    return inb(0x60);
+}
+
+
+
+
+
+uint8_t ps2_read_no_wait()
+{
+    return inb(0x60);
+}
+
+void ps2_write(uint16_t port, uint8_t value)
+{
+
+    while ((inb((uint16_t)0x64) & 2) != 0);
+
+    outb(port, value);
+}
+
+
+
+
+uint8_t ps2_read_config()
+{
+    ps2_write((uint16_t)0x64, (uint8_t)0x20);
+    return ps2_read();
+}
+
+
+
+
+void ps2_write_config(uint8_t value)
+{
+    ps2_write((uint16_t)0x64, (uint16_t)0x60);
+    ps2_write((uint16_t)0x60, value);
+}
+
+void ps2_init()
+{
+
+
+
+    ps2_write((uint16_t)0x64, (uint8_t)0xAD);
+    ps2_write((uint16_t)0x64, (uint8_t)0xA7);
+
+
+    ps2_read_no_wait();
+
+
+    uint8_t config = ps2_read_config();
+    config |= (1 << 0) | (1 << 6);
+
+
+    if ((config & (1 << 5)) != 0) {
+       config |= (1 << 1);
+    }
+
+
+    ps2_write_config(config);
+
+
+    ioapic_redirect_irq(bsp_lapic_id, 33, 1, 
+# 263 "src/drivers/ps2.c" 3 4
+                                                         1
+# 263 "src/drivers/ps2.c"
+                                                             );
+
+
+    ps2_write((uint16_t)0x64, 0xAE);
+
+
+    if ((config & (1 << 5)) != 0) {
+        ps2_write((uint16_t)0x64, 0xA8);
+    }
+
+
+    for (uint64_t i = 0; i < sizeof(key_map) / sizeof(KeyEvent_t); i++) {
+        KeyEvent_t *pKE = &key_map[i];
+        if (scancode_map[pKE->scan_code] != 
+# 276 "src/drivers/ps2.c" 3 4
+                                           ((void *)0)
+# 276 "src/drivers/ps2.c"
+                                               ) {
+            kprintf("Map Error: Scan code %d already registered.\n", pKE->scan_code);
+        }
+        scancode_map[pKE->scan_code] = pKE;
+    }
+
+    kprintf("PS2 initialized.\n");
+}
@@ -0,0 +1,4257 @@
+	.file	"ps2.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/drivers/ps2.c"
+	.p2align 4
+	.globl	ps2_read
+	.type	ps2_read, @function
+ps2_read:
+.LFB30:
+	.file 1 "src/drivers/ps2.c"
+	.loc 1 197 1 view -0
+	.cfi_startproc
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 199 38 discriminator 1 view .LVU1
+.LVL0:
+.LBB66:
+.LBI66:
+	.file 2 "src/include/cpu.h"
+	.loc 2 104 23 discriminator 1 view .LVU2
+.LBB67:
+	.loc 2 106 5 discriminator 1 view .LVU3
+	.loc 2 107 5 discriminator 1 view .LVU4
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL1:
+	.loc 2 111 5 discriminator 1 view .LVU5
+	.loc 2 111 5 is_stmt 0 discriminator 1 view .LVU6
+#NO_APP
+.LBE67:
+.LBE66:
+	.loc 1 199 38 discriminator 1 view .LVU7
+	testb	$1, %al
+	je	.L2
+	.loc 1 201 5 is_stmt 1 view .LVU8
+.LVL2:
+.LBB68:
+.LBI68:
+	.loc 2 104 23 view .LVU9
+.LBB69:
+	.loc 2 106 5 view .LVU10
+	.loc 2 107 5 view .LVU11
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $96, %al
+# 0 "" 2
+.LVL3:
+	.loc 2 111 5 view .LVU12
+	.loc 2 111 5 is_stmt 0 view .LVU13
+#NO_APP
+.LBE69:
+.LBE68:
+	.loc 1 202 1 view .LVU14
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	ps2_read, .-ps2_read
+	.p2align 4
+	.globl	ps2_read_no_wait
+	.type	ps2_read_no_wait, @function
+ps2_read_no_wait:
+.LFB31:
+	.loc 1 209 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 210 5 view .LVU16
+.LVL4:
+.LBB70:
+.LBI70:
+	.loc 2 104 23 view .LVU17
+.LBB71:
+	.loc 2 106 5 view .LVU18
+	.loc 2 107 5 view .LVU19
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $96, %al
+# 0 "" 2
+.LVL5:
+	.loc 2 111 5 view .LVU20
+	.loc 2 111 5 is_stmt 0 view .LVU21
+#NO_APP
+.LBE71:
+.LBE70:
+	.loc 1 211 1 view .LVU22
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	ps2_read_no_wait, .-ps2_read_no_wait
+	.p2align 4
+	.globl	ps2_write
+	.type	ps2_write, @function
+ps2_write:
+.LVL6:
+.LFB32:
+	.loc 1 214 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 214 1 is_stmt 0 view .LVU24
+	movl	%edi, %edx
+	.loc 1 216 5 is_stmt 1 view .LVU25
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 216 38 discriminator 1 view .LVU26
+.LVL7:
+.LBB72:
+.LBI72:
+	.loc 2 104 23 discriminator 1 view .LVU27
+.LBB73:
+	.loc 2 106 5 discriminator 1 view .LVU28
+	.loc 2 107 5 discriminator 1 view .LVU29
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL8:
+	.loc 2 111 5 discriminator 1 view .LVU30
+	.loc 2 111 5 is_stmt 0 discriminator 1 view .LVU31
+#NO_APP
+.LBE73:
+.LBE72:
+	.loc 1 216 38 discriminator 1 view .LVU32
+	testb	$2, %al
+	jne	.L8
+	.loc 1 218 5 is_stmt 1 view .LVU33
+.LVL9:
+.LBB74:
+.LBI74:
+	.loc 2 86 20 view .LVU34
+.LBB75:
+	.loc 2 88 5 view .LVU35
+	movl	%esi, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL10:
+	.loc 2 88 5 is_stmt 0 view .LVU36
+#NO_APP
+.LBE75:
+.LBE74:
+	.loc 1 219 1 view .LVU37
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	ps2_write, .-ps2_write
+	.p2align 4
+	.globl	ps2_read_config
+	.type	ps2_read_config, @function
+ps2_read_config:
+.LFB33:
+	.loc 1 225 1 is_stmt 1 view -0
+	.cfi_startproc
+	.p2align 4,,10
+	.p2align 3
+.L11:
+.LBB88:
+.LBB89:
+	.loc 1 216 38 view .LVU39
+.LVL11:
+.LBB90:
+.LBI90:
+	.loc 2 104 23 view .LVU40
+.LBB91:
+	.loc 2 106 5 view .LVU41
+	.loc 2 107 5 view .LVU42
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL12:
+	.loc 2 111 5 view .LVU43
+	.loc 2 111 5 is_stmt 0 view .LVU44
+#NO_APP
+.LBE91:
+.LBE90:
+	.loc 1 216 38 view .LVU45
+	testb	$2, %al
+	jne	.L11
+	.loc 1 218 5 is_stmt 1 view .LVU46
+.LVL13:
+.LBB92:
+.LBI92:
+	.loc 2 86 20 view .LVU47
+.LBB93:
+	.loc 2 88 5 view .LVU48
+	movl	$32, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+#NO_APP
+.L12:
+	.loc 2 88 5 is_stmt 0 view .LVU49
+.LBE93:
+.LBE92:
+.LBE89:
+.LBE88:
+.LBB94:
+.LBB95:
+	.loc 1 199 38 is_stmt 1 view .LVU50
+.LBB96:
+.LBI96:
+	.loc 2 104 23 view .LVU51
+.LBB97:
+	.loc 2 106 5 view .LVU52
+	.loc 2 107 5 view .LVU53
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL15:
+	.loc 2 111 5 view .LVU54
+	.loc 2 111 5 is_stmt 0 view .LVU55
+#NO_APP
+.LBE97:
+.LBE96:
+	.loc 1 199 38 view .LVU56
+	testb	$1, %al
+	je	.L12
+	.loc 1 201 5 is_stmt 1 view .LVU57
+.LVL16:
+.LBB98:
+.LBI98:
+	.loc 2 104 23 view .LVU58
+.LBB99:
+	.loc 2 106 5 view .LVU59
+	.loc 2 107 5 view .LVU60
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $96, %al
+# 0 "" 2
+.LVL17:
+	.loc 2 111 5 view .LVU61
+	.loc 2 111 5 is_stmt 0 view .LVU62
+#NO_APP
+.LBE99:
+.LBE98:
+.LBE95:
+.LBE94:
+	.loc 1 228 1 view .LVU63
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	ps2_read_config, .-ps2_read_config
+	.p2align 4
+	.globl	ps2_write_config
+	.type	ps2_write_config, @function
+ps2_write_config:
+.LFB34:
+	.loc 1 234 1 is_stmt 1 view -0
+	.cfi_startproc
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+.LBB112:
+.LBB113:
+	.loc 1 216 38 view .LVU65
+.LBB114:
+.LBI114:
+	.loc 2 104 23 view .LVU66
+.LBB115:
+	.loc 2 106 5 view .LVU67
+	.loc 2 107 5 view .LVU68
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL19:
+	.loc 2 111 5 view .LVU69
+	.loc 2 111 5 is_stmt 0 view .LVU70
+#NO_APP
+.LBE115:
+.LBE114:
+	.loc 1 216 38 view .LVU71
+	testb	$2, %al
+	jne	.L17
+	.loc 1 218 5 is_stmt 1 view .LVU72
+.LVL20:
+.LBB116:
+.LBI116:
+	.loc 2 86 20 view .LVU73
+.LBB117:
+	.loc 2 88 5 view .LVU74
+	movl	$96, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL21:
+	.loc 2 88 5 is_stmt 0 view .LVU75
+#NO_APP
+.LBE117:
+.LBE116:
+.LBE113:
+.LBE112:
+	.loc 1 236 5 is_stmt 1 view .LVU76
+.LBB118:
+.LBI118:
+	.loc 1 213 6 view .LVU77
+	.p2align 4,,10
+	.p2align 3
+.L18:
+.LBB119:
+	.loc 1 216 38 view .LVU78
+.LBB120:
+.LBI120:
+	.loc 2 104 23 view .LVU79
+.LBB121:
+	.loc 2 106 5 view .LVU80
+	.loc 2 107 5 view .LVU81
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL22:
+	.loc 2 111 5 view .LVU82
+	.loc 2 111 5 is_stmt 0 view .LVU83
+#NO_APP
+.LBE121:
+.LBE120:
+	.loc 1 216 38 view .LVU84
+	testb	$2, %al
+	jne	.L18
+	.loc 1 218 5 is_stmt 1 view .LVU85
+.LVL23:
+.LBB122:
+.LBI122:
+	.loc 2 86 20 view .LVU86
+.LBB123:
+	.loc 2 88 5 view .LVU87
+	movl	%edi, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $96
+# 0 "" 2
+.LVL24:
+	.loc 2 88 5 is_stmt 0 view .LVU88
+#NO_APP
+.LBE123:
+.LBE122:
+.LBE119:
+.LBE118:
+	.loc 1 237 1 view .LVU89
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	ps2_write_config, .-ps2_write_config
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Map Error: Scan code %d already registered.\n"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"PS2 initialized.\n"
+	.text
+	.p2align 4
+	.globl	ps2_init
+	.type	ps2_init, @function
+ps2_init:
+.LFB35:
+	.loc 1 240 1 is_stmt 1 view -0
+	.cfi_startproc
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.p2align 4,,10
+	.p2align 3
+.L22:
+.LBB181:
+.LBB182:
+	.loc 1 216 38 view .LVU91
+.LVL25:
+.LBB183:
+.LBI183:
+	.loc 2 104 23 view .LVU92
+.LBB184:
+	.loc 2 106 5 view .LVU93
+	.loc 2 107 5 view .LVU94
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL26:
+	.loc 2 111 5 view .LVU95
+	.loc 2 111 5 is_stmt 0 view .LVU96
+#NO_APP
+.LBE184:
+.LBE183:
+	.loc 1 216 38 view .LVU97
+	testb	$2, %al
+	jne	.L22
+	.loc 1 218 5 is_stmt 1 view .LVU98
+.LVL27:
+.LBB185:
+.LBI185:
+	.loc 2 86 20 view .LVU99
+.LBB186:
+	.loc 2 88 5 view .LVU100
+	movl	$-83, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+#NO_APP
+.L23:
+	.loc 2 88 5 is_stmt 0 view .LVU101
+.LBE186:
+.LBE185:
+.LBE182:
+.LBE181:
+.LBB187:
+.LBB188:
+	.loc 1 216 38 is_stmt 1 view .LVU102
+.LBB189:
+.LBI189:
+	.loc 2 104 23 view .LVU103
+.LBB190:
+	.loc 2 106 5 view .LVU104
+	.loc 2 107 5 view .LVU105
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL29:
+	.loc 2 111 5 view .LVU106
+	.loc 2 111 5 is_stmt 0 view .LVU107
+#NO_APP
+.LBE190:
+.LBE189:
+	.loc 1 216 38 view .LVU108
+	testb	$2, %al
+	jne	.L23
+	.loc 1 218 5 is_stmt 1 view .LVU109
+.LVL30:
+.LBB191:
+.LBI191:
+	.loc 2 86 20 view .LVU110
+.LBB192:
+	.loc 2 88 5 view .LVU111
+	movl	$-89, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL31:
+	.loc 2 88 5 is_stmt 0 view .LVU112
+#NO_APP
+.LBE192:
+.LBE191:
+.LBE188:
+.LBE187:
+	.loc 1 248 5 is_stmt 1 view .LVU113
+.LBB193:
+.LBI193:
+	.loc 1 208 9 view .LVU114
+	.loc 1 210 5 view .LVU115
+.LBB194:
+.LBI194:
+	.loc 2 104 23 view .LVU116
+.LBB195:
+	.loc 2 106 5 view .LVU117
+	.loc 2 107 5 view .LVU118
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $96, %al
+# 0 "" 2
+.LVL32:
+	.loc 2 111 5 view .LVU119
+	.loc 2 111 5 is_stmt 0 view .LVU120
+#NO_APP
+.LBE195:
+.LBE194:
+.LBE193:
+	.loc 1 251 5 is_stmt 1 view .LVU121
+.LBB196:
+.LBI196:
+	.loc 1 224 9 view .LVU122
+	.p2align 4,,10
+	.p2align 3
+.L24:
+.LBB197:
+.LBB198:
+	.loc 1 216 38 view .LVU123
+.LBB199:
+.LBI199:
+	.loc 2 104 23 view .LVU124
+.LBB200:
+	.loc 2 106 5 view .LVU125
+	.loc 2 107 5 view .LVU126
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL33:
+	.loc 2 111 5 view .LVU127
+	.loc 2 111 5 is_stmt 0 view .LVU128
+#NO_APP
+.LBE200:
+.LBE199:
+	.loc 1 216 38 view .LVU129
+	testb	$2, %al
+	jne	.L24
+	.loc 1 218 5 is_stmt 1 view .LVU130
+.LVL34:
+.LBB201:
+.LBI201:
+	.loc 2 86 20 view .LVU131
+.LBB202:
+	.loc 2 88 5 view .LVU132
+	movl	$32, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+#NO_APP
+.L25:
+	.loc 2 88 5 is_stmt 0 view .LVU133
+.LBE202:
+.LBE201:
+.LBE198:
+.LBE197:
+.LBB203:
+.LBB204:
+	.loc 1 199 38 is_stmt 1 view .LVU134
+.LBB205:
+.LBI205:
+	.loc 2 104 23 view .LVU135
+.LBB206:
+	.loc 2 106 5 view .LVU136
+	.loc 2 107 5 view .LVU137
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL36:
+	.loc 2 111 5 view .LVU138
+	.loc 2 111 5 is_stmt 0 view .LVU139
+#NO_APP
+.LBE206:
+.LBE205:
+	.loc 1 199 38 view .LVU140
+	testb	$1, %al
+	je	.L25
+	.loc 1 201 5 is_stmt 1 view .LVU141
+.LVL37:
+.LBB207:
+.LBI207:
+	.loc 2 104 23 view .LVU142
+.LBB208:
+	.loc 2 106 5 view .LVU143
+	.loc 2 107 5 view .LVU144
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $96, %al
+# 0 "" 2
+.LVL38:
+	.loc 2 111 5 view .LVU145
+	.loc 2 111 5 is_stmt 0 view .LVU146
+#NO_APP
+.LBE208:
+.LBE207:
+.LBE204:
+.LBE203:
+.LBE196:
+	.loc 1 252 5 is_stmt 1 view .LVU147
+	.loc 1 255 5 view .LVU148
+	.loc 1 252 12 is_stmt 0 view .LVU149
+	movl	%eax, %ecx
+	movl	%eax, %edx
+	orl	$65, %ecx
+	orl	$67, %edx
+	andl	$32, %eax
+.LVL39:
+	.loc 1 252 12 view .LVU150
+	cmove	%ecx, %edx
+.LVL40:
+	.loc 1 260 5 is_stmt 1 view .LVU151
+.LBB209:
+.LBI209:
+	.loc 1 233 6 view .LVU152
+.LBE209:
+	.loc 1 252 12 is_stmt 0 view .LVU153
+	movl	%eax, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L28:
+.LBB222:
+.LBB210:
+.LBB211:
+	.loc 1 216 38 is_stmt 1 view .LVU154
+.LVL41:
+.LBB212:
+.LBI212:
+	.loc 2 104 23 view .LVU155
+.LBB213:
+	.loc 2 106 5 view .LVU156
+	.loc 2 107 5 view .LVU157
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL42:
+	.loc 2 111 5 view .LVU158
+	.loc 2 111 5 is_stmt 0 view .LVU159
+#NO_APP
+.LBE213:
+.LBE212:
+	.loc 1 216 38 view .LVU160
+	testb	$2, %al
+	jne	.L28
+	.loc 1 218 5 is_stmt 1 view .LVU161
+.LVL43:
+.LBB214:
+.LBI214:
+	.loc 2 86 20 view .LVU162
+.LBB215:
+	.loc 2 88 5 view .LVU163
+	movl	$96, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL44:
+	.loc 2 88 5 is_stmt 0 view .LVU164
+#NO_APP
+.LBE215:
+.LBE214:
+.LBE211:
+.LBE210:
+	.loc 1 236 5 is_stmt 1 view .LVU165
+.LBB216:
+.LBI216:
+	.loc 1 213 6 view .LVU166
+	.p2align 4,,10
+	.p2align 3
+.L29:
+.LBB217:
+	.loc 1 216 38 view .LVU167
+.LBB218:
+.LBI218:
+	.loc 2 104 23 view .LVU168
+.LBB219:
+	.loc 2 106 5 view .LVU169
+	.loc 2 107 5 view .LVU170
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL45:
+	.loc 2 111 5 view .LVU171
+	.loc 2 111 5 is_stmt 0 view .LVU172
+#NO_APP
+.LBE219:
+.LBE218:
+	.loc 1 216 38 view .LVU173
+	testb	$2, %al
+	jne	.L29
+	.loc 1 218 5 is_stmt 1 view .LVU174
+.LVL46:
+.LBB220:
+.LBI220:
+	.loc 2 86 20 view .LVU175
+.LBB221:
+	.loc 2 88 5 view .LVU176
+	movl	%edx, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $96
+# 0 "" 2
+.LVL47:
+	.loc 2 88 5 is_stmt 0 view .LVU177
+#NO_APP
+.LBE221:
+.LBE220:
+.LBE217:
+.LBE216:
+.LBE222:
+	.loc 1 263 5 is_stmt 1 view .LVU178
+	movl	bsp_lapic_id(%rip), %edi
+	movl	$1, %ecx
+	movl	$1, %edx
+.LVL48:
+	.loc 1 263 5 is_stmt 0 view .LVU179
+	movl	$33, %esi
+	call	ioapic_redirect_irq@PLT
+.LVL49:
+	.loc 1 266 5 is_stmt 1 view .LVU180
+.LBB223:
+.LBI223:
+	.loc 1 213 6 view .LVU181
+.LBB224:
+	.loc 1 216 5 view .LVU182
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.loc 1 216 38 view .LVU183
+.LBB225:
+.LBI225:
+	.loc 2 104 23 view .LVU184
+.LBB226:
+	.loc 2 106 5 view .LVU185
+	.loc 2 107 5 view .LVU186
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL50:
+	.loc 2 111 5 view .LVU187
+	.loc 2 111 5 is_stmt 0 view .LVU188
+#NO_APP
+.LBE226:
+.LBE225:
+	.loc 1 216 38 view .LVU189
+	testb	$2, %al
+	jne	.L30
+	.loc 1 218 5 is_stmt 1 view .LVU190
+.LVL51:
+.LBB227:
+.LBI227:
+	.loc 2 86 20 view .LVU191
+.LBB228:
+	.loc 2 88 5 view .LVU192
+	movl	$-82, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL52:
+	.loc 2 88 5 is_stmt 0 view .LVU193
+#NO_APP
+.LBE228:
+.LBE227:
+.LBE224:
+.LBE223:
+	.loc 1 269 5 is_stmt 1 view .LVU194
+	.loc 1 269 8 is_stmt 0 view .LVU195
+	testb	%bl, %bl
+	jne	.L32
+.L31:
+	leaq	key_map(%rip), %rbx
+	leaq	scancode_map(%rip), %rbp
+	leaq	580(%rbx), %r12
+.LBB229:
+.LBB230:
+	.loc 1 277 13 view .LVU196
+	leaq	.LC0(%rip), %r13
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 275 9 is_stmt 1 view .LVU197
+.LVL53:
+	.loc 1 276 9 view .LVU198
+	.loc 1 276 29 is_stmt 0 view .LVU199
+	movzbl	(%rbx), %eax
+	.loc 1 276 12 view .LVU200
+	cmpq	$0, 0(%rbp,%rax,8)
+	.loc 1 276 29 view .LVU201
+	movq	%rax, %rsi
+	.loc 1 276 12 view .LVU202
+	je	.L33
+	.loc 1 277 13 is_stmt 1 view .LVU203
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	call	kprintf@PLT
+.LVL54:
+	movzbl	(%rbx), %eax
+.L33:
+	.loc 1 279 9 discriminator 2 view .LVU204
+	.loc 1 279 38 is_stmt 0 discriminator 2 view .LVU205
+	movq	%rbx, 0(%rbp,%rax,8)
+.LBE230:
+	.loc 1 274 69 is_stmt 1 discriminator 2 view .LVU206
+	.loc 1 274 28 discriminator 2 view .LVU207
+	addq	$4, %rbx
+.LVL55:
+	.loc 1 274 28 is_stmt 0 discriminator 2 view .LVU208
+	cmpq	%rbx, %r12
+	jne	.L34
+	.loc 1 274 28 discriminator 2 view .LVU209
+.LBE229:
+	.loc 1 282 5 is_stmt 1 view .LVU210
+	.loc 1 283 1 is_stmt 0 view .LVU211
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 282 5 view .LVU212
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+.LVL56:
+	.loc 1 283 1 view .LVU213
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL57:
+	.loc 1 283 1 view .LVU214
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	.loc 1 282 5 view .LVU215
+	jmp	kprintf@PLT
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.cfi_restore_state
+.LBB231:
+.LBB232:
+	.loc 1 216 38 is_stmt 1 view .LVU216
+.LBB233:
+.LBI233:
+	.loc 2 104 23 view .LVU217
+.LBB234:
+	.loc 2 106 5 view .LVU218
+	.loc 2 107 5 view .LVU219
+#APP
+# 107 "src/include/cpu.h" 1
+	inb $100, %al
+# 0 "" 2
+.LVL59:
+	.loc 2 111 5 view .LVU220
+	.loc 2 111 5 is_stmt 0 view .LVU221
+#NO_APP
+.LBE234:
+.LBE233:
+	.loc 1 216 38 view .LVU222
+	testb	$2, %al
+	jne	.L32
+	.loc 1 218 5 is_stmt 1 view .LVU223
+.LVL60:
+.LBB235:
+.LBI235:
+	.loc 2 86 20 view .LVU224
+.LBB236:
+	.loc 2 88 5 view .LVU225
+	movl	$-88, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $100
+# 0 "" 2
+.LVL61:
+	.loc 2 88 5 is_stmt 0 view .LVU226
+#NO_APP
+.LBE236:
+.LBE235:
+.LBE232:
+.LBE231:
+.LBB237:
+	.loc 1 274 28 is_stmt 1 view .LVU227
+	jmp	.L31
+.LBE237:
+	.cfi_endproc
+.LFE35:
+	.size	ps2_init, .-ps2_init
+	.globl	scancode_map
+	.bss
+	.align 32
+	.type	scancode_map, @object
+	.size	scancode_map, 2048
+scancode_map:
+	.zero	2048
+	.globl	key_map
+	.data
+	.align 32
+	.type	key_map, @object
+	.size	key_map, 580
+key_map:
+	.byte	2
+	.byte	0
+	.byte	49
+	.zero	1
+	.byte	-126
+	.byte	1
+	.byte	49
+	.zero	1
+	.byte	3
+	.byte	0
+	.byte	50
+	.zero	1
+	.byte	-125
+	.byte	1
+	.byte	50
+	.zero	1
+	.byte	4
+	.byte	0
+	.byte	51
+	.zero	1
+	.byte	-124
+	.byte	1
+	.byte	51
+	.zero	1
+	.byte	5
+	.byte	0
+	.byte	52
+	.zero	1
+	.byte	-123
+	.byte	1
+	.byte	52
+	.zero	1
+	.byte	6
+	.byte	0
+	.byte	53
+	.zero	1
+	.byte	-122
+	.byte	1
+	.byte	53
+	.zero	1
+	.byte	7
+	.byte	0
+	.byte	54
+	.zero	1
+	.byte	-121
+	.byte	1
+	.byte	54
+	.zero	1
+	.byte	8
+	.byte	0
+	.byte	55
+	.zero	1
+	.byte	-120
+	.byte	1
+	.byte	55
+	.zero	1
+	.byte	9
+	.byte	0
+	.byte	56
+	.zero	1
+	.byte	-119
+	.byte	1
+	.byte	56
+	.zero	1
+	.byte	10
+	.byte	0
+	.byte	57
+	.zero	1
+	.byte	-118
+	.byte	1
+	.byte	57
+	.zero	1
+	.byte	11
+	.byte	0
+	.byte	48
+	.zero	1
+	.byte	-117
+	.byte	1
+	.byte	48
+	.zero	1
+	.byte	12
+	.byte	0
+	.byte	45
+	.zero	1
+	.byte	-116
+	.byte	1
+	.byte	45
+	.zero	1
+	.byte	13
+	.byte	0
+	.byte	61
+	.zero	1
+	.byte	-115
+	.byte	1
+	.byte	61
+	.zero	1
+	.byte	16
+	.byte	0
+	.byte	113
+	.zero	1
+	.byte	-112
+	.byte	1
+	.byte	113
+	.zero	1
+	.byte	17
+	.byte	0
+	.byte	119
+	.zero	1
+	.byte	-111
+	.byte	1
+	.byte	119
+	.zero	1
+	.byte	18
+	.byte	0
+	.byte	101
+	.zero	1
+	.byte	-110
+	.byte	1
+	.byte	101
+	.zero	1
+	.byte	19
+	.byte	0
+	.byte	114
+	.zero	1
+	.byte	-109
+	.byte	1
+	.byte	114
+	.zero	1
+	.byte	20
+	.byte	0
+	.byte	116
+	.zero	1
+	.byte	-108
+	.byte	1
+	.byte	116
+	.zero	1
+	.byte	21
+	.byte	0
+	.byte	121
+	.zero	1
+	.byte	-107
+	.byte	1
+	.byte	121
+	.zero	1
+	.byte	22
+	.byte	0
+	.byte	117
+	.zero	1
+	.byte	-106
+	.byte	1
+	.byte	117
+	.zero	1
+	.byte	23
+	.byte	0
+	.byte	105
+	.zero	1
+	.byte	-105
+	.byte	1
+	.byte	105
+	.zero	1
+	.byte	24
+	.byte	0
+	.byte	111
+	.zero	1
+	.byte	-104
+	.byte	1
+	.byte	111
+	.zero	1
+	.byte	25
+	.byte	0
+	.byte	112
+	.zero	1
+	.byte	-103
+	.byte	1
+	.byte	112
+	.zero	1
+	.byte	26
+	.byte	0
+	.byte	91
+	.zero	1
+	.byte	-102
+	.byte	1
+	.byte	91
+	.zero	1
+	.byte	27
+	.byte	0
+	.byte	93
+	.zero	1
+	.byte	-101
+	.byte	1
+	.byte	93
+	.zero	1
+	.byte	30
+	.byte	0
+	.byte	97
+	.zero	1
+	.byte	-98
+	.byte	1
+	.byte	97
+	.zero	1
+	.byte	31
+	.byte	0
+	.byte	115
+	.zero	1
+	.byte	-97
+	.byte	1
+	.byte	115
+	.zero	1
+	.byte	32
+	.byte	0
+	.byte	100
+	.zero	1
+	.byte	-96
+	.byte	1
+	.byte	100
+	.zero	1
+	.byte	33
+	.byte	0
+	.byte	102
+	.zero	1
+	.byte	-95
+	.byte	1
+	.byte	102
+	.zero	1
+	.byte	34
+	.byte	0
+	.byte	103
+	.zero	1
+	.byte	-94
+	.byte	1
+	.byte	103
+	.zero	1
+	.byte	35
+	.byte	0
+	.byte	104
+	.zero	1
+	.byte	-93
+	.byte	1
+	.byte	104
+	.zero	1
+	.byte	36
+	.byte	0
+	.byte	106
+	.zero	1
+	.byte	-92
+	.byte	1
+	.byte	106
+	.zero	1
+	.byte	37
+	.byte	0
+	.byte	107
+	.zero	1
+	.byte	-91
+	.byte	1
+	.byte	107
+	.zero	1
+	.byte	38
+	.byte	0
+	.byte	108
+	.zero	1
+	.byte	-90
+	.byte	1
+	.byte	108
+	.zero	1
+	.byte	39
+	.byte	0
+	.byte	59
+	.zero	1
+	.byte	-89
+	.byte	1
+	.byte	59
+	.zero	1
+	.byte	40
+	.byte	0
+	.byte	39
+	.zero	1
+	.byte	-88
+	.byte	1
+	.byte	39
+	.zero	1
+	.byte	43
+	.byte	0
+	.byte	35
+	.zero	1
+	.byte	-85
+	.byte	1
+	.byte	35
+	.zero	1
+	.byte	57
+	.byte	0
+	.byte	32
+	.zero	1
+	.byte	-71
+	.byte	1
+	.byte	32
+	.zero	1
+	.byte	53
+	.byte	0
+	.byte	47
+	.zero	1
+	.byte	-75
+	.byte	1
+	.byte	47
+	.zero	1
+	.byte	41
+	.byte	0
+	.byte	96
+	.zero	1
+	.byte	-87
+	.byte	1
+	.byte	96
+	.zero	1
+	.byte	44
+	.byte	0
+	.byte	122
+	.zero	1
+	.byte	-84
+	.byte	1
+	.byte	122
+	.zero	1
+	.byte	45
+	.byte	0
+	.byte	120
+	.zero	1
+	.byte	-83
+	.byte	1
+	.byte	120
+	.zero	1
+	.byte	46
+	.byte	0
+	.byte	99
+	.zero	1
+	.byte	-82
+	.byte	1
+	.byte	99
+	.zero	1
+	.byte	47
+	.byte	0
+	.byte	118
+	.zero	1
+	.byte	-81
+	.byte	1
+	.byte	118
+	.zero	1
+	.byte	48
+	.byte	0
+	.byte	98
+	.zero	1
+	.byte	-80
+	.byte	1
+	.byte	98
+	.zero	1
+	.byte	49
+	.byte	0
+	.byte	110
+	.zero	1
+	.byte	-79
+	.byte	1
+	.byte	110
+	.zero	1
+	.byte	50
+	.byte	0
+	.byte	109
+	.zero	1
+	.byte	-78
+	.byte	1
+	.byte	109
+	.zero	1
+	.byte	51
+	.byte	0
+	.byte	44
+	.zero	1
+	.byte	-77
+	.byte	1
+	.byte	44
+	.zero	1
+	.byte	52
+	.byte	0
+	.byte	46
+	.zero	1
+	.byte	-76
+	.byte	1
+	.byte	46
+	.zero	1
+	.byte	71
+	.byte	0
+	.byte	55
+	.zero	1
+	.byte	-57
+	.byte	1
+	.byte	55
+	.zero	1
+	.byte	72
+	.byte	0
+	.byte	56
+	.zero	1
+	.byte	-56
+	.byte	1
+	.byte	56
+	.zero	1
+	.byte	73
+	.byte	0
+	.byte	57
+	.zero	1
+	.byte	-55
+	.byte	1
+	.byte	57
+	.zero	1
+	.byte	75
+	.byte	0
+	.byte	52
+	.zero	1
+	.byte	-53
+	.byte	1
+	.byte	52
+	.zero	1
+	.byte	76
+	.byte	0
+	.byte	53
+	.zero	1
+	.byte	-52
+	.byte	1
+	.byte	53
+	.zero	1
+	.byte	77
+	.byte	0
+	.byte	54
+	.zero	1
+	.byte	-51
+	.byte	1
+	.byte	54
+	.zero	1
+	.byte	79
+	.byte	0
+	.byte	49
+	.zero	1
+	.byte	-49
+	.byte	1
+	.byte	49
+	.zero	1
+	.byte	80
+	.byte	0
+	.byte	50
+	.zero	1
+	.byte	-48
+	.byte	1
+	.byte	50
+	.zero	1
+	.byte	81
+	.byte	0
+	.byte	51
+	.zero	1
+	.byte	-47
+	.byte	1
+	.byte	51
+	.zero	1
+	.byte	82
+	.byte	0
+	.byte	48
+	.zero	1
+	.byte	-46
+	.byte	1
+	.byte	48
+	.zero	1
+	.byte	83
+	.byte	0
+	.byte	46
+	.zero	1
+	.byte	-45
+	.byte	1
+	.byte	46
+	.zero	1
+	.byte	-32
+	.byte	1
+	.byte	47
+	.zero	1
+	.byte	55
+	.byte	0
+	.byte	42
+	.zero	1
+	.byte	-73
+	.byte	1
+	.byte	42
+	.zero	1
+	.byte	74
+	.byte	0
+	.byte	45
+	.zero	1
+	.byte	-54
+	.byte	1
+	.byte	45
+	.zero	1
+	.byte	78
+	.byte	0
+	.byte	43
+	.zero	1
+	.byte	-50
+	.byte	1
+	.byte	43
+	.zero	1
+	.byte	69
+	.byte	0
+	.byte	0
+	.zero	1
+	.byte	-59
+	.byte	1
+	.byte	0
+	.zero	1
+	.byte	28
+	.byte	0
+	.byte	10
+	.byte	1
+	.byte	-100
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	14
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-114
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	42
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-86
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	54
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-74
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	29
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-99
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	56
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-72
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	15
+	.byte	0
+	.byte	9
+	.byte	1
+	.byte	-113
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	1
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-127
+	.byte	1
+	.byte	0
+	.byte	1
+	.byte	58
+	.byte	0
+	.byte	0
+	.byte	1
+	.byte	-70
+	.byte	1
+	.byte	0
+	.byte	1
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "src/include/ps2.h"
+	.file 5 "src/include/str.h"
+	.file 6 "src/include/ioapic.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xd18
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF35
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL69
+	.quad	0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x8
+	.long	.LASF6
+	.byte	0x3
+	.byte	0x2e
+	.byte	0x17
+	.long	0x52
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x8
+	.long	.LASF7
+	.byte	0x3
+	.byte	0x31
+	.byte	0x1c
+	.long	0x65
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x8
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x34
+	.byte	0x16
+	.long	0x78
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x8
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x37
+	.byte	0x1b
+	.long	0x8b
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x19
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x10
+	.long	0xd0
+	.uleb128 0xc
+	.long	.LASF13
+	.byte	0x1e
+	.byte	0xd
+	.long	0x46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF14
+	.byte	0x1f
+	.byte	0xd
+	.long	0x46
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF15
+	.byte	0x20
+	.byte	0xa
+	.long	0xd0
+	.byte	0x2
+	.uleb128 0xc
+	.long	.LASF16
+	.byte	0x21
+	.byte	0x9
+	.long	0xdc
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF17
+	.uleb128 0x1a
+	.long	0xd0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF18
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x22
+	.byte	0x3
+	.long	0x92
+	.uleb128 0xe
+	.long	0xfa
+	.long	0xfa
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x10
+	.long	0xe3
+	.uleb128 0x11
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x24
+	.byte	0x14
+	.long	0xef
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF20
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF21
+	.uleb128 0x11
+	.long	.LASF23
+	.byte	0x2
+	.byte	0x3a
+	.byte	0x11
+	.long	0x6c
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x135
+	.uleb128 0x12
+	.long	0x8b
+	.byte	0x90
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF24
+	.byte	0x1
+	.byte	0x20
+	.byte	0xc
+	.long	0x125
+	.uleb128 0x9
+	.byte	0x3
+	.quad	key_map
+	.uleb128 0xe
+	.long	0xfa
+	.long	0x15b
+	.uleb128 0x12
+	.long	0x8b
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1d
+	.long	0xff
+	.byte	0x1
+	.byte	0xc2
+	.byte	0xd
+	.long	0x14b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	scancode_map
+	.uleb128 0x13
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x30
+	.long	0x183
+	.uleb128 0x9
+	.long	0x183
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x10
+	.long	0xd7
+	.uleb128 0x13
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x21
+	.long	0x1a8
+	.uleb128 0x9
+	.long	0x6c
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x9
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF37
+	.byte	0x1
+	.byte	0xef
+	.byte	0x6
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82d
+	.uleb128 0x20
+	.long	.LASF27
+	.byte	0x1
+	.byte	0xfb
+	.byte	0xd
+	.long	0x46
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x21
+	.long	.LLRL63
+	.long	0x22b
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x1
+	.value	0x112
+	.byte	0x13
+	.long	0x7f
+	.byte	0
+	.uleb128 0x23
+	.quad	.LBB230
+	.quad	.LBE230-.LBB230
+	.uleb128 0x24
+	.string	"pKE"
+	.byte	0x1
+	.value	0x113
+	.byte	0x15
+	.long	0xfa
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x25
+	.quad	.LVL54
+	.long	0x171
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x84e
+	.quad	.LBB181
+	.quad	.LBE181-.LBB181
+	.byte	0xf4
+	.long	0x2ca
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI183
+	.byte	.LVU92
+	.quad	.LBB183
+	.quad	.LBE183-.LBB183
+	.byte	0xd8
+	.byte	0xd
+	.long	0x28e
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI185
+	.byte	.LVU99
+	.quad	.LBB185
+	.quad	.LBE185-.LBB185
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x84e
+	.quad	.LBB187
+	.quad	.LBE187-.LBB187
+	.byte	0xf5
+	.long	0x369
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI189
+	.byte	.LVU103
+	.quad	.LBB189
+	.quad	.LBE189-.LBB189
+	.byte	0xd8
+	.byte	0xd
+	.long	0x32d
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI191
+	.byte	.LVU110
+	.quad	.LBB191
+	.quad	.LBE191-.LBB191
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x871
+	.quad	.LBI193
+	.byte	.LVU114
+	.quad	.LBB193
+	.quad	.LBE193-.LBB193
+	.byte	0xf8
+	.byte	0x5
+	.long	0x3c1
+	.uleb128 0x3
+	.long	0x885
+	.quad	.LBI194
+	.byte	.LVU116
+	.quad	.LBB194
+	.quad	.LBE194-.LBB194
+	.byte	0xd2
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x26
+	.long	0x8a2
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x844
+	.quad	.LBI196
+	.byte	.LVU122
+	.quad	.LBB196
+	.quad	.LBE196-.LBB196
+	.byte	0xfb
+	.byte	0x16
+	.long	0x516
+	.uleb128 0x7
+	.long	0x84e
+	.quad	.LBB197
+	.quad	.LBE197-.LBB197
+	.byte	0xe2
+	.long	0x484
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI199
+	.byte	.LVU124
+	.quad	.LBB199
+	.quad	.LBE199-.LBB199
+	.byte	0xd8
+	.byte	0xd
+	.long	0x448
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI201
+	.byte	.LVU131
+	.quad	.LBB201
+	.quad	.LBE201-.LBB201
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x87b
+	.quad	.LBB203
+	.quad	.LBE203-.LBB203
+	.byte	0xe3
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI205
+	.byte	.LVU135
+	.quad	.LBB205
+	.quad	.LBE205-.LBB205
+	.byte	0xc7
+	.byte	0xd
+	.long	0x4d9
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x3
+	.long	0x885
+	.quad	.LBI207
+	.byte	.LVU142
+	.quad	.LBB207
+	.quad	.LBE207-.LBB207
+	.byte	0xc9
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	0x82d
+	.quad	.LBI209
+	.byte	.LVU152
+	.long	.LLRL45
+	.byte	0x1
+	.value	0x104
+	.byte	0x5
+	.long	0x692
+	.uleb128 0x1
+	.long	0x837
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x7
+	.long	0x84e
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.byte	0xeb
+	.long	0x5dc
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI212
+	.byte	.LVU155
+	.quad	.LBB212
+	.quad	.LBE212-.LBB212
+	.byte	0xd8
+	.byte	0xd
+	.long	0x5a0
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI214
+	.byte	.LVU162
+	.quad	.LBB214
+	.quad	.LBE214-.LBB214
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x84e
+	.quad	.LBI216
+	.byte	.LVU166
+	.quad	.LBB216
+	.quad	.LBE216-.LBB216
+	.byte	0xec
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x864
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x1
+	.long	0x858
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI218
+	.byte	.LVU168
+	.quad	.LBB218
+	.quad	.LBE218-.LBB218
+	.byte	0xd8
+	.byte	0xd
+	.long	0x655
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI220
+	.byte	.LVU175
+	.quad	.LBB220
+	.quad	.LBE220-.LBB220
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x84e
+	.quad	.LBI223
+	.byte	.LVU181
+	.quad	.LBB223
+	.quad	.LBE223-.LBB223
+	.byte	0x1
+	.value	0x10a
+	.byte	0x5
+	.long	0x74d
+	.uleb128 0x1
+	.long	0x864
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1
+	.long	0x858
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI225
+	.byte	.LVU184
+	.quad	.LBB225
+	.quad	.LBE225-.LBB225
+	.byte	0xd8
+	.byte	0xd
+	.long	0x711
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI227
+	.byte	.LVU191
+	.quad	.LBB227
+	.quad	.LBE227-.LBB227
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	0x84e
+	.quad	.LBB231
+	.quad	.LBE231-.LBB231
+	.byte	0x1
+	.value	0x10e
+	.byte	0x9
+	.long	0x7ef
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI233
+	.byte	.LVU217
+	.quad	.LBB233
+	.quad	.LBE233-.LBB233
+	.byte	0xd8
+	.byte	0xd
+	.long	0x7b3
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI235
+	.byte	.LVU224
+	.quad	.LBB235
+	.quad	.LBE235-.LBB235
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.quad	.LVL49
+	.long	0x188
+	.long	0x811
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x21
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL58
+	.long	0x171
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF28
+	.byte	0xe9
+	.long	0x844
+	.uleb128 0xb
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xe9
+	.byte	0x1f
+	.long	0x46
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF32
+	.byte	0xe0
+	.long	0x46
+	.uleb128 0x15
+	.long	.LASF29
+	.byte	0xd5
+	.long	0x871
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0x1
+	.byte	0xd5
+	.byte	0x19
+	.long	0x59
+	.uleb128 0xb
+	.long	.LASF30
+	.byte	0x1
+	.byte	0xd5
+	.byte	0x27
+	.long	0x46
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF33
+	.byte	0xd0
+	.long	0x46
+	.uleb128 0xf
+	.long	.LASF34
+	.byte	0xc4
+	.long	0x46
+	.uleb128 0x2c
+	.string	"inb"
+	.byte	0x2
+	.byte	0x68
+	.byte	0x17
+	.long	0x46
+	.byte	0x3
+	.long	0x8af
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x68
+	.byte	0x24
+	.long	0x59
+	.uleb128 0x2d
+	.string	"ret"
+	.byte	0x2
+	.byte	0x6a
+	.byte	0xd
+	.long	0x46
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF38
+	.byte	0x2
+	.byte	0x56
+	.byte	0x14
+	.byte	0x3
+	.long	0x8d5
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x56
+	.byte	0x22
+	.long	0x59
+	.uleb128 0x2f
+	.string	"val"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x30
+	.long	0x46
+	.byte	0
+	.uleb128 0xd
+	.long	0x87b
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x96b
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI66
+	.byte	.LVU2
+	.quad	.LBB66
+	.quad	.LBE66-.LBB66
+	.byte	0xc7
+	.byte	0xd
+	.long	0x92f
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x3
+	.long	0x885
+	.quad	.LBI68
+	.byte	.LVU9
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0xc9
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x871
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9c2
+	.uleb128 0x3
+	.long	0x885
+	.quad	.LBI70
+	.byte	.LVU17
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0xd2
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x84e
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa66
+	.uleb128 0x16
+	.long	0x858
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x16
+	.long	0x864
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI72
+	.byte	.LVU27
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.byte	0xd8
+	.byte	0xd
+	.long	0xa2a
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI74
+	.byte	.LVU34
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x844
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbb2
+	.uleb128 0x7
+	.long	0x84e
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.byte	0xe2
+	.long	0xb20
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI90
+	.byte	.LVU40
+	.quad	.LBB90
+	.quad	.LBE90-.LBB90
+	.byte	0xd8
+	.byte	0xd
+	.long	0xae4
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI92
+	.byte	.LVU47
+	.quad	.LBB92
+	.quad	.LBE92-.LBB92
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x87b
+	.quad	.LBB94
+	.quad	.LBE94-.LBB94
+	.byte	0xe3
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI96
+	.byte	.LVU51
+	.quad	.LBB96
+	.quad	.LBE96-.LBB96
+	.byte	0xc7
+	.byte	0xd
+	.long	0xb75
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x3
+	.long	0x885
+	.quad	.LBI98
+	.byte	.LVU58
+	.quad	.LBB98
+	.quad	.LBE98-.LBB98
+	.byte	0xc9
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	0x82d
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0x837
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x7
+	.long	0x84e
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.byte	0xeb
+	.long	0xc75
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x4
+	.long	0x858
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI114
+	.byte	.LVU66
+	.quad	.LBB114
+	.quad	.LBE114-.LBB114
+	.byte	0xd8
+	.byte	0xd
+	.long	0xc39
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI116
+	.byte	.LVU73
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x8c8
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x84e
+	.quad	.LBI118
+	.byte	.LVU77
+	.quad	.LBB118
+	.quad	.LBE118-.LBB118
+	.byte	0xec
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x864
+	.uleb128 0x1
+	.long	0x858
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x5
+	.long	0x885
+	.quad	.LBI120
+	.byte	.LVU79
+	.quad	.LBB120
+	.quad	.LBE120-.LBB120
+	.byte	0xd8
+	.byte	0xd
+	.long	0xce6
+	.uleb128 0x1
+	.long	0x896
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x2
+	.long	0x8a2
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x3
+	.long	0x8af
+	.quad	.LBI122
+	.byte	.LVU86
+	.quad	.LBB122
+	.quad	.LBE122-.LBB122
+	.byte	0xda
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x8c8
+	.uleb128 0x1
+	.long	0x8bc
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 12
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS27:
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU180
+.LLST27:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL38-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL39-.LVL38
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x41
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL38
+	.uleb128 .LVL48-.LVL38
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.LVL38
+	.uleb128 .LVL49-1-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU198
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+.LLST64:
+	.byte	0x6
+	.quad	.LVL53
+	.byte	0x4
+	.uleb128 .LVL53-.LVL53
+	.uleb128 .LVL55-.LVL53
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL55-.LVL53
+	.uleb128 .LVL56-.LVL53
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL56-.LVL53
+	.uleb128 .LVL57-.LVL53
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU92
+	.uleb128 .LVU96
+.LLST28:
+	.byte	0x8
+	.quad	.LVL25
+	.uleb128 .LVL26-.LVL25
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+.LLST29:
+	.byte	0x8
+	.quad	.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST30:
+	.byte	0x8
+	.quad	.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xad
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST31:
+	.byte	0x8
+	.quad	.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+.LLST32:
+	.byte	0x8
+	.quad	.LVL28
+	.uleb128 .LVL29-.LVL28
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+.LLST33:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL29-.LVL29
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+.LLST34:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xa7
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+.LLST35:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU116
+	.uleb128 .LVU120
+.LLST36:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL32-.LVL31
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU124
+	.uleb128 .LVU128
+.LLST37:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-.LVL32
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU127
+	.uleb128 .LVU128
+.LLST38:
+	.byte	0x8
+	.quad	.LVL33
+	.uleb128 .LVL33-.LVL33
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+.LLST39:
+	.byte	0x8
+	.quad	.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+.LLST40:
+	.byte	0x8
+	.quad	.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU135
+	.uleb128 .LVU139
+.LLST41:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL36-.LVL35
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU138
+	.uleb128 .LVU139
+.LLST42:
+	.byte	0x8
+	.quad	.LVL36
+	.uleb128 .LVL36-.LVL36
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU142
+	.uleb128 .LVU146
+.LLST43:
+	.byte	0x8
+	.quad	.LVL37
+	.uleb128 .LVL38-.LVL37
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+.LLST44:
+	.byte	0x8
+	.quad	.LVL38
+	.uleb128 .LVL38-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU152
+	.uleb128 .LVU177
+.LLST46:
+	.byte	0x8
+	.quad	.LVL40
+	.uleb128 .LVL47-.LVL40
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU155
+	.uleb128 .LVU159
+.LLST47:
+	.byte	0x8
+	.quad	.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU158
+	.uleb128 .LVU159
+.LLST48:
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL42-.LVL42
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU162
+	.uleb128 .LVU164
+.LLST49:
+	.byte	0x8
+	.quad	.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU162
+	.uleb128 .LVU164
+.LLST50:
+	.byte	0x8
+	.quad	.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU166
+	.uleb128 .LVU177
+.LLST51:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL47-.LVL44
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU166
+	.uleb128 .LVU177
+.LLST52:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL47-.LVL44
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU168
+	.uleb128 .LVU172
+.LLST53:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL45-.LVL44
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+.LLST54:
+	.byte	0x8
+	.quad	.LVL45
+	.uleb128 .LVL45-.LVL45
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+.LLST55:
+	.byte	0x8
+	.quad	.LVL46
+	.uleb128 .LVL47-.LVL46
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+.LLST56:
+	.byte	0x8
+	.quad	.LVL46
+	.uleb128 .LVL47-.LVL46
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU181
+	.uleb128 .LVU193
+.LLST57:
+	.byte	0x8
+	.quad	.LVL49
+	.uleb128 .LVL52-.LVL49
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xae
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU181
+	.uleb128 .LVU193
+.LLST58:
+	.byte	0x8
+	.quad	.LVL49
+	.uleb128 .LVL52-.LVL49
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU184
+	.uleb128 .LVU188
+.LLST59:
+	.byte	0x8
+	.quad	.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU187
+	.uleb128 .LVU188
+.LLST60:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LVL50-.LVL50
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST61:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xae
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+.LLST62:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU217
+	.uleb128 .LVU221
+.LLST65:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL59-.LVL58
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU220
+	.uleb128 .LVU221
+.LLST66:
+	.byte	0x8
+	.quad	.LVL59
+	.uleb128 .LVL59-.LVL59
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU224
+	.uleb128 .LVU226
+.LLST67:
+	.byte	0x8
+	.quad	.LVL60
+	.uleb128 .LVL61-.LVL60
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xa8
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU224
+	.uleb128 .LVU226
+.LLST68:
+	.byte	0x8
+	.quad	.LVL60
+	.uleb128 .LVL61-.LVL60
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU2
+	.uleb128 .LVU6
+.LLST0:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU5
+	.uleb128 .LVU6
+.LLST1:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL1-.LVL1
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU9
+	.uleb128 .LVU13
+.LLST2:
+	.byte	0x8
+	.quad	.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+.LLST3:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU17
+	.uleb128 .LVU21
+.LLST4:
+	.byte	0x8
+	.quad	.LVL4
+	.uleb128 .LVL5-.LVL4
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU20
+	.uleb128 .LVU21
+.LLST5:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL5-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU27
+	.uleb128 .LVU31
+.LLST6:
+	.byte	0x8
+	.quad	.LVL7
+	.uleb128 .LVL8-.LVL7
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU30
+	.uleb128 .LVU31
+.LLST7:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL8-.LVL8
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU34
+	.uleb128 .LVU36
+.LLST8:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LVL10-.LVL9
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU34
+	.uleb128 .LVU36
+.LLST9:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LVL10-.LVL9
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU40
+	.uleb128 .LVU44
+.LLST10:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU43
+	.uleb128 .LVU44
+.LLST11:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL12-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+.LLST12:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+.LLST13:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU51
+	.uleb128 .LVU55
+.LLST14:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU54
+	.uleb128 .LVU55
+.LLST15:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL15-.LVL15
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU58
+	.uleb128 .LVU62
+.LLST16:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU61
+	.uleb128 .LVU62
+.LLST17:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL17-.LVL17
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST18:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LFE34-.LVL18
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU66
+	.uleb128 .LVU70
+.LLST19:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU69
+	.uleb128 .LVU70
+.LLST20:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL19-.LVL19
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+.LLST21:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+.LLST22:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU77
+	.uleb128 .LVU88
+.LLST23:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL24-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU79
+	.uleb128 .LVU83
+.LLST24:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+.LLST25:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU86
+	.uleb128 .LVU88
+.LLST26:
+	.byte	0x8
+	.quad	.LVL23
+	.uleb128 .LVL24-.LVL23
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x60
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL45:
+	.byte	0x5
+	.quad	.LBB209
+	.byte	0x4
+	.uleb128 .LBB209-.LBB209
+	.uleb128 .LBE209-.LBB209
+	.byte	0x4
+	.uleb128 .LBB222-.LBB209
+	.uleb128 .LBE222-.LBB209
+	.byte	0
+.LLRL63:
+	.byte	0x5
+	.quad	.LBB229
+	.byte	0x4
+	.uleb128 .LBB229-.LBB229
+	.uleb128 .LBE229-.LBB229
+	.byte	0x4
+	.uleb128 .LBB237-.LBB229
+	.uleb128 .LBE237-.LBB229
+	.byte	0
+.LLRL69:
+	.byte	0x7
+	.quad	.Ltext0
+	.uleb128 .Letext0-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF19:
+	.string	"KeyEvent_t"
+.LASF32:
+	.string	"ps2_read_config"
+.LASF11:
+	.string	"uint64_t"
+.LASF3:
+	.string	"short int"
+.LASF25:
+	.string	"kprintf"
+.LASF27:
+	.string	"config"
+.LASF6:
+	.string	"uint8_t"
+.LASF33:
+	.string	"ps2_read_no_wait"
+.LASF14:
+	.string	"event_type"
+.LASF23:
+	.string	"bsp_lapic_id"
+.LASF26:
+	.string	"ioapic_redirect_irq"
+.LASF20:
+	.string	"long long int"
+.LASF36:
+	.string	"KeyEvent"
+.LASF4:
+	.string	"long int"
+.LASF35:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF21:
+	.string	"long double"
+.LASF5:
+	.string	"unsigned char"
+.LASF37:
+	.string	"ps2_init"
+.LASF2:
+	.string	"signed char"
+.LASF9:
+	.string	"uint32_t"
+.LASF10:
+	.string	"unsigned int"
+.LASF7:
+	.string	"uint16_t"
+.LASF28:
+	.string	"ps2_write_config"
+.LASF8:
+	.string	"short unsigned int"
+.LASF29:
+	.string	"ps2_write"
+.LASF17:
+	.string	"char"
+.LASF16:
+	.string	"is_control"
+.LASF24:
+	.string	"key_map"
+.LASF34:
+	.string	"ps2_read"
+.LASF18:
+	.string	"_Bool"
+.LASF31:
+	.string	"port"
+.LASF12:
+	.string	"long unsigned int"
+.LASF15:
+	.string	"ascii"
+.LASF13:
+	.string	"scan_code"
+.LASF22:
+	.string	"scancode_map"
+.LASF30:
+	.string	"value"
+.LASF38:
+	.string	"outb"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/drivers/ps2.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
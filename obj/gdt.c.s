@@ -0,0 +1,1353 @@
+	.file	"gdt.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/gdt.c"
+	.p2align 4
+	.globl	set_gdt_entry
+	.type	set_gdt_entry, @function
+set_gdt_entry:
+.LVL0:
+.LFB30:
+	.file 1 "src/gdt.c"
+	.loc 1 30 1 view -0
+	.cfi_startproc
+	.loc 1 32 5 view .LVU1
+	.loc 1 30 1 is_stmt 0 view .LVU2
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 32 23 view .LVU3
+	leaq	gdt(%rip), %rax
+	.loc 1 30 1 view .LVU4
+	movl	%ecx, %ebx
+	.loc 1 32 23 view .LVU5
+	movslq	%edi, %rcx
+.LVL1:
+	.loc 1 35 24 view .LVU6
+	movw	%dx, (%rax,%rcx,8)
+	.loc 1 33 34 view .LVU7
+	movl	%esi, %edi
+.LVL2:
+	.loc 1 39 35 view .LVU8
+	shrl	$16, %edx
+.LVL3:
+	.loc 1 33 26 view .LVU9
+	andl	$-16, %r8d
+.LVL4:
+	.loc 1 32 23 view .LVU10
+	movw	%si, 2(%rax,%rcx,8)
+	.loc 1 33 5 is_stmt 1 view .LVU11
+	.loc 1 34 5 view .LVU12
+	.loc 1 35 5 view .LVU13
+	.loc 1 39 5 view .LVU14
+	.loc 1 40 5 view .LVU15
+	.loc 1 42 5 view .LVU16
+	.loc 1 33 34 is_stmt 0 view .LVU17
+	shrl	$16, %edi
+	.loc 1 33 26 view .LVU18
+	xorl	%eax, %eax
+	.loc 1 39 42 view .LVU19
+	andl	$15, %edx
+	.loc 1 33 26 view .LVU20
+	movb	%dil, %al
+	orl	%r8d, %edx
+	andl	$-16777216, %esi
+.LVL5:
+	.loc 1 33 26 view .LVU21
+	movb	%bl, %ah
+.LVL6:
+	.loc 1 33 26 view .LVU22
+	movzbl	%dl, %edx
+	sall	$16, %edx
+	movzwl	%ax, %eax
+	orl	%edx, %eax
+	leaq	4+gdt(%rip), %rdx
+	orl	%esi, %eax
+	movl	%eax, (%rdx,%rcx,8)
+	.loc 1 43 1 view .LVU23
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	set_gdt_entry, .-set_gdt_entry
+	.p2align 4
+	.globl	_gdt_reload
+	.type	_gdt_reload, @function
+_gdt_reload:
+.LFB31:
+	.loc 1 47 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 5 view .LVU25
+#APP
+# 50 "src/gdt.c" 1
+	lgdt gdtp(%rip)
+	push $0x08
+	lea 1f(%rip), %rax
+	push %rax
+	lretq
+	1:
+	mov $0x10, %eax
+	mov %eax, %ds
+	mov %eax, %es
+	mov %eax, %fs
+	mov %eax, %gs
+	mov %eax, %ss
+	
+# 0 "" 2
+	.loc 1 67 1 is_stmt 0 view .LVU26
+#NO_APP
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	_gdt_reload, .-_gdt_reload
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Loading GDT at: 0x%X\n"
+	.text
+	.p2align 4
+	.globl	init_gdt
+	.type	init_gdt, @function
+init_gdt:
+.LFB32:
+	.loc 1 71 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 72 5 view .LVU28
+.LBB16:
+.LBB17:
+	.loc 1 35 24 is_stmt 0 view .LVU29
+	movq	$0, gdt(%rip)
+.LBE17:
+.LBE16:
+	.loc 1 72 16 view .LVU30
+	movl	$23, %eax
+	movw	%ax, gdtp(%rip)
+	.loc 1 73 5 is_stmt 1 view .LVU31
+	.loc 1 73 15 is_stmt 0 view .LVU32
+	leaq	gdt(%rip), %rax
+	movq	%rax, 2+gdtp(%rip)
+	.loc 1 76 5 is_stmt 1 view .LVU33
+.LVL7:
+.LBB19:
+.LBI16:
+	.loc 1 29 6 view .LVU34
+.LBB18:
+	.loc 1 32 5 view .LVU35
+	.loc 1 33 5 view .LVU36
+	.loc 1 34 5 view .LVU37
+	.loc 1 35 5 view .LVU38
+	.loc 1 39 5 view .LVU39
+	.loc 1 40 5 view .LVU40
+	.loc 1 42 5 view .LVU41
+	.loc 1 42 5 is_stmt 0 view .LVU42
+.LBE18:
+.LBE19:
+	.loc 1 79 5 is_stmt 1 view .LVU43
+.LBB20:
+.LBI20:
+	.loc 1 29 6 view .LVU44
+.LBB21:
+	.loc 1 32 5 view .LVU45
+	.loc 1 33 5 view .LVU46
+	.loc 1 34 5 view .LVU47
+	.loc 1 35 5 view .LVU48
+	.loc 1 39 5 view .LVU49
+	.loc 1 40 5 view .LVU50
+	.loc 1 42 5 view .LVU51
+	.loc 1 42 5 is_stmt 0 view .LVU52
+.LBE21:
+.LBE20:
+	.loc 1 82 5 is_stmt 1 view .LVU53
+.LBB23:
+.LBI23:
+	.loc 1 29 6 view .LVU54
+.LBB24:
+	.loc 1 32 5 view .LVU55
+	.loc 1 33 5 view .LVU56
+	.loc 1 34 5 view .LVU57
+	.loc 1 35 5 view .LVU58
+	.loc 1 39 5 view .LVU59
+	.loc 1 40 5 view .LVU60
+	.loc 1 42 5 view .LVU61
+.LBE24:
+.LBE23:
+.LBB26:
+.LBB22:
+	.loc 1 35 24 is_stmt 0 view .LVU62
+	movabsq	$13398648696143871, %rax
+	movq	%rax, 8+gdt(%rip)
+.LBE22:
+.LBE26:
+.LBB27:
+.LBB25:
+	movabsq	$4382653348380671, %rax
+	movq	%rax, 16+gdt(%rip)
+.LVL8:
+	.loc 1 35 24 view .LVU63
+.LBE25:
+.LBE27:
+	.loc 1 84 5 is_stmt 1 view .LVU64
+.LBB28:
+.LBI28:
+	.loc 1 46 6 view .LVU65
+.LBB29:
+	.loc 1 50 5 view .LVU66
+#APP
+# 50 "src/gdt.c" 1
+	lgdt gdtp(%rip)
+	push $0x08
+	lea 1f(%rip), %rax
+	push %rax
+	lretq
+	1:
+	mov $0x10, %eax
+	mov %eax, %ds
+	mov %eax, %es
+	mov %eax, %fs
+	mov %eax, %gs
+	mov %eax, %ss
+	
+# 0 "" 2
+#NO_APP
+.LBE29:
+.LBE28:
+	.loc 1 86 5 view .LVU67
+	leaq	gdtp(%rip), %rsi
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	jmp	kprintf@PLT
+.LVL9:
+	.cfi_endproc
+.LFE32:
+	.size	init_gdt, .-init_gdt
+	.globl	gdtp
+	.bss
+	.align 8
+	.type	gdtp, @object
+	.size	gdtp, 10
+gdtp:
+	.zero	10
+	.globl	gdt
+	.align 16
+	.type	gdt, @object
+	.size	gdt, 24
+gdt:
+	.zero	24
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 3 "src/include/gdt.h"
+	.file 4 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3a8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x9
+	.long	.LASF30
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x4
+	.long	.LASF6
+	.byte	0x2e
+	.byte	0x17
+	.long	0x55
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x4
+	.long	.LASF7
+	.byte	0x31
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x4
+	.long	.LASF9
+	.byte	0x34
+	.byte	0x16
+	.long	0x79
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x37
+	.byte	0x1b
+	.long	0x8b
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x8
+	.byte	0x31
+	.long	0xf4
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x33
+	.byte	0xe
+	.long	0x5c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x34
+	.byte	0xe
+	.long	0x5c
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x35
+	.byte	0xd
+	.long	0x4a
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x36
+	.byte	0xd
+	.long	0x4a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x37
+	.byte	0xd
+	.long	0x4a
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x38
+	.byte	0xd
+	.long	0x4a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0xa
+	.byte	0x3b
+	.long	0x118
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x3d
+	.byte	0xe
+	.long	0x5c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x3e
+	.byte	0xe
+	.long	0x80
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0xa0
+	.long	0x128
+	.uleb128 0xc
+	.long	0x8b
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.string	"gdt"
+	.byte	0x1
+	.byte	0x19
+	.byte	0x12
+	.long	0x118
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gdt
+	.uleb128 0xe
+	.long	.LASF25
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x10
+	.long	0xf4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gdtp
+	.uleb128 0xf
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x30
+	.byte	0x6
+	.long	0x167
+	.uleb128 0x10
+	.long	0x167
+	.uleb128 0x11
+	.byte	0
+	.uleb128 0x12
+	.byte	0x8
+	.long	0x174
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF26
+	.uleb128 0x13
+	.long	0x16d
+	.uleb128 0x14
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x46
+	.byte	0x6
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ec
+	.uleb128 0x6
+	.long	0x2f5
+	.quad	.LBI16
+	.byte	.LVU34
+	.long	.LLRL5
+	.byte	0x4c
+	.long	0x1f0
+	.uleb128 0x1
+	.long	0x32c
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x322
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x318
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x30e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x302
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x6
+	.long	0x2f5
+	.quad	.LBI20
+	.byte	.LVU44
+	.long	.LLRL11
+	.byte	0x4f
+	.long	0x249
+	.uleb128 0x1
+	.long	0x32c
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1
+	.long	0x322
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x318
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1
+	.long	0x30e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1
+	.long	0x302
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x6
+	.long	0x2f5
+	.quad	.LBI23
+	.byte	.LVU54
+	.long	.LLRL17
+	.byte	0x52
+	.long	0x2a2
+	.uleb128 0x1
+	.long	0x32c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x322
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1
+	.long	0x318
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1
+	.long	0x30e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x302
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x15
+	.long	0x2ec
+	.quad	.LBI28
+	.byte	.LVU65
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.byte	0x1
+	.byte	0x54
+	.byte	0x5
+	.uleb128 0x16
+	.quad	.LVL9
+	.long	0x154
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gdtp
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x18
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x1d
+	.byte	0x6
+	.byte	0x1
+	.long	0x337
+	.uleb128 0x19
+	.string	"num"
+	.byte	0x1
+	.byte	0x1d
+	.byte	0x18
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x26
+	.long	0x6e
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x35
+	.long	0x6e
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x44
+	.long	0x4a
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x54
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1a
+	.long	0x2f5
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x394
+	.uleb128 0x1
+	.long	0x302
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0x30e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1
+	.long	0x318
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1
+	.long	0x322
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x32c
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x1b
+	.long	0x2ec
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS6:
+	.uleb128 .LVU34
+	.uleb128 .LVU42
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU44
+	.uleb128 .LVU52
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU44
+	.uleb128 .LVU52
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x9a
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU44
+	.uleb128 .LVU52
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU44
+	.uleb128 .LVU52
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU44
+	.uleb128 .LVU52
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU54
+	.uleb128 .LVU63
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU54
+	.uleb128 .LVU63
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x92
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU54
+	.uleb128 .LVU63
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU54
+	.uleb128 .LVU63
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU22
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU10
+	.uleb128 .LVU10
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0
+.LLRL11:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF25:
+	.string	"gdtp"
+.LASF21:
+	.string	"gdt_entry"
+.LASF11:
+	.string	"uint64_t"
+.LASF27:
+	.string	"kprintf"
+.LASF22:
+	.string	"gdt_ptr"
+.LASF18:
+	.string	"access"
+.LASF19:
+	.string	"granularity"
+.LASF5:
+	.string	"unsigned char"
+.LASF12:
+	.string	"long unsigned int"
+.LASF8:
+	.string	"short unsigned int"
+.LASF31:
+	.string	"init_gdt"
+.LASF20:
+	.string	"base_high"
+.LASF24:
+	.string	"base"
+.LASF10:
+	.string	"unsigned int"
+.LASF26:
+	.string	"char"
+.LASF6:
+	.string	"uint8_t"
+.LASF23:
+	.string	"limit"
+.LASF16:
+	.string	"base_low"
+.LASF30:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF13:
+	.string	"long long int"
+.LASF3:
+	.string	"short int"
+.LASF7:
+	.string	"uint16_t"
+.LASF9:
+	.string	"uint32_t"
+.LASF4:
+	.string	"long int"
+.LASF29:
+	.string	"gran"
+.LASF14:
+	.string	"long double"
+.LASF2:
+	.string	"signed char"
+.LASF17:
+	.string	"base_middle"
+.LASF28:
+	.string	"set_gdt_entry"
+.LASF32:
+	.string	"_gdt_reload"
+.LASF15:
+	.string	"limit_low"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/gdt.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2734 @@
+	.file	"hpet.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/hpet.c"
+	.p2align 4
+	.globl	_timer_config_reg
+	.type	_timer_config_reg, @function
+_timer_config_reg:
+.LVL0:
+.LFB30:
+	.file 1 "src/hpet.c"
+	.loc 1 54 1 view -0
+	.cfi_startproc
+	.loc 1 55 5 view .LVU1
+	.loc 1 55 50 is_stmt 0 view .LVU2
+	leal	8(%rdi), %eax
+	sall	$5, %eax
+	.loc 1 55 12 view .LVU3
+	addq	base_addr(%rip), %rax
+	.loc 1 56 1 view .LVU4
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	_timer_config_reg, .-_timer_config_reg
+	.p2align 4
+	.globl	_timer_comparator_reg
+	.type	_timer_comparator_reg, @function
+_timer_comparator_reg:
+.LVL1:
+.LFB31:
+	.loc 1 59 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 60 5 view .LVU6
+	.loc 1 60 58 is_stmt 0 view .LVU7
+	movl	%edi, %eax
+	sall	$5, %eax
+	.loc 1 60 50 view .LVU8
+	addl	$264, %eax
+	.loc 1 60 12 view .LVU9
+	addq	base_addr(%rip), %rax
+	.loc 1 61 1 view .LVU10
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	_timer_comparator_reg, .-_timer_comparator_reg
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"HPET Initializing...\n"
+.LC1:
+	.string	"  Base: 0x%X\n"
+.LC2:
+	.string	"HPET Capabilites:\n"
+.LC3:
+	.string	"  HPET Num Timers: %d\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"  HPET Legacy Route Capable: %d\n"
+	.section	.rodata.str1.1
+.LC5:
+	.string	"  HPET 64-Bit Counter: %d\n"
+.LC6:
+	.string	"  HPET Tick Period: %d\n"
+.LC7:
+	.string	"  HPET Frequency: %d\n"
+.LC8:
+	.string	"HPET Config:\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC9:
+	.string	"  HPET Legacy Replacement Route Supported: %d\n"
+	.section	.rodata.str1.1
+.LC10:
+	.string	"  HPET Overall Enable: %d\n"
+	.text
+	.p2align 4
+	.globl	hpet_init
+	.type	hpet_init, @function
+hpet_init:
+.LFB34:
+	.loc 1 76 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 77 5 view .LVU12
+	.loc 1 76 1 is_stmt 0 view .LVU13
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 77 5 view .LVU14
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+	.loc 1 76 1 view .LVU15
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 77 5 view .LVU16
+	call	kprintf@PLT
+.LVL2:
+	.loc 1 86 5 is_stmt 1 view .LVU17
+	.loc 1 86 60 is_stmt 0 view .LVU18
+	movq	hpet(%rip), %rax
+	movq	vmm_higher_half_offset(%rip), %rsi
+	.loc 1 87 5 view .LVU19
+	leaq	.LC1(%rip), %rdi
+	.loc 1 86 60 view .LVU20
+	addq	44(%rax), %rsi
+	.loc 1 87 5 view .LVU21
+	xorl	%eax, %eax
+	.loc 1 86 15 view .LVU22
+	movq	%rsi, base_addr(%rip)
+	.loc 1 87 5 is_stmt 1 view .LVU23
+	call	kprintf@PLT
+.LVL3:
+	.loc 1 89 5 view .LVU24
+	.loc 1 89 15 is_stmt 0 view .LVU25
+	movq	base_addr(%rip), %rax
+	.loc 1 92 5 view .LVU26
+	leaq	.LC2(%rip), %rdi
+	.loc 1 89 15 view .LVU27
+	movq	%rax, hpet_regs(%rip)
+	.loc 1 90 5 is_stmt 1 view .LVU28
+	.loc 1 90 25 is_stmt 0 view .LVU29
+	addq	$240, %rax
+	movq	%rax, hpet_main_counter(%rip)
+	.loc 1 92 5 is_stmt 1 view .LVU30
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL4:
+	.loc 1 93 5 view .LVU31
+	.loc 1 93 36 is_stmt 0 view .LVU32
+	movq	hpet_regs(%rip), %rax
+	.loc 1 94 5 view .LVU33
+	leaq	.LC3(%rip), %rdi
+	.loc 1 93 36 view .LVU34
+	movq	(%rax), %rsi
+.LVL5:
+	.loc 1 94 5 is_stmt 1 view .LVU35
+	xorl	%eax, %eax
+	.loc 1 93 51 is_stmt 0 view .LVU36
+	shrq	$8, %rsi
+.LVL6:
+	.loc 1 93 14 view .LVU37
+	andl	$31, %esi
+.LVL7:
+	.loc 1 94 5 view .LVU38
+	call	kprintf@PLT
+.LVL8:
+	.loc 1 95 5 is_stmt 1 view .LVU39
+	.loc 1 95 60 is_stmt 0 view .LVU40
+	movq	hpet_regs(%rip), %rax
+	.loc 1 95 5 view .LVU41
+	leaq	.LC4(%rip), %rdi
+	.loc 1 95 60 view .LVU42
+	movq	(%rax), %rsi
+	.loc 1 95 5 view .LVU43
+	xorl	%eax, %eax
+	.loc 1 95 75 view .LVU44
+	shrq	$15, %rsi
+	.loc 1 95 5 view .LVU45
+	andl	$1, %esi
+	call	kprintf@PLT
+.LVL9:
+	.loc 1 96 5 is_stmt 1 view .LVU46
+	.loc 1 96 54 is_stmt 0 view .LVU47
+	movq	hpet_regs(%rip), %rax
+	.loc 1 96 5 view .LVU48
+	leaq	.LC5(%rip), %rdi
+	.loc 1 96 54 view .LVU49
+	movq	(%rax), %rsi
+	.loc 1 96 5 view .LVU50
+	xorl	%eax, %eax
+	.loc 1 96 69 view .LVU51
+	shrq	$13, %rsi
+	.loc 1 96 5 view .LVU52
+	andl	$1, %esi
+	call	kprintf@PLT
+.LVL10:
+	.loc 1 97 5 is_stmt 1 view .LVU53
+	.loc 1 97 48 is_stmt 0 view .LVU54
+	movq	hpet_regs(%rip), %rax
+	.loc 1 98 5 view .LVU55
+	leaq	.LC6(%rip), %rdi
+	.loc 1 97 48 view .LVU56
+	movq	(%rax), %rbx
+	.loc 1 98 5 view .LVU57
+	xorl	%eax, %eax
+	.loc 1 97 63 view .LVU58
+	shrq	$32, %rbx
+.LVL11:
+	.loc 1 98 5 is_stmt 1 view .LVU59
+	movl	%ebx, %esi
+	call	kprintf@PLT
+.LVL12:
+	.loc 1 100 5 view .LVU60
+	.loc 1 101 5 is_stmt 0 view .LVU61
+	leaq	.LC7(%rip), %rdi
+	.loc 1 100 41 view .LVU62
+	movabsq	$1000000000000000, %rax
+	cqto
+	idivq	%rbx
+	.loc 1 101 5 view .LVU63
+	movq	%rax, %rsi
+	.loc 1 100 20 view .LVU64
+	movq	%rax, hpet_frequency(%rip)
+	.loc 1 101 5 is_stmt 1 view .LVU65
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL13:
+	.loc 1 108 5 view .LVU66
+	xorl	%eax, %eax
+	leaq	.LC8(%rip), %rdi
+	call	kprintf@PLT
+.LVL14:
+	.loc 1 109 5 view .LVU67
+	.loc 1 109 46 is_stmt 0 view .LVU68
+	movq	hpet_regs(%rip), %rax
+	.loc 1 110 5 view .LVU69
+	leaq	.LC9(%rip), %rdi
+	.loc 1 109 46 view .LVU70
+	movq	16(%rax), %rsi
+.LVL15:
+	.loc 1 110 5 is_stmt 1 view .LVU71
+	.loc 1 109 55 is_stmt 0 view .LVU72
+	shrq	%rsi
+.LVL16:
+	.loc 1 110 5 view .LVU73
+	andl	$1, %esi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL17:
+	.loc 1 111 5 is_stmt 1 view .LVU74
+	.loc 1 111 53 is_stmt 0 view .LVU75
+	movq	hpet_regs(%rip), %rax
+	.loc 1 111 5 view .LVU76
+	leaq	.LC10(%rip), %rdi
+	.loc 1 111 53 view .LVU77
+	movq	16(%rax), %rsi
+	.loc 1 111 5 view .LVU78
+	xorl	%eax, %eax
+	andl	$1, %esi
+	call	kprintf@PLT
+.LVL18:
+	.loc 1 114 5 is_stmt 1 view .LVU79
+.LBB26:
+.LBI26:
+	.loc 1 53 11 view .LVU80
+.LBB27:
+	.loc 1 55 5 view .LVU81
+	.loc 1 55 41 is_stmt 0 view .LVU82
+	movq	base_addr(%rip), %rbx
+.LVL19:
+	.loc 1 55 41 view .LVU83
+.LBE27:
+.LBE26:
+	.loc 1 119 5 is_stmt 1 view .LVU84
+	.loc 1 121 5 is_stmt 0 view .LVU85
+	leaq	12(%rsp), %rdi
+	.loc 1 119 40 view .LVU86
+	movq	256(%rbx), %rsi
+.LVL20:
+	.loc 1 120 5 is_stmt 1 view .LVU87
+	.loc 1 121 5 view .LVU88
+	shrq	$32, %rsi
+.LVL21:
+	.loc 1 121 5 is_stmt 0 view .LVU89
+	call	sprint_binary32@PLT
+.LVL22:
+	.loc 1 129 5 is_stmt 1 view .LVU90
+	.loc 1 130 5 view .LVU91
+	movq	256(%rbx), %rax
+	.loc 1 142 5 is_stmt 0 view .LVU92
+	movl	bsp_lapic_id(%rip), %edi
+	xorl	%edx, %edx
+	movl	$1, %ecx
+	movl	$32, %esi
+	.loc 1 130 19 view .LVU93
+	movq	%rax, 256(%rbx)
+	.loc 1 133 5 is_stmt 1 view .LVU94
+	movq	256(%rbx), %rax
+	.loc 1 133 19 is_stmt 0 view .LVU95
+	orq	$8, %rax
+	movq	%rax, 256(%rbx)
+	.loc 1 139 5 is_stmt 1 view .LVU96
+	movq	256(%rbx), %rax
+	.loc 1 139 19 is_stmt 0 view .LVU97
+	orq	$4, %rax
+	movq	%rax, 256(%rbx)
+	.loc 1 142 5 is_stmt 1 view .LVU98
+	call	ioapic_redirect_irq@PLT
+.LVL23:
+	.loc 1 144 5 view .LVU99
+	.loc 1 144 12 is_stmt 0 view .LVU100
+	movq	$0, _ticks(%rip)
+	.loc 1 145 1 view .LVU101
+	addq	$48, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL24:
+	.loc 1 145 1 view .LVU102
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	hpet_init, .-hpet_init
+	.p2align 4
+	.globl	hpet_one_shot
+	.type	hpet_one_shot, @function
+hpet_one_shot:
+.LVL25:
+.LFB35:
+	.loc 1 151 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 155 5 view .LVU104
+.LBB28:
+.LBI28:
+	.loc 1 197 6 view .LVU105
+.LBB29:
+	.loc 1 202 5 view .LVU106
+.LBB30:
+.LBI30:
+	.loc 1 175 13 view .LVU107
+.LBB31:
+	.loc 1 180 5 view .LVU108
+	.loc 1 180 14 is_stmt 0 view .LVU109
+	movq	hpet_regs(%rip), %rsi
+.LBE31:
+.LBE30:
+.LBE29:
+.LBE28:
+.LBB36:
+.LBB37:
+	.loc 1 55 41 view .LVU110
+	movq	base_addr(%rip), %rcx
+.LBE37:
+.LBE36:
+	.loc 1 165 46 view .LVU111
+	movabsq	$2361183241434822607, %rdx
+.LBB39:
+.LBB34:
+.LBB33:
+.LBB32:
+	.loc 1 180 14 view .LVU112
+	movq	16(%rsi), %rax
+	.loc 1 180 23 view .LVU113
+	andq	$-2, %rax
+	movq	%rax, 16(%rsi)
+.LBE32:
+.LBE33:
+	.loc 1 203 5 is_stmt 1 view .LVU114
+.LBE34:
+.LBE39:
+	.loc 1 158 5 is_stmt 0 view .LVU115
+	movq	hpet_main_counter(%rip), %rax
+.LBB40:
+.LBB35:
+	.loc 1 203 12 view .LVU116
+	movq	$0, _ticks(%rip)
+.LBE35:
+.LBE40:
+	.loc 1 158 5 is_stmt 1 view .LVU117
+	.loc 1 158 24 is_stmt 0 view .LVU118
+	movq	$0, (%rax)
+	.loc 1 160 5 is_stmt 1 view .LVU119
+.LVL26:
+.LBB41:
+.LBI36:
+	.loc 1 53 11 view .LVU120
+.LBB38:
+	.loc 1 55 5 view .LVU121
+	.loc 1 55 5 is_stmt 0 view .LVU122
+.LBE38:
+.LBE41:
+	.loc 1 161 5 is_stmt 1 view .LVU123
+	movq	256(%rcx), %rax
+	.loc 1 161 19 is_stmt 0 view .LVU124
+	andq	$-9, %rax
+	movq	%rax, 256(%rcx)
+	.loc 1 164 5 is_stmt 1 view .LVU125
+.LVL27:
+	.loc 1 165 5 view .LVU126
+	.loc 1 165 46 is_stmt 0 view .LVU127
+	movq	hpet_frequency(%rip), %rax
+	shrq	$3, %rax
+	mulq	%rdx
+	shrq	$4, %rdx
+	.loc 1 165 54 view .LVU128
+	imulq	%rdi, %rdx
+	.loc 1 165 17 view .LVU129
+	movq	%rdx, 264(%rcx)
+	.loc 1 167 5 is_stmt 1 view .LVU130
+	movq	256(%rcx), %rax
+	.loc 1 167 19 is_stmt 0 view .LVU131
+	orq	$4, %rax
+	movq	%rax, 256(%rcx)
+	.loc 1 169 5 is_stmt 1 view .LVU132
+.LBB42:
+.LBI42:
+	.loc 1 186 13 view .LVU133
+.LBB43:
+	.loc 1 191 5 view .LVU134
+	.loc 1 191 14 is_stmt 0 view .LVU135
+	movq	16(%rsi), %rax
+	.loc 1 191 23 view .LVU136
+	orq	$1, %rax
+	movq	%rax, 16(%rsi)
+.LBE43:
+.LBE42:
+	.loc 1 170 1 view .LVU137
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	hpet_one_shot, .-hpet_one_shot
+	.p2align 4
+	.globl	hpet_disable
+	.type	hpet_disable, @function
+hpet_disable:
+.LFB36:
+	.loc 1 176 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 180 5 view .LVU139
+	.loc 1 180 14 is_stmt 0 view .LVU140
+	movq	hpet_regs(%rip), %rdx
+	movq	16(%rdx), %rax
+	.loc 1 180 23 view .LVU141
+	andq	$-2, %rax
+	movq	%rax, 16(%rdx)
+	.loc 1 181 1 view .LVU142
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	hpet_disable, .-hpet_disable
+	.p2align 4
+	.globl	hpet_enable
+	.type	hpet_enable, @function
+hpet_enable:
+.LFB37:
+	.loc 1 187 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 191 5 view .LVU144
+	.loc 1 191 14 is_stmt 0 view .LVU145
+	movq	hpet_regs(%rip), %rdx
+	movq	16(%rdx), %rax
+	.loc 1 191 23 view .LVU146
+	orq	$1, %rax
+	movq	%rax, 16(%rdx)
+	.loc 1 192 1 view .LVU147
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	hpet_enable, .-hpet_enable
+	.p2align 4
+	.globl	hpet_reset
+	.type	hpet_reset, @function
+hpet_reset:
+.LFB38:
+	.loc 1 198 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 202 5 view .LVU149
+.LBB44:
+.LBI44:
+	.loc 1 175 13 view .LVU150
+.LBB45:
+	.loc 1 180 5 view .LVU151
+	.loc 1 180 14 is_stmt 0 view .LVU152
+	movq	hpet_regs(%rip), %rdx
+	movq	16(%rdx), %rax
+	.loc 1 180 23 view .LVU153
+	andq	$-2, %rax
+	movq	%rax, 16(%rdx)
+.LBE45:
+.LBE44:
+	.loc 1 203 5 is_stmt 1 view .LVU154
+	.loc 1 203 12 is_stmt 0 view .LVU155
+	movq	$0, _ticks(%rip)
+	.loc 1 204 1 view .LVU156
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	hpet_reset, .-hpet_reset
+	.p2align 4
+	.globl	hpet_ack
+	.type	hpet_ack, @function
+hpet_ack:
+.LFB39:
+	.loc 1 207 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 214 5 view .LVU158
+	.loc 1 214 14 is_stmt 0 view .LVU159
+	movq	hpet_regs(%rip), %rdx
+	movq	32(%rdx), %rax
+	.loc 1 214 33 view .LVU160
+	andq	$-2, %rax
+	movq	%rax, 32(%rdx)
+	.loc 1 215 1 view .LVU161
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	hpet_ack, .-hpet_ack
+	.p2align 4
+	.globl	hpet_sleep
+	.type	hpet_sleep, @function
+hpet_sleep:
+.LVL28:
+.LFB40:
+	.loc 1 222 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 226 5 view .LVU163
+	call	hpet_one_shot
+.LVL29:
+	.loc 1 229 5 view .LVU164
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 229 18 discriminator 1 view .LVU165
+	movq	_ticks(%rip), %rax
+	testq	%rax, %rax
+	je	.L12
+	.loc 1 231 5 view .LVU166
+.LBB46:
+.LBI46:
+	.loc 1 175 13 view .LVU167
+.LBB47:
+	.loc 1 180 5 view .LVU168
+	.loc 1 180 14 is_stmt 0 view .LVU169
+	movq	hpet_regs(%rip), %rdx
+	movq	16(%rdx), %rax
+	.loc 1 180 23 view .LVU170
+	andq	$-2, %rax
+	movq	%rax, 16(%rdx)
+.LBE47:
+.LBE46:
+	.loc 1 232 1 view .LVU171
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	hpet_sleep, .-hpet_sleep
+	.p2align 4
+	.globl	hpet_sleep_counter
+	.type	hpet_sleep_counter, @function
+hpet_sleep_counter:
+.LVL30:
+.LFB41:
+	.loc 1 239 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 240 5 view .LVU173
+.LBB48:
+.LBI48:
+	.loc 1 175 13 view .LVU174
+.LBB49:
+	.loc 1 180 5 view .LVU175
+	.loc 1 180 14 is_stmt 0 view .LVU176
+	movq	hpet_regs(%rip), %rsi
+.LBE49:
+.LBE48:
+.LBB51:
+.LBB52:
+	.loc 1 55 41 view .LVU177
+	movq	base_addr(%rip), %rdx
+.LBE52:
+.LBE51:
+	.loc 1 245 5 view .LVU178
+	movq	hpet_main_counter(%rip), %rcx
+.LBB54:
+.LBB50:
+	.loc 1 180 14 view .LVU179
+	movq	16(%rsi), %rax
+	.loc 1 180 23 view .LVU180
+	andq	$-2, %rax
+	movq	%rax, 16(%rsi)
+.LBE50:
+.LBE54:
+	.loc 1 242 5 is_stmt 1 view .LVU181
+.LVL31:
+.LBB55:
+.LBI51:
+	.loc 1 53 11 view .LVU182
+.LBB53:
+	.loc 1 55 5 view .LVU183
+	.loc 1 55 5 is_stmt 0 view .LVU184
+.LBE53:
+.LBE55:
+	.loc 1 243 5 is_stmt 1 view .LVU185
+	movq	256(%rdx), %rax
+	.loc 1 243 19 is_stmt 0 view .LVU186
+	andq	$-5, %rax
+	movq	%rax, 256(%rdx)
+	.loc 1 245 5 is_stmt 1 view .LVU187
+	.loc 1 246 49 is_stmt 0 view .LVU188
+	movabsq	$2361183241434822607, %rax
+	.loc 1 245 24 view .LVU189
+	movq	$0, (%rcx)
+	.loc 1 246 5 is_stmt 1 view .LVU190
+	.loc 1 246 49 is_stmt 0 view .LVU191
+	movq	hpet_frequency(%rip), %rdx
+.LVL32:
+	.loc 1 246 49 view .LVU192
+	shrq	$3, %rdx
+	mulq	%rdx
+.LBB56:
+.LBB57:
+	.loc 1 191 14 view .LVU193
+	movq	16(%rsi), %rax
+	.loc 1 191 23 view .LVU194
+	orq	$1, %rax
+.LBE57:
+.LBE56:
+	.loc 1 246 49 view .LVU195
+	shrq	$4, %rdx
+.LBB60:
+.LBB58:
+	.loc 1 191 23 view .LVU196
+	movq	%rax, 16(%rsi)
+.LBE58:
+.LBE60:
+	.loc 1 246 14 view .LVU197
+	imulq	%rdi, %rdx
+.LVL33:
+	.loc 1 248 5 is_stmt 1 view .LVU198
+.LBB61:
+.LBI56:
+	.loc 1 186 13 view .LVU199
+.LBB59:
+	.loc 1 191 5 view .LVU200
+	.p2align 4,,10
+	.p2align 3
+.L16:
+.LBE59:
+.LBE61:
+	.loc 1 249 31 discriminator 1 view .LVU201
+	.loc 1 249 12 is_stmt 0 discriminator 1 view .LVU202
+	movq	(%rcx), %rax
+	.loc 1 249 31 discriminator 1 view .LVU203
+	cmpq	%rdx, %rax
+	jb	.L16
+	.loc 1 250 5 is_stmt 1 view .LVU204
+.LBB62:
+.LBI62:
+	.loc 1 175 13 view .LVU205
+.LBB63:
+	.loc 1 180 5 view .LVU206
+	.loc 1 180 14 is_stmt 0 view .LVU207
+	movq	16(%rsi), %rax
+	.loc 1 180 23 view .LVU208
+	andq	$-2, %rax
+	movq	%rax, 16(%rsi)
+.LBE63:
+.LBE62:
+	.loc 1 251 1 view .LVU209
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	hpet_sleep_counter, .-hpet_sleep_counter
+	.p2align 4
+	.globl	hpet_isr
+	.type	hpet_isr, @function
+hpet_isr:
+.LFB42:
+	.loc 1 257 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 258 5 view .LVU211
+	.loc 1 258 11 is_stmt 0 view .LVU212
+	movq	_ticks(%rip), %rax
+	addq	$1, %rax
+	movq	%rax, _ticks(%rip)
+	.loc 1 259 1 view .LVU213
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	hpet_isr, .-hpet_isr
+	.globl	_ticks
+	.bss
+	.align 8
+	.type	_ticks, @object
+	.size	_ticks, 8
+_ticks:
+	.zero	8
+	.globl	hpet_frequency
+	.align 8
+	.type	hpet_frequency, @object
+	.size	hpet_frequency, 8
+hpet_frequency:
+	.zero	8
+	.globl	hpet_main_counter
+	.align 8
+	.type	hpet_main_counter, @object
+	.size	hpet_main_counter, 8
+hpet_main_counter:
+	.zero	8
+	.globl	hpet_regs
+	.align 8
+	.type	hpet_regs, @object
+	.size	hpet_regs, 8
+hpet_regs:
+	.zero	8
+	.globl	base_addr
+	.align 8
+	.type	base_addr, @object
+	.size	base_addr, 8
+base_addr:
+	.zero	8
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 3 "src/include/acpi.h"
+	.file 4 "src/include/mem.h"
+	.file 5 "src/include/cpu.h"
+	.file 6 "src/include/ioapic.h"
+	.file 7 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x913
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF77
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x9
+	.long	.LASF6
+	.byte	0x2e
+	.byte	0x17
+	.long	0x55
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x9
+	.long	.LASF7
+	.byte	0x31
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x34
+	.byte	0x16
+	.long	0x79
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x9
+	.long	.LASF11
+	.byte	0x37
+	.byte	0x1b
+	.long	0x90
+	.uleb128 0x17
+	.long	0x80
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x20
+	.long	0x97
+	.uleb128 0xa
+	.long	.LASF23
+	.byte	0x24
+	.byte	0x3
+	.byte	0x2f
+	.long	0x125
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x30
+	.byte	0xa
+	.long	0x125
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x31
+	.byte	0xe
+	.long	0x6e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x32
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x33
+	.byte	0xd
+	.long	0x4a
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x3
+	.byte	0x34
+	.byte	0xa
+	.long	0x135
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x3
+	.byte	0x35
+	.byte	0xa
+	.long	0x145
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x3
+	.byte	0x36
+	.byte	0xe
+	.long	0x6e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x3
+	.byte	0x37
+	.byte	0xe
+	.long	0x6e
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x3
+	.byte	0x38
+	.byte	0xe
+	.long	0x6e
+	.byte	0x20
+	.byte	0
+	.uleb128 0xb
+	.long	0x97
+	.long	0x135
+	.uleb128 0xc
+	.long	0x90
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	0x97
+	.long	0x145
+	.uleb128 0xc
+	.long	0x90
+	.byte	0x5
+	.byte	0
+	.uleb128 0xb
+	.long	0x97
+	.long	0x155
+	.uleb128 0xc
+	.long	0x90
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF24
+	.byte	0xc
+	.byte	0x3
+	.byte	0x3b
+	.long	0x1a3
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x3
+	.byte	0x3d
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x3
+	.byte	0x3e
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x3
+	.byte	0x3f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x3
+	.byte	0x40
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x3
+	.byte	0x41
+	.byte	0xe
+	.long	0x80
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF30
+	.byte	0x38
+	.byte	0x3
+	.byte	0x45
+	.long	0x23f
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x3
+	.byte	0x47
+	.byte	0x14
+	.long	0xa3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x3
+	.byte	0x48
+	.byte	0xd
+	.long	0x4a
+	.byte	0x24
+	.uleb128 0xd
+	.long	.LASF33
+	.byte	0x49
+	.long	0x4a
+	.byte	0x5
+	.value	0x128
+	.uleb128 0xd
+	.long	.LASF34
+	.byte	0x4a
+	.long	0x4a
+	.byte	0x1
+	.value	0x12d
+	.uleb128 0xd
+	.long	.LASF28
+	.byte	0x4b
+	.long	0x4a
+	.byte	0x1
+	.value	0x12e
+	.uleb128 0xd
+	.long	.LASF35
+	.byte	0x4c
+	.long	0x4a
+	.byte	0x1
+	.value	0x12f
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x3
+	.byte	0x4d
+	.byte	0xe
+	.long	0x5c
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x3
+	.byte	0x4e
+	.byte	0x1e
+	.long	0x155
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x3
+	.byte	0x4f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x3
+	.byte	0x50
+	.byte	0xe
+	.long	0x5c
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x3
+	.byte	0x51
+	.byte	0xd
+	.long	0x4a
+	.byte	0x37
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF30
+	.byte	0x3
+	.byte	0x9c
+	.byte	0x15
+	.long	0x24b
+	.uleb128 0x7
+	.long	0x1a3
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF40
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF41
+	.uleb128 0x7
+	.long	0x97
+	.uleb128 0x7
+	.long	0x9e
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF42
+	.uleb128 0xf
+	.long	.LASF43
+	.byte	0x4
+	.byte	0xb2
+	.byte	0x11
+	.long	0x80
+	.uleb128 0xf
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x11
+	.long	0x6e
+	.uleb128 0xa
+	.long	.LASF45
+	.byte	0x28
+	.byte	0x1
+	.byte	0x26
+	.long	0x2d5
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x1
+	.byte	0x27
+	.byte	0x17
+	.long	0x8b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x28
+	.byte	0x17
+	.long	0x8b
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x29
+	.byte	0x17
+	.long	0x8b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x17
+	.long	0x8b
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x17
+	.long	0x8b
+	.byte	0x20
+	.byte	0
+	.uleb128 0x17
+	.long	0x287
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0x2e
+	.byte	0x14
+	.long	0x2ef
+	.uleb128 0x9
+	.byte	0x3
+	.quad	base_addr
+	.uleb128 0x7
+	.long	0x8b
+	.uleb128 0x8
+	.long	.LASF45
+	.byte	0x2f
+	.byte	0x1c
+	.long	0x309
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hpet_regs
+	.uleb128 0x7
+	.long	0x2d5
+	.uleb128 0x8
+	.long	.LASF52
+	.byte	0x30
+	.byte	0x14
+	.long	0x2ef
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hpet_main_counter
+	.uleb128 0x8
+	.long	.LASF53
+	.byte	0x32
+	.byte	0xa
+	.long	0x80
+	.uleb128 0x9
+	.byte	0x3
+	.quad	hpet_frequency
+	.uleb128 0x8
+	.long	.LASF54
+	.byte	0x33
+	.byte	0x13
+	.long	0x8b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_ticks
+	.uleb128 0x10
+	.long	.LASF55
+	.byte	0x6
+	.byte	0x21
+	.long	0x36d
+	.uleb128 0x6
+	.long	0x6e
+	.uleb128 0x6
+	.long	0x4a
+	.uleb128 0x6
+	.long	0x4a
+	.uleb128 0x6
+	.long	0x268
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF56
+	.byte	0x7
+	.byte	0x34
+	.long	0x383
+	.uleb128 0x6
+	.long	0x25e
+	.uleb128 0x6
+	.long	0x6e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF57
+	.byte	0x7
+	.byte	0x30
+	.long	0x395
+	.uleb128 0x6
+	.long	0x263
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF62
+	.byte	0x1
+	.value	0x100
+	.byte	0x6
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x11
+	.long	.LASF60
+	.byte	0xee
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x46a
+	.uleb128 0x12
+	.string	"ms"
+	.byte	0xee
+	.byte	0x22
+	.long	0x80
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0xf2
+	.byte	0x18
+	.long	0x2ef
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xf6
+	.byte	0xe
+	.long	0x80
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x13
+	.long	0x4f0
+	.quad	.LBI48
+	.byte	.LVU174
+	.long	.LLRL14
+	.byte	0xf0
+	.uleb128 0x14
+	.long	0x853
+	.quad	.LBI51
+	.byte	.LVU182
+	.long	.LLRL15
+	.byte	0xf2
+	.byte	0x27
+	.long	0x437
+	.uleb128 0x15
+	.long	0x861
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x13
+	.long	0x4e8
+	.quad	.LBI56
+	.byte	.LVU199
+	.long	.LLRL17
+	.byte	0xf8
+	.uleb128 0xe
+	.long	0x4f0
+	.quad	.LBI62
+	.byte	.LVU205
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF61
+	.byte	0xdd
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4c6
+	.uleb128 0x12
+	.string	"ms"
+	.byte	0xdd
+	.byte	0x1a
+	.long	0x80
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xe
+	.long	0x4f0
+	.quad	.LBI46
+	.byte	.LVU167
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.byte	0xe7
+	.uleb128 0x18
+	.quad	.LVL29
+	.long	0x4f8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF63
+	.byte	0x1
+	.byte	0xce
+	.byte	0x6
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x16
+	.long	.LASF64
+	.byte	0xc5
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x16
+	.long	.LASF65
+	.byte	0xba
+	.byte	0xd
+	.byte	0x3
+	.uleb128 0x16
+	.long	.LASF66
+	.byte	0xaf
+	.byte	0xd
+	.byte	0x3
+	.uleb128 0x11
+	.long	.LASF67
+	.byte	0x96
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5b8
+	.uleb128 0x12
+	.string	"ms"
+	.byte	0x96
+	.byte	0x1d
+	.long	0x80
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0xa0
+	.byte	0x18
+	.long	0x2ef
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x5
+	.long	.LASF68
+	.byte	0xa4
+	.byte	0x18
+	.long	0x2ef
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x14
+	.long	0x4e0
+	.quad	.LBI28
+	.byte	.LVU105
+	.long	.LLRL8
+	.byte	0x9b
+	.byte	0x5
+	.long	0x572
+	.uleb128 0x13
+	.long	0x4f0
+	.quad	.LBI30
+	.byte	.LVU107
+	.long	.LLRL9
+	.byte	0xca
+	.byte	0
+	.uleb128 0x14
+	.long	0x853
+	.quad	.LBI36
+	.byte	.LVU120
+	.long	.LLRL10
+	.byte	0xa0
+	.byte	0x27
+	.long	0x598
+	.uleb128 0x15
+	.long	0x861
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0xe
+	.long	0x4e8
+	.quad	.LBI42
+	.byte	.LVU133
+	.quad	.LBB42
+	.quad	.LBE42-.LBB42
+	.byte	0xa9
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF78
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x6
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x826
+	.uleb128 0x5
+	.long	.LASF69
+	.byte	0x5d
+	.byte	0xe
+	.long	0x80
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x5
+	.long	.LASF70
+	.byte	0x61
+	.byte	0xe
+	.long	0x6e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x5
+	.long	.LASF71
+	.byte	0x6d
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0x72
+	.byte	0x18
+	.long	0x2ef
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x5
+	.long	.LASF72
+	.byte	0x77
+	.byte	0xe
+	.long	0x6e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x25
+	.long	.LASF73
+	.byte	0x1
+	.byte	0x78
+	.byte	0xa
+	.long	0x826
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x26
+	.long	.LASF74
+	.byte	0x1
+	.byte	0x81
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x27
+	.long	0x853
+	.quad	.LBI26
+	.byte	.LVU80
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.byte	0x1
+	.byte	0x72
+	.byte	0x27
+	.long	0x684
+	.uleb128 0x15
+	.long	0x861
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL2
+	.long	0x383
+	.long	0x6a3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL3
+	.long	0x383
+	.long	0x6c2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL4
+	.long	0x383
+	.long	0x6e1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL8
+	.long	0x383
+	.long	0x700
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL9
+	.long	0x383
+	.long	0x71f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL10
+	.long	0x383
+	.long	0x73e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL12
+	.long	0x383
+	.long	0x763
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL13
+	.long	0x383
+	.long	0x792
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.byte	0x10
+	.uleb128 0x38d7ea4c68000
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1b
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL14
+	.long	0x383
+	.long	0x7b1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL17
+	.long	0x383
+	.long	0x7d0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL18
+	.long	0x383
+	.long	0x7ef
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x3
+	.quad	.LVL22
+	.long	0x36d
+	.long	0x807
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL23
+	.long	0x34d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x97
+	.long	0x836
+	.uleb128 0xc
+	.long	0x90
+	.byte	0x23
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF75
+	.byte	0x3a
+	.long	0x84e
+	.long	0x84e
+	.uleb128 0x1a
+	.string	"n"
+	.byte	0x3a
+	.byte	0x2a
+	.long	0x6e
+	.byte	0
+	.uleb128 0x7
+	.long	0x80
+	.uleb128 0x19
+	.long	.LASF76
+	.byte	0x35
+	.long	0x84e
+	.long	0x86b
+	.uleb128 0x1a
+	.string	"n"
+	.byte	0x35
+	.byte	0x26
+	.long	0x6e
+	.byte	0
+	.uleb128 0x1b
+	.long	0x853
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x88e
+	.uleb128 0x1c
+	.long	0x861
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1b
+	.long	0x836
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b1
+	.uleb128 0x1c
+	.long	0x844
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1d
+	.long	0x4f0
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1d
+	.long	0x4e8
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x28
+	.long	0x4e0
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xe
+	.long	0x4f0
+	.quad	.LBI44
+	.byte	.LVU150
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.byte	0xca
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0xd
+	.uleb128 0xb
+	.uleb128 0x6b
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS12:
+	.uleb128 .LVU184
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 256
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0xe
+	.byte	0x3
+	.quad	base_addr
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU198
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 256
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU126
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 264
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU35
+	.uleb128 .LVU37
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0x38
+	.byte	0x25
+	.byte	0x4f
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU59
+	.uleb128 .LVU83
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x31
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU83
+	.uleb128 .LVU102
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 256
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF56:
+	.string	"sprint_binary32"
+.LASF65:
+	.string	"hpet_enable"
+.LASF17:
+	.string	"checksum"
+.LASF11:
+	.string	"uint64_t"
+.LASF16:
+	.string	"revision"
+.LASF25:
+	.string	"address_space_id"
+.LASF61:
+	.string	"hpet_sleep"
+.LASF59:
+	.string	"limit"
+.LASF63:
+	.string	"hpet_ack"
+.LASF40:
+	.string	"long long int"
+.LASF2:
+	.string	"signed char"
+.LASF73:
+	.string	"buff"
+.LASF67:
+	.string	"hpet_one_shot"
+.LASF4:
+	.string	"long int"
+.LASF78:
+	.string	"hpet_init"
+.LASF37:
+	.string	"hpet_number"
+.LASF7:
+	.string	"uint16_t"
+.LASF27:
+	.string	"register_bit_offset"
+.LASF14:
+	.string	"signature"
+.LASF28:
+	.string	"reserved"
+.LASF77:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF22:
+	.string	"creator_revision"
+.LASF10:
+	.string	"unsigned int"
+.LASF20:
+	.string	"oem_revision"
+.LASF12:
+	.string	"long unsigned int"
+.LASF21:
+	.string	"creator_id"
+.LASF55:
+	.string	"ioapic_redirect_irq"
+.LASF50:
+	.string	"interrupt_status"
+.LASF52:
+	.string	"hpet_main_counter"
+.LASF8:
+	.string	"short unsigned int"
+.LASF43:
+	.string	"vmm_higher_half_offset"
+.LASF35:
+	.string	"legacy_replacement"
+.LASF51:
+	.string	"base_addr"
+.LASF71:
+	.string	"legacy_replace_route"
+.LASF39:
+	.string	"page_protection"
+.LASF54:
+	.string	"_ticks"
+.LASF41:
+	.string	"long double"
+.LASF29:
+	.string	"address"
+.LASF18:
+	.string	"oem_id"
+.LASF36:
+	.string	"pci_vendor_id"
+.LASF31:
+	.string	"desc"
+.LASF75:
+	.string	"_timer_comparator_reg"
+.LASF38:
+	.string	"minimum_tick"
+.LASF33:
+	.string	"comparator_count"
+.LASF45:
+	.string	"hpet_regs"
+.LASF66:
+	.string	"hpet_disable"
+.LASF68:
+	.string	"timer_comp"
+.LASF76:
+	.string	"_timer_config_reg"
+.LASF42:
+	.string	"_Bool"
+.LASF5:
+	.string	"unsigned char"
+.LASF26:
+	.string	"register_bit_width"
+.LASF3:
+	.string	"short int"
+.LASF64:
+	.string	"hpet_reset"
+.LASF58:
+	.string	"timer_config"
+.LASF23:
+	.string	"sysdesc"
+.LASF32:
+	.string	"hardware_rev_id"
+.LASF9:
+	.string	"uint32_t"
+.LASF69:
+	.string	"numTimers"
+.LASF15:
+	.string	"length"
+.LASF13:
+	.string	"char"
+.LASF30:
+	.string	"hpet"
+.LASF72:
+	.string	"routing_caps"
+.LASF48:
+	.string	"config"
+.LASF74:
+	.string	"selected_ioapic_input"
+.LASF62:
+	.string	"hpet_isr"
+.LASF46:
+	.string	"capabilities"
+.LASF24:
+	.string	"address_structure"
+.LASF19:
+	.string	"oem_table_id"
+.LASF70:
+	.string	"tick_period"
+.LASF44:
+	.string	"bsp_lapic_id"
+.LASF6:
+	.string	"uint8_t"
+.LASF57:
+	.string	"kprintf"
+.LASF47:
+	.string	"reserved1"
+.LASF49:
+	.string	"reserved2"
+.LASF53:
+	.string	"hpet_frequency"
+.LASF34:
+	.string	"counter_size"
+.LASF60:
+	.string	"hpet_sleep_counter"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/hpet.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3047 @@
+	.file	"idt.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/idt.c"
+	.p2align 4
+	.globl	_handle_lapic_timer
+	.type	_handle_lapic_timer, @function
+_handle_lapic_timer:
+.LFB37:
+	.file 1 "src/idt.c"
+	.loc 1 110 1 view -0
+	.cfi_startproc
+	.loc 1 111 5 view .LVU1
+.LBB19:
+.LBI19:
+	.file 2 "src/include/cpu.h"
+	.loc 2 326 20 view .LVU2
+.LBB20:
+	.loc 2 328 5 view .LVU3
+.LBE20:
+.LBE19:
+	.loc 1 110 1 is_stmt 0 view .LVU4
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB22:
+.LBB21:
+	.loc 2 328 5 view .LVU5
+#APP
+# 328 "src/include/cpu.h" 1
+	push %r15
+	push %r14
+	push %r13
+	push %r12
+	push %r11
+	push %r10
+	push %r9
+	push %r8
+	push %rbp
+	push %rdi
+	push %rsi
+	push %rdx
+	push %rcx
+	push %rbx
+	push %rax
+	mov %es, %eax
+	push %rax
+	mov %ds, %eax
+	push %rax
+	
+# 0 "" 2
+#NO_APP
+.LBE21:
+.LBE22:
+	.loc 1 112 5 is_stmt 1 view .LVU6
+	.loc 1 112 22 is_stmt 0 view .LVU7
+	movq	kernel_timer_secs(%rip), %rax
+	addq	$1, %rax
+	movq	%rax, kernel_timer_secs(%rip)
+	.loc 1 113 5 is_stmt 1 view .LVU8
+	xorl	%eax, %eax
+	call	lapic_eoi@PLT
+.LVL0:
+	.loc 1 114 5 view .LVU9
+.LBB23:
+.LBI23:
+	.loc 2 357 20 view .LVU10
+.LBB24:
+	.loc 2 359 5 view .LVU11
+#APP
+# 359 "src/include/cpu.h" 1
+	pop %rax
+	mov %eax, %ds
+	pop %rax
+	mov %eax, %es
+	pop %rax
+	pop %rbx
+	pop %rcx
+	pop %rdx
+	pop %rsi
+	pop %rdi
+	pop %rbp
+	pop %r8
+	pop %r9
+	pop %r10
+	pop %r11
+	pop %r12
+	pop %r13
+	pop %r14
+	pop %r15
+	add $8, %rsp
+	iretq
+# 0 "" 2
+#NO_APP
+.LBE24:
+.LBE23:
+	.loc 1 115 1 is_stmt 0 view .LVU12
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	_handle_lapic_timer, .-_handle_lapic_timer
+	.p2align 4
+	.globl	_handle_timer
+	.type	_handle_timer, @function
+_handle_timer:
+.LFB36:
+	.loc 1 98 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 99 5 view .LVU14
+.LBB29:
+.LBI29:
+	.loc 2 326 20 view .LVU15
+.LBB30:
+	.loc 2 328 5 view .LVU16
+.LBE30:
+.LBE29:
+	.loc 1 98 1 is_stmt 0 view .LVU17
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB32:
+.LBB31:
+	.loc 2 328 5 view .LVU18
+#APP
+# 328 "src/include/cpu.h" 1
+	push %r15
+	push %r14
+	push %r13
+	push %r12
+	push %r11
+	push %r10
+	push %r9
+	push %r8
+	push %rbp
+	push %rdi
+	push %rsi
+	push %rdx
+	push %rcx
+	push %rbx
+	push %rax
+	mov %es, %eax
+	push %rax
+	mov %ds, %eax
+	push %rax
+	
+# 0 "" 2
+#NO_APP
+.LBE31:
+.LBE32:
+	.loc 1 100 5 is_stmt 1 view .LVU19
+	xorl	%eax, %eax
+	call	hpet_isr@PLT
+.LVL1:
+	.loc 1 101 5 view .LVU20
+	xorl	%eax, %eax
+	call	hpet_ack@PLT
+.LVL2:
+	.loc 1 102 5 view .LVU21
+	xorl	%eax, %eax
+	call	lapic_eoi@PLT
+.LVL3:
+	.loc 1 103 5 view .LVU22
+.LBB33:
+.LBI33:
+	.loc 2 357 20 view .LVU23
+.LBB34:
+	.loc 2 359 5 view .LVU24
+#APP
+# 359 "src/include/cpu.h" 1
+	pop %rax
+	mov %eax, %ds
+	pop %rax
+	mov %eax, %es
+	pop %rax
+	pop %rbx
+	pop %rcx
+	pop %rdx
+	pop %rsi
+	pop %rdi
+	pop %rbp
+	pop %r8
+	pop %r9
+	pop %r10
+	pop %r11
+	pop %r12
+	pop %r13
+	pop %r14
+	pop %r15
+	add $8, %rsp
+	iretq
+# 0 "" 2
+#NO_APP
+.LBE34:
+.LBE33:
+	.loc 1 104 1 is_stmt 0 view .LVU25
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	_handle_timer, .-_handle_timer
+	.p2align 4
+	.globl	_idt_load
+	.type	_idt_load, @function
+_idt_load:
+.LFB33:
+	.loc 1 45 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 46 5 view .LVU27
+	.loc 1 46 16 is_stmt 0 view .LVU28
+	movl	$4095, %eax
+	movw	%ax, idtp(%rip)
+	.loc 1 47 5 is_stmt 1 view .LVU29
+	.loc 1 47 15 is_stmt 0 view .LVU30
+	leaq	idt(%rip), %rax
+	movq	%rax, 2+idtp(%rip)
+	.loc 1 48 5 is_stmt 1 view .LVU31
+.LVL4:
+.LBB35:
+.LBI35:
+	.loc 2 279 20 view .LVU32
+.LBB36:
+	.loc 2 281 5 view .LVU33
+	leaq	idtp(%rip), %rax
+#APP
+# 281 "src/include/cpu.h" 1
+	lidt (%rax)
+# 0 "" 2
+.LVL5:
+	.loc 2 281 5 is_stmt 0 view .LVU34
+#NO_APP
+.LBE36:
+.LBE35:
+	.loc 1 49 1 view .LVU35
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	_idt_load, .-_idt_load
+	.p2align 4
+	.globl	_idt_set_gate
+	.type	_idt_set_gate, @function
+_idt_set_gate:
+.LVL6:
+.LFB34:
+	.loc 1 53 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 54 5 view .LVU37
+	.loc 1 56 5 view .LVU38
+	.loc 1 56 26 is_stmt 0 view .LVU39
+	movslq	%edi, %rax
+	leaq	idt(%rip), %rdi
+.LVL7:
+	.loc 1 56 26 view .LVU40
+	salq	$4, %rax
+.LVL8:
+	.loc 1 56 26 view .LVU41
+	addq	%rax, %rdi
+	.loc 1 57 48 view .LVU42
+	movq	%rsi, %rax
+	shrq	$16, %rax
+	.loc 1 56 28 view .LVU43
+	movw	%si, (%rdi)
+	.loc 1 57 5 is_stmt 1 view .LVU44
+	.loc 1 58 49 is_stmt 0 view .LVU45
+	shrq	$32, %rsi
+.LVL9:
+	.loc 1 57 28 view .LVU46
+	movw	%ax, 6(%rdi)
+	.loc 1 59 26 view .LVU47
+	movl	$8, %eax
+	.loc 1 58 29 view .LVU48
+	movl	%esi, 8(%rdi)
+	.loc 1 59 26 view .LVU49
+	movw	%ax, 2(%rdi)
+	.loc 1 60 5 is_stmt 1 view .LVU50
+	.loc 1 60 23 is_stmt 0 view .LVU51
+	movb	%dl, 5(%rdi)
+	.loc 1 61 5 is_stmt 1 view .LVU52
+	.loc 1 61 21 is_stmt 0 view .LVU53
+	movb	$0, 4(%rdi)
+	.loc 1 62 5 is_stmt 1 view .LVU54
+	.loc 1 62 26 is_stmt 0 view .LVU55
+	movl	$0, 12(%rdi)
+	.loc 1 63 1 view .LVU56
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	_idt_set_gate, .-_idt_set_gate
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Divide Error Exception"
+.LC1:
+	.string	"Debug Exception"
+.LC2:
+	.string	"NMI Interrupt"
+.LC3:
+	.string	"Breakpoint Exception"
+.LC4:
+	.string	"Overflow Exception"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC5:
+	.string	"BOUND Range Exceeded Exception"
+	.section	.rodata.str1.1
+.LC6:
+	.string	"Invalid Opcode Exception"
+	.section	.rodata.str1.8
+	.align 8
+.LC7:
+	.string	"Device Not Available Exception"
+	.section	.rodata.str1.1
+.LC8:
+	.string	"Double Fault Exception"
+.LC9:
+	.string	"Coprocessor Segment Overrun"
+.LC10:
+	.string	"Invalid TSS Exception"
+.LC11:
+	.string	"Segment Not Present"
+.LC12:
+	.string	"Stack Fault Exception"
+.LC13:
+	.string	"General Protection Exception"
+.LC14:
+	.string	"Page Fault Exception"
+.LC15:
+	.string	"Unknown"
+.LC16:
+	.string	"x87 FPU Floating-Point Error"
+.LC17:
+	.string	"Alignment Check Exception"
+.LC18:
+	.string	"Machine-Check Exception"
+.LC19:
+	.string	"SIMD Floating-Point Exception"
+.LC20:
+	.string	"Virtualization Exception"
+.LC21:
+	.string	"Control Protection Exception"
+.LC22:
+	.string	"**FAULT**: (%lu) %s\n"
+	.text
+	.p2align 4
+	.globl	_handle_fault
+	.type	_handle_fault, @function
+_handle_fault:
+.LVL10:
+.LFB35:
+	.loc 1 66 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 67 5 view .LVU58
+	.loc 1 68 5 view .LVU59
+	.loc 1 66 1 is_stmt 0 view .LVU60
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 272
+	.loc 1 68 20 view .LVU61
+	leaq	.LC0(%rip), %rax
+	.loc 1 66 1 view .LVU62
+	movq	%rdi, %rsi
+	.loc 1 68 20 view .LVU63
+	movq	%rax, (%rsp)
+	.loc 1 69 5 is_stmt 1 view .LVU64
+	.loc 1 69 20 is_stmt 0 view .LVU65
+	leaq	.LC1(%rip), %rax
+	movq	%rax, 8(%rsp)
+	.loc 1 70 5 is_stmt 1 view .LVU66
+	.loc 1 70 20 is_stmt 0 view .LVU67
+	leaq	.LC2(%rip), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 71 5 is_stmt 1 view .LVU68
+	.loc 1 71 20 is_stmt 0 view .LVU69
+	leaq	.LC3(%rip), %rax
+	movq	%rax, 24(%rsp)
+	.loc 1 72 5 is_stmt 1 view .LVU70
+	.loc 1 72 20 is_stmt 0 view .LVU71
+	leaq	.LC4(%rip), %rax
+	movq	%rax, 32(%rsp)
+	.loc 1 73 5 is_stmt 1 view .LVU72
+	.loc 1 73 20 is_stmt 0 view .LVU73
+	leaq	.LC5(%rip), %rax
+	movq	%rax, 40(%rsp)
+	.loc 1 74 5 is_stmt 1 view .LVU74
+	.loc 1 74 20 is_stmt 0 view .LVU75
+	leaq	.LC6(%rip), %rax
+	movq	%rax, 48(%rsp)
+	.loc 1 75 5 is_stmt 1 view .LVU76
+	.loc 1 75 20 is_stmt 0 view .LVU77
+	leaq	.LC7(%rip), %rax
+	movq	%rax, 56(%rsp)
+	.loc 1 76 5 is_stmt 1 view .LVU78
+	.loc 1 76 20 is_stmt 0 view .LVU79
+	leaq	.LC8(%rip), %rax
+	movq	%rax, 64(%rsp)
+	.loc 1 77 5 is_stmt 1 view .LVU80
+	.loc 1 77 20 is_stmt 0 view .LVU81
+	leaq	.LC9(%rip), %rax
+	movq	%rax, 72(%rsp)
+	.loc 1 78 5 is_stmt 1 view .LVU82
+	.loc 1 78 21 is_stmt 0 view .LVU83
+	leaq	.LC10(%rip), %rax
+	movq	%rax, 80(%rsp)
+	.loc 1 79 5 is_stmt 1 view .LVU84
+	.loc 1 79 21 is_stmt 0 view .LVU85
+	leaq	.LC11(%rip), %rax
+	movq	%rax, 88(%rsp)
+	.loc 1 80 5 is_stmt 1 view .LVU86
+	.loc 1 80 21 is_stmt 0 view .LVU87
+	leaq	.LC12(%rip), %rax
+	movq	%rax, 96(%rsp)
+	.loc 1 81 5 is_stmt 1 view .LVU88
+	.loc 1 81 21 is_stmt 0 view .LVU89
+	leaq	.LC13(%rip), %rax
+	movq	%rax, 104(%rsp)
+	.loc 1 82 5 is_stmt 1 view .LVU90
+	.loc 1 82 21 is_stmt 0 view .LVU91
+	leaq	.LC14(%rip), %rax
+	movq	%rax, 112(%rsp)
+	.loc 1 83 5 is_stmt 1 view .LVU92
+	.loc 1 83 21 is_stmt 0 view .LVU93
+	leaq	.LC15(%rip), %rax
+	movq	%rax, 120(%rsp)
+	.loc 1 84 5 is_stmt 1 view .LVU94
+	.loc 1 84 21 is_stmt 0 view .LVU95
+	leaq	.LC16(%rip), %rax
+	movq	%rax, 128(%rsp)
+	.loc 1 85 5 is_stmt 1 view .LVU96
+	.loc 1 85 21 is_stmt 0 view .LVU97
+	leaq	.LC17(%rip), %rax
+	movq	%rax, 136(%rsp)
+	.loc 1 86 5 is_stmt 1 view .LVU98
+	.loc 1 86 21 is_stmt 0 view .LVU99
+	leaq	.LC18(%rip), %rax
+	movq	%rax, 144(%rsp)
+	.loc 1 87 5 is_stmt 1 view .LVU100
+	.loc 1 87 21 is_stmt 0 view .LVU101
+	leaq	.LC19(%rip), %rax
+	movq	%rax, 152(%rsp)
+	.loc 1 88 5 is_stmt 1 view .LVU102
+	.loc 1 88 21 is_stmt 0 view .LVU103
+	leaq	.LC20(%rip), %rax
+	movq	%rax, 160(%rsp)
+	.loc 1 89 5 is_stmt 1 view .LVU104
+	.loc 1 89 21 is_stmt 0 view .LVU105
+	leaq	.LC21(%rip), %rax
+	movq	%rax, 168(%rsp)
+	.loc 1 91 5 is_stmt 1 view .LVU106
+	movq	(%rsp,%rdi,8), %rdx
+	xorl	%eax, %eax
+	leaq	.LC22(%rip), %rdi
+.LVL11:
+	.loc 1 92 1 is_stmt 0 view .LVU107
+	addq	$264, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 91 5 view .LVU108
+	jmp	kprintf@PLT
+.LVL12:
+	.loc 1 91 5 view .LVU109
+	.cfi_endproc
+.LFE35:
+	.size	_handle_fault, .-_handle_fault
+	.p2align 4
+	.globl	_handle_keyboard
+	.type	_handle_keyboard, @function
+_handle_keyboard:
+.LFB38:
+	.loc 1 121 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 122 5 view .LVU111
+	.loc 1 121 1 is_stmt 0 view .LVU112
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 122 19 view .LVU113
+	xorl	%eax, %eax
+	call	ps2_read_no_wait@PLT
+.LVL13:
+	.loc 1 124 5 is_stmt 1 view .LVU114
+	movq	q_keyboard(%rip), %rdi
+	movzbl	%al, %esi
+	call	cqueue_write@PLT
+.LVL14:
+	.loc 1 126 5 view .LVU115
+	xorl	%eax, %eax
+	.loc 1 127 1 is_stmt 0 view .LVU116
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 126 5 view .LVU117
+	jmp	lapic_eoi@PLT
+.LVL15:
+	.cfi_endproc
+.LFE38:
+	.size	_handle_keyboard, .-_handle_keyboard
+	.section	.rodata.str1.1
+.LC24:
+	.string	"Loading IDT at: 0x%X\n"
+	.text
+	.p2align 4
+	.globl	idt_init
+	.type	idt_init, @function
+idt_init:
+.LFB39:
+	.loc 1 130 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 5 view .LVU119
+	.loc 1 130 1 is_stmt 0 view .LVU120
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 131 5 view .LVU121
+	leaq	idt(%rip), %rbx
+	movl	$4096, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	memset@PLT
+.LVL16:
+	.loc 1 133 5 is_stmt 1 view .LVU122
+.LBB50:
+	.loc 1 133 10 view .LVU123
+	.loc 1 133 23 view .LVU124
+	movzwl	.LC23(%rip), %edi
+	leaq	isr_thunks(%rip), %rcx
+.LBE50:
+	.loc 1 131 5 is_stmt 0 view .LVU125
+	movq	%rbx, %rax
+	leaq	512(%rbx), %r8
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+.LBB55:
+	.loc 1 134 9 is_stmt 1 discriminator 3 view .LVU126
+.LBB51:
+.LBI51:
+	.loc 1 52 6 discriminator 3 view .LVU127
+.LBB52:
+	.loc 1 54 5 discriminator 3 view .LVU128
+	.loc 1 54 14 is_stmt 0 discriminator 3 view .LVU129
+	movq	(%rcx), %rdx
+.LVL18:
+	.loc 1 56 5 is_stmt 1 discriminator 3 view .LVU130
+	.loc 1 61 21 is_stmt 0 discriminator 3 view .LVU131
+	movw	%di, 4(%rax)
+.LBE52:
+.LBE51:
+	.loc 1 133 23 discriminator 3 view .LVU132
+	addq	$16, %rax
+	addq	$8, %rcx
+.LVL19:
+.LBB54:
+.LBB53:
+	.loc 1 62 26 discriminator 3 view .LVU133
+	movl	$0, -4(%rax)
+	.loc 1 57 48 discriminator 3 view .LVU134
+	movq	%rdx, %rsi
+	.loc 1 56 28 discriminator 3 view .LVU135
+	movw	%dx, -16(%rax)
+	.loc 1 57 5 is_stmt 1 discriminator 3 view .LVU136
+	.loc 1 58 49 is_stmt 0 discriminator 3 view .LVU137
+	shrq	$32, %rdx
+.LVL20:
+	.loc 1 58 29 discriminator 3 view .LVU138
+	movl	%edx, -8(%rax)
+	.loc 1 57 48 discriminator 3 view .LVU139
+	shrq	$16, %rsi
+.LVL21:
+	.loc 1 59 26 discriminator 3 view .LVU140
+	movl	$8, %edx
+	.loc 1 57 28 discriminator 3 view .LVU141
+	movw	%si, -10(%rax)
+	.loc 1 59 26 discriminator 3 view .LVU142
+	movw	%dx, -14(%rax)
+	.loc 1 60 5 is_stmt 1 discriminator 3 view .LVU143
+	.loc 1 61 5 discriminator 3 view .LVU144
+	.loc 1 62 5 discriminator 3 view .LVU145
+.LVL22:
+	.loc 1 62 5 is_stmt 0 discriminator 3 view .LVU146
+.LBE53:
+.LBE54:
+	.loc 1 133 30 is_stmt 1 discriminator 3 view .LVU147
+	.loc 1 133 23 discriminator 3 view .LVU148
+	cmpq	%rax, %r8
+	jne	.L13
+.LBE55:
+	.loc 1 138 5 view .LVU149
+.LVL23:
+.LBB56:
+.LBI56:
+	.loc 1 52 6 view .LVU150
+.LBB57:
+	.loc 1 54 5 view .LVU151
+	.loc 1 54 14 is_stmt 0 view .LVU152
+	leaq	_handle_timer(%rip), %rax
+.LVL24:
+	.loc 1 56 5 is_stmt 1 view .LVU153
+	.loc 1 59 26 is_stmt 0 view .LVU154
+	movl	$-1912602616, 514+idt(%rip)
+.LBE57:
+.LBE56:
+.LBB61:
+.LBB62:
+	.loc 1 46 16 view .LVU155
+	leaq	idtp(%rip), %rsi
+.LBE62:
+.LBE61:
+.LBB67:
+.LBB58:
+	.loc 1 56 28 view .LVU156
+	movw	%ax, 512+idt(%rip)
+	.loc 1 57 5 is_stmt 1 view .LVU157
+	.loc 1 57 48 is_stmt 0 view .LVU158
+	movq	%rax, %rdx
+	.loc 1 58 49 view .LVU159
+	shrq	$32, %rax
+	.loc 1 58 29 view .LVU160
+	movl	%eax, 520+idt(%rip)
+	.loc 1 60 5 is_stmt 1 view .LVU161
+	.loc 1 61 5 view .LVU162
+	.loc 1 62 5 view .LVU163
+	.loc 1 57 48 is_stmt 0 view .LVU164
+	shrq	$16, %rdx
+.LBE58:
+.LBE67:
+.LBB68:
+.LBB69:
+	.loc 1 54 14 view .LVU165
+	movq	ISR_Handler_PS2@GOTPCREL(%rip), %rax
+.LBE69:
+.LBE68:
+.LBB73:
+.LBB59:
+	.loc 1 57 28 view .LVU166
+	movw	%dx, 518+idt(%rip)
+.LBE59:
+.LBE73:
+.LBB74:
+.LBB70:
+	.loc 1 56 28 view .LVU167
+	movw	%ax, 528+idt(%rip)
+	.loc 1 57 48 view .LVU168
+	movq	%rax, %rdx
+	.loc 1 58 49 view .LVU169
+	shrq	$32, %rax
+	.loc 1 57 48 view .LVU170
+	shrq	$16, %rdx
+	.loc 1 58 29 view .LVU171
+	movl	%eax, 536+idt(%rip)
+.LBE70:
+.LBE74:
+.LBB75:
+.LBB76:
+	.loc 1 54 14 view .LVU172
+	leaq	_handle_lapic_timer(%rip), %rax
+.LBE76:
+.LBE75:
+.LBB79:
+.LBB71:
+	.loc 1 57 28 view .LVU173
+	movw	%dx, 534+idt(%rip)
+.LBE71:
+.LBE79:
+.LBB80:
+.LBB77:
+	.loc 1 57 48 view .LVU174
+	movq	%rax, %rdx
+	.loc 1 56 28 view .LVU175
+	movw	%ax, 560+idt(%rip)
+	.loc 1 58 49 view .LVU176
+	shrq	$32, %rax
+	.loc 1 57 48 view .LVU177
+	shrq	$16, %rdx
+	.loc 1 58 29 view .LVU178
+	movl	%eax, 568+idt(%rip)
+.LBE77:
+.LBE80:
+.LBB81:
+.LBB65:
+	.loc 1 46 16 view .LVU179
+	movl	$4095, %eax
+.LBE65:
+.LBE81:
+.LBB82:
+.LBB60:
+	.loc 1 62 26 view .LVU180
+	movl	$0, 524+idt(%rip)
+.LVL25:
+	.loc 1 62 26 view .LVU181
+.LBE60:
+.LBE82:
+	.loc 1 139 5 is_stmt 1 view .LVU182
+.LBB83:
+.LBI68:
+	.loc 1 52 6 view .LVU183
+.LBB72:
+	.loc 1 54 5 view .LVU184
+	.loc 1 56 5 view .LVU185
+	.loc 1 57 5 view .LVU186
+	.loc 1 60 5 view .LVU187
+	.loc 1 61 5 view .LVU188
+	.loc 1 59 26 is_stmt 0 view .LVU189
+	movl	$-1912602616, 530+idt(%rip)
+	.loc 1 62 5 is_stmt 1 view .LVU190
+	.loc 1 62 26 is_stmt 0 view .LVU191
+	movl	$0, 540+idt(%rip)
+.LVL26:
+	.loc 1 62 26 view .LVU192
+.LBE72:
+.LBE83:
+	.loc 1 140 5 is_stmt 1 view .LVU193
+.LBB84:
+.LBI75:
+	.loc 1 52 6 view .LVU194
+.LBB78:
+	.loc 1 54 5 view .LVU195
+	.loc 1 56 5 view .LVU196
+	.loc 1 57 5 view .LVU197
+	.loc 1 60 5 view .LVU198
+	.loc 1 61 5 view .LVU199
+	.loc 1 57 28 is_stmt 0 view .LVU200
+	movw	%dx, 566+idt(%rip)
+	.loc 1 59 26 view .LVU201
+	movl	$-1912602616, 562+idt(%rip)
+	.loc 1 62 5 is_stmt 1 view .LVU202
+	.loc 1 62 26 is_stmt 0 view .LVU203
+	movl	$0, 572+idt(%rip)
+.LVL27:
+	.loc 1 62 26 view .LVU204
+.LBE78:
+.LBE84:
+	.loc 1 142 5 is_stmt 1 view .LVU205
+.LBB85:
+.LBI61:
+	.loc 1 44 6 view .LVU206
+.LBB66:
+	.loc 1 46 5 view .LVU207
+	.loc 1 46 16 is_stmt 0 view .LVU208
+	movw	%ax, idtp(%rip)
+	.loc 1 47 5 is_stmt 1 view .LVU209
+	.loc 1 47 15 is_stmt 0 view .LVU210
+	movq	%rbx, 2+idtp(%rip)
+	.loc 1 48 5 is_stmt 1 view .LVU211
+.LVL28:
+.LBB63:
+.LBI63:
+	.loc 2 279 20 view .LVU212
+.LBB64:
+	.loc 2 281 5 view .LVU213
+#APP
+# 281 "src/include/cpu.h" 1
+	lidt (%rsi)
+# 0 "" 2
+.LVL29:
+	.loc 2 281 5 is_stmt 0 view .LVU214
+#NO_APP
+.LBE64:
+.LBE63:
+.LBE66:
+.LBE85:
+	.loc 1 143 5 is_stmt 1 view .LVU215
+	leaq	.LC24(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 144 1 is_stmt 0 view .LVU216
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	.loc 1 143 5 view .LVU217
+	jmp	kprintf@PLT
+.LVL30:
+	.cfi_endproc
+.LFE39:
+	.size	idt_init, .-idt_init
+	.globl	kernel_timer_secs
+	.bss
+	.align 8
+	.type	kernel_timer_secs, @object
+	.size	kernel_timer_secs, 8
+kernel_timer_secs:
+	.zero	8
+	.globl	idtp
+	.align 8
+	.type	idtp, @object
+	.size	idtp, 10
+idtp:
+	.zero	10
+	.globl	idt
+	.align 32
+	.type	idt, @object
+	.size	idt, 4096
+idt:
+	.zero	4096
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC23:
+	.byte	0
+	.byte	-114
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "src/include/idt.h"
+	.file 6 "src/include/atomic.h"
+	.file 7 "src/include/queue.h"
+	.file 8 "src/kernel.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "src/include/lapic.h"
+	.file 11 "src/include/hpet.h"
+	.file 12 "src/include/ps2.h"
+	.file 13 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x797
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF55
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.long	.LASF6
+	.byte	0x3
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x5
+	.long	.LASF7
+	.byte	0x3
+	.byte	0x31
+	.byte	0x1c
+	.long	0x69
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x34
+	.byte	0x16
+	.long	0x81
+	.uleb128 0x12
+	.long	0x70
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x37
+	.byte	0x1b
+	.long	0x99
+	.uleb128 0x12
+	.long	0x88
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x99
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF14
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF15
+	.uleb128 0x13
+	.long	.LASF22
+	.byte	0x10
+	.byte	0x1e
+	.long	0x121
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x20
+	.byte	0xe
+	.long	0x5d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x21
+	.byte	0xe
+	.long	0x5d
+	.byte	0x2
+	.uleb128 0x14
+	.string	"ist"
+	.byte	0x5
+	.byte	0x22
+	.byte	0xd
+	.long	0x4a
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x23
+	.byte	0xd
+	.long	0x4a
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x24
+	.byte	0xe
+	.long	0x5d
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x25
+	.byte	0xe
+	.long	0x70
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x26
+	.byte	0xe
+	.long	0x70
+	.byte	0xc
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF23
+	.byte	0xa
+	.byte	0x29
+	.long	0x147
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.long	0x5d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xe
+	.long	0x88
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x39
+	.byte	0x1a
+	.long	0x94
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0xe
+	.long	0x161
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF26
+	.uleb128 0x22
+	.long	0x15a
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF27
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.byte	0x17
+	.long	0x183
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x18
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x6
+	.byte	0x19
+	.byte	0x3
+	.long	0x16d
+	.uleb128 0x15
+	.byte	0x19
+	.byte	0x7
+	.byte	0x19
+	.long	0x1e6
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x17
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x17
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x1c
+	.byte	0xf
+	.long	0x1e6
+	.byte	0x8
+	.uleb128 0x14
+	.string	"len"
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xe
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x17
+	.long	0x7c
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x10
+	.long	0x183
+	.byte	0x18
+	.byte	0
+	.uleb128 0xe
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x20
+	.byte	0x1b
+	.long	0x18f
+	.uleb128 0xd
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x23
+	.byte	0x12
+	.long	0x203
+	.uleb128 0xe
+	.long	0x1eb
+	.uleb128 0xf
+	.long	0xba
+	.long	0x218
+	.uleb128 0x16
+	.long	0x99
+	.byte	0xff
+	.byte	0
+	.uleb128 0x23
+	.string	"idt"
+	.byte	0x1
+	.byte	0x22
+	.byte	0x12
+	.long	0x208
+	.uleb128 0x9
+	.byte	0x3
+	.quad	idt
+	.uleb128 0x24
+	.long	.LASF37
+	.byte	0x1
+	.byte	0x23
+	.byte	0x10
+	.long	0x121
+	.uleb128 0x9
+	.byte	0x3
+	.quad	idtp
+	.uleb128 0x25
+	.long	0x147
+	.byte	0x1
+	.byte	0x26
+	.byte	0x13
+	.uleb128 0x9
+	.byte	0x3
+	.quad	kernel_timer_secs
+	.uleb128 0xf
+	.long	0x153
+	.long	0x261
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF38
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xe
+	.long	0x256
+	.uleb128 0x27
+	.long	.LASF56
+	.byte	0x1
+	.byte	0x28
+	.byte	0xd
+	.uleb128 0x17
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xe
+	.long	0x153
+	.long	0x295
+	.uleb128 0x6
+	.long	0x153
+	.uleb128 0x6
+	.long	0x3c
+	.uleb128 0x6
+	.long	0xa0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF40
+	.byte	0x7
+	.byte	0x23
+	.byte	0xc
+	.long	0x166
+	.long	0x2b0
+	.uleb128 0x6
+	.long	0x203
+	.uleb128 0x6
+	.long	0x70
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF44
+	.byte	0xc
+	.byte	0x27
+	.byte	0x9
+	.long	0x4a
+	.long	0x2c2
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF41
+	.byte	0xa
+	.byte	0x18
+	.long	0x2cf
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF42
+	.byte	0xb
+	.byte	0x19
+	.long	0x2dc
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF43
+	.byte	0xb
+	.byte	0x1a
+	.long	0x2e9
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF45
+	.byte	0xd
+	.byte	0x30
+	.byte	0x6
+	.long	0x2fc
+	.uleb128 0x6
+	.long	0x155
+	.uleb128 0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF46
+	.byte	0x81
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f2
+	.uleb128 0x2a
+	.long	.LLRL8
+	.long	0x37b
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x85
+	.byte	0xe
+	.long	0x3c
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2b
+	.long	0x6a1
+	.quad	.LBI51
+	.byte	.LVU127
+	.long	.LLRL10
+	.byte	0x1
+	.byte	0x86
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x6c2
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2
+	.long	0x6b8
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x19
+	.long	0x6ae
+	.uleb128 0xa
+	.long	.LLRL10
+	.uleb128 0xb
+	.long	0x6cc
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6a1
+	.quad	.LBI56
+	.byte	.LVU150
+	.long	.LLRL14
+	.byte	0x8a
+	.long	0x3cd
+	.uleb128 0x2
+	.long	0x6c2
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	0x6b8
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	0x6ae
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xa
+	.long	.LLRL14
+	.uleb128 0xb
+	.long	0x6cc
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6d9
+	.quad	.LBI61
+	.byte	.LVU206
+	.long	.LLRL19
+	.byte	0x8e
+	.long	0x411
+	.uleb128 0x1a
+	.long	0x6f0
+	.quad	.LBI63
+	.byte	.LVU212
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.uleb128 0x2
+	.long	0x6fe
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6a1
+	.quad	.LBI68
+	.byte	.LVU183
+	.long	.LLRL21
+	.byte	0x8b
+	.long	0x453
+	.uleb128 0x2
+	.long	0x6c2
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x19
+	.long	0x6b8
+	.uleb128 0x2
+	.long	0x6ae
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xa
+	.long	.LLRL21
+	.uleb128 0x2c
+	.long	0x6cc
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6a1
+	.quad	.LBI75
+	.byte	.LVU194
+	.long	.LLRL24
+	.byte	0x8c
+	.long	0x4a5
+	.uleb128 0x2
+	.long	0x6c2
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	0x6b8
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2
+	.long	0x6ae
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xa
+	.long	.LLRL24
+	.uleb128 0xb
+	.long	0x6cc
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.quad	.LVL16
+	.long	0x275
+	.long	0x4c9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL30
+	.long	0x2e9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	idtp
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF47
+	.byte	0x78
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x549
+	.uleb128 0x18
+	.string	"key"
+	.byte	0x7a
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x7
+	.quad	.LVL13
+	.long	0x2b0
+	.uleb128 0x7
+	.quad	.LVL14
+	.long	0x295
+	.uleb128 0x2e
+	.quad	.LVL15
+	.long	0x2c2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF48
+	.byte	0x6d
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5a5
+	.uleb128 0x1c
+	.long	0x6e9
+	.quad	.LBI19
+	.byte	.LVU2
+	.long	.LLRL0
+	.byte	0x6f
+	.uleb128 0x1d
+	.long	0x6e2
+	.quad	.LBI23
+	.byte	.LVU10
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.byte	0x72
+	.uleb128 0x7
+	.quad	.LVL0
+	.long	0x2c2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF49
+	.byte	0x61
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x61b
+	.uleb128 0x1c
+	.long	0x6e9
+	.quad	.LBI29
+	.byte	.LVU15
+	.long	.LLRL1
+	.byte	0x63
+	.uleb128 0x1d
+	.long	0x6e2
+	.quad	.LBI33
+	.byte	.LVU23
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.byte	0x67
+	.uleb128 0x7
+	.quad	.LVL1
+	.long	0x2dc
+	.uleb128 0x7
+	.quad	.LVL2
+	.long	0x2cf
+	.uleb128 0x7
+	.quad	.LVL3
+	.long	0x2c2
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF57
+	.byte	0x1
+	.byte	0x41
+	.byte	0x6
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x691
+	.uleb128 0x30
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x41
+	.byte	0x1d
+	.long	0x88
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x31
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x43
+	.byte	0x11
+	.long	0x691
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x1b
+	.quad	.LVL12
+	.long	0x2e9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xd
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x33
+	.byte	0x24
+	.byte	0x91
+	.sleb128 0
+	.byte	0x22
+	.byte	0xa
+	.value	0x110
+	.byte	0x1c
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x155
+	.long	0x6a1
+	.uleb128 0x16
+	.long	0x99
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF50
+	.byte	0x1
+	.byte	0x34
+	.byte	0x6
+	.byte	0x1
+	.long	0x6d9
+	.uleb128 0x11
+	.long	.LASF51
+	.byte	0x18
+	.long	0x3c
+	.uleb128 0x11
+	.long	.LASF52
+	.byte	0x26
+	.long	0x153
+	.uleb128 0x11
+	.long	.LASF18
+	.byte	0x37
+	.long	0x4a
+	.uleb128 0x33
+	.long	.LASF59
+	.byte	0x1
+	.byte	0x36
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF60
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x1e
+	.long	.LASF53
+	.value	0x165
+	.uleb128 0x1e
+	.long	.LASF54
+	.value	0x146
+	.uleb128 0x35
+	.long	.LASF61
+	.byte	0x2
+	.value	0x117
+	.byte	0x14
+	.byte	0x3
+	.long	0x70c
+	.uleb128 0x36
+	.long	.LASF23
+	.byte	0x2
+	.value	0x117
+	.byte	0x1f
+	.long	0x153
+	.byte	0
+	.uleb128 0x37
+	.long	0x6d9
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x754
+	.uleb128 0x1a
+	.long	0x6f0
+	.quad	.LBI35
+	.byte	.LVU32
+	.quad	.LBB35
+	.quad	.LBE35-.LBB35
+	.uleb128 0x2
+	.long	0x6fe
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	0x6a1
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	0x6ae
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2
+	.long	0x6b8
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x39
+	.long	0x6c2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xb
+	.long	0x6cc
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 52
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 48
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS9:
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU127
+	.uleb128 .LVU146
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x8e
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU127
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU146
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 -8
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU146
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 -8
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU150
+	.uleb128 .LVU181
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x8e
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU150
+	.uleb128 .LVU181
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_handle_timer
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU150
+	.uleb128 .LVU181
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU153
+	.uleb128 .LVU181
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_handle_timer
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU212
+	.uleb128 .LVU214
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	idtp
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU183
+	.uleb128 .LVU192
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x8e
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU183
+	.uleb128 .LVU192
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU194
+	.uleb128 .LVU204
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x8e
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU194
+	.uleb128 .LVU204
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_handle_lapic_timer
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU194
+	.uleb128 .LVU204
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x23
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU196
+	.uleb128 .LVU204
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_handle_lapic_timer
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU114
+	.uleb128 .LVU115
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	idtp
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU38
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB22-.Ltext0
+	.uleb128 .LBE22-.Ltext0
+	.byte	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF36:
+	.string	"q_keyboard"
+.LASF24:
+	.string	"limit"
+.LASF46:
+	.string	"idt_init"
+.LASF19:
+	.string	"base_mid"
+.LASF23:
+	.string	"idt_ptr"
+.LASF59:
+	.string	"ihandler"
+.LASF11:
+	.string	"uint64_t"
+.LASF3:
+	.string	"short int"
+.LASF13:
+	.string	"size_t"
+.LASF45:
+	.string	"kprintf"
+.LASF32:
+	.string	"buff"
+.LASF52:
+	.string	"handler"
+.LASF6:
+	.string	"uint8_t"
+.LASF44:
+	.string	"ps2_read_no_wait"
+.LASF31:
+	.string	"write_i"
+.LASF49:
+	.string	"_handle_timer"
+.LASF54:
+	.string	"isr_save"
+.LASF14:
+	.string	"long long int"
+.LASF47:
+	.string	"_handle_keyboard"
+.LASF56:
+	.string	"ISR_Handler_PS2"
+.LASF4:
+	.string	"long int"
+.LASF57:
+	.string	"_handle_fault"
+.LASF55:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF58:
+	.string	"fault_names"
+.LASF42:
+	.string	"hpet_ack"
+.LASF15:
+	.string	"long double"
+.LASF53:
+	.string	"isr_restore"
+.LASF5:
+	.string	"unsigned char"
+.LASF17:
+	.string	"selector"
+.LASF33:
+	.string	"num_items"
+.LASF2:
+	.string	"signed char"
+.LASF18:
+	.string	"flags"
+.LASF21:
+	.string	"reserved"
+.LASF9:
+	.string	"uint32_t"
+.LASF38:
+	.string	"isr_thunks"
+.LASF10:
+	.string	"unsigned int"
+.LASF7:
+	.string	"uint16_t"
+.LASF51:
+	.string	"vector"
+.LASF41:
+	.string	"lapic_eoi"
+.LASF35:
+	.string	"kernel_timer_secs"
+.LASF50:
+	.string	"_idt_set_gate"
+.LASF8:
+	.string	"short unsigned int"
+.LASF26:
+	.string	"char"
+.LASF61:
+	.string	"lidt"
+.LASF28:
+	.string	"lock"
+.LASF27:
+	.string	"_Bool"
+.LASF20:
+	.string	"base_high"
+.LASF34:
+	.string	"CQueue_t"
+.LASF37:
+	.string	"idtp"
+.LASF40:
+	.string	"cqueue_write"
+.LASF12:
+	.string	"long unsigned int"
+.LASF43:
+	.string	"hpet_isr"
+.LASF30:
+	.string	"read_i"
+.LASF60:
+	.string	"_idt_load"
+.LASF16:
+	.string	"base_low"
+.LASF39:
+	.string	"memset"
+.LASF48:
+	.string	"_handle_lapic_timer"
+.LASF25:
+	.string	"base"
+.LASF22:
+	.string	"idt_entry"
+.LASF29:
+	.string	"spinlock_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"src/idt.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
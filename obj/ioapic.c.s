@@ -0,0 +1,2601 @@
+	.file	"ioapic.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/ioapic.c"
+	.p2align 4
+	.globl	ioapic_write
+	.type	ioapic_write, @function
+ioapic_write:
+.LVL0:
+.LFB0:
+	.file 1 "src/ioapic.c"
+	.loc 1 29 1 view -0
+	.cfi_startproc
+	.loc 1 30 5 view .LVU1
+	.loc 1 30 21 is_stmt 0 view .LVU2
+	movl	4(%rdi), %eax
+	.loc 1 33 31 view .LVU3
+	movzbl	%sil, %esi
+	.loc 1 30 14 view .LVU4
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL1:
+	.loc 1 33 5 is_stmt 1 view .LVU5
+	.loc 1 33 31 is_stmt 0 view .LVU6
+	movl	%esi, (%rax)
+	.loc 1 36 5 is_stmt 1 view .LVU7
+	.loc 1 36 40 is_stmt 0 view .LVU8
+	movl	%edx, 16(%rax)
+	.loc 1 37 1 view .LVU9
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	ioapic_write, .-ioapic_write
+	.p2align 4
+	.globl	ioapic_read
+	.type	ioapic_read, @function
+ioapic_read:
+.LVL2:
+.LFB1:
+	.loc 1 43 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 44 5 view .LVU11
+	.loc 1 44 21 is_stmt 0 view .LVU12
+	movl	4(%rdi), %eax
+	.loc 1 47 33 view .LVU13
+	movzbl	%sil, %esi
+	.loc 1 44 14 view .LVU14
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL3:
+	.loc 1 47 5 is_stmt 1 view .LVU15
+	.loc 1 47 33 is_stmt 0 view .LVU16
+	movl	%esi, (%rax)
+	.loc 1 50 5 is_stmt 1 view .LVU17
+	.loc 1 50 12 is_stmt 0 view .LVU18
+	movl	16(%rax), %eax
+.LVL4:
+	.loc 1 51 1 view .LVU19
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	ioapic_read, .-ioapic_read
+	.p2align 4
+	.globl	_get_ioapic_from_gsi
+	.type	_get_ioapic_from_gsi, @function
+_get_ioapic_from_gsi:
+.LVL5:
+.LFB3:
+	.loc 1 66 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 67 5 view .LVU21
+.LBB14:
+	.loc 1 67 10 view .LVU22
+	.loc 1 67 23 view .LVU23
+	leaq	ioapic_list(%rip), %rax
+.LBB15:
+.LBB16:
+.LBB17:
+.LBB18:
+.LBB19:
+	.loc 1 44 50 is_stmt 0 view .LVU24
+	movq	vmm_higher_half_offset(%rip), %r10
+.LBE19:
+.LBE18:
+.LBE17:
+.LBE16:
+	.loc 1 74 45 view .LVU25
+	movl	%edi, %r9d
+	leaq	256(%rax), %r8
+	jmp	.L7
+.LVL6:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.loc 1 74 9 is_stmt 1 view .LVU26
+	.loc 1 74 27 is_stmt 0 view .LVU27
+	movl	8(%rcx), %esi
+	.loc 1 74 12 view .LVU28
+	cmpl	%esi, %edi
+	jb	.L9
+.LVL7:
+.LBB23:
+.LBI16:
+	.loc 1 56 17 is_stmt 1 discriminator 1 view .LVU29
+.LBB22:
+	.loc 1 58 5 discriminator 1 view .LVU30
+.LBB21:
+.LBI18:
+	.loc 1 42 10 discriminator 1 view .LVU31
+.LBB20:
+	.loc 1 44 5 discriminator 1 view .LVU32
+	.loc 1 44 21 is_stmt 0 discriminator 1 view .LVU33
+	movl	4(%rcx), %edx
+	.loc 1 44 14 discriminator 1 view .LVU34
+	addq	%r10, %rdx
+.LVL8:
+	.loc 1 47 5 is_stmt 1 discriminator 1 view .LVU35
+	.loc 1 47 33 is_stmt 0 discriminator 1 view .LVU36
+	movl	$1, (%rdx)
+	.loc 1 50 5 is_stmt 1 discriminator 1 view .LVU37
+	.loc 1 50 12 is_stmt 0 discriminator 1 view .LVU38
+	movl	16(%rdx), %edx
+.LVL9:
+	.loc 1 50 12 discriminator 1 view .LVU39
+.LBE20:
+.LBE21:
+	.loc 1 59 5 is_stmt 1 discriminator 1 view .LVU40
+	.loc 1 58 60 is_stmt 0 discriminator 1 view .LVU41
+	shrl	$16, %edx
+	.loc 1 58 14 discriminator 1 view .LVU42
+	movzbl	%dl, %edx
+.LBE22:
+.LBE23:
+	.loc 1 74 65 discriminator 1 view .LVU43
+	addq	%rsi, %rdx
+	.loc 1 74 38 discriminator 1 view .LVU44
+	cmpq	%rdx, %r9
+	jb	.L4
+.L9:
+	.loc 1 74 38 discriminator 1 view .LVU45
+.LBE15:
+	.loc 1 67 30 is_stmt 1 view .LVU46
+.LVL10:
+	.loc 1 67 23 view .LVU47
+	addq	$8, %rax
+.LVL11:
+	.loc 1 67 23 is_stmt 0 view .LVU48
+	cmpq	%r8, %rax
+	je	.L5
+.LVL12:
+.L7:
+.LBB24:
+	.loc 1 68 9 is_stmt 1 view .LVU49
+	.loc 1 68 24 is_stmt 0 view .LVU50
+	movq	(%rax), %rcx
+.LVL13:
+	.loc 1 71 9 is_stmt 1 view .LVU51
+	.loc 1 71 12 is_stmt 0 view .LVU52
+	testq	%rcx, %rcx
+	jne	.L14
+.LVL14:
+.L5:
+	.loc 1 72 19 view .LVU53
+	xorl	%ecx, %ecx
+.LVL15:
+.L4:
+	.loc 1 72 19 view .LVU54
+.LBE24:
+.LBE14:
+	.loc 1 80 1 view .LVU55
+	movq	%rcx, %rax
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	_get_ioapic_from_gsi, .-_get_ioapic_from_gsi
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Applied I/O APIC redirect: Vector %d, GSI %d.\n"
+	.text
+	.p2align 4
+	.globl	_ioapic_redirect_gsi
+	.type	_ioapic_redirect_gsi, @function
+_ioapic_redirect_gsi:
+.LVL16:
+.LFB4:
+	.loc 1 86 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 87 5 view .LVU57
+	.loc 1 86 1 is_stmt 0 view .LVU58
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%edi, %r11d
+	.loc 1 87 30 view .LVU59
+	movzbl	%dl, %edi
+.LVL17:
+	.loc 1 86 1 view .LVU60
+	movl	%r8d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%ecx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 86 1 view .LVU61
+	movl	%esi, %ebx
+	.loc 1 87 30 view .LVU62
+	call	_get_ioapic_from_gsi
+.LVL18:
+.LBB25:
+.LBB26:
+	.loc 1 30 50 view .LVU63
+	movq	vmm_higher_half_offset(%rip), %r8
+.LBE26:
+.LBE25:
+	.loc 1 87 30 view .LVU64
+	movq	%rax, %rsi
+.LVL19:
+	.loc 1 89 5 is_stmt 1 view .LVU65
+	.loc 1 89 14 is_stmt 0 view .LVU66
+	movzbl	%bl, %eax
+.LVL20:
+	.loc 1 92 5 is_stmt 1 view .LVU67
+	.loc 1 93 18 is_stmt 0 view .LVU68
+	movq	%rax, %rdx
+.LBB32:
+.LBB27:
+	.loc 1 30 21 view .LVU69
+	movl	4(%rsi), %ecx
+.LBE27:
+.LBE32:
+	.loc 1 93 18 view .LVU70
+	orb	$32, %dh
+	testb	$2, %bpl
+	cmovne	%rdx, %rax
+.LVL21:
+	.loc 1 97 5 is_stmt 1 view .LVU71
+	.loc 1 98 18 is_stmt 0 view .LVU72
+	movq	%rax, %rdx
+	orb	$-128, %dh
+	andl	$8, %ebp
+	cmovne	%rdx, %rax
+.LVL22:
+	.loc 1 102 5 is_stmt 1 view .LVU73
+	.loc 1 103 18 is_stmt 0 view .LVU74
+	movq	%rax, %rdx
+	orq	$65536, %rdx
+	testb	%r12b, %r12b
+	cmove	%rdx, %rax
+.LVL23:
+	.loc 1 107 5 is_stmt 1 view .LVU75
+	.loc 1 110 68 is_stmt 0 view .LVU76
+	movl	%edi, %edx
+	subl	8(%rsi), %edx
+	.loc 1 107 36 view .LVU77
+	salq	$56, %r11
+.LVL24:
+	.loc 1 110 14 view .LVU78
+	leal	16(%rdx,%rdx), %edx
+.LBB33:
+.LBB28:
+	.loc 1 30 14 view .LVU79
+	addq	%r8, %rcx
+.LBE28:
+.LBE33:
+	.loc 1 107 14 view .LVU80
+	orq	%r11, %rax
+.LVL25:
+	.loc 1 110 5 is_stmt 1 view .LVU81
+	.loc 1 113 5 view .LVU82
+	movzbl	%dl, %r9d
+.LVL26:
+.LBB34:
+.LBI25:
+	.loc 1 28 6 view .LVU83
+.LBB29:
+	.loc 1 30 5 view .LVU84
+	.loc 1 33 5 view .LVU85
+.LBE29:
+.LBE34:
+	.loc 1 114 49 is_stmt 0 view .LVU86
+	addl	$1, %edx
+.LVL27:
+.LBB35:
+.LBB30:
+	.loc 1 33 31 view .LVU87
+	movl	%r9d, (%rcx)
+	.loc 1 36 5 is_stmt 1 view .LVU88
+.LBE30:
+.LBE35:
+.LBB36:
+.LBB37:
+	.loc 1 33 31 is_stmt 0 view .LVU89
+	movzbl	%dl, %edx
+.LVL28:
+	.loc 1 33 31 view .LVU90
+.LBE37:
+.LBE36:
+.LBB42:
+.LBB31:
+	.loc 1 36 40 view .LVU91
+	movl	%eax, 16(%rcx)
+.LVL29:
+	.loc 1 36 40 view .LVU92
+.LBE31:
+.LBE42:
+	.loc 1 114 5 is_stmt 1 view .LVU93
+.LBB43:
+.LBB38:
+	.loc 1 30 21 is_stmt 0 view .LVU94
+	movl	4(%rsi), %ecx
+.LBE38:
+.LBE43:
+	.loc 1 114 74 view .LVU95
+	shrq	$32, %rax
+.LVL30:
+.LBB44:
+.LBI36:
+	.loc 1 28 6 is_stmt 1 view .LVU96
+.LBB39:
+	.loc 1 30 5 view .LVU97
+.LBE39:
+.LBE44:
+	.loc 1 116 5 is_stmt 0 view .LVU98
+	movzbl	%bl, %esi
+.LVL31:
+.LBB45:
+.LBB40:
+	.loc 1 30 14 view .LVU99
+	addq	%r8, %rcx
+.LVL32:
+	.loc 1 33 5 is_stmt 1 view .LVU100
+	.loc 1 33 31 is_stmt 0 view .LVU101
+	movl	%edx, (%rcx)
+	.loc 1 36 5 is_stmt 1 view .LVU102
+.LBE40:
+.LBE45:
+	.loc 1 116 5 is_stmt 0 view .LVU103
+	movl	%edi, %edx
+	leaq	.LC0(%rip), %rdi
+.LVL33:
+.LBB46:
+.LBB41:
+	.loc 1 36 40 view .LVU104
+	movl	%eax, 16(%rcx)
+.LVL34:
+	.loc 1 36 40 view .LVU105
+.LBE41:
+.LBE46:
+	.loc 1 116 5 is_stmt 1 view .LVU106
+	xorl	%eax, %eax
+	.loc 1 117 1 is_stmt 0 view .LVU107
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	.loc 1 116 5 view .LVU108
+	jmp	kprintf@PLT
+.LVL35:
+	.loc 1 116 5 view .LVU109
+	.cfi_endproc
+.LFE4:
+	.size	_ioapic_redirect_gsi, .-_ioapic_redirect_gsi
+	.section	.rodata.str1.8
+	.align 8
+.LC1:
+	.string	"I/O APIC using override from %d to %d.\n"
+	.text
+	.p2align 4
+	.globl	ioapic_redirect_irq
+	.type	ioapic_redirect_irq, @function
+ioapic_redirect_irq:
+.LVL36:
+.LFB5:
+	.loc 1 124 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 125 5 view .LVU111
+.LBB47:
+	.loc 1 125 10 view .LVU112
+	.loc 1 125 23 view .LVU113
+.LBE47:
+	.loc 1 124 1 is_stmt 0 view .LVU114
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	iso_list(%rip), %rax
+	movl	%ecx, %r13d
+	movl	%edx, %ecx
+.LVL37:
+	.loc 1 124 1 view .LVU115
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp
+	leaq	1024(%rax), %rdi
+.LVL38:
+	.loc 1 124 1 view .LVU116
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	jmp	.L27
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+.LBB51:
+.LBB48:
+	.loc 1 133 9 is_stmt 1 view .LVU117
+	.loc 1 133 12 is_stmt 0 view .LVU118
+	cmpb	%cl, 3(%rbx)
+	je	.L34
+	.loc 1 133 12 view .LVU119
+.LBE48:
+	.loc 1 125 31 is_stmt 1 discriminator 2 view .LVU120
+.LVL40:
+	.loc 1 125 23 discriminator 2 view .LVU121
+	addq	$8, %rax
+.LVL41:
+	.loc 1 125 23 is_stmt 0 discriminator 2 view .LVU122
+	cmpq	%rdi, %rax
+	je	.L25
+.LVL42:
+.L27:
+.LBB49:
+	.loc 1 126 9 is_stmt 1 view .LVU123
+	.loc 1 126 21 is_stmt 0 view .LVU124
+	movq	(%rax), %rbx
+.LVL43:
+	.loc 1 127 9 is_stmt 1 view .LVU125
+	.loc 1 127 12 is_stmt 0 view .LVU126
+	testq	%rbx, %rbx
+	jne	.L35
+.LVL44:
+.L25:
+	.loc 1 127 12 view .LVU127
+.LBE49:
+.LBE51:
+	.loc 1 141 5 is_stmt 1 view .LVU128
+	movzbl	%dl, %edx
+.LVL45:
+	.loc 1 141 5 is_stmt 0 view .LVU129
+	movzbl	%r12b, %esi
+.LVL46:
+	.loc 1 141 5 view .LVU130
+	movzbl	%r13b, %r8d
+	xorl	%ecx, %ecx
+.LVL47:
+.L33:
+	.loc 1 142 1 view .LVU131
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 141 5 view .LVU132
+	movl	%ebp, %edi
+	.loc 1 142 1 view .LVU133
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL48:
+	.loc 1 142 1 view .LVU134
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL49:
+	.loc 1 142 1 view .LVU135
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	.loc 1 141 5 view .LVU136
+	jmp	_ioapic_redirect_gsi
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+.LBB52:
+.LBB50:
+	.loc 1 134 13 is_stmt 1 view .LVU137
+	movzbl	%dl, %esi
+.LVL51:
+	.loc 1 134 13 is_stmt 0 view .LVU138
+	movl	4(%rbx), %edx
+.LVL52:
+	.loc 1 134 13 view .LVU139
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+.LVL53:
+	.loc 1 134 13 view .LVU140
+	call	kprintf@PLT
+.LVL54:
+	.loc 1 135 13 is_stmt 1 view .LVU141
+	movzwl	8(%rbx), %ecx
+	movzbl	4(%rbx), %edx
+	movzbl	%r12b, %esi
+	movzbl	%r13b, %r8d
+	jmp	.L33
+.LBE50:
+.LBE52:
+	.cfi_endproc
+.LFE5:
+	.size	ioapic_redirect_irq, .-ioapic_redirect_irq
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 3 "src/include/acpi.h"
+	.file 4 "src/include/mem.h"
+	.file 5 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x610
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF44
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xb
+	.long	.LASF6
+	.byte	0x2e
+	.byte	0x17
+	.long	0x5a
+	.uleb128 0xc
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xb
+	.long	.LASF7
+	.byte	0x31
+	.byte	0x1c
+	.long	0x6c
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xb
+	.long	.LASF9
+	.byte	0x34
+	.byte	0x16
+	.long	0x83
+	.uleb128 0xc
+	.long	0x73
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0xb
+	.long	.LASF11
+	.byte	0x37
+	.byte	0x1b
+	.long	0x95
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x1a
+	.long	.LASF20
+	.byte	0xc
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x8
+	.long	0xf2
+	.uleb128 0x2
+	.long	.LASF13
+	.byte	0x1c
+	.byte	0xa
+	.long	0xf2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF14
+	.byte	0x1d
+	.byte	0xa
+	.long	0xf2
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x1e
+	.byte	0xa
+	.long	0xf2
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x1f
+	.byte	0xa
+	.long	0xf2
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF17
+	.byte	0x20
+	.byte	0xe
+	.long	0x73
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF18
+	.byte	0x21
+	.byte	0xe
+	.long	0x73
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF19
+	.uleb128 0xc
+	.long	0xf2
+	.uleb128 0x1b
+	.string	"iso"
+	.byte	0xa
+	.byte	0x3
+	.byte	0x25
+	.byte	0x8
+	.long	0x155
+	.uleb128 0x2
+	.long	.LASF13
+	.byte	0x26
+	.byte	0xa
+	.long	0xf2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF14
+	.byte	0x27
+	.byte	0xa
+	.long	0xf2
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF21
+	.byte	0x28
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF22
+	.byte	0x29
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x1c
+	.string	"gsi"
+	.byte	0x3
+	.byte	0x2a
+	.byte	0xe
+	.long	0x73
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF23
+	.byte	0x2b
+	.byte	0xe
+	.long	0x61
+	.byte	0x8
+	.byte	0
+	.uleb128 0xf
+	.long	0x160
+	.long	0x160
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0x9c
+	.uleb128 0xe
+	.long	.LASF24
+	.byte	0x3
+	.byte	0x9a
+	.byte	0x17
+	.long	0x155
+	.uleb128 0xf
+	.long	0x17c
+	.long	0x17c
+	.uleb128 0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0xfe
+	.uleb128 0xe
+	.long	.LASF25
+	.byte	0x3
+	.byte	0x9b
+	.byte	0x14
+	.long	0x171
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF26
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF27
+	.uleb128 0xd
+	.long	0xf9
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF28
+	.uleb128 0xe
+	.long	.LASF29
+	.byte	0x4
+	.byte	0xb2
+	.byte	0x11
+	.long	0x8a
+	.uleb128 0x1d
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x30
+	.byte	0x6
+	.long	0x1c6
+	.uleb128 0x1e
+	.long	0x19b
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF34
+	.byte	0x7b
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x29c
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x7b
+	.byte	0x23
+	.long	0x73
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x7b
+	.byte	0x35
+	.long	0x4a
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x12
+	.string	"irq"
+	.byte	0x7b
+	.byte	0x45
+	.long	0x4a
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x7b
+	.byte	0x4e
+	.long	0x1a0
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x20
+	.long	.LLRL33
+	.long	0x286
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x7d
+	.long	0x3c
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x5
+	.long	.LLRL35
+	.uleb128 0x8
+	.long	.LASF33
+	.byte	0x7e
+	.byte	0x15
+	.long	0x17c
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x21
+	.quad	.LVL54
+	.long	0x1b3
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL50
+	.long	0x29c
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF35
+	.byte	0x55
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x42a
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x55
+	.byte	0x24
+	.long	0x73
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x55
+	.byte	0x36
+	.long	0x4a
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x12
+	.string	"gsi"
+	.byte	0x55
+	.byte	0x46
+	.long	0x4a
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x55
+	.byte	0x54
+	.long	0x61
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x4
+	.long	.LASF32
+	.byte	0x55
+	.byte	0x5f
+	.long	0x1a0
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x8
+	.long	.LASF36
+	.byte	0x57
+	.byte	0x14
+	.long	0x160
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x8
+	.long	.LASF37
+	.byte	0x59
+	.byte	0xe
+	.long	0x8a
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x8
+	.long	.LASF38
+	.byte	0x6e
+	.byte	0xe
+	.long	0x73
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x15
+	.long	0x568
+	.quad	.LBI25
+	.byte	.LVU83
+	.long	.LLRL20
+	.byte	0x71
+	.long	0x3a2
+	.uleb128 0x3
+	.long	0x58b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x3
+	.long	0x580
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x3
+	.long	0x575
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x5
+	.long	.LLRL20
+	.uleb128 0x7
+	.long	0x597
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x568
+	.quad	.LBI36
+	.byte	.LVU96
+	.long	.LLRL25
+	.byte	0x72
+	.long	0x3ec
+	.uleb128 0x3
+	.long	0x58b
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x22
+	.long	0x580
+	.uleb128 0x3
+	.long	0x575
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x5
+	.long	.LLRL25
+	.uleb128 0x7
+	.long	0x597
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL18
+	.long	0x42a
+	.long	0x404
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL35
+	.long	0x1b3
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF45
+	.byte	0x1
+	.byte	0x41
+	.byte	0x10
+	.long	0x160
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x50d
+	.uleb128 0x25
+	.string	"gsi"
+	.byte	0x1
+	.byte	0x41
+	.byte	0x2e
+	.long	0x73
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x26
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x43
+	.long	0x3c
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x5
+	.long	.LLRL3
+	.uleb128 0x8
+	.long	.LASF36
+	.byte	0x44
+	.byte	0x18
+	.long	0x160
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x16
+	.long	0x50d
+	.quad	.LBI16
+	.byte	.LVU29
+	.long	.LLRL5
+	.byte	0x4a
+	.byte	0x43
+	.uleb128 0x3
+	.long	0x51e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x5
+	.long	.LLRL5
+	.uleb128 0x7
+	.long	0x529
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x16
+	.long	0x536
+	.quad	.LBI18
+	.byte	.LVU31
+	.long	.LLRL8
+	.byte	0x3a
+	.byte	0x15
+	.uleb128 0x3
+	.long	0x552
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x3
+	.long	0x547
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x5
+	.long	.LLRL8
+	.uleb128 0x7
+	.long	0x55d
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF46
+	.byte	0x1
+	.byte	0x38
+	.byte	0x11
+	.long	0x8a
+	.byte	0x1
+	.long	0x536
+	.uleb128 0x9
+	.long	.LASF36
+	.byte	0x38
+	.byte	0x2f
+	.long	0x160
+	.uleb128 0x28
+	.string	"max"
+	.byte	0x1
+	.byte	0x3a
+	.byte	0xe
+	.long	0x8a
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xa
+	.long	0x73
+	.byte	0x1
+	.long	0x568
+	.uleb128 0x9
+	.long	.LASF39
+	.byte	0x2a
+	.byte	0x25
+	.long	0x160
+	.uleb128 0x9
+	.long	.LASF40
+	.byte	0x2a
+	.byte	0x3a
+	.long	0x55
+	.uleb128 0x17
+	.long	.LASF41
+	.byte	0x2c
+	.long	0x8a
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF43
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x1
+	.long	0x5a2
+	.uleb128 0x9
+	.long	.LASF39
+	.byte	0x1c
+	.byte	0x22
+	.long	0x160
+	.uleb128 0x9
+	.long	.LASF40
+	.byte	0x1c
+	.byte	0x37
+	.long	0x55
+	.uleb128 0x2b
+	.string	"val"
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x4e
+	.long	0x7e
+	.uleb128 0x17
+	.long	.LASF41
+	.byte	0x1e
+	.long	0x8a
+	.byte	0
+	.uleb128 0x2c
+	.long	0x568
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e0
+	.uleb128 0xa
+	.long	0x575
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.long	0x580
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xa
+	.long	0x58b
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.long	0x597
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x536
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xa
+	.long	0x547
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.long	0x552
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.long	0x55d
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL50-1-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU113
+	.uleb128 .LVU117
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU117
+	.uleb128 .LVU123
+	.uleb128 .LVU125
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-1-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU65
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU99
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU67
+	.uleb128 .LVU96
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU82
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU90
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU83
+	.uleb128 .LVU92
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU83
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU92
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU83
+	.uleb128 .LVU92
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU85
+	.uleb128 .LVU92
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU96
+	.uleb128 .LVU105
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU96
+	.uleb128 .LVU99
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU100
+	.uleb128 .LVU105
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU23
+	.uleb128 .LVU26
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU26
+	.uleb128 .LVU49
+	.uleb128 .LVU51
+	.uleb128 .LVU54
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU29
+	.uleb128 .LVU41
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0xe
+	.byte	0x71
+	.sleb128 0
+	.byte	0x40
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU31
+	.uleb128 .LVU39
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU31
+	.uleb128 .LVU39
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU35
+	.uleb128 .LVU39
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU15
+	.uleb128 .LVU19
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF39:
+	.string	"pApic"
+.LASF43:
+	.string	"ioapic_write"
+.LASF32:
+	.string	"status"
+.LASF28:
+	.string	"_Bool"
+.LASF16:
+	.string	"reserved"
+.LASF15:
+	.string	"ioapic_id"
+.LASF36:
+	.string	"pIOApic"
+.LASF11:
+	.string	"uint64_t"
+.LASF42:
+	.string	"kprintf"
+.LASF5:
+	.string	"unsigned char"
+.LASF18:
+	.string	"gsi_base"
+.LASF8:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"ioapic_addr"
+.LASF37:
+	.string	"redirect"
+.LASF12:
+	.string	"long unsigned int"
+.LASF35:
+	.string	"_ioapic_redirect_gsi"
+.LASF21:
+	.string	"bus_source"
+.LASF10:
+	.string	"unsigned int"
+.LASF23:
+	.string	"flags"
+.LASF24:
+	.string	"ioapic_list"
+.LASF19:
+	.string	"char"
+.LASF6:
+	.string	"uint8_t"
+.LASF27:
+	.string	"long double"
+.LASF46:
+	.string	"ioapic_max_gsi"
+.LASF26:
+	.string	"long long int"
+.LASF29:
+	.string	"vmm_higher_half_offset"
+.LASF31:
+	.string	"vector"
+.LASF41:
+	.string	"base"
+.LASF30:
+	.string	"lapic_id"
+.LASF45:
+	.string	"_get_ioapic_from_gsi"
+.LASF40:
+	.string	"offset"
+.LASF13:
+	.string	"type"
+.LASF3:
+	.string	"short int"
+.LASF38:
+	.string	"io_redirect_table_reg"
+.LASF22:
+	.string	"irq_source"
+.LASF7:
+	.string	"uint16_t"
+.LASF14:
+	.string	"length"
+.LASF47:
+	.string	"ioapic_read"
+.LASF9:
+	.string	"uint32_t"
+.LASF4:
+	.string	"long int"
+.LASF34:
+	.string	"ioapic_redirect_irq"
+.LASF2:
+	.string	"signed char"
+.LASF44:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF33:
+	.string	"pISO"
+.LASF25:
+	.string	"iso_list"
+.LASF20:
+	.string	"ioapic"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"src/ioapic.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
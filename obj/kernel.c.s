@@ -0,0 +1,3409 @@
+	.file	"kernel.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/kernel.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"CPU Vendor: %s\n"
+.LC1:
+	.string	"CPU Brand: %s\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC2:
+	.string	"Logical Processors Per Core: %d\n"
+	.section	.rodata.str1.1
+.LC3:
+	.string	"Total Logical Processors: %d\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC4:
+	.string	"CPU Frequency (0x16) not supported.\n"
+	.section	.rodata.str1.1
+.LC5:
+	.string	"Base Frequency: %d\n"
+.LC6:
+	.string	"Max Frequency: %d\n"
+.LC7:
+	.string	"Bus Frequency: %d\n"
+	.text
+	.p2align 4
+	.globl	report_cpu_details
+	.type	report_cpu_details, @function
+report_cpu_details:
+.LFB40:
+	.file 1 "src/kernel.c"
+	.loc 1 153 1 view -0
+	.cfi_startproc
+	.loc 1 154 5 view .LVU1
+	.loc 1 153 1 is_stmt 0 view .LVU2
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB24:
+.LBB25:
+	.file 2 "src/include/cpuid.h"
+	.loc 2 28 5 view .LVU3
+	xorl	%eax, %eax
+.LBE25:
+.LBE24:
+	.loc 1 153 1 view .LVU4
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$64, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 154 10 view .LVU5
+	movq	$0, 7(%rsp)
+	.loc 1 155 5 is_stmt 1 view .LVU6
+.LVL0:
+.LBB28:
+.LBI24:
+	.loc 2 24 20 view .LVU7
+.LBB26:
+	.loc 2 26 5 view .LVU8
+	.loc 2 28 5 view .LVU9
+#APP
+# 28 "src/include/cpuid.h" 1
+	cpuid
+# 0 "" 2
+.LVL1:
+	.loc 2 35 5 view .LVU10
+#NO_APP
+.LBE26:
+.LBE28:
+	.loc 1 156 5 is_stmt 0 view .LVU11
+	leaq	.LC0(%rip), %rdi
+	leaq	2(%rsp), %rsi
+.LVL2:
+.LBB29:
+.LBB27:
+	.loc 2 35 26 view .LVU12
+	movl	%ebx, 2(%rsp)
+	.loc 2 36 5 is_stmt 1 view .LVU13
+	.loc 2 36 32 is_stmt 0 view .LVU14
+	movl	%edx, 6(%rsp)
+	.loc 2 37 5 is_stmt 1 view .LVU15
+	.loc 2 37 32 is_stmt 0 view .LVU16
+	movl	%ecx, 10(%rsp)
+.LVL3:
+	.loc 2 37 32 view .LVU17
+.LBE27:
+.LBE29:
+	.loc 1 156 5 is_stmt 1 view .LVU18
+	call	kprintf@PLT
+.LVL4:
+	.loc 1 158 5 view .LVU19
+	.loc 1 158 10 is_stmt 0 view .LVU20
+	movb	$0, 63(%rsp)
+	.loc 1 159 5 is_stmt 1 view .LVU21
+.LVL5:
+.LBB30:
+.LBI30:
+	.loc 2 40 20 view .LVU22
+.LBB31:
+	.loc 2 41 5 view .LVU23
+	.loc 2 42 5 view .LVU24
+	.loc 2 44 5 view .LVU25
+.LBB32:
+	.loc 2 44 10 view .LVU26
+	.loc 2 44 23 view .LVU27
+.LBE32:
+	.loc 2 42 11 is_stmt 0 view .LVU28
+	leaq	15(%rsp), %r8
+.LVL6:
+	.loc 2 42 11 view .LVU29
+.LBE31:
+.LBE30:
+	.loc 1 158 10 view .LVU30
+	movl	$-2147483646, %esi
+	movq	$0, 15(%rsp)
+.LBB36:
+.LBB34:
+	.loc 2 42 11 view .LVU31
+	movq	%r8, %rdi
+.LBE34:
+.LBE36:
+	.loc 1 158 10 view .LVU32
+	movq	$0, 23(%rsp)
+	movq	$0, 31(%rsp)
+	movq	$0, 39(%rsp)
+	movq	$0, 47(%rsp)
+	movq	$0, 55(%rsp)
+.LVL7:
+.L2:
+.LBB37:
+.LBB35:
+.LBB33:
+	.loc 2 45 9 is_stmt 1 view .LVU33
+	movl	%esi, %eax
+#APP
+# 45 "src/include/cpuid.h" 1
+	cpuid
+# 0 "" 2
+.LVL8:
+	.loc 2 51 9 view .LVU34
+	.loc 2 44 23 is_stmt 0 view .LVU35
+#NO_APP
+	addl	$1, %esi
+.LVL9:
+	.loc 2 51 27 view .LVU36
+	movl	%eax, (%rdi)
+	.loc 2 52 9 is_stmt 1 view .LVU37
+	.loc 2 55 13 is_stmt 0 view .LVU38
+	addq	$16, %rdi
+.LVL10:
+	.loc 2 52 33 view .LVU39
+	movl	%ebx, -12(%rdi)
+	.loc 2 53 9 is_stmt 1 view .LVU40
+	.loc 2 53 33 is_stmt 0 view .LVU41
+	movl	%ecx, -8(%rdi)
+	.loc 2 54 9 is_stmt 1 view .LVU42
+	.loc 2 54 34 is_stmt 0 view .LVU43
+	movl	%edx, -4(%rdi)
+	.loc 2 55 9 is_stmt 1 view .LVU44
+.LVL11:
+	.loc 2 44 29 view .LVU45
+	.loc 2 44 23 view .LVU46
+	cmpl	$-2147483643, %esi
+	jne	.L2
+.LVL12:
+	.loc 2 44 23 is_stmt 0 view .LVU47
+.LBE33:
+.LBE35:
+.LBE37:
+	.loc 1 160 5 is_stmt 1 view .LVU48
+	xorl	%eax, %eax
+	movq	%r8, %rsi
+	leaq	.LC1(%rip), %rdi
+	call	kprintf@PLT
+.LVL13:
+	.loc 1 162 5 view .LVU49
+	.loc 1 163 5 view .LVU50
+.LBB38:
+.LBI38:
+	.loc 2 59 20 view .LVU51
+.LBB39:
+	.loc 2 60 5 view .LVU52
+	.loc 2 61 5 view .LVU53
+	.loc 2 62 5 view .LVU54
+	.loc 2 63 5 view .LVU55
+	.loc 2 66 5 view .LVU56
+	.loc 2 67 5 view .LVU57
+	movl	$11, %eax
+	xorl	%ecx, %ecx
+#APP
+# 67 "src/include/cpuid.h" 1
+	cpuid
+# 0 "" 2
+.LVL14:
+	.loc 2 74 5 view .LVU58
+	.loc 2 79 12 is_stmt 0 view .LVU59
+#NO_APP
+	movl	%ecx, %eax
+	.loc 2 74 13 view .LVU60
+	movzwl	%bx, %ebp
+.LVL15:
+	.loc 2 79 12 is_stmt 1 view .LVU61
+	andl	$65280, %eax
+	je	.L3
+	.loc 2 80 9 view .LVU62
+.LVL16:
+	.loc 2 81 9 view .LVU63
+	.loc 2 80 19 is_stmt 0 view .LVU64
+	movzbl	%ch, %ecx
+.LVL17:
+	.loc 2 81 12 view .LVU65
+	cmpl	$2, %ecx
+	je	.L9
+	xorl	%esi, %esi
+	.loc 2 87 9 view .LVU66
+	movl	$11, %edi
+	jmp	.L5
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.loc 2 80 9 is_stmt 1 view .LVU67
+	.loc 2 81 9 view .LVU68
+	.loc 2 80 19 is_stmt 0 view .LVU69
+	movzbl	%ch, %ecx
+.LVL19:
+	.loc 2 81 12 view .LVU70
+	cmpl	$2, %ecx
+	je	.L17
+.LVL20:
+.L5:
+	.loc 2 86 9 is_stmt 1 view .LVU71
+	.loc 2 86 14 is_stmt 0 view .LVU72
+	addl	$1, %esi
+.LVL21:
+	.loc 2 87 9 is_stmt 1 view .LVU73
+	movl	%edi, %eax
+	movl	%esi, %ecx
+#APP
+# 87 "src/include/cpuid.h" 1
+	cpuid
+# 0 "" 2
+.LVL22:
+	.loc 2 79 12 view .LVU74
+#NO_APP
+	movl	%ecx, %eax
+	andl	$65280, %eax
+	jne	.L6
+.LVL23:
+.L3:
+	.loc 2 79 12 is_stmt 0 view .LVU75
+.LBE39:
+.LBE38:
+	.loc 1 165 5 is_stmt 1 view .LVU76
+	movl	%eax, %esi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+.LVL24:
+	.loc 1 165 5 is_stmt 0 view .LVU77
+	call	kprintf@PLT
+.LVL25:
+	.loc 1 166 5 is_stmt 1 view .LVU78
+	xorl	%eax, %eax
+	movl	%ebp, %esi
+	leaq	.LC3(%rip), %rdi
+	call	kprintf@PLT
+.LVL26:
+	.loc 1 168 5 view .LVU79
+	.loc 1 169 5 view .LVU80
+.LBB42:
+.LBI42:
+	.loc 2 95 20 view .LVU81
+.LBB43:
+	.loc 2 96 5 view .LVU82
+	.loc 2 98 5 view .LVU83
+	movl	$22, %eax
+#APP
+# 98 "src/include/cpuid.h" 1
+	cpuid
+# 0 "" 2
+.LVL27:
+	.loc 2 104 5 view .LVU84
+	.loc 2 104 29 is_stmt 0 view .LVU85
+#NO_APP
+	movzwl	%ax, %esi
+.LVL28:
+	.loc 2 105 5 is_stmt 1 view .LVU86
+.LBE43:
+.LBE42:
+	.loc 1 171 55 is_stmt 0 view .LVU87
+	orl	%ebx, %eax
+.LVL29:
+.LBB45:
+.LBB44:
+	.loc 2 105 28 view .LVU88
+	movzwl	%bx, %r12d
+.LVL30:
+	.loc 2 106 5 is_stmt 1 view .LVU89
+	.loc 2 106 28 is_stmt 0 view .LVU90
+	movzwl	%cx, %ebp
+.LVL31:
+	.loc 2 106 28 view .LVU91
+.LBE44:
+.LBE45:
+	.loc 1 171 5 is_stmt 1 view .LVU92
+	.loc 1 171 55 is_stmt 0 view .LVU93
+	orl	%ecx, %eax
+	testw	%ax, %ax
+	je	.L18
+	.loc 1 175 9 is_stmt 1 view .LVU94
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL32:
+	.loc 1 176 9 view .LVU95
+	movl	%r12d, %esi
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL33:
+	.loc 1 177 9 view .LVU96
+	movl	%ebp, %esi
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL34:
+	.loc 1 179 1 is_stmt 0 view .LVU97
+	addq	$64, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.cfi_restore_state
+.LBB46:
+.LBB40:
+	.loc 2 82 45 view .LVU98
+	movzwl	%bx, %eax
+	jmp	.L3
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.loc 2 82 45 view .LVU99
+.LBE40:
+.LBE46:
+	.loc 1 172 9 is_stmt 1 view .LVU100
+	leaq	.LC4(%rip), %rdi
+	call	kprintf@PLT
+.LVL37:
+	.loc 1 179 1 is_stmt 0 view .LVU101
+	addq	$64, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL38:
+	.loc 1 179 1 view .LVU102
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL39:
+	.loc 1 179 1 view .LVU103
+	ret
+.LVL40:
+.L9:
+	.cfi_restore_state
+.LBB47:
+.LBB41:
+	.loc 2 81 12 view .LVU104
+	movl	%ebp, %eax
+	.loc 2 82 13 is_stmt 1 view .LVU105
+.LVL41:
+	.loc 2 83 13 view .LVU106
+	jmp	.L3
+.LBE41:
+.LBE47:
+	.cfi_endproc
+.LFE40:
+	.size	report_cpu_details, .-report_cpu_details
+	.section	.rodata.str1.1
+.LC8:
+	.string	"BloreOS Alpha v0.01\n\n"
+.LC9:
+	.string	"GDT/IDT initialized.\n"
+.LC10:
+	.string	"PMM Available Pages: %lu\n"
+	.text
+	.p2align 4
+	.globl	kernel_main
+	.type	kernel_main, @function
+kernel_main:
+.LFB39:
+	.loc 1 55 1 view -0
+	.cfi_startproc
+	.loc 1 57 5 view .LVU108
+	.loc 1 57 8 is_stmt 0 view .LVU109
+	cmpq	$0, 16+limine_base_revision(%rip)
+	je	.L20
+	.loc 1 58 9 is_stmt 1 view .LVU110
+.LBB59:
+.LBI59:
+	.file 3 "src/kernel.h"
+	.loc 3 27 20 view .LVU111
+.LBB60:
+	.loc 3 29 5 view .LVU112
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+	.p2align 4,,10
+	.p2align 3
+#NO_APP
+.L21:
+	.loc 3 30 5 view .LVU113
+	.loc 3 31 9 view .LVU114
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 3 30 5 view .LVU115
+#NO_APP
+	jmp	.L21
+.L20:
+.LBE60:
+.LBE59:
+	.loc 1 61 5 view .LVU116
+	.loc 1 55 1 is_stmt 0 view .LVU117
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 61 5 view .LVU118
+	movl	$1016, %edi
+	call	init_serial@PLT
+.LVL42:
+	.loc 1 62 5 is_stmt 1 view .LVU119
+	xorl	%eax, %eax
+	call	term_init@PLT
+.LVL43:
+	.loc 1 64 5 view .LVU120
+	movl	$65280, %edi
+	call	term_fgcolor@PLT
+.LVL44:
+	.loc 1 65 5 view .LVU121
+	xorl	%eax, %eax
+	leaq	.LC8(%rip), %rdi
+	call	kprintf@PLT
+.LVL45:
+	.loc 1 66 5 view .LVU122
+	movl	$13421772, %edi
+	call	term_fgcolor@PLT
+.LVL46:
+	.loc 1 68 5 view .LVU123
+	xorl	%eax, %eax
+	call	report_cpu_details
+.LVL47:
+	.loc 1 69 5 view .LVU124
+	xorl	%eax, %eax
+	call	memops_init@PLT
+.LVL48:
+	.loc 1 71 5 view .LVU125
+.LBB61:
+.LBI61:
+	.file 4 "src/include/cpu.h"
+	.loc 4 284 20 view .LVU126
+.LBB62:
+	.loc 4 286 5 view .LVU127
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE62:
+.LBE61:
+	.loc 1 73 5 view .LVU128
+	xorl	%eax, %eax
+	call	init_gdt@PLT
+.LVL49:
+	.loc 1 74 5 view .LVU129
+	xorl	%edi, %edi
+	call	cpu_local_init@PLT
+.LVL50:
+	.loc 1 75 5 view .LVU130
+	xorl	%eax, %eax
+	call	idt_init@PLT
+.LVL51:
+	.loc 1 76 5 view .LVU131
+	xorl	%eax, %eax
+	call	pit_disable_timer@PLT
+.LVL52:
+	.loc 1 78 5 view .LVU132
+.LBB63:
+.LBI63:
+	.loc 4 289 20 view .LVU133
+.LBB64:
+	.loc 4 291 5 view .LVU134
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE64:
+.LBE63:
+	.loc 1 80 5 view .LVU135
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	leaq	scancode_map(%rip), %rbx
+	call	kprintf@PLT
+.LVL53:
+	.loc 1 82 5 view .LVU136
+	xorl	%eax, %eax
+	call	kmem_init@PLT
+.LVL54:
+	.loc 1 87 5 view .LVU137
+	xorl	%eax, %eax
+	call	slab_init@PLT
+.LVL55:
+	.loc 1 90 5 view .LVU138
+	movq	num_pages_available(%rip), %rsi
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL56:
+	.loc 1 92 5 view .LVU139
+	xorl	%eax, %eax
+	call	acpi_init@PLT
+.LVL57:
+	.loc 1 93 5 view .LVU140
+	xorl	%eax, %eax
+	call	kmem_numa_init@PLT
+.LVL58:
+	.loc 1 95 5 view .LVU141
+	xorl	%eax, %eax
+	call	hpet_init@PLT
+.LVL59:
+	.loc 1 97 5 view .LVU142
+	xorl	%eax, %eax
+	call	cpu_init@PLT
+.LVL60:
+	.loc 1 99 5 view .LVU143
+	xorl	%eax, %eax
+	call	lapic_init@PLT
+.LVL61:
+	.loc 1 101 5 view .LVU144
+	xorl	%eax, %eax
+	call	pci_init@PLT
+.LVL62:
+	.loc 1 103 5 view .LVU145
+	xorl	%eax, %eax
+	call	nvme_init@PLT
+.LVL63:
+	.loc 1 105 5 view .LVU146
+	.loc 1 105 18 is_stmt 0 view .LVU147
+	movl	$200, %edi
+	call	cqueue_create@PLT
+.LVL64:
+	.loc 1 105 16 view .LVU148
+	movq	%rax, q_keyboard(%rip)
+	.loc 1 106 5 is_stmt 1 view .LVU149
+	xorl	%eax, %eax
+	call	ps2_init@PLT
+.LVL65:
+	.loc 1 108 5 view .LVU150
+	xorl	%eax, %eax
+	call	vm_init@PLT
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 122 5 view .LVU151
+	.loc 1 124 9 view .LVU152
+	.loc 1 124 23 is_stmt 0 view .LVU153
+	movq	q_keyboard(%rip), %rax
+	movl	20(%rax), %eax
+	.loc 1 124 12 view .LVU154
+	testl	%eax, %eax
+	je	.L23
+.L31:
+.LBB65:
+	.loc 1 128 13 is_stmt 1 view .LVU155
+.LBB66:
+.LBI66:
+	.loc 4 284 20 view .LVU156
+.LBB67:
+	.loc 4 286 5 view .LVU157
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE67:
+.LBE66:
+	.loc 1 129 13 view .LVU158
+	.loc 1 129 33 is_stmt 0 view .LVU159
+	movq	q_keyboard(%rip), %rdi
+	call	cqueue_read@PLT
+.LVL67:
+	.loc 1 130 13 is_stmt 1 view .LVU160
+.LBB68:
+.LBI68:
+	.loc 4 289 20 view .LVU161
+.LBB69:
+	.loc 4 291 5 view .LVU162
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE69:
+.LBE68:
+	.loc 1 132 13 view .LVU163
+	.loc 1 132 25 is_stmt 0 view .LVU164
+	movl	%eax, %eax
+	.loc 1 132 25 view .LVU165
+	movq	(%rbx,%rax,8), %rdi
+.LVL68:
+	.loc 1 133 13 is_stmt 1 view .LVU166
+	.loc 1 133 16 is_stmt 0 view .LVU167
+	testq	%rdi, %rdi
+	je	.L22
+	.loc 1 134 17 is_stmt 1 view .LVU168
+	call	term_keyevent@PLT
+.LVL69:
+	.loc 1 134 17 is_stmt 0 view .LVU169
+.LBE65:
+	.loc 1 122 5 is_stmt 1 view .LVU170
+	.loc 1 124 9 view .LVU171
+	.loc 1 124 23 is_stmt 0 view .LVU172
+	movq	q_keyboard(%rip), %rax
+	movl	20(%rax), %eax
+	.loc 1 124 12 view .LVU173
+	testl	%eax, %eax
+	jne	.L31
+.LVL70:
+.L23:
+	.loc 1 140 13 is_stmt 1 view .LVU174
+	.loc 1 140 16 is_stmt 0 view .LVU175
+	cmpq	$4095, num_pages_available(%rip)
+	jbe	.L32
+.L25:
+	.loc 1 144 13 is_stmt 1 view .LVU176
+	xorl	%eax, %eax
+	call	kmem_zero_pool_fill@PLT
+.LVL71:
+	.loc 1 145 13 view .LVU177
+	xorl	%eax, %eax
+	call	kmem_compact_background@PLT
+.LVL72:
+	jmp	.L22
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 141 17 view .LVU178
+	xorl	%eax, %eax
+	call	alloc_cpu_cache_drain@PLT
+.LVL73:
+	jmp	.L25
+	.cfi_endproc
+.LFE39:
+	.size	kernel_main, .-kernel_main
+	.globl	limine_base_revision
+	.data
+	.align 16
+	.type	limine_base_revision, @object
+	.size	limine_base_revision, 24
+limine_base_revision:
+	.quad	-480148836441545016
+	.quad	7672788277485857756
+	.quad	1
+	.globl	q_keyboard
+	.bss
+	.align 8
+	.type	q_keyboard, @object
+	.size	q_keyboard, 8
+q_keyboard:
+	.zero	8
+	.text
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 6 "src/include/ps2.h"
+	.file 7 "src/include/mem.h"
+	.file 8 "src/include/atomic.h"
+	.file 9 "src/include/queue.h"
+	.file 10 "src/include/alloc.h"
+	.file 11 "src/include/vm.h"
+	.file 12 "src/include/nvme.h"
+	.file 13 "src/include/pci.h"
+	.file 14 "src/include/lapic.h"
+	.file 15 "src/include/hpet.h"
+	.file 16 "src/include/acpi.h"
+	.file 17 "src/include/slab.h"
+	.file 18 "src/include/pit.h"
+	.file 19 "src/include/idt.h"
+	.file 20 "src/include/terminal.h"
+	.file 21 "src/include/gdt.h"
+	.file 22 "src/include/str.h"
+	.file 23 "src/include/serial.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb7d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF77
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xa
+	.long	.LASF6
+	.byte	0x5
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xa
+	.long	.LASF7
+	.byte	0x5
+	.byte	0x31
+	.byte	0x1c
+	.long	0x69
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x81
+	.uleb128 0x20
+	.long	0x70
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x5
+	.byte	0x37
+	.byte	0x1b
+	.long	0x94
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0xf
+	.long	0xae
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x21
+	.long	0xae
+	.uleb128 0xf
+	.long	0xb5
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF16
+	.uleb128 0x16
+	.long	.LASF22
+	.byte	0x7
+	.byte	0xb1
+	.byte	0x11
+	.long	0x88
+	.uleb128 0x22
+	.long	.LASF78
+	.byte	0x4
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x10
+	.long	0x114
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x1f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x9
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x20
+	.byte	0xa
+	.long	0xae
+	.byte	0x2
+	.uleb128 0x9
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x21
+	.byte	0x9
+	.long	0xbf
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x22
+	.byte	0x3
+	.long	0xd2
+	.uleb128 0x11
+	.long	0x12b
+	.long	0x12b
+	.uleb128 0x23
+	.byte	0
+	.uleb128 0xf
+	.long	0x114
+	.uleb128 0x16
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x24
+	.byte	0x14
+	.long	0x120
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x8
+	.byte	0x17
+	.long	0x152
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x8
+	.byte	0x18
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF25
+	.byte	0x8
+	.byte	0x19
+	.byte	0x3
+	.long	0x13c
+	.uleb128 0x1a
+	.byte	0x19
+	.byte	0x9
+	.byte	0x19
+	.long	0x1b5
+	.uleb128 0x9
+	.long	.LASF26
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x17
+	.long	0x7c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF27
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x17
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x9
+	.long	.LASF28
+	.byte	0x9
+	.byte	0x1c
+	.byte	0xf
+	.long	0x1b5
+	.byte	0x8
+	.uleb128 0x24
+	.string	"len"
+	.byte	0x9
+	.byte	0x1d
+	.byte	0xe
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF29
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x17
+	.long	0x7c
+	.byte	0x14
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x9
+	.byte	0x1f
+	.byte	0x10
+	.long	0x152
+	.byte	0x18
+	.byte	0
+	.uleb128 0xf
+	.long	0x70
+	.uleb128 0xa
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x20
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x16
+	.long	.LASF31
+	.byte	0x3
+	.byte	0x23
+	.byte	0x12
+	.long	0x1d2
+	.uleb128 0xf
+	.long	0x1ba
+	.uleb128 0x25
+	.long	0x1c6
+	.byte	0x1
+	.byte	0x2e
+	.byte	0xb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	q_keyboard
+	.uleb128 0x11
+	.long	0x88
+	.long	0x1f9
+	.uleb128 0x17
+	.long	0x94
+	.byte	0x2
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x33
+	.byte	0xa
+	.long	0x1e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	limine_base_revision
+	.uleb128 0x4
+	.long	.LASF33
+	.byte	0x7
+	.byte	0xce
+	.byte	0x6
+	.long	0x21d
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF34
+	.byte	0x7
+	.byte	0xc3
+	.byte	0x6
+	.long	0x22b
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0xa
+	.byte	0x30
+	.byte	0x6
+	.long	0x239
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF51
+	.byte	0x14
+	.byte	0x1f
+	.byte	0x6
+	.long	0x24b
+	.uleb128 0xb
+	.long	0x12b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x24
+	.byte	0xa
+	.long	0x70
+	.long	0x261
+	.uleb128 0xb
+	.long	0x1d2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0xb
+	.byte	0x29
+	.byte	0x6
+	.long	0x26f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x28
+	.byte	0x6
+	.long	0x27d
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x22
+	.byte	0xb
+	.long	0x1d2
+	.long	0x293
+	.uleb128 0xb
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0xc
+	.byte	0x15
+	.byte	0x6
+	.long	0x2a1
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF41
+	.byte	0xd
+	.byte	0x2e
+	.byte	0x6
+	.long	0x2af
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0xe
+	.byte	0x17
+	.byte	0x6
+	.long	0x2bd
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF43
+	.byte	0x4
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2cb
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF44
+	.byte	0xf
+	.byte	0x15
+	.byte	0x6
+	.long	0x2d9
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x7
+	.byte	0xba
+	.byte	0x6
+	.long	0x2e7
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x10
+	.byte	0x17
+	.byte	0x6
+	.long	0x2f5
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x11
+	.byte	0x2d
+	.byte	0x6
+	.long	0x303
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x7
+	.byte	0xb8
+	.byte	0x6
+	.long	0x311
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF49
+	.byte	0x12
+	.byte	0x15
+	.byte	0x6
+	.long	0x31f
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF50
+	.byte	0x13
+	.byte	0x37
+	.byte	0x6
+	.long	0x32d
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF52
+	.byte	0x4
+	.byte	0x3f
+	.byte	0xd
+	.long	0x33f
+	.uleb128 0xb
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF53
+	.byte	0x15
+	.byte	0x41
+	.byte	0x6
+	.long	0x34d
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF54
+	.byte	0x7
+	.byte	0xde
+	.byte	0x6
+	.long	0x35b
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF55
+	.byte	0x16
+	.byte	0x30
+	.byte	0x6
+	.long	0x36e
+	.uleb128 0xb
+	.long	0xba
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF56
+	.byte	0x14
+	.byte	0x1d
+	.byte	0x6
+	.long	0x380
+	.uleb128 0xb
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x6
+	.long	0x38e
+	.uleb128 0x3
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF58
+	.byte	0x17
+	.byte	0x19
+	.byte	0x5
+	.long	0x3c
+	.long	0x3a4
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF79
+	.byte	0x1
+	.byte	0x98
+	.byte	0x6
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x70e
+	.uleb128 0x1b
+	.long	.LASF59
+	.byte	0x9a
+	.long	0x70e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -94
+	.uleb128 0x1b
+	.long	.LASF60
+	.byte	0x9e
+	.long	0x71e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -81
+	.uleb128 0xe
+	.long	.LASF61
+	.byte	0xa2
+	.byte	0xe
+	.long	0x70
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xe
+	.long	.LASF62
+	.byte	0xa2
+	.byte	0x28
+	.long	0x70
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xe
+	.long	.LASF63
+	.byte	0xa8
+	.byte	0xe
+	.long	0x70
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xe
+	.long	.LASF64
+	.byte	0xa8
+	.byte	0x20
+	.long	0x70
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xe
+	.long	.LASF65
+	.byte	0xa8
+	.byte	0x31
+	.long	0x70
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.long	0xb3b
+	.quad	.LBI24
+	.byte	.LVU7
+	.long	.LLRL5
+	.byte	0x9b
+	.long	0x48f
+	.uleb128 0xc
+	.long	0xb45
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x14
+	.long	.LLRL5
+	.uleb128 0x6
+	.long	0xb50
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x6
+	.long	0xb5b
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x6
+	.long	0xb66
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xae3
+	.quad	.LBI30
+	.byte	.LVU22
+	.long	.LLRL10
+	.byte	0x9f
+	.long	0x512
+	.uleb128 0xc
+	.long	0xaed
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x14
+	.long	.LLRL10
+	.uleb128 0x6
+	.long	0xaf8
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x6
+	.long	0xb03
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	0xb0e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.long	0xb19
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.long	0xb24
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x28
+	.long	0xb2f
+	.long	.LLRL17
+	.uleb128 0x6
+	.long	0xb30
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xa82
+	.quad	.LBI38
+	.byte	.LVU51
+	.long	.LLRL19
+	.byte	0xa3
+	.long	0x588
+	.uleb128 0xc
+	.long	0xa97
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xc
+	.long	0xa8c
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x14
+	.long	.LLRL19
+	.uleb128 0x19
+	.long	0xaa2
+	.uleb128 0x6
+	.long	0xaad
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x6
+	.long	0xab8
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x19
+	.long	0xac3
+	.uleb128 0x6
+	.long	0xace
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x6
+	.long	0xad8
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xa2a
+	.quad	.LBI42
+	.byte	.LVU81
+	.long	.LLRL26
+	.byte	0xa9
+	.long	0x5f9
+	.uleb128 0xc
+	.long	0xa4a
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xc
+	.long	0xa3f
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0xc
+	.long	0xa34
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x14
+	.long	.LLRL26
+	.uleb128 0x6
+	.long	0xa55
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x6
+	.long	0xa60
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x6
+	.long	0xa6b
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x19
+	.long	0xa76
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL4
+	.long	0x35b
+	.long	0x61f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -94
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL13
+	.long	0x35b
+	.long	0x645
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -81
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL25
+	.long	0x35b
+	.long	0x664
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL26
+	.long	0x35b
+	.long	0x689
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL32
+	.long	0x35b
+	.long	0x6a8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL33
+	.long	0x35b
+	.long	0x6cd
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL34
+	.long	0x35b
+	.long	0x6f2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x29
+	.quad	.LVL37
+	.long	0x35b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xae
+	.long	0x71e
+	.uleb128 0x17
+	.long	0x94
+	.byte	0xc
+	.byte	0
+	.uleb128 0x11
+	.long	0xae
+	.long	0x72e
+	.uleb128 0x17
+	.long	0x94
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF80
+	.byte	0x1
+	.byte	0x36
+	.byte	0x6
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa21
+	.uleb128 0x2b
+	.quad	.LBB65
+	.quad	.LBE65-.LBB65
+	.long	0x7e3
+	.uleb128 0xe
+	.long	.LASF66
+	.byte	0x81
+	.byte	0x16
+	.long	0x70
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x2c
+	.string	"pKE"
+	.byte	0x1
+	.byte	0x84
+	.byte	0x19
+	.long	0x12b
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x10
+	.long	0xb79
+	.quad	.LBI66
+	.byte	.LVU156
+	.quad	.LBB66
+	.quad	.LBE66-.LBB66
+	.byte	0x80
+	.byte	0xd
+	.uleb128 0x10
+	.long	0xb72
+	.quad	.LBI68
+	.byte	.LVU161
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0x82
+	.byte	0xd
+	.uleb128 0x1
+	.quad	.LVL67
+	.long	0x24b
+	.uleb128 0x1
+	.quad	.LVL69
+	.long	0x239
+	.byte	0
+	.uleb128 0x10
+	.long	0xa21
+	.quad	.LBI59
+	.byte	.LVU111
+	.quad	.LBB59
+	.quad	.LBE59-.LBB59
+	.byte	0x3a
+	.byte	0x9
+	.uleb128 0x10
+	.long	0xb79
+	.quad	.LBI61
+	.byte	.LVU126
+	.quad	.LBB61
+	.quad	.LBE61-.LBB61
+	.byte	0x47
+	.byte	0x5
+	.uleb128 0x10
+	.long	0xb72
+	.quad	.LBI63
+	.byte	.LVU133
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.byte	0x4e
+	.byte	0x5
+	.uleb128 0x7
+	.quad	.LVL42
+	.long	0x38e
+	.long	0x85c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3f8
+	.byte	0
+	.uleb128 0x1
+	.quad	.LVL43
+	.long	0x380
+	.uleb128 0x7
+	.quad	.LVL44
+	.long	0x36e
+	.long	0x882
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0xff00
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL45
+	.long	0x35b
+	.long	0x8a1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL46
+	.long	0x36e
+	.long	0x8bc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xc
+	.long	0xcccccc
+	.byte	0
+	.uleb128 0x1
+	.quad	.LVL47
+	.long	0x3a4
+	.uleb128 0x1
+	.quad	.LVL48
+	.long	0x34d
+	.uleb128 0x1
+	.quad	.LVL49
+	.long	0x33f
+	.uleb128 0x7
+	.quad	.LVL50
+	.long	0x32d
+	.long	0x8fa
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1
+	.quad	.LVL51
+	.long	0x31f
+	.uleb128 0x1
+	.quad	.LVL52
+	.long	0x311
+	.uleb128 0x7
+	.quad	.LVL53
+	.long	0x35b
+	.long	0x933
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x1
+	.quad	.LVL54
+	.long	0x303
+	.uleb128 0x1
+	.quad	.LVL55
+	.long	0x2f5
+	.uleb128 0x7
+	.quad	.LVL56
+	.long	0x35b
+	.long	0x96c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x1
+	.quad	.LVL57
+	.long	0x2e7
+	.uleb128 0x1
+	.quad	.LVL58
+	.long	0x2d9
+	.uleb128 0x1
+	.quad	.LVL59
+	.long	0x2cb
+	.uleb128 0x1
+	.quad	.LVL60
+	.long	0x2bd
+	.uleb128 0x1
+	.quad	.LVL61
+	.long	0x2af
+	.uleb128 0x1
+	.quad	.LVL62
+	.long	0x2a1
+	.uleb128 0x1
+	.quad	.LVL63
+	.long	0x293
+	.uleb128 0x7
+	.quad	.LVL64
+	.long	0x27d
+	.long	0x9df
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x1
+	.quad	.LVL65
+	.long	0x26f
+	.uleb128 0x1
+	.quad	.LVL66
+	.long	0x261
+	.uleb128 0x1
+	.quad	.LVL71
+	.long	0x21d
+	.uleb128 0x1
+	.quad	.LVL72
+	.long	0x20f
+	.uleb128 0x1
+	.quad	.LVL73
+	.long	0x22b
+	.byte	0
+	.uleb128 0x2d
+	.string	"hcf"
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x15
+	.long	.LASF67
+	.byte	0x5f
+	.long	0xa82
+	.uleb128 0xd
+	.long	.LASF63
+	.byte	0x5f
+	.byte	0x30
+	.long	0x1b5
+	.uleb128 0xd
+	.long	.LASF64
+	.byte	0x5f
+	.byte	0x4c
+	.long	0x1b5
+	.uleb128 0xd
+	.long	.LASF65
+	.byte	0x5f
+	.byte	0x67
+	.long	0x1b5
+	.uleb128 0x5
+	.string	"eax"
+	.byte	0x60
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x5
+	.string	"ebx"
+	.byte	0x60
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.string	"ecx"
+	.byte	0x60
+	.byte	0x18
+	.long	0x70
+	.uleb128 0x5
+	.string	"edx"
+	.byte	0x60
+	.byte	0x1d
+	.long	0x70
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF68
+	.byte	0x3b
+	.long	0xae3
+	.uleb128 0xd
+	.long	.LASF61
+	.byte	0x3b
+	.byte	0x2f
+	.long	0x1b5
+	.uleb128 0xd
+	.long	.LASF62
+	.byte	0x3b
+	.byte	0x53
+	.long	0x1b5
+	.uleb128 0x5
+	.string	"eax"
+	.byte	0x3c
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x5
+	.string	"ebx"
+	.byte	0x3c
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.string	"ecx"
+	.byte	0x3c
+	.byte	0x18
+	.long	0x70
+	.uleb128 0x5
+	.string	"edx"
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x70
+	.uleb128 0x1c
+	.long	.LASF69
+	.byte	0x3d
+	.long	0x70
+	.uleb128 0x1c
+	.long	.LASF70
+	.byte	0x42
+	.long	0x70
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF71
+	.byte	0x28
+	.long	0xb3b
+	.uleb128 0xd
+	.long	.LASF72
+	.byte	0x28
+	.byte	0x28
+	.long	0xa9
+	.uleb128 0x5
+	.string	"eax"
+	.byte	0x29
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x5
+	.string	"ebx"
+	.byte	0x29
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.string	"ecx"
+	.byte	0x29
+	.byte	0x18
+	.long	0x70
+	.uleb128 0x5
+	.string	"edx"
+	.byte	0x29
+	.byte	0x1d
+	.long	0x70
+	.uleb128 0x5
+	.string	"ptr"
+	.byte	0x2a
+	.byte	0xb
+	.long	0xa9
+	.uleb128 0x2e
+	.uleb128 0x5
+	.string	"i"
+	.byte	0x2c
+	.byte	0xe
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF73
+	.byte	0x18
+	.long	0xb72
+	.uleb128 0xd
+	.long	.LASF74
+	.byte	0x18
+	.byte	0x29
+	.long	0xa9
+	.uleb128 0x5
+	.string	"ebx"
+	.byte	0x1a
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x5
+	.string	"edx"
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.string	"ecx"
+	.byte	0x1a
+	.byte	0x18
+	.long	0x70
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF75
+	.value	0x121
+	.uleb128 0x1d
+	.long	.LASF76
+	.value	0x11c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 .LVU55
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU78
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 .LVU106
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU56
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU91
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU86
+	.uleb128 .LVU95
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL32-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU89
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+	.uleb128 .LVU103
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU91
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU7
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU17
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -94
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU10
+	.uleb128 .LVU17
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU10
+	.uleb128 .LVU17
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU10
+	.uleb128 .LVU17
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU22
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU47
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -81
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU34
+	.uleb128 .LVU47
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU34
+	.uleb128 .LVU47
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU34
+	.uleb128 .LVU47
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU34
+	.uleb128 .LVU47
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU25
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU47
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -81
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU27
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU46
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 2147483646
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 2147483645
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU51
+	.uleb128 .LVU75
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1009
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1009
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1009
+	.sleb128 0
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU51
+	.uleb128 .LVU75
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+990
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+990
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+990
+	.sleb128 0
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU58
+	.uleb128 .LVU71
+	.uleb128 .LVU74
+	.uleb128 .LVU75
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU58
+	.uleb128 .LVU65
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+	.uleb128 .LVU74
+	.uleb128 .LVU75
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU54
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+	.uleb128 .LVU68
+	.uleb128 .LVU70
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x38
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x38
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU57
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU75
+	.uleb128 .LVU98
+	.uleb128 .LVU99
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU81
+	.uleb128 .LVU91
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1066
+	.sleb128 0
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU81
+	.uleb128 .LVU91
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1047
+	.sleb128 0
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU81
+	.uleb128 .LVU91
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1028
+	.sleb128 0
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU84
+	.uleb128 .LVU88
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU84
+	.uleb128 .LVU91
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU84
+	.uleb128 .LVU91
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU160
+	.uleb128 .LVU169
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU166
+	.uleb128 .LVU169
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF31:
+	.string	"q_keyboard"
+.LASF50:
+	.string	"idt_init"
+.LASF54:
+	.string	"memops_init"
+.LASF63:
+	.string	"baseFrequencyMHz"
+.LASF21:
+	.string	"KeyEvent_t"
+.LASF42:
+	.string	"lapic_init"
+.LASF11:
+	.string	"uint64_t"
+.LASF76:
+	.string	"disable_interrupts"
+.LASF3:
+	.string	"short int"
+.LASF45:
+	.string	"kmem_numa_init"
+.LASF33:
+	.string	"kmem_compact_background"
+.LASF57:
+	.string	"term_init"
+.LASF55:
+	.string	"kprintf"
+.LASF80:
+	.string	"kernel_main"
+.LASF44:
+	.string	"hpet_init"
+.LASF67:
+	.string	"get_cpu_frequency"
+.LASF28:
+	.string	"buff"
+.LASF46:
+	.string	"acpi_init"
+.LASF22:
+	.string	"num_pages_available"
+.LASF6:
+	.string	"uint8_t"
+.LASF35:
+	.string	"alloc_cpu_cache_drain"
+.LASF39:
+	.string	"cqueue_create"
+.LASF48:
+	.string	"kmem_init"
+.LASF61:
+	.string	"logicalProcessorsPerCore"
+.LASF79:
+	.string	"report_cpu_details"
+.LASF18:
+	.string	"event_type"
+.LASF59:
+	.string	"vendor"
+.LASF13:
+	.string	"long long int"
+.LASF78:
+	.string	"KeyEvent"
+.LASF71:
+	.string	"get_cpu_brand"
+.LASF40:
+	.string	"nvme_init"
+.LASF4:
+	.string	"long int"
+.LASF77:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF52:
+	.string	"cpu_local_init"
+.LASF5:
+	.string	"unsigned char"
+.LASF14:
+	.string	"long double"
+.LASF75:
+	.string	"enable_interrupts"
+.LASF62:
+	.string	"totalLogicalProcessors"
+.LASF41:
+	.string	"pci_init"
+.LASF60:
+	.string	"brand"
+.LASF37:
+	.string	"ps2_init"
+.LASF29:
+	.string	"num_items"
+.LASF2:
+	.string	"signed char"
+.LASF69:
+	.string	"levelType"
+.LASF9:
+	.string	"uint32_t"
+.LASF56:
+	.string	"term_fgcolor"
+.LASF10:
+	.string	"unsigned int"
+.LASF7:
+	.string	"uint16_t"
+.LASF49:
+	.string	"pit_disable_timer"
+.LASF36:
+	.string	"vm_init"
+.LASF64:
+	.string	"maxFrequencyMHz"
+.LASF51:
+	.string	"term_keyevent"
+.LASF47:
+	.string	"slab_init"
+.LASF27:
+	.string	"write_i"
+.LASF38:
+	.string	"cqueue_read"
+.LASF15:
+	.string	"char"
+.LASF20:
+	.string	"is_control"
+.LASF24:
+	.string	"lock"
+.LASF8:
+	.string	"short unsigned int"
+.LASF25:
+	.string	"spinlock_t"
+.LASF34:
+	.string	"kmem_zero_pool_fill"
+.LASF16:
+	.string	"_Bool"
+.LASF58:
+	.string	"init_serial"
+.LASF74:
+	.string	"buffer"
+.LASF12:
+	.string	"long unsigned int"
+.LASF53:
+	.string	"init_gdt"
+.LASF72:
+	.string	"brandString"
+.LASF65:
+	.string	"busFrequencyMHz"
+.LASF26:
+	.string	"read_i"
+.LASF32:
+	.string	"limine_base_revision"
+.LASF70:
+	.string	"level"
+.LASF19:
+	.string	"ascii"
+.LASF30:
+	.string	"CQueue_t"
+.LASF17:
+	.string	"scan_code"
+.LASF23:
+	.string	"scancode_map"
+.LASF68:
+	.string	"get_cpu_topology"
+.LASF66:
+	.string	"scanCode"
+.LASF43:
+	.string	"cpu_init"
+.LASF73:
+	.string	"get_cpu_vendor"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/kernel.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3636 @@
+	.file	"lapic.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/lapic.c"
+	.p2align 4
+	.globl	_check_lapic_cpuid
+	.type	_check_lapic_cpuid, @function
+_check_lapic_cpuid:
+.LFB30:
+	.file 1 "src/lapic.c"
+	.loc 1 60 31 view -0
+	.cfi_startproc
+	.loc 1 61 5 view .LVU1
+	.loc 1 62 5 view .LVU2
+.LVL0:
+.LBB64:
+.LBI64:
+	.file 2 "src/include/cpu.h"
+	.loc 2 240 20 view .LVU3
+.LBB65:
+	.loc 2 242 5 view .LVU4
+.LBE65:
+.LBE64:
+	.loc 1 60 31 is_stmt 0 view .LVU5
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB67:
+.LBB66:
+	.loc 2 242 5 view .LVU6
+#APP
+# 242 "src/include/cpu.h" 1
+	cpuid
+# 0 "" 2
+.LVL1:
+	.loc 2 242 5 view .LVU7
+#NO_APP
+.LBE66:
+.LBE67:
+	.loc 1 63 5 is_stmt 1 view .LVU8
+	.loc 1 63 17 is_stmt 0 view .LVU9
+	shrl	$9, %edx
+	.loc 1 64 1 view .LVU10
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	.loc 1 63 23 view .LVU11
+	movl	%edx, %eax
+	andl	$1, %eax
+	.loc 1 64 1 view .LVU12
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	_check_lapic_cpuid, .-_check_lapic_cpuid
+	.p2align 4
+	.globl	lapic_time_stop
+	.type	lapic_time_stop, @function
+lapic_time_stop:
+.LFB33:
+	.loc 1 79 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 5 view .LVU14
+.LVL2:
+.LBB68:
+.LBI68:
+	.loc 1 72 20 view .LVU15
+.LBB69:
+	.loc 1 74 5 view .LVU16
+	.loc 1 74 67 is_stmt 0 view .LVU17
+	movq	apic_base(%rip), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL3:
+	.loc 1 75 5 is_stmt 1 view .LVU18
+	.loc 1 75 12 is_stmt 0 view .LVU19
+	movl	$0, 896(%rax)
+.LVL4:
+	.loc 1 75 12 view .LVU20
+.LBE69:
+.LBE68:
+	.loc 1 81 5 is_stmt 1 view .LVU21
+.LBB70:
+.LBI70:
+	.loc 1 72 20 view .LVU22
+.LBB71:
+	.loc 1 74 5 view .LVU23
+	.loc 1 75 5 view .LVU24
+	.loc 1 75 12 is_stmt 0 view .LVU25
+	movl	$65536, 800(%rax)
+.LVL5:
+	.loc 1 75 12 view .LVU26
+.LBE71:
+.LBE70:
+	.loc 1 82 1 view .LVU27
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	lapic_time_stop, .-lapic_time_stop
+	.p2align 4
+	.globl	lapic_timer_init
+	.type	lapic_timer_init, @function
+lapic_timer_init:
+.LFB34:
+	.loc 1 88 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 89 5 view .LVU29
+.LVL6:
+.LBB72:
+.LBI72:
+	.loc 1 72 20 view .LVU30
+.LBB73:
+	.loc 1 74 5 view .LVU31
+.LBE73:
+.LBE72:
+	.loc 1 88 1 is_stmt 0 view .LVU32
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB76:
+.LBB74:
+	.loc 1 74 67 view .LVU33
+	movq	apic_base(%rip), %rax
+.LBE74:
+.LBE76:
+	.loc 1 96 5 view .LVU34
+	movl	$100, %edi
+.LBB77:
+.LBB75:
+	.loc 1 74 67 view .LVU35
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL7:
+	.loc 1 75 5 is_stmt 1 view .LVU36
+	.loc 1 75 12 is_stmt 0 view .LVU37
+	movl	$0, 992(%rax)
+.LVL8:
+	.loc 1 75 12 view .LVU38
+.LBE75:
+.LBE77:
+	.loc 1 90 5 is_stmt 1 view .LVU39
+.LBB78:
+.LBI78:
+	.loc 1 78 6 view .LVU40
+	.loc 1 80 5 view .LVU41
+.LBB79:
+.LBI79:
+	.loc 1 72 20 view .LVU42
+.LBB80:
+	.loc 1 74 5 view .LVU43
+	.loc 1 75 5 view .LVU44
+	.loc 1 75 12 is_stmt 0 view .LVU45
+	movl	$0, 896(%rax)
+.LVL9:
+	.loc 1 75 12 view .LVU46
+.LBE80:
+.LBE79:
+	.loc 1 81 5 is_stmt 1 view .LVU47
+.LBB81:
+.LBI81:
+	.loc 1 72 20 view .LVU48
+.LBB82:
+	.loc 1 74 5 view .LVU49
+	.loc 1 75 5 view .LVU50
+	.loc 1 75 12 is_stmt 0 view .LVU51
+	movl	$65536, 800(%rax)
+.LVL10:
+	.loc 1 75 12 view .LVU52
+.LBE82:
+.LBE81:
+.LBE78:
+	.loc 1 95 5 is_stmt 1 view .LVU53
+.LBB83:
+.LBI83:
+	.loc 1 72 20 view .LVU54
+.LBB84:
+	.loc 1 74 5 view .LVU55
+	.loc 1 75 5 view .LVU56
+	.loc 1 75 12 is_stmt 0 view .LVU57
+	movl	$-1, 896(%rax)
+.LVL11:
+	.loc 1 75 12 view .LVU58
+.LBE84:
+.LBE83:
+	.loc 1 96 5 is_stmt 1 view .LVU59
+	call	hpet_sleep_counter@PLT
+.LVL12:
+	.loc 1 97 5 view .LVU60
+.LBB85:
+.LBI85:
+	.loc 1 66 24 view .LVU61
+.LBB86:
+	.loc 1 68 5 view .LVU62
+	.loc 1 68 67 is_stmt 0 view .LVU63
+	movq	apic_base(%rip), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL13:
+	.loc 1 69 5 is_stmt 1 view .LVU64
+	.loc 1 69 12 is_stmt 0 view .LVU65
+	movl	912(%rax), %edx
+.LVL14:
+	.loc 1 69 12 view .LVU66
+.LBE86:
+.LBE85:
+	.loc 1 98 5 is_stmt 1 view .LVU67
+.LBB87:
+.LBI87:
+	.loc 1 78 6 view .LVU68
+	.loc 1 80 5 view .LVU69
+.LBB88:
+.LBI88:
+	.loc 1 72 20 view .LVU70
+.LBB89:
+	.loc 1 74 5 view .LVU71
+	.loc 1 75 5 view .LVU72
+	.loc 1 75 12 is_stmt 0 view .LVU73
+	movl	$0, 896(%rax)
+.LVL15:
+	.loc 1 75 12 view .LVU74
+.LBE89:
+.LBE88:
+	.loc 1 81 5 is_stmt 1 view .LVU75
+.LBB90:
+.LBI90:
+	.loc 1 72 20 view .LVU76
+.LBB91:
+	.loc 1 74 5 view .LVU77
+	.loc 1 75 5 view .LVU78
+	.loc 1 75 12 is_stmt 0 view .LVU79
+	movl	$65536, 800(%rax)
+.LVL16:
+	.loc 1 75 12 view .LVU80
+.LBE91:
+.LBE90:
+.LBE87:
+	.loc 1 101 5 is_stmt 1 view .LVU81
+	.loc 1 97 14 is_stmt 0 view .LVU82
+	notl	%edx
+.LVL17:
+	.loc 1 101 5 view .LVU83
+	leal	(%rdx,%rdx,4), %edx
+.LVL18:
+	.loc 1 101 5 view .LVU84
+	addl	%edx, %edx
+.LVL19:
+.LBB92:
+.LBI92:
+	.loc 1 72 20 is_stmt 1 view .LVU85
+.LBB93:
+	.loc 1 74 5 view .LVU86
+	.loc 1 75 5 view .LVU87
+	.loc 1 75 12 is_stmt 0 view .LVU88
+	movl	%edx, 896(%rax)
+.LVL20:
+	.loc 1 75 12 view .LVU89
+.LBE93:
+.LBE92:
+	.loc 1 102 5 is_stmt 1 view .LVU90
+.LBB94:
+.LBI94:
+	.loc 1 72 20 view .LVU91
+.LBB95:
+	.loc 1 74 5 view .LVU92
+	.loc 1 75 5 view .LVU93
+	.loc 1 75 12 is_stmt 0 view .LVU94
+	movl	$131107, 800(%rax)
+.LVL21:
+	.loc 1 75 12 view .LVU95
+.LBE95:
+.LBE94:
+	.loc 1 103 1 view .LVU96
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	lapic_timer_init, .-lapic_timer_init
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"LAPIC Base: %X\n"
+.LC1:
+	.string	"LAPIC ID: %d\n"
+.LC2:
+	.string	"LAPIC Version: %d\n"
+.LC3:
+	.string	"CPUID APIC Enabled: %d\n"
+.LC4:
+	.string	"MSR APIC Enabled: %d\n"
+	.text
+	.p2align 4
+	.globl	lapic_init
+	.type	lapic_init, @function
+lapic_init:
+.LFB35:
+	.loc 1 106 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 107 4 view .LVU98
+.LVL22:
+.LBB130:
+.LBI130:
+	.loc 2 310 19 view .LVU99
+.LBB131:
+	.loc 2 312 4 view .LVU100
+.LBB132:
+.LBI132:
+	.loc 2 294 19 view .LVU101
+.LBB133:
+	.loc 2 296 5 view .LVU102
+	.loc 2 298 5 view .LVU103
+.LBE133:
+.LBE132:
+.LBE131:
+.LBE130:
+	.loc 1 106 1 is_stmt 0 view .LVU104
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB139:
+.LBB138:
+.LBB135:
+.LBB134:
+	.loc 2 298 5 view .LVU105
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %rbp
+	
+# 0 "" 2
+.LVL23:
+	.loc 2 304 5 is_stmt 1 view .LVU106
+	.loc 2 304 5 is_stmt 0 view .LVU107
+#NO_APP
+.LBE134:
+.LBE135:
+	.loc 2 314 5 is_stmt 1 view .LVU108
+	.loc 2 317 9 view .LVU109
+.LBB136:
+.LBI136:
+	.loc 2 284 20 view .LVU110
+.LBB137:
+	.loc 2 286 5 view .LVU111
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE137:
+.LBE136:
+	.loc 2 320 5 view .LVU112
+.LVL24:
+	.loc 2 320 5 is_stmt 0 view .LVU113
+.LBE138:
+.LBE139:
+	.loc 1 109 5 is_stmt 1 view .LVU114
+.LBB140:
+.LBI140:
+	.loc 2 148 24 view .LVU115
+.LBB141:
+	.loc 2 150 5 view .LVU116
+	.loc 2 152 5 view .LVU117
+	movl	$27, %ecx
+#APP
+# 152 "src/include/cpu.h" 1
+	rdmsr
+# 0 "" 2
+.LVL25:
+	.loc 2 158 5 view .LVU118
+	.loc 2 158 5 is_stmt 0 view .LVU119
+#NO_APP
+.LBE141:
+.LBE140:
+	.loc 1 112 5 is_stmt 1 view .LVU120
+	.loc 1 112 28 is_stmt 0 view .LVU121
+	movl	%eax, %esi
+	.loc 1 114 5 view .LVU122
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 112 28 view .LVU123
+	andl	$-4096, %esi
+	.loc 1 112 15 view .LVU124
+	movq	%rsi, apic_base(%rip)
+	.loc 1 114 5 is_stmt 1 view .LVU125
+	call	kprintf@PLT
+.LVL26:
+	.loc 1 116 5 view .LVU126
+.LBB142:
+.LBI142:
+	.loc 1 66 24 view .LVU127
+.LBB143:
+	.loc 1 68 5 view .LVU128
+	.loc 1 68 67 is_stmt 0 view .LVU129
+	movq	apic_base(%rip), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL27:
+	.loc 1 69 5 is_stmt 1 view .LVU130
+.LBE143:
+.LBE142:
+	.loc 1 119 5 is_stmt 0 view .LVU131
+	leaq	.LC1(%rip), %rdi
+.LBB145:
+.LBB144:
+	.loc 1 69 12 view .LVU132
+	movl	32(%rax), %esi
+.LVL28:
+	.loc 1 69 12 view .LVU133
+.LBE144:
+.LBE145:
+	.loc 1 116 14 view .LVU134
+	movl	%esi, lapic_id(%rip)
+	.loc 1 117 5 is_stmt 1 view .LVU135
+.LVL29:
+.LBB146:
+.LBI146:
+	.loc 1 66 24 view .LVU136
+.LBB147:
+	.loc 1 68 5 view .LVU137
+	.loc 1 69 5 view .LVU138
+	.loc 1 69 12 is_stmt 0 view .LVU139
+	movl	48(%rax), %r12d
+.LVL30:
+	.loc 1 69 12 view .LVU140
+.LBE147:
+.LBE146:
+	.loc 1 119 5 is_stmt 1 view .LVU141
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL31:
+	.loc 1 120 5 view .LVU142
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	movl	%r12d, %esi
+	call	kprintf@PLT
+.LVL32:
+	.loc 1 123 5 view .LVU143
+	.loc 1 123 79 is_stmt 0 view .LVU144
+	movq	apic_base(%rip), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL33:
+	.loc 1 124 5 is_stmt 1 view .LVU145
+	.loc 1 124 14 is_stmt 0 view .LVU146
+	movl	(%rax), %r12d
+.LVL34:
+	.loc 1 126 5 is_stmt 1 view .LVU147
+.LBB148:
+.LBI148:
+	.loc 1 60 10 view .LVU148
+.LBB149:
+	.loc 1 61 5 view .LVU149
+	.loc 1 62 5 view .LVU150
+.LBB150:
+.LBI150:
+	.loc 2 240 20 view .LVU151
+.LBB151:
+	.loc 2 242 5 view .LVU152
+#APP
+# 242 "src/include/cpu.h" 1
+	cpuid
+# 0 "" 2
+.LVL35:
+	.loc 2 242 5 is_stmt 0 view .LVU153
+#NO_APP
+.LBE151:
+.LBE150:
+	.loc 1 63 5 is_stmt 1 view .LVU154
+	.loc 1 63 17 is_stmt 0 view .LVU155
+	shrl	$9, %edx
+.LBE149:
+.LBE148:
+	.loc 1 126 5 view .LVU156
+	xorl	%eax, %eax
+	leaq	.LC3(%rip), %rdi
+.LBB153:
+.LBB152:
+	.loc 1 63 23 view .LVU157
+	andl	$1, %edx
+	movl	%edx, %esi
+.LBE152:
+.LBE153:
+	.loc 1 126 5 view .LVU158
+	call	kprintf@PLT
+.LVL36:
+	.loc 1 127 5 is_stmt 1 view .LVU159
+	movl	%r12d, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL37:
+	.loc 1 130 5 view .LVU160
+.LBB154:
+.LBI154:
+	.loc 1 66 24 view .LVU161
+.LBB155:
+	.loc 1 68 5 view .LVU162
+	.loc 1 68 67 is_stmt 0 view .LVU163
+	movq	apic_base(%rip), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL38:
+	.loc 1 69 5 is_stmt 1 view .LVU164
+	.loc 1 69 12 is_stmt 0 view .LVU165
+	movl	240(%rax), %edx
+.LVL39:
+	.loc 1 69 12 view .LVU166
+.LBE155:
+.LBE154:
+	.loc 1 130 5 view .LVU167
+	orl	$511, %edx
+.LVL40:
+.LBB156:
+.LBI156:
+	.loc 1 72 20 is_stmt 1 view .LVU168
+.LBB157:
+	.loc 1 74 5 view .LVU169
+	.loc 1 75 5 view .LVU170
+	.loc 1 75 12 is_stmt 0 view .LVU171
+	movl	%edx, 240(%rax)
+.LVL41:
+	.loc 1 75 12 view .LVU172
+.LBE157:
+.LBE156:
+	.loc 1 132 5 is_stmt 1 view .LVU173
+	xorl	%eax, %eax
+	call	lapic_timer_init
+.LVL42:
+	.loc 1 134 5 view .LVU174
+.LBB158:
+.LBI158:
+	.loc 2 310 19 view .LVU175
+.LBB159:
+	.loc 2 312 4 view .LVU176
+.LBB160:
+.LBI160:
+	.loc 2 294 19 view .LVU177
+.LBB161:
+	.loc 2 296 5 view .LVU178
+	.loc 2 298 5 view .LVU179
+#APP
+# 298 "src/include/cpu.h" 1
+	pushfq
+	pop %rax
+	
+# 0 "" 2
+.LVL43:
+	.loc 2 304 5 view .LVU180
+	.loc 2 304 5 is_stmt 0 view .LVU181
+#NO_APP
+.LBE161:
+.LBE160:
+	.loc 2 314 5 is_stmt 1 view .LVU182
+	.loc 2 314 8 is_stmt 0 view .LVU183
+	testl	$512, %ebp
+	je	.L8
+	.loc 2 315 9 is_stmt 1 view .LVU184
+.LBB162:
+.LBI162:
+	.loc 2 289 20 view .LVU185
+.LBB163:
+	.loc 2 291 5 view .LVU186
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE163:
+.LBE162:
+.LBE159:
+.LBE158:
+	.loc 1 135 1 is_stmt 0 view .LVU187
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL44:
+	.loc 1 135 1 view .LVU188
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL45:
+	.loc 1 135 1 view .LVU189
+	ret
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.cfi_restore_state
+.LBB167:
+.LBB166:
+	.loc 2 317 9 is_stmt 1 view .LVU190
+.LBB164:
+.LBI164:
+	.loc 2 284 20 view .LVU191
+.LBB165:
+	.loc 2 286 5 view .LVU192
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE165:
+.LBE164:
+	.loc 2 320 5 view .LVU193
+.LVL47:
+	.loc 2 320 5 is_stmt 0 view .LVU194
+.LBE166:
+.LBE167:
+	.loc 1 135 1 view .LVU195
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 135 1 view .LVU196
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LVL49:
+	.loc 1 135 1 view .LVU197
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	lapic_init, .-lapic_init
+	.p2align 4
+	.globl	lapic_raiseint
+	.type	lapic_raiseint, @function
+lapic_raiseint:
+.LVL50:
+.LFB36:
+	.loc 1 141 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 142 5 view .LVU199
+.LBB168:
+.LBB169:
+	.loc 1 74 67 is_stmt 0 view .LVU200
+	movq	apic_base(%rip), %rax
+.LBE169:
+.LBE168:
+	.loc 1 142 5 view .LVU201
+	sall	$24, %edi
+.LVL51:
+.LBB171:
+.LBI168:
+	.loc 1 72 20 is_stmt 1 view .LVU202
+.LBB170:
+	.loc 1 74 5 view .LVU203
+	.loc 1 74 67 is_stmt 0 view .LVU204
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL52:
+	.loc 1 75 5 is_stmt 1 view .LVU205
+	.loc 1 75 12 is_stmt 0 view .LVU206
+	movl	%edi, 784(%rax)
+.LVL53:
+	.loc 1 75 12 view .LVU207
+.LBE170:
+.LBE171:
+	.loc 1 143 5 is_stmt 1 view .LVU208
+.LBB172:
+.LBI172:
+	.loc 1 72 20 view .LVU209
+.LBB173:
+	.loc 1 74 5 view .LVU210
+	.loc 1 75 5 view .LVU211
+	.loc 1 75 12 is_stmt 0 view .LVU212
+	movl	%esi, 768(%rax)
+.LVL54:
+	.loc 1 75 12 view .LVU213
+.LBE173:
+.LBE172:
+	.loc 1 144 1 view .LVU214
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	lapic_raiseint, .-lapic_raiseint
+	.p2align 4
+	.globl	lapic_eoi
+	.type	lapic_eoi, @function
+lapic_eoi:
+.LFB37:
+	.loc 1 150 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 151 5 view .LVU216
+.LVL55:
+.LBB174:
+.LBI174:
+	.loc 1 72 20 view .LVU217
+.LBB175:
+	.loc 1 74 5 view .LVU218
+	.loc 1 74 67 is_stmt 0 view .LVU219
+	movq	apic_base(%rip), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL56:
+	.loc 1 75 5 is_stmt 1 view .LVU220
+	.loc 1 75 12 is_stmt 0 view .LVU221
+	movl	$0, 176(%rax)
+.LVL57:
+	.loc 1 75 12 view .LVU222
+.LBE175:
+.LBE174:
+	.loc 1 152 1 view .LVU223
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	lapic_eoi, .-lapic_eoi
+	.globl	lapic_id
+	.bss
+	.align 4
+	.type	lapic_id, @object
+	.size	lapic_id, 4
+lapic_id:
+	.zero	4
+	.globl	apic_base
+	.align 8
+	.type	apic_base, @object
+	.size	apic_base, 8
+apic_base:
+	.zero	8
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "src/include/lapic.h"
+	.file 5 "src/include/mem.h"
+	.file 6 "src/include/str.h"
+	.file 7 "src/include/hpet.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xbb8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF45
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x13
+	.long	.LASF8
+	.byte	0x34
+	.byte	0x16
+	.long	0x68
+	.uleb128 0x1d
+	.long	0x58
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x13
+	.long	.LASF9
+	.byte	0x37
+	.byte	0x1b
+	.long	0x7a
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x14
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x1b
+	.long	0x58
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x1e
+	.long	0x9a
+	.uleb128 0xd
+	.long	0xa1
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF14
+	.uleb128 0x14
+	.long	.LASF16
+	.byte	0x5
+	.byte	0xb2
+	.long	0x6f
+	.uleb128 0x1f
+	.long	.LASF17
+	.byte	0x1
+	.byte	0x39
+	.byte	0xa
+	.long	0x6f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	apic_base
+	.uleb128 0x20
+	.long	0x81
+	.byte	0x1
+	.byte	0x3a
+	.byte	0xa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lapic_id
+	.uleb128 0x15
+	.long	.LASF18
+	.byte	0x6
+	.byte	0x30
+	.long	0xf7
+	.uleb128 0x16
+	.long	0xa6
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x1c
+	.long	0x108
+	.uleb128 0x16
+	.long	0x6f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0x95
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16c
+	.uleb128 0x7
+	.long	0x965
+	.quad	.LBI174
+	.byte	.LVU217
+	.quad	.LBB174
+	.quad	.LBE174-.LBB174
+	.byte	0x97
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST77
+	.long	.LVUS77
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF46
+	.byte	0x1
+	.byte	0x8c
+	.byte	0x6
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x23a
+	.uleb128 0x23
+	.long	.LASF15
+	.byte	0x1
+	.byte	0x8c
+	.byte	0x1e
+	.long	0x58
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x24
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x8c
+	.byte	0x31
+	.long	0x58
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.long	0x965
+	.quad	.LBI168
+	.byte	.LVU202
+	.long	.LLRL68
+	.byte	0x8e
+	.byte	0x5
+	.long	0x1f2
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x6
+	.long	.LLRL68
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x965
+	.quad	.LBI172
+	.byte	.LVU209
+	.quad	.LBB172
+	.quad	.LBE172-.LBB172
+	.byte	0x8f
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST74
+	.long	.LVUS74
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF21
+	.byte	0x69
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x63a
+	.uleb128 0x9
+	.long	.LASF22
+	.byte	0x6b
+	.byte	0x9
+	.long	0xab
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x9
+	.long	.LASF23
+	.byte	0x75
+	.byte	0xe
+	.long	0x58
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x7b
+	.byte	0x18
+	.long	0x63a
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x9
+	.long	.LASF25
+	.byte	0x7c
+	.byte	0xe
+	.long	0x58
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x8
+	.long	0x9e7
+	.quad	.LBI130
+	.byte	.LVU99
+	.long	.LLRL43
+	.byte	0x6b
+	.byte	0x12
+	.long	0x329
+	.uleb128 0x1
+	.long	0x9f9
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x6
+	.long	.LLRL43
+	.uleb128 0x2
+	.long	0xa06
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x25
+	.long	0xa13
+	.quad	.LBI132
+	.byte	.LVU101
+	.long	.LLRL46
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0x307
+	.uleb128 0x6
+	.long	.LLRL46
+	.uleb128 0x2
+	.long	0xa25
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa39
+	.quad	.LBI136
+	.byte	.LVU110
+	.quad	.LBB136
+	.quad	.LBE136-.LBB136
+	.value	0x13d
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0xa71
+	.quad	.LBI140
+	.byte	.LVU115
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.byte	0x6d
+	.byte	0x11
+	.long	0x36d
+	.uleb128 0x1
+	.long	0xa80
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x2
+	.long	0xa8c
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xa
+	.long	0xa98
+	.byte	0
+	.uleb128 0x8
+	.long	0x995
+	.quad	.LBI142
+	.byte	.LVU127
+	.long	.LLRL50
+	.byte	0x74
+	.byte	0x10
+	.long	0x3a6
+	.uleb128 0x1
+	.long	0x9a4
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x6
+	.long	.LLRL50
+	.uleb128 0x2
+	.long	0x9b0
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x995
+	.quad	.LBI146
+	.byte	.LVU136
+	.quad	.LBB146
+	.quad	.LBE146-.LBB146
+	.byte	0x75
+	.byte	0x1d
+	.long	0x3e5
+	.uleb128 0x1
+	.long	0x9a4
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x2
+	.long	0x9b0
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0x8
+	.long	0x9bd
+	.quad	.LBI148
+	.byte	.LVU148
+	.long	.LLRL55
+	.byte	0x7e
+	.byte	0x5
+	.long	0x45d
+	.uleb128 0x6
+	.long	.LLRL55
+	.uleb128 0xa
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x9da
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x7
+	.long	0xa40
+	.quad	.LBI150
+	.byte	.LVU151
+	.quad	.LBB150
+	.quad	.LBE150-.LBB150
+	.byte	0x3e
+	.uleb128 0x1
+	.long	0xa61
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1
+	.long	0xa57
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0xa4b
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x995
+	.quad	.LBI154
+	.byte	.LVU161
+	.quad	.LBB154
+	.quad	.LBE154-.LBB154
+	.byte	0x82
+	.byte	0x18
+	.long	0x49c
+	.uleb128 0x1
+	.long	0x9a4
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x2
+	.long	0x9b0
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI156
+	.byte	.LVU168
+	.quad	.LBB156
+	.quad	.LBE156-.LBB156
+	.byte	0x82
+	.byte	0x5
+	.long	0x4e8
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0x8
+	.long	0x9e7
+	.quad	.LBI158
+	.byte	.LVU175
+	.long	.LLRL65
+	.byte	0x86
+	.byte	0x5
+	.long	0x585
+	.uleb128 0x1
+	.long	0x9f9
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x6
+	.long	.LLRL65
+	.uleb128 0xa
+	.long	0xa06
+	.uleb128 0x26
+	.long	0xa13
+	.quad	.LBI160
+	.byte	.LVU177
+	.quad	.LBB160
+	.quad	.LBE160-.LBB160
+	.byte	0x2
+	.value	0x138
+	.byte	0x11
+	.long	0x543
+	.uleb128 0xa
+	.long	0xa25
+	.byte	0
+	.uleb128 0xf
+	.long	0xa32
+	.quad	.LBI162
+	.byte	.LVU185
+	.quad	.LBB162
+	.quad	.LBE162-.LBB162
+	.value	0x13b
+	.uleb128 0xf
+	.long	0xa39
+	.quad	.LBI164
+	.byte	.LVU191
+	.quad	.LBB164
+	.quad	.LBE164-.LBB164
+	.value	0x13d
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL26
+	.long	0xe5
+	.long	0x5a4
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL31
+	.long	0xe5
+	.long	0x5c3
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL32
+	.long	0xe5
+	.long	0x5e8
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL36
+	.long	0xe5
+	.long	0x607
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL37
+	.long	0xe5
+	.long	0x62c
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x27
+	.quad	.LVL42
+	.long	0x63f
+	.byte	0
+	.uleb128 0xd
+	.long	0x63
+	.uleb128 0xe
+	.long	.LASF26
+	.byte	0x57
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x95c
+	.uleb128 0x9
+	.long	.LASF27
+	.byte	0x61
+	.byte	0xe
+	.long	0x58
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.long	0x965
+	.quad	.LBI72
+	.byte	.LVU30
+	.long	.LLRL12
+	.byte	0x59
+	.byte	0x5
+	.long	0x6b4
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.long	.LLRL12
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x95c
+	.quad	.LBI78
+	.byte	.LVU40
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.byte	0x5a
+	.byte	0x5
+	.long	0x76c
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI79
+	.byte	.LVU42
+	.quad	.LBB79
+	.quad	.LBE79-.LBB79
+	.byte	0x50
+	.byte	0x5
+	.long	0x724
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x7
+	.long	0x965
+	.quad	.LBI81
+	.byte	.LVU48
+	.quad	.LBB81
+	.quad	.LBE81-.LBB81
+	.byte	0x51
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI83
+	.byte	.LVU54
+	.quad	.LBB83
+	.quad	.LBE83-.LBB83
+	.byte	0x5f
+	.byte	0x5
+	.long	0x7b8
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x3
+	.long	0x995
+	.quad	.LBI85
+	.byte	.LVU61
+	.quad	.LBB85
+	.quad	.LBE85-.LBB85
+	.byte	0x61
+	.byte	0x2a
+	.long	0x7f7
+	.uleb128 0x1
+	.long	0x9a4
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	0x9b0
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x3
+	.long	0x95c
+	.quad	.LBI87
+	.byte	.LVU68
+	.quad	.LBB87
+	.quad	.LBE87-.LBB87
+	.byte	0x62
+	.byte	0x5
+	.long	0x8af
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI88
+	.byte	.LVU70
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.byte	0x50
+	.byte	0x5
+	.long	0x867
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x7
+	.long	0x965
+	.quad	.LBI90
+	.byte	.LVU76
+	.quad	.LBB90
+	.quad	.LBE90-.LBB90
+	.byte	0x51
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI92
+	.byte	.LVU85
+	.quad	.LBB92
+	.quad	.LBE92-.LBB92
+	.byte	0x65
+	.byte	0x5
+	.long	0x8fb
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI94
+	.byte	.LVU91
+	.quad	.LBB94
+	.quad	.LBE94-.LBB94
+	.byte	0x66
+	.byte	0x5
+	.long	0x947
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x28
+	.quad	.LVL12
+	.long	0xf7
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x17
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x48
+	.long	0x995
+	.uleb128 0xc
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x48
+	.byte	0x29
+	.long	0x58
+	.uleb128 0x10
+	.string	"val"
+	.byte	0x1
+	.byte	0x48
+	.byte	0x3a
+	.long	0x58
+	.uleb128 0x11
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x18
+	.long	0x63a
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x42
+	.long	0x58
+	.long	0x9bd
+	.uleb128 0xc
+	.long	.LASF28
+	.byte	0x1
+	.byte	0x42
+	.byte	0x2c
+	.long	0x58
+	.uleb128 0x11
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x44
+	.byte	0x18
+	.long	0x63a
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xa
+	.long	0x58
+	.byte	0x1
+	.long	0x9e7
+	.uleb128 0x12
+	.string	"eax"
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x12
+	.string	"edx"
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x13
+	.long	0x58
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF32
+	.byte	0x2
+	.value	0x136
+	.byte	0x13
+	.long	0xab
+	.byte	0x3
+	.long	0xa13
+	.uleb128 0x2c
+	.long	.LASF33
+	.byte	0x2
+	.value	0x136
+	.byte	0x2c
+	.long	0xab
+	.uleb128 0x19
+	.long	.LASF34
+	.value	0x138
+	.byte	0x9
+	.long	0xab
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF36
+	.byte	0x2
+	.value	0x126
+	.byte	0x13
+	.long	0xab
+	.byte	0x3
+	.long	0xa32
+	.uleb128 0x19
+	.long	.LASF37
+	.value	0x128
+	.byte	0x13
+	.long	0x7a
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF38
+	.value	0x121
+	.uleb128 0x1a
+	.long	.LASF39
+	.value	0x11c
+	.uleb128 0x17
+	.long	.LASF40
+	.byte	0x2
+	.byte	0xf0
+	.long	0xa6c
+	.uleb128 0xc
+	.long	.LASF41
+	.byte	0x2
+	.byte	0xf0
+	.byte	0x1e
+	.long	0x3c
+	.uleb128 0x10
+	.string	"a"
+	.byte	0x2
+	.byte	0xf0
+	.byte	0x2e
+	.long	0xa6c
+	.uleb128 0x10
+	.string	"d"
+	.byte	0x2
+	.byte	0xf0
+	.byte	0x3b
+	.long	0xa6c
+	.byte	0
+	.uleb128 0xd
+	.long	0x58
+	.uleb128 0x18
+	.long	.LASF42
+	.byte	0x2
+	.byte	0x94
+	.long	0x6f
+	.long	0xaa5
+	.uleb128 0xc
+	.long	.LASF43
+	.byte	0x2
+	.byte	0x94
+	.byte	0x2a
+	.long	0x58
+	.uleb128 0x12
+	.string	"low"
+	.byte	0x2
+	.byte	0x96
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x11
+	.long	.LASF44
+	.byte	0x2
+	.byte	0x96
+	.byte	0x13
+	.long	0x58
+	.byte	0
+	.uleb128 0x2e
+	.long	0x9bd
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb10
+	.uleb128 0xa
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x9da
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2f
+	.long	0xa40
+	.quad	.LBI64
+	.byte	.LVU3
+	.long	.LLRL1
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x5
+	.uleb128 0x1
+	.long	0xa61
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1
+	.long	0xa57
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0xa4b
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	0x95c
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3
+	.long	0x965
+	.quad	.LBI68
+	.byte	.LVU15
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0x50
+	.byte	0x5
+	.long	0xb73
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x7
+	.long	0x965
+	.quad	.LBI70
+	.byte	.LVU22
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0x51
+	.uleb128 0x1
+	.long	0x97c
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x970
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2
+	.long	0x988
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS75:
+	.uleb128 .LVU217
+	.uleb128 .LVU222
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU217
+	.uleb128 .LVU222
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xb0
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU220
+	.uleb128 .LVU222
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 176
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x310
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU205
+	.uleb128 .LVU207
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 784
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU209
+	.uleb128 .LVU213
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU209
+	.uleb128 .LVU213
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x300
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU211
+	.uleb128 .LVU213
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 768
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU113
+	.uleb128 .LVU188
+	.uleb128 .LVU190
+	.uleb128 .LVU196
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x200
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x200
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU140
+	.uleb128 .LVU147
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU145
+	.uleb128 .LVU153
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU147
+	.uleb128 .LVU189
+	.uleb128 .LVU190
+	.uleb128 .LVU197
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU99
+	.uleb128 .LVU113
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU107
+	.uleb128 .LVU188
+	.uleb128 .LVU190
+	.uleb128 .LVU196
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x200
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x200
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU115
+	.uleb128 .LVU119
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x4b
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU118
+	.uleb128 .LVU119
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU127
+	.uleb128 .LVU133
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU136
+	.uleb128 .LVU140
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU138
+	.uleb128 .LVU140
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 48
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU151
+	.uleb128 .LVU153
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1031
+	.sleb128 0
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU151
+	.uleb128 .LVU153
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+1026
+	.sleb128 0
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU151
+	.uleb128 .LVU153
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU161
+	.uleb128 .LVU166
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU164
+	.uleb128 .LVU166
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 240
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU168
+	.uleb128 .LVU172
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU168
+	.uleb128 .LVU172
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xf0
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 240
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU175
+	.uleb128 .LVU188
+	.uleb128 .LVU190
+	.uleb128 .LVU194
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x200
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0x200
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU66
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU30
+	.uleb128 .LVU38
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU30
+	.uleb128 .LVU38
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3e0
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU36
+	.uleb128 .LVU38
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 992
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU42
+	.uleb128 .LVU46
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU42
+	.uleb128 .LVU46
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x380
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 896
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x320
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 800
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU54
+	.uleb128 .LVU58
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU54
+	.uleb128 .LVU58
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x380
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU56
+	.uleb128 .LVU58
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 896
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU61
+	.uleb128 .LVU66
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x390
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 912
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU70
+	.uleb128 .LVU74
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU70
+	.uleb128 .LVU74
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x380
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU72
+	.uleb128 .LVU74
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 896
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU76
+	.uleb128 .LVU80
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU76
+	.uleb128 .LVU80
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x320
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 800
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU85
+	.uleb128 .LVU89
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU85
+	.uleb128 .LVU89
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x380
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 896
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU91
+	.uleb128 .LVU95
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x20023
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU91
+	.uleb128 .LVU95
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x320
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 800
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2522
+	.sleb128 0
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2510
+	.sleb128 0
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU3
+	.uleb128 .LVU7
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x380
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 896
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU22
+	.uleb128 .LVU26
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU22
+	.uleb128 .LVU26
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x320
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 800
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB139-.Ltext0
+	.uleb128 .LBE139-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB148-.Ltext0
+	.uleb128 .LBE148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB167-.Ltext0
+	.uleb128 .LBE167-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB168-.Ltext0
+	.uleb128 .LBE168-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF20:
+	.string	"lapic_eoi"
+.LASF30:
+	.string	"_check_lapic_cpuid"
+.LASF28:
+	.string	"offset"
+.LASF34:
+	.string	"state"
+.LASF17:
+	.string	"apic_base"
+.LASF36:
+	.string	"interrupt_state"
+.LASF38:
+	.string	"enable_interrupts"
+.LASF24:
+	.string	"apic_reg"
+.LASF42:
+	.string	"read_msr"
+.LASF9:
+	.string	"uint64_t"
+.LASF25:
+	.string	"apic_flags"
+.LASF39:
+	.string	"disable_interrupts"
+.LASF5:
+	.string	"unsigned char"
+.LASF29:
+	.string	"pAddr"
+.LASF21:
+	.string	"lapic_init"
+.LASF10:
+	.string	"long unsigned int"
+.LASF6:
+	.string	"short unsigned int"
+.LASF26:
+	.string	"lapic_timer_init"
+.LASF33:
+	.string	"enabled"
+.LASF35:
+	.string	"lapic_write"
+.LASF27:
+	.string	"ticksin100ms"
+.LASF32:
+	.string	"set_interrupt_state"
+.LASF44:
+	.string	"high"
+.LASF41:
+	.string	"code"
+.LASF46:
+	.string	"lapic_raiseint"
+.LASF40:
+	.string	"cpuid"
+.LASF7:
+	.string	"unsigned int"
+.LASF37:
+	.string	"flags"
+.LASF48:
+	.string	"lapic_time_stop"
+.LASF13:
+	.string	"char"
+.LASF22:
+	.string	"istate"
+.LASF19:
+	.string	"hpet_sleep_counter"
+.LASF45:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF11:
+	.string	"long long int"
+.LASF16:
+	.string	"vmm_higher_half_offset"
+.LASF47:
+	.string	"vector"
+.LASF15:
+	.string	"lapic_id"
+.LASF31:
+	.string	"lapic_read"
+.LASF23:
+	.string	"apic_version"
+.LASF3:
+	.string	"short int"
+.LASF8:
+	.string	"uint32_t"
+.LASF4:
+	.string	"long int"
+.LASF18:
+	.string	"kprintf"
+.LASF12:
+	.string	"long double"
+.LASF2:
+	.string	"signed char"
+.LASF14:
+	.string	"_Bool"
+.LASF43:
+	.string	"msr_id"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/lapic.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
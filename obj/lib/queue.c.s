@@ -0,0 +1,1830 @@
+	.file	"queue.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/lib/queue.c"
+	.p2align 4
+	.type	_cqueue_ctor, @function
+_cqueue_ctor:
+.LVL0:
+.LFB3:
+	.file 1 "src/lib/queue.c"
+	.loc 1 34 1 view -0
+	.cfi_startproc
+	.loc 1 35 5 view .LVU1
+	.loc 1 36 5 view .LVU2
+	.loc 1 38 15 is_stmt 0 view .LVU3
+	movl	$0, (%rdi)
+	.loc 1 36 13 view .LVU4
+	movq	$0, 8(%rdi)
+	.loc 1 37 5 is_stmt 1 view .LVU5
+	.loc 1 39 16 is_stmt 0 view .LVU6
+	movl	$0, 4(%rdi)
+	.loc 1 37 12 view .LVU7
+	movl	$0, 16(%rdi)
+	.loc 1 38 5 is_stmt 1 view .LVU8
+	.loc 1 39 5 view .LVU9
+	.loc 1 40 5 view .LVU10
+	.loc 1 40 18 is_stmt 0 view .LVU11
+	movl	$0, 20(%rdi)
+	.loc 1 41 5 is_stmt 1 view .LVU12
+	.loc 1 41 18 is_stmt 0 view .LVU13
+	movb	$0, 24(%rdi)
+	.loc 1 42 1 view .LVU14
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	_cqueue_ctor, .-_cqueue_ctor
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"cqueue"
+	.text
+	.p2align 4
+	.globl	cqueue_create
+	.type	cqueue_create, @function
+cqueue_create:
+.LVL1:
+.LFB4:
+	.loc 1 49 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 5 view .LVU16
+	.loc 1 49 1 is_stmt 0 view .LVU17
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 50 22 view .LVU18
+	movq	cqueue_cache(%rip), %rdi
+.LVL2:
+	.loc 1 50 8 view .LVU19
+	testq	%rdi, %rdi
+	je	.L12
+	.loc 1 54 5 is_stmt 1 view .LVU20
+	.loc 1 54 30 is_stmt 0 view .LVU21
+	call	kmem_cache_alloc@PLT
+.LVL3:
+	movq	%rax, %rbx
+.LVL4:
+	.loc 1 55 5 is_stmt 1 view .LVU22
+	.loc 1 55 8 is_stmt 0 view .LVU23
+	testq	%rax, %rax
+	je	.L5
+.L14:
+	.loc 1 59 5 is_stmt 1 view .LVU24
+	.loc 1 59 26 is_stmt 0 view .LVU25
+	movl	%ebp, %edi
+	salq	$2, %rdi
+	call	malloc@PLT
+.LVL5:
+	.loc 1 59 13 view .LVU26
+	movq	%rax, 8(%rbx)
+	.loc 1 60 5 is_stmt 1 view .LVU27
+	.loc 1 60 8 is_stmt 0 view .LVU28
+	testq	%rax, %rax
+	je	.L13
+	.loc 1 65 5 is_stmt 1 view .LVU29
+	.loc 1 65 12 is_stmt 0 view .LVU30
+	movl	%ebp, 16(%rbx)
+	.loc 1 66 5 is_stmt 1 view .LVU31
+.LVL6:
+.L3:
+	.loc 1 67 1 is_stmt 0 view .LVU32
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL7:
+	.loc 1 67 1 view .LVU33
+	ret
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.cfi_restore_state
+	.loc 1 51 9 is_stmt 1 view .LVU34
+	.loc 1 51 24 is_stmt 0 view .LVU35
+	leaq	_cqueue_ctor(%rip), %rcx
+	movl	$64, %edx
+	movl	$25, %esi
+	leaq	.LC0(%rip), %rdi
+	call	kmem_cache_create@PLT
+.LVL9:
+	movq	%rax, %rdi
+	.loc 1 51 22 view .LVU36
+	movq	%rax, cqueue_cache(%rip)
+	.loc 1 54 5 is_stmt 1 view .LVU37
+	.loc 1 54 30 is_stmt 0 view .LVU38
+	call	kmem_cache_alloc@PLT
+.LVL10:
+	movq	%rax, %rbx
+.LVL11:
+	.loc 1 55 5 is_stmt 1 view .LVU39
+	.loc 1 55 8 is_stmt 0 view .LVU40
+	testq	%rax, %rax
+	jne	.L14
+.L5:
+	.loc 1 56 15 view .LVU41
+	xorl	%ebx, %ebx
+	jmp	.L3
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 61 9 is_stmt 1 view .LVU42
+	movq	cqueue_cache(%rip), %rdi
+	movq	%rbx, %rsi
+	.loc 1 56 15 is_stmt 0 view .LVU43
+	xorl	%ebx, %ebx
+.LVL13:
+	.loc 1 61 9 view .LVU44
+	call	kmem_cache_free@PLT
+.LVL14:
+	.loc 1 62 9 is_stmt 1 view .LVU45
+	jmp	.L3
+	.cfi_endproc
+.LFE4:
+	.size	cqueue_create, .-cqueue_create
+	.p2align 4
+	.globl	cqueue_write
+	.type	cqueue_write, @function
+cqueue_write:
+.LVL15:
+.LFB5:
+	.loc 1 75 1 view -0
+	.cfi_startproc
+	.loc 1 76 5 view .LVU47
+.LBB14:
+.LBI14:
+	.file 2 "src/include/atomic.h"
+	.loc 2 27 20 view .LVU48
+.LBB15:
+	.loc 2 29 5 view .LVU49
+.LBE15:
+.LBE14:
+	.loc 1 75 1 is_stmt 0 view .LVU50
+	movq	%rdi, %rcx
+.LBB17:
+.LBB16:
+	.loc 2 29 37 view .LVU51
+	leaq	24(%rdi), %rax
+	.loc 2 29 12 view .LVU52
+	movl	$1, %edi
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 2 31 5 is_stmt 1 view .LVU53
+	.loc 2 29 12 view .LVU54
+	movl	%edi, %edx
+	xchgb	(%rax), %dl
+	testb	%dl, %dl
+	jne	.L16
+.LVL17:
+	.loc 2 29 12 is_stmt 0 view .LVU55
+.LBE16:
+.LBE17:
+	.loc 1 78 5 is_stmt 1 view .LVU56
+	.loc 1 78 10 is_stmt 0 view .LVU57
+	movl	20(%rcx), %eax
+	.loc 1 78 8 view .LVU58
+	cmpl	16(%rcx), %eax
+	je	.L21
+	.loc 1 85 5 is_stmt 1 view .LVU59
+	.loc 1 85 14 is_stmt 0 view .LVU60
+	movl	4(%rcx), %eax
+	.loc 1 85 25 view .LVU61
+	movq	8(%rcx), %rdx
+	movl	%esi, (%rdx,%rax,4)
+	.loc 1 86 5 is_stmt 1 view .LVU62
+	.loc 1 86 6 is_stmt 0 view .LVU63
+	movl	4(%rcx), %eax
+	.loc 1 86 15 view .LVU64
+	addl	$1, %eax
+	movl	%eax, 4(%rcx)
+	.loc 1 88 5 is_stmt 1 view .LVU65
+	.loc 1 88 10 is_stmt 0 view .LVU66
+	movl	4(%rcx), %eax
+	.loc 1 88 8 view .LVU67
+	cmpl	16(%rcx), %eax
+	jne	.L19
+	.loc 1 90 9 is_stmt 1 view .LVU68
+	.loc 1 90 20 is_stmt 0 view .LVU69
+	movl	$0, 4(%rcx)
+.L19:
+	.loc 1 93 5 is_stmt 1 view .LVU70
+.LVL18:
+.LBB18:
+.LBI18:
+	.loc 2 34 20 view .LVU71
+.LBB19:
+	.loc 2 36 5 view .LVU72
+	movb	$0, 24(%rcx)
+.LVL19:
+	.loc 2 36 5 is_stmt 0 view .LVU73
+.LBE19:
+.LBE18:
+	.loc 1 95 5 is_stmt 1 view .LVU74
+	.loc 1 95 6 is_stmt 0 view .LVU75
+	movl	20(%rcx), %eax
+	.loc 1 95 17 view .LVU76
+	addl	$1, %eax
+	movl	%eax, 20(%rcx)
+	.loc 1 97 5 is_stmt 1 view .LVU77
+	.loc 1 97 11 is_stmt 0 view .LVU78
+	movl	$1, %eax
+	.loc 1 98 1 view .LVU79
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.loc 1 81 9 is_stmt 1 view .LVU80
+.LVL20:
+.LBB20:
+.LBI20:
+	.loc 2 34 20 view .LVU81
+.LBB21:
+	.loc 2 36 5 view .LVU82
+.LBE21:
+.LBE20:
+	.loc 1 82 15 is_stmt 0 view .LVU83
+	xorl	%eax, %eax
+.LBB23:
+.LBB22:
+	.loc 2 36 5 view .LVU84
+	movb	$0, 24(%rcx)
+.LVL21:
+	.loc 2 36 5 view .LVU85
+.LBE22:
+.LBE23:
+	.loc 1 82 9 is_stmt 1 view .LVU86
+	.loc 1 82 15 is_stmt 0 view .LVU87
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	cqueue_write, .-cqueue_write
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC1:
+	.string	"FATAL: Attempted to dequeue without first checking 'num_items' > 0."
+	.text
+	.p2align 4
+	.globl	cqueue_read
+	.type	cqueue_read, @function
+cqueue_read:
+.LVL22:
+.LFB6:
+	.loc 1 105 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 106 5 view .LVU89
+.LBB30:
+.LBI30:
+	.loc 2 27 20 view .LVU90
+.LBB31:
+	.loc 2 29 5 view .LVU91
+	.loc 2 29 37 is_stmt 0 view .LVU92
+	leaq	24(%rdi), %rax
+	.loc 2 29 12 view .LVU93
+	movl	$1, %ecx
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.loc 2 31 5 is_stmt 1 view .LVU94
+	.loc 2 29 12 view .LVU95
+	movl	%ecx, %edx
+	xchgb	(%rax), %dl
+	testb	%dl, %dl
+	jne	.L23
+.LVL23:
+	.loc 2 29 12 is_stmt 0 view .LVU96
+.LBE31:
+.LBE30:
+	.loc 1 108 5 is_stmt 1 view .LVU97
+	.loc 1 108 10 is_stmt 0 view .LVU98
+	movl	20(%rdi), %eax
+	.loc 1 108 8 view .LVU99
+	testl	%eax, %eax
+	je	.L31
+	.loc 1 114 5 is_stmt 1 view .LVU100
+	.loc 1 114 29 is_stmt 0 view .LVU101
+	movl	(%rdi), %eax
+	.loc 1 114 14 view .LVU102
+	movq	8(%rdi), %rdx
+	movl	(%rdx,%rax,4), %edx
+.LVL24:
+	.loc 1 116 5 is_stmt 1 view .LVU103
+	.loc 1 116 6 is_stmt 0 view .LVU104
+	movl	(%rdi), %eax
+	.loc 1 116 14 view .LVU105
+	addl	$1, %eax
+	movl	%eax, (%rdi)
+	.loc 1 118 5 is_stmt 1 view .LVU106
+	.loc 1 118 10 is_stmt 0 view .LVU107
+	movl	(%rdi), %eax
+	.loc 1 118 8 view .LVU108
+	cmpl	16(%rdi), %eax
+	jne	.L26
+	.loc 1 120 9 is_stmt 1 view .LVU109
+	.loc 1 120 19 is_stmt 0 view .LVU110
+	movl	$0, (%rdi)
+.L26:
+	.loc 1 123 5 is_stmt 1 view .LVU111
+	.loc 1 123 6 is_stmt 0 view .LVU112
+	movl	20(%rdi), %eax
+	.loc 1 123 17 view .LVU113
+	subl	$1, %eax
+	movl	%eax, 20(%rdi)
+	.loc 1 125 5 is_stmt 1 view .LVU114
+.LVL25:
+.LBB32:
+.LBI32:
+	.loc 2 34 20 view .LVU115
+.LBB33:
+	.loc 2 36 5 view .LVU116
+.LBE33:
+.LBE32:
+	.loc 1 128 1 is_stmt 0 view .LVU117
+	movl	%edx, %eax
+.LBB35:
+.LBB34:
+	.loc 2 36 5 view .LVU118
+	movb	$0, 24(%rdi)
+.LVL26:
+	.loc 2 36 5 view .LVU119
+.LBE34:
+.LBE35:
+	.loc 1 127 5 is_stmt 1 view .LVU120
+	.loc 1 128 1 is_stmt 0 view .LVU121
+	ret
+.LVL27:
+.L31:
+	.loc 1 109 9 is_stmt 1 view .LVU122
+	.loc 1 105 1 is_stmt 0 view .LVU123
+	pushq	%rdx
+	.cfi_def_cfa_offset 16
+	.loc 1 109 9 view .LVU124
+	leaq	.LC1(%rip), %rdi
+.LVL28:
+	.loc 1 109 9 view .LVU125
+	call	kprintf@PLT
+.LVL29:
+	.loc 1 110 9 is_stmt 1 view .LVU126
+.LBB36:
+.LBI36:
+	.file 3 "src/kernel.h"
+	.loc 3 27 20 view .LVU127
+.LBB37:
+	.loc 3 29 5 view .LVU128
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.L25:
+	.loc 3 30 5 view .LVU129
+	.loc 3 31 9 view .LVU130
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 3 30 5 view .LVU131
+#NO_APP
+	jmp	.L25
+.LBE37:
+.LBE36:
+	.cfi_endproc
+.LFE6:
+	.size	cqueue_read, .-cqueue_read
+	.local	cqueue_cache
+	.comm	cqueue_cache,8,8
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 5 "src/include/queue.h"
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 "src/include/str.h"
+	.file 8 "src/include/slab.h"
+	.file 9 "src/include/alloc.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4bc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF33
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x6
+	.long	.LASF7
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.long	.LASF8
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x75
+	.uleb128 0x15
+	.long	0x64
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.byte	0x17
+	.long	0x99
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x18
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0x83
+	.uleb128 0xd
+	.byte	0x19
+	.byte	0x5
+	.byte	0x19
+	.long	0xfc
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x17
+	.long	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x17
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x1c
+	.byte	0xf
+	.long	0xfc
+	.byte	0x8
+	.uleb128 0x16
+	.string	"len"
+	.byte	0x5
+	.byte	0x1d
+	.byte	0xe
+	.long	0x64
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x17
+	.long	0x70
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x10
+	.long	0x99
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x20
+	.byte	0x1b
+	.long	0xa5
+	.uleb128 0x6
+	.long	.LASF18
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x7c
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF19
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF20
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF21
+	.uleb128 0x18
+	.long	0x129
+	.uleb128 0x4
+	.long	0x130
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF22
+	.uleb128 0x4
+	.long	0x101
+	.uleb128 0x19
+	.long	.LASF34
+	.uleb128 0x1a
+	.long	.LASF35
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x1a
+	.long	0x161
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cqueue_cache
+	.uleb128 0x4
+	.long	0x146
+	.uleb128 0xe
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x30
+	.long	0x178
+	.uleb128 0x2
+	.long	0x135
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF24
+	.byte	0x8
+	.byte	0x38
+	.long	0x18e
+	.uleb128 0x2
+	.long	0x161
+	.uleb128 0x2
+	.long	0x127
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF25
+	.byte	0x9
+	.byte	0x27
+	.byte	0x7
+	.long	0x127
+	.long	0x1a4
+	.uleb128 0x2
+	.long	0x10d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF26
+	.byte	0x8
+	.byte	0x37
+	.byte	0x7
+	.long	0x127
+	.long	0x1ba
+	.uleb128 0x2
+	.long	0x161
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x36
+	.byte	0x13
+	.long	0x161
+	.long	0x1df
+	.uleb128 0x2
+	.long	0x135
+	.uleb128 0x2
+	.long	0x10d
+	.uleb128 0x2
+	.long	0x10d
+	.uleb128 0x2
+	.long	0x1df
+	.byte	0
+	.uleb128 0x4
+	.long	0x1e4
+	.uleb128 0x1c
+	.long	0x1ef
+	.uleb128 0x2
+	.long	0x127
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF28
+	.byte	0x68
+	.byte	0xa
+	.long	0x64
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c7
+	.uleb128 0xa
+	.string	"q"
+	.byte	0x68
+	.byte	0x20
+	.long	0x141
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x72
+	.byte	0xe
+	.long	0x64
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xf
+	.long	0x4aa
+	.quad	.LBI30
+	.byte	.LVU90
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.byte	0x6a
+	.long	0x265
+	.uleb128 0x7
+	.long	0x4b3
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0x10
+	.long	0x48c
+	.quad	.LBI32
+	.byte	.LVU115
+	.long	.LLRL12
+	.byte	0x7d
+	.long	0x28a
+	.uleb128 0x7
+	.long	0x499
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0x1d
+	.long	0x483
+	.quad	.LBI36
+	.byte	.LVU127
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.byte	0x1
+	.byte	0x6e
+	.byte	0x9
+	.uleb128 0x1e
+	.quad	.LVL29
+	.long	0x166
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF29
+	.byte	0x4a
+	.byte	0x5
+	.long	0x13a
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x381
+	.uleb128 0xa
+	.string	"q"
+	.byte	0x4a
+	.byte	0x1c
+	.long	0x141
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1f
+	.string	"val"
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x28
+	.long	0x64
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x10
+	.long	0x4aa
+	.quad	.LBI14
+	.byte	.LVU48
+	.long	.LLRL4
+	.byte	0x4c
+	.long	0x32c
+	.uleb128 0x7
+	.long	0x4b3
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0xf
+	.long	0x48c
+	.quad	.LBI18
+	.byte	.LVU71
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.byte	0x5d
+	.long	0x35d
+	.uleb128 0x7
+	.long	0x499
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x20
+	.long	0x48c
+	.quad	.LBI20
+	.byte	.LVU81
+	.long	.LLRL7
+	.byte	0x1
+	.byte	0x51
+	.byte	0x9
+	.uleb128 0x7
+	.long	0x499
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF30
+	.byte	0x30
+	.byte	0xb
+	.long	0x141
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x445
+	.uleb128 0xa
+	.string	"len"
+	.byte	0x30
+	.byte	0x22
+	.long	0x64
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xb
+	.string	"q"
+	.byte	0x36
+	.byte	0xf
+	.long	0x141
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xc
+	.quad	.LVL3
+	.long	0x1a4
+	.uleb128 0x11
+	.quad	.LVL5
+	.long	0x18e
+	.long	0x3f3
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x24
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL9
+	.long	0x1ba
+	.long	0x42a
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x49
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_cqueue_ctor
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL10
+	.long	0x1a4
+	.uleb128 0xc
+	.quad	.LVL14
+	.long	0x178
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x21
+	.byte	0xd
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x483
+	.uleb128 0x22
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x21
+	.byte	0x20
+	.long	0x127
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.string	"q"
+	.byte	0x23
+	.byte	0xf
+	.long	0x141
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x23
+	.string	"hcf"
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x24
+	.long	.LASF37
+	.byte	0x2
+	.byte	0x22
+	.byte	0x14
+	.byte	0x3
+	.long	0x4a5
+	.uleb128 0x12
+	.long	.LASF32
+	.byte	0x22
+	.byte	0x30
+	.long	0x4a5
+	.byte	0
+	.uleb128 0x4
+	.long	0x99
+	.uleb128 0x25
+	.long	.LASF38
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x12
+	.long	.LASF32
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x4a5
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU103
+	.uleb128 .LVU122
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU90
+	.uleb128 .LVU96
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU115
+	.uleb128 .LVU119
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU48
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU81
+	.uleb128 .LVU85
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU22
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU32
+	.uleb128 .LVU39
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU45
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU2
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB32-.Ltext0
+	.uleb128 .LBE32-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF11:
+	.string	"spinlock_t"
+.LASF34:
+	.string	"SlabCache"
+.LASF32:
+	.string	"pLock"
+.LASF37:
+	.string	"spinlock_unlock"
+.LASF4:
+	.string	"long int"
+.LASF23:
+	.string	"kprintf"
+.LASF27:
+	.string	"kmem_cache_create"
+.LASF5:
+	.string	"unsigned char"
+.LASF17:
+	.string	"CQueue_t"
+.LASF10:
+	.string	"long unsigned int"
+.LASF36:
+	.string	"_cqueue_ctor"
+.LASF6:
+	.string	"short unsigned int"
+.LASF18:
+	.string	"size_t"
+.LASF15:
+	.string	"buff"
+.LASF30:
+	.string	"cqueue_create"
+.LASF24:
+	.string	"kmem_cache_free"
+.LASF9:
+	.string	"unsigned int"
+.LASF31:
+	.string	"pObject"
+.LASF16:
+	.string	"num_items"
+.LASF21:
+	.string	"char"
+.LASF7:
+	.string	"uint8_t"
+.LASF29:
+	.string	"cqueue_write"
+.LASF38:
+	.string	"spinlock_lock"
+.LASF33:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF19:
+	.string	"long long int"
+.LASF26:
+	.string	"kmem_cache_alloc"
+.LASF3:
+	.string	"short int"
+.LASF35:
+	.string	"cqueue_cache"
+.LASF8:
+	.string	"uint32_t"
+.LASF28:
+	.string	"cqueue_read"
+.LASF14:
+	.string	"write_i"
+.LASF20:
+	.string	"long double"
+.LASF2:
+	.string	"signed char"
+.LASF12:
+	.string	"lock"
+.LASF22:
+	.string	"_Bool"
+.LASF13:
+	.string	"read_i"
+.LASF25:
+	.string	"malloc"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/lib/queue.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
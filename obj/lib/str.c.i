@@ -0,0 +1,617 @@
+# 0 "src/lib/str.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/lib/str.c"
+# 18 "src/lib/str.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 19 "src/lib/str.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 20 "src/lib/str.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 21 "src/lib/str.c" 2
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 22 "src/lib/str.c" 2
+# 1 "src/include/terminal.h" 1
+# 22 "src/include/terminal.h"
+# 1 "src/include/ps2.h" 1
+# 22 "src/include/ps2.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/ps2.h" 2
+
+
+
+
+
+
+typedef struct KeyEvent {
+    uint8_t scan_code;
+    uint8_t event_type;
+    char ascii;
+    
+# 33 "src/include/ps2.h" 3 4
+   _Bool 
+# 33 "src/include/ps2.h"
+        is_control;
+} KeyEvent_t;
+
+extern KeyEvent_t* scancode_map[];
+
+uint8_t ps2_read();
+uint8_t ps2_read_no_wait();
+void ps2_init();
+# 23 "src/include/terminal.h" 2
+
+
+
+
+void term_init();
+void tprintf(const char format[], ...);
+void term_fgcolor(uint32_t color);
+void term_bgcolor(uint32_t color);
+void term_keyevent(KeyEvent_t *ke);
+void term_cblink();
+void term_clear();
+# 23 "src/lib/str.c" 2
+
+
+void reverse(char str[], size_t length)
+{
+    size_t start = 0;
+    size_t end = length - 1;
+
+    while (start < end) {
+
+        char temp = str[start];
+        str[start] = str[end];
+        str[end] = temp;
+
+
+        ++start;
+        --end;
+    }
+}
+
+
+size_t itoa(int num, char str[], size_t base)
+{
+    size_t i = 0;
+
+
+    int isNegative = 0;
+    if (num < 0)
+    {
+        isNegative = 1;
+        num = -num;
+    }
+
+
+    if (num == 0)
+    {
+        str[i++] = '0';
+    }
+
+
+    while (num != 0)
+    {
+        size_t rem = num % base;
+        str[i++] = (rem > 9) ? (rem - 10) + 'a' : rem + '0';
+        num = num / base;
+    }
+
+
+    if (isNegative)
+    {
+        str[i++] = '-';
+    }
+
+
+    str[i] = '\0';
+
+
+    reverse(str, i);
+
+    return i;
+}
+
+
+size_t __ultoa(uint64_t num, char str[], size_t base)
+{
+    size_t i = 0;
+
+
+    do
+    {
+        size_t rem = num % base;
+        str[i++] = (rem > 9) ? (rem - 10) + 'a' : rem + '0';
+        num = num / base;
+    } while (num != 0);
+
+
+    if (base == 16) {
+        while (i < 16) {
+            str[i++] = '0';
+        }
+    }
+
+
+    str[i] = '\0';
+
+
+    reverse(str, i);
+
+    return i;
+}
+
+
+
+
+
+size_t __ultoua(uint64_t num, char str[], size_t base)
+{
+    size_t i = 0;
+
+
+    do
+    {
+        size_t rem = num % base;
+        str[i++] = (rem > 9) ? (rem - 10) + 'A' : rem + '0';
+        num = num / base;
+    } while (num != 0);
+
+
+    if (base == 16) {
+        while (i < 16) {
+            str[i++] = '0';
+        }
+    }
+
+
+    str[i] = '\0';
+
+
+    reverse(str, i);
+
+    return i;
+}
+
+
+size_t ltoa(int64_t num, char str[], size_t base)
+{
+    size_t i = 0;
+
+
+    int isNegative = 0;
+    if (num < 0)
+    {
+        isNegative = 1;
+        num = -num;
+    }
+
+
+    if (num == 0)
+    {
+        str[i++] = '0';
+    }
+
+
+    while (num != 0)
+    {
+        size_t rem = num % base;
+        str[i++] = (rem > 9) ? (rem - 10) + 'a' : rem + '0';
+        num = num / base;
+    }
+
+
+    if (isNegative)
+    {
+        str[i++] = '-';
+    }
+
+
+    str[i] = '\0';
+
+
+    reverse(str, i);
+
+    return i;
+}
+# 198 "src/lib/str.c"
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args)
+{
+    size_t bufferIndex = 0;
+
+
+    for (size_t i = 0; format[i] != '\0'; ++i) {
+        if (format[i] == '%') {
+            ++i;
+
+
+            if (format[i] == 'd') {
+                int value = 
+# 209 "src/lib/str.c" 3 4
+                           __builtin_va_arg(
+# 209 "src/lib/str.c"
+                           args
+# 209 "src/lib/str.c" 3 4
+                           ,
+# 209 "src/lib/str.c"
+                           int
+# 209 "src/lib/str.c" 3 4
+                           )
+# 209 "src/lib/str.c"
+                                            ;
+                bufferIndex += itoa(value, buffer + bufferIndex, 10);
+            } else if (format[i] == 'x') {
+                uint64_t value = 
+# 212 "src/lib/str.c" 3 4
+                                __builtin_va_arg(
+# 212 "src/lib/str.c"
+                                args
+# 212 "src/lib/str.c" 3 4
+                                ,
+# 212 "src/lib/str.c"
+                                uint64_t
+# 212 "src/lib/str.c" 3 4
+                                )
+# 212 "src/lib/str.c"
+                                                      ;
+                bufferIndex += __ultoa(value, buffer + bufferIndex, 16);
+            } else if (format[i] == 'X') {
+                uint64_t value = 
+# 215 "src/lib/str.c" 3 4
+                                __builtin_va_arg(
+# 215 "src/lib/str.c"
+                                args
+# 215 "src/lib/str.c" 3 4
+                                ,
+# 215 "src/lib/str.c"
+                                uint64_t
+# 215 "src/lib/str.c" 3 4
+                                )
+# 215 "src/lib/str.c"
+                                                      ;
+                bufferIndex += __ultoua(value, buffer + bufferIndex, 16);
+            } else if (format[i] == 's') {
+                char *str = 
+# 218 "src/lib/str.c" 3 4
+                           __builtin_va_arg(
+# 218 "src/lib/str.c"
+                           args
+# 218 "src/lib/str.c" 3 4
+                           ,
+# 218 "src/lib/str.c"
+                           char*
+# 218 "src/lib/str.c" 3 4
+                           )
+# 218 "src/lib/str.c"
+                                              ;
+                while (*str != '\0') {
+                    buffer[bufferIndex++] = *str++;
+                }
+            } else if (format[i] == 'c') {
+                int ch = 
+# 223 "src/lib/str.c" 3 4
+                        __builtin_va_arg(
+# 223 "src/lib/str.c"
+                        args
+# 223 "src/lib/str.c" 3 4
+                        ,
+# 223 "src/lib/str.c"
+                        int
+# 223 "src/lib/str.c" 3 4
+                        )
+# 223 "src/lib/str.c"
+                                         ;
+                buffer[bufferIndex++] = (char)ch;
+            } else if (format[i] == 'l' && format[i+1] == 'u') {
+                ++i;
+                uint64_t value = 
+# 227 "src/lib/str.c" 3 4
+                                __builtin_va_arg(
+# 227 "src/lib/str.c"
+                                args
+# 227 "src/lib/str.c" 3 4
+                                ,
+# 227 "src/lib/str.c"
+                                uint64_t
+# 227 "src/lib/str.c" 3 4
+                                )
+# 227 "src/lib/str.c"
+                                                      ;
+                bufferIndex += __ultoa(value, buffer + bufferIndex, 10);
+            } else if (format[i] == 'l' && format[i+1] == 'd') {
+                ++i;
+                int64_t value = 
+# 231 "src/lib/str.c" 3 4
+                               __builtin_va_arg(
+# 231 "src/lib/str.c"
+                               args
+# 231 "src/lib/str.c" 3 4
+                               ,
+# 231 "src/lib/str.c"
+                               int64_t
+# 231 "src/lib/str.c" 3 4
+                               )
+# 231 "src/lib/str.c"
+                                                    ;
+                bufferIndex += ltoa(value, buffer + bufferIndex, 10);
+            }
+        }
+        else {
+
+            if (bufferIndex < size - 1) {
+                buffer[bufferIndex++] = format[i];
+            }
+            else {
+
+                break;
+            }
+        }
+    }
+
+
+    if (bufferIndex < size) {
+        buffer[bufferIndex] = '\0';
+    }
+    else {
+
+        buffer[size - 1] = '\0';
+    }
+
+    return bufferIndex;
+}
+
+int snprintf(char buffer[], size_t size, const char format[], ...)
+{
+    va_list args;
+    
+# 262 "src/lib/str.c" 3 4
+   __builtin_va_start(
+# 262 "src/lib/str.c"
+   args
+# 262 "src/lib/str.c" 3 4
+   ,
+# 262 "src/lib/str.c"
+   format
+# 262 "src/lib/str.c" 3 4
+   )
+# 262 "src/lib/str.c"
+                         ;
+    int r = vsnprintf(buffer, size, format, args);
+    
+# 264 "src/lib/str.c" 3 4
+   __builtin_va_end(
+# 264 "src/lib/str.c"
+   args
+# 264 "src/lib/str.c" 3 4
+   )
+# 264 "src/lib/str.c"
+               ;
+
+    return r;
+}
+
+size_t strlen(const char *str)
+{
+    size_t len = 0;
+
+    for (int i = 0; i < 65535; i++) {
+        if (str[i] == '\0') {
+            return len;
+        }
+        len++;
+    }
+
+    return -1;
+}
+
+int strcmp(const char *l, const char *r)
+{
+    while (*l && *r) {
+        if (*l != *r) {
+            return -1;
+        }
+
+        l++;
+        r++;
+    }
+
+    return 0;
+}
+
+
+
+
+void kprintf(const char format[], ...)
+{
+    char buffer[256];
+
+    va_list args;
+    
+# 305 "src/lib/str.c" 3 4
+   __builtin_va_start(
+# 305 "src/lib/str.c"
+   args
+# 305 "src/lib/str.c" 3 4
+   ,
+# 305 "src/lib/str.c"
+   format
+# 305 "src/lib/str.c" 3 4
+   )
+# 305 "src/lib/str.c"
+                         ;
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    
+# 307 "src/lib/str.c" 3 4
+   __builtin_va_end(
+# 307 "src/lib/str.c"
+   args
+# 307 "src/lib/str.c" 3 4
+   )
+# 307 "src/lib/str.c"
+               ;
+
+    write_serial_str((uint16_t)0x3F8, buffer);
+
+    tprintf(buffer);
+}
+
+
+
+
+
+
+void sprint_binary8(char buff[], uint8_t ch)
+{
+    for (int i = 0; i < 8; i++) {
+        buff[7-i] = ch & (1 << i) ? '1' : '0';
+    }
+
+    buff[8] = '\0';
+}
+
+
+
+
+
+
+void sprint_binary16(char buff[], uint16_t ch)
+{
+    buff[17] = '\0';
+    int bitIndex, charIndex = 0;
+
+    for (bitIndex = 0; bitIndex < 16; bitIndex++) {
+        buff[charIndex++] = ((ch << bitIndex) & 0x8000) ? '1' : '0';
+
+        if ((bitIndex + 1) % 8 == 0 && bitIndex != 15) {
+            buff[charIndex++] = ' ';
+        }
+    }
+}
+
+
+
+
+
+
+void sprint_binary32(char buff[], uint32_t ch)
+{
+    buff[35] = '\0';
+    int bitIndex, charIndex = 0;
+
+    for (bitIndex = 0; bitIndex < 32; bitIndex++) {
+        buff[charIndex++] = ((ch << bitIndex) & 0x80000000) ? '1' : '0';
+
+        if ((bitIndex + 1) % 8 == 0 && bitIndex != 31) {
+            buff[charIndex++] = ' ';
+        }
+    }
+}
+
+
+
+
+
+
+void sprint_binary64(char buff[], uint64_t ch)
+{
+    buff[71] = '\0';
+    int bitIndex, charIndex = 0;
+
+    for (bitIndex = 0; bitIndex < 64; bitIndex++) {
+        buff[charIndex++] = ((ch << bitIndex) & 0x8000000000000000) ? '1' : '0';
+
+        if ((bitIndex + 1) % 8 == 0 && bitIndex != 63) {
+            buff[charIndex++] = ' ';
+        }
+    }
+}
@@ -0,0 +1,7360 @@
+	.file	"str.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/lib/str.c"
+	.p2align 4
+	.globl	reverse
+	.type	reverse, @function
+reverse:
+.LVL0:
+.LFB0:
+	.file 1 "src/lib/str.c"
+	.loc 1 26 1 view -0
+	.cfi_startproc
+	.loc 1 27 5 view .LVU1
+	.loc 1 28 5 view .LVU2
+	.loc 1 30 5 view .LVU3
+	.loc 1 30 18 view .LVU4
+	subq	$1, %rsi
+.LVL1:
+	.loc 1 30 18 is_stmt 0 view .LVU5
+	je	.L1
+	.loc 1 27 12 view .LVU6
+	xorl	%eax, %eax
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+.LBB3:
+	.loc 1 32 9 is_stmt 1 view .LVU7
+	.loc 1 32 14 is_stmt 0 view .LVU8
+	movzbl	(%rdi,%rax), %edx
+.LVL3:
+	.loc 1 33 9 is_stmt 1 view .LVU9
+	.loc 1 33 25 is_stmt 0 view .LVU10
+	movzbl	(%rdi,%rsi), %ecx
+	.loc 1 33 20 view .LVU11
+	movb	%cl, (%rdi,%rax)
+	.loc 1 34 9 is_stmt 1 view .LVU12
+	.loc 1 37 9 is_stmt 0 view .LVU13
+	addq	$1, %rax
+.LVL4:
+	.loc 1 34 18 view .LVU14
+	movb	%dl, (%rdi,%rsi)
+	.loc 1 37 9 is_stmt 1 view .LVU15
+.LVL5:
+	.loc 1 38 9 view .LVU16
+	subq	$1, %rsi
+.LVL6:
+	.loc 1 38 9 is_stmt 0 view .LVU17
+.LBE3:
+	.loc 1 30 18 is_stmt 1 view .LVU18
+	cmpq	%rsi, %rax
+	jb	.L3
+.LVL7:
+.L1:
+	.loc 1 40 1 is_stmt 0 view .LVU19
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	reverse, .-reverse
+	.p2align 4
+	.globl	itoa
+	.type	itoa, @function
+itoa:
+.LVL8:
+.LFB1:
+	.loc 1 44 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 44 1 is_stmt 0 view .LVU21
+	movl	%edi, %eax
+	.loc 1 45 5 is_stmt 1 view .LVU22
+.LVL9:
+	.loc 1 48 5 view .LVU23
+	.loc 1 49 5 view .LVU24
+	.loc 1 44 1 is_stmt 0 view .LVU25
+	movq	%rsi, %rcx
+	movq	%rdx, %r8
+	.loc 1 49 8 view .LVU26
+	testl	%edi, %edi
+	js	.L25
+	.loc 1 56 5 is_stmt 1 view .LVU27
+	.loc 1 56 8 is_stmt 0 view .LVU28
+	jne	.L19
+	.loc 1 58 9 is_stmt 1 view .LVU29
+.LVL10:
+	.loc 1 62 16 view .LVU30
+	.loc 1 70 5 view .LVU31
+	.loc 1 76 5 view .LVU32
+	.loc 1 58 18 is_stmt 0 view .LVU33
+	movl	$48, %eax
+	.loc 1 58 14 view .LVU34
+	movl	$1, %r8d
+	.loc 1 58 18 view .LVU35
+	movw	%ax, (%rsi)
+	.loc 1 79 5 is_stmt 1 view .LVU36
+.LVL11:
+.LBB8:
+.LBI8:
+	.loc 1 25 6 view .LVU37
+.LBB9:
+	.loc 1 27 5 view .LVU38
+	.loc 1 28 5 view .LVU39
+	.loc 1 30 5 view .LVU40
+	.loc 1 30 18 view .LVU41
+.L9:
+	.loc 1 30 18 is_stmt 0 view .LVU42
+.LBE9:
+.LBE8:
+	.loc 1 82 1 view .LVU43
+	movq	%r8, %rax
+	ret
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 51 9 is_stmt 1 view .LVU44
+	.loc 1 52 9 view .LVU45
+	.loc 1 52 13 is_stmt 0 view .LVU46
+	negl	%eax
+.LVL13:
+	.loc 1 56 5 is_stmt 1 view .LVU47
+	.loc 1 62 16 view .LVU48
+	.loc 1 51 20 is_stmt 0 view .LVU49
+	movl	$1, %r11d
+.LVL14:
+.L11:
+	.loc 1 51 20 view .LVU50
+	xorl	%r9d, %r9d
+	jmp	.L15
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+.LBB12:
+	.loc 1 65 14 view .LVU51
+	movq	%rdx, %r9
+.LVL16:
+.L15:
+	.loc 1 64 9 is_stmt 1 view .LVU52
+	.loc 1 64 26 is_stmt 0 view .LVU53
+	movslq	%eax, %rsi
+	xorl	%edx, %edx
+	movq	%rsi, %rax
+	.loc 1 64 26 view .LVU54
+	divq	%r8
+.LVL17:
+	.loc 1 65 9 is_stmt 1 view .LVU55
+	.loc 1 65 43 is_stmt 0 view .LVU56
+	leal	87(%rdx), %r10d
+	leal	48(%rdx), %edi
+	cmpq	$10, %rdx
+	cmovnb	%r10d, %edi
+	.loc 1 65 14 view .LVU57
+	leaq	1(%r9), %rdx
+.LVL18:
+	.loc 1 65 18 view .LVU58
+	movb	%dil, -1(%rcx,%rdx)
+	.loc 1 66 9 is_stmt 1 view .LVU59
+.LVL19:
+	.loc 1 66 9 is_stmt 0 view .LVU60
+.LBE12:
+	.loc 1 62 16 is_stmt 1 view .LVU61
+	cmpq	%r8, %rsi
+	jnb	.L20
+	.loc 1 70 5 view .LVU62
+	.loc 1 72 12 is_stmt 0 view .LVU63
+	leaq	(%rcx,%rdx), %rax
+	.loc 1 70 8 view .LVU64
+	testl	%r11d, %r11d
+	je	.L21
+	.loc 1 72 9 is_stmt 1 view .LVU65
+	.loc 1 72 18 is_stmt 0 view .LVU66
+	movb	$45, (%rax)
+	.loc 1 72 14 view .LVU67
+	leaq	2(%r9), %r8
+.LVL20:
+.L16:
+	.loc 1 76 5 is_stmt 1 view .LVU68
+	.loc 1 76 12 is_stmt 0 view .LVU69
+	movb	$0, (%rcx,%r8)
+	.loc 1 79 5 is_stmt 1 view .LVU70
+.LVL21:
+.LBB13:
+	.loc 1 25 6 view .LVU71
+.LBB11:
+	.loc 1 27 5 view .LVU72
+	.loc 1 28 5 view .LVU73
+	.loc 1 30 5 view .LVU74
+	.loc 1 30 18 view .LVU75
+	.loc 1 27 12 is_stmt 0 view .LVU76
+	xorl	%eax, %eax
+	.loc 1 30 18 view .LVU77
+	testq	%rdx, %rdx
+	je	.L9
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+.LBB10:
+	.loc 1 32 9 is_stmt 1 view .LVU78
+	.loc 1 32 14 is_stmt 0 view .LVU79
+	movzbl	(%rcx,%rax), %esi
+.LVL23:
+	.loc 1 33 9 is_stmt 1 view .LVU80
+	.loc 1 33 25 is_stmt 0 view .LVU81
+	movzbl	(%rcx,%rdx), %edi
+	.loc 1 33 20 view .LVU82
+	movb	%dil, (%rcx,%rax)
+	.loc 1 34 9 is_stmt 1 view .LVU83
+	.loc 1 37 9 is_stmt 0 view .LVU84
+	addq	$1, %rax
+.LVL24:
+	.loc 1 34 18 view .LVU85
+	movb	%sil, (%rcx,%rdx)
+	.loc 1 37 9 is_stmt 1 view .LVU86
+.LVL25:
+	.loc 1 38 9 view .LVU87
+	subq	$1, %rdx
+.LVL26:
+	.loc 1 38 9 is_stmt 0 view .LVU88
+.LBE10:
+	.loc 1 30 18 is_stmt 1 view .LVU89
+	cmpq	%rdx, %rax
+	jb	.L17
+.LBE11:
+.LBE13:
+	.loc 1 82 1 is_stmt 0 view .LVU90
+	movq	%r8, %rax
+.LVL27:
+	.loc 1 82 1 view .LVU91
+	ret
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.loc 1 48 9 view .LVU92
+	xorl	%r11d, %r11d
+	jmp	.L11
+.LVL29:
+.L21:
+.LBB14:
+	.loc 1 65 14 view .LVU93
+	movq	%rdx, %r8
+.LVL30:
+	.loc 1 65 14 view .LVU94
+.LBE14:
+	movq	%r9, %rdx
+.LVL31:
+	.loc 1 65 14 view .LVU95
+	jmp	.L16
+	.cfi_endproc
+.LFE1:
+	.size	itoa, .-itoa
+	.p2align 4
+	.globl	__ultoa
+	.type	__ultoa, @function
+__ultoa:
+.LVL32:
+.LFB2:
+	.loc 1 86 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 87 5 view .LVU97
+	.loc 1 86 1 is_stmt 0 view .LVU98
+	movq	%rdx, %r9
+	.loc 1 87 12 view .LVU99
+	xorl	%ecx, %ecx
+	jmp	.L29
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+.LBB19:
+	.loc 1 93 14 view .LVU100
+	movq	%rdx, %rcx
+	.loc 1 94 13 view .LVU101
+	movq	%rax, %rdi
+.LVL34:
+.L29:
+	.loc 1 94 13 view .LVU102
+.LBE19:
+	.loc 1 90 5 is_stmt 1 view .LVU103
+.LBB20:
+	.loc 1 92 9 view .LVU104
+	xorl	%edx, %edx
+	movq	%rdi, %rax
+	divq	%r9
+.LVL35:
+	.loc 1 93 9 view .LVU105
+	.loc 1 93 43 is_stmt 0 view .LVU106
+	leal	87(%rdx), %r10d
+	leal	48(%rdx), %r8d
+	cmpq	$10, %rdx
+	cmovnb	%r10d, %r8d
+	.loc 1 93 14 view .LVU107
+	leaq	1(%rcx), %rdx
+.LVL36:
+	.loc 1 93 18 view .LVU108
+	movb	%r8b, -1(%rsi,%rdx)
+	.loc 1 94 9 is_stmt 1 view .LVU109
+.LVL37:
+	.loc 1 94 9 is_stmt 0 view .LVU110
+.LBE20:
+	.loc 1 95 18 is_stmt 1 view .LVU111
+	cmpq	%r9, %rdi
+	jnb	.L37
+	.loc 1 98 5 view .LVU112
+	.loc 1 98 8 is_stmt 0 view .LVU113
+	cmpq	$16, %r9
+	je	.L42
+	.loc 1 105 5 is_stmt 1 view .LVU114
+	.loc 1 105 12 is_stmt 0 view .LVU115
+	movb	$0, (%rsi,%rdx)
+	.loc 1 108 5 is_stmt 1 view .LVU116
+.LVL38:
+.LBB21:
+.LBI21:
+	.loc 1 25 6 view .LVU117
+.LBB22:
+	.loc 1 27 5 view .LVU118
+	.loc 1 28 5 view .LVU119
+	.loc 1 30 5 view .LVU120
+	.loc 1 30 18 view .LVU121
+	testq	%rcx, %rcx
+	je	.L38
+.LVL39:
+.L34:
+	.loc 1 27 12 is_stmt 0 view .LVU122
+	xorl	%eax, %eax
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+.LBB23:
+	.loc 1 32 9 is_stmt 1 view .LVU123
+	.loc 1 32 14 is_stmt 0 view .LVU124
+	movzbl	(%rsi,%rax), %edi
+.LVL41:
+	.loc 1 33 9 is_stmt 1 view .LVU125
+	.loc 1 33 25 is_stmt 0 view .LVU126
+	movzbl	(%rsi,%rcx), %r8d
+	.loc 1 33 20 view .LVU127
+	movb	%r8b, (%rsi,%rax)
+	.loc 1 34 9 is_stmt 1 view .LVU128
+	.loc 1 37 9 is_stmt 0 view .LVU129
+	addq	$1, %rax
+.LVL42:
+	.loc 1 34 18 view .LVU130
+	movb	%dil, (%rsi,%rcx)
+	.loc 1 37 9 is_stmt 1 view .LVU131
+.LVL43:
+	.loc 1 38 9 view .LVU132
+	subq	$1, %rcx
+.LVL44:
+	.loc 1 38 9 is_stmt 0 view .LVU133
+.LBE23:
+	.loc 1 30 18 is_stmt 1 view .LVU134
+	cmpq	%rcx, %rax
+	jb	.L36
+.LBE22:
+.LBE21:
+	.loc 1 111 1 is_stmt 0 view .LVU135
+	movq	%rdx, %rax
+.LVL45:
+	.loc 1 111 1 view .LVU136
+	ret
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	.loc 1 99 18 is_stmt 1 view .LVU137
+	cmpq	$15, %rdx
+	ja	.L31
+	addq	%rsi, %rdx
+.LVL47:
+	.loc 1 99 18 is_stmt 0 view .LVU138
+	leaq	16(%rsi), %rax
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 100 13 is_stmt 1 view .LVU139
+	.loc 1 100 22 is_stmt 0 view .LVU140
+	movb	$48, (%rdx)
+	.loc 1 99 18 is_stmt 1 view .LVU141
+	addq	$1, %rdx
+.LVL49:
+	.loc 1 99 18 is_stmt 0 view .LVU142
+	cmpq	%rdx, %rax
+	jne	.L32
+.LVL50:
+	.loc 1 105 5 is_stmt 1 view .LVU143
+	.loc 1 105 12 is_stmt 0 view .LVU144
+	movb	$0, 16(%rsi)
+	.loc 1 108 5 is_stmt 1 view .LVU145
+.LVL51:
+.LBB27:
+	.loc 1 25 6 view .LVU146
+.LBB24:
+	.loc 1 27 5 view .LVU147
+	.loc 1 28 5 view .LVU148
+	.loc 1 30 5 view .LVU149
+	.loc 1 30 18 view .LVU150
+.LBE24:
+.LBE27:
+	.loc 1 100 18 is_stmt 0 view .LVU151
+	movl	$16, %edx
+	.loc 1 105 12 view .LVU152
+	movl	$15, %ecx
+	jmp	.L34
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+.LBB28:
+.LBB25:
+	.loc 1 30 18 view .LVU153
+	movl	$1, %edx
+.LVL53:
+	.loc 1 30 18 view .LVU154
+.LBE25:
+.LBE28:
+	.loc 1 110 5 is_stmt 1 view .LVU155
+	.loc 1 111 1 is_stmt 0 view .LVU156
+	movq	%rdx, %rax
+.LVL54:
+	.loc 1 111 1 view .LVU157
+	ret
+.LVL55:
+.L31:
+	.loc 1 105 5 is_stmt 1 view .LVU158
+	.loc 1 105 12 is_stmt 0 view .LVU159
+	movb	$0, (%rsi,%rdx)
+	.loc 1 108 5 is_stmt 1 view .LVU160
+.LVL56:
+.LBB29:
+	.loc 1 25 6 view .LVU161
+.LBB26:
+	.loc 1 27 5 view .LVU162
+	.loc 1 28 5 view .LVU163
+	.loc 1 30 5 view .LVU164
+	.loc 1 30 18 view .LVU165
+	jmp	.L34
+.LBE26:
+.LBE29:
+	.cfi_endproc
+.LFE2:
+	.size	__ultoa, .-__ultoa
+	.p2align 4
+	.globl	__ultoua
+	.type	__ultoua, @function
+__ultoua:
+.LVL57:
+.LFB3:
+	.loc 1 118 1 view -0
+	.cfi_startproc
+	.loc 1 119 5 view .LVU167
+	.loc 1 118 1 is_stmt 0 view .LVU168
+	movq	%rdx, %r9
+	.loc 1 119 12 view .LVU169
+	xorl	%ecx, %ecx
+	jmp	.L46
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+.LBB34:
+	.loc 1 125 14 view .LVU170
+	movq	%rdx, %rcx
+	.loc 1 126 13 view .LVU171
+	movq	%rax, %rdi
+.LVL59:
+.L46:
+	.loc 1 126 13 view .LVU172
+.LBE34:
+	.loc 1 122 5 is_stmt 1 view .LVU173
+.LBB35:
+	.loc 1 124 9 view .LVU174
+	xorl	%edx, %edx
+	movq	%rdi, %rax
+	divq	%r9
+.LVL60:
+	.loc 1 125 9 view .LVU175
+	.loc 1 125 43 is_stmt 0 view .LVU176
+	leal	55(%rdx), %r10d
+	leal	48(%rdx), %r8d
+	cmpq	$10, %rdx
+	cmovnb	%r10d, %r8d
+	.loc 1 125 14 view .LVU177
+	leaq	1(%rcx), %rdx
+.LVL61:
+	.loc 1 125 18 view .LVU178
+	movb	%r8b, -1(%rsi,%rdx)
+	.loc 1 126 9 is_stmt 1 view .LVU179
+.LVL62:
+	.loc 1 126 9 is_stmt 0 view .LVU180
+.LBE35:
+	.loc 1 127 18 is_stmt 1 view .LVU181
+	cmpq	%r9, %rdi
+	jnb	.L54
+	.loc 1 130 5 view .LVU182
+	.loc 1 130 8 is_stmt 0 view .LVU183
+	cmpq	$16, %r9
+	je	.L59
+	.loc 1 137 5 is_stmt 1 view .LVU184
+	.loc 1 137 12 is_stmt 0 view .LVU185
+	movb	$0, (%rsi,%rdx)
+	.loc 1 140 5 is_stmt 1 view .LVU186
+.LVL63:
+.LBB36:
+.LBI36:
+	.loc 1 25 6 view .LVU187
+.LBB37:
+	.loc 1 27 5 view .LVU188
+	.loc 1 28 5 view .LVU189
+	.loc 1 30 5 view .LVU190
+	.loc 1 30 18 view .LVU191
+	testq	%rcx, %rcx
+	je	.L55
+.LVL64:
+.L51:
+	.loc 1 27 12 is_stmt 0 view .LVU192
+	xorl	%eax, %eax
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+.LBB38:
+	.loc 1 32 9 is_stmt 1 view .LVU193
+	.loc 1 32 14 is_stmt 0 view .LVU194
+	movzbl	(%rsi,%rax), %edi
+.LVL66:
+	.loc 1 33 9 is_stmt 1 view .LVU195
+	.loc 1 33 25 is_stmt 0 view .LVU196
+	movzbl	(%rsi,%rcx), %r8d
+	.loc 1 33 20 view .LVU197
+	movb	%r8b, (%rsi,%rax)
+	.loc 1 34 9 is_stmt 1 view .LVU198
+	.loc 1 37 9 is_stmt 0 view .LVU199
+	addq	$1, %rax
+.LVL67:
+	.loc 1 34 18 view .LVU200
+	movb	%dil, (%rsi,%rcx)
+	.loc 1 37 9 is_stmt 1 view .LVU201
+.LVL68:
+	.loc 1 38 9 view .LVU202
+	subq	$1, %rcx
+.LVL69:
+	.loc 1 38 9 is_stmt 0 view .LVU203
+.LBE38:
+	.loc 1 30 18 is_stmt 1 view .LVU204
+	cmpq	%rcx, %rax
+	jb	.L53
+.LBE37:
+.LBE36:
+	.loc 1 143 1 is_stmt 0 view .LVU205
+	movq	%rdx, %rax
+.LVL70:
+	.loc 1 143 1 view .LVU206
+	ret
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 131 18 is_stmt 1 view .LVU207
+	cmpq	$15, %rdx
+	ja	.L48
+	addq	%rsi, %rdx
+.LVL72:
+	.loc 1 131 18 is_stmt 0 view .LVU208
+	leaq	16(%rsi), %rax
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 132 13 is_stmt 1 view .LVU209
+	.loc 1 132 22 is_stmt 0 view .LVU210
+	movb	$48, (%rdx)
+	.loc 1 131 18 is_stmt 1 view .LVU211
+	addq	$1, %rdx
+.LVL74:
+	.loc 1 131 18 is_stmt 0 view .LVU212
+	cmpq	%rdx, %rax
+	jne	.L49
+.LVL75:
+	.loc 1 137 5 is_stmt 1 view .LVU213
+	.loc 1 137 12 is_stmt 0 view .LVU214
+	movb	$0, 16(%rsi)
+	.loc 1 140 5 is_stmt 1 view .LVU215
+.LVL76:
+.LBB42:
+	.loc 1 25 6 view .LVU216
+.LBB39:
+	.loc 1 27 5 view .LVU217
+	.loc 1 28 5 view .LVU218
+	.loc 1 30 5 view .LVU219
+	.loc 1 30 18 view .LVU220
+.LBE39:
+.LBE42:
+	.loc 1 132 18 is_stmt 0 view .LVU221
+	movl	$16, %edx
+	.loc 1 137 12 view .LVU222
+	movl	$15, %ecx
+	jmp	.L51
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+.LBB43:
+.LBB40:
+	.loc 1 30 18 view .LVU223
+	movl	$1, %edx
+.LVL78:
+	.loc 1 30 18 view .LVU224
+.LBE40:
+.LBE43:
+	.loc 1 142 5 is_stmt 1 view .LVU225
+	.loc 1 143 1 is_stmt 0 view .LVU226
+	movq	%rdx, %rax
+.LVL79:
+	.loc 1 143 1 view .LVU227
+	ret
+.LVL80:
+.L48:
+	.loc 1 137 5 is_stmt 1 view .LVU228
+	.loc 1 137 12 is_stmt 0 view .LVU229
+	movb	$0, (%rsi,%rdx)
+	.loc 1 140 5 is_stmt 1 view .LVU230
+.LVL81:
+.LBB44:
+	.loc 1 25 6 view .LVU231
+.LBB41:
+	.loc 1 27 5 view .LVU232
+	.loc 1 28 5 view .LVU233
+	.loc 1 30 5 view .LVU234
+	.loc 1 30 18 view .LVU235
+	jmp	.L51
+.LBE41:
+.LBE44:
+	.cfi_endproc
+.LFE3:
+	.size	__ultoua, .-__ultoua
+	.p2align 4
+	.globl	ltoa
+	.type	ltoa, @function
+ltoa:
+.LVL82:
+.LFB4:
+	.loc 1 147 1 view -0
+	.cfi_startproc
+	.loc 1 147 1 is_stmt 0 view .LVU237
+	movq	%rdi, %rax
+	.loc 1 148 5 is_stmt 1 view .LVU238
+.LVL83:
+	.loc 1 151 5 view .LVU239
+	.loc 1 152 5 view .LVU240
+	.loc 1 147 1 is_stmt 0 view .LVU241
+	movq	%rsi, %rcx
+	movq	%rdx, %r8
+	.loc 1 152 8 view .LVU242
+	testq	%rdi, %rdi
+	js	.L76
+	.loc 1 159 5 is_stmt 1 view .LVU243
+	.loc 1 159 8 is_stmt 0 view .LVU244
+	jne	.L70
+	.loc 1 161 9 is_stmt 1 view .LVU245
+.LVL84:
+	.loc 1 165 16 view .LVU246
+	.loc 1 173 5 view .LVU247
+	.loc 1 179 5 view .LVU248
+	.loc 1 161 18 is_stmt 0 view .LVU249
+	movl	$48, %eax
+	.loc 1 161 14 view .LVU250
+	movl	$1, %r8d
+	.loc 1 161 18 view .LVU251
+	movw	%ax, (%rsi)
+	.loc 1 182 5 is_stmt 1 view .LVU252
+.LVL85:
+.LBB49:
+.LBI49:
+	.loc 1 25 6 view .LVU253
+.LBB50:
+	.loc 1 27 5 view .LVU254
+	.loc 1 28 5 view .LVU255
+	.loc 1 30 5 view .LVU256
+	.loc 1 30 18 view .LVU257
+.L60:
+	.loc 1 30 18 is_stmt 0 view .LVU258
+.LBE50:
+.LBE49:
+	.loc 1 185 1 view .LVU259
+	movq	%r8, %rax
+	ret
+.LVL86:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.loc 1 154 9 is_stmt 1 view .LVU260
+	.loc 1 155 9 view .LVU261
+	.loc 1 155 13 is_stmt 0 view .LVU262
+	negq	%rax
+.LVL87:
+	.loc 1 159 5 is_stmt 1 view .LVU263
+	.loc 1 165 16 view .LVU264
+	.loc 1 154 20 is_stmt 0 view .LVU265
+	movl	$1, %r11d
+.LVL88:
+.L62:
+	.loc 1 154 20 view .LVU266
+	xorl	%r9d, %r9d
+	jmp	.L66
+.LVL89:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+.LBB53:
+	.loc 1 168 14 view .LVU267
+	movq	%rdx, %r9
+.LVL90:
+.L66:
+	.loc 1 167 9 is_stmt 1 view .LVU268
+	xorl	%edx, %edx
+	.loc 1 167 26 is_stmt 0 view .LVU269
+	movq	%rax, %rsi
+	divq	%r8
+.LVL91:
+	.loc 1 168 9 is_stmt 1 view .LVU270
+	.loc 1 168 43 is_stmt 0 view .LVU271
+	leal	87(%rdx), %r10d
+	leal	48(%rdx), %edi
+	cmpq	$10, %rdx
+	cmovnb	%r10d, %edi
+	.loc 1 168 14 view .LVU272
+	leaq	1(%r9), %rdx
+.LVL92:
+	.loc 1 168 18 view .LVU273
+	movb	%dil, -1(%rcx,%rdx)
+	.loc 1 169 9 is_stmt 1 view .LVU274
+.LVL93:
+	.loc 1 169 9 is_stmt 0 view .LVU275
+.LBE53:
+	.loc 1 165 16 is_stmt 1 view .LVU276
+	cmpq	%r8, %rsi
+	jnb	.L71
+	.loc 1 173 5 view .LVU277
+	.loc 1 175 12 is_stmt 0 view .LVU278
+	leaq	(%rcx,%rdx), %rax
+	.loc 1 173 8 view .LVU279
+	testl	%r11d, %r11d
+	je	.L72
+	.loc 1 175 9 is_stmt 1 view .LVU280
+	.loc 1 175 18 is_stmt 0 view .LVU281
+	movb	$45, (%rax)
+	.loc 1 175 14 view .LVU282
+	leaq	2(%r9), %r8
+.LVL94:
+.L67:
+	.loc 1 179 5 is_stmt 1 view .LVU283
+	.loc 1 179 12 is_stmt 0 view .LVU284
+	movb	$0, (%rcx,%r8)
+	.loc 1 182 5 is_stmt 1 view .LVU285
+.LVL95:
+.LBB54:
+	.loc 1 25 6 view .LVU286
+.LBB52:
+	.loc 1 27 5 view .LVU287
+	.loc 1 28 5 view .LVU288
+	.loc 1 30 5 view .LVU289
+	.loc 1 30 18 view .LVU290
+	.loc 1 27 12 is_stmt 0 view .LVU291
+	xorl	%eax, %eax
+	.loc 1 30 18 view .LVU292
+	testq	%rdx, %rdx
+	je	.L60
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L68:
+.LBB51:
+	.loc 1 32 9 is_stmt 1 view .LVU293
+	.loc 1 32 14 is_stmt 0 view .LVU294
+	movzbl	(%rcx,%rax), %esi
+.LVL97:
+	.loc 1 33 9 is_stmt 1 view .LVU295
+	.loc 1 33 25 is_stmt 0 view .LVU296
+	movzbl	(%rcx,%rdx), %edi
+	.loc 1 33 20 view .LVU297
+	movb	%dil, (%rcx,%rax)
+	.loc 1 34 9 is_stmt 1 view .LVU298
+	.loc 1 37 9 is_stmt 0 view .LVU299
+	addq	$1, %rax
+.LVL98:
+	.loc 1 34 18 view .LVU300
+	movb	%sil, (%rcx,%rdx)
+	.loc 1 37 9 is_stmt 1 view .LVU301
+.LVL99:
+	.loc 1 38 9 view .LVU302
+	subq	$1, %rdx
+.LVL100:
+	.loc 1 38 9 is_stmt 0 view .LVU303
+.LBE51:
+	.loc 1 30 18 is_stmt 1 view .LVU304
+	cmpq	%rdx, %rax
+	jb	.L68
+.LBE52:
+.LBE54:
+	.loc 1 185 1 is_stmt 0 view .LVU305
+	movq	%r8, %rax
+.LVL101:
+	.loc 1 185 1 view .LVU306
+	ret
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 151 9 view .LVU307
+	xorl	%r11d, %r11d
+	jmp	.L62
+.LVL103:
+.L72:
+.LBB55:
+	.loc 1 168 14 view .LVU308
+	movq	%rdx, %r8
+.LVL104:
+	.loc 1 168 14 view .LVU309
+.LBE55:
+	movq	%r9, %rdx
+.LVL105:
+	.loc 1 168 14 view .LVU310
+	jmp	.L67
+	.cfi_endproc
+.LFE4:
+	.size	ltoa, .-ltoa
+	.p2align 4
+	.globl	vsnprintf
+	.type	vsnprintf, @function
+vsnprintf:
+.LVL106:
+.LFB5:
+	.loc 1 199 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 200 5 view .LVU312
+	.loc 1 203 5 view .LVU313
+.LBB56:
+	.loc 1 203 10 view .LVU314
+	.loc 1 203 34 view .LVU315
+.LBE56:
+	.loc 1 199 1 is_stmt 0 view .LVU316
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB84:
+	.loc 1 203 30 view .LVU317
+	movzbl	(%rdx), %eax
+	.loc 1 203 34 view .LVU318
+	testb	%al, %al
+	je	.L109
+	movq	%rcx, %r15
+	movq	%rdx, %r12
+	.loc 1 203 17 view .LVU319
+	xorl	%ebp, %ebp
+.LBE84:
+	.loc 1 200 12 view .LVU320
+	xorl	%ebx, %ebx
+	leaq	.L86(%rip), %rcx
+.LVL107:
+	.loc 1 200 12 view .LVU321
+	jmp	.L106
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+.LBB85:
+	.loc 1 237 13 is_stmt 1 view .LVU322
+	.loc 1 237 36 is_stmt 0 view .LVU323
+	leaq	-1(%r14), %rdx
+	.loc 1 237 16 view .LVU324
+	cmpq	%rdx, %rbx
+	jnb	.L116
+	.loc 1 238 17 is_stmt 1 view .LVU325
+.LVL109:
+	.loc 1 205 13 is_stmt 0 view .LVU326
+	addq	$1, %rbp
+.LVL110:
+	.loc 1 238 39 view .LVU327
+	movb	%al, 0(%r13,%rbx)
+	.loc 1 238 35 view .LVU328
+	addq	$1, %rbx
+.LVL111:
+	.loc 1 203 30 view .LVU329
+	movzbl	(%r12,%rbp), %eax
+.LVL112:
+.L83:
+	.loc 1 203 43 is_stmt 1 discriminator 2 view .LVU330
+	.loc 1 203 34 discriminator 2 view .LVU331
+	testb	%al, %al
+	je	.L116
+.LVL113:
+.L106:
+	.loc 1 204 9 view .LVU332
+	.loc 1 204 12 is_stmt 0 view .LVU333
+	cmpb	$37, %al
+	jne	.L79
+	.loc 1 205 13 is_stmt 1 view .LVU334
+.LVL114:
+	.loc 1 208 13 view .LVU335
+	.loc 1 208 23 is_stmt 0 view .LVU336
+	movzbl	1(%r12,%rbp), %eax
+	.loc 1 208 16 view .LVU337
+	cmpb	$100, %al
+	je	.L117
+	.loc 1 211 20 is_stmt 1 view .LVU338
+	subl	$88, %eax
+	cmpb	$32, %al
+	ja	.L84
+	movzbl	%al, %eax
+	movslq	(%rcx,%rax,4), %rax
+	addq	%rcx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L86:
+	.long	.L90-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L89-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L88-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L87-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L84-.L86
+	.long	.L85-.L86
+	.text
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.loc 1 211 20 is_stmt 0 view .LVU339
+.LBE85:
+	.loc 1 256 12 view .LVU340
+	movl	%ebx, %eax
+.LVL116:
+.L78:
+	.loc 1 248 5 is_stmt 1 view .LVU341
+	.loc 1 248 8 is_stmt 0 view .LVU342
+	cmpq	%r14, %rbx
+	jb	.L118
+	.loc 1 253 9 is_stmt 1 view .LVU343
+	.loc 1 253 26 is_stmt 0 view .LVU344
+	movb	$0, -1(%r13,%r14)
+	.loc 1 256 5 is_stmt 1 view .LVU345
+	.loc 1 257 1 is_stmt 0 view .LVU346
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+.LVL117:
+	.loc 1 257 1 view .LVU347
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL118:
+	.loc 1 257 1 view .LVU348
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.cfi_restore_state
+.LBB86:
+.LBB57:
+	.loc 1 209 17 is_stmt 1 view .LVU349
+	.loc 1 209 21 is_stmt 0 view .LVU350
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L81
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L82:
+	.loc 1 210 17 is_stmt 1 view .LVU351
+	.loc 1 210 32 is_stmt 0 view .LVU352
+	movl	(%rdx), %edi
+	leaq	0(%r13,%rbx), %rsi
+	movl	$10, %edx
+.LBE57:
+	.loc 1 203 43 view .LVU353
+	addq	$2, %rbp
+.LVL120:
+.LBB58:
+	.loc 1 210 32 view .LVU354
+	call	itoa
+.LVL121:
+	.loc 1 210 32 view .LVU355
+.LBE58:
+	leaq	.L86(%rip), %rcx
+.LBB59:
+	.loc 1 210 29 view .LVU356
+	addq	%rax, %rbx
+.LVL122:
+	.loc 1 210 29 view .LVU357
+.LBE59:
+	.loc 1 203 30 view .LVU358
+	movzbl	(%r12,%rbp), %eax
+	jmp	.L83
+.LVL123:
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.loc 1 203 43 view .LVU359
+	addq	$2, %rbp
+.LVL124:
+	.loc 1 203 30 view .LVU360
+	movzbl	(%r12,%rbp), %eax
+	jmp	.L83
+.LVL125:
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	.loc 1 203 30 view .LVU361
+.LBE86:
+	.loc 1 249 9 is_stmt 1 view .LVU362
+	.loc 1 249 29 is_stmt 0 view .LVU363
+	movb	$0, 0(%r13,%rbx)
+	.loc 1 257 1 view .LVU364
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+.LVL126:
+	.loc 1 257 1 view .LVU365
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL127:
+	.loc 1 257 1 view .LVU366
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.cfi_restore_state
+.LBB87:
+.LBB60:
+	.loc 1 209 21 view .LVU367
+	movq	8(%r15), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L82
+.L85:
+	.loc 1 209 21 view .LVU368
+.LBE60:
+.LBB61:
+	.loc 1 212 17 is_stmt 1 view .LVU369
+	.loc 1 212 26 is_stmt 0 view .LVU370
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L91
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L92:
+	.loc 1 213 17 is_stmt 1 view .LVU371
+	.loc 1 213 32 is_stmt 0 view .LVU372
+	movq	(%rdx), %rdi
+	leaq	0(%r13,%rbx), %rsi
+	movl	$16, %edx
+.LBE61:
+	.loc 1 203 43 view .LVU373
+	addq	$2, %rbp
+.LVL129:
+.LBB62:
+	.loc 1 213 32 view .LVU374
+	call	__ultoa
+.LVL130:
+	.loc 1 213 32 view .LVU375
+.LBE62:
+	leaq	.L86(%rip), %rcx
+.LBB63:
+	.loc 1 213 29 view .LVU376
+	addq	%rax, %rbx
+.LVL131:
+	.loc 1 213 29 view .LVU377
+.LBE63:
+	.loc 1 203 30 view .LVU378
+	movzbl	(%r12,%rbp), %eax
+	jmp	.L83
+.LVL132:
+.L87:
+.LBB64:
+	.loc 1 218 17 is_stmt 1 view .LVU379
+	.loc 1 218 23 is_stmt 0 view .LVU380
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L95
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L96:
+	movq	(%rdx), %rsi
+	.loc 1 219 17 is_stmt 1 view .LVU381
+.LVL133:
+	.loc 1 219 29 view .LVU382
+.LBE64:
+	.loc 1 203 43 is_stmt 0 view .LVU383
+	addq	$2, %rbp
+.LVL134:
+.LBB65:
+	.loc 1 219 29 view .LVU384
+	movq	%rbx, %rdx
+.LBE65:
+	.loc 1 203 30 view .LVU385
+	leaq	(%r12,%rbp), %rdi
+.LBB66:
+	.loc 1 219 24 view .LVU386
+	movzbl	(%rsi), %eax
+	subq	%rbx, %rsi
+.LVL135:
+	.loc 1 219 29 view .LVU387
+	testb	%al, %al
+	je	.L119
+.LVL136:
+	.p2align 4,,10
+	.p2align 3
+.L97:
+	.loc 1 220 21 is_stmt 1 view .LVU388
+	.loc 1 220 39 is_stmt 0 view .LVU389
+	addq	$1, %rdx
+.LVL137:
+	.loc 1 220 43 view .LVU390
+	movb	%al, -1(%r13,%rdx)
+	.loc 1 219 29 is_stmt 1 view .LVU391
+	.loc 1 219 24 is_stmt 0 view .LVU392
+	movzbl	(%rsi,%rdx), %eax
+	.loc 1 219 29 view .LVU393
+	testb	%al, %al
+	jne	.L97
+.LBE66:
+	.loc 1 203 30 view .LVU394
+	movzbl	(%rdi), %eax
+.LBB67:
+	.loc 1 220 39 view .LVU395
+	movq	%rdx, %rbx
+	jmp	.L83
+.LVL138:
+.L88:
+	.loc 1 220 39 view .LVU396
+.LBE67:
+	.loc 1 225 50 discriminator 1 view .LVU397
+	movzbl	2(%r12,%rbp), %eax
+	leaq	2(%rbp), %rdx
+	.loc 1 225 41 discriminator 1 view .LVU398
+	cmpb	$117, %al
+	je	.L120
+	.loc 1 229 20 is_stmt 1 discriminator 1 view .LVU399
+	.loc 1 229 41 is_stmt 0 discriminator 1 view .LVU400
+	cmpb	$100, %al
+	je	.L121
+	movq	%rdx, %rbp
+.LVL139:
+	.loc 1 229 41 discriminator 1 view .LVU401
+	jmp	.L83
+.LVL140:
+.L89:
+.LBB68:
+	.loc 1 223 17 is_stmt 1 view .LVU402
+	.loc 1 223 21 is_stmt 0 view .LVU403
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L98
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L99:
+	.loc 1 224 17 is_stmt 1 view .LVU404
+.LVL141:
+	.loc 1 224 41 is_stmt 0 view .LVU405
+	movl	(%rdx), %eax
+.LBE68:
+	.loc 1 203 43 view .LVU406
+	addq	$2, %rbp
+.LVL142:
+.LBB69:
+	.loc 1 224 41 view .LVU407
+	movb	%al, 0(%r13,%rbx)
+	.loc 1 224 35 view .LVU408
+	addq	$1, %rbx
+.LVL143:
+	.loc 1 224 35 view .LVU409
+.LBE69:
+	.loc 1 203 30 view .LVU410
+	movzbl	(%r12,%rbp), %eax
+	jmp	.L83
+.LVL144:
+.L90:
+.LBB70:
+	.loc 1 215 17 is_stmt 1 view .LVU411
+	.loc 1 215 26 is_stmt 0 view .LVU412
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L93
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L94:
+	.loc 1 216 17 is_stmt 1 view .LVU413
+	.loc 1 216 32 is_stmt 0 view .LVU414
+	movq	(%rdx), %rdi
+	leaq	0(%r13,%rbx), %rsi
+	movl	$16, %edx
+.LBE70:
+	.loc 1 203 43 view .LVU415
+	addq	$2, %rbp
+.LVL145:
+.LBB71:
+	.loc 1 216 32 view .LVU416
+	call	__ultoua
+.LVL146:
+	.loc 1 216 32 view .LVU417
+.LBE71:
+	leaq	.L86(%rip), %rcx
+.LBB72:
+	.loc 1 216 29 view .LVU418
+	addq	%rax, %rbx
+.LVL147:
+	.loc 1 216 29 view .LVU419
+.LBE72:
+	.loc 1 203 30 view .LVU420
+	movzbl	(%r12,%rbp), %eax
+	jmp	.L83
+.LVL148:
+	.p2align 4,,10
+	.p2align 3
+.L95:
+.LBB73:
+	.loc 1 218 23 view .LVU421
+	movq	8(%r15), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L96
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.loc 1 218 23 view .LVU422
+.LBE73:
+.LBB74:
+	.loc 1 223 21 view .LVU423
+	movq	8(%r15), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L99
+	.p2align 4,,10
+	.p2align 3
+.L91:
+	.loc 1 223 21 view .LVU424
+.LBE74:
+.LBB75:
+	.loc 1 212 26 view .LVU425
+	movq	8(%r15), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L92
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	.loc 1 212 26 view .LVU426
+.LBE75:
+.LBB76:
+	.loc 1 215 26 view .LVU427
+	movq	8(%r15), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L94
+.L120:
+	.loc 1 215 26 view .LVU428
+.LBE76:
+.LBB77:
+	.loc 1 226 17 is_stmt 1 view .LVU429
+.LVL149:
+	.loc 1 227 17 view .LVU430
+	.loc 1 227 26 is_stmt 0 view .LVU431
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L101
+	movl	%eax, %edx
+.LVL150:
+	.loc 1 227 26 view .LVU432
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L102:
+	.loc 1 228 17 is_stmt 1 view .LVU433
+	.loc 1 228 32 is_stmt 0 view .LVU434
+	movq	(%rdx), %rdi
+	leaq	0(%r13,%rbx), %rsi
+	movl	$10, %edx
+.LBE77:
+	.loc 1 203 43 view .LVU435
+	addq	$3, %rbp
+.LVL151:
+.LBB78:
+	.loc 1 228 32 view .LVU436
+	call	__ultoa
+.LVL152:
+	.loc 1 228 32 view .LVU437
+.LBE78:
+	.loc 1 225 64 view .LVU438
+	leaq	.L86(%rip), %rcx
+.LBB79:
+	.loc 1 228 29 view .LVU439
+	addq	%rax, %rbx
+.LVL153:
+	.loc 1 228 29 view .LVU440
+.LBE79:
+	.loc 1 203 30 view .LVU441
+	movzbl	(%r12,%rbp), %eax
+	.loc 1 225 64 view .LVU442
+	jmp	.L83
+.LVL154:
+.L121:
+.LBB80:
+	.loc 1 230 17 is_stmt 1 view .LVU443
+	.loc 1 231 17 view .LVU444
+	.loc 1 231 25 is_stmt 0 view .LVU445
+	movl	(%r15), %eax
+	cmpl	$47, %eax
+	ja	.L103
+	movl	%eax, %edx
+.LVL155:
+	.loc 1 231 25 view .LVU446
+	addl	$8, %eax
+	addq	16(%r15), %rdx
+	movl	%eax, (%r15)
+.L104:
+	.loc 1 232 17 is_stmt 1 view .LVU447
+	.loc 1 232 32 is_stmt 0 view .LVU448
+	movq	(%rdx), %rdi
+	leaq	0(%r13,%rbx), %rsi
+	movl	$10, %edx
+.LBE80:
+	.loc 1 203 43 view .LVU449
+	addq	$3, %rbp
+.LVL156:
+.LBB81:
+	.loc 1 232 32 view .LVU450
+	call	ltoa
+.LVL157:
+	.loc 1 232 32 view .LVU451
+	leaq	.L86(%rip), %rcx
+	.loc 1 232 29 view .LVU452
+	addq	%rax, %rbx
+.LVL158:
+	.loc 1 232 29 view .LVU453
+.LBE81:
+	.loc 1 203 30 view .LVU454
+	movzbl	(%r12,%rbp), %eax
+	jmp	.L83
+.LVL159:
+.L109:
+	.loc 1 203 34 view .LVU455
+	xorl	%eax, %eax
+.LBE87:
+	.loc 1 200 12 view .LVU456
+	xorl	%ebx, %ebx
+	jmp	.L78
+.LVL160:
+.L119:
+.LBB88:
+	.loc 1 203 30 view .LVU457
+	movzbl	(%rdi), %eax
+	jmp	.L83
+.LVL161:
+.L101:
+.LBB82:
+	.loc 1 227 26 view .LVU458
+	movq	8(%r15), %rdx
+.LVL162:
+	.loc 1 227 26 view .LVU459
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L102
+.LVL163:
+.L103:
+	.loc 1 227 26 view .LVU460
+.LBE82:
+.LBB83:
+	.loc 1 231 25 view .LVU461
+	movq	8(%r15), %rdx
+.LVL164:
+	.loc 1 231 25 view .LVU462
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r15)
+	jmp	.L104
+.LBE83:
+.LBE88:
+	.cfi_endproc
+.LFE5:
+	.size	vsnprintf, .-vsnprintf
+	.p2align 4
+	.globl	snprintf
+	.type	snprintf, @function
+snprintf:
+.LVL165:
+.LFB6:
+	.loc 1 260 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 261 5 view .LVU464
+	.loc 1 262 4 view .LVU465
+	.loc 1 260 1 is_stmt 0 view .LVU466
+	subq	$80, %rsp
+	.cfi_def_cfa_offset 88
+	.loc 1 262 4 view .LVU467
+	leaq	88(%rsp), %rax
+	.loc 1 260 1 view .LVU468
+	movq	%rcx, 56(%rsp)
+	.loc 1 263 13 view .LVU469
+	leaq	8(%rsp), %rcx
+	.loc 1 262 4 view .LVU470
+	movq	%rax, 16(%rsp)
+	leaq	32(%rsp), %rax
+	.loc 1 260 1 view .LVU471
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	.loc 1 262 4 view .LVU472
+	movl	$24, 8(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 263 5 is_stmt 1 view .LVU473
+	.loc 1 263 13 is_stmt 0 view .LVU474
+	call	vsnprintf
+.LVL166:
+	.loc 1 264 4 is_stmt 1 view .LVU475
+	.loc 1 266 5 view .LVU476
+	.loc 1 267 1 is_stmt 0 view .LVU477
+	addq	$80, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	snprintf, .-snprintf
+	.p2align 4
+	.globl	strlen
+	.type	strlen, @function
+strlen:
+.LVL167:
+.LFB7:
+	.loc 1 270 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 271 5 view .LVU479
+	.loc 1 273 5 view .LVU480
+.LBB89:
+	.loc 1 273 10 view .LVU481
+	.loc 1 273 23 view .LVU482
+.LBE89:
+	.loc 1 271 12 is_stmt 0 view .LVU483
+	xorl	%eax, %eax
+	jmp	.L126
+.LVL168:
+	.p2align 4,,10
+	.p2align 3
+.L129:
+.LBB90:
+	.loc 1 277 9 is_stmt 1 discriminator 2 view .LVU484
+	.loc 1 277 12 is_stmt 0 discriminator 2 view .LVU485
+	addq	$1, %rax
+.LVL169:
+	.loc 1 273 33 is_stmt 1 discriminator 2 view .LVU486
+	.loc 1 273 23 discriminator 2 view .LVU487
+	cmpq	$65535, %rax
+	je	.L128
+.LVL170:
+.L126:
+	.loc 1 274 9 view .LVU488
+	.loc 1 274 12 is_stmt 0 view .LVU489
+	cmpb	$0, (%rdi,%rax)
+	jne	.L129
+.LBE90:
+	.loc 1 281 1 view .LVU490
+	ret
+.L128:
+	.loc 1 280 12 view .LVU491
+	movq	$-1, %rax
+.LVL171:
+	.loc 1 281 1 view .LVU492
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	strlen, .-strlen
+	.p2align 4
+	.globl	strcmp
+	.type	strcmp, @function
+strcmp:
+.LVL172:
+.LFB8:
+	.loc 1 284 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 285 5 view .LVU494
+	.loc 1 285 15 view .LVU495
+	.loc 1 285 12 is_stmt 0 view .LVU496
+	movzbl	(%rdi), %edx
+	.loc 1 285 15 view .LVU497
+	xorl	%eax, %eax
+	testb	%dl, %dl
+	jne	.L131
+	jmp	.L138
+.LVL173:
+	.p2align 4,,10
+	.p2align 3
+.L133:
+	.loc 1 286 9 is_stmt 1 view .LVU498
+	.loc 1 286 12 is_stmt 0 view .LVU499
+	cmpb	%dl, %cl
+	jne	.L135
+	.loc 1 290 9 is_stmt 1 view .LVU500
+.LVL174:
+	.loc 1 291 9 view .LVU501
+	.loc 1 285 15 view .LVU502
+	addq	$1, %rax
+.LVL175:
+	.loc 1 285 12 is_stmt 0 view .LVU503
+	movzbl	(%rdi,%rax), %edx
+	.loc 1 285 15 view .LVU504
+	testb	%dl, %dl
+	je	.L136
+.LVL176:
+.L131:
+	.loc 1 285 18 discriminator 1 view .LVU505
+	movzbl	(%rsi,%rax), %ecx
+	.loc 1 285 15 discriminator 1 view .LVU506
+	testb	%cl, %cl
+	jne	.L133
+.LVL177:
+.L136:
+	.loc 1 294 12 view .LVU507
+	xorl	%eax, %eax
+	.loc 1 295 1 view .LVU508
+	ret
+.LVL178:
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	.loc 1 287 20 view .LVU509
+	movl	$-1, %eax
+.LVL179:
+	.loc 1 287 20 view .LVU510
+	ret
+.LVL180:
+.L138:
+	.loc 1 287 20 view .LVU511
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	strcmp, .-strcmp
+	.p2align 4
+	.globl	kprintf
+	.type	kprintf, @function
+kprintf:
+.LVL181:
+.LFB9:
+	.loc 1 301 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 302 5 view .LVU513
+	.loc 1 304 5 view .LVU514
+	.loc 1 305 4 view .LVU515
+	.loc 1 301 1 is_stmt 0 view .LVU516
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$336, %rsp
+	.cfi_def_cfa_offset 352
+	.loc 1 306 5 view .LVU517
+	leaq	32(%rsp), %rbx
+	.loc 1 305 4 view .LVU518
+	leaq	352(%rsp), %rax
+	.loc 1 301 1 view .LVU519
+	movq	%rsi, 296(%rsp)
+	.loc 1 306 5 view .LVU520
+	movl	$256, %esi
+	.loc 1 301 1 view .LVU521
+	movq	%rdx, 304(%rsp)
+	.loc 1 306 5 view .LVU522
+	movq	%rdi, %rdx
+	movq	%rbx, %rdi
+.LVL182:
+	.loc 1 301 1 view .LVU523
+	movq	%rcx, 312(%rsp)
+	.loc 1 306 5 view .LVU524
+	leaq	8(%rsp), %rcx
+	.loc 1 305 4 view .LVU525
+	movq	%rax, 16(%rsp)
+	leaq	288(%rsp), %rax
+	.loc 1 301 1 view .LVU526
+	movq	%r8, 320(%rsp)
+	movq	%r9, 328(%rsp)
+	.loc 1 305 4 view .LVU527
+	movl	$8, 8(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 306 5 is_stmt 1 view .LVU528
+	call	vsnprintf
+.LVL183:
+	.loc 1 307 4 view .LVU529
+	.loc 1 309 5 view .LVU530
+	movq	%rbx, %rsi
+	movl	$1016, %edi
+	call	write_serial_str@PLT
+.LVL184:
+	.loc 1 311 5 view .LVU531
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	tprintf@PLT
+.LVL185:
+	.loc 1 312 1 is_stmt 0 view .LVU532
+	addq	$336, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	kprintf, .-kprintf
+	.p2align 4
+	.globl	sprint_binary8
+	.type	sprint_binary8, @function
+sprint_binary8:
+.LVL186:
+.LFB10:
+	.loc 1 320 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 321 5 view .LVU534
+.LBB91:
+	.loc 1 321 10 view .LVU535
+	.loc 1 321 23 view .LVU536
+	.loc 1 322 35 is_stmt 0 view .LVU537
+	movzbl	%sil, %esi
+	.loc 1 322 35 view .LVU538
+	leaq	-8(%rdi), %r8
+	movq	%rdi, %rdx
+.LVL187:
+	.p2align 4,,10
+	.p2align 3
+.L142:
+	.loc 1 322 9 is_stmt 1 view .LVU539
+	.loc 1 322 35 is_stmt 0 view .LVU540
+	movl	%edi, %ecx
+	movl	%esi, %eax
+	subl	%edx, %ecx
+.LVL188:
+	.loc 1 321 23 view .LVU541
+	subq	$1, %rdx
+	.loc 1 322 35 view .LVU542
+	sarl	%cl, %eax
+	andl	$1, %eax
+	.loc 1 322 19 view .LVU543
+	addl	$48, %eax
+	movb	%al, 8(%rdx)
+	.loc 1 321 29 is_stmt 1 view .LVU544
+.LVL189:
+	.loc 1 321 23 view .LVU545
+	cmpq	%r8, %rdx
+	jne	.L142
+.LBE91:
+	.loc 1 325 5 view .LVU546
+	.loc 1 325 13 is_stmt 0 view .LVU547
+	movb	$0, 8(%rdi)
+	.loc 1 326 1 view .LVU548
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	sprint_binary8, .-sprint_binary8
+	.p2align 4
+	.globl	sprint_binary16
+	.type	sprint_binary16, @function
+sprint_binary16:
+.LVL190:
+.LFB11:
+	.loc 1 334 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 335 5 view .LVU550
+	.loc 1 335 14 is_stmt 0 view .LVU551
+	movb	$0, 17(%rdi)
+	.loc 1 336 5 is_stmt 1 view .LVU552
+.LVL191:
+	.loc 1 338 5 view .LVU553
+	.loc 1 338 33 view .LVU554
+	.loc 1 339 34 is_stmt 0 view .LVU555
+	movzwl	%si, %esi
+	.loc 1 336 19 view .LVU556
+	xorl	%r8d, %r8d
+	.loc 1 338 19 view .LVU557
+	xorl	%ecx, %ecx
+	jmp	.L150
+.LVL192:
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	.loc 1 341 37 discriminator 1 view .LVU558
+	cmpl	$15, %ecx
+	je	.L144
+	.loc 1 342 13 is_stmt 1 view .LVU559
+.LVL193:
+	.loc 1 342 27 is_stmt 0 view .LVU560
+	movslq	%edx, %rdx
+	.loc 1 342 31 view .LVU561
+	movb	$32, (%rdi,%rdx)
+.LVL194:
+	.loc 1 338 33 is_stmt 1 view .LVU562
+	.loc 1 342 27 is_stmt 0 view .LVU563
+	leal	2(%r8), %edx
+.LVL195:
+.L148:
+	.loc 1 334 1 view .LVU564
+	movl	%edx, %r8d
+	movl	%eax, %ecx
+.LVL196:
+.L150:
+	.loc 1 339 9 is_stmt 1 view .LVU565
+	.loc 1 339 34 is_stmt 0 view .LVU566
+	movl	%esi, %eax
+	.loc 1 339 23 view .LVU567
+	movslq	%r8d, %r9
+	leal	1(%r8), %edx
+.LVL197:
+	.loc 1 339 34 view .LVU568
+	sall	%cl, %eax
+	.loc 1 339 27 view .LVU569
+	testb	$-128, %ah
+	setne	%al
+	addl	$48, %eax
+	movb	%al, (%rdi,%r9)
+	.loc 1 341 9 is_stmt 1 view .LVU570
+	.loc 1 341 23 is_stmt 0 view .LVU571
+	leal	1(%rcx), %eax
+	.loc 1 341 12 view .LVU572
+	testb	$7, %al
+	je	.L155
+.LVL198:
+	.loc 1 338 33 is_stmt 1 discriminator 1 view .LVU573
+	cmpl	$16, %eax
+	jne	.L148
+.LVL199:
+.L144:
+	.loc 1 345 1 is_stmt 0 view .LVU574
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	sprint_binary16, .-sprint_binary16
+	.p2align 4
+	.globl	sprint_binary32
+	.type	sprint_binary32, @function
+sprint_binary32:
+.LVL200:
+.LFB12:
+	.loc 1 353 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 354 5 view .LVU576
+	.loc 1 354 14 is_stmt 0 view .LVU577
+	movb	$0, 35(%rdi)
+	.loc 1 355 5 is_stmt 1 view .LVU578
+.LVL201:
+	.loc 1 357 5 view .LVU579
+	.loc 1 357 33 view .LVU580
+	.loc 1 355 19 is_stmt 0 view .LVU581
+	xorl	%r8d, %r8d
+	.loc 1 357 19 view .LVU582
+	xorl	%ecx, %ecx
+	jmp	.L162
+.LVL202:
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	.loc 1 360 37 discriminator 1 view .LVU583
+	cmpl	$31, %ecx
+	je	.L156
+	.loc 1 361 13 is_stmt 1 view .LVU584
+.LVL203:
+	.loc 1 361 27 is_stmt 0 view .LVU585
+	movslq	%edx, %rdx
+	.loc 1 361 31 view .LVU586
+	movb	$32, (%rdi,%rdx)
+.LVL204:
+	.loc 1 357 33 is_stmt 1 view .LVU587
+	.loc 1 361 27 is_stmt 0 view .LVU588
+	leal	2(%r8), %edx
+.LVL205:
+.L160:
+	.loc 1 353 1 view .LVU589
+	movl	%edx, %r8d
+	movl	%eax, %ecx
+.LVL206:
+.L162:
+	.loc 1 358 9 is_stmt 1 view .LVU590
+	.loc 1 358 34 is_stmt 0 view .LVU591
+	movl	%esi, %eax
+	.loc 1 358 23 view .LVU592
+	movslq	%r8d, %r9
+	leal	1(%r8), %edx
+.LVL207:
+	.loc 1 358 34 view .LVU593
+	sall	%cl, %eax
+	.loc 1 358 27 view .LVU594
+	shrl	$31, %eax
+	addl	$48, %eax
+	movb	%al, (%rdi,%r9)
+	.loc 1 360 9 is_stmt 1 view .LVU595
+	.loc 1 360 23 is_stmt 0 view .LVU596
+	leal	1(%rcx), %eax
+	.loc 1 360 12 view .LVU597
+	testb	$7, %al
+	je	.L167
+.LVL208:
+	.loc 1 357 33 is_stmt 1 discriminator 1 view .LVU598
+	cmpl	$32, %eax
+	jne	.L160
+.LVL209:
+.L156:
+	.loc 1 364 1 is_stmt 0 view .LVU599
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	sprint_binary32, .-sprint_binary32
+	.p2align 4
+	.globl	sprint_binary64
+	.type	sprint_binary64, @function
+sprint_binary64:
+.LVL210:
+.LFB13:
+	.loc 1 372 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 373 5 view .LVU601
+	.loc 1 373 14 is_stmt 0 view .LVU602
+	movb	$0, 71(%rdi)
+	.loc 1 374 5 is_stmt 1 view .LVU603
+.LVL211:
+	.loc 1 376 5 view .LVU604
+	.loc 1 376 33 view .LVU605
+	.loc 1 374 19 is_stmt 0 view .LVU606
+	xorl	%r8d, %r8d
+	.loc 1 376 19 view .LVU607
+	xorl	%ecx, %ecx
+	jmp	.L174
+.LVL212:
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	.loc 1 379 37 discriminator 1 view .LVU608
+	cmpl	$63, %ecx
+	je	.L168
+	.loc 1 380 13 is_stmt 1 view .LVU609
+.LVL213:
+	.loc 1 380 27 is_stmt 0 view .LVU610
+	movslq	%edx, %rdx
+	.loc 1 380 31 view .LVU611
+	movb	$32, (%rdi,%rdx)
+.LVL214:
+	.loc 1 376 33 is_stmt 1 view .LVU612
+	.loc 1 380 27 is_stmt 0 view .LVU613
+	leal	2(%r8), %edx
+.LVL215:
+.L172:
+	.loc 1 372 1 view .LVU614
+	movl	%edx, %r8d
+	movl	%eax, %ecx
+.LVL216:
+.L174:
+	.loc 1 377 9 is_stmt 1 view .LVU615
+	.loc 1 377 34 is_stmt 0 view .LVU616
+	movq	%rsi, %rax
+	.loc 1 377 23 view .LVU617
+	movslq	%r8d, %r9
+	leal	1(%r8), %edx
+.LVL217:
+	.loc 1 377 34 view .LVU618
+	salq	%cl, %rax
+	.loc 1 377 27 view .LVU619
+	shrq	$63, %rax
+	addl	$48, %eax
+	movb	%al, (%rdi,%r9)
+	.loc 1 379 9 is_stmt 1 view .LVU620
+	.loc 1 379 23 is_stmt 0 view .LVU621
+	leal	1(%rcx), %eax
+	.loc 1 379 12 view .LVU622
+	testb	$7, %al
+	je	.L179
+.LVL218:
+	.loc 1 376 33 is_stmt 1 discriminator 1 view .LVU623
+	cmpl	$64, %eax
+	jne	.L172
+.LVL219:
+.L168:
+	.loc 1 383 1 is_stmt 0 view .LVU624
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	sprint_binary64, .-sprint_binary64
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 4 "<built-in>"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 6 "src/include/terminal.h"
+	.file 7 "src/include/serial.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb5f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF55
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x7
+	.long	.LASF6
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF5
+	.uleb128 0x7
+	.long	.LASF7
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1b
+	.long	0x69
+	.uleb128 0x26
+	.long	.LASF56
+	.long	0x72
+	.uleb128 0x1d
+	.long	0x82
+	.long	0x82
+	.uleb128 0x1e
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF57
+	.byte	0x18
+	.byte	0x4
+	.byte	0
+	.long	0xb7
+	.uleb128 0x12
+	.long	.LASF8
+	.long	0xb7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF9
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x12
+	.long	.LASF10
+	.long	0xbe
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF11
+	.long	0xbe
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x63
+	.byte	0x18
+	.long	0x5d
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF15
+	.uleb128 0x7
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x12
+	.long	0x35
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x2e
+	.byte	0x17
+	.long	0xf2
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF18
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x31
+	.byte	0x1c
+	.long	0x105
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF20
+	.uleb128 0x7
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0xb7
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x37
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF23
+	.uleb128 0x29
+	.long	0x124
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF24
+	.uleb128 0x1f
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x1c
+	.long	0x149
+	.uleb128 0x17
+	.long	0x149
+	.uleb128 0x18
+	.byte	0
+	.uleb128 0x19
+	.long	0x12b
+	.uleb128 0x1f
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x1b
+	.long	0x164
+	.uleb128 0x17
+	.long	0xf9
+	.uleb128 0x17
+	.long	0x164
+	.byte	0
+	.uleb128 0x19
+	.long	0x124
+	.uleb128 0xe
+	.long	.LASF30
+	.value	0x173
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ca
+	.uleb128 0x13
+	.long	.LASF27
+	.value	0x173
+	.byte	0x1b
+	.long	0x164
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.string	"ch"
+	.value	0x173
+	.byte	0x2c
+	.long	0x118
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF28
+	.value	0x176
+	.byte	0x9
+	.long	0x48
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0xc
+	.long	.LASF29
+	.value	0x176
+	.byte	0x13
+	.long	0x48
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF31
+	.value	0x160
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22b
+	.uleb128 0x13
+	.long	.LASF27
+	.value	0x160
+	.byte	0x1b
+	.long	0x164
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.string	"ch"
+	.value	0x160
+	.byte	0x2c
+	.long	0x10c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF28
+	.value	0x163
+	.byte	0x9
+	.long	0x48
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0xc
+	.long	.LASF29
+	.value	0x163
+	.byte	0x13
+	.long	0x48
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF32
+	.value	0x14d
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x28c
+	.uleb128 0x13
+	.long	.LASF27
+	.value	0x14d
+	.byte	0x1b
+	.long	0x164
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.string	"ch"
+	.value	0x14d
+	.byte	0x2c
+	.long	0xf9
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF28
+	.value	0x150
+	.byte	0x9
+	.long	0x48
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0xc
+	.long	.LASF29
+	.value	0x150
+	.byte	0x13
+	.long	0x48
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF33
+	.value	0x13f
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e9
+	.uleb128 0x13
+	.long	.LASF27
+	.value	0x13f
+	.byte	0x1a
+	.long	0x164
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xf
+	.string	"ch"
+	.value	0x13f
+	.byte	0x2a
+	.long	0xe6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2a
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.uleb128 0x14
+	.string	"i"
+	.value	0x141
+	.byte	0xe
+	.long	0x48
+	.long	.LLST77
+	.long	.LVUS77
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF34
+	.value	0x12c
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x39c
+	.uleb128 0x15
+	.long	.LASF37
+	.value	0x12c
+	.byte	0x19
+	.long	0x149
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x18
+	.uleb128 0x1a
+	.long	.LASF35
+	.value	0x12e
+	.byte	0xa
+	.long	0x39c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1a
+	.long	.LASF36
+	.value	0x130
+	.byte	0xd
+	.long	0xc0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.uleb128 0x20
+	.quad	.LVL183
+	.long	0x4f8
+	.long	0x368
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL184
+	.long	0x14e
+	.long	0x387
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL185
+	.long	0x137
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x124
+	.long	0x3ac
+	.uleb128 0x1e
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF38
+	.value	0x11b
+	.byte	0x5
+	.long	0x48
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ef
+	.uleb128 0x21
+	.string	"l"
+	.byte	0x18
+	.long	0x149
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x21
+	.string	"r"
+	.byte	0x27
+	.long	0x149
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF39
+	.value	0x10d
+	.byte	0x8
+	.long	0x3c
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x44c
+	.uleb128 0xf
+	.string	"str"
+	.value	0x10d
+	.byte	0x1b
+	.long	0x149
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x14
+	.string	"len"
+	.value	0x10f
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0xa
+	.long	.LLRL72
+	.uleb128 0x14
+	.string	"i"
+	.value	0x111
+	.byte	0xe
+	.long	0x48
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF40
+	.value	0x103
+	.byte	0x5
+	.long	0x48
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f8
+	.uleb128 0x15
+	.long	.LASF35
+	.value	0x103
+	.byte	0x13
+	.long	0x164
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x15
+	.long	.LASF41
+	.value	0x103
+	.byte	0x24
+	.long	0x3c
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x15
+	.long	.LASF37
+	.value	0x103
+	.byte	0x35
+	.long	0x149
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x18
+	.uleb128 0x1a
+	.long	.LASF36
+	.value	0x105
+	.byte	0xd
+	.long	0xc0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x14
+	.string	"r"
+	.value	0x107
+	.byte	0x9
+	.long	0x48
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x9
+	.quad	.LVL166
+	.long	0x4f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF42
+	.byte	0xc6
+	.byte	0x5
+	.long	0x48
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6a9
+	.uleb128 0x8
+	.long	.LASF35
+	.byte	0xc6
+	.byte	0x14
+	.long	0x164
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x8
+	.long	.LASF41
+	.byte	0xc6
+	.byte	0x25
+	.long	0x3c
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x8
+	.long	.LASF37
+	.byte	0xc6
+	.byte	0x36
+	.long	0x149
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x8
+	.long	.LASF36
+	.byte	0xc6
+	.byte	0x48
+	.long	0x6a9
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1c
+	.long	.LASF43
+	.byte	0xc8
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0xa
+	.long	.LLRL57
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xcb
+	.byte	0x11
+	.long	0x3c
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x5
+	.long	.LLRL59
+	.long	0x5bf
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0xd1
+	.byte	0x15
+	.long	0x48
+	.uleb128 0x9
+	.quad	.LVL121
+	.long	0x9a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LLRL60
+	.long	0x5ed
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0xd4
+	.byte	0x1a
+	.long	0x118
+	.uleb128 0x9
+	.quad	.LVL130
+	.long	0x8af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LLRL64
+	.long	0x61b
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0xd7
+	.byte	0x1a
+	.long	0x118
+	.uleb128 0x9
+	.quad	.LVL146
+	.long	0x7bb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LLRL61
+	.long	0x638
+	.uleb128 0x4
+	.string	"str"
+	.byte	0xda
+	.byte	0x17
+	.long	0x164
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.uleb128 0x5
+	.long	.LLRL63
+	.long	0x64c
+	.uleb128 0x22
+	.string	"ch"
+	.byte	0xdf
+	.byte	0x15
+	.long	0x48
+	.byte	0
+	.uleb128 0x5
+	.long	.LLRL65
+	.long	0x67a
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0xe3
+	.byte	0x1a
+	.long	0x118
+	.uleb128 0x9
+	.quad	.LVL152
+	.long	0x8af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LLRL66
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0xe7
+	.byte	0x19
+	.long	0xda
+	.uleb128 0x9
+	.quad	.LVL157
+	.long	0x6ae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x82
+	.uleb128 0x10
+	.long	.LASF45
+	.byte	0x92
+	.byte	0x8
+	.long	0x3c
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7bb
+	.uleb128 0xd
+	.string	"num"
+	.byte	0x92
+	.byte	0x15
+	.long	0xda
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xd
+	.string	"str"
+	.byte	0x92
+	.byte	0x1f
+	.long	0x164
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x92
+	.byte	0x2d
+	.long	0x3c
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x94
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1c
+	.long	.LASF47
+	.byte	0x97
+	.byte	0x9
+	.long	0x48
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x5
+	.long	.LLRL50
+	.long	0x749
+	.uleb128 0x4
+	.string	"rem"
+	.byte	0xa7
+	.byte	0x10
+	.long	0x3c
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x16
+	.long	0xab0
+	.quad	.LBI49
+	.byte	.LVU253
+	.long	.LLRL44
+	.byte	0xb6
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x6
+	.long	0xabd
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0xa
+	.long	.LLRL44
+	.uleb128 0x2
+	.long	0xad5
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.long	0xae0
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x11
+	.long	0xaeb
+	.quad	.LBB51
+	.quad	.LBE51-.LBB51
+	.uleb128 0x2
+	.long	0xaec
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF48
+	.byte	0x75
+	.byte	0x8
+	.long	0x3c
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8af
+	.uleb128 0xd
+	.string	"num"
+	.byte	0x75
+	.byte	0x1a
+	.long	0x118
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x23
+	.string	"str"
+	.byte	0x75
+	.byte	0x24
+	.long	0x164
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x75
+	.byte	0x32
+	.long	0x3c
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x77
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x5
+	.long	.LLRL31
+	.long	0x83d
+	.uleb128 0x4
+	.string	"rem"
+	.byte	0x7c
+	.byte	0x10
+	.long	0x3c
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x16
+	.long	0xab0
+	.quad	.LBI36
+	.byte	.LVU187
+	.long	.LLRL33
+	.byte	0x8c
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x6
+	.long	0xabd
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xa
+	.long	.LLRL33
+	.uleb128 0x2
+	.long	0xad5
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x2
+	.long	0xae0
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x11
+	.long	0xaeb
+	.quad	.LBB38
+	.quad	.LBE38-.LBB38
+	.uleb128 0x2
+	.long	0xaec
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF49
+	.byte	0x55
+	.byte	0x8
+	.long	0x3c
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9a3
+	.uleb128 0xd
+	.string	"num"
+	.byte	0x55
+	.byte	0x19
+	.long	0x118
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x23
+	.string	"str"
+	.byte	0x55
+	.byte	0x23
+	.long	0x164
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x55
+	.byte	0x31
+	.long	0x3c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x57
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x5
+	.long	.LLRL20
+	.long	0x931
+	.uleb128 0x4
+	.string	"rem"
+	.byte	0x5c
+	.byte	0x10
+	.long	0x3c
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0x16
+	.long	0xab0
+	.quad	.LBI21
+	.byte	.LVU117
+	.long	.LLRL22
+	.byte	0x6c
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x6
+	.long	0xabd
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xa
+	.long	.LLRL22
+	.uleb128 0x2
+	.long	0xad5
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	0xae0
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x11
+	.long	0xaeb
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.uleb128 0x2
+	.long	0xaec
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF50
+	.byte	0x2b
+	.byte	0x8
+	.long	0x3c
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xab0
+	.uleb128 0xd
+	.string	"num"
+	.byte	0x2b
+	.byte	0x11
+	.long	0x48
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xd
+	.string	"str"
+	.byte	0x2b
+	.byte	0x1b
+	.long	0x164
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x8
+	.long	.LASF46
+	.byte	0x2b
+	.byte	0x29
+	.long	0x3c
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x2d
+	.byte	0xc
+	.long	0x3c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1c
+	.long	.LASF47
+	.byte	0x30
+	.byte	0x9
+	.long	0x48
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x5
+	.long	.LLRL15
+	.long	0xa3e
+	.uleb128 0x4
+	.string	"rem"
+	.byte	0x40
+	.byte	0x10
+	.long	0x3c
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x16
+	.long	0xab0
+	.quad	.LBI8
+	.byte	.LVU37
+	.long	.LLRL9
+	.byte	0x4f
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x6
+	.long	0xabd
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xa
+	.long	.LLRL9
+	.uleb128 0x2
+	.long	0xad5
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.long	0xae0
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x11
+	.long	0xaeb
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x2
+	.long	0xaec
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF51
+	.byte	0x1
+	.byte	0x19
+	.byte	0x6
+	.byte	0x1
+	.long	0xaf9
+	.uleb128 0x2c
+	.string	"str"
+	.byte	0x1
+	.byte	0x19
+	.byte	0x13
+	.long	0x164
+	.uleb128 0x2d
+	.long	.LASF52
+	.byte	0x1
+	.byte	0x19
+	.byte	0x21
+	.long	0x3c
+	.uleb128 0xb
+	.long	.LASF53
+	.byte	0x1b
+	.byte	0xc
+	.long	0x3c
+	.uleb128 0x22
+	.string	"end"
+	.byte	0x1c
+	.byte	0xc
+	.long	0x3c
+	.uleb128 0x2e
+	.uleb128 0xb
+	.long	.LASF54
+	.byte	0x20
+	.byte	0xe
+	.long	0x124
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0xab0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x30
+	.long	0xabd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.long	0xac9
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2
+	.long	0xad5
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2
+	.long	0xae0
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x11
+	.long	0xaeb
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x2
+	.long	0xaec
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 283
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS82:
+	.uleb128 .LVU605
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU623
+	.uleb128 .LVU623
+	.uleb128 .LVU624
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU604
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU610
+	.uleb128 .LVU610
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LFE13-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU580
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU599
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU579
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU593
+	.uleb128 .LVU593
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU554
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU573
+	.uleb128 .LVU573
+	.uleb128 .LVU574
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU553
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU536
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU545
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS76:
+	.uleb128 0
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL183-1-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU507
+	.uleb128 .LVU509
+	.uleb128 .LVU510
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU507
+	.uleb128 .LVU509
+	.uleb128 .LVU510
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU480
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU492
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU482
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU486
+	.uleb128 .LVU487
+	.uleb128 .LVU492
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL166-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU475
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU367
+	.uleb128 .LVU367
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU313
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+	.uleb128 .LVU355
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 .LVU359
+	.uleb128 .LVU375
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU379
+	.uleb128 .LVU388
+	.uleb128 .LVU396
+	.uleb128 .LVU405
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+	.uleb128 .LVU417
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 .LVU421
+	.uleb128 .LVU437
+	.uleb128 .LVU440
+	.uleb128 .LVU440
+	.uleb128 .LVU443
+	.uleb128 .LVU451
+	.uleb128 .LVU453
+	.uleb128 .LVU453
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU457
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU315
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU330
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU339
+	.uleb128 .LVU349
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU361
+	.uleb128 .LVU367
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU416
+	.uleb128 .LVU416
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU430
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU436
+	.uleb128 .LVU436
+	.uleb128 .LVU443
+	.uleb128 .LVU443
+	.uleb128 .LVU444
+	.uleb128 .LVU444
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 .LVU455
+	.uleb128 .LVU455
+	.uleb128 .LVU457
+	.uleb128 .LVU457
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU382
+	.uleb128 .LVU387
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 .LVU266
+	.uleb128 .LVU268
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU275
+	.uleb128 .LVU307
+	.uleb128 .LVU308
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 .LVU260
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU239
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU310
+	.uleb128 .LVU310
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU240
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU266
+	.uleb128 .LVU307
+	.uleb128 .LVU308
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU293
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU253
+	.uleb128 .LVU258
+	.uleb128 .LVU286
+	.uleb128 .LVU307
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU253
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 .LVU286
+	.uleb128 .LVU307
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU255
+	.uleb128 .LVU260
+	.uleb128 .LVU288
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU306
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU256
+	.uleb128 .LVU258
+	.uleb128 .LVU289
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 .LVU307
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU295
+	.uleb128 .LVU307
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x79
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x79
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x79
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU168
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU192
+	.uleb128 .LVU207
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU175
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU193
+	.uleb128 .LVU207
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU187
+	.uleb128 .LVU192
+	.uleb128 .LVU216
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU224
+	.uleb128 .LVU231
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU187
+	.uleb128 .LVU207
+	.uleb128 .LVU216
+	.uleb128 .LVU224
+	.uleb128 .LVU231
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU189
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU206
+	.uleb128 .LVU218
+	.uleb128 .LVU224
+	.uleb128 .LVU233
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU190
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU207
+	.uleb128 .LVU219
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU224
+	.uleb128 .LVU234
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU195
+	.uleb128 .LVU207
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU137
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x79
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x79
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x79
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU98
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU122
+	.uleb128 .LVU137
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU100
+	.uleb128 .LVU102
+	.uleb128 .LVU105
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU123
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU117
+	.uleb128 .LVU122
+	.uleb128 .LVU146
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU154
+	.uleb128 .LVU161
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU117
+	.uleb128 .LVU137
+	.uleb128 .LVU146
+	.uleb128 .LVU154
+	.uleb128 .LVU161
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU119
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU136
+	.uleb128 .LVU148
+	.uleb128 .LVU154
+	.uleb128 .LVU163
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU137
+	.uleb128 .LVU149
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU154
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU125
+	.uleb128 .LVU137
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU23
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU50
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU24
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU50
+	.uleb128 .LVU92
+	.uleb128 .LVU93
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 .LVU55
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU78
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+	.uleb128 .LVU71
+	.uleb128 .LVU92
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU71
+	.uleb128 .LVU92
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU39
+	.uleb128 .LVU44
+	.uleb128 .LVU73
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU91
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU40
+	.uleb128 .LVU42
+	.uleb128 .LVU74
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU92
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU80
+	.uleb128 .LVU92
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU9
+	.uleb128 .LVU19
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB19-.Ltext0
+	.uleb128 .LBE19-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB20-.Ltext0
+	.uleb128 .LBE20-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB21-.Ltext0
+	.uleb128 .LBE21-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0
+.LLRL31:
+	.byte	0x4
+	.uleb128 .LBB34-.Ltext0
+	.uleb128 .LBE34-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB35-.Ltext0
+	.uleb128 .LBE35-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB55-.Ltext0
+	.uleb128 .LBE55-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB84-.Ltext0
+	.uleb128 .LBE84-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB58-.Ltext0
+	.uleb128 .LBE58-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB60-.Ltext0
+	.uleb128 .LBE60-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0
+.LLRL63:
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF25:
+	.string	"tprintf"
+.LASF49:
+	.string	"__ultoa"
+.LASF47:
+	.string	"isNegative"
+.LASF26:
+	.string	"write_serial_str"
+.LASF22:
+	.string	"uint64_t"
+.LASF54:
+	.string	"temp"
+.LASF15:
+	.string	"short int"
+.LASF6:
+	.string	"size_t"
+.LASF34:
+	.string	"kprintf"
+.LASF27:
+	.string	"buff"
+.LASF13:
+	.string	"va_list"
+.LASF57:
+	.string	"__va_list_tag"
+.LASF16:
+	.string	"int64_t"
+.LASF44:
+	.string	"value"
+.LASF17:
+	.string	"uint8_t"
+.LASF30:
+	.string	"sprint_binary64"
+.LASF52:
+	.string	"length"
+.LASF40:
+	.string	"snprintf"
+.LASF4:
+	.string	"long long int"
+.LASF3:
+	.string	"long int"
+.LASF9:
+	.string	"fp_offset"
+.LASF55:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF8:
+	.string	"gp_offset"
+.LASF31:
+	.string	"sprint_binary32"
+.LASF5:
+	.string	"long double"
+.LASF50:
+	.string	"itoa"
+.LASF18:
+	.string	"unsigned char"
+.LASF28:
+	.string	"bitIndex"
+.LASF14:
+	.string	"signed char"
+.LASF21:
+	.string	"uint32_t"
+.LASF12:
+	.string	"unsigned int"
+.LASF19:
+	.string	"uint16_t"
+.LASF36:
+	.string	"args"
+.LASF53:
+	.string	"start"
+.LASF20:
+	.string	"short unsigned int"
+.LASF11:
+	.string	"reg_save_area"
+.LASF42:
+	.string	"vsnprintf"
+.LASF23:
+	.string	"char"
+.LASF39:
+	.string	"strlen"
+.LASF24:
+	.string	"_Bool"
+.LASF35:
+	.string	"buffer"
+.LASF29:
+	.string	"charIndex"
+.LASF2:
+	.string	"long unsigned int"
+.LASF56:
+	.string	"__builtin_va_list"
+.LASF48:
+	.string	"__ultoua"
+.LASF10:
+	.string	"overflow_arg_area"
+.LASF41:
+	.string	"size"
+.LASF38:
+	.string	"strcmp"
+.LASF7:
+	.string	"__gnuc_va_list"
+.LASF43:
+	.string	"bufferIndex"
+.LASF51:
+	.string	"reverse"
+.LASF32:
+	.string	"sprint_binary16"
+.LASF46:
+	.string	"base"
+.LASF37:
+	.string	"format"
+.LASF45:
+	.string	"ltoa"
+.LASF33:
+	.string	"sprint_binary8"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"src/lib/str.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
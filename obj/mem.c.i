@@ -0,0 +1,5132 @@
+# 0 "src/mem.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/mem.c"
+# 28 "src/mem.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 29 "src/mem.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 30 "src/mem.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 31 "src/mem.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 24 "src/include/mem.h" 2
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 32 "src/mem.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 467 "/usr/include/features.h" 3 4
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 468 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 33 "src/mem.c" 2
+
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 35 "src/mem.c" 2
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 36 "src/mem.c" 2
+# 1 "src/include/math.h" 1
+# 37 "src/mem.c" 2
+# 1 "src/include/bitmap.h" 1
+# 39 "src/include/bitmap.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 40 "src/include/bitmap.h" 2
+
+
+
+
+static inline 
+# 44 "src/include/bitmap.h" 3 4
+             _Bool 
+# 44 "src/include/bitmap.h"
+                  bitmap_test(const void *bitmap, size_t bit) {
+    const uint8_t *bitmap_u8 = (const uint8_t*)bitmap;
+
+    size_t byte_index = bit / 8;
+    uint8_t bit_mask = 1 << (bit % 8);
+
+    return (bitmap_u8[byte_index] & bit_mask) != 0;
+}
+
+
+static inline void bitmap_on(void *bitmap, size_t bit) {
+    uint8_t *bitmap_u8 = (uint8_t*)bitmap;
+    bitmap_u8[bit / 8] |= (1 << (bit % 8));
+}
+
+
+static inline void bitmap_off(void *bitmap, size_t bit) {
+    uint8_t *bitmap_u8 = (uint8_t*)bitmap;
+
+    bitmap_u8[bit / 8] &= ~(1 << (bit % 8));
+}
+
+
+
+static inline uint64_t _bitmap_word_mask(size_t shift, size_t count) {
+    return (count == 64) ? ~(uint64_t)0 : ((((uint64_t)1 << count) - 1) << shift);
+}
+
+
+static inline void bitmap_set_range(void *bitmap, size_t start, size_t count) {
+    uint64_t *words = (uint64_t*)bitmap;
+    size_t end = start + count;
+
+    while (start < end) {
+        size_t shift = start % 64;
+        size_t bits = (64 - shift < end - start) ? 64 - shift : end - start;
+
+        words[start / 64] |= _bitmap_word_mask(shift, bits);
+        start += bits;
+    }
+}
+
+
+static inline void bitmap_clear_range(void *bitmap, size_t start, size_t count) {
+    uint64_t *words = (uint64_t*)bitmap;
+    size_t end = start + count;
+
+    while (start < end) {
+        size_t shift = start % 64;
+        size_t bits = (64 - shift < end - start) ? 64 - shift : end - start;
+
+        words[start / 64] &= ~_bitmap_word_mask(shift, bits);
+        start += bits;
+    }
+}
+
+
+
+
+
+static inline size_t bitmap_find_clear(const void *bitmap, size_t start, size_t end) {
+    const uint64_t *words = (const uint64_t*)bitmap;
+
+    while (start < end) {
+        uint64_t word = ~words[start / 64] & (~(uint64_t)0 << (start % 64));
+
+        if (word != 0) {
+            size_t bit = (start & ~(size_t)63) + __builtin_ctzll(word);
+            return bit < end ? bit : end;
+        }
+
+        start = (start & ~(size_t)63) + 64;
+    }
+
+    return end;
+}
+
+
+static inline size_t bitmap_find_set(const void *bitmap, size_t start, size_t end) {
+    const uint64_t *words = (const uint64_t*)bitmap;
+
+    while (start < end) {
+        uint64_t word = words[start / 64] & (~(uint64_t)0 << (start % 64));
+
+        if (word != 0) {
+            size_t bit = (start & ~(size_t)63) + __builtin_ctzll(word);
+            return bit < end ? bit : end;
+        }
+
+        start = (start & ~(size_t)63) + 64;
+    }
+
+    return end;
+}
+
+
+
+
+
+
+struct summary_bitmap {
+    uint64_t *bits;
+    uint64_t *summary;
+    size_t num_bits;
+};
+
+
+static inline void _sbitmap_update(struct summary_bitmap *sb, size_t first, size_t last) {
+    for (size_t word = first; word <= last; word++) {
+        if (sb->bits[word] == ~(uint64_t)0) {
+            bitmap_on(sb->summary, word);
+        } else {
+            bitmap_off(sb->summary, word);
+        }
+    }
+}
+
+static inline 
+# 161 "src/include/bitmap.h" 3 4
+             _Bool 
+# 161 "src/include/bitmap.h"
+                  sbitmap_test(const struct summary_bitmap *sb, size_t bit) {
+    return bitmap_test(sb->bits, bit);
+}
+
+
+static inline void sbitmap_set_range(struct summary_bitmap *sb, size_t start, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    bitmap_set_range(sb->bits, start, count);
+
+    size_t first = start / 64;
+    size_t last = (start + count - 1) / 64;
+
+
+    _sbitmap_update(sb, first, first);
+    _sbitmap_update(sb, last, last);
+
+    if (last > first + 1) {
+        bitmap_set_range(sb->summary, first + 1, last - first - 1);
+    }
+}
+
+
+static inline void sbitmap_clear_range(struct summary_bitmap *sb, size_t start, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    bitmap_clear_range(sb->bits, start, count);
+    bitmap_clear_range(sb->summary, start / 64, ((start + count - 1) / 64) - (start / 64) + 1);
+}
+
+
+static inline size_t sbitmap_find_clear(const struct summary_bitmap *sb, size_t start) {
+    if (start >= sb->num_bits) {
+        return sb->num_bits;
+    }
+
+
+    size_t num_words = (sb->num_bits + 63) / 64;
+    size_t word = start / 64;
+    size_t bit = bitmap_find_clear(sb->bits, start, (word + 1) * 64);
+
+    if (bit < (word + 1) * 64) {
+        return bit < sb->num_bits ? bit : sb->num_bits;
+    }
+
+
+    word = bitmap_find_clear(sb->summary, word + 1, num_words);
+    if (word == num_words) {
+        return sb->num_bits;
+    }
+
+    bit = (word * 64) + __builtin_ctzll(~sb->bits[word]);
+    return bit < sb->num_bits ? bit : sb->num_bits;
+}
+
+
+
+
+
+static inline size_t sbitmap_find_clear_run(const struct summary_bitmap *sb, size_t start, size_t count) {
+    while (start < sb->num_bits) {
+        size_t run_start = sbitmap_find_clear(sb, start);
+
+        if (run_start + count > sb->num_bits) {
+            break;
+        }
+
+        size_t run_end = bitmap_find_set(sb->bits, run_start, run_start + count);
+        if (run_end == run_start + count) {
+            return run_start;
+        }
+
+        start = run_end;
+    }
+
+    return sb->num_bits;
+}
+# 38 "src/mem.c" 2
+# 1 "src/kernel.h" 1
+# 22 "src/kernel.h"
+# 1 "src/include/queue.h" 1
+# 25 "src/include/queue.h"
+typedef struct {
+    volatile uint32_t read_i;
+    volatile uint32_t write_i;
+    uint32_t *buff;
+    uint32_t len;
+    volatile uint32_t num_items;
+    spinlock_t lock;
+} __attribute__((packed)) CQueue_t;
+
+CQueue_t* cqueue_create(uint32_t len);
+
+# 35 "src/include/queue.h" 3 4
+_Bool 
+# 35 "src/include/queue.h"
+           cqueue_write(CQueue_t *q, uint32_t val);
+uint32_t cqueue_read(CQueue_t *q);
+# 23 "src/kernel.h" 2
+
+void report_cpu_details();
+
+
+static inline void hcf(void)
+{
+    asm("cli");
+    for (;;) {
+        asm("hlt");
+    }
+}
+
+extern CQueue_t *q_keyboard;
+# 39 "src/mem.c" 2
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 43 "src/include/cpu.h" 2
+# 51 "src/include/cpu.h"
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 40 "src/mem.c" 2
+# 1 "src/include/acpi.h" 1
+# 23 "src/include/acpi.h"
+void acpi_init();
+
+
+struct ioapic
+{
+    char type;
+    char length;
+    char ioapic_id;
+    char reserved;
+    uint32_t ioapic_addr;
+    uint32_t gsi_base;
+} __attribute__((packed));
+
+
+struct iso {
+    char type;
+    char length;
+    uint8_t bus_source;
+    uint8_t irq_source;
+    uint32_t gsi;
+    uint16_t flags;
+} __attribute__((packed));
+
+
+struct sysdesc {
+    char signature[4];
+    uint32_t length;
+    uint8_t revision;
+    uint8_t checksum;
+    char oem_id[6];
+    char oem_table_id[8];
+    uint32_t oem_revision;
+    uint32_t creator_id;
+    uint32_t creator_revision;
+} __attribute__((packed));
+
+struct address_structure
+{
+    uint8_t address_space_id;
+    uint8_t register_bit_width;
+    uint8_t register_bit_offset;
+    uint8_t reserved;
+    uint64_t address;
+} __attribute__((packed));
+
+
+struct hpet
+{
+    struct sysdesc desc;
+    uint8_t hardware_rev_id;
+    uint8_t comparator_count:5;
+    uint8_t counter_size:1;
+    uint8_t reserved:1;
+    uint8_t legacy_replacement:1;
+    uint16_t pci_vendor_id;
+    struct address_structure address;
+    uint8_t hpet_number;
+    uint16_t minimum_tick;
+    uint8_t page_protection;
+} __attribute__((packed));
+
+
+struct mcfg_entry {
+    struct sysdesc desc;
+    char reserved1[8];
+    uint64_t mmio_base;
+    uint16_t segment;
+    uint8_t start;
+    uint8_t end;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+
+struct srat_lapic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint8_t proximity_domain_low;
+    uint8_t apic_id;
+    uint32_t flags;
+    uint8_t sapic_eid;
+    uint8_t proximity_domain_high[3];
+    uint32_t clock_domain;
+} __attribute__((packed));
+
+
+struct srat_mem_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint32_t proximity_domain;
+    uint16_t reserved1;
+    uint64_t base;
+    uint64_t range_length;
+    uint32_t reserved2;
+    uint32_t flags;
+    uint64_t reserved3;
+} __attribute__((packed));
+
+
+struct srat_x2apic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint16_t reserved1;
+    uint32_t proximity_domain;
+    uint32_t x2apic_id;
+    uint32_t flags;
+    uint32_t clock_domain;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+
+struct slit {
+    struct sysdesc desc;
+    uint64_t num_localities;
+    uint8_t entries[];
+} __attribute__((packed));
+# 149 "src/include/acpi.h"
+struct numa_cpu {
+    uint32_t apic_id;
+    uint32_t node;
+};
+
+extern struct ioapic *ioapic_list[];
+extern struct iso *iso_list[];
+extern struct hpet *hpet;
+extern struct mcfg_entry *mcfg;
+extern struct srat_mem_affinity *srat_mem_list[];
+extern uint32_t numa_node_count;
+
+uint32_t acpi_numa_node(uint32_t proximity_domain);
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id);
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node);
+# 41 "src/mem.c" 2
+# 1 "src/include/cpuid.h" 1
+# 24 "src/include/cpuid.h"
+static inline void get_cpu_vendor(char *buffer)
+{
+    uint32_t ebx, edx, ecx;
+
+    asm volatile (
+        "cpuid"
+        : "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0)
+        :
+        );
+
+    *((uint32_t*)buffer) = ebx;
+    *((uint32_t*)(buffer + 4)) = edx;
+    *((uint32_t*)(buffer + 8)) = ecx;
+}
+
+static inline void get_cpu_brand(char *brandString) {
+    uint32_t eax, ebx, ecx, edx;
+    char *ptr = brandString;
+
+    for (int i = 0; i < 3; i++) {
+        asm volatile(
+            "cpuid"
+            : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+            : "a"(0x80000002 + i)
+        );
+
+        *((uint32_t*)ptr) = eax;
+        *((uint32_t*)(ptr + 4)) = ebx;
+        *((uint32_t*)(ptr + 8)) = ecx;
+        *((uint32_t*)(ptr + 12)) = edx;
+        ptr += 16;
+    }
+}
+
+static inline void get_cpu_topology(uint32_t *logicalProcessorsPerCore, uint32_t *totalLogicalProcessors) {
+    uint32_t eax, ebx, ecx, edx;
+    uint32_t levelType = 0;
+    *logicalProcessorsPerCore = 0;
+    *totalLogicalProcessors = 0;
+
+
+    uint32_t level = 0;
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0xB), "c"(level)
+    );
+
+
+    if (ebx & 0xFFFF) {
+        *totalLogicalProcessors = ebx & 0xFFFF;
+    }
+
+
+    while (ecx & 0xFF00) {
+        levelType = (ecx >> 8) & 0xFF;
+        if (levelType == 2) {
+            *logicalProcessorsPerCore = ebx & 0xFFFF;
+            break;
+        }
+
+        level++;
+        asm volatile(
+            "cpuid"
+            : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+            : "a"(0xB), "c"(level)
+        );
+    }
+}
+
+static inline void get_cpu_frequency(uint32_t *baseFrequencyMHz, uint32_t *maxFrequencyMHz, uint32_t *busFrequencyMHz) {
+    uint32_t eax, ebx, ecx, edx;
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0x16)
+    );
+
+    *baseFrequencyMHz = eax & 0xFFFF;
+    *maxFrequencyMHz = ebx & 0xFFFF;
+    *busFrequencyMHz = ecx & 0xFFFF;
+}
+
+
+
+
+static inline 
+# 112 "src/include/cpuid.h" 3 4
+             _Bool 
+# 112 "src/include/cpuid.h"
+                  cpu_has_erms() {
+    uint32_t eax, ebx, ecx, edx;
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0)
+    );
+
+    if (eax < 7) {
+        return 
+# 122 "src/include/cpuid.h" 3 4
+              0
+# 122 "src/include/cpuid.h"
+                   ;
+    }
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(7), "c"(0)
+    );
+
+    return (ebx >> 9) & 1;
+}
+# 143 "src/include/cpuid.h"
+struct cpu_cache {
+    uint32_t type;
+    uint32_t level;
+    uint32_t line_size;
+    uint32_t partitions;
+    uint32_t ways;
+    uint32_t sets;
+    uint64_t size;
+};
+
+
+
+
+
+static inline 
+# 157 "src/include/cpuid.h" 3 4
+             _Bool 
+# 157 "src/include/cpuid.h"
+                  get_cpu_cache(uint32_t index, struct cpu_cache *pCache) {
+    uint32_t eax, ebx, ecx, edx;
+    uint32_t leaf = 4;
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0)
+    );
+
+
+    if (ebx == 0x68747541) {
+        leaf = 0x8000001D;
+
+        asm volatile(
+            "cpuid"
+            : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+            : "a"(0x80000000)
+        );
+    }
+
+    if (eax < leaf) {
+        return 
+# 179 "src/include/cpuid.h" 3 4
+              0
+# 179 "src/include/cpuid.h"
+                   ;
+    }
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(leaf), "c"(index)
+    );
+
+    pCache->type = eax & 0x1F;
+    pCache->level = (eax >> 5) & 0x7;
+    pCache->line_size = (ebx & 0xFFF) + 1;
+    pCache->partitions = ((ebx >> 12) & 0x3FF) + 1;
+    pCache->ways = ((ebx >> 22) & 0x3FF) + 1;
+    pCache->sets = ecx + 1;
+    pCache->size = (uint64_t)pCache->line_size * pCache->partitions * pCache->ways * pCache->sets;
+
+    return pCache->type != 0;
+}
+# 42 "src/mem.c" 2
+# 1 "src/include/serial.h" 1
+# 43 "src/mem.c" 2
+# 1 "src/include/memblock.h" 1
+# 22 "src/include/memblock.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/memblock.h" 2
+# 37 "src/include/memblock.h"
+void* memblock_alloc(size_t size, size_t align);
+void* memblock_alloc_range(size_t size, size_t align, uint64_t min_addr, uint64_t max_addr);
+void memblock_free(void *ptr, size_t size);
+
+# 40 "src/include/memblock.h" 3 4
+_Bool 
+# 40 "src/include/memblock.h"
+    memblock_find_free(uint64_t base, uint64_t end, uint64_t *pStart, uint64_t *pEnd);
+uint64_t memblock_reserved_pages();
+void memblock_seal();
+# 44 "src/mem.c" 2
+
+spinlock_t lock = {0};
+
+
+uint64_t max_pages_available;
+
+uint64_t total_memory_bytes;
+
+volatile struct limine_memmap_request memmap_request = {
+    .id = { 0xc7b1dd30df4c8b88, 0x0a82e883a194f07b, 0x67cf3d9d378a806f, 0xe304acdfc50c3c62 },
+    .revision = 0};
+
+volatile struct limine_hhdm_request hhdm_request = {
+    .id = { 0xc7b1dd30df4c8b88, 0x0a82e883a194f07b, 0x48dcf1cb8ad2b852, 0x63984e959a98244b },
+    .revision = 0
+};
+
+volatile struct limine_memmap_response *memmap;
+volatile struct limine_hhdm_response *hhdm;
+
+
+uint64_t highest_address = 0;
+
+
+uint64_t lowest_address = 0;
+
+
+
+
+
+static uint64_t num_pages_in_map = 0;
+
+
+
+
+
+
+
+static uint64_t *section_base;
+static uint32_t *section_index;
+static uint64_t num_sections = 0;
+static uint64_t num_section_slots = 0;
+
+
+
+
+
+
+static struct summary_bitmap page_bitmap = {0};
+
+
+uint64_t vmm_higher_half_offset = 0;
+
+uint64_t num_pages_available = 0;
+
+
+
+
+
+
+static struct page **page_chunks;
+static uint64_t num_page_chunks = 0;
+static uint64_t num_desc_chunks = 0;
+static uint64_t num_desc_pages = 0;
+
+
+
+
+
+struct DescPool {
+    uint64_t next_page;
+    uint64_t end_page;
+};
+
+static struct DescPool desc_pools[8];
+
+
+
+
+
+static uint64_t *free_heads;
+
+
+
+
+
+struct FreeBlock {
+    struct FreeBlock *pNext;
+    struct FreeBlock *pPrev;
+    uint8_t order;
+};
+
+
+
+
+
+struct MemZone {
+    struct FreeBlock *free_lists[18 + 1];
+    uint64_t free_counts[18 + 1];
+    uint64_t free_pages;
+};
+
+
+
+
+
+
+struct MemNode {
+    struct MemZone zones[2];
+    uint32_t fallback[8];
+};
+
+static struct MemNode mem_nodes[8];
+static uint32_t mem_node_count = 1;
+
+
+
+
+
+
+struct MemRange {
+    uint64_t start_page;
+    uint64_t end_page;
+    uint32_t node;
+    uint32_t zone;
+};
+
+static struct MemRange mem_ranges[32];
+static uint32_t num_mem_ranges = 0;
+
+
+static uint64_t dma32_end_page = 0;
+# 186 "src/mem.c"
+struct PageMagazine {
+    uint32_t count;
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t pages[256];
+} __attribute__((aligned(64)));
+
+static struct PageMagazine page_magazines[64];
+
+uint32_t pcp_low_watermark = 64;
+uint32_t pcp_high_watermark = 192;
+
+
+
+
+
+
+static spinlock_t zero_pool_lock = {0};
+static void *zero_pool[512];
+static uint32_t zero_pool_count = 0;
+
+uint64_t zero_pool_hits = 0;
+uint64_t zero_pool_misses = 0;
+# 219 "src/mem.c"
+static uint32_t page_colors = 1;
+static uint32_t color_cache_level = 0;
+static uint32_t color_cache_ways = 0;
+static uint64_t color_cache_size = 0;
+static uint32_t next_color = 0;
+static uint64_t color_lists[128][8];
+static uint32_t color_counts[128];
+static uint64_t color_list_pages = 0;
+
+
+
+
+
+
+
+static uint64_t deferred_start_page = 0;
+static volatile uint64_t deferred_next_page = 0;
+static volatile uint64_t deferred_chunks_done = 0;
+static volatile uint64_t deferred_pages_freed = 0;
+static volatile uint64_t deferred_cpus = 0;
+static uint64_t boot_init_cycles = 0;
+
+
+static uint64_t alloc_failures = 0;
+
+
+static uint64_t compact_runs = 0;
+static uint64_t compact_successes = 0;
+static uint64_t compact_pages_migrated = 0;
+static uint64_t compact_last_tsc = 0;
+# 257 "src/mem.c"
+static 
+# 257 "src/mem.c" 3 4
+      _Bool 
+# 257 "src/mem.c"
+           memops_erms = 
+# 257 "src/mem.c" 3 4
+                         0
+# 257 "src/mem.c"
+                              ;
+
+
+typedef uint64_t __attribute__((may_alias, aligned(1))) unaligned_u64;
+
+static void _memcpy_bytes(void *dest, const void *src, size_t n)
+{
+    uint8_t *pdest = (uint8_t *)dest;
+    const uint8_t *psrc = (const uint8_t *)src;
+
+    for (size_t i = 0; i < n; i++) {
+        pdest[i] = psrc[i];
+    }
+}
+
+static void _memcpy_words(void *dest, const void *src, size_t n)
+{
+    uint8_t *pdest = (uint8_t *)dest;
+    const uint8_t *psrc = (const uint8_t *)src;
+
+    for (; n >= 8; n -= 8, pdest += 8, psrc += 8) {
+        *(unaligned_u64 *)pdest = *(const unaligned_u64 *)psrc;
+    }
+
+    for (; n > 0; n--) {
+        *pdest++ = *psrc++;
+    }
+}
+
+static void _memcpy_erms(void *dest, const void *src, size_t n)
+{
+    asm volatile ("rep movsb" : "+D"(dest), "+S"(src), "+c"(n) : : "memory");
+}
+
+static void _memset_bytes(void *s, int c, size_t n)
+{
+    uint8_t *p = (uint8_t *)s;
+
+    for (size_t i = 0; i < n; i++) {
+        p[i] = (uint8_t)c;
+    }
+}
+
+static void _memset_words(void *s, int c, size_t n)
+{
+    uint8_t *p = (uint8_t *)s;
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)c;
+
+    for (; n >= 8; n -= 8, p += 8) {
+        *(unaligned_u64 *)p = pattern;
+    }
+
+    for (; n > 0; n--) {
+        *p++ = (uint8_t)c;
+    }
+}
+
+static void _memset_stosq(void *s, int c, size_t n)
+{
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)c;
+    size_t words = n / 8;
+    size_t tail = n % 8;
+
+    asm volatile ("rep stosq" : "+D"(s), "+c"(words) : "a"(pattern) : "memory");
+    asm volatile ("rep stosb" : "+D"(s), "+c"(tail) : "a"(pattern) : "memory");
+}
+
+
+
+
+void memops_init()
+{
+    memops_erms = cpu_has_erms();
+    kprintf("Memory ops: %s\n", memops_erms ? "ERMS rep movsb/stosq" : "8 byte words");
+}
+
+
+
+
+
+void *memcpy(void *dest, const void *src, size_t n)
+{
+    if (memops_erms && n >= 256) {
+        _memcpy_erms(dest, src, n);
+    } else {
+        _memcpy_words(dest, src, n);
+    }
+
+    return dest;
+}
+
+void *memset(void *s, int c, size_t n)
+{
+    if (memops_erms && n >= 256) {
+        _memset_stosq(s, c, n);
+    } else {
+        _memset_words(s, c, n);
+    }
+
+    return s;
+}
+
+void *memmove(void *dest, const void *src, size_t n)
+{
+    uint8_t *pdest = (uint8_t *)dest;
+    const uint8_t *psrc = (const uint8_t *)src;
+
+
+
+    if (pdest <= psrc || pdest >= psrc + n) {
+        return memcpy(dest, src, n);
+    }
+
+
+    for (; n >= 8; n -= 8) {
+        *(unaligned_u64 *)(pdest + n - 8) = *(const unaligned_u64 *)(psrc + n - 8);
+    }
+
+    for (; n > 0; n--) {
+        pdest[n - 1] = psrc[n - 1];
+    }
+
+    return dest;
+}
+
+int memcmp(const void *s1, const void *s2, size_t n)
+{
+    const uint8_t *p1 = (const uint8_t *)s1;
+    const uint8_t *p2 = (const uint8_t *)s2;
+    size_t i = 0;
+
+
+    for (; i + 8 <= n; i += 8) {
+        if (*(const unaligned_u64 *)(p1 + i) != *(const unaligned_u64 *)(p2 + i)) {
+            break;
+        }
+    }
+
+    for (; i < n; i++)
+    {
+        if (p1[i] != p2[i])
+        {
+            return p1[i] < p2[i] ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+
+
+
+static void _print_rate(const char *name, uint64_t rate)
+{
+    kprintf(" %s %lu.%d%d", name, rate / 100, (int)(rate / 10 % 10), (int)(rate % 10));
+}
+
+
+
+
+
+static uint64_t _bench_memop(void (*fn)(void*, const void*, size_t), void *pDest, const void *pSrc, size_t size)
+{
+    uint64_t iterations = (((16 * 1024 * 1024) / size) > (1) ? ((16 * 1024 * 1024) / size) : (1));
+
+
+    fn(pDest, pSrc, size);
+
+    uint64_t start = rdtsc();
+
+    for (uint64_t i = 0; i < iterations; i++) {
+        fn(pDest, pSrc, size);
+    }
+
+    uint64_t cycles = ((rdtsc() - start) > (1) ? (rdtsc() - start) : (1));
+
+    return size * iterations * 100 / cycles;
+}
+
+static void _bench_memset_bytes(void *pDest, const void *pSrc, size_t n) { _memset_bytes(pDest, (int)(uint64_t)pSrc, n); }
+static void _bench_memset_words(void *pDest, const void *pSrc, size_t n) { _memset_words(pDest, (int)(uint64_t)pSrc, n); }
+static void _bench_memset_stosq(void *pDest, const void *pSrc, size_t n) { _memset_stosq(pDest, (int)(uint64_t)pSrc, n); }
+
+
+
+
+void memops_benchmark()
+{
+    static const size_t sizes[] = { 64, 512, 4096, 65536, 1048576 };
+
+    uint8_t *pSrc = kpalloc((1024 * 1024) / 4096);
+    uint8_t *pDest = kpalloc((1024 * 1024) / 4096);
+
+    if (pSrc == 
+# 450 "src/mem.c" 3 4
+               ((void *)0) 
+# 450 "src/mem.c"
+                    || pDest == 
+# 450 "src/mem.c" 3 4
+                                ((void *)0)
+# 450 "src/mem.c"
+                                    ) {
+        kprintf("Memory ops benchmark couldn't allocate its buffers.\n");
+        kfree(pSrc);
+        kfree(pDest);
+        return;
+    }
+
+    _memset_words(pSrc, 0xA5, (1024 * 1024));
+
+    kprintf("Memory ops benchmark (bytes/cycle):\n");
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        kprintf("memcpy %lu:", sizes[i]);
+        _print_rate("bytes", _bench_memop(_memcpy_bytes, pDest, pSrc, sizes[i]));
+        _print_rate("words", _bench_memop(_memcpy_words, pDest, pSrc, sizes[i]));
+        if (memops_erms) {
+            _print_rate("erms", _bench_memop(_memcpy_erms, pDest, pSrc, sizes[i]));
+        }
+        kprintf("\n");
+
+        kprintf("memset %lu:", sizes[i]);
+        _print_rate("bytes", _bench_memop(_bench_memset_bytes, pDest, (void*)0x5A, sizes[i]));
+        _print_rate("words", _bench_memop(_bench_memset_words, pDest, (void*)0x5A, sizes[i]));
+        if (memops_erms) {
+            _print_rate("stosq", _bench_memop(_bench_memset_stosq, pDest, (void*)0x5A, sizes[i]));
+        }
+        kprintf("\n");
+    }
+
+    kfree(pSrc);
+    kfree(pDest);
+}
+
+
+
+
+void _print_bitmap(uint64_t start, uint64_t len)
+{
+    kprintf("Bitmap (%d-%d): ", start, start+len);
+    for (uint64_t i = start; i < start+len; i++) {
+        kprintf(sbitmap_test(&page_bitmap, i) ? "1" : "0");
+    }
+    kprintf("\n");
+}
+
+
+
+
+
+static void _zero_pages_nt(void *pPages, uint64_t pages)
+{
+    uint64_t *pData = (uint64_t*)pPages;
+    uint64_t *pEnd = pData + (pages * 4096 / sizeof(uint64_t));
+
+    for (; pData < pEnd; pData += 4) {
+        asm volatile (
+            "movnti %1, 0(%0)\n"
+            "movnti %1, 8(%0)\n"
+            "movnti %1, 16(%0)\n"
+            "movnti %1, 24(%0)\n"
+            : : "r"(pData), "r"((uint64_t)0) : "memory");
+    }
+
+
+    asm volatile ("sfence" : : : "memory");
+}
+
+
+
+
+
+void* memmap_alloc(size_t length)
+{
+    void *pData = memblock_alloc((((length) + (4096) - 1) / (4096)) * (4096), 4096);
+    _zero_pages_nt(pData, (((length) + (4096) - 1) / (4096)));
+    return pData;
+}
+
+
+
+
+static void _split_zone_ranges()
+{
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->start_page < dma32_end_page && pRange->end_page > dma32_end_page) {
+
+            if (num_mem_ranges == 32) {
+                kprintf("*FATAL*: No memory range slot left to split the range crossing 4 GiB.\n");
+                hcf();
+            }
+
+            for (uint32_t j = num_mem_ranges; j > i + 1; j--) {
+                mem_ranges[j] = mem_ranges[j - 1];
+            }
+
+            mem_ranges[i + 1] = *pRange;
+            mem_ranges[i + 1].start_page = dma32_end_page;
+            pRange->end_page = dma32_end_page;
+            num_mem_ranges++;
+        }
+
+        pRange->zone = pRange->start_page < dma32_end_page ? 0 : 1;
+    }
+}
+
+
+
+
+
+void _create_page_map()
+{
+    num_page_chunks = (((num_pages_in_map) + (((uint64_t)1 << 9)) - 1) / (((uint64_t)1 << 9)));
+
+    uint64_t index_size = num_page_chunks * sizeof(struct page*);
+    uint64_t heads_size = (((num_pages_in_map) + (64) - 1) / (64)) * 8;
+
+    kprintf("Page Descriptor Index Size: %lu Kib\n", (((index_size + heads_size) + (1024) - 1) / (1024)));
+
+    page_chunks = (struct page**)memblock_alloc(index_size, 64);
+    memset(page_chunks, 0, index_size);
+
+    free_heads = (uint64_t*)memblock_alloc(heads_size, 64);
+}
+
+void _create_page_bitmap()
+{
+
+
+
+    uint64_t bits_size = (((num_pages_in_map) + (64) - 1) / (64)) * 8;
+    uint64_t summary_size = (((bits_size / 8) + (64) - 1) / (64)) * 8;
+    uint64_t bitmap_size = (((bits_size + summary_size) + (4096) - 1) / (4096)) * (4096);
+
+    kprintf("Page Bitmap Size: %lu Kib\n", bitmap_size / 1024);
+
+
+    page_bitmap.bits = (uint64_t*)memblock_alloc(bitmap_size, 4096);
+    page_bitmap.summary = (uint64_t*)((char*)page_bitmap.bits + bits_size);
+    page_bitmap.num_bits = num_pages_in_map;
+
+
+
+    memset(page_bitmap.bits, 0xFF, bitmap_size);
+}
+
+
+
+
+
+static uint64_t _phys_to_page(uint64_t phys)
+{
+    if (phys < lowest_address) {
+        return 0;
+    }
+
+    uint64_t slot = (phys - lowest_address) / (((uint64_t)1 << 18) * 4096);
+
+    if (slot >= num_section_slots) {
+        return num_pages_in_map;
+    }
+
+    uint64_t section = section_index[slot];
+    uint64_t section_start = lowest_address + slot * ((uint64_t)1 << 18) * 4096;
+
+    if (section == num_sections) {
+        return num_pages_in_map;
+    }
+
+    if (section_base[section] != section_start) {
+        return section << 18;
+    }
+
+    return (((section << 18) + (phys - section_start) / 4096) < (num_pages_in_map) ? ((section << 18) + (phys - section_start) / 4096) : (num_pages_in_map));
+}
+
+
+
+
+
+static void _init_sections()
+{
+    uint64_t section_bytes = ((uint64_t)1 << 18) * 4096;
+    num_section_slots = (((highest_address - lowest_address) + (section_bytes) - 1) / (section_bytes));
+
+    section_index = (uint32_t*)memblock_alloc(num_section_slots * sizeof(uint32_t), 64);
+    memset(section_index, 0, num_section_slots * sizeof(uint32_t));
+
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type != 0 || entry->length == 0) {
+            continue;
+        }
+
+        uint64_t first = (entry->base - lowest_address) / section_bytes;
+        uint64_t last = (entry->base + entry->length - 1 - lowest_address) / section_bytes;
+
+        for (uint64_t slot = first; slot <= last; slot++) {
+            section_index[slot] = 1;
+        }
+    }
+
+    for (uint64_t slot = 0; slot < num_section_slots; slot++) {
+        num_sections += section_index[slot];
+    }
+
+    section_base = (uint64_t*)memblock_alloc(num_sections * sizeof(uint64_t), 64);
+
+
+    uint64_t section = num_sections;
+    for (uint64_t slot = num_section_slots; slot > 0; slot--) {
+        if (section_index[slot - 1]) {
+            section--;
+            section_base[section] = lowest_address + (slot - 1) * section_bytes;
+        }
+
+        section_index[slot - 1] = section;
+    }
+
+    uint64_t last_pages = (((highest_address - section_base[num_sections - 1]) + (4096) - 1) / (4096));
+    num_pages_in_map = ((num_sections - 1) << 18) + last_pages;
+
+    kprintf("PMM: %lu of %lu sections hold usable memory.\n", num_sections, num_section_slots);
+}
+
+void _init_stats()
+{
+    memmap = memmap_request.response;
+    hhdm = hhdm_request.response;
+    vmm_higher_half_offset = hhdm->offset;
+
+
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type == 0) {
+            total_memory_bytes += entry->length;
+
+
+            max_pages_available += entry->length / 4096;
+
+            highest_address = ((highest_address) > (entry->base + entry->length) ? (highest_address) : (entry->base + entry->length));
+
+            if (lowest_address == 0) {
+                lowest_address = entry->base;
+            } else {
+                lowest_address = ((lowest_address) < (entry->base) ? (lowest_address) : (entry->base));
+            }
+        }
+    }
+
+
+
+    lowest_address = (((lowest_address) / ((uint64_t)4096 << 18)) * ((uint64_t)4096 << 18));
+
+    _init_sections();
+
+
+    if (lowest_address < 0x100000000) {
+        dma32_end_page = _phys_to_page(0x100000000);
+    }
+
+
+    mem_ranges[0].start_page = 0;
+    mem_ranges[0].end_page = num_pages_in_map;
+    mem_ranges[0].node = 0;
+    num_mem_ranges = 1;
+
+    _split_zone_ranges();
+}
+
+static inline void* _get_addr_from_page(uint64_t page)
+{
+    uint64_t offset = (page & (((uint64_t)1 << 18) - 1)) * 4096;
+    return (void*)(section_base[page >> 18] + offset + vmm_higher_half_offset);
+}
+
+
+
+
+
+static inline uint64_t _get_page_from_addr(void* addr)
+{
+    uint64_t offset = (uint64_t)addr - vmm_higher_half_offset - lowest_address;
+    uint64_t slot = (offset / 4096) >> 18;
+
+    if (slot >= num_section_slots) {
+        return 0xffffffffffffffffUL;
+    }
+
+
+    uint64_t section = section_index[slot];
+    if (section == num_sections || section_base[section] != lowest_address + (slot << 18) * 4096) {
+        return 0xffffffffffffffffUL;
+    }
+
+    return (section << 18) | ((offset / 4096) & (((uint64_t)1 << 18) - 1));
+}
+
+void _reserve_pages(uint64_t startPage, uint64_t pages)
+{
+    sbitmap_set_range(&page_bitmap, startPage, pages);
+}
+
+void _release_pages(uint64_t startPage, uint64_t pages)
+{
+    sbitmap_clear_range(&page_bitmap, startPage, pages);
+}
+
+
+
+
+static inline uint8_t _pages_to_order(uint64_t pages)
+{
+    uint8_t order = 0;
+    while (((uint64_t)1 << order) < pages) {
+        order++;
+    }
+
+    return order;
+}
+
+
+
+
+static struct MemRange* _page_range(uint64_t page)
+{
+    for (uint32_t i = 0; i < num_mem_ranges - 1; i++) {
+        if (page < mem_ranges[i].end_page) {
+            return &mem_ranges[i];
+        }
+    }
+
+    return &mem_ranges[num_mem_ranges - 1];
+}
+
+
+
+
+static inline struct MemZone* _range_zone(struct MemRange *pRange)
+{
+    return &mem_nodes[pRange->node].zones[pRange->zone];
+}
+
+
+
+
+static void _free_list_add(struct MemZone *pZone, uint64_t page, uint8_t order)
+{
+    struct FreeBlock *pBlock = (struct FreeBlock*)_get_addr_from_page(page);
+
+    pBlock->pPrev = 
+# 805 "src/mem.c" 3 4
+                   ((void *)0)
+# 805 "src/mem.c"
+                       ;
+    pBlock->pNext = pZone->free_lists[order];
+
+    if (pZone->free_lists[order] != 
+# 808 "src/mem.c" 3 4
+                                   ((void *)0)
+# 808 "src/mem.c"
+                                       ) {
+        pZone->free_lists[order]->pPrev = pBlock;
+    }
+
+    pZone->free_lists[order] = pBlock;
+    pZone->free_counts[order]++;
+    pZone->free_pages += (uint64_t)1 << order;
+    pBlock->order = order;
+    bitmap_on(free_heads, page);
+}
+
+
+
+
+static void _free_list_remove(struct MemZone *pZone, uint64_t page, uint8_t order)
+{
+    struct FreeBlock *pBlock = (struct FreeBlock*)_get_addr_from_page(page);
+
+    if (pBlock->pPrev != 
+# 826 "src/mem.c" 3 4
+                        ((void *)0)
+# 826 "src/mem.c"
+                            ) {
+        pBlock->pPrev->pNext = pBlock->pNext;
+    } else {
+        pZone->free_lists[order] = pBlock->pNext;
+    }
+
+    if (pBlock->pNext != 
+# 832 "src/mem.c" 3 4
+                        ((void *)0)
+# 832 "src/mem.c"
+                            ) {
+        pBlock->pNext->pPrev = pBlock->pPrev;
+    }
+
+    pZone->free_counts[order]--;
+    pZone->free_pages -= (uint64_t)1 << order;
+    bitmap_off(free_heads, page);
+}
+
+
+
+
+
+static void _buddy_free_block(struct MemRange *pRange, uint64_t page, uint8_t order)
+{
+    struct MemZone *pZone = _range_zone(pRange);
+
+    while (order < 18) {
+        uint64_t buddy = page ^ ((uint64_t)1 << order);
+
+
+
+        if (buddy < pRange->start_page || buddy >= pRange->end_page ||
+            sbitmap_test(&page_bitmap, buddy) ||
+            !bitmap_test(free_heads, buddy) ||
+            ((struct FreeBlock*)_get_addr_from_page(buddy))->order != order) {
+            break;
+        }
+
+
+        _free_list_remove(pZone, buddy, order);
+        page = ((page) < (buddy) ? (page) : (buddy));
+        order++;
+    }
+
+    _free_list_add(pZone, page, order);
+}
+
+
+
+
+
+static void _buddy_free_range(uint64_t page, uint64_t count)
+{
+    while (count > 0) {
+        struct MemRange *pRange = _page_range(page);
+        uint64_t end = page + ((count) < (pRange->end_page - page) ? (count) : (pRange->end_page - page));
+
+        count -= end - page;
+
+        while (page < end) {
+            uint8_t order = 0;
+
+            while (order < 18 &&
+                   (page & (((uint64_t)1 << (order + 1)) - 1)) == 0 &&
+                   page + ((uint64_t)1 << (order + 1)) <= end) {
+                order++;
+            }
+
+            _buddy_free_block(pRange, page, order);
+            page += (uint64_t)1 << order;
+        }
+    }
+}
+
+
+
+
+
+static 
+# 901 "src/mem.c" 3 4
+      _Bool 
+# 901 "src/mem.c"
+           _buddy_alloc(struct MemZone *pZone, uint8_t order, uint64_t *pPage)
+{
+    uint8_t found = order;
+
+    while (found <= 18 && pZone->free_lists[found] == 
+# 905 "src/mem.c" 3 4
+                                                                  ((void *)0)
+# 905 "src/mem.c"
+                                                                      ) {
+        found++;
+    }
+
+    if (found > 18) {
+        return 
+# 910 "src/mem.c" 3 4
+              0
+# 910 "src/mem.c"
+                   ;
+    }
+
+    uint64_t page = _get_page_from_addr(pZone->free_lists[found]);
+    _free_list_remove(pZone, page, found);
+
+
+
+    while (found > order) {
+        found--;
+        _free_list_add(pZone, page + ((uint64_t)1 << found), found);
+    }
+
+    *pPage = page;
+    return 
+# 924 "src/mem.c" 3 4
+          1
+# 924 "src/mem.c"
+              ;
+}
+
+
+
+
+
+
+static uint64_t _free_usable_pages(uint64_t first, uint64_t last)
+{
+    uint64_t freed = 0;
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type != 0) {
+            continue;
+        }
+
+        uint64_t base = entry->base;
+        uint64_t end = entry->base + entry->length;
+        uint64_t free_start = 0;
+        uint64_t free_end = 0;
+
+        while (memblock_find_free(base, end, &free_start, &free_end)) {
+            base = free_end;
+
+
+            uint64_t start_bit = ((_phys_to_page((((free_start) + (4096) - 1) / (4096)) * (4096))) > (first) ? (_phys_to_page((((free_start) + (4096) - 1) / (4096)) * (4096))) : (first));
+            uint64_t end_bit = ((_phys_to_page((((free_end) / (4096)) * (4096)))) < (last) ? (_phys_to_page((((free_end) / (4096)) * (4096)))) : (last));
+
+            if (start_bit >= end_bit) {
+                continue;
+            }
+
+
+            _release_pages(start_bit, end_bit - start_bit);
+            _buddy_free_range(start_bit, end_bit - start_bit);
+            freed += end_bit - start_bit;
+        }
+    }
+
+    num_pages_available += freed;
+    return freed;
+}
+
+
+
+
+
+void _get_free_pages()
+{
+    kprintf("Searching for free memory pages...\n");
+
+    uint64_t boot_pages = 0;
+    deferred_start_page = num_pages_in_map;
+
+
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type != 0) {
+            kprintf(
+                "Memory Region Unusable: type %d, %d pages (%d mb)\n",
+                entry->type,
+                entry->length / 4096,
+                entry->length / 1024 / 1024);
+
+            continue;
+        } else {
+            kprintf(
+                "Memory Region Usable: %d pages (%d mb)\n",
+                entry->length / 4096,
+                entry->length / 1024 / 1024);
+        }
+
+        uint64_t start_bit = _phys_to_page(entry->base);
+        uint64_t pages_free = entry->length / 4096;
+
+        if (boot_pages < 16384 && boot_pages + pages_free >= 16384) {
+            uint64_t boot_end = start_bit + (16384 - boot_pages);
+            deferred_start_page = (((((boot_end) + (32768) - 1) / (32768)) * (32768)) < (num_pages_in_map) ? ((((boot_end) + (32768) - 1) / (32768)) * (32768)) : (num_pages_in_map));
+        }
+
+        boot_pages += pages_free;
+    }
+
+
+    memset(free_heads, 0, (((deferred_start_page) + (64) - 1) / (64)) * 8);
+
+
+    memblock_seal();
+    max_pages_available -= memblock_reserved_pages();
+
+    _free_usable_pages(0, deferred_start_page);
+    deferred_next_page = deferred_start_page;
+}
+
+
+
+
+
+
+void kmem_init_deferred()
+{
+    uint64_t num_chunks = (((num_pages_in_map - deferred_start_page) + (32768) - 1) / (32768));
+    uint64_t start_cycles = rdtsc();
+    
+# 1032 "src/mem.c" 3 4
+   _Bool 
+# 1032 "src/mem.c"
+        worked = 
+# 1032 "src/mem.c" 3 4
+                 0
+# 1032 "src/mem.c"
+                      ;
+
+    while (
+# 1034 "src/mem.c" 3 4
+          1
+# 1034 "src/mem.c"
+              ) {
+        uint64_t first = __sync_fetch_and_add(&deferred_next_page, 32768);
+        if (first >= num_pages_in_map) {
+            break;
+        }
+
+        uint64_t last = ((first + 32768) < (num_pages_in_map) ? (first + 32768) : (num_pages_in_map));
+
+        if (!worked) {
+            worked = 
+# 1043 "src/mem.c" 3 4
+                    1
+# 1043 "src/mem.c"
+                        ;
+            __sync_fetch_and_add(&deferred_cpus, 1);
+        }
+
+
+
+        memset(&free_heads[first / 64], 0, (((last - first) + (64) - 1) / (64)) * 8);
+
+        spinlock_lock(&lock);
+        uint64_t freed = _free_usable_pages(first, last);
+        spinlock_unlock(&lock);
+
+        __sync_fetch_and_add(&deferred_pages_freed, freed);
+        __sync_fetch_and_add(&deferred_chunks_done, 1);
+    }
+
+    if (cpu_index() != 0) {
+        return;
+    }
+
+    while (deferred_chunks_done < num_chunks) {
+
+        asm volatile("pause");
+    }
+
+    uint64_t cycles = rdtsc() - start_cycles;
+
+    kprintf("PMM: Boot init took %lu cycles.\n", boot_init_cycles);
+    kprintf("PMM: Deferred init freed %lu pages in %lu cycles across %lu CPUs.\n", deferred_pages_freed, cycles, deferred_cpus);
+    kprintf("PMM Available Pages: %lu\n", num_pages_available);
+    kprintf("PMM: Free pages in zone DMA32 %lu, NORMAL %lu.\n", kmem_zone_free_pages(0), kmem_zone_free_pages(1));
+}
+
+
+
+
+static 
+# 1079 "src/mem.c" 3 4
+      _Bool 
+# 1079 "src/mem.c"
+           _buddy_find_block(uint64_t page, uint64_t *pHead, uint8_t *pOrder)
+{
+    for (uint8_t order = 0; order <= 18; order++) {
+        uint64_t head = page & ~(((uint64_t)1 << order) - 1);
+
+        if (bitmap_test(free_heads, head) && ((struct FreeBlock*)_get_addr_from_page(head))->order == order) {
+            *pHead = head;
+            *pOrder = order;
+            return 
+# 1087 "src/mem.c" 3 4
+                  1
+# 1087 "src/mem.c"
+                      ;
+        }
+    }
+
+    return 
+# 1091 "src/mem.c" 3 4
+          0
+# 1091 "src/mem.c"
+               ;
+}
+
+
+
+
+
+static void _buddy_take_range(uint64_t page, uint64_t count)
+{
+    uint64_t end = page + count;
+    uint64_t head = 0;
+    uint8_t order = 0;
+
+    while (page < end) {
+        if (!_buddy_find_block(page, &head, &order)) {
+            kprintf("*FATAL*: PMM page %lu is marked free but isn't in a free block.\n", page);
+            hcf();
+        }
+
+        uint64_t block_end = head + ((uint64_t)1 << order);
+
+        _free_list_remove(_range_zone(_page_range(head)), head, order);
+        _buddy_free_range(head, page - head);
+
+        if (block_end > end) {
+            _buddy_free_range(end, block_end - end);
+        }
+
+        page = ((block_end) < (end) ? (block_end) : (end));
+    }
+}
+
+
+
+
+static inline struct page* _page_find(uint64_t page)
+{
+    struct page *pChunk = page_chunks[page >> 9];
+    return pChunk != 
+# 1129 "src/mem.c" 3 4
+                    ((void *)0) 
+# 1129 "src/mem.c"
+                         ? &pChunk[page & (((uint64_t)1 << 9) - 1)] : 
+# 1129 "src/mem.c" 3 4
+                                                                        ((void *)0)
+# 1129 "src/mem.c"
+                                                                            ;
+}
+
+
+
+
+static inline struct page* _page(uint64_t page)
+{
+    return &page_chunks[page >> 9][page & (((uint64_t)1 << 9) - 1)];
+}
+
+
+
+
+static inline uint64_t _page_allocated(uint64_t page)
+{
+    struct page *pPage = _page_find(page);
+    return pPage != 
+# 1146 "src/mem.c" 3 4
+                   ((void *)0) 
+# 1146 "src/mem.c"
+                        ? pPage->pages_allocated : 0;
+}
+
+
+
+
+
+
+static 
+# 1154 "src/mem.c" 3 4
+      _Bool 
+# 1154 "src/mem.c"
+           _page_desc_block(uint32_t node, uint64_t *pBlock)
+{
+    struct DescPool *pPool = &desc_pools[node];
+
+    if (pPool->next_page == pPool->end_page) {
+        uint64_t page = 0;
+        
+# 1160 "src/mem.c" 3 4
+       _Bool 
+# 1160 "src/mem.c"
+            found = 
+# 1160 "src/mem.c" 3 4
+                    0
+# 1160 "src/mem.c"
+                         ;
+        uint8_t order = 9;
+
+        while (!found) {
+
+            for (uint32_t i = 0; i < mem_node_count * 2 && !found; i++) {
+                struct MemNode *pNode = &mem_nodes[mem_nodes[node].fallback[i / 2]];
+                found = _buddy_alloc(&pNode->zones[2 - 1 - (i % 2)], order, &page);
+            }
+
+            if (!found && order == 2) {
+                return 
+# 1171 "src/mem.c" 3 4
+                      0
+# 1171 "src/mem.c"
+                           ;
+            }
+
+            if (!found) {
+                order = 2;
+            }
+        }
+
+        uint64_t pages = (uint64_t)1 << order;
+        _reserve_pages(page, pages);
+        num_pages_available -= pages;
+        num_desc_pages += pages;
+
+        pPool->next_page = page;
+        pPool->end_page = page + pages;
+    }
+
+    *pBlock = pPool->next_page;
+    pPool->next_page += (uint64_t)1 << 2;
+
+    return 
+# 1191 "src/mem.c" 3 4
+          1
+# 1191 "src/mem.c"
+              ;
+}
+
+
+
+
+
+
+
+static 
+# 1200 "src/mem.c" 3 4
+      _Bool 
+# 1200 "src/mem.c"
+           _page_desc_ensure(uint64_t page, uint64_t pages)
+{
+    uint64_t last = (page + ((pages) < (((uint64_t)1 << 9)) ? (pages) : (((uint64_t)1 << 9))) - 1) >> 9;
+
+    for (uint64_t chunk = page >> 9; chunk <= last; chunk++) {
+        if (page_chunks[chunk] != 
+# 1205 "src/mem.c" 3 4
+                                 ((void *)0)
+# 1205 "src/mem.c"
+                                     ) {
+            continue;
+        }
+
+        uint64_t block = 0;
+
+        if (!_page_desc_block(_page_range(chunk << 9)->node, &block)) {
+            return 
+# 1212 "src/mem.c" 3 4
+                  0
+# 1212 "src/mem.c"
+                       ;
+        }
+
+        struct page *pChunk = (struct page*)_get_addr_from_page(block);
+        memset(pChunk, 0, sizeof(struct page) * ((uint64_t)1 << 9));
+
+        for (uint64_t i = 0; i < ((uint64_t)1 << 9); i++) {
+            pChunk[i].index = (chunk << 9) + i;
+            pChunk[i].lru_next = 0xFFFFFFFF;
+            pChunk[i].lru_prev = 0xFFFFFFFF;
+        }
+
+
+        __atomic_store_n(&page_chunks[chunk], pChunk, 3);
+        num_desc_chunks++;
+    }
+
+    return 
+# 1229 "src/mem.c" 3 4
+          1
+# 1229 "src/mem.c"
+              ;
+}
+
+
+
+
+
+static inline void _page_init_alloc(uint64_t page, uint64_t pages)
+{
+    struct page *pPage = _page(page);
+
+    pPage->pOwner = 
+# 1240 "src/mem.c" 3 4
+                   ((void *)0)
+# 1240 "src/mem.c"
+                       ;
+    pPage->pages_allocated = pages;
+    pPage->refcount = 1;
+    pPage->lru_next = 0xFFFFFFFF;
+    pPage->lru_prev = 0xFFFFFFFF;
+    pPage->flags = 0;
+}
+
+
+
+
+
+static void _pcp_refill(struct PageMagazine *pMag, uint32_t node)
+{
+    spinlock_lock(&lock);
+
+    uint64_t page = 0;
+
+
+    for (uint32_t i = 0; i < mem_node_count * 2 && pMag->count < pcp_low_watermark; i++) {
+        struct MemNode *pNode = &mem_nodes[mem_nodes[node].fallback[i / 2]];
+        struct MemZone *pZone = &pNode->zones[2 - 1 - (i % 2)];
+        uint8_t order = 18;
+
+        while (pMag->count < pcp_low_watermark) {
+            uint64_t needed = pcp_low_watermark - pMag->count;
+
+            while (((uint64_t)1 << order) > needed) {
+                order--;
+            }
+
+            if (!_buddy_alloc(pZone, order, &page)) {
+                if (order == 0) {
+                    break;
+                }
+
+                order--;
+                continue;
+            }
+
+            uint64_t pages = (uint64_t)1 << order;
+            _reserve_pages(page, pages);
+
+
+            if (!_page_desc_ensure(page, pages)) {
+                _release_pages(page, pages);
+                _buddy_free_range(page, pages);
+                spinlock_unlock(&lock);
+                return;
+            }
+
+            num_pages_available -= pages;
+
+            for (uint64_t p = 0; p < pages; p++) {
+                pMag->pages[pMag->count++] = page + p;
+            }
+        }
+    }
+
+    spinlock_unlock(&lock);
+}
+
+
+
+
+static void _pcp_drain(struct PageMagazine *pMag, uint32_t target)
+{
+    spinlock_lock(&lock);
+
+    while (pMag->count > target) {
+        uint64_t page = pMag->pages[--pMag->count];
+        _release_pages(page, 1);
+        _buddy_free_block(_page_range(page), page, 0);
+        num_pages_available++;
+    }
+
+    spinlock_unlock(&lock);
+}
+
+
+
+
+static void* _pcp_alloc()
+{
+
+    
+# 1325 "src/mem.c" 3 4
+   _Bool 
+# 1325 "src/mem.c"
+        istate = set_interrupt_state(
+# 1325 "src/mem.c" 3 4
+                                     0
+# 1325 "src/mem.c"
+                                          );
+
+    struct PageMagazine *pMag = &page_magazines[cpu_index()];
+
+    if (pMag->count == 0) {
+        _pcp_refill(pMag, cpu_node());
+
+        if (pMag->count == 0) {
+            set_interrupt_state(istate);
+            return 
+# 1334 "src/mem.c" 3 4
+                  ((void *)0)
+# 1334 "src/mem.c"
+                      ;
+        }
+    }
+
+    uint64_t page = pMag->pages[--pMag->count];
+    _page_init_alloc(page, 1);
+
+    set_interrupt_state(istate);
+
+    return _get_addr_from_page(page);
+}
+
+
+
+
+static void _pcp_free(uint64_t page)
+{
+    
+# 1351 "src/mem.c" 3 4
+   _Bool 
+# 1351 "src/mem.c"
+        istate = set_interrupt_state(
+# 1351 "src/mem.c" 3 4
+                                     0
+# 1351 "src/mem.c"
+                                          );
+
+    struct PageMagazine *pMag = &page_magazines[cpu_index()];
+
+    _page(page)->pages_allocated = 0;
+    pMag->pages[pMag->count++] = page;
+
+    if (pMag->count >= pcp_high_watermark) {
+        _pcp_drain(pMag, pcp_low_watermark);
+    }
+
+    set_interrupt_state(istate);
+}
+
+
+
+
+void kmem_pcp_drain()
+{
+    
+# 1370 "src/mem.c" 3 4
+   _Bool 
+# 1370 "src/mem.c"
+        istate = set_interrupt_state(
+# 1370 "src/mem.c" 3 4
+                                     0
+# 1370 "src/mem.c"
+                                          );
+    _pcp_drain(&page_magazines[cpu_index()], 0);
+    set_interrupt_state(istate);
+}
+
+
+
+
+
+void kmem_pcp_tune(uint32_t low, uint32_t high)
+{
+    high = ((((high) > (2) ? (high) : (2))) < (256) ? (((high) > (2) ? (high) : (2))) : (256));
+    low = ((((low) > (1) ? (low) : (1))) < (high - 1) ? (((low) > (1) ? (low) : (1))) : (high - 1));
+
+    pcp_low_watermark = low;
+    pcp_high_watermark = high;
+
+    kprintf("PMM: Per-CPU page watermarks low %d, high %d.\n", low, high);
+}
+# 1397 "src/mem.c"
+static 
+# 1397 "src/mem.c" 3 4
+      _Bool 
+# 1397 "src/mem.c"
+           _take_pages(uint32_t node, uint32_t zone, uint64_t pages, uint8_t align_order, uint64_t *pPage)
+{
+    uint8_t order = _pages_to_order(pages);
+
+    if (order <= 18 && _buddy_alloc(&mem_nodes[node].zones[zone], order, pPage)) {
+        _buddy_free_range(*pPage + pages, ((uint64_t)1 << order) - pages);
+        return 
+# 1403 "src/mem.c" 3 4
+              1
+# 1403 "src/mem.c"
+                  ;
+    }
+
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->node != node || pRange->zone != zone) {
+            continue;
+        }
+
+        uint64_t align = (uint64_t)1 << align_order;
+        uint64_t page = (((pRange->start_page) + (align) - 1) / (align)) * (align);
+
+
+
+        while (page < pRange->end_page) {
+            uint64_t run = sbitmap_find_clear_run(&page_bitmap, page, pages);
+            if (run == page) {
+                break;
+            }
+
+            page = (((run) + (align) - 1) / (align)) * (align);
+        }
+
+        if (page + pages > pRange->end_page) {
+            continue;
+        }
+
+        _buddy_take_range(page, pages);
+        *pPage = page;
+        return 
+# 1433 "src/mem.c" 3 4
+              1
+# 1433 "src/mem.c"
+                  ;
+    }
+
+    return 
+# 1436 "src/mem.c" 3 4
+          0
+# 1436 "src/mem.c"
+               ;
+}
+
+
+
+
+
+static 
+# 1443 "src/mem.c" 3 4
+      _Bool 
+# 1443 "src/mem.c"
+           _take_pages_nearest(uint32_t node, uint32_t max_zone, uint64_t pages, uint8_t align_order, uint64_t *pPage)
+{
+    for (uint32_t i = 0; i < mem_node_count; i++) {
+        for (int32_t zone = max_zone; zone >= 0; zone--) {
+            if (_take_pages(mem_nodes[node].fallback[i], zone, pages, align_order, pPage)) {
+                return 
+# 1448 "src/mem.c" 3 4
+                      1
+# 1448 "src/mem.c"
+                          ;
+            }
+        }
+    }
+
+    return 
+# 1453 "src/mem.c" 3 4
+          0
+# 1453 "src/mem.c"
+               ;
+}
+
+
+
+
+
+static uint64_t _initialised_pages()
+{
+    uint64_t num_chunks = (((num_pages_in_map - deferred_start_page) + (32768) - 1) / (32768));
+    return deferred_chunks_done == num_chunks ? num_pages_in_map : deferred_start_page;
+}
+
+
+
+
+
+
+static uint64_t _compact_cost(uint64_t first, uint64_t count)
+{
+    uint64_t last = first + count;
+    uint64_t used = 0;
+    uint64_t page = bitmap_find_set(page_bitmap.bits, first, last);
+
+    while (page < last) {
+        struct page *pPage = _page_find(page);
+
+        if (pPage == 
+# 1480 "src/mem.c" 3 4
+                    ((void *)0) 
+# 1480 "src/mem.c"
+                         || pPage->pages_allocated == 0 ||
+            (pPage->flags & (0x20 | 0x08)) != 0x20 ||
+            pPage->refcount != 1 ||
+            page + pPage->pages_allocated > last) {
+            return 0xffffffffffffffffUL;
+        }
+
+        used += pPage->pages_allocated;
+        page = bitmap_find_set(page_bitmap.bits, page + pPage->pages_allocated, last);
+    }
+
+    return used;
+}
+
+
+
+
+
+
+static 
+# 1499 "src/mem.c" 3 4
+      _Bool 
+# 1499 "src/mem.c"
+           _compact_migrate(uint32_t node, uint32_t zone, uint64_t page)
+{
+    struct page *pOld = _page(page);
+    uint64_t pages = pOld->pages_allocated;
+    uint64_t dest = 0;
+
+    if (!_take_pages(node, zone, pages, 0, &dest)) {
+        return 
+# 1506 "src/mem.c" 3 4
+              0
+# 1506 "src/mem.c"
+                   ;
+    }
+
+    _reserve_pages(dest, pages);
+
+    if (!_page_desc_ensure(dest, pages)) {
+        _release_pages(dest, pages);
+        _buddy_free_range(dest, pages);
+        return 
+# 1514 "src/mem.c" 3 4
+              0
+# 1514 "src/mem.c"
+                   ;
+    }
+
+    memcpy(_get_addr_from_page(dest), _get_addr_from_page(page), pages * 4096);
+
+    struct page *pNew = _page(dest);
+    *pNew = *pOld;
+    pNew->index = dest;
+
+    struct page_mover *pMover = (struct page_mover*)pOld->pOwner;
+
+    if (!pMover->migrate(pMover, _get_addr_from_page(page), _get_addr_from_page(dest))) {
+        pNew->pages_allocated = 0;
+        pNew->flags = 0;
+        _release_pages(dest, pages);
+        _buddy_free_range(dest, pages);
+        return 
+# 1530 "src/mem.c" 3 4
+              0
+# 1530 "src/mem.c"
+                   ;
+    }
+
+
+    pOld->pOwner = 
+# 1534 "src/mem.c" 3 4
+                  ((void *)0)
+# 1534 "src/mem.c"
+                      ;
+    pOld->pages_allocated = 0;
+    pOld->refcount = 0;
+    pOld->flags = 0;
+
+    num_pages_available -= pages;
+    compact_pages_migrated += pages;
+
+    return 
+# 1542 "src/mem.c" 3 4
+          1
+# 1542 "src/mem.c"
+              ;
+}
+
+
+
+
+
+static 
+# 1549 "src/mem.c" 3 4
+      _Bool 
+# 1549 "src/mem.c"
+           _compact_zone(uint32_t node, uint32_t zone, uint8_t order)
+{
+    uint64_t block = (uint64_t)1 << order;
+    uint64_t best = 0;
+    uint64_t best_cost = 0xffffffffffffffffUL;
+
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->node != node || pRange->zone != zone) {
+            continue;
+        }
+
+
+        uint64_t end = ((pRange->end_page) < (_initialised_pages()) ? (pRange->end_page) : (_initialised_pages()));
+
+        for (uint64_t first = (((pRange->start_page) + (block) - 1) / (block)) * (block); first + block <= end; first += block) {
+            uint64_t cost = _compact_cost(first, block);
+
+            if (cost < best_cost) {
+                best = first;
+                best_cost = cost;
+            }
+        }
+    }
+
+
+    struct MemZone *pZone = &mem_nodes[node].zones[zone];
+    if (best_cost == 0xffffffffffffffffUL || best_cost == 0 || pZone->free_pages < block) {
+        return 
+# 1578 "src/mem.c" 3 4
+              0
+# 1578 "src/mem.c"
+                   ;
+    }
+
+    compact_runs++;
+
+
+    uint64_t last = best + block;
+    uint64_t page = sbitmap_find_clear(&page_bitmap, best);
+
+    while (page < last) {
+        uint64_t end = bitmap_find_set(page_bitmap.bits, page, last);
+
+        _buddy_take_range(page, end - page);
+        _reserve_pages(page, end - page);
+        num_pages_available -= end - page;
+
+        page = sbitmap_find_clear(&page_bitmap, end);
+    }
+
+    
+# 1597 "src/mem.c" 3 4
+   _Bool 
+# 1597 "src/mem.c"
+        moved_all = 
+# 1597 "src/mem.c" 3 4
+                    1
+# 1597 "src/mem.c"
+                        ;
+
+    for (page = best; page < last; page++) {
+        uint64_t pages = _page_allocated(page);
+
+        if (pages > 0) {
+            if (!_compact_migrate(node, zone, page)) {
+                moved_all = 
+# 1604 "src/mem.c" 3 4
+                           0
+# 1604 "src/mem.c"
+                                ;
+            }
+
+            page += pages - 1;
+        }
+    }
+
+
+    page = best;
+
+    while (page < last) {
+        if (_page_allocated(page) > 0) {
+            page += _page_allocated(page);
+            continue;
+        }
+
+        uint64_t end = page + 1;
+        while (end < last && _page_allocated(end) == 0) {
+            end++;
+        }
+
+        _release_pages(page, end - page);
+        _buddy_free_range(page, end - page);
+        num_pages_available += end - page;
+
+        page = end;
+    }
+
+    if (moved_all) {
+        compact_successes++;
+    }
+
+    return moved_all;
+}
+
+
+
+
+
+static 
+# 1643 "src/mem.c" 3 4
+      _Bool 
+# 1643 "src/mem.c"
+           _compact(uint32_t node, uint32_t max_zone, uint64_t pages, uint8_t align_order)
+{
+    uint8_t order = ((_pages_to_order(pages)) > (align_order) ? (_pages_to_order(pages)) : (align_order));
+
+    if (order > 18) {
+        return 
+# 1648 "src/mem.c" 3 4
+              0
+# 1648 "src/mem.c"
+                   ;
+    }
+
+    for (uint32_t i = 0; i < mem_node_count; i++) {
+        for (int32_t zone = max_zone; zone >= 0; zone--) {
+            if (_compact_zone(mem_nodes[node].fallback[i], zone, order)) {
+                return 
+# 1654 "src/mem.c" 3 4
+                      1
+# 1654 "src/mem.c"
+                          ;
+            }
+        }
+    }
+
+    return 
+# 1659 "src/mem.c" 3 4
+          0
+# 1659 "src/mem.c"
+               ;
+}
+# 1673 "src/mem.c"
+void* kalloc(size_t numBytes)
+{
+    return kalloc_node(cpu_node(), numBytes);
+}
+
+
+
+
+
+static void* _kalloc_pages(uint32_t node, uint64_t pages_to_alloc, uint8_t align_order, uint32_t flags)
+{
+    uint64_t start_alloc_page = 0;
+    uint32_t max_zone = (flags & 0x1) ? 0 : 1;
+
+    if (node >= mem_node_count) {
+        node = 0;
+    }
+
+    page_magazines[cpu_index()].allocs++;
+
+
+
+    if (pages_to_alloc == 1 && node == cpu_node() && max_zone == 1) {
+        void *pPage = _pcp_alloc();
+        if (pPage != 
+# 1697 "src/mem.c" 3 4
+                    ((void *)0)
+# 1697 "src/mem.c"
+                        ) {
+            return pPage;
+        }
+    }
+
+    spinlock_lock(&lock);
+
+    if (!_take_pages_nearest(node, max_zone, pages_to_alloc, align_order, &start_alloc_page)) {
+        spinlock_unlock(&lock);
+
+
+        kmem_zero_pool_drain();
+        kmem_color_drain();
+        kmem_pcp_drain();
+        spinlock_lock(&lock);
+
+
+        if (!_take_pages_nearest(node, max_zone, pages_to_alloc, align_order, &start_alloc_page) &&
+            (!_compact(node, max_zone, pages_to_alloc, align_order) ||
+             !_take_pages_nearest(node, max_zone, pages_to_alloc, align_order, &start_alloc_page))) {
+            spinlock_unlock(&lock);
+            __sync_fetch_and_add(&alloc_failures, 1);
+            kprintf("PMM Allocation failed.\n");
+            return 
+# 1720 "src/mem.c" 3 4
+                  ((void *)0)
+# 1720 "src/mem.c"
+                      ;
+        }
+    }
+
+
+    _reserve_pages(start_alloc_page, pages_to_alloc);
+
+    if (!_page_desc_ensure(start_alloc_page, pages_to_alloc)) {
+        _release_pages(start_alloc_page, pages_to_alloc);
+        _buddy_free_range(start_alloc_page, pages_to_alloc);
+        spinlock_unlock(&lock);
+        __sync_fetch_and_add(&alloc_failures, 1);
+        kprintf("PMM Allocation failed, no memory for page descriptors.\n");
+        return 
+# 1733 "src/mem.c" 3 4
+              ((void *)0)
+# 1733 "src/mem.c"
+                  ;
+    }
+
+    _page_init_alloc(start_alloc_page, pages_to_alloc);
+
+    num_pages_available -= pages_to_alloc;
+    spinlock_unlock(&lock);
+
+    return _get_addr_from_page(start_alloc_page);
+}
+
+
+
+
+
+void* kalloc_node(uint32_t node, size_t numBytes)
+{
+    return _kalloc_pages(node, (((((numBytes) + (4096) - 1) / (4096))) > (1) ? ((((numBytes) + (4096) - 1) / (4096))) : (1)), 0, 0);
+}
+
+
+
+
+static inline uint32_t _page_color(uint64_t page)
+{
+    return page & (page_colors - 1);
+}
+
+
+
+
+
+static 
+# 1765 "src/mem.c" 3 4
+      _Bool 
+# 1765 "src/mem.c"
+           _take_pages_colored(uint32_t node, uint32_t zone, uint64_t pages, uint32_t color, uint64_t *pPage)
+{
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->node != node || pRange->zone != zone) {
+            continue;
+        }
+
+        uint64_t page = (((pRange->start_page) / (page_colors)) * (page_colors)) + color;
+        if (page < pRange->start_page) {
+            page += page_colors;
+        }
+
+
+        while (page + pages <= pRange->end_page) {
+            uint64_t run = sbitmap_find_clear_run(&page_bitmap, page, pages);
+
+            if (run == page) {
+                _buddy_take_range(page, pages);
+                *pPage = page;
+                return 
+# 1786 "src/mem.c" 3 4
+                      1
+# 1786 "src/mem.c"
+                          ;
+            }
+
+            if (run + pages > pRange->end_page) {
+                break;
+            }
+
+            page = (((run) / (page_colors)) * (page_colors)) + color;
+            if (page < run) {
+                page += page_colors;
+            }
+        }
+    }
+
+    return 
+# 1800 "src/mem.c" 3 4
+          0
+# 1800 "src/mem.c"
+               ;
+}
+
+
+
+
+
+static 
+# 1807 "src/mem.c" 3 4
+      _Bool 
+# 1807 "src/mem.c"
+           _color_refill(uint32_t node)
+{
+    uint64_t block = 0;
+    uint8_t order = _pages_to_order(page_colors);
+
+    if (!_take_pages_nearest(node, 1, page_colors, order, &block)) {
+        return 
+# 1813 "src/mem.c" 3 4
+              0
+# 1813 "src/mem.c"
+                   ;
+    }
+
+    _reserve_pages(block, page_colors);
+
+
+    if (!_page_desc_ensure(block, page_colors)) {
+        _release_pages(block, page_colors);
+        _buddy_free_range(block, page_colors);
+        return 
+# 1822 "src/mem.c" 3 4
+              0
+# 1822 "src/mem.c"
+                   ;
+    }
+
+    for (uint64_t page = block; page < block + page_colors; page++) {
+        uint32_t color = _page_color(page);
+
+        if (color_counts[color] < 8) {
+            color_lists[color][color_counts[color]++] = page;
+            color_list_pages++;
+            num_pages_available--;
+        } else {
+            _release_pages(page, 1);
+            _buddy_free_block(_page_range(page), page, 0);
+        }
+    }
+
+    return 
+# 1838 "src/mem.c" 3 4
+          1
+# 1838 "src/mem.c"
+              ;
+}
+
+
+
+
+
+static void* _kalloc_colored(uint32_t node, uint64_t pages, uint32_t color)
+{
+    uint64_t page = 0;
+    
+# 1848 "src/mem.c" 3 4
+   _Bool 
+# 1848 "src/mem.c"
+        found = 
+# 1848 "src/mem.c" 3 4
+                0
+# 1848 "src/mem.c"
+                     ;
+
+    if (node >= mem_node_count) {
+        node = 0;
+    }
+
+    spinlock_lock(&lock);
+
+    if (pages == 1) {
+        if (color_counts[color] == 0) {
+            _color_refill(node);
+        }
+
+        if (color_counts[color] > 0) {
+            page = color_lists[color][--color_counts[color]];
+            color_list_pages--;
+            _page_init_alloc(page, 1);
+            found = 
+# 1865 "src/mem.c" 3 4
+                   1
+# 1865 "src/mem.c"
+                       ;
+        }
+    } else {
+        for (uint32_t i = 0; i < mem_node_count * 2 && !found; i++) {
+            uint32_t zone = 2 - 1 - (i % 2);
+            found = _take_pages_colored(mem_nodes[node].fallback[i / 2], zone, pages, color, &page);
+        }
+
+        if (found) {
+            _reserve_pages(page, pages);
+
+            if (_page_desc_ensure(page, pages)) {
+                _page_init_alloc(page, pages);
+                num_pages_available -= pages;
+            } else {
+                _release_pages(page, pages);
+                _buddy_free_range(page, pages);
+                found = 
+# 1882 "src/mem.c" 3 4
+                       0
+# 1882 "src/mem.c"
+                            ;
+            }
+        }
+    }
+
+    spinlock_unlock(&lock);
+
+    if (!found) {
+        return 
+# 1890 "src/mem.c" 3 4
+              ((void *)0)
+# 1890 "src/mem.c"
+                  ;
+    }
+
+
+    page_magazines[cpu_index()].allocs++;
+    return _get_addr_from_page(page);
+}
+
+
+
+
+void kmem_color_drain()
+{
+    spinlock_lock(&lock);
+
+    for (uint32_t color = 0; color < page_colors; color++) {
+        while (color_counts[color] > 0) {
+            uint64_t page = color_lists[color][--color_counts[color]];
+            _release_pages(page, 1);
+            _buddy_free_block(_page_range(page), page, 0);
+            num_pages_available++;
+        }
+    }
+
+    color_list_pages = 0;
+
+    spinlock_unlock(&lock);
+}
+
+
+
+
+uint32_t kmem_page_colors()
+{
+    return page_colors;
+}
+
+
+
+
+uint32_t kmem_page_color(void *ptr)
+{
+    return _page_color(_get_page_from_addr(ptr));
+}
+
+
+
+
+
+static void _init_colors()
+{
+    struct cpu_cache cache;
+    struct cpu_cache chosen = {0};
+
+    for (uint32_t i = 0; get_cpu_cache(i, &cache); i++) {
+
+        if (cache.type != 2 && chosen.level != 2 && cache.level > chosen.level) {
+            chosen = cache;
+        }
+    }
+
+    if (chosen.level == 0) {
+        kprintf("PMM: No cache geometry, page coloring is off.\n");
+        return;
+    }
+
+    uint64_t colors = (uint64_t)chosen.line_size * chosen.partitions * chosen.sets / 4096;
+
+    while (page_colors * 2 <= ((colors) < (128) ? (colors) : (128))) {
+        page_colors *= 2;
+    }
+
+    color_cache_level = chosen.level;
+    color_cache_ways = chosen.ways;
+    color_cache_size = chosen.size;
+
+    kprintf("PMM: L%d cache %lu KiB, %d ways, %d page colors.\n",
+        chosen.level, chosen.size / 1024, chosen.ways, page_colors);
+}
+
+
+
+
+
+static uint64_t _color_bench_pass(uint8_t **ppPages, uint32_t count)
+{
+    uint64_t start = rdtsc();
+
+    for (uint32_t round = 0; round < 2000; round++) {
+        for (uint32_t i = 0; i < count; i++) {
+            for (uint32_t line = 0; line < 4096; line += 64) {
+                (void)*(volatile uint64_t*)(ppPages[i] + line);
+            }
+        }
+    }
+
+    uint64_t reads = (uint64_t)2000 * count * (4096 / 64);
+    return (rdtsc() - start) * 100 / reads;
+}
+
+
+
+
+
+
+void kmem_color_benchmark()
+{
+    static uint8_t *same[128];
+    static uint8_t *spread[128];
+
+    if (page_colors <= 1) {
+        kprintf("Page coloring is off, there's nothing to compare.\n");
+        return;
+    }
+
+    uint32_t count = ((color_cache_ways * 2) < (128) ? (color_cache_ways * 2) : (128));
+    uint32_t got = 0;
+
+    while (got < count) {
+        same[got] = _kalloc_colored(cpu_node(), 1, 0);
+        spread[got] = kalloc_zone(4096, 0x4);
+
+        if (same[got] == 
+# 2012 "src/mem.c" 3 4
+                        ((void *)0) 
+# 2012 "src/mem.c"
+                             || spread[got] == 
+# 2012 "src/mem.c" 3 4
+                                               ((void *)0)
+# 2012 "src/mem.c"
+                                                   ) {
+            if (same[got] != 
+# 2013 "src/mem.c" 3 4
+                            ((void *)0)
+# 2013 "src/mem.c"
+                                ) {
+                kfree(same[got]);
+            }
+
+            if (spread[got] != 
+# 2017 "src/mem.c" 3 4
+                              ((void *)0)
+# 2017 "src/mem.c"
+                                  ) {
+                kfree(spread[got]);
+            }
+
+            break;
+        }
+
+        memset(same[got], 1, 4096);
+        memset(spread[got], 1, 4096);
+        got++;
+    }
+
+    if (got == count) {
+        kprintf("Page color benchmark, %d pages, L%d %lu KiB, %d ways, %d colors (cycles/read):\n",
+            count, color_cache_level, color_cache_size / 1024, color_cache_ways, page_colors);
+
+        uint64_t same_rate = _color_bench_pass(same, count);
+        uint64_t spread_rate = _color_bench_pass(spread, count);
+
+        kprintf("Colors:");
+        _print_rate("same", same_rate);
+        _print_rate("spread", spread_rate);
+        kprintf("\n");
+    } else {
+        kprintf("Page color benchmark couldn't allocate its pages.\n");
+    }
+
+    for (uint32_t i = 0; i < got; i++) {
+        kfree(same[i]);
+        kfree(spread[i]);
+    }
+}
+
+
+
+
+
+static 
+# 2054 "src/mem.c" 3 4
+      _Bool 
+# 2054 "src/mem.c"
+           _zero_pool_migrate(struct page_mover *pMover, void *pOld, void *pNew)
+{
+    (void)pMover;
+    
+# 2057 "src/mem.c" 3 4
+   _Bool 
+# 2057 "src/mem.c"
+        found = 
+# 2057 "src/mem.c" 3 4
+                0
+# 2057 "src/mem.c"
+                     ;
+
+    spinlock_lock(&zero_pool_lock);
+
+    for (uint32_t i = 0; i < zero_pool_count; i++) {
+        if (zero_pool[i] == pOld) {
+            zero_pool[i] = pNew;
+            found = 
+# 2064 "src/mem.c" 3 4
+                   1
+# 2064 "src/mem.c"
+                       ;
+            break;
+        }
+    }
+
+    spinlock_unlock(&zero_pool_lock);
+
+    return found;
+}
+
+static struct page_mover zero_pool_mover = { _zero_pool_migrate };
+
+
+
+
+static void* _zero_pool_take()
+{
+    void *pPage = 
+# 2081 "src/mem.c" 3 4
+                 ((void *)0)
+# 2081 "src/mem.c"
+                     ;
+
+
+
+    spinlock_lock(&lock);
+    spinlock_lock(&zero_pool_lock);
+
+    if (zero_pool_count > 0) {
+        pPage = zero_pool[--zero_pool_count];
+
+
+        kmem_page(pPage)->flags &= ~0x20;
+    }
+
+    spinlock_unlock(&zero_pool_lock);
+    spinlock_unlock(&lock);
+
+    return pPage;
+}
+# 2108 "src/mem.c"
+void* kalloc_zone(size_t numBytes, uint32_t flags)
+{
+    uint64_t pages = (((((numBytes) + (4096) - 1) / (4096))) > (1) ? ((((numBytes) + (4096) - 1) / (4096))) : (1));
+
+
+    if ((flags & 0x2) && pages == 1 && !(flags & 0x1)) {
+        void *pPage = _zero_pool_take();
+        if (pPage != 
+# 2115 "src/mem.c" 3 4
+                    ((void *)0)
+# 2115 "src/mem.c"
+                        ) {
+            __sync_fetch_and_add(&zero_pool_hits, 1);
+            return pPage;
+        }
+    }
+
+    void *pData = 
+# 2121 "src/mem.c" 3 4
+                 ((void *)0)
+# 2121 "src/mem.c"
+                     ;
+
+    if ((flags & 0x4) && page_colors > 1 && !(flags & 0x1)) {
+        pData = _kalloc_colored(cpu_node(), pages, __sync_fetch_and_add(&next_color, 1) & (page_colors - 1));
+    }
+
+    if (pData == 
+# 2127 "src/mem.c" 3 4
+                ((void *)0)
+# 2127 "src/mem.c"
+                    ) {
+        pData = _kalloc_pages(cpu_node(), pages, 0, flags);
+    }
+
+    if (pData != 
+# 2131 "src/mem.c" 3 4
+                ((void *)0) 
+# 2131 "src/mem.c"
+                     && (flags & 0x2)) {
+        __sync_fetch_and_add(&zero_pool_misses, 1);
+        _zero_pages_nt(pData, pages);
+    }
+
+    return pData;
+}
+
+
+
+
+
+
+
+void* kalloc_huge(size_t numBytes, uint8_t order)
+{
+    if (order > 18) {
+        kprintf("PMM: Huge page order %d is larger than the maximum of %d.\n", order, 18);
+        return 
+# 2149 "src/mem.c" 3 4
+              ((void *)0)
+# 2149 "src/mem.c"
+                  ;
+    }
+
+    uint64_t align = (uint64_t)1 << order;
+    uint64_t pages = (((((numBytes) + (4096) - 1) / (4096))) > (1) ? ((((numBytes) + (4096) - 1) / (4096))) : (1));
+
+    return _kalloc_pages(cpu_node(), (((pages) + (align) - 1) / (align)) * (align), order, 0);
+}
+
+
+
+
+void* kpalloc(size_t numPages) {
+    return kalloc(4096 * numPages);
+}
+
+
+
+
+void* kpalloc_node(uint32_t node, size_t numPages) {
+    return kalloc_node(node, 4096 * numPages);
+}
+
+
+
+
+
+uint64_t kmem_zone_free_pages(uint32_t zone)
+{
+    uint64_t pages = 0;
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        pages += mem_nodes[node].zones[zone].free_pages;
+    }
+
+    return pages;
+}
+
+
+
+
+
+static void _numa_build_ranges()
+{
+    struct MemRange ranges[64];
+    uint32_t count = 0;
+
+    for (int i = 0; i < 64 && srat_mem_list[i] != 
+# 2196 "src/mem.c" 3 4
+                                                                ((void *)0)
+# 2196 "src/mem.c"
+                                                                    ; i++) {
+        struct srat_mem_affinity *pMem = srat_mem_list[i];
+
+
+        uint64_t start_page = _phys_to_page(pMem->base);
+        uint64_t end_page = _phys_to_page((((pMem->base + pMem->range_length) + (4096) - 1) / (4096)) * (4096));
+
+        if (start_page >= end_page) {
+            continue;
+        }
+
+
+        uint32_t pos = count++;
+        while (pos > 0 && ranges[pos - 1].start_page > start_page) {
+            ranges[pos] = ranges[pos - 1];
+            pos--;
+        }
+
+        ranges[pos].start_page = start_page;
+        ranges[pos].end_page = end_page;
+        ranges[pos].node = acpi_numa_node(pMem->proximity_domain);
+    }
+
+
+
+    uint64_t page = 0;
+    num_mem_ranges = 0;
+
+    for (uint32_t i = 0; i < count && num_mem_ranges < 32 - 3; i++) {
+        if (ranges[i].end_page <= page) {
+            continue;
+        }
+
+        if (ranges[i].start_page > page) {
+            mem_ranges[num_mem_ranges].start_page = page;
+            mem_ranges[num_mem_ranges].end_page = ranges[i].start_page;
+            mem_ranges[num_mem_ranges].node = 0;
+            num_mem_ranges++;
+            page = ranges[i].start_page;
+        }
+
+        mem_ranges[num_mem_ranges].start_page = page;
+        mem_ranges[num_mem_ranges].end_page = ranges[i].end_page;
+        mem_ranges[num_mem_ranges].node = ranges[i].node;
+        num_mem_ranges++;
+        page = ranges[i].end_page;
+    }
+
+    if (page < num_pages_in_map) {
+        mem_ranges[num_mem_ranges].start_page = page;
+        mem_ranges[num_mem_ranges].end_page = num_pages_in_map;
+        mem_ranges[num_mem_ranges].node = 0;
+        num_mem_ranges++;
+    }
+
+    _split_zone_ranges();
+}
+
+
+
+
+
+static void _numa_redistribute()
+{
+    struct FreeBlock *lists[2][18 + 1];
+
+
+
+    for (uint32_t zone = 0; zone < 2; zone++) {
+        struct MemZone *pZone = &mem_nodes[0].zones[zone];
+
+        for (uint8_t order = 0; order <= 18; order++) {
+            lists[zone][order] = pZone->free_lists[order];
+            pZone->free_lists[order] = 
+# 2269 "src/mem.c" 3 4
+                                      ((void *)0)
+# 2269 "src/mem.c"
+                                          ;
+            pZone->free_counts[order] = 0;
+
+            for (struct FreeBlock *pBlock = lists[zone][order]; pBlock != 
+# 2272 "src/mem.c" 3 4
+                                                                         ((void *)0)
+# 2272 "src/mem.c"
+                                                                             ; pBlock = pBlock->pNext) {
+                bitmap_off(free_heads, _get_page_from_addr(pBlock));
+            }
+        }
+
+        pZone->free_pages = 0;
+    }
+
+    for (uint32_t zone = 0; zone < 2; zone++) {
+        for (uint8_t order = 0; order <= 18; order++) {
+            struct FreeBlock *pBlock = lists[zone][order];
+
+            while (pBlock != 
+# 2284 "src/mem.c" 3 4
+                            ((void *)0)
+# 2284 "src/mem.c"
+                                ) {
+                struct FreeBlock *pNext = pBlock->pNext;
+                _buddy_free_range(_get_page_from_addr(pBlock), (uint64_t)1 << order);
+                pBlock = pNext;
+            }
+        }
+    }
+}
+
+
+
+
+
+void kmem_numa_init()
+{
+    cpu_locals[cpu_index()].node = acpi_numa_node_of_apic(cpu_locals[cpu_index()].lapic_id);
+
+    if (numa_node_count <= 1) {
+        kprintf("PMM: Single NUMA node.\n");
+        return;
+    }
+
+    spinlock_lock(&lock);
+
+    _numa_build_ranges();
+
+
+    for (uint32_t node = 0; node < numa_node_count; node++) {
+        uint32_t *fallback = mem_nodes[node].fallback;
+
+        for (uint32_t i = 0; i < numa_node_count; i++) {
+            uint32_t pos = i;
+
+            while (pos > 0 && acpi_numa_distance(node, fallback[pos - 1]) > acpi_numa_distance(node, i)) {
+                fallback[pos] = fallback[pos - 1];
+                pos--;
+            }
+
+            fallback[pos] = i;
+        }
+    }
+
+    mem_node_count = numa_node_count;
+    _numa_redistribute();
+
+    spinlock_unlock(&lock);
+
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        kprintf("PMM: Pages %lu - %lu in node %d.\n", mem_ranges[i].start_page, mem_ranges[i].end_page, mem_ranges[i].node);
+    }
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        struct MemZone *pZones = mem_nodes[node].zones;
+        kprintf("PMM: Node %d has %lu free pages.\n", node, pZones[0].free_pages + pZones[1].free_pages);
+    }
+}
+
+
+
+
+void kmem_init()
+{
+    kprintf("Initialzing PMM...\n");
+
+    uint64_t start_cycles = rdtsc();
+
+    _init_stats();
+
+    kprintf("Total Memory: %lu Mib\n", total_memory_bytes / 1024 / 1024);
+    kprintf("Total Map Pages: %lu\n", num_pages_in_map);
+    kprintf("Total Pages Available: %lu\n", max_pages_available);
+    kprintf("Lowest Memory Addr: 0x%X\n", lowest_address);
+
+    _create_page_bitmap();
+    _create_page_map();
+    _init_colors();
+
+    _get_free_pages();
+
+    boot_init_cycles = rdtsc() - start_cycles;
+
+    kprintf("PMM initialized, %lu pages deferred.\n", num_pages_in_map - deferred_start_page);
+}
+
+
+
+
+
+
+void kfree(void *ptr)
+{
+    if (ptr == 
+# 2375 "src/mem.c" 3 4
+              ((void *)0)
+# 2375 "src/mem.c"
+                  ) {
+        return;
+    }
+
+    uint64_t page_index = _get_page_from_addr(ptr);
+
+    if (page_index >= num_pages_in_map) {
+        kprintf("*FATAL*: Page index lookup resulted in out of bounds value of %lu from address 0x%X.\n", page_index, ptr);
+        hcf();
+    }
+
+    struct page *pPage = _page_find(page_index);
+    uint64_t pages = pPage != 
+# 2387 "src/mem.c" 3 4
+                             ((void *)0) 
+# 2387 "src/mem.c"
+                                  ? pPage->pages_allocated : 0;
+
+    if (pages == 0) {
+        kprintf("PMM: Free of unallocated address 0x%X ignored.\n", ptr);
+        return;
+    }
+
+
+    if (__sync_sub_and_fetch(&pPage->refcount, 1) > 0) {
+        return;
+    }
+
+    page_magazines[cpu_index()].frees++;
+
+    pPage->flags = 0;
+    pPage->pOwner = 
+# 2402 "src/mem.c" 3 4
+                   ((void *)0)
+# 2402 "src/mem.c"
+                       ;
+
+
+    if (pages == 1 && (mem_node_count == 1 || _page_range(page_index)->node == cpu_node())) {
+        _pcp_free(page_index);
+        return;
+    }
+
+    spinlock_lock(&lock);
+
+
+    _release_pages(page_index, pages);
+    _buddy_free_range(page_index, pages);
+
+
+    pPage->pages_allocated = 0;
+    num_pages_available += pages;
+
+    spinlock_unlock(&lock);
+}
+
+
+
+
+
+
+void kmem_zero_pool_fill()
+{
+    for (uint32_t i = 0; i < 16; i++) {
+        if (zero_pool_count >= 512 || num_pages_available < 4096) {
+            return;
+        }
+
+        void *pPage = kalloc(4096);
+        if (pPage == 
+# 2436 "src/mem.c" 3 4
+                    ((void *)0)
+# 2436 "src/mem.c"
+                        ) {
+            return;
+        }
+
+        _zero_pages_nt(pPage, 1);
+        kmem_set_movable(pPage, &zero_pool_mover);
+
+        spinlock_lock(&zero_pool_lock);
+
+        if (zero_pool_count < 512) {
+            zero_pool[zero_pool_count++] = pPage;
+            pPage = 
+# 2447 "src/mem.c" 3 4
+                   ((void *)0)
+# 2447 "src/mem.c"
+                       ;
+        }
+
+        spinlock_unlock(&zero_pool_lock);
+
+
+        if (pPage != 
+# 2453 "src/mem.c" 3 4
+                    ((void *)0)
+# 2453 "src/mem.c"
+                        ) {
+            spinlock_lock(&lock);
+            kmem_page(pPage)->flags &= ~0x20;
+            spinlock_unlock(&lock);
+            kfree(pPage);
+            return;
+        }
+    }
+}
+
+
+
+
+void kmem_zero_pool_drain()
+{
+    void *pPage;
+
+    while ((pPage = _zero_pool_take()) != 
+# 2470 "src/mem.c" 3 4
+                                         ((void *)0)
+# 2470 "src/mem.c"
+                                             ) {
+        kfree(pPage);
+    }
+}
+
+
+
+
+uint32_t kmem_zero_pool_count()
+{
+    return zero_pool_count;
+}
+
+
+
+
+
+
+static uint64_t _scan_free_runs(uint64_t first, uint64_t last, struct kmem_stats *pStats)
+{
+    uint64_t free = 0;
+    uint64_t page = sbitmap_find_clear(&page_bitmap, first);
+
+    while (page < last) {
+        uint64_t end = bitmap_find_set(page_bitmap.bits, page, last);
+        uint64_t run = end - page;
+
+        if (pStats != 
+# 2497 "src/mem.c" 3 4
+                     ((void *)0)
+# 2497 "src/mem.c"
+                         ) {
+            pStats->free_runs[63 - __builtin_clzll(run)]++;
+            pStats->largest_free_run = ((pStats->largest_free_run) > (run) ? (pStats->largest_free_run) : (run));
+        }
+
+        free += run;
+        page = sbitmap_find_clear(&page_bitmap, end);
+    }
+
+    return free;
+}
+
+
+
+
+void kmem_get_stats(struct kmem_stats *pStats)
+{
+    memset(pStats, 0, sizeof(struct kmem_stats));
+
+    pStats->total_pages = max_pages_available;
+    pStats->zero_pool_pages = zero_pool_count;
+    pStats->color_pages = color_list_pages;
+    pStats->zero_pool_hits = zero_pool_hits;
+    pStats->zero_pool_misses = zero_pool_misses;
+    pStats->alloc_failures = alloc_failures;
+    pStats->compact_runs = compact_runs;
+    pStats->compact_successes = compact_successes;
+    pStats->compact_pages_migrated = compact_pages_migrated;
+    pStats->desc_chunks = num_desc_chunks;
+    pStats->desc_pages = num_desc_pages;
+
+    for (uint32_t cpu = 0; cpu < 64; cpu++) {
+        pStats->pcp_pages += page_magazines[cpu].count;
+        pStats->allocs += page_magazines[cpu].allocs;
+        pStats->frees += page_magazines[cpu].frees;
+    }
+
+    spinlock_lock(&lock);
+
+    pStats->free_pages = num_pages_available;
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        for (uint32_t zone = 0; zone < 2; zone++) {
+            struct MemZone *pZone = &mem_nodes[node].zones[zone];
+
+            pStats->zone_free_pages[zone] += pZone->free_pages;
+
+            for (uint8_t order = 0; order <= 18; order++) {
+                pStats->free_blocks[order] += pZone->free_counts[order];
+            }
+        }
+    }
+
+    _scan_free_runs(0, num_pages_in_map, pStats);
+
+    spinlock_unlock(&lock);
+}
+
+
+
+
+static uint64_t _region_free_pages(struct limine_memmap_entry *entry)
+{
+    uint64_t first = _phys_to_page(entry->base);
+    uint64_t last = _phys_to_page(entry->base + entry->length);
+
+    spinlock_lock(&lock);
+    uint64_t free = _scan_free_runs(first, last, 
+# 2564 "src/mem.c" 3 4
+                                                ((void *)0)
+# 2564 "src/mem.c"
+                                                    );
+    spinlock_unlock(&lock);
+
+    return free;
+}
+
+
+
+
+
+void kmem_report()
+{
+    struct kmem_stats stats;
+    kmem_get_stats(&stats);
+
+    kprintf("PMM: %lu of %lu pages free, %lu in per-CPU magazines, %lu in the zero pool.\n",
+        stats.free_pages, stats.total_pages, stats.pcp_pages, stats.zero_pool_pages);
+    kprintf("PMM: Zone DMA32 %lu free, NORMAL %lu free.\n",
+        stats.zone_free_pages[0], stats.zone_free_pages[1]);
+    kprintf("PMM: %lu allocs, %lu frees, %lu failed.\n", stats.allocs, stats.frees, stats.alloc_failures);
+    kprintf("PMM: Largest free run %lu pages.\n", stats.largest_free_run);
+    kprintf("PMM: %lu compactions, %lu succeeded, %lu pages migrated.\n",
+        stats.compact_runs, stats.compact_successes, stats.compact_pages_migrated);
+    kprintf("PMM: %d page colors, %lu pages in the color lists.\n", page_colors, stats.color_pages);
+    kprintf("PMM: Page descriptors use %lu pages for %lu of %lu chunks.\n",
+        stats.desc_pages, stats.desc_chunks, num_page_chunks);
+
+    kprintf("Free runs:");
+    for (int i = 0; i < 64; i++) {
+        if (stats.free_runs[i] > 0) {
+            kprintf(" %lu+:%lu", (uint64_t)1 << i, stats.free_runs[i]);
+        }
+    }
+    kprintf("\n");
+
+    kprintf("Free blocks:");
+    for (int order = 0; order <= 18; order++) {
+        if (stats.free_blocks[order] > 0) {
+            kprintf(" o%d:%lu", order, stats.free_blocks[order]);
+        }
+    }
+    kprintf("\n");
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type == 0) {
+            uint64_t pages = entry->length / 4096;
+            uint64_t free = _region_free_pages(entry);
+            kprintf("Region 0x%X: %lu pages, %lu used, %lu free.\n", entry->base, pages, pages - free, free);
+        }
+    }
+}
+
+
+
+
+
+void kmem_report_serial()
+{
+    struct kmem_stats stats;
+    kmem_get_stats(&stats);
+
+    write_serial_strf((uint16_t)0x3F8, "PMM_STATS_BEGIN\n");
+    write_serial_strf((uint16_t)0x3F8, "tsc=%lu\n", rdtsc());
+    write_serial_strf((uint16_t)0x3F8, "total_pages=%lu\n", stats.total_pages);
+    write_serial_strf((uint16_t)0x3F8, "free_pages=%lu\n", stats.free_pages);
+    write_serial_strf((uint16_t)0x3F8, "pcp_pages=%lu\n", stats.pcp_pages);
+    write_serial_strf((uint16_t)0x3F8, "zero_pool_pages=%lu\n", stats.zero_pool_pages);
+    write_serial_strf((uint16_t)0x3F8, "zero_pool_hits=%lu\n", stats.zero_pool_hits);
+    write_serial_strf((uint16_t)0x3F8, "zero_pool_misses=%lu\n", stats.zero_pool_misses);
+    write_serial_strf((uint16_t)0x3F8, "zone_dma32_free=%lu\n", stats.zone_free_pages[0]);
+    write_serial_strf((uint16_t)0x3F8, "zone_normal_free=%lu\n", stats.zone_free_pages[1]);
+    write_serial_strf((uint16_t)0x3F8, "allocs=%lu\n", stats.allocs);
+    write_serial_strf((uint16_t)0x3F8, "frees=%lu\n", stats.frees);
+    write_serial_strf((uint16_t)0x3F8, "alloc_failures=%lu\n", stats.alloc_failures);
+    write_serial_strf((uint16_t)0x3F8, "largest_free_run=%lu\n", stats.largest_free_run);
+    write_serial_strf((uint16_t)0x3F8, "compact_runs=%lu\n", stats.compact_runs);
+    write_serial_strf((uint16_t)0x3F8, "compact_successes=%lu\n", stats.compact_successes);
+    write_serial_strf((uint16_t)0x3F8, "compact_pages_migrated=%lu\n", stats.compact_pages_migrated);
+    write_serial_strf((uint16_t)0x3F8, "color_pages=%lu\n", stats.color_pages);
+    write_serial_strf((uint16_t)0x3F8, "desc_pages=%lu\n", stats.desc_pages);
+    write_serial_strf((uint16_t)0x3F8, "desc_chunks=%lu\n", stats.desc_chunks);
+
+    for (int i = 0; i < 64; i++) {
+        write_serial_strf((uint16_t)0x3F8, "free_runs.%d=%lu\n", i, stats.free_runs[i]);
+    }
+
+    for (int order = 0; order <= 18; order++) {
+        write_serial_strf((uint16_t)0x3F8, "free_blocks.%d=%lu\n", order, stats.free_blocks[order]);
+    }
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type == 0) {
+            write_serial_strf((uint16_t)0x3F8, "region.%d=0x%x,%lu,%lu\n",
+                (int)i, entry->base, entry->length / 4096, _region_free_pages(entry));
+        }
+    }
+
+    write_serial_strf((uint16_t)0x3F8, "PMM_STATS_END\n");
+}
+# 2675 "src/mem.c"
+void kmem_set_movable(void *ptr, struct page_mover *pMover)
+{
+    struct page *pPage = kmem_page(ptr);
+
+    spinlock_lock(&lock);
+    pPage->pOwner = pMover;
+    pPage->flags |= 0x20;
+    spinlock_unlock(&lock);
+}
+
+
+
+
+
+
+void kmem_compact_background()
+{
+    uint64_t now = rdtsc();
+
+    if (now - compact_last_tsc < (1ULL << 31)) {
+        return;
+    }
+
+    compact_last_tsc = now;
+
+    spinlock_lock(&lock);
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        for (uint32_t zone = 0; zone < 2; zone++) {
+            struct MemZone *pZone = &mem_nodes[node].zones[zone];
+            
+# 2705 "src/mem.c" 3 4
+           _Bool 
+# 2705 "src/mem.c"
+                has_block = 
+# 2705 "src/mem.c" 3 4
+                            0
+# 2705 "src/mem.c"
+                                 ;
+
+            for (uint8_t order = 9; order <= 18; order++) {
+                if (pZone->free_counts[order] > 0) {
+                    has_block = 
+# 2709 "src/mem.c" 3 4
+                               1
+# 2709 "src/mem.c"
+                                   ;
+                    break;
+                }
+            }
+
+            if (!has_block && pZone->free_pages >= ((uint64_t)2 << 9)) {
+                _compact_zone(node, zone, 9);
+            }
+        }
+    }
+
+    spinlock_unlock(&lock);
+}
+
+
+
+
+
+struct page* kmem_page(void *ptr)
+{
+    uint64_t page_index = _get_page_from_addr(ptr);
+
+    if (page_index >= num_pages_in_map) {
+        return 
+# 2732 "src/mem.c" 3 4
+              ((void *)0)
+# 2732 "src/mem.c"
+                  ;
+    }
+
+    return _page_find(page_index);
+}
+
+
+
+
+void* kmem_page_addr(struct page *pPage)
+{
+    return _get_addr_from_page(pPage->index);
+}
+
+
+
+
+
+void page_get(struct page *pPage)
+{
+    __sync_fetch_and_add(&pPage->refcount, 1);
+}
+
+
+
+
+void page_put(struct page *pPage)
+{
+    kfree(kmem_page_addr(pPage));
+}
+
+
+
+
+
+void page_list_add(struct page_list *pList, struct page *pPage)
+{
+    uint32_t index = pPage->index;
+
+    pPage->lru_next = 0xFFFFFFFF;
+    pPage->lru_prev = pList->tail;
+
+    if (pList->tail != 0xFFFFFFFF) {
+        _page(pList->tail)->lru_next = index;
+    } else {
+        pList->head = index;
+    }
+
+    pList->tail = index;
+    pList->count++;
+}
+
+
+
+
+void page_list_remove(struct page_list *pList, struct page *pPage)
+{
+    if (pPage->lru_prev != 0xFFFFFFFF) {
+        _page(pPage->lru_prev)->lru_next = pPage->lru_next;
+    } else {
+        pList->head = pPage->lru_next;
+    }
+
+    if (pPage->lru_next != 0xFFFFFFFF) {
+        _page(pPage->lru_next)->lru_prev = pPage->lru_prev;
+    } else {
+        pList->tail = pPage->lru_prev;
+    }
+
+    pPage->lru_next = 0xFFFFFFFF;
+    pPage->lru_prev = 0xFFFFFFFF;
+    pList->count--;
+}
+
+
+
+
+struct page* page_list_pop(struct page_list *pList)
+{
+    if (pList->head == 0xFFFFFFFF) {
+        return 
+# 2812 "src/mem.c" 3 4
+              ((void *)0)
+# 2812 "src/mem.c"
+                  ;
+    }
+
+    struct page *pPage = _page(pList->head);
+    page_list_remove(pList, pPage);
+
+    return pPage;
+}
+
+
+void memdumps(void *location, uint64_t len_bytes)
+{
+    char * chLocation = (char*)location;
+    for (uint64_t i = 0; i < len_bytes; i++) {
+        kprintf("%c", *chLocation++);
+    }
+
+    kprintf("\n");
+}
+
+void memdumpx32(void *location, uint64_t len_bytes)
+{
+    uint32_t *data = (uint32_t*)location;
+    for (uint64_t i = 0; i < (len_bytes / 4); i++) {
+        kprintf("0x%X ", *data++);
+    }
+
+    kprintf("\n");
+}
+
+void memdumpx64(void *location, uint64_t len_bytes)
+{
+    uint64_t *data = (uint64_t*)location;
+    for (uint64_t i = 0; i < (len_bytes / 8); i++) {
+        kprintf("0x%X ", *data++);
+    }
+
+    kprintf("\n");
+}
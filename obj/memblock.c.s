@@ -0,0 +1,4683 @@
+	.file	"memblock.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/memblock.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"*FATAL*: Memblock ran out of regions.\n"
+	.text
+	.p2align 4
+	.type	_region_add, @function
+_region_add:
+.LVL0:
+.LFB4:
+	.file 1 "src/memblock.c"
+	.loc 1 64 1 view -0
+	.cfi_startproc
+	.loc 1 65 5 view .LVU1
+	.loc 1 64 1 is_stmt 0 view .LVU2
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 68 32 view .LVU3
+	leaq	regions(%rip), %r9
+	.loc 1 64 1 view .LVU4
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 65 14 view .LVU5
+	leaq	(%rdi,%rsi), %rbp
+.LVL1:
+	.loc 1 66 5 is_stmt 1 view .LVU6
+	.loc 1 68 5 view .LVU7
+	.loc 1 68 32 view .LVU8
+	.loc 1 64 1 is_stmt 0 view .LVU9
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 68 18 view .LVU10
+	movl	num_regions(%rip), %r11d
+	.loc 1 68 32 view .LVU11
+	testl	%r11d, %r11d
+	je	.L19
+	movq	%r9, %rax
+	.loc 1 66 14 view .LVU12
+	xorl	%r10d, %r10d
+	jmp	.L3
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.loc 1 69 9 is_stmt 1 view .LVU13
+	.loc 1 69 14 is_stmt 0 view .LVU14
+	addl	$1, %r10d
+.LVL3:
+	.loc 1 68 32 is_stmt 1 view .LVU15
+	addq	$16, %rax
+	cmpl	%r11d, %r10d
+	je	.L4
+.LVL4:
+.L3:
+	.loc 1 68 55 is_stmt 0 discriminator 1 view .LVU16
+	movq	8(%rax), %rcx
+	addq	(%rax), %rcx
+	.loc 1 68 32 discriminator 1 view .LVU17
+	cmpq	%rbx, %rcx
+	jb	.L5
+	.loc 1 73 32 is_stmt 1 view .LVU18
+	cmpl	%r11d, %r10d
+	jnb	.L4
+	.loc 1 73 32 is_stmt 0 view .LVU19
+	movl	%r10d, %r13d
+	leal	1(%r10), %r14d
+	leal	-1(%r11), %r8d
+	xorl	%ecx, %ecx
+	.loc 1 73 49 view .LVU20
+	movq	%r13, %r12
+	movq	%r14, %r15
+	salq	$4, %r14
+	salq	$4, %r12
+	addq	%r9, %r14
+	addq	%r9, %r12
+	.loc 1 73 49 view .LVU21
+	movq	(%r12), %rax
+	.loc 1 73 32 view .LVU22
+	cmpq	%rax, %rbp
+	jb	.L39
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 74 9 is_stmt 1 view .LVU23
+	.loc 1 74 14 is_stmt 0 view .LVU24
+	cmpq	%rax, %rbx
+.LBB8:
+.LBB9:
+.LBB10:
+	.loc 1 53 36 view .LVU25
+	movq	%r14, %rcx
+.LBE10:
+.LBE9:
+.LBE8:
+	.loc 1 74 14 view .LVU26
+	cmova	%rax, %rbx
+.LVL6:
+	.loc 1 75 9 is_stmt 1 view .LVU27
+	.loc 1 75 45 is_stmt 0 view .LVU28
+	addq	8(%r12), %rax
+	.loc 1 75 13 view .LVU29
+	cmpq	%rax, %rbp
+	cmovb	%rax, %rbp
+.LVL7:
+	.loc 1 76 9 is_stmt 1 view .LVU30
+.LBB14:
+.LBI8:
+	.loc 1 51 13 view .LVU31
+.LBB12:
+	.loc 1 53 5 view .LVU32
+.LBB11:
+	.loc 1 53 10 view .LVU33
+	.loc 1 53 36 view .LVU34
+	movl	%r10d, %eax
+	cmpl	%r11d, %r15d
+	jnb	.L10
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 54 9 view .LVU35
+	.loc 1 54 20 is_stmt 0 view .LVU36
+	movq	(%rcx), %rsi
+	movq	8(%rcx), %rdi
+	movl	%eax, %edx
+	.loc 1 53 36 view .LVU37
+	addl	$1, %eax
+.LVL9:
+	.loc 1 54 20 view .LVU38
+	salq	$4, %rdx
+	.loc 1 53 36 view .LVU39
+	addq	$16, %rcx
+	.loc 1 54 20 view .LVU40
+	movq	%rsi, (%r9,%rdx)
+	movq	%rdi, 8(%r9,%rdx)
+	.loc 1 53 52 is_stmt 1 view .LVU41
+.LVL10:
+	.loc 1 53 36 view .LVU42
+	cmpl	%r8d, %eax
+	jne	.L7
+.L10:
+.LBE11:
+	.loc 1 57 5 view .LVU43
+	.loc 1 57 16 is_stmt 0 view .LVU44
+	leal	-1(%r11), %edx
+.LVL11:
+	.loc 1 57 16 view .LVU45
+.LBE12:
+.LBE14:
+	.loc 1 73 32 is_stmt 1 view .LVU46
+	subl	$1, %r8d
+	movl	$1, %ecx
+	cmpl	%r10d, %edx
+	je	.L40
+	.loc 1 73 49 is_stmt 0 view .LVU47
+	movq	(%r12), %rax
+.LBB15:
+.LBB13:
+	.loc 1 57 16 view .LVU48
+	movl	%edx, %r11d
+	.loc 1 57 16 view .LVU49
+.LBE13:
+.LBE15:
+	.loc 1 73 32 view .LVU50
+	cmpq	%rax, %rbp
+	jnb	.L12
+.L39:
+	.loc 1 73 32 view .LVU51
+	testb	%cl, %cl
+	je	.L13
+	movl	%edx, num_regions(%rip)
+.L13:
+	.loc 1 79 5 is_stmt 1 view .LVU52
+	.loc 1 79 8 is_stmt 0 view .LVU53
+	cmpl	$128, %r11d
+	je	.L14
+.LVL12:
+.LBB16:
+	.loc 1 84 38 is_stmt 1 view .LVU54
+.LBE16:
+	.loc 1 89 31 is_stmt 0 view .LVU55
+	movq	%rbp, %rsi
+	subq	%rbx, %rsi
+.LBB17:
+	.loc 1 84 38 view .LVU56
+	cmpl	%r11d, %r10d
+	jnb	.L2
+	.loc 1 84 38 view .LVU57
+	movl	%r11d, %eax
+	movl	%r11d, %edi
+	subl	%r10d, %eax
+	movq	%rdi, %r8
+	leal	-1(%r11), %r10d
+.LVL13:
+	.loc 1 84 38 view .LVU58
+	salq	$4, %r8
+	subl	$1, %eax
+	salq	$4, %r10
+	subq	%rax, %rdi
+	leaq	-16+regions(%rip), %rax
+	leaq	(%r9,%r8), %rcx
+	salq	$4, %rdi
+	addq	%rax, %rdi
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.loc 1 85 9 is_stmt 1 discriminator 3 view .LVU59
+	.loc 1 85 20 is_stmt 0 discriminator 3 view .LVU60
+	movq	%rcx, %rax
+	.loc 1 84 38 discriminator 3 view .LVU61
+	subq	$16, %rcx
+	.loc 1 85 20 discriminator 3 view .LVU62
+	subq	%r8, %rax
+	movq	8(%rax,%r10), %rdx
+	movq	(%rax,%r10), %rax
+	movq	%rdx, 24(%rcx)
+	.loc 1 84 48 is_stmt 1 discriminator 3 view .LVU63
+	.loc 1 84 38 discriminator 3 view .LVU64
+	.loc 1 85 20 is_stmt 0 discriminator 3 view .LVU65
+	movq	%rax, 16(%rcx)
+	.loc 1 84 38 discriminator 3 view .LVU66
+	cmpq	%rdi, %rcx
+	jne	.L18
+.LVL15:
+.L2:
+	.loc 1 84 38 discriminator 3 view .LVU67
+.LBE17:
+	.loc 1 88 5 is_stmt 1 view .LVU68
+	.loc 1 88 25 is_stmt 0 view .LVU69
+	salq	$4, %r13
+	.loc 1 90 16 view .LVU70
+	addl	$1, %r11d
+	.loc 1 88 25 view .LVU71
+	leaq	(%r9,%r13), %rax
+	.loc 1 90 16 view .LVU72
+	movl	%r11d, num_regions(%rip)
+	.loc 1 88 25 view .LVU73
+	movq	%rbx, (%rax)
+	.loc 1 89 5 is_stmt 1 view .LVU74
+	.loc 1 89 25 is_stmt 0 view .LVU75
+	movq	%rsi, 8(%rax)
+	.loc 1 90 5 is_stmt 1 view .LVU76
+	.loc 1 91 1 is_stmt 0 view .LVU77
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL16:
+.L40:
+	.cfi_restore_state
+	.loc 1 79 5 is_stmt 1 view .LVU78
+.LBB18:
+	.loc 1 84 38 view .LVU79
+.LBE18:
+	.loc 1 89 31 is_stmt 0 view .LVU80
+	movq	%rbp, %rsi
+	movl	%r10d, %r11d
+	subq	%rbx, %rsi
+	jmp	.L2
+.LVL17:
+.L19:
+	.loc 1 89 31 view .LVU81
+	xorl	%r13d, %r13d
+	jmp	.L2
+.LVL18:
+.L4:
+	.loc 1 79 5 is_stmt 1 view .LVU82
+	movl	%r10d, %r13d
+	.loc 1 79 8 is_stmt 0 view .LVU83
+	cmpl	$128, %r11d
+	jne	.L2
+.LVL19:
+.L14:
+	.loc 1 80 9 is_stmt 1 view .LVU84
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL20:
+	.loc 1 81 9 view .LVU85
+.LBB19:
+.LBI19:
+	.file 2 "src/kernel.h"
+	.loc 2 27 20 view .LVU86
+.LBB20:
+	.loc 2 29 5 view .LVU87
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.L17:
+	.loc 2 30 5 view .LVU88
+	.loc 2 31 9 view .LVU89
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 2 30 5 view .LVU90
+#NO_APP
+	jmp	.L17
+.LBE20:
+.LBE19:
+	.cfi_endproc
+.LFE4:
+	.size	_region_add, .-_region_add
+	.section	.rodata.str1.8
+	.align 8
+.LC1:
+	.string	"Memblock: Allocation of %lu bytes after the PMM took over.\n"
+	.text
+	.p2align 4
+	.globl	memblock_alloc_range
+	.type	memblock_alloc_range, @function
+memblock_alloc_range:
+.LVL21:
+.LFB6:
+	.loc 1 113 1 view -0
+	.cfi_startproc
+	.loc 1 114 5 view .LVU92
+	.loc 1 113 1 is_stmt 0 view .LVU93
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 114 8 view .LVU94
+	cmpb	$0, sealed(%rip)
+	jne	.L66
+	.loc 1 119 5 is_stmt 1 view .LVU95
+	.loc 1 119 11 is_stmt 0 view .LVU96
+	movl	$8, %eax
+.LBB27:
+	.loc 1 123 27 view .LVU97
+	movq	memmap(%rip), %r14
+.LBE27:
+	.loc 1 119 11 view .LVU98
+	cmpq	%rax, %rsi
+	cmovnb	%rsi, %rax
+	.loc 1 120 38 view .LVU99
+	testq	%rdi, %rdi
+.LBB47:
+	.loc 1 123 17 view .LVU100
+	movq	8(%r14), %rsi
+.LVL22:
+	.loc 1 123 17 view .LVU101
+.LBE47:
+	.loc 1 119 11 view .LVU102
+	movq	%rax, %r10
+.LVL23:
+	.loc 1 120 5 is_stmt 1 view .LVU103
+	.loc 1 120 38 is_stmt 0 view .LVU104
+	movl	$1, %eax
+.LVL24:
+	.loc 1 120 38 view .LVU105
+	cmovne	%rdi, %rax
+	movq	%rax, %r9
+	.loc 1 120 52 view .LVU106
+	addq	$7, %r9
+	.loc 1 120 10 view .LVU107
+	andq	$-8, %r9
+.LVL25:
+	.loc 1 123 5 is_stmt 1 view .LVU108
+.LBB48:
+	.loc 1 123 10 view .LVU109
+	.loc 1 123 44 view .LVU110
+	testq	%rsi, %rsi
+	je	.L43
+.LBB28:
+.LBB29:
+.LBB30:
+.LBB31:
+	.loc 1 98 28 is_stmt 0 view .LVU111
+	movl	num_regions(%rip), %r8d
+	leaq	regions(%rip), %rbp
+	movq	%rdx, %r12
+	movq	%rcx, %r13
+	subq	$1, %rsi
+.LVL26:
+	.loc 1 98 28 view .LVU112
+	movq	%r8, %r15
+	salq	$4, %r8
+	addq	%rbp, %r8
+	movl	%r15d, %ebx
+	jmp	.L54
+.LVL27:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.loc 1 98 28 view .LVU113
+.LBE31:
+.LBE30:
+.LBE29:
+.LBE28:
+	.loc 1 123 50 is_stmt 1 discriminator 2 view .LVU114
+	.loc 1 123 44 discriminator 2 view .LVU115
+	subq	$1, %rsi
+.LVL28:
+	.loc 1 123 44 is_stmt 0 discriminator 2 view .LVU116
+	jb	.L43
+.LVL29:
+.L54:
+.LBB44:
+	.loc 1 124 9 is_stmt 1 view .LVU117
+	.loc 1 124 51 is_stmt 0 view .LVU118
+	movq	16(%r14), %rax
+	.loc 1 124 37 view .LVU119
+	movq	(%rax,%rsi,8), %rdx
+.LVL30:
+	.loc 1 126 9 is_stmt 1 view .LVU120
+	.loc 1 126 12 is_stmt 0 view .LVU121
+	cmpq	$0, 16(%rdx)
+	jne	.L44
+	.loc 1 130 9 is_stmt 1 view .LVU122
+	.loc 1 130 34 is_stmt 0 view .LVU123
+	movq	(%rdx), %rax
+	.loc 1 130 18 view .LVU124
+	movq	%r12, %rdi
+	cmpq	%r12, %rax
+	cmovnb	%rax, %rdi
+.LVL31:
+	.loc 1 131 9 is_stmt 1 view .LVU125
+	.loc 1 131 38 is_stmt 0 view .LVU126
+	addq	8(%rdx), %rax
+	.loc 1 131 18 view .LVU127
+	cmpq	%r13, %rax
+	cmova	%r13, %rax
+.LVL32:
+	.loc 1 133 9 is_stmt 1 view .LVU128
+	.loc 1 133 20 view .LVU129
+	.loc 1 133 30 is_stmt 0 view .LVU130
+	leaq	(%r9,%rdi), %r11
+	.loc 1 133 20 view .LVU131
+	cmpq	%r11, %rax
+	jb	.L44
+.LBB40:
+	.loc 1 134 13 is_stmt 1 view .LVU132
+	.loc 1 134 37 is_stmt 0 view .LVU133
+	subq	%r9, %rax
+	.loc 1 134 22 view .LVU134
+	xorl	%edx, %edx
+.LVL33:
+	.loc 1 134 37 view .LVU135
+	movq	%rax, %rcx
+	.loc 1 134 22 view .LVU136
+	divq	%r10
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+.LVL34:
+	.loc 1 135 13 is_stmt 1 view .LVU137
+	.loc 1 135 16 is_stmt 0 view .LVU138
+	cmpq	%rdi, %rax
+	jb	.L44
+	.loc 1 140 13 is_stmt 1 view .LVU139
+	.loc 1 140 46 is_stmt 0 view .LVU140
+	leaq	(%r9,%rax), %r15
+.LVL35:
+.LBB36:
+.LBI30:
+	.loc 1 96 31 is_stmt 1 view .LVU141
+	.loc 1 98 5 view .LVU142
+.LBB32:
+	.loc 1 98 10 view .LVU143
+	.loc 1 98 42 view .LVU144
+	testl	%ebx, %ebx
+	je	.L47
+	movq	%r14, 8(%rsp)
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.loc 1 98 42 is_stmt 0 view .LVU145
+.LBE32:
+.LBE36:
+.LBE40:
+.LBE44:
+.LBE48:
+	.loc 1 113 1 view .LVU146
+	movq	%rbp, %rdx
+	jmp	.L48
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+.LBB49:
+.LBB45:
+.LBB41:
+.LBB37:
+.LBB33:
+	.loc 1 99 9 is_stmt 1 view .LVU147
+	.loc 1 99 29 is_stmt 0 view .LVU148
+	movq	8(%rdx), %r14
+	addq	%rcx, %r14
+	.loc 1 99 12 view .LVU149
+	cmpq	%r14, %rax
+	jb	.L67
+	.loc 1 98 69 is_stmt 1 view .LVU150
+.LVL37:
+	.loc 1 98 42 view .LVU151
+	addq	$16, %rdx
+.LVL38:
+	.loc 1 98 42 is_stmt 0 view .LVU152
+	cmpq	%r8, %rdx
+	je	.L47
+.LVL39:
+.L48:
+	.loc 1 98 55 view .LVU153
+	movq	(%rdx), %rcx
+	.loc 1 98 42 view .LVU154
+	cmpq	%r15, %rcx
+	jb	.L51
+.LVL40:
+.L47:
+	.loc 1 98 42 view .LVU155
+.LBE33:
+.LBE37:
+	.loc 1 141 13 is_stmt 1 view .LVU156
+	.loc 1 142 17 view .LVU157
+	movq	%rax, %rdi
+.LVL41:
+	.loc 1 142 17 is_stmt 0 view .LVU158
+	movq	%r9, %rsi
+.LVL42:
+	.loc 1 142 17 view .LVU159
+	movq	%rax, 8(%rsp)
+	call	_region_add
+.LVL43:
+	.loc 1 143 17 is_stmt 1 view .LVU160
+	.loc 1 143 38 is_stmt 0 view .LVU161
+	movq	8(%rsp), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LBE41:
+.LBE45:
+.LBE49:
+	.loc 1 151 1 view .LVU162
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL44:
+	.loc 1 151 1 view .LVU163
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+.LVL45:
+	.loc 1 151 1 view .LVU164
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.cfi_restore_state
+.LBB50:
+.LBB46:
+.LBB42:
+.LBB38:
+.LBB34:
+	.loc 1 100 13 is_stmt 1 view .LVU165
+	.loc 1 100 13 is_stmt 0 view .LVU166
+.LBE34:
+.LBE38:
+	.loc 1 141 13 is_stmt 1 view .LVU167
+	.loc 1 146 13 view .LVU168
+	.loc 1 146 13 is_stmt 0 view .LVU169
+.LBE42:
+	.loc 1 133 20 is_stmt 1 view .LVU170
+	cmpq	%r11, %rcx
+	jb	.L62
+.LBB43:
+	.loc 1 134 13 view .LVU171
+	.loc 1 134 37 is_stmt 0 view .LVU172
+	subq	%r9, %rcx
+.LVL47:
+	.loc 1 134 22 view .LVU173
+	xorl	%edx, %edx
+.LVL48:
+	.loc 1 134 22 view .LVU174
+	movq	%rcx, %rax
+.LVL49:
+	.loc 1 134 22 view .LVU175
+	divq	%r10
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+.LVL50:
+	.loc 1 135 13 is_stmt 1 view .LVU176
+	.loc 1 135 16 is_stmt 0 view .LVU177
+	cmpq	%rdi, %rax
+	jb	.L62
+	.loc 1 140 13 is_stmt 1 view .LVU178
+	.loc 1 140 46 is_stmt 0 view .LVU179
+	leaq	(%r9,%rax), %r15
+.LVL51:
+.LBB39:
+	.loc 1 96 31 is_stmt 1 view .LVU180
+	.loc 1 98 5 view .LVU181
+.LBB35:
+	.loc 1 98 10 view .LVU182
+	.loc 1 98 42 view .LVU183
+	jmp	.L46
+.LVL52:
+.L62:
+	.loc 1 98 42 is_stmt 0 view .LVU184
+	movq	8(%rsp), %r14
+.LBE35:
+.LBE39:
+.LBE43:
+.LBE46:
+	.loc 1 123 50 is_stmt 1 view .LVU185
+.LVL53:
+	.loc 1 123 44 view .LVU186
+	subq	$1, %rsi
+.LVL54:
+	.loc 1 123 44 is_stmt 0 view .LVU187
+	jnb	.L54
+.LVL55:
+.L43:
+	.loc 1 123 44 view .LVU188
+.LBE50:
+	.loc 1 116 15 view .LVU189
+	xorl	%eax, %eax
+.LVL56:
+.L68:
+	.loc 1 151 1 view .LVU190
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL57:
+.L66:
+	.cfi_restore_state
+	.loc 1 115 9 is_stmt 1 view .LVU191
+	movq	%rdi, %rsi
+.LVL58:
+	.loc 1 115 9 is_stmt 0 view .LVU192
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+.LVL59:
+	.loc 1 115 9 view .LVU193
+	call	kprintf@PLT
+.LVL60:
+	.loc 1 116 9 is_stmt 1 view .LVU194
+	.loc 1 116 15 is_stmt 0 view .LVU195
+	xorl	%eax, %eax
+	jmp	.L68
+	.cfi_endproc
+.LFE6:
+	.size	memblock_alloc_range, .-memblock_alloc_range
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"Couldn't allocate memory!"
+	.text
+	.p2align 4
+	.globl	memblock_alloc
+	.type	memblock_alloc, @function
+memblock_alloc:
+.LVL61:
+.LFB7:
+	.loc 1 158 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 159 5 view .LVU197
+	.loc 1 158 1 is_stmt 0 view .LVU198
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 159 19 view .LVU199
+	xorl	%edx, %edx
+	movq	$-1, %rcx
+	call	memblock_alloc_range
+.LVL62:
+	.loc 1 161 5 is_stmt 1 view .LVU200
+	.loc 1 161 8 is_stmt 0 view .LVU201
+	testq	%rax, %rax
+	je	.L73
+	.loc 1 167 1 view .LVU202
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.L73:
+	.cfi_restore_state
+	.loc 1 162 9 is_stmt 1 view .LVU203
+	leaq	.LC2(%rip), %rdi
+	call	kprintf@PLT
+.LVL63:
+	.loc 1 163 9 view .LVU204
+.LBB53:
+.LBI53:
+	.loc 2 27 20 view .LVU205
+.LBB54:
+	.loc 2 29 5 view .LVU206
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+	.p2align 4,,10
+	.p2align 3
+#NO_APP
+.L71:
+	.loc 2 30 5 view .LVU207
+	.loc 2 31 9 view .LVU208
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 2 30 5 view .LVU209
+#NO_APP
+	jmp	.L71
+.LBE54:
+.LBE53:
+	.cfi_endproc
+.LFE7:
+	.size	memblock_alloc, .-memblock_alloc
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"Memblock: Free of 0x%X after the PMM took over ignored.\n"
+	.text
+	.p2align 4
+	.globl	memblock_free
+	.type	memblock_free, @function
+memblock_free:
+.LVL64:
+.LFB8:
+	.loc 1 174 1 view -0
+	.cfi_startproc
+	.loc 1 175 5 view .LVU211
+	.loc 1 174 1 is_stmt 0 view .LVU212
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 175 8 view .LVU213
+	cmpb	$0, sealed(%rip)
+	jne	.L95
+	.loc 1 180 5 is_stmt 1 view .LVU214
+	.loc 1 180 14 is_stmt 0 view .LVU215
+	subq	vmm_higher_half_offset(%rip), %rbp
+.LVL65:
+	.loc 1 181 5 is_stmt 1 view .LVU216
+	.loc 1 181 53 is_stmt 0 view .LVU217
+	movl	$1, %eax
+	testq	%rsi, %rsi
+	.loc 1 184 14 view .LVU218
+	movl	num_regions(%rip), %edi
+.LVL66:
+	.loc 1 181 53 view .LVU219
+	cmovne	%rsi, %rax
+	leaq	regions(%rip), %r12
+	.loc 1 182 14 view .LVU220
+	xorl	%edx, %edx
+	.loc 1 181 53 view .LVU221
+	movq	%rax, %r13
+	.loc 1 181 67 view .LVU222
+	addq	$7, %r13
+	.loc 1 181 79 view .LVU223
+	andq	$-8, %r13
+	.loc 1 181 14 view .LVU224
+	addq	%rbp, %r13
+.LVL67:
+	.loc 1 182 5 is_stmt 1 view .LVU225
+	.loc 1 184 5 view .LVU226
+	.loc 1 184 14 view .LVU227
+	testl	%edi, %edi
+	jne	.L76
+	jmp	.L74
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L97:
+.LBB59:
+	.loc 1 195 13 view .LVU228
+	.loc 1 195 34 is_stmt 0 view .LVU229
+	movq	%rbp, %rdx
+	subq	%rcx, %rdx
+	movq	%rdx, 8(%rax)
+	.loc 1 197 13 is_stmt 1 view .LVU230
+	.loc 1 197 16 is_stmt 0 view .LVU231
+	cmpq	%rsi, %r13
+	jb	.L96
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	.loc 1 205 13 is_stmt 1 view .LVU232
+	.loc 1 205 13 is_stmt 0 view .LVU233
+.LBE59:
+	.loc 1 184 14 view .LVU234
+	movl	num_regions(%rip), %edi
+.LVL70:
+.LBB63:
+	.loc 1 205 14 view .LVU235
+	movl	%ebx, %edx
+.LVL71:
+.L80:
+	.loc 1 205 14 view .LVU236
+.LBE63:
+	.loc 1 184 14 is_stmt 1 view .LVU237
+	cmpl	%edi, %edx
+	jnb	.L74
+.LVL72:
+.L76:
+.LBB64:
+	.loc 1 185 9 view .LVU238
+	.loc 1 186 9 view .LVU239
+	.loc 1 186 38 is_stmt 0 view .LVU240
+	movl	%edx, %eax
+	.loc 1 189 14 view .LVU241
+	leal	1(%rdx), %ebx
+	.loc 1 186 38 view .LVU242
+	salq	$4, %rax
+	addq	%r12, %rax
+	movq	(%rax), %rcx
+	.loc 1 186 18 view .LVU243
+	movq	8(%rax), %rsi
+	addq	%rcx, %rsi
+.LVL73:
+	.loc 1 188 9 is_stmt 1 view .LVU244
+	.loc 1 188 32 is_stmt 0 view .LVU245
+	cmpq	%r13, %rcx
+	jnb	.L94
+	cmpq	%rsi, %rbp
+	jnb	.L94
+	.loc 1 193 9 is_stmt 1 view .LVU246
+	.loc 1 193 12 is_stmt 0 view .LVU247
+	cmpq	%rbp, %rcx
+	jb	.L97
+	.loc 1 202 16 is_stmt 1 view .LVU248
+	.loc 1 202 19 is_stmt 0 view .LVU249
+	cmpq	%rsi, %r13
+	jnb	.L98
+	.loc 1 203 13 is_stmt 1 view .LVU250
+	.loc 1 204 40 is_stmt 0 view .LVU251
+	subq	%r13, %rsi
+.LVL74:
+	.loc 1 203 27 view .LVU252
+	movq	%r13, (%rax)
+	.loc 1 204 13 is_stmt 1 view .LVU253
+	.loc 1 204 40 is_stmt 0 view .LVU254
+	movq	%rsi, 8(%rax)
+.LVL75:
+	.loc 1 204 40 view .LVU255
+	jmp	.L94
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.loc 1 204 40 view .LVU256
+.LBE64:
+	.loc 1 210 1 view .LVU257
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL77:
+	.loc 1 210 1 view .LVU258
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+.LVL78:
+	.loc 1 210 1 view .LVU259
+	ret
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.cfi_restore_state
+.LBB65:
+	.loc 1 198 17 is_stmt 1 view .LVU260
+	subq	%r13, %rsi
+.LVL80:
+	.loc 1 198 17 is_stmt 0 view .LVU261
+	movq	%r13, %rdi
+	call	_region_add
+.LVL81:
+	.loc 1 201 13 is_stmt 1 view .LVU262
+	.loc 1 201 13 is_stmt 0 view .LVU263
+	jmp	.L94
+.LVL82:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+.LBB60:
+.LBB61:
+.LBB62:
+	.loc 1 53 36 is_stmt 1 view .LVU264
+	cmpl	%edi, %ebx
+	jnb	.L99
+	salq	$4, %rbx
+	subl	$1, %edi
+	movl	%edx, %esi
+.LVL83:
+	.loc 1 53 36 is_stmt 0 view .LVU265
+	leaq	(%r12,%rbx), %rax
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.loc 1 54 9 is_stmt 1 view .LVU266
+	.loc 1 54 20 is_stmt 0 view .LVU267
+	movq	(%rax), %rcx
+	movq	8(%rax), %rbx
+	movl	%esi, %r8d
+	.loc 1 53 36 view .LVU268
+	addl	$1, %esi
+.LVL85:
+	.loc 1 54 20 view .LVU269
+	salq	$4, %r8
+	.loc 1 53 36 view .LVU270
+	addq	$16, %rax
+	.loc 1 54 20 view .LVU271
+	movq	%rcx, (%r12,%r8)
+	movq	%rbx, 8(%r12,%r8)
+	.loc 1 53 52 is_stmt 1 view .LVU272
+.LVL86:
+	.loc 1 53 36 view .LVU273
+	cmpl	%esi, %edi
+	jne	.L85
+.L86:
+.LBE62:
+	.loc 1 57 5 view .LVU274
+	.loc 1 57 16 is_stmt 0 view .LVU275
+	movl	%edi, num_regions(%rip)
+	.loc 1 58 1 view .LVU276
+	jmp	.L80
+.LVL87:
+	.p2align 4,,10
+	.p2align 3
+.L95:
+	.loc 1 58 1 view .LVU277
+.LBE61:
+.LBE60:
+.LBE65:
+	.loc 1 176 9 is_stmt 1 view .LVU278
+	.loc 1 210 1 is_stmt 0 view .LVU279
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 176 9 view .LVU280
+	movq	%rdi, %rsi
+.LVL88:
+	.loc 1 176 9 view .LVU281
+	leaq	.LC3(%rip), %rdi
+.LVL89:
+	.loc 1 176 9 view .LVU282
+	xorl	%eax, %eax
+	.loc 1 210 1 view .LVU283
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL90:
+	.loc 1 210 1 view .LVU284
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	.loc 1 176 9 view .LVU285
+	jmp	kprintf@PLT
+.LVL91:
+.L99:
+	.cfi_restore_state
+	.loc 1 176 9 view .LVU286
+	subl	$1, %edi
+	jmp	.L86
+	.cfi_endproc
+.LFE8:
+	.size	memblock_free, .-memblock_free
+	.p2align 4
+	.globl	memblock_find_free
+	.type	memblock_find_free, @function
+memblock_find_free:
+.LVL92:
+.LFB9:
+	.loc 1 217 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 218 5 view .LVU288
+.LBB66:
+	.loc 1 218 10 view .LVU289
+	.loc 1 218 42 view .LVU290
+	.loc 1 218 28 is_stmt 0 view .LVU291
+	movl	num_regions(%rip), %r11d
+.LBE66:
+	.loc 1 217 1 view .LVU292
+	movq	%rsi, %r10
+.LBB71:
+	.loc 1 218 42 view .LVU293
+	cmpq	%rsi, %rdi
+	jnb	.L120
+	testl	%r11d, %r11d
+	je	.L120
+.LBE71:
+	.loc 1 217 1 view .LVU294
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	leaq	regions(%rip), %rbx
+.LBB72:
+	.loc 1 218 19 view .LVU295
+	xorl	%esi, %esi
+.LVL93:
+	.loc 1 218 19 view .LVU296
+	movq	%rbx, %rax
+	jmp	.L104
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	.loc 1 218 42 discriminator 2 view .LVU297
+	cmpq	%r10, %rdi
+	jnb	.L101
+.LVL95:
+.L104:
+.LBB67:
+	.loc 1 219 9 is_stmt 1 view .LVU298
+	.loc 1 219 41 is_stmt 0 view .LVU299
+	movq	(%rax), %r8
+	.loc 1 219 18 view .LVU300
+	movq	8(%rax), %r9
+	addq	%r8, %r9
+.LVL96:
+	.loc 1 221 9 is_stmt 1 view .LVU301
+	.loc 1 221 12 is_stmt 0 view .LVU302
+	cmpq	%r9, %rdi
+	jnb	.L102
+	.loc 1 225 9 is_stmt 1 view .LVU303
+	.loc 1 225 12 is_stmt 0 view .LVU304
+	cmpq	%r8, %rdi
+	jb	.L126
+	movq	%r9, %rdi
+.LVL97:
+.L102:
+	.loc 1 225 12 view .LVU305
+.LBE67:
+	.loc 1 218 58 is_stmt 1 discriminator 2 view .LVU306
+	addl	$1, %esi
+.LVL98:
+	.loc 1 218 42 discriminator 2 view .LVU307
+	addq	$16, %rax
+	cmpl	%r11d, %esi
+	jb	.L127
+.L101:
+.LBE72:
+	.loc 1 234 5 view .LVU308
+	.loc 1 240 11 is_stmt 0 view .LVU309
+	xorl	%eax, %eax
+	.loc 1 234 8 view .LVU310
+	cmpq	%r10, %rdi
+	jb	.L128
+	.loc 1 241 1 view .LVU311
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	.cfi_restore_state
+	.loc 1 235 9 is_stmt 1 view .LVU312
+	.loc 1 235 17 is_stmt 0 view .LVU313
+	movq	%rdi, (%rdx)
+	.loc 1 236 9 is_stmt 1 view .LVU314
+	.loc 1 237 9 view .LVU315
+.LVL99:
+.L103:
+.LBB73:
+.LBB68:
+	.loc 1 228 19 is_stmt 0 view .LVU316
+	movl	$1, %eax
+.LBE68:
+.LBE73:
+	.loc 1 236 15 view .LVU317
+	movq	%r10, (%rcx)
+	.loc 1 241 1 view .LVU318
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	ret
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.cfi_restore_state
+.LBB74:
+.LBB69:
+	.loc 1 226 13 is_stmt 1 view .LVU319
+	.loc 1 227 33 is_stmt 0 view .LVU320
+	salq	$4, %rsi
+.LVL101:
+	.loc 1 226 21 view .LVU321
+	movq	%rdi, (%rdx)
+	.loc 1 227 13 is_stmt 1 view .LVU322
+	.loc 1 227 68 is_stmt 0 view .LVU323
+	movq	(%rbx,%rsi), %rax
+	cmpq	%rax, %r10
+	cmova	%rax, %r10
+.LVL102:
+	.loc 1 228 13 is_stmt 1 view .LVU324
+	.loc 1 228 19 is_stmt 0 view .LVU325
+	jmp	.L103
+.LVL103:
+.L120:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.loc 1 228 19 view .LVU326
+.LBE69:
+.LBE74:
+	.loc 1 234 5 is_stmt 1 view .LVU327
+	.loc 1 240 11 is_stmt 0 view .LVU328
+	xorl	%eax, %eax
+	.loc 1 234 8 view .LVU329
+	cmpq	%r10, %rdi
+	jb	.L129
+	.loc 1 241 1 view .LVU330
+	ret
+.L129:
+	.loc 1 235 9 is_stmt 1 view .LVU331
+	.loc 1 235 17 is_stmt 0 view .LVU332
+	movq	%rdi, (%rdx)
+	.loc 1 236 9 is_stmt 1 view .LVU333
+	.loc 1 237 9 view .LVU334
+.LBB75:
+.LBB70:
+	.loc 1 228 19 is_stmt 0 view .LVU335
+	movl	$1, %eax
+.LBE70:
+.LBE75:
+	.loc 1 236 15 view .LVU336
+	movq	%r10, (%rcx)
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	memblock_find_free, .-memblock_find_free
+	.p2align 4
+	.globl	memblock_reserved_pages
+	.type	memblock_reserved_pages, @function
+memblock_reserved_pages:
+.LFB10:
+	.loc 1 247 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 5 view .LVU338
+.LVL104:
+	.loc 1 249 5 view .LVU339
+	.loc 1 251 5 view .LVU340
+.LBB76:
+	.loc 1 251 10 view .LVU341
+	.loc 1 251 28 view .LVU342
+	movl	num_regions(%rip), %r9d
+	testl	%r9d, %r9d
+	je	.L134
+	leaq	regions(%rip), %rcx
+	salq	$4, %r9
+.LBE76:
+	.loc 1 249 14 is_stmt 0 view .LVU343
+	xorl	%esi, %esi
+	.loc 1 248 14 view .LVU344
+	xorl	%r8d, %r8d
+	addq	%rcx, %r9
+.LVL105:
+	.p2align 4,,10
+	.p2align 3
+.L133:
+.LBB78:
+.LBB77:
+	.loc 1 252 9 is_stmt 1 view .LVU345
+	.loc 1 252 38 is_stmt 0 view .LVU346
+	movq	(%rcx), %rax
+	.loc 1 252 44 view .LVU347
+	movq	%rax, %rdx
+	shrq	$12, %rdx
+	.loc 1 252 18 view .LVU348
+	cmpq	%rsi, %rdx
+	cmovb	%rsi, %rdx
+.LVL106:
+	.loc 1 253 9 is_stmt 1 view .LVU349
+	.loc 1 253 43 is_stmt 0 view .LVU350
+	addq	8(%rcx), %rax
+	.loc 1 253 71 view .LVU351
+	addq	$4095, %rax
+	.loc 1 253 18 view .LVU352
+	shrq	$12, %rax
+.LVL107:
+	.loc 1 255 9 is_stmt 1 view .LVU353
+	.loc 1 256 19 is_stmt 0 view .LVU354
+	movq	%rax, %rdi
+	subq	%rdx, %rdi
+	addq	%r8, %rdi
+	cmpq	%rax, %rdx
+	cmovb	%rdi, %r8
+.LVL108:
+	.loc 1 259 9 is_stmt 1 view .LVU355
+	.loc 1 259 19 is_stmt 0 view .LVU356
+	cmpq	%rax, %rsi
+	cmovb	%rax, %rsi
+.LVL109:
+	.loc 1 259 19 view .LVU357
+.LBE77:
+	.loc 1 251 44 is_stmt 1 view .LVU358
+	.loc 1 251 28 view .LVU359
+	addq	$16, %rcx
+.LVL110:
+	.loc 1 251 28 is_stmt 0 view .LVU360
+	cmpq	%rcx, %r9
+	jne	.L133
+.LBE78:
+	.loc 1 263 1 view .LVU361
+	movq	%r8, %rax
+.LVL111:
+	.loc 1 263 1 view .LVU362
+	ret
+.LVL112:
+	.p2align 4,,10
+	.p2align 3
+.L134:
+	.loc 1 248 14 view .LVU363
+	xorl	%r8d, %r8d
+	.loc 1 262 5 is_stmt 1 view .LVU364
+	.loc 1 263 1 is_stmt 0 view .LVU365
+	movq	%r8, %rax
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	memblock_reserved_pages, .-memblock_reserved_pages
+	.section	.rodata.str1.8
+	.align 8
+.LC4:
+	.string	"Memblock: %d regions reserving %lu pages handed over to the PMM.\n"
+	.text
+	.p2align 4
+	.globl	memblock_seal
+	.type	memblock_seal, @function
+memblock_seal:
+.LFB11:
+	.loc 1 269 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 270 5 view .LVU367
+	.loc 1 269 1 is_stmt 0 view .LVU368
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 272 5 view .LVU369
+	xorl	%eax, %eax
+	.loc 1 270 12 view .LVU370
+	movb	$1, sealed(%rip)
+	.loc 1 272 5 is_stmt 1 view .LVU371
+	call	memblock_reserved_pages
+.LVL113:
+	movl	num_regions(%rip), %esi
+	.loc 1 273 1 is_stmt 0 view .LVU372
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 272 5 view .LVU373
+	leaq	.LC4(%rip), %rdi
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	jmp	kprintf@PLT
+.LVL114:
+	.cfi_endproc
+.LFE11:
+	.size	memblock_seal, .-memblock_seal
+	.local	sealed
+	.comm	sealed,1,1
+	.local	num_regions
+	.comm	num_regions,4,4
+	.local	regions
+	.comm	regions,2048,32
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "src/include/limine.h"
+	.file 6 "src/include/mem.h"
+	.file 7 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x811
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF51
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xa
+	.long	.LASF8
+	.byte	0x3
+	.byte	0x34
+	.byte	0x16
+	.long	0x64
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xa
+	.long	.LASF9
+	.byte	0x3
+	.byte	0x37
+	.byte	0x1b
+	.long	0x77
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x77
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF12
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0x1f
+	.long	0x9a
+	.uleb128 0x6
+	.long	0xa1
+	.uleb128 0x10
+	.long	.LASF18
+	.value	0x183
+	.long	0xde
+	.uleb128 0x7
+	.long	.LASF15
+	.value	0x184
+	.byte	0xe
+	.long	0x6b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF16
+	.value	0x185
+	.byte	0xe
+	.long	0x6b
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF17
+	.value	0x186
+	.byte	0xe
+	.long	0x6b
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF19
+	.value	0x189
+	.long	0x111
+	.uleb128 0x7
+	.long	.LASF20
+	.value	0x18a
+	.byte	0xe
+	.long	0x6b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF21
+	.value	0x18b
+	.byte	0xe
+	.long	0x6b
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF22
+	.value	0x18c
+	.byte	0x23
+	.long	0x116
+	.byte	0x10
+	.byte	0
+	.uleb128 0x20
+	.long	0xde
+	.uleb128 0x6
+	.long	0x11b
+	.uleb128 0x6
+	.long	0xab
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF23
+	.uleb128 0x11
+	.long	.LASF24
+	.byte	0xad
+	.byte	0x30
+	.long	0x132
+	.uleb128 0x6
+	.long	0x111
+	.uleb128 0x11
+	.long	.LASF25
+	.byte	0xb2
+	.byte	0x11
+	.long	0x6b
+	.uleb128 0x21
+	.long	.LASF26
+	.byte	0x10
+	.byte	0x1
+	.byte	0x25
+	.byte	0x8
+	.long	0x166
+	.uleb128 0x12
+	.long	.LASF15
+	.byte	0x26
+	.long	0x6b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF27
+	.byte	0x27
+	.long	0x6b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x22
+	.long	0x142
+	.long	0x176
+	.uleb128 0x23
+	.long	0x77
+	.byte	0x7f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF28
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x166
+	.uleb128 0x9
+	.byte	0x3
+	.quad	regions
+	.uleb128 0xb
+	.long	.LASF29
+	.byte	0x2b
+	.byte	0x11
+	.long	0x58
+	.uleb128 0x9
+	.byte	0x3
+	.quad	num_regions
+	.uleb128 0xb
+	.long	.LASF30
+	.byte	0x2e
+	.byte	0xc
+	.long	0x120
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sealed
+	.uleb128 0x24
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x30
+	.byte	0x6
+	.long	0x1c8
+	.uleb128 0x25
+	.long	0xa6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF53
+	.byte	0x1
+	.value	0x10c
+	.byte	0x6
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x210
+	.uleb128 0x28
+	.quad	.LVL113
+	.long	0x210
+	.uleb128 0x13
+	.quad	.LVL114
+	.long	0x1b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF37
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xa
+	.long	0x6b
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a8
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0xf8
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0xf9
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x8
+	.long	.LLRL47
+	.uleb128 0x5
+	.string	"i"
+	.byte	0xfb
+	.byte	0x13
+	.long	0x58
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x2a
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0xfc
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x5
+	.string	"end"
+	.byte	0xfd
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF40
+	.byte	0xd8
+	.byte	0x5
+	.long	0x120
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x33a
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0xd8
+	.byte	0x21
+	.long	0x6b
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x14
+	.string	"end"
+	.byte	0xd8
+	.byte	0x30
+	.long	0x6b
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x15
+	.long	.LASF34
+	.byte	0xd8
+	.byte	0x3f
+	.long	0x33a
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x15
+	.long	.LASF35
+	.byte	0xd8
+	.byte	0x51
+	.long	0x33a
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x8
+	.long	.LLRL41
+	.uleb128 0x5
+	.string	"i"
+	.byte	0xda
+	.byte	0x13
+	.long	0x58
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x8
+	.long	.LLRL43
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0xdb
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x6b
+	.uleb128 0x2b
+	.long	.LASF38
+	.byte	0x1
+	.byte	0xad
+	.byte	0x6
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x466
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0xad
+	.byte	0x1a
+	.long	0x98
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0xad
+	.byte	0x26
+	.long	0x7e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0xb4
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x5
+	.string	"end"
+	.byte	0xb5
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x5
+	.string	"i"
+	.byte	0xb6
+	.byte	0xe
+	.long	0x58
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xd
+	.long	.LLRL35
+	.long	0x443
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0xb9
+	.byte	0x20
+	.long	0x466
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0xba
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2c
+	.long	0x7e8
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.byte	0x1
+	.byte	0xcf
+	.byte	0xd
+	.long	0x42e
+	.uleb128 0x2d
+	.long	0x7f5
+	.uleb128 0x2e
+	.long	0x800
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.uleb128 0xe
+	.long	0x801
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL81
+	.long	0x6eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL91
+	.long	0x1b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x142
+	.uleb128 0xc
+	.long	.LASF41
+	.byte	0x9d
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x52b
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x9d
+	.byte	0x1d
+	.long	0x7e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x9d
+	.byte	0x2a
+	.long	0x7e
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x9f
+	.byte	0xb
+	.long	0x98
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x16
+	.long	0x80b
+	.quad	.LBI53
+	.byte	.LVU205
+	.quad	.LBB53
+	.quad	.LBE53-.LBB53
+	.byte	0xa3
+	.uleb128 0x2f
+	.quad	.LVL62
+	.long	0x52b
+	.long	0x50f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL63
+	.long	0x1b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF44
+	.byte	0x70
+	.byte	0x7
+	.long	0x98
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6b8
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x70
+	.byte	0x23
+	.long	0x7e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4
+	.long	.LASF42
+	.byte	0x70
+	.byte	0x30
+	.long	0x7e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x70
+	.byte	0x40
+	.long	0x6b
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x70
+	.byte	0x53
+	.long	0x6b
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xd
+	.long	.LLRL14
+	.long	0x695
+	.uleb128 0x5
+	.string	"i"
+	.byte	0x7b
+	.byte	0x11
+	.long	0x7e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x8
+	.long	.LLRL16
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x7c
+	.byte	0x25
+	.long	0x11b
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x2
+	.long	.LASF48
+	.byte	0x82
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x5
+	.string	"top"
+	.byte	0x83
+	.byte	0x12
+	.long	0x6b
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x8
+	.long	.LLRL20
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0x86
+	.byte	0x16
+	.long	0x6b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x8c
+	.byte	0x24
+	.long	0x466
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x17
+	.long	0x6b8
+	.quad	.LBI30
+	.byte	.LVU141
+	.long	.LLRL23
+	.byte	0x8c
+	.byte	0x2e
+	.long	0x665
+	.uleb128 0xf
+	.long	0x6d4
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xf
+	.long	0x6c9
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x18
+	.long	0x6e0
+	.long	.LLRL23
+	.uleb128 0xe
+	.long	0x6e1
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL43
+	.long	0x6eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x13
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x7
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL60
+	.long	0x1b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF54
+	.byte	0x1
+	.byte	0x60
+	.byte	0x1f
+	.long	0x466
+	.byte	0x1
+	.long	0x6eb
+	.uleb128 0x19
+	.long	.LASF15
+	.byte	0x60
+	.byte	0x38
+	.long	0x6b
+	.uleb128 0x31
+	.string	"end"
+	.byte	0x1
+	.byte	0x60
+	.byte	0x47
+	.long	0x6b
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x62
+	.long	0x58
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF55
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xd
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e8
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x3f
+	.byte	0x22
+	.long	0x6b
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x3f
+	.byte	0x31
+	.long	0x6b
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x5
+	.string	"end"
+	.byte	0x41
+	.byte	0xe
+	.long	0x6b
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x42
+	.byte	0xe
+	.long	0x58
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xd
+	.long	.LLRL8
+	.long	0x770
+	.uleb128 0x5
+	.string	"i"
+	.byte	0x54
+	.byte	0x13
+	.long	0x58
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x17
+	.long	0x7e8
+	.quad	.LBI8
+	.byte	.LVU31
+	.long	.LLRL4
+	.byte	0x4c
+	.byte	0x9
+	.long	0x7ad
+	.uleb128 0xf
+	.long	0x7f5
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x18
+	.long	0x800
+	.long	.LLRL6
+	.uleb128 0xe
+	.long	0x801
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x80b
+	.quad	.LBI19
+	.byte	.LVU86
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.byte	0x51
+	.uleb128 0x9
+	.quad	.LVL20
+	.long	0x1b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF56
+	.byte	0x1
+	.byte	0x33
+	.byte	0xd
+	.byte	0x1
+	.long	0x80b
+	.uleb128 0x19
+	.long	.LASF50
+	.byte	0x33
+	.byte	0x25
+	.long	0x58
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x35
+	.long	0x58
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.string	"hcf"
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS45:
+	.uleb128 .LVU339
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU340
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU342
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0xf
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x11
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x11
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	regions+16
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU349
+	.uleb128 .LVU363
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU353
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0xd
+	.byte	0x72
+	.sleb128 -16
+	.byte	0x6
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0x3c
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU290
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU316
+	.uleb128 .LVU319
+	.uleb128 .LVU321
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU297
+	.uleb128 .LVU298
+	.uleb128 .LVU301
+	.uleb128 .LVU326
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL91-1-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU216
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+	.uleb128 .LVU277
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU225
+	.uleb128 .LVU259
+	.uleb128 .LVU260
+	.uleb128 .LVU277
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU226
+	.uleb128 .LVU228
+	.uleb128 .LVU235
+	.uleb128 .LVU236
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU235
+	.uleb128 .LVU236
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	regions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU228
+	.uleb128 .LVU232
+	.uleb128 .LVU244
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU255
+	.uleb128 .LVU260
+	.uleb128 .LVU261
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU266
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 8
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 8
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU266
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU273
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 .LFE7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 .LFE7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU200
+	.uleb128 .LVU204
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL63-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU190
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x14
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x31
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x7
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU190
+	.uleb128 .LVU191
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x24
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x38
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775800
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL60-1-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU110
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU159
+	.uleb128 .LVU165
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU188
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU120
+	.uleb128 .LVU135
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU125
+	.uleb128 .LVU158
+	.uleb128 .LVU165
+	.uleb128 .LVU188
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU128
+	.uleb128 .LVU135
+	.uleb128 .LVU169
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU174
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x29
+	.byte	0x71
+	.sleb128 0
+	.byte	0x6
+	.byte	0x71
+	.sleb128 8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU137
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU175
+	.uleb128 .LVU176
+	.uleb128 .LVU188
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU174
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x21
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	regions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU141
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU180
+	.uleb128 .LVU184
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU141
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU180
+	.uleb128 .LVU184
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU144
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU183
+	.uleb128 .LVU184
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0xf
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x11
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x11
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	regions+16
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0xf
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0xf
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	regions
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU67
+	.uleb128 .LVU78
+	.uleb128 .LVU82
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU6
+	.uleb128 .LVU67
+	.uleb128 .LVU78
+	.uleb128 .LVU82
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU7
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU67
+	.uleb128 .LVU78
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU85
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU54
+	.uleb128 .LVU59
+	.uleb128 .LVU79
+	.uleb128 .LVU81
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU31
+	.uleb128 .LVU45
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU34
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB14-.Ltext0
+	.uleb128 .LBE14-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB15-.Ltext0
+	.uleb128 .LBE15-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB10-.Ltext0
+	.uleb128 .LBE10-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB11-.Ltext0
+	.uleb128 .LBE11-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB17-.Ltext0
+	.uleb128 .LBE17-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB18-.Ltext0
+	.uleb128 .LBE18-.Ltext0
+	.byte	0
+.LLRL14:
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB49-.Ltext0
+	.uleb128 .LBE49-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0
+.LLRL16:
+	.byte	0x4
+	.uleb128 .LBB28-.Ltext0
+	.uleb128 .LBE28-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB29-.Ltext0
+	.uleb128 .LBE29-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB37-.Ltext0
+	.uleb128 .LBE37-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB38-.Ltext0
+	.uleb128 .LBE38-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB63-.Ltext0
+	.uleb128 .LBE63-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB73-.Ltext0
+	.uleb128 .LBE73-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB67-.Ltext0
+	.uleb128 .LBE67-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF11:
+	.string	"size_t"
+.LASF20:
+	.string	"revision"
+.LASF34:
+	.string	"pStart"
+.LASF49:
+	.string	"start"
+.LASF21:
+	.string	"entry_count"
+.LASF53:
+	.string	"memblock_seal"
+.LASF33:
+	.string	"first"
+.LASF47:
+	.string	"entry"
+.LASF9:
+	.string	"uint64_t"
+.LASF52:
+	.string	"kprintf"
+.LASF30:
+	.string	"sealed"
+.LASF24:
+	.string	"memmap"
+.LASF43:
+	.string	"pData"
+.LASF32:
+	.string	"next_page"
+.LASF39:
+	.string	"pRegion"
+.LASF27:
+	.string	"size"
+.LASF10:
+	.string	"long unsigned int"
+.LASF54:
+	.string	"_region_overlap"
+.LASF8:
+	.string	"uint32_t"
+.LASF48:
+	.string	"bottom"
+.LASF5:
+	.string	"unsigned char"
+.LASF36:
+	.string	"region_end"
+.LASF19:
+	.string	"limine_memmap_response"
+.LASF3:
+	.string	"short int"
+.LASF46:
+	.string	"max_addr"
+.LASF15:
+	.string	"base"
+.LASF7:
+	.string	"unsigned int"
+.LASF56:
+	.string	"_region_remove"
+.LASF29:
+	.string	"num_regions"
+.LASF55:
+	.string	"_region_add"
+.LASF41:
+	.string	"memblock_alloc"
+.LASF13:
+	.string	"long double"
+.LASF31:
+	.string	"pages"
+.LASF12:
+	.string	"long long int"
+.LASF25:
+	.string	"vmm_higher_half_offset"
+.LASF14:
+	.string	"char"
+.LASF50:
+	.string	"index"
+.LASF42:
+	.string	"align"
+.LASF17:
+	.string	"type"
+.LASF18:
+	.string	"limine_memmap_entry"
+.LASF26:
+	.string	"MemblockRegion"
+.LASF51:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF40:
+	.string	"memblock_find_free"
+.LASF44:
+	.string	"memblock_alloc_range"
+.LASF4:
+	.string	"long int"
+.LASF22:
+	.string	"entries"
+.LASF45:
+	.string	"min_addr"
+.LASF2:
+	.string	"signed char"
+.LASF38:
+	.string	"memblock_free"
+.LASF6:
+	.string	"short unsigned int"
+.LASF28:
+	.string	"regions"
+.LASF23:
+	.string	"_Bool"
+.LASF16:
+	.string	"length"
+.LASF37:
+	.string	"memblock_reserved_pages"
+.LASF35:
+	.string	"pEnd"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/memblock.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6952 @@
+	.file	"pci.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/pci.c"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"Mass Storage Controller - Serial ATA Controller"
+	.align 8
+.LC1:
+	.string	"Mass Storage Controller - Non-Volatile Memory Controller"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC2:
+	.string	"Unknown Device"
+	.section	.rodata.str1.8
+	.align 8
+.LC3:
+	.string	"Network Controller - Ethernet Controller"
+	.section	.rodata.str1.1
+.LC4:
+	.string	"Bridge - ISA Bridge"
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"Display Controller - VGA Compatible Controller"
+	.align 8
+.LC6:
+	.string	"Serial Bus Controller - SMBus Controller"
+	.section	.rodata.str1.1
+.LC7:
+	.string	"Bridge - Host Bridge"
+.LC8:
+	.string	"PCI: %d / %d\n"
+	.text
+	.p2align 4
+	.globl	_get_device_str
+	.type	_get_device_str, @function
+_get_device_str:
+.LVL0:
+.LFB0:
+	.file 1 "src/pci.c"
+	.loc 1 35 1 view -0
+	.cfi_startproc
+	.loc 1 37 5 view .LVU1
+	.loc 1 35 1 is_stmt 0 view .LVU2
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 39 13 view .LVU3
+	movzbl	%sil, %ecx
+	.loc 1 37 5 view .LVU4
+	cmpb	$12, %dil
+	ja	.L2
+	leaq	.L4(%rip), %rdx
+	movzbl	%dil, %eax
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L4:
+	.long	.L2-.L4
+	.long	.L8-.L4
+	.long	.L7-.L4
+	.long	.L6-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L5-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L3-.L4
+	.text
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 84 5 is_stmt 1 view .LVU5
+	.loc 1 37 5 is_stmt 0 view .LVU6
+	movzbl	%dil, %esi
+.LVL1:
+	.loc 1 84 5 view .LVU7
+	movl	%ecx, %edx
+	leaq	.LC8(%rip), %rdi
+.LVL2:
+	.loc 1 84 5 view .LVU8
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL3:
+	.loc 1 85 5 is_stmt 1 view .LVU9
+.L10:
+	.loc 1 46 28 is_stmt 0 view .LVU10
+	leaq	.LC2(%rip), %rax
+.L1:
+	.loc 1 86 1 view .LVU11
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL4:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.cfi_restore_state
+	.loc 1 39 13 is_stmt 1 view .LVU12
+	.loc 1 41 28 is_stmt 0 view .LVU13
+	leaq	.LC0(%rip), %rax
+	.loc 1 39 13 view .LVU14
+	cmpb	$6, %sil
+	je	.L1
+	leaq	.LC1(%rip), %rax
+	cmpb	$8, %sil
+	je	.L1
+	.loc 1 45 21 is_stmt 1 view .LVU15
+	movl	%ecx, %edx
+	movl	$1, %esi
+.LVL5:
+	.loc 1 45 21 is_stmt 0 view .LVU16
+	leaq	.LC8(%rip), %rdi
+.LVL6:
+	.loc 1 45 21 view .LVU17
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL7:
+	.loc 1 46 21 is_stmt 1 view .LVU18
+	.loc 1 46 28 is_stmt 0 view .LVU19
+	jmp	.L10
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 49 13 is_stmt 1 view .LVU20
+	.loc 1 51 28 is_stmt 0 view .LVU21
+	leaq	.LC3(%rip), %rax
+	.loc 1 49 13 view .LVU22
+	testb	%sil, %sil
+	je	.L1
+	.loc 1 53 21 is_stmt 1 view .LVU23
+	movl	%ecx, %edx
+	movl	$2, %esi
+.LVL9:
+	.loc 1 53 21 is_stmt 0 view .LVU24
+	leaq	.LC8(%rip), %rdi
+.LVL10:
+	.loc 1 53 21 view .LVU25
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL11:
+	.loc 1 54 21 is_stmt 1 view .LVU26
+	.loc 1 54 28 is_stmt 0 view .LVU27
+	jmp	.L10
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.loc 1 57 13 is_stmt 1 view .LVU28
+	.loc 1 59 28 is_stmt 0 view .LVU29
+	leaq	.LC5(%rip), %rax
+	.loc 1 57 13 view .LVU30
+	testb	%sil, %sil
+	je	.L1
+	.loc 1 61 21 is_stmt 1 view .LVU31
+	movl	%ecx, %edx
+	movl	$3, %esi
+.LVL13:
+	.loc 1 61 21 is_stmt 0 view .LVU32
+	leaq	.LC8(%rip), %rdi
+.LVL14:
+	.loc 1 61 21 view .LVU33
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL15:
+	.loc 1 62 21 is_stmt 1 view .LVU34
+	.loc 1 62 28 is_stmt 0 view .LVU35
+	jmp	.L10
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.loc 1 65 13 is_stmt 1 view .LVU36
+	.loc 1 67 28 is_stmt 0 view .LVU37
+	leaq	.LC7(%rip), %rax
+	.loc 1 65 13 view .LVU38
+	testb	%sil, %sil
+	je	.L1
+	leaq	.LC4(%rip), %rax
+	cmpb	$1, %sil
+	je	.L1
+	.loc 1 71 21 is_stmt 1 view .LVU39
+	movl	%ecx, %edx
+	movl	$6, %esi
+.LVL17:
+	.loc 1 71 21 is_stmt 0 view .LVU40
+	leaq	.LC8(%rip), %rdi
+.LVL18:
+	.loc 1 71 21 view .LVU41
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL19:
+	.loc 1 72 21 is_stmt 1 view .LVU42
+	.loc 1 72 28 is_stmt 0 view .LVU43
+	jmp	.L10
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 75 13 is_stmt 1 view .LVU44
+	.loc 1 77 28 is_stmt 0 view .LVU45
+	leaq	.LC6(%rip), %rax
+	.loc 1 75 13 view .LVU46
+	cmpb	$5, %sil
+	je	.L1
+	.loc 1 79 21 is_stmt 1 view .LVU47
+	movl	%ecx, %edx
+	movl	$12, %esi
+.LVL21:
+	.loc 1 79 21 is_stmt 0 view .LVU48
+	leaq	.LC8(%rip), %rdi
+.LVL22:
+	.loc 1 79 21 view .LVU49
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL23:
+	.loc 1 80 21 is_stmt 1 view .LVU50
+	.loc 1 80 28 is_stmt 0 view .LVU51
+	jmp	.L10
+	.cfi_endproc
+.LFE0:
+	.size	_get_device_str, .-_get_device_str
+	.p2align 4
+	.globl	_pci_mm_read
+	.type	_pci_mm_read, @function
+_pci_mm_read:
+.LVL24:
+.LFB1:
+	.loc 1 92 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 93 5 view .LVU53
+	.loc 1 93 25 is_stmt 0 view .LVU54
+	movq	mcfg(%rip), %r9
+	.loc 1 94 15 view .LVU55
+	movzbl	%dil, %edi
+	.loc 1 94 62 view .LVU56
+	movzbl	%dl, %edx
+	.loc 1 93 62 view .LVU57
+	movl	%ecx, %ecx
+	.loc 1 94 45 view .LVU58
+	movzbl	%sil, %esi
+	.loc 1 94 62 view .LVU59
+	sall	$12, %edx
+.LVL25:
+	.loc 1 94 21 view .LVU60
+	movzbl	54(%r9), %eax
+	.loc 1 94 45 view .LVU61
+	sall	$15, %esi
+.LVL26:
+	.loc 1 94 51 view .LVU62
+	orl	%edx, %esi
+	.loc 1 94 15 view .LVU63
+	subl	%eax, %edi
+.LVL27:
+	.loc 1 93 37 view .LVU64
+	movq	vmm_higher_half_offset(%rip), %rax
+	addq	44(%r9), %rax
+	.loc 1 94 30 view .LVU65
+	sall	$20, %edi
+	.loc 1 93 62 view .LVU66
+	addq	%rcx, %rax
+	.loc 1 94 51 view .LVU67
+	orl	%esi, %edi
+	movslq	%edi, %rdi
+	.loc 1 93 14 view .LVU68
+	addq	%rax, %rdi
+.LVL28:
+	.loc 1 96 5 is_stmt 1 view .LVU69
+	cmpb	$2, %r8b
+	je	.L21
+	cmpb	$4, %r8b
+	je	.L22
+	xorl	%eax, %eax
+	cmpb	$1, %r8b
+	je	.L25
+	.loc 1 106 1 is_stmt 0 view .LVU70
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 98 13 is_stmt 1 view .LVU71
+	.loc 1 98 20 is_stmt 0 view .LVU72
+	movzbl	(%rdi), %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 102 13 is_stmt 1 view .LVU73
+	.loc 1 102 20 is_stmt 0 view .LVU74
+	movl	(%rdi), %eax
+	.loc 1 106 1 view .LVU75
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.loc 1 100 13 is_stmt 1 view .LVU76
+	.loc 1 100 20 is_stmt 0 view .LVU77
+	movzwl	(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	_pci_mm_read, .-_pci_mm_read
+	.p2align 4
+	.globl	pci_device_read
+	.type	pci_device_read, @function
+pci_device_read:
+.LVL29:
+.LFB2:
+	.loc 1 113 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 114 5 view .LVU79
+.LBB16:
+.LBI16:
+	.loc 1 91 10 view .LVU80
+.LBB17:
+	.loc 1 93 5 view .LVU81
+.LBE17:
+.LBE16:
+	.loc 1 114 12 is_stmt 0 view .LVU82
+	movzbl	3(%rdi), %eax
+	movzbl	4(%rdi), %ecx
+.LBB23:
+.LBB18:
+	.loc 1 93 62 view .LVU83
+	movl	%esi, %esi
+	.loc 1 93 25 view .LVU84
+	movq	mcfg(%rip), %r8
+	.loc 1 94 62 view .LVU85
+	sall	$12, %ecx
+	.loc 1 94 45 view .LVU86
+	sall	$15, %eax
+	.loc 1 94 51 view .LVU87
+	orl	%ecx, %eax
+.LBE18:
+.LBE23:
+	.loc 1 114 12 view .LVU88
+	movzbl	2(%rdi), %ecx
+.LBB24:
+.LBB19:
+	.loc 1 94 21 view .LVU89
+	movzbl	54(%r8), %edi
+.LVL30:
+	.loc 1 94 15 view .LVU90
+	subl	%edi, %ecx
+.LVL31:
+	.loc 1 94 30 view .LVU91
+	sall	$20, %ecx
+	.loc 1 94 51 view .LVU92
+	orl	%ecx, %eax
+	.loc 1 93 37 view .LVU93
+	movq	vmm_higher_half_offset(%rip), %rcx
+	addq	44(%r8), %rcx
+	.loc 1 94 51 view .LVU94
+	cltq
+	.loc 1 93 62 view .LVU95
+	addq	%rsi, %rcx
+	.loc 1 93 14 view .LVU96
+	addq	%rcx, %rax
+.LVL32:
+	.loc 1 96 5 is_stmt 1 view .LVU97
+	cmpb	$2, %dl
+	je	.L27
+	cmpb	$4, %dl
+	je	.L28
+	xorl	%ecx, %ecx
+	cmpb	$1, %dl
+	je	.L31
+.LBE19:
+.LBE24:
+	.loc 1 115 1 is_stmt 0 view .LVU98
+	movl	%ecx, %eax
+.LVL33:
+	.loc 1 115 1 view .LVU99
+	ret
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+.LBB25:
+.LBB20:
+	.loc 1 100 13 is_stmt 1 view .LVU100
+	.loc 1 100 20 is_stmt 0 view .LVU101
+	movzwl	(%rax), %ecx
+.LBE20:
+.LBE25:
+	.loc 1 115 1 view .LVU102
+	movl	%ecx, %eax
+.LVL35:
+	.loc 1 115 1 view .LVU103
+	ret
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+.LBB26:
+.LBB21:
+	.loc 1 98 13 is_stmt 1 view .LVU104
+	.loc 1 98 20 is_stmt 0 view .LVU105
+	movzbl	(%rax), %ecx
+.LBE21:
+.LBE26:
+	.loc 1 115 1 view .LVU106
+	movl	%ecx, %eax
+.LVL37:
+	.loc 1 115 1 view .LVU107
+	ret
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+.LBB27:
+.LBB22:
+	.loc 1 102 13 is_stmt 1 view .LVU108
+	.loc 1 102 20 is_stmt 0 view .LVU109
+	movl	(%rax), %ecx
+.LBE22:
+.LBE27:
+	.loc 1 115 1 view .LVU110
+	movl	%ecx, %eax
+.LVL39:
+	.loc 1 115 1 view .LVU111
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	pci_device_read, .-pci_device_read
+	.p2align 4
+	.globl	pci_device_write
+	.type	pci_device_write, @function
+pci_device_write:
+.LVL40:
+.LFB3:
+	.loc 1 122 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 123 5 view .LVU113
+	.loc 1 124 46 is_stmt 0 view .LVU114
+	movzbl	3(%rdi), %eax
+	.loc 1 122 1 view .LVU115
+	movl	%ecx, %r8d
+	.loc 1 124 66 view .LVU116
+	movzbl	4(%rdi), %ecx
+.LVL41:
+	.loc 1 123 62 view .LVU117
+	movl	%esi, %esi
+	.loc 1 123 25 view .LVU118
+	movq	mcfg(%rip), %r9
+	.loc 1 124 77 view .LVU119
+	sall	$12, %ecx
+	.loc 1 124 55 view .LVU120
+	sall	$15, %eax
+	.loc 1 124 61 view .LVU121
+	orl	%ecx, %eax
+	.loc 1 124 14 view .LVU122
+	movzbl	2(%rdi), %ecx
+	.loc 1 124 26 view .LVU123
+	movzbl	54(%r9), %edi
+.LVL42:
+	.loc 1 124 20 view .LVU124
+	subl	%edi, %ecx
+	.loc 1 124 35 view .LVU125
+	sall	$20, %ecx
+	.loc 1 124 61 view .LVU126
+	orl	%ecx, %eax
+	.loc 1 123 37 view .LVU127
+	movq	vmm_higher_half_offset(%rip), %rcx
+	addq	44(%r9), %rcx
+	.loc 1 124 61 view .LVU128
+	cltq
+	.loc 1 123 62 view .LVU129
+	addq	%rsi, %rcx
+	.loc 1 123 14 view .LVU130
+	addq	%rcx, %rax
+.LVL43:
+	.loc 1 126 5 is_stmt 1 view .LVU131
+	cmpb	$2, %dl
+	je	.L33
+	cmpb	$4, %dl
+	je	.L34
+	cmpb	$1, %dl
+	je	.L36
+	.loc 1 137 1 is_stmt 0 view .LVU132
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.loc 1 128 13 is_stmt 1 view .LVU133
+	.loc 1 128 31 is_stmt 0 view .LVU134
+	movb	%r8b, (%rax)
+	.loc 1 129 13 is_stmt 1 view .LVU135
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 134 13 view .LVU136
+	.loc 1 134 30 is_stmt 0 view .LVU137
+	movl	%r8d, (%rax)
+	.loc 1 135 13 is_stmt 1 view .LVU138
+	.loc 1 137 1 is_stmt 0 view .LVU139
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.loc 1 131 13 is_stmt 1 view .LVU140
+	.loc 1 131 32 is_stmt 0 view .LVU141
+	movw	%r8w, (%rax)
+	.loc 1 132 13 is_stmt 1 view .LVU142
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	pci_device_write, .-pci_device_write
+	.p2align 4
+	.globl	_pci_mm_read_vendor_id
+	.type	_pci_mm_read_vendor_id, @function
+_pci_mm_read_vendor_id:
+.LVL44:
+.LFB4:
+	.loc 1 143 1 view -0
+	.cfi_startproc
+	.loc 1 144 5 view .LVU144
+.LBB30:
+.LBI30:
+	.loc 1 91 10 view .LVU145
+.LBB31:
+	.loc 1 93 5 view .LVU146
+	.loc 1 93 25 is_stmt 0 view .LVU147
+	movq	mcfg(%rip), %rax
+.LVL45:
+	.loc 1 96 5 is_stmt 1 view .LVU148
+	.loc 1 100 13 view .LVU149
+	.loc 1 100 13 is_stmt 0 view .LVU150
+.LBE31:
+.LBE30:
+	.loc 1 145 5 is_stmt 1 view .LVU151
+	.loc 1 144 21 is_stmt 0 view .LVU152
+	movzbl	%dil, %edi
+	.loc 1 144 21 view .LVU153
+	movzbl	%sil, %esi
+.LVL46:
+	.loc 1 144 21 view .LVU154
+	movzbl	%dl, %edx
+.LBB33:
+.LBB32:
+	.loc 1 94 45 view .LVU155
+	sall	$15, %esi
+.LVL47:
+	.loc 1 94 62 view .LVU156
+	sall	$12, %edx
+.LVL48:
+	.loc 1 94 21 view .LVU157
+	movzbl	54(%rax), %ecx
+	.loc 1 94 15 view .LVU158
+	subl	%ecx, %edi
+.LVL49:
+	.loc 1 94 30 view .LVU159
+	sall	$20, %edi
+	.loc 1 94 36 view .LVU160
+	orl	%esi, %edi
+	.loc 1 94 51 view .LVU161
+	orl	%edx, %edi
+	movslq	%edi, %rdi
+	.loc 1 100 20 view .LVU162
+	addq	44(%rax), %rdi
+	addq	vmm_higher_half_offset(%rip), %rdi
+.LBE32:
+.LBE33:
+	.loc 1 145 12 view .LVU163
+	movzwl	(%rdi), %eax
+.LVL50:
+	.loc 1 146 1 view .LVU164
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	_pci_mm_read_vendor_id, .-_pci_mm_read_vendor_id
+	.p2align 4
+	.globl	_pci_mm_read_header_type
+	.type	_pci_mm_read_header_type, @function
+_pci_mm_read_header_type:
+.LVL51:
+.LFB5:
+	.loc 1 152 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 153 5 view .LVU166
+.LBB36:
+.LBI36:
+	.loc 1 91 10 view .LVU167
+.LBB37:
+	.loc 1 93 5 view .LVU168
+	.loc 1 93 25 is_stmt 0 view .LVU169
+	movq	mcfg(%rip), %rax
+.LVL52:
+	.loc 1 96 5 is_stmt 1 view .LVU170
+	.loc 1 102 13 view .LVU171
+	.loc 1 102 13 is_stmt 0 view .LVU172
+.LBE37:
+.LBE36:
+	.loc 1 154 5 is_stmt 1 view .LVU173
+	.loc 1 153 21 is_stmt 0 view .LVU174
+	movzbl	%dil, %edi
+	.loc 1 153 21 view .LVU175
+	movzbl	%sil, %esi
+.LVL53:
+	.loc 1 153 21 view .LVU176
+	movzbl	%dl, %edx
+.LBB39:
+.LBB38:
+	.loc 1 94 45 view .LVU177
+	sall	$15, %esi
+.LVL54:
+	.loc 1 94 62 view .LVU178
+	sall	$12, %edx
+.LVL55:
+	.loc 1 94 21 view .LVU179
+	movzbl	54(%rax), %ecx
+	.loc 1 94 15 view .LVU180
+	subl	%ecx, %edi
+.LVL56:
+	.loc 1 94 30 view .LVU181
+	sall	$20, %edi
+	.loc 1 94 36 view .LVU182
+	orl	%esi, %edi
+	.loc 1 94 51 view .LVU183
+	orl	%edx, %edi
+	movslq	%edi, %rdi
+	.loc 1 102 20 view .LVU184
+	addq	vmm_higher_half_offset(%rip), %rdi
+	addq	44(%rax), %rdi
+.LBE38:
+.LBE39:
+	.loc 1 154 12 view .LVU185
+	movzbl	14(%rdi), %eax
+.LVL57:
+	.loc 1 155 1 view .LVU186
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	_pci_mm_read_header_type, .-_pci_mm_read_header_type
+	.p2align 4
+	.globl	_pci_mm_read_class_code
+	.type	_pci_mm_read_class_code, @function
+_pci_mm_read_class_code:
+.LVL58:
+.LFB6:
+	.loc 1 161 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 162 5 view .LVU188
+.LBB42:
+.LBI42:
+	.loc 1 91 10 view .LVU189
+.LBB43:
+	.loc 1 93 5 view .LVU190
+	.loc 1 93 25 is_stmt 0 view .LVU191
+	movq	mcfg(%rip), %rax
+.LVL59:
+	.loc 1 96 5 is_stmt 1 view .LVU192
+	.loc 1 102 13 view .LVU193
+	.loc 1 102 13 is_stmt 0 view .LVU194
+.LBE43:
+.LBE42:
+	.loc 1 163 5 is_stmt 1 view .LVU195
+	.loc 1 165 5 view .LVU196
+	.loc 1 162 21 is_stmt 0 view .LVU197
+	movzbl	%dil, %edi
+	.loc 1 162 21 view .LVU198
+	movzbl	%sil, %esi
+.LVL60:
+	.loc 1 162 21 view .LVU199
+	movzbl	%dl, %edx
+.LBB45:
+.LBB44:
+	.loc 1 94 45 view .LVU200
+	sall	$15, %esi
+.LVL61:
+	.loc 1 94 62 view .LVU201
+	sall	$12, %edx
+.LVL62:
+	.loc 1 94 21 view .LVU202
+	movzbl	54(%rax), %ecx
+	.loc 1 94 15 view .LVU203
+	subl	%ecx, %edi
+.LVL63:
+	.loc 1 94 30 view .LVU204
+	sall	$20, %edi
+	.loc 1 94 36 view .LVU205
+	orl	%esi, %edi
+	.loc 1 94 51 view .LVU206
+	orl	%edx, %edi
+	movslq	%edi, %rdi
+	.loc 1 102 20 view .LVU207
+	addq	vmm_higher_half_offset(%rip), %rdi
+	addq	44(%rax), %rdi
+.LBE44:
+.LBE45:
+	.loc 1 163 13 view .LVU208
+	movzbl	11(%rdi), %eax
+.LVL64:
+	.loc 1 166 1 view .LVU209
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	_pci_mm_read_class_code, .-_pci_mm_read_class_code
+	.p2align 4
+	.globl	_pci_mm_read_subclass_code
+	.type	_pci_mm_read_subclass_code, @function
+_pci_mm_read_subclass_code:
+.LVL65:
+.LFB7:
+	.loc 1 172 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 173 5 view .LVU211
+.LBB48:
+.LBI48:
+	.loc 1 91 10 view .LVU212
+.LBB49:
+	.loc 1 93 5 view .LVU213
+	.loc 1 93 25 is_stmt 0 view .LVU214
+	movq	mcfg(%rip), %rax
+.LVL66:
+	.loc 1 96 5 is_stmt 1 view .LVU215
+	.loc 1 102 13 view .LVU216
+	.loc 1 102 13 is_stmt 0 view .LVU217
+.LBE49:
+.LBE48:
+	.loc 1 174 5 is_stmt 1 view .LVU218
+	.loc 1 175 5 view .LVU219
+	.loc 1 173 21 is_stmt 0 view .LVU220
+	movzbl	%dil, %edi
+	.loc 1 173 21 view .LVU221
+	movzbl	%sil, %esi
+.LVL67:
+	.loc 1 173 21 view .LVU222
+	movzbl	%dl, %edx
+.LBB51:
+.LBB50:
+	.loc 1 94 45 view .LVU223
+	sall	$15, %esi
+.LVL68:
+	.loc 1 94 62 view .LVU224
+	sall	$12, %edx
+.LVL69:
+	.loc 1 94 21 view .LVU225
+	movzbl	54(%rax), %ecx
+	.loc 1 94 15 view .LVU226
+	subl	%ecx, %edi
+.LVL70:
+	.loc 1 94 30 view .LVU227
+	sall	$20, %edi
+	.loc 1 94 36 view .LVU228
+	orl	%esi, %edi
+	.loc 1 94 51 view .LVU229
+	orl	%edx, %edi
+	movslq	%edi, %rdi
+	.loc 1 102 20 view .LVU230
+	addq	vmm_higher_half_offset(%rip), %rdi
+	addq	44(%rax), %rdi
+.LBE50:
+.LBE51:
+	.loc 1 174 13 view .LVU231
+	movzbl	10(%rdi), %eax
+.LVL71:
+	.loc 1 176 1 view .LVU232
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	_pci_mm_read_subclass_code, .-_pci_mm_read_subclass_code
+	.p2align 4
+	.globl	_pci_mm_read_prog_if
+	.type	_pci_mm_read_prog_if, @function
+_pci_mm_read_prog_if:
+.LVL72:
+.LFB8:
+	.loc 1 182 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 183 5 view .LVU234
+.LBB54:
+.LBI54:
+	.loc 1 91 10 view .LVU235
+.LBB55:
+	.loc 1 93 5 view .LVU236
+	.loc 1 93 25 is_stmt 0 view .LVU237
+	movq	mcfg(%rip), %rax
+.LVL73:
+	.loc 1 96 5 is_stmt 1 view .LVU238
+	.loc 1 102 13 view .LVU239
+	.loc 1 102 13 is_stmt 0 view .LVU240
+.LBE55:
+.LBE54:
+	.loc 1 184 5 is_stmt 1 view .LVU241
+	.loc 1 185 5 view .LVU242
+	.loc 1 183 21 is_stmt 0 view .LVU243
+	movzbl	%dil, %edi
+	.loc 1 183 21 view .LVU244
+	movzbl	%sil, %esi
+.LVL74:
+	.loc 1 183 21 view .LVU245
+	movzbl	%dl, %edx
+.LBB57:
+.LBB56:
+	.loc 1 94 45 view .LVU246
+	sall	$15, %esi
+.LVL75:
+	.loc 1 94 62 view .LVU247
+	sall	$12, %edx
+.LVL76:
+	.loc 1 94 21 view .LVU248
+	movzbl	54(%rax), %ecx
+	.loc 1 94 15 view .LVU249
+	subl	%ecx, %edi
+.LVL77:
+	.loc 1 94 30 view .LVU250
+	sall	$20, %edi
+	.loc 1 94 36 view .LVU251
+	orl	%esi, %edi
+	.loc 1 94 51 view .LVU252
+	orl	%edx, %edi
+	movslq	%edi, %rdi
+	.loc 1 102 20 view .LVU253
+	addq	vmm_higher_half_offset(%rip), %rdi
+	addq	44(%rax), %rdi
+.LBE56:
+.LBE57:
+	.loc 1 184 13 view .LVU254
+	movzbl	9(%rdi), %eax
+.LVL78:
+	.loc 1 186 1 view .LVU255
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	_pci_mm_read_prog_if, .-_pci_mm_read_prog_if
+	.section	.rodata.str1.1
+.LC9:
+	.string	"PCI: %s\n"
+	.text
+	.p2align 4
+	.globl	_check_function
+	.type	_check_function, @function
+_check_function:
+.LVL79:
+.LFB9:
+	.loc 1 192 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 193 5 view .LVU257
+	.loc 1 192 1 is_stmt 0 view .LVU258
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%esi, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	.loc 1 193 25 view .LVU259
+	movzbl	%sil, %r14d
+	.loc 1 192 1 view .LVU260
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+.LBB66:
+.LBB67:
+.LBB68:
+.LBB69:
+	.loc 1 94 45 view .LVU261
+	sall	$15, %r14d
+.LBE69:
+.LBE68:
+.LBE67:
+.LBE66:
+	.loc 1 193 25 view .LVU262
+	movzbl	%dl, %r13d
+	.loc 1 192 1 view .LVU263
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB86:
+.LBB78:
+.LBB74:
+.LBB70:
+	.loc 1 94 62 view .LVU264
+	sall	$12, %r13d
+.LBE70:
+.LBE74:
+.LBE78:
+.LBE86:
+	.loc 1 192 1 view .LVU265
+	movl	%edi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 193 25 view .LVU266
+	movzbl	%dil, %ebx
+.LVL80:
+.LBB87:
+.LBI66:
+	.loc 1 160 9 is_stmt 1 view .LVU267
+.LBB79:
+	.loc 1 162 5 view .LVU268
+.LBB75:
+.LBI68:
+	.loc 1 91 10 view .LVU269
+.LBB71:
+	.loc 1 93 5 view .LVU270
+	.loc 1 94 15 is_stmt 0 view .LVU271
+	movl	%ebx, %eax
+.LBE71:
+.LBE75:
+.LBE79:
+.LBE87:
+	.loc 1 192 1 view .LVU272
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 198 50 view .LVU273
+	movq	pci_device_cache(%rip), %rdi
+.LVL81:
+	.loc 1 192 1 view .LVU274
+	movl	%ecx, 12(%rsp)
+.LBB88:
+.LBB80:
+.LBB76:
+.LBB72:
+	.loc 1 93 25 view .LVU275
+	movq	mcfg(%rip), %rcx
+.LVL82:
+	.loc 1 96 5 is_stmt 1 view .LVU276
+	.loc 1 102 13 view .LVU277
+.LBE72:
+.LBE76:
+.LBE80:
+.LBE88:
+	.loc 1 193 25 is_stmt 0 view .LVU278
+	movl	%edx, 28(%rsp)
+.LBB89:
+.LBB81:
+.LBB77:
+.LBB73:
+	.loc 1 94 21 view .LVU279
+	movzbl	54(%rcx), %esi
+.LVL83:
+	.loc 1 94 15 view .LVU280
+	subl	%esi, %eax
+.LVL84:
+	.loc 1 94 30 view .LVU281
+	sall	$20, %eax
+	.loc 1 94 36 view .LVU282
+	orl	%r14d, %eax
+	.loc 1 94 51 view .LVU283
+	orl	%r13d, %eax
+	cltq
+	.loc 1 102 20 view .LVU284
+	addq	vmm_higher_half_offset(%rip), %rax
+	addq	44(%rcx), %rax
+	movl	8(%rax), %r9d
+.LVL85:
+	.loc 1 102 20 view .LVU285
+.LBE73:
+.LBE77:
+	.loc 1 163 5 is_stmt 1 view .LVU286
+	.loc 1 163 40 is_stmt 0 view .LVU287
+	movl	%r9d, %eax
+.LBE81:
+.LBE89:
+.LBB90:
+.LBB91:
+	.loc 1 174 39 view .LVU288
+	movl	%r9d, %esi
+	movl	%r9d, 20(%rsp)
+	shrl	$16, %esi
+.LBE91:
+.LBE90:
+.LBB96:
+.LBB82:
+	.loc 1 163 40 view .LVU289
+	shrl	$24, %eax
+.LBE82:
+.LBE96:
+.LBB97:
+.LBB92:
+	.loc 1 174 39 view .LVU290
+	movl	%esi, 16(%rsp)
+.LBE92:
+.LBE97:
+.LBB98:
+.LBB83:
+	.loc 1 163 40 view .LVU291
+	movl	%eax, 24(%rsp)
+.LVL86:
+	.loc 1 165 5 is_stmt 1 view .LVU292
+	.loc 1 165 5 is_stmt 0 view .LVU293
+.LBE83:
+.LBE98:
+	.loc 1 194 5 is_stmt 1 view .LVU294
+.LBB99:
+.LBI90:
+	.loc 1 171 9 view .LVU295
+.LBB93:
+	.loc 1 173 5 view .LVU296
+	.loc 1 174 5 view .LVU297
+	.loc 1 175 5 view .LVU298
+	.loc 1 175 5 is_stmt 0 view .LVU299
+.LBE93:
+.LBE99:
+	.loc 1 195 5 is_stmt 1 view .LVU300
+.LBB100:
+.LBI100:
+	.loc 1 181 9 view .LVU301
+.LBB101:
+	.loc 1 183 5 view .LVU302
+	.loc 1 184 5 view .LVU303
+	.loc 1 185 5 view .LVU304
+	.loc 1 185 5 is_stmt 0 view .LVU305
+.LBE101:
+.LBE100:
+	.loc 1 198 5 is_stmt 1 view .LVU306
+	.loc 1 198 50 is_stmt 0 view .LVU307
+	call	kmem_cache_alloc@PLT
+.LVL87:
+.LBB104:
+.LBB84:
+	.loc 1 163 13 view .LVU308
+	movl	24(%rsp), %ecx
+.LBE84:
+.LBE104:
+.LBB105:
+.LBB94:
+	.loc 1 174 13 view .LVU309
+	movl	16(%rsp), %esi
+.LBE94:
+.LBE105:
+	.loc 1 198 50 view .LVU310
+	movq	%rax, %rbp
+.LVL88:
+	.loc 1 199 5 is_stmt 1 view .LVU311
+	.loc 1 199 31 is_stmt 0 view .LVU312
+	movzbl	pci_device_cnt(%rip), %eax
+.LVL89:
+	.loc 1 199 31 view .LVU313
+	leal	1(%rax), %edi
+	movb	%dil, pci_device_cnt(%rip)
+	.loc 1 199 35 view .LVU314
+	leaq	pci_devices(%rip), %rdi
+	movq	%rbp, (%rdi,%rax,8)
+	.loc 1 200 5 is_stmt 1 view .LVU315
+.LBB106:
+.LBB102:
+	.loc 1 184 13 is_stmt 0 view .LVU316
+	movl	20(%rsp), %eax
+.LBE102:
+.LBE106:
+	.loc 1 203 24 view .LVU317
+	movl	%ecx, %edi
+.LBB107:
+.LBB85:
+	.loc 1 163 13 view .LVU318
+	movb	%cl, 0(%rbp)
+.LBE85:
+.LBE107:
+	.loc 1 201 5 is_stmt 1 view .LVU319
+.LBB108:
+.LBB95:
+	.loc 1 174 13 is_stmt 0 view .LVU320
+	movb	%sil, 1(%rbp)
+.LBE95:
+.LBE108:
+	.loc 1 202 5 is_stmt 1 view .LVU321
+	.loc 1 203 24 is_stmt 0 view .LVU322
+	movzbl	%sil, %esi
+.LBB109:
+.LBB103:
+	.loc 1 184 13 view .LVU323
+	movb	%ah, 5(%rbp)
+.LBE103:
+.LBE109:
+	.loc 1 203 5 is_stmt 1 view .LVU324
+	.loc 1 203 24 is_stmt 0 view .LVU325
+	call	_get_device_str
+.LVL90:
+	.loc 1 205 19 view .LVU326
+	movl	28(%rsp), %edx
+	.loc 1 204 14 view .LVU327
+	movb	%r12b, 2(%rbp)
+	.loc 1 210 5 view .LVU328
+	leaq	.LC9(%rip), %rdi
+	.loc 1 206 17 view .LVU329
+	movb	%r15b, 3(%rbp)
+	.loc 1 207 22 view .LVU330
+	movzwl	12(%rsp), %r12d
+	.loc 1 203 24 view .LVU331
+	movq	%rax, %rsi
+	.loc 1 205 19 view .LVU332
+	movb	%dl, 4(%rbp)
+	.loc 1 208 24 view .LVU333
+	movq	mcfg(%rip), %rcx
+	.loc 1 203 22 view .LVU334
+	movq	%rax, 8(%rbp)
+	.loc 1 204 5 is_stmt 1 view .LVU335
+	.loc 1 205 5 view .LVU336
+	.loc 1 206 5 view .LVU337
+	.loc 1 207 5 view .LVU338
+	.loc 1 208 69 is_stmt 0 view .LVU339
+	movl	%ebx, %eax
+	.loc 1 207 22 view .LVU340
+	movl	%r12d, 24(%rbp)
+	.loc 1 208 5 is_stmt 1 view .LVU341
+	.loc 1 208 75 is_stmt 0 view .LVU342
+	movzbl	54(%rcx), %edx
+	.loc 1 208 69 view .LVU343
+	subl	%edx, %eax
+	.loc 1 208 36 view .LVU344
+	movq	vmm_higher_half_offset(%rip), %rdx
+	addq	44(%rcx), %rdx
+	.loc 1 208 84 view .LVU345
+	sall	$20, %eax
+	.loc 1 208 90 view .LVU346
+	orl	%r14d, %eax
+	.loc 1 208 105 view .LVU347
+	orl	%r13d, %eax
+	cltq
+	.loc 1 208 61 view .LVU348
+	addq	%rdx, %rax
+	movq	%rax, 16(%rbp)
+	.loc 1 210 5 is_stmt 1 view .LVU349
+	.loc 1 211 1 is_stmt 0 view .LVU350
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 56
+	.loc 1 210 5 view .LVU351
+	xorl	%eax, %eax
+	.loc 1 211 1 view .LVU352
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+.LVL91:
+	.loc 1 211 1 view .LVU353
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL92:
+	.loc 1 211 1 view .LVU354
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	.loc 1 210 5 view .LVU355
+	jmp	kprintf@PLT
+.LVL93:
+	.cfi_endproc
+.LFE9:
+	.size	_check_function, .-_check_function
+	.p2align 4
+	.globl	_check_device
+	.type	_check_device, @function
+_check_device:
+.LVL94:
+.LFB10:
+	.loc 1 217 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 218 5 view .LVU357
+	.loc 1 220 5 view .LVU358
+.LBB122:
+.LBB123:
+.LBB124:
+.LBB125:
+	.loc 1 93 25 is_stmt 0 view .LVU359
+	movq	mcfg(%rip), %rax
+	.loc 1 93 37 view .LVU360
+	movq	vmm_higher_half_offset(%rip), %rdx
+.LBE125:
+.LBE124:
+.LBE123:
+.LBE122:
+	.loc 1 217 1 view .LVU361
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	.loc 1 220 25 view .LVU362
+	movzbl	%dil, %r14d
+.LVL95:
+.LBB135:
+.LBI122:
+	.loc 1 142 10 is_stmt 1 view .LVU363
+.LBB132:
+	.loc 1 144 5 view .LVU364
+.LBB129:
+.LBI124:
+	.loc 1 91 10 view .LVU365
+.LBB126:
+	.loc 1 93 5 view .LVU366
+.LBE126:
+.LBE129:
+.LBE132:
+.LBE135:
+	.loc 1 217 1 is_stmt 0 view .LVU367
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+.LBB136:
+.LBB133:
+.LBB130:
+.LBB127:
+	.loc 1 94 21 view .LVU368
+	movzbl	54(%rax), %ecx
+.LBE127:
+.LBE130:
+.LBE133:
+.LBE136:
+	.loc 1 220 25 view .LVU369
+	movzbl	%sil, %ebx
+.LBB137:
+.LBB134:
+.LBB131:
+.LBB128:
+	.loc 1 93 37 view .LVU370
+	addq	44(%rax), %rdx
+	.loc 1 94 15 view .LVU371
+	movl	%r14d, %eax
+	.loc 1 94 45 view .LVU372
+	movl	%ebx, %r13d
+	.loc 1 94 15 view .LVU373
+	subl	%ecx, %eax
+	.loc 1 94 45 view .LVU374
+	sall	$15, %r13d
+	.loc 1 94 30 view .LVU375
+	sall	$20, %eax
+	.loc 1 94 36 view .LVU376
+	orl	%r13d, %eax
+	.loc 1 94 51 view .LVU377
+	cltq
+.LVL96:
+	.loc 1 96 5 is_stmt 1 view .LVU378
+	.loc 1 100 13 view .LVU379
+	.loc 1 100 13 is_stmt 0 view .LVU380
+.LBE128:
+.LBE131:
+	.loc 1 145 5 is_stmt 1 view .LVU381
+	.loc 1 145 5 is_stmt 0 view .LVU382
+.LBE134:
+.LBE137:
+	.loc 1 221 5 is_stmt 1 view .LVU383
+	.loc 1 221 8 is_stmt 0 view .LVU384
+	cmpw	$-1, (%rdx,%rax)
+	je	.L44
+	.loc 1 225 5 is_stmt 1 view .LVU385
+.LVL97:
+.LBB138:
+.LBI138:
+	.loc 1 151 9 view .LVU386
+.LBB139:
+	.loc 1 153 5 view .LVU387
+.LBB140:
+.LBI140:
+	.loc 1 91 10 view .LVU388
+.LBB141:
+	.loc 1 93 5 view .LVU389
+	.loc 1 96 5 view .LVU390
+	.loc 1 102 13 view .LVU391
+	.loc 1 102 13 is_stmt 0 view .LVU392
+.LBE141:
+.LBE140:
+	.loc 1 154 5 is_stmt 1 view .LVU393
+	.loc 1 154 27 is_stmt 0 view .LVU394
+	movzwl	14(%rdx,%rax), %r12d
+.LVL98:
+	.loc 1 154 27 view .LVU395
+.LBE139:
+.LBE138:
+	.loc 1 227 5 is_stmt 1 view .LVU396
+	movl	%ebx, %esi
+.LVL99:
+	.loc 1 227 5 is_stmt 0 view .LVU397
+	xorl	%edx, %edx
+.LVL100:
+	.loc 1 227 5 view .LVU398
+	movl	%r14d, %edi
+	.loc 1 227 5 view .LVU399
+	movzbl	%r12b, %ebp
+	movl	%ebp, %ecx
+	call	_check_function
+.LVL101:
+	.loc 1 229 5 is_stmt 1 view .LVU400
+	.loc 1 229 8 is_stmt 0 view .LVU401
+	andl	$128, %r12d
+.LVL102:
+	.loc 1 229 8 view .LVU402
+	je	.L44
+	movl	$1, %r12d
+.LVL103:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 232 13 is_stmt 1 view .LVU403
+.LBB142:
+.LBI142:
+	.loc 1 142 10 view .LVU404
+.LBB143:
+	.loc 1 144 5 view .LVU405
+.LBB144:
+.LBI144:
+	.loc 1 91 10 view .LVU406
+.LBB145:
+	.loc 1 93 5 view .LVU407
+	.loc 1 93 25 is_stmt 0 view .LVU408
+	movq	mcfg(%rip), %rdx
+.LVL104:
+	.loc 1 96 5 is_stmt 1 view .LVU409
+	.loc 1 100 13 view .LVU410
+	.loc 1 100 13 is_stmt 0 view .LVU411
+.LBE145:
+.LBE144:
+	.loc 1 145 5 is_stmt 1 view .LVU412
+.LBB147:
+.LBB146:
+	.loc 1 94 15 is_stmt 0 view .LVU413
+	movl	%r14d, %eax
+	.loc 1 94 21 view .LVU414
+	movzbl	54(%rdx), %ecx
+	.loc 1 94 15 view .LVU415
+	subl	%ecx, %eax
+	.loc 1 94 62 view .LVU416
+	movl	%r12d, %ecx
+	.loc 1 94 30 view .LVU417
+	sall	$20, %eax
+	.loc 1 94 62 view .LVU418
+	sall	$12, %ecx
+	.loc 1 94 36 view .LVU419
+	orl	%r13d, %eax
+	.loc 1 94 51 view .LVU420
+	orl	%ecx, %eax
+	cltq
+	.loc 1 100 20 view .LVU421
+	addq	44(%rdx), %rax
+	addq	vmm_higher_half_offset(%rip), %rax
+.LBE146:
+.LBE147:
+.LBE143:
+.LBE142:
+	.loc 1 232 16 view .LVU422
+	cmpw	$-1, (%rax)
+	je	.L46
+	.loc 1 233 17 is_stmt 1 view .LVU423
+	movl	%ebp, %ecx
+	movl	%r12d, %edx
+	movl	%ebx, %esi
+	movl	%r14d, %edi
+	call	_check_function
+.LVL105:
+.L46:
+	.loc 1 231 50 discriminator 2 view .LVU424
+	.loc 1 231 37 discriminator 2 view .LVU425
+	addl	$1, %r12d
+.LVL106:
+	.loc 1 231 37 is_stmt 0 discriminator 2 view .LVU426
+	cmpl	$8, %r12d
+	jne	.L47
+.LVL107:
+.L44:
+	.loc 1 237 1 view .LVU427
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 40
+.LVL108:
+	.loc 1 237 1 view .LVU428
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 8
+.LVL109:
+	.loc 1 237 1 view .LVU429
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	_check_device, .-_check_device
+	.p2align 4
+	.globl	_scan_all_buses
+	.type	_scan_all_buses, @function
+_scan_all_buses:
+.LFB11:
+	.loc 1 243 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 244 5 view .LVU431
+.LBB150:
+	.loc 1 244 10 view .LVU432
+.LVL110:
+	.loc 1 244 32 view .LVU433
+.LBE150:
+	.loc 1 243 1 is_stmt 0 view .LVU434
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB153:
+.LBB151:
+	.loc 1 246 13 view .LVU435
+	xorl	%ebp, %ebp
+.LBE151:
+.LBE153:
+	.loc 1 243 1 view .LVU436
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LVL111:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+.LBB154:
+.LBB152:
+	.loc 1 245 41 is_stmt 1 view .LVU437
+	.loc 1 246 13 is_stmt 0 view .LVU438
+	xorl	%ebx, %ebx
+.LVL112:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 246 13 is_stmt 1 discriminator 3 view .LVU439
+	movl	%ebx, %esi
+	movl	%ebp, %edi
+	.loc 1 245 41 is_stmt 0 discriminator 3 view .LVU440
+	addl	$1, %ebx
+.LVL113:
+	.loc 1 246 13 discriminator 3 view .LVU441
+	call	_check_device
+.LVL114:
+	.loc 1 245 53 is_stmt 1 discriminator 3 view .LVU442
+	.loc 1 245 41 discriminator 3 view .LVU443
+	cmpl	$32, %ebx
+	jne	.L55
+.LBE152:
+	.loc 1 244 42 discriminator 2 view .LVU444
+.LVL115:
+	.loc 1 244 32 discriminator 2 view .LVU445
+	addl	$1, %ebp
+.LVL116:
+	.loc 1 244 32 is_stmt 0 discriminator 2 view .LVU446
+	cmpl	$256, %ebp
+	jne	.L54
+.LBE154:
+	.loc 1 249 1 view .LVU447
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	_scan_all_buses, .-_scan_all_buses
+	.section	.rodata.str1.1
+.LC10:
+	.string	"pci_device"
+.LC11:
+	.string	"PCI: Found %d PCI devices.\n"
+.LC12:
+	.string	"PCI: Initialized.\n"
+	.text
+	.p2align 4
+	.globl	pci_init
+	.type	pci_init, @function
+pci_init:
+.LFB12:
+	.loc 1 252 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 253 5 view .LVU449
+	.loc 1 252 1 is_stmt 0 view .LVU450
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 253 24 view .LVU451
+	xorl	%ecx, %ecx
+	movl	$64, %edx
+	movl	$32, %esi
+	.loc 1 252 1 view .LVU452
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 253 24 view .LVU453
+	leaq	.LC10(%rip), %rdi
+	.loc 1 253 22 view .LVU454
+	xorl	%ebp, %ebp
+	.loc 1 252 1 view .LVU455
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 253 24 view .LVU456
+	call	kmem_cache_create@PLT
+.LVL117:
+	.loc 1 253 22 view .LVU457
+	movq	%rax, pci_device_cache(%rip)
+	.loc 1 254 5 is_stmt 1 view .LVU458
+.LBB159:
+.LBI159:
+	.loc 1 242 6 view .LVU459
+.LVL118:
+.LBB160:
+	.loc 1 244 32 view .LVU460
+	.p2align 4,,10
+	.p2align 3
+.L60:
+.LBB161:
+	.loc 1 245 41 view .LVU461
+	.loc 1 246 13 is_stmt 0 view .LVU462
+	xorl	%ebx, %ebx
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.loc 1 246 13 is_stmt 1 view .LVU463
+	movl	%ebx, %esi
+	movl	%ebp, %edi
+	.loc 1 245 41 is_stmt 0 view .LVU464
+	addl	$1, %ebx
+.LVL120:
+	.loc 1 246 13 view .LVU465
+	call	_check_device
+.LVL121:
+	.loc 1 245 53 is_stmt 1 view .LVU466
+	.loc 1 245 41 view .LVU467
+	cmpl	$32, %ebx
+	jne	.L61
+.LBE161:
+	.loc 1 244 42 view .LVU468
+.LVL122:
+	.loc 1 244 32 view .LVU469
+	addl	$1, %ebp
+.LVL123:
+	.loc 1 244 32 is_stmt 0 view .LVU470
+	cmpl	$256, %ebp
+	jne	.L60
+.LVL124:
+	.loc 1 244 32 view .LVU471
+.LBE160:
+.LBE159:
+	.loc 1 255 5 is_stmt 1 view .LVU472
+	movzbl	pci_device_cnt(%rip), %esi
+	leaq	.LC11(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL125:
+	.loc 1 256 5 view .LVU473
+	.loc 1 257 1 is_stmt 0 view .LVU474
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 256 5 view .LVU475
+	leaq	.LC12(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 257 1 view .LVU476
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	.loc 1 256 5 view .LVU477
+	jmp	kprintf@PLT
+.LVL126:
+	.cfi_endproc
+.LFE12:
+	.size	pci_init, .-pci_init
+	.p2align 4
+	.globl	pci_find_device
+	.type	pci_find_device, @function
+pci_find_device:
+.LVL127:
+.LFB13:
+	.loc 1 263 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 264 5 view .LVU479
+.LBB162:
+	.loc 1 264 10 view .LVU480
+	.loc 1 264 23 view .LVU481
+	movzbl	pci_device_cnt(%rip), %edx
+	testb	%dl, %dl
+	je	.L69
+	leaq	pci_devices(%rip), %rax
+	leal	-1(%rdx), %ecx
+	leaq	8(%rax), %rdx
+	leaq	(%rdx,%rcx,8), %rcx
+	jmp	.L68
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.loc 1 264 42 discriminator 2 view .LVU482
+	.loc 1 264 23 discriminator 2 view .LVU483
+	addq	$8, %rax
+.LVL129:
+	.loc 1 264 23 is_stmt 0 discriminator 2 view .LVU484
+	cmpq	%rcx, %rax
+	je	.L69
+.LVL130:
+.L68:
+.LBB163:
+	.loc 1 265 9 is_stmt 1 view .LVU485
+	.loc 1 265 28 is_stmt 0 view .LVU486
+	movq	(%rax), %rdx
+.LVL131:
+	.loc 1 266 9 is_stmt 1 view .LVU487
+	.loc 1 266 12 is_stmt 0 view .LVU488
+	cmpb	%dil, (%rdx)
+	jne	.L67
+	.loc 1 266 38 discriminator 1 view .LVU489
+	cmpb	%sil, 1(%rdx)
+	jne	.L67
+.LBE163:
+.LBE162:
+	.loc 1 272 1 view .LVU490
+	movq	%rdx, %rax
+.LVL132:
+	.loc 1 272 1 view .LVU491
+	ret
+.LVL133:
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.loc 1 271 11 view .LVU492
+	xorl	%edx, %edx
+	.loc 1 272 1 view .LVU493
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	pci_find_device, .-pci_find_device
+	.local	pci_device_cache
+	.comm	pci_device_cache,8,8
+	.globl	pci_device_cnt
+	.bss
+	.type	pci_device_cnt, @object
+	.size	pci_device_cnt, 1
+pci_device_cnt:
+	.zero	1
+	.globl	pci_devices
+	.align 32
+	.type	pci_devices, @object
+	.size	pci_devices, 256
+pci_devices:
+	.zero	256
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 3 "src/include/pci.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "src/include/acpi.h"
+	.file 6 "src/include/mem.h"
+	.file 7 "src/include/slab.h"
+	.file 8 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x12de
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x29
+	.long	.LASF74
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x12
+	.long	.LASF6
+	.byte	0x2
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x12
+	.long	.LASF7
+	.byte	0x2
+	.byte	0x31
+	.byte	0x1c
+	.long	0x69
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x12
+	.long	.LASF9
+	.byte	0x2
+	.byte	0x34
+	.byte	0x16
+	.long	0x7c
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x12
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x37
+	.byte	0x1b
+	.long	0x8f
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x1b
+	.long	.LASF27
+	.byte	0x20
+	.byte	0x3
+	.byte	0x1f
+	.long	0x117
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x20
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x21
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x1e
+	.string	"bus"
+	.byte	0x3
+	.byte	0x22
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x23
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x24
+	.byte	0xd
+	.long	0x4a
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x25
+	.byte	0xd
+	.long	0x4a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x3
+	.byte	0x26
+	.byte	0x11
+	.long	0x117
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x3
+	.byte	0x27
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x3
+	.byte	0x28
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.byte	0
+	.uleb128 0x13
+	.long	0x123
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF21
+	.uleb128 0x2b
+	.long	0x11c
+	.uleb128 0x14
+	.long	0x133
+	.long	0x133
+	.uleb128 0x2c
+	.byte	0
+	.uleb128 0x13
+	.long	0x96
+	.uleb128 0x16
+	.long	.LASF22
+	.byte	0x3
+	.byte	0x2b
+	.byte	0x1b
+	.long	0x128
+	.uleb128 0x16
+	.long	.LASF23
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x10
+	.long	0x4a
+	.uleb128 0x12
+	.long	.LASF24
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x8f
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF25
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF26
+	.uleb128 0x2d
+	.byte	0x8
+	.uleb128 0x1b
+	.long	.LASF28
+	.byte	0x24
+	.byte	0x5
+	.byte	0x2f
+	.long	0x1ee
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x30
+	.byte	0xa
+	.long	0x1ee
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x31
+	.byte	0xe
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x5
+	.byte	0x32
+	.byte	0xd
+	.long	0x4a
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x5
+	.byte	0x33
+	.byte	0xd
+	.long	0x4a
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x34
+	.byte	0xa
+	.long	0x1fe
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x35
+	.byte	0xa
+	.long	0x20e
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x36
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x37
+	.byte	0xe
+	.long	0x70
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x38
+	.byte	0xe
+	.long	0x70
+	.byte	0x20
+	.byte	0
+	.uleb128 0x14
+	.long	0x11c
+	.long	0x1fe
+	.uleb128 0x17
+	.long	0x8f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x14
+	.long	0x11c
+	.long	0x20e
+	.uleb128 0x17
+	.long	0x8f
+	.byte	0x5
+	.byte	0
+	.uleb128 0x14
+	.long	0x11c
+	.long	0x21e
+	.uleb128 0x17
+	.long	0x8f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF38
+	.byte	0x3c
+	.byte	0x5
+	.byte	0x55
+	.long	0x285
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x56
+	.byte	0x14
+	.long	0x16c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x57
+	.byte	0xa
+	.long	0x20e
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x58
+	.byte	0xe
+	.long	0x83
+	.byte	0x2c
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x59
+	.byte	0xe
+	.long	0x5d
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x5a
+	.byte	0xd
+	.long	0x4a
+	.byte	0x36
+	.uleb128 0x1e
+	.string	"end"
+	.byte	0x5
+	.byte	0x5b
+	.long	0x4a
+	.byte	0x37
+	.uleb128 0x3
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x5c
+	.byte	0xe
+	.long	0x70
+	.byte	0x38
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x9d
+	.byte	0x1b
+	.long	0x291
+	.uleb128 0x13
+	.long	0x21e
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF46
+	.uleb128 0x16
+	.long	.LASF47
+	.byte	0x6
+	.byte	0xb2
+	.byte	0x11
+	.long	0x83
+	.uleb128 0x14
+	.long	0x133
+	.long	0x2b9
+	.uleb128 0x17
+	.long	0x8f
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x2e
+	.long	0x138
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x14
+	.long	0x2a9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pci_devices
+	.uleb128 0x2f
+	.long	0x144
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pci_device_cnt
+	.uleb128 0x30
+	.long	.LASF75
+	.uleb128 0x31
+	.long	.LASF76
+	.byte	0x1
+	.byte	0x1d
+	.byte	0x1a
+	.long	0x2fc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pci_device_cache
+	.uleb128 0x13
+	.long	0x2e1
+	.uleb128 0x1f
+	.long	.LASF48
+	.byte	0x36
+	.byte	0x13
+	.long	0x2fc
+	.long	0x325
+	.uleb128 0xc
+	.long	0x117
+	.uleb128 0xc
+	.long	0x150
+	.uleb128 0xc
+	.long	0x150
+	.uleb128 0xc
+	.long	0x325
+	.byte	0
+	.uleb128 0x13
+	.long	0x32a
+	.uleb128 0x32
+	.long	0x335
+	.uleb128 0xc
+	.long	0x16a
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF49
+	.byte	0x37
+	.byte	0x7
+	.long	0x16a
+	.long	0x34a
+	.uleb128 0xc
+	.long	0x2fc
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF77
+	.byte	0x8
+	.byte	0x30
+	.byte	0x6
+	.long	0x35d
+	.uleb128 0xc
+	.long	0x117
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF70
+	.byte	0x1
+	.value	0x106
+	.byte	0x14
+	.long	0x133
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3e3
+	.uleb128 0x20
+	.long	.LASF50
+	.byte	0x2c
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x20
+	.long	.LASF51
+	.byte	0x3b
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x21
+	.quad	.LBB162
+	.quad	.LBE162-.LBB162
+	.uleb128 0x22
+	.string	"i"
+	.value	0x108
+	.byte	0xe
+	.long	0x3c
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x21
+	.quad	.LBB163
+	.quad	.LBE163-.LBB163
+	.uleb128 0x22
+	.string	"dev"
+	.value	0x109
+	.byte	0x1c
+	.long	0x133
+	.long	.LLST136
+	.long	.LVUS136
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF78
+	.byte	0x1
+	.byte	0xfb
+	.byte	0x6
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f2
+	.uleb128 0x1c
+	.long	0x4f2
+	.quad	.LBI159
+	.byte	.LVU459
+	.quad	.LBB159
+	.quad	.LBE159-.LBB159
+	.byte	0xfe
+	.byte	0x5
+	.long	0x486
+	.uleb128 0x23
+	.long	0x4ff
+	.quad	.LBB160
+	.quad	.LBE160-.LBB160
+	.uleb128 0x4
+	.long	0x500
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x23
+	.long	0x50c
+	.quad	.LBB161
+	.quad	.LBE161-.LBB161
+	.uleb128 0x4
+	.long	0x50d
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x18
+	.quad	.LVL121
+	.long	0x535
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL117
+	.long	0x301
+	.long	0x4b7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL125
+	.long	0x34a
+	.long	0x4d6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL126
+	.long	0x34a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF79
+	.byte	0x1
+	.byte	0xf2
+	.byte	0x6
+	.byte	0x1
+	.long	0x535
+	.uleb128 0x25
+	.uleb128 0x38
+	.string	"bus"
+	.byte	0x1
+	.byte	0xf4
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x25
+	.uleb128 0x9
+	.long	.LASF15
+	.byte	0xf5
+	.byte	0x16
+	.long	0x4a
+	.uleb128 0x18
+	.quad	.LVL114
+	.long	0x535
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF54
+	.byte	0xd8
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x837
+	.uleb128 0x15
+	.string	"bus"
+	.byte	0xd8
+	.byte	0x1c
+	.long	0x4a
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0xe
+	.long	.LASF15
+	.byte	0xd8
+	.byte	0x29
+	.long	0x4a
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xd
+	.long	.LASF16
+	.byte	0xda
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0xd
+	.long	.LASF52
+	.byte	0xdc
+	.byte	0xe
+	.long	0x5d
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0xd
+	.long	.LASF53
+	.byte	0xe1
+	.byte	0xe
+	.long	0x5d
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x19
+	.long	0xbce
+	.quad	.LBI122
+	.byte	.LVU363
+	.long	.LLRL99
+	.byte	0xdc
+	.byte	0x19
+	.long	0x66c
+	.uleb128 0x1
+	.long	0xbf3
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x1
+	.long	0xbe8
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x1
+	.long	0xbdd
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x7
+	.long	.LLRL99
+	.uleb128 0x4
+	.long	0xbfe
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI124
+	.byte	.LVU365
+	.long	.LLRL99
+	.byte	0x90
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x7
+	.long	.LLRL99
+	.uleb128 0x4
+	.long	0xd78
+	.long	.LLST109
+	.long	.LVUS109
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0xb92
+	.quad	.LBI138
+	.byte	.LVU386
+	.quad	.LBB138
+	.quad	.LBE138-.LBB138
+	.byte	0xe1
+	.byte	0x1b
+	.long	0x735
+	.uleb128 0x1
+	.long	0xbb7
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1
+	.long	0xbac
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x1
+	.long	0xba1
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x4
+	.long	0xbc2
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x39
+	.long	0xd32
+	.quad	.LBI140
+	.byte	.LVU388
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.byte	0x1
+	.byte	0x99
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x4
+	.long	0xd78
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0xbce
+	.quad	.LBI142
+	.byte	.LVU404
+	.quad	.LBB142
+	.quad	.LBE142-.LBB142
+	.byte	0xe8
+	.byte	0x11
+	.long	0x7e7
+	.uleb128 0x1
+	.long	0xbf3
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x1
+	.long	0xbe8
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1
+	.long	0xbdd
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x5
+	.long	0xbfe
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI144
+	.byte	.LVU406
+	.long	.LLRL123
+	.byte	0x90
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x7
+	.long	.LLRL123
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL101
+	.long	0x837
+	.long	0x810
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL105
+	.long	0x837
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF55
+	.byte	0xbf
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xabd
+	.uleb128 0x15
+	.string	"bus"
+	.byte	0xbf
+	.byte	0x1e
+	.long	0x4a
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xe
+	.long	.LASF15
+	.byte	0xbf
+	.byte	0x2b
+	.long	0x4a
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0xe
+	.long	.LASF16
+	.byte	0xbf
+	.byte	0x3b
+	.long	0x4a
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0xbf
+	.byte	0x4e
+	.long	0x5d
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xd
+	.long	.LASF56
+	.byte	0xc1
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xd
+	.long	.LASF51
+	.byte	0xc2
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xd
+	.long	.LASF57
+	.byte	0xc3
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x3a
+	.string	"dev"
+	.byte	0x1
+	.byte	0xc6
+	.byte	0x18
+	.long	0x133
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x19
+	.long	0xb4b
+	.quad	.LBI66
+	.byte	.LVU267
+	.long	.LLRL70
+	.byte	0xc1
+	.byte	0x19
+	.long	0x9ad
+	.uleb128 0x1
+	.long	0xb70
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x1
+	.long	0xb65
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x1
+	.long	0xb5a
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x7
+	.long	.LLRL70
+	.uleb128 0x4
+	.long	0xb7b
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x4
+	.long	0xb86
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI68
+	.byte	.LVU269
+	.long	.LLRL76
+	.byte	0xa2
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x7
+	.long	.LLRL76
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0xb04
+	.quad	.LBI90
+	.byte	.LVU295
+	.long	.LLRL82
+	.byte	0xc2
+	.byte	0x18
+	.long	0xa0d
+	.uleb128 0x1
+	.long	0xb29
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x1
+	.long	0xb1e
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x1
+	.long	0xb13
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x7
+	.long	.LLRL82
+	.uleb128 0x4
+	.long	0xb34
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x4
+	.long	0xb3f
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0xabd
+	.quad	.LBI100
+	.byte	.LVU301
+	.long	.LLRL88
+	.byte	0xc3
+	.byte	0x16
+	.long	0xa6d
+	.uleb128 0x1
+	.long	0xae2
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x1
+	.long	0xad7
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x1
+	.long	0xacc
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x7
+	.long	.LLRL88
+	.uleb128 0x4
+	.long	0xaed
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x4
+	.long	0xaf8
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.quad	.LVL87
+	.long	0x335
+	.uleb128 0xa
+	.quad	.LVL90
+	.long	0xd84
+	.long	0xaa1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL93
+	.long	0x34a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF58
+	.byte	0xb5
+	.byte	0x9
+	.long	0x4a
+	.long	0xb04
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0xb5
+	.byte	0x26
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0xb5
+	.byte	0x33
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0xb5
+	.byte	0x43
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF59
+	.byte	0xb7
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x9
+	.long	.LASF57
+	.byte	0xb8
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF60
+	.byte	0xab
+	.byte	0x9
+	.long	0x4a
+	.long	0xb4b
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0xab
+	.byte	0x2c
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0xab
+	.byte	0x39
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0xab
+	.byte	0x49
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF59
+	.byte	0xad
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x9
+	.long	.LASF51
+	.byte	0xae
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF61
+	.byte	0xa0
+	.byte	0x9
+	.long	0x4a
+	.long	0xb92
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0xa0
+	.byte	0x29
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0xa0
+	.byte	0x36
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0xa0
+	.byte	0x46
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF59
+	.byte	0xa2
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x9
+	.long	.LASF56
+	.byte	0xa3
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF62
+	.byte	0x97
+	.byte	0x9
+	.long	0x4a
+	.long	0xbce
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0x97
+	.byte	0x2a
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x97
+	.byte	0x37
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x97
+	.byte	0x47
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF63
+	.byte	0x99
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF64
+	.byte	0x8e
+	.byte	0xa
+	.long	0x5d
+	.long	0xc0a
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0x8e
+	.byte	0x29
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x8e
+	.byte	0x36
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x8e
+	.byte	0x46
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF65
+	.byte	0x90
+	.byte	0xe
+	.long	0x5d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF66
+	.byte	0x79
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc7a
+	.uleb128 0x15
+	.string	"dev"
+	.byte	0x79
+	.byte	0x2a
+	.long	0x133
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1a
+	.long	.LASF67
+	.byte	0x79
+	.byte	0x38
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1a
+	.long	.LASF68
+	.byte	0x79
+	.byte	0x48
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x15
+	.string	"val"
+	.byte	0x79
+	.byte	0x57
+	.long	0x70
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xd
+	.long	.LASF69
+	.byte	0x7b
+	.byte	0xe
+	.long	0x83
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF71
+	.byte	0x70
+	.byte	0xa
+	.long	0x70
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd32
+	.uleb128 0x15
+	.string	"dev"
+	.byte	0x70
+	.byte	0x2d
+	.long	0x133
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1a
+	.long	.LASF67
+	.byte	0x70
+	.byte	0x3b
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1a
+	.long	.LASF68
+	.byte	0x70
+	.byte	0x4b
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI16
+	.byte	.LVU80
+	.long	.LLRL7
+	.byte	0x72
+	.byte	0xc
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x7
+	.long	.LLRL7
+	.uleb128 0x4
+	.long	0xd78
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF72
+	.byte	0x5b
+	.byte	0xa
+	.long	0x70
+	.long	0xd84
+	.uleb128 0x10
+	.string	"bus"
+	.byte	0x5b
+	.byte	0x1f
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x5b
+	.byte	0x2c
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x5b
+	.byte	0x3c
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0x5b
+	.byte	0x4f
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF68
+	.byte	0x5b
+	.byte	0x5f
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF69
+	.byte	0x5d
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF73
+	.byte	0x22
+	.byte	0xd
+	.long	0x117
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xee1
+	.uleb128 0xe
+	.long	.LASF13
+	.byte	0x22
+	.byte	0x25
+	.long	0x4a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xe
+	.long	.LASF14
+	.byte	0x22
+	.byte	0x39
+	.long	0x4a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xa
+	.quad	.LVL3
+	.long	0x34a
+	.long	0xdfe
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL7
+	.long	0x34a
+	.long	0xe2c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL11
+	.long	0x34a
+	.long	0xe5a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL15
+	.long	0x34a
+	.long	0xe88
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL19
+	.long	0x34a
+	.long	0xeb6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL23
+	.long	0x34a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xd32
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf3f
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x27
+	.long	0xd62
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x27
+	.long	0xd6d
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.long	0xd78
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x11
+	.long	0xbce
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfe8
+	.uleb128 0x1
+	.long	0xbdd
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1
+	.long	0xbe8
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0xbf3
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x5
+	.long	0xbfe
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI30
+	.byte	.LVU145
+	.long	.LLRL20
+	.byte	0x90
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x7
+	.long	.LLRL20
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xb92
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1091
+	.uleb128 0x1
+	.long	0xba1
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1
+	.long	0xbac
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1
+	.long	0xbb7
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x5
+	.long	0xbc2
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI36
+	.byte	.LVU167
+	.long	.LLRL29
+	.byte	0x99
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x7
+	.long	.LLRL29
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xb4b
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x113f
+	.uleb128 0x1
+	.long	0xb5a
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x1
+	.long	0xb65
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1
+	.long	0xb70
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x5
+	.long	0xb7b
+	.uleb128 0x5
+	.long	0xb86
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI42
+	.byte	.LVU189
+	.long	.LLRL38
+	.byte	0xa2
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x7
+	.long	.LLRL38
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xb04
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11ed
+	.uleb128 0x1
+	.long	0xb13
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x1
+	.long	0xb1e
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x1
+	.long	0xb29
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x5
+	.long	0xb34
+	.uleb128 0x5
+	.long	0xb3f
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI48
+	.byte	.LVU212
+	.long	.LLRL47
+	.byte	0xad
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x7
+	.long	.LLRL47
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xabd
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x129b
+	.uleb128 0x1
+	.long	0xacc
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x1
+	.long	0xad7
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x1
+	.long	0xae2
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x5
+	.long	0xaed
+	.uleb128 0x5
+	.long	0xaf8
+	.uleb128 0xb
+	.long	0xd32
+	.quad	.LBI54
+	.byte	.LVU235
+	.long	.LLRL56
+	.byte	0xb7
+	.byte	0x15
+	.uleb128 0x1
+	.long	0xd6d
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x1
+	.long	0xd62
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x1
+	.long	0xd57
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1
+	.long	0xd4c
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1
+	.long	0xd41
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x7
+	.long	.LLRL56
+	.uleb128 0x5
+	.long	0xd78
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	0x4f2
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x28
+	.long	0x4ff
+	.long	.LLRL129
+	.uleb128 0x4
+	.long	0x500
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x28
+	.long	0x50c
+	.long	.LLRL131
+	.uleb128 0x4
+	.long	0x50d
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 262
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS135:
+	.uleb128 .LVU481
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU491
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	pci_devices
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	pci_devices
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	pci_devices+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	pci_devices
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU482
+	.uleb128 .LVU485
+	.uleb128 .LVU487
+	.uleb128 .LVU492
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU460
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU470
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU461
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU465
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU429
+	.uleb128 .LVU429
+	.uleb128 0
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL101-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU428
+	.uleb128 .LVU428
+	.uleb128 0
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU358
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU425
+	.uleb128 .LVU425
+	.uleb128 .LVU426
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU382
+	.uleb128 .LVU398
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU395
+	.uleb128 .LVU402
+	.uleb128 .LVU402
+	.uleb128 .LVU427
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU363
+	.uleb128 .LVU382
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU363
+	.uleb128 .LVU382
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU363
+	.uleb128 .LVU382
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU380
+	.uleb128 .LVU382
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU365
+	.uleb128 .LVU380
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU365
+	.uleb128 .LVU380
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU365
+	.uleb128 .LVU380
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU365
+	.uleb128 .LVU380
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU378
+	.uleb128 .LVU380
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU386
+	.uleb128 .LVU395
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU386
+	.uleb128 .LVU395
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU386
+	.uleb128 .LVU395
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU392
+	.uleb128 .LVU395
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xc
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU390
+	.uleb128 .LVU392
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xc
+	.byte	0x9f
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU404
+	.uleb128 .LVU413
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU404
+	.uleb128 .LVU413
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU404
+	.uleb128 .LVU413
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU406
+	.uleb128 .LVU411
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU406
+	.uleb128 .LVU411
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU406
+	.uleb128 .LVU411
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU406
+	.uleb128 .LVU411
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU406
+	.uleb128 .LVU411
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 0
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 0
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU293
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU299
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU305
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -75
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU311
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU354
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU267
+	.uleb128 .LVU293
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU267
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU293
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU267
+	.uleb128 .LVU293
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU285
+	.uleb128 .LVU293
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU292
+	.uleb128 .LVU293
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU269
+	.uleb128 .LVU285
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU269
+	.uleb128 .LVU285
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU269
+	.uleb128 .LVU285
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU269
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU285
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU269
+	.uleb128 .LVU285
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU295
+	.uleb128 .LVU299
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU295
+	.uleb128 .LVU299
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU295
+	.uleb128 .LVU299
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU298
+	.uleb128 .LVU299
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU303
+	.uleb128 .LVU305
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU304
+	.uleb128 .LVU305
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -75
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU131
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU80
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU80
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 3
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU80
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 2
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU97
+	.uleb128 .LVU99
+	.uleb128 .LVU100
+	.uleb128 .LVU103
+	.uleb128 .LVU104
+	.uleb128 .LVU107
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL3-1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL7-1-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL23-1-.Ltext0
+	.uleb128 .LFE0-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LFE1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU167
+	.uleb128 .LVU172
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU167
+	.uleb128 .LVU172
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU167
+	.uleb128 .LVU172
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU167
+	.uleb128 .LVU172
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU167
+	.uleb128 .LVU172
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE6-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LFE7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LFE7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LFE7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU212
+	.uleb128 .LVU217
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU212
+	.uleb128 .LVU217
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU212
+	.uleb128 .LVU217
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU212
+	.uleb128 .LVU217
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU212
+	.uleb128 .LVU217
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU235
+	.uleb128 .LVU240
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU433
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU445
+	.uleb128 .LVU445
+	.uleb128 .LVU446
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU441
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB16-.Ltext0
+	.uleb128 .LBE16-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB27-.Ltext0
+	.uleb128 .LBE27-.Ltext0
+	.byte	0
+.LLRL20:
+	.byte	0x4
+	.uleb128 .LBB30-.Ltext0
+	.uleb128 .LBE30-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0
+.LLRL29:
+	.byte	0x4
+	.uleb128 .LBB36-.Ltext0
+	.uleb128 .LBE36-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB45-.Ltext0
+	.uleb128 .LBE45-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB57-.Ltext0
+	.uleb128 .LBE57-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB76-.Ltext0
+	.uleb128 .LBE76-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB77-.Ltext0
+	.uleb128 .LBE77-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB99-.Ltext0
+	.uleb128 .LBE99-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0
+.LLRL123:
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB147-.Ltext0
+	.uleb128 .LBE147-.Ltext0
+	.byte	0
+.LLRL129:
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0
+.LLRL131:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF18:
+	.string	"description"
+.LASF75:
+	.string	"SlabCache"
+.LASF51:
+	.string	"subclass"
+.LASF24:
+	.string	"size_t"
+.LASF66:
+	.string	"pci_device_write"
+.LASF32:
+	.string	"checksum"
+.LASF11:
+	.string	"uint64_t"
+.LASF31:
+	.string	"revision"
+.LASF54:
+	.string	"_check_device"
+.LASF69:
+	.string	"addr"
+.LASF41:
+	.string	"mmio_base"
+.LASF70:
+	.string	"pci_find_device"
+.LASF15:
+	.string	"device"
+.LASF25:
+	.string	"long long int"
+.LASF2:
+	.string	"signed char"
+.LASF57:
+	.string	"progif"
+.LASF16:
+	.string	"function"
+.LASF49:
+	.string	"kmem_cache_alloc"
+.LASF4:
+	.string	"long int"
+.LASF45:
+	.string	"mcfg"
+.LASF48:
+	.string	"kmem_cache_create"
+.LASF7:
+	.string	"uint16_t"
+.LASF72:
+	.string	"_pci_mm_read"
+.LASF52:
+	.string	"vendorID"
+.LASF53:
+	.string	"headerType"
+.LASF42:
+	.string	"segment"
+.LASF61:
+	.string	"_pci_mm_read_class_code"
+.LASF29:
+	.string	"signature"
+.LASF74:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF37:
+	.string	"creator_revision"
+.LASF10:
+	.string	"unsigned int"
+.LASF35:
+	.string	"oem_revision"
+.LASF12:
+	.string	"long unsigned int"
+.LASF36:
+	.string	"creator_id"
+.LASF68:
+	.string	"size"
+.LASF8:
+	.string	"short unsigned int"
+.LASF47:
+	.string	"vmm_higher_half_offset"
+.LASF23:
+	.string	"pci_device_cnt"
+.LASF60:
+	.string	"_pci_mm_read_subclass_code"
+.LASF26:
+	.string	"long double"
+.LASF71:
+	.string	"pci_device_read"
+.LASF19:
+	.string	"address"
+.LASF33:
+	.string	"oem_id"
+.LASF39:
+	.string	"desc"
+.LASF56:
+	.string	"classcode"
+.LASF50:
+	.string	"class"
+.LASF65:
+	.string	"reg0"
+.LASF59:
+	.string	"reg2"
+.LASF63:
+	.string	"reg3"
+.LASF17:
+	.string	"prog_if"
+.LASF46:
+	.string	"_Bool"
+.LASF5:
+	.string	"unsigned char"
+.LASF3:
+	.string	"short int"
+.LASF14:
+	.string	"sub_class_code"
+.LASF28:
+	.string	"sysdesc"
+.LASF62:
+	.string	"_pci_mm_read_header_type"
+.LASF79:
+	.string	"_scan_all_buses"
+.LASF9:
+	.string	"uint32_t"
+.LASF30:
+	.string	"length"
+.LASF22:
+	.string	"pci_devices"
+.LASF21:
+	.string	"char"
+.LASF67:
+	.string	"offset"
+.LASF76:
+	.string	"pci_device_cache"
+.LASF27:
+	.string	"pci_device"
+.LASF34:
+	.string	"oem_table_id"
+.LASF38:
+	.string	"mcfg_entry"
+.LASF13:
+	.string	"class_code"
+.LASF55:
+	.string	"_check_function"
+.LASF58:
+	.string	"_pci_mm_read_prog_if"
+.LASF73:
+	.string	"_get_device_str"
+.LASF6:
+	.string	"uint8_t"
+.LASF77:
+	.string	"kprintf"
+.LASF64:
+	.string	"_pci_mm_read_vendor_id"
+.LASF40:
+	.string	"reserved1"
+.LASF44:
+	.string	"reserved2"
+.LASF20:
+	.string	"header_type"
+.LASF43:
+	.string	"start"
+.LASF78:
+	.string	"pci_init"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/pci.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,536 @@
+	.file	"pit.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/pit.c"
+	.p2align 4
+	.globl	pit_disable_timer
+	.type	pit_disable_timer, @function
+pit_disable_timer:
+.LFB30:
+	.file 1 "src/pit.c"
+	.loc 1 29 1 view -0
+	.cfi_startproc
+	.loc 1 30 5 view .LVU1
+.LVL0:
+.LBB8:
+.LBI8:
+	.file 2 "src/include/cpu.h"
+	.loc 2 86 20 view .LVU2
+.LBB9:
+	.loc 2 88 5 view .LVU3
+	movl	$48, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $67
+# 0 "" 2
+.LVL1:
+	.loc 2 88 5 is_stmt 0 view .LVU4
+#NO_APP
+.LBE9:
+.LBE8:
+	.loc 1 31 5 is_stmt 1 view .LVU5
+.LBB10:
+.LBI10:
+	.loc 2 86 20 view .LVU6
+.LBB11:
+	.loc 2 88 5 view .LVU7
+	xorl	%eax, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $64
+# 0 "" 2
+.LVL2:
+	.loc 2 88 5 is_stmt 0 view .LVU8
+#NO_APP
+.LBE11:
+.LBE10:
+	.loc 1 32 5 is_stmt 1 view .LVU9
+.LBB12:
+.LBI12:
+	.loc 2 86 20 view .LVU10
+.LBB13:
+	.loc 2 88 5 view .LVU11
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, $64
+# 0 "" 2
+.LVL3:
+	.loc 2 88 5 is_stmt 0 view .LVU12
+#NO_APP
+.LBE13:
+.LBE12:
+	.loc 1 33 1 view .LVU13
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	pit_disable_timer, .-pit_disable_timer
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x180
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.long	.LASF6
+	.byte	0x2e
+	.byte	0x17
+	.long	0x55
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.long	.LASF7
+	.byte	0x31
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x6
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x161
+	.uleb128 0x4
+	.long	0x161
+	.quad	.LBI8
+	.byte	.LVU2
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.byte	0x1e
+	.long	0xe6
+	.uleb128 0x2
+	.long	0x176
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2
+	.long	0x16a
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x4
+	.long	0x161
+	.quad	.LBI10
+	.byte	.LVU6
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.byte	0x1f
+	.long	0x124
+	.uleb128 0x2
+	.long	0x176
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x2
+	.long	0x16a
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x8
+	.long	0x161
+	.quad	.LBI12
+	.byte	.LVU10
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.byte	0x1
+	.byte	0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	0x176
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.long	0x16a
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x56
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0xa
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x56
+	.byte	0x22
+	.long	0x5c
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x30
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 .LVU2
+	.uleb128 .LVU4
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU2
+	.uleb128 .LVU4
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x43
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU6
+	.uleb128 .LVU8
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU6
+	.uleb128 .LVU8
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU10
+	.uleb128 .LVU12
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU10
+	.uleb128 .LVU12
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF5:
+	.string	"unsigned char"
+.LASF10:
+	.string	"long unsigned int"
+.LASF8:
+	.string	"short unsigned int"
+.LASF16:
+	.string	"outb"
+.LASF9:
+	.string	"unsigned int"
+.LASF6:
+	.string	"uint8_t"
+.LASF14:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF11:
+	.string	"long long int"
+.LASF13:
+	.string	"port"
+.LASF3:
+	.string	"short int"
+.LASF7:
+	.string	"uint16_t"
+.LASF4:
+	.string	"long int"
+.LASF15:
+	.string	"pit_disable_timer"
+.LASF12:
+	.string	"long double"
+.LASF2:
+	.string	"signed char"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/pit.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
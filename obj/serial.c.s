@@ -0,0 +1,2810 @@
+	.file	"serial.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/serial.c"
+	.p2align 4
+	.globl	init_serial
+	.type	init_serial, @function
+init_serial:
+.LVL0:
+.LFB30:
+	.file 1 "src/serial.c"
+	.loc 1 25 1 view -0
+	.cfi_startproc
+	.loc 1 26 5 view .LVU1
+	.loc 1 26 15 is_stmt 0 view .LVU2
+	leal	1(%rdi), %r10d
+.LVL1:
+.LBB41:
+.LBI41:
+	.file 2 "src/include/cpu.h"
+	.loc 2 86 20 is_stmt 1 view .LVU3
+.LBB42:
+	.loc 2 88 5 view .LVU4
+	xorl	%r9d, %r9d
+	movl	%r9d, %eax
+	movl	%r10d, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL2:
+	.loc 2 88 5 is_stmt 0 view .LVU5
+#NO_APP
+.LBE42:
+.LBE41:
+	.loc 1 27 5 is_stmt 1 view .LVU6
+	.loc 1 27 15 is_stmt 0 view .LVU7
+	leal	3(%rdi), %r8d
+.LVL3:
+.LBB43:
+.LBI43:
+	.loc 2 86 20 is_stmt 1 view .LVU8
+.LBB44:
+	.loc 2 88 5 view .LVU9
+	movl	$-128, %eax
+	movl	%r8d, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL4:
+	.loc 2 88 5 is_stmt 0 view .LVU10
+#NO_APP
+.LBE44:
+.LBE43:
+	.loc 1 28 5 is_stmt 1 view .LVU11
+.LBB45:
+.LBI45:
+	.loc 2 86 20 view .LVU12
+.LBB46:
+	.loc 2 88 5 view .LVU13
+	movl	$3, %ecx
+	movl	%edi, %edx
+	movl	%ecx, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL5:
+	.loc 2 88 5 is_stmt 0 view .LVU14
+#NO_APP
+.LBE46:
+.LBE45:
+	.loc 1 29 5 is_stmt 1 view .LVU15
+.LBB47:
+.LBI47:
+	.loc 2 86 20 view .LVU16
+.LBB48:
+	.loc 2 88 5 view .LVU17
+	movl	%r9d, %eax
+	movl	%r10d, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL6:
+	.loc 2 88 5 is_stmt 0 view .LVU18
+#NO_APP
+.LBE48:
+.LBE47:
+	.loc 1 30 5 is_stmt 1 view .LVU19
+.LBB49:
+.LBI49:
+	.loc 2 86 20 view .LVU20
+.LBB50:
+	.loc 2 88 5 view .LVU21
+	movl	%ecx, %eax
+	movl	%r8d, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL7:
+	.loc 2 88 5 is_stmt 0 view .LVU22
+#NO_APP
+.LBE50:
+.LBE49:
+	.loc 1 31 5 is_stmt 1 view .LVU23
+.LBB51:
+.LBI51:
+	.loc 2 86 20 view .LVU24
+.LBB52:
+	.loc 2 88 5 view .LVU25
+	movl	$-57, %eax
+.LBE52:
+.LBE51:
+	.loc 1 31 15 is_stmt 0 view .LVU26
+	leal	2(%rdi), %edx
+.LBB54:
+.LBB53:
+	.loc 2 88 5 view .LVU27
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL8:
+	.loc 2 88 5 view .LVU28
+#NO_APP
+.LBE53:
+.LBE54:
+	.loc 1 32 5 is_stmt 1 view .LVU29
+	.loc 1 32 15 is_stmt 0 view .LVU30
+	leal	4(%rdi), %ecx
+.LVL9:
+.LBB55:
+.LBI55:
+	.loc 2 86 20 is_stmt 1 view .LVU31
+.LBB56:
+	.loc 2 88 5 view .LVU32
+	movl	$11, %eax
+	movl	%ecx, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL10:
+	.loc 2 88 5 is_stmt 0 view .LVU33
+#NO_APP
+.LBE56:
+.LBE55:
+	.loc 1 33 5 is_stmt 1 view .LVU34
+.LBB57:
+.LBI57:
+	.loc 2 86 20 view .LVU35
+.LBB58:
+	.loc 2 88 5 view .LVU36
+	movl	$30, %eax
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL11:
+	.loc 2 88 5 is_stmt 0 view .LVU37
+#NO_APP
+.LBE58:
+.LBE57:
+	.loc 1 34 5 is_stmt 1 view .LVU38
+.LBB59:
+.LBI59:
+	.loc 2 86 20 view .LVU39
+.LBB60:
+	.loc 2 88 5 view .LVU40
+	movl	$-82, %eax
+	movl	%edi, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL12:
+	.loc 2 88 5 is_stmt 0 view .LVU41
+#NO_APP
+.LBE60:
+.LBE59:
+	.loc 1 37 5 is_stmt 1 view .LVU42
+.LBB61:
+.LBI61:
+	.loc 2 104 23 view .LVU43
+.LBB62:
+	.loc 2 106 5 view .LVU44
+	.loc 2 107 5 view .LVU45
+#APP
+# 107 "src/include/cpu.h" 1
+	inb %dx, %al
+# 0 "" 2
+.LVL13:
+	.loc 2 111 5 view .LVU46
+	.loc 2 111 5 is_stmt 0 view .LVU47
+#NO_APP
+.LBE62:
+.LBE61:
+	.loc 1 38 16 view .LVU48
+	movl	$1, %edx
+	.loc 1 37 7 view .LVU49
+	cmpb	$-82, %al
+	jne	.L1
+	.loc 1 43 5 is_stmt 1 view .LVU50
+.LVL14:
+.LBB63:
+.LBI63:
+	.loc 2 86 20 view .LVU51
+.LBB64:
+	.loc 2 88 5 view .LVU52
+	movl	$15, %eax
+	movl	%ecx, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL15:
+	.loc 2 88 5 is_stmt 0 view .LVU53
+#NO_APP
+.LBE64:
+.LBE63:
+	.loc 1 45 5 is_stmt 1 view .LVU54
+	.loc 1 45 12 is_stmt 0 view .LVU55
+	xorl	%edx, %edx
+.L1:
+	.loc 1 46 1 view .LVU56
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	init_serial, .-init_serial
+	.p2align 4
+	.globl	is_transmit_empty
+	.type	is_transmit_empty, @function
+is_transmit_empty:
+.LVL16:
+.LFB31:
+	.loc 1 49 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 50 5 view .LVU58
+.LBB65:
+.LBI65:
+	.loc 2 104 23 view .LVU59
+.LBB66:
+	.loc 2 106 5 view .LVU60
+	.loc 2 107 5 view .LVU61
+.LBE66:
+.LBE65:
+	.loc 1 50 21 is_stmt 0 view .LVU62
+	leal	5(%rdi), %edx
+.LBB68:
+.LBB67:
+	.loc 2 107 5 view .LVU63
+#APP
+# 107 "src/include/cpu.h" 1
+	inb %dx, %al
+# 0 "" 2
+.LVL17:
+	.loc 2 111 5 is_stmt 1 view .LVU64
+	.loc 2 111 5 is_stmt 0 view .LVU65
+#NO_APP
+.LBE67:
+.LBE68:
+	.loc 1 50 26 view .LVU66
+	andl	$32, %eax
+	.loc 1 51 1 view .LVU67
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	is_transmit_empty, .-is_transmit_empty
+	.p2align 4
+	.globl	write_serial
+	.type	write_serial, @function
+write_serial:
+.LVL18:
+.LFB32:
+	.loc 1 54 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 55 5 view .LVU69
+	.loc 1 54 1 is_stmt 0 view .LVU70
+	movl	%edi, %ecx
+.LBB69:
+.LBB70:
+	.loc 1 50 21 view .LVU71
+	leal	5(%rdi), %edx
+	.p2align 4,,10
+	.p2align 3
+.L7:
+.LBE70:
+.LBE69:
+	.loc 1 55 36 is_stmt 1 discriminator 1 view .LVU72
+.LVL19:
+.LBB74:
+.LBI69:
+	.loc 1 48 5 discriminator 1 view .LVU73
+.LBB73:
+	.loc 1 50 5 discriminator 1 view .LVU74
+.LBB71:
+.LBI71:
+	.loc 2 104 23 discriminator 1 view .LVU75
+.LBB72:
+	.loc 2 106 5 discriminator 1 view .LVU76
+	.loc 2 107 5 discriminator 1 view .LVU77
+#APP
+# 107 "src/include/cpu.h" 1
+	inb %dx, %al
+# 0 "" 2
+.LVL20:
+	.loc 2 111 5 discriminator 1 view .LVU78
+	.loc 2 111 5 is_stmt 0 discriminator 1 view .LVU79
+#NO_APP
+.LBE72:
+.LBE71:
+.LBE73:
+.LBE74:
+	.loc 1 55 36 discriminator 1 view .LVU80
+	testb	$32, %al
+	je	.L7
+	.loc 1 57 5 is_stmt 1 view .LVU81
+.LVL21:
+.LBB75:
+.LBI75:
+	.loc 2 86 20 view .LVU82
+.LBB76:
+	.loc 2 88 5 view .LVU83
+	movl	%esi, %eax
+	movl	%ecx, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL22:
+	.loc 2 88 5 is_stmt 0 view .LVU84
+#NO_APP
+.LBE76:
+.LBE75:
+	.loc 1 58 1 view .LVU85
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	write_serial, .-write_serial
+	.p2align 4
+	.globl	write_serial_str
+	.type	write_serial_str, @function
+write_serial_str:
+.LVL23:
+.LFB33:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU87
+.LBB86:
+	.loc 1 62 10 view .LVU88
+	.loc 1 62 23 view .LVU89
+	leaq	256(%rsi), %r9
+.LBB87:
+.LBB88:
+.LBB89:
+.LBB90:
+	.loc 1 50 21 is_stmt 0 view .LVU90
+	leal	5(%rdi), %ecx
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 50 21 view .LVU91
+.LBE90:
+.LBE89:
+.LBE88:
+.LBE87:
+	.loc 1 63 9 is_stmt 1 view .LVU92
+	.loc 1 63 16 is_stmt 0 view .LVU93
+	movzbl	(%rsi), %r8d
+	.loc 1 63 12 view .LVU94
+	testb	%r8b, %r8b
+	je	.L10
+	.p2align 4,,10
+	.p2align 3
+.L12:
+.LBB98:
+.LBB97:
+	.loc 1 55 36 is_stmt 1 view .LVU95
+.LVL25:
+.LBB94:
+.LBI89:
+	.loc 1 48 5 view .LVU96
+.LBB93:
+	.loc 1 50 5 view .LVU97
+.LBB91:
+.LBI91:
+	.loc 2 104 23 view .LVU98
+.LBB92:
+	.loc 2 106 5 view .LVU99
+	.loc 2 107 5 view .LVU100
+	movl	%ecx, %edx
+#APP
+# 107 "src/include/cpu.h" 1
+	inb %dx, %al
+# 0 "" 2
+.LVL26:
+	.loc 2 111 5 view .LVU101
+	.loc 2 111 5 is_stmt 0 view .LVU102
+#NO_APP
+.LBE92:
+.LBE91:
+.LBE93:
+.LBE94:
+	.loc 1 55 36 view .LVU103
+	testb	$32, %al
+	je	.L12
+	.loc 1 57 5 is_stmt 1 view .LVU104
+.LVL27:
+.LBB95:
+.LBI95:
+	.loc 2 86 20 view .LVU105
+.LBB96:
+	.loc 2 88 5 view .LVU106
+	movl	%r8d, %eax
+	movl	%edi, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL28:
+	.loc 2 88 5 is_stmt 0 view .LVU107
+#NO_APP
+.LBE96:
+.LBE95:
+.LBE97:
+.LBE98:
+	.loc 1 62 31 is_stmt 1 view .LVU108
+	.loc 1 62 23 view .LVU109
+	addq	$1, %rsi
+.LVL29:
+	.loc 1 62 23 is_stmt 0 view .LVU110
+	cmpq	%r9, %rsi
+	jne	.L13
+.LVL30:
+.L10:
+	.loc 1 62 23 view .LVU111
+.LBE86:
+	.loc 1 69 1 view .LVU112
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	write_serial_str, .-write_serial_str
+	.p2align 4
+	.globl	write_serial_strf
+	.type	write_serial_strf, @function
+write_serial_strf:
+.LVL31:
+.LFB34:
+	.loc 1 72 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 73 5 view .LVU114
+	.loc 1 74 4 view .LVU115
+	.loc 1 72 1 is_stmt 0 view .LVU116
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$344, %rsp
+	.cfi_def_cfa_offset 368
+	.loc 1 74 4 view .LVU117
+	leaq	368(%rsp), %rax
+	.loc 1 77 5 view .LVU118
+	leaq	32(%rsp), %rbx
+	.loc 1 72 1 view .LVU119
+	movq	%rdx, 304(%rsp)
+	.loc 1 77 5 view .LVU120
+	movq	%rsi, %rdx
+	.loc 1 72 1 view .LVU121
+	movq	%rcx, 312(%rsp)
+	.loc 1 77 5 view .LVU122
+	movq	%rbx, %rdi
+.LVL32:
+	.loc 1 77 5 view .LVU123
+	leaq	8(%rsp), %rcx
+	movl	$256, %esi
+.LVL33:
+	.loc 1 74 4 view .LVU124
+	movq	%rax, 16(%rsp)
+	leaq	288(%rsp), %rax
+	.loc 1 72 1 view .LVU125
+	movq	%r8, 320(%rsp)
+	movq	%r9, 328(%rsp)
+	.loc 1 74 4 view .LVU126
+	movl	$16, 8(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 76 5 is_stmt 1 view .LVU127
+	.loc 1 77 5 view .LVU128
+	call	vsnprintf@PLT
+.LVL34:
+	.loc 1 79 4 view .LVU129
+	.loc 1 81 5 view .LVU130
+.LBB110:
+.LBI110:
+	.loc 1 60 6 view .LVU131
+.LBB111:
+	.loc 1 62 23 view .LVU132
+	movq	%rbx, %rcx
+.LBB112:
+.LBB113:
+.LBB114:
+.LBB115:
+	.loc 1 50 21 is_stmt 0 view .LVU133
+	leal	5(%rbp), %r8d
+	leaq	288(%rsp), %rdi
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.loc 1 50 21 view .LVU134
+.LBE115:
+.LBE114:
+.LBE113:
+.LBE112:
+	.loc 1 63 9 is_stmt 1 view .LVU135
+	.loc 1 63 16 is_stmt 0 view .LVU136
+	movzbl	(%rcx), %esi
+	.loc 1 63 12 view .LVU137
+	testb	%sil, %sil
+	je	.L18
+	.p2align 4,,10
+	.p2align 3
+.L20:
+.LBB123:
+.LBB122:
+	.loc 1 55 36 is_stmt 1 view .LVU138
+.LVL36:
+.LBB119:
+.LBI114:
+	.loc 1 48 5 view .LVU139
+.LBB118:
+	.loc 1 50 5 view .LVU140
+.LBB116:
+.LBI116:
+	.loc 2 104 23 view .LVU141
+.LBB117:
+	.loc 2 106 5 view .LVU142
+	.loc 2 107 5 view .LVU143
+	movl	%r8d, %edx
+#APP
+# 107 "src/include/cpu.h" 1
+	inb %dx, %al
+# 0 "" 2
+.LVL37:
+	.loc 2 111 5 view .LVU144
+	.loc 2 111 5 is_stmt 0 view .LVU145
+#NO_APP
+.LBE117:
+.LBE116:
+.LBE118:
+.LBE119:
+	.loc 1 55 36 view .LVU146
+	testb	$32, %al
+	je	.L20
+	.loc 1 57 5 is_stmt 1 view .LVU147
+.LVL38:
+.LBB120:
+.LBI120:
+	.loc 2 86 20 view .LVU148
+.LBB121:
+	.loc 2 88 5 view .LVU149
+	movl	%esi, %eax
+	movl	%ebp, %edx
+#APP
+# 88 "src/include/cpu.h" 1
+	outb %al, %dx
+# 0 "" 2
+.LVL39:
+	.loc 2 88 5 is_stmt 0 view .LVU150
+#NO_APP
+.LBE121:
+.LBE120:
+.LBE122:
+.LBE123:
+	.loc 1 62 31 is_stmt 1 view .LVU151
+	.loc 1 62 23 view .LVU152
+	addq	$1, %rcx
+.LVL40:
+	.loc 1 62 23 is_stmt 0 view .LVU153
+	cmpq	%rdi, %rcx
+	jne	.L21
+.LVL41:
+.L18:
+	.loc 1 62 23 view .LVU154
+.LBE111:
+.LBE110:
+	.loc 1 82 1 view .LVU155
+	addq	$344, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL42:
+	.loc 1 82 1 view .LVU156
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LVL43:
+	.loc 1 82 1 view .LVU157
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	write_serial_strf, .-write_serial_strf
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 5 "<built-in>"
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x89a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF28
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x6
+	.long	.LASF6
+	.byte	0x3
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x6
+	.long	.LASF7
+	.byte	0x3
+	.byte	0x31
+	.byte	0x1c
+	.long	0x69
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0x6
+	.long	.LASF11
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1b
+	.long	0x8a
+	.uleb128 0x1a
+	.long	.LASF29
+	.long	0x93
+	.uleb128 0x10
+	.long	0xa3
+	.long	0xa3
+	.uleb128 0x11
+	.long	0x77
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF30
+	.byte	0x18
+	.byte	0x5
+	.byte	0
+	.long	0xd8
+	.uleb128 0x9
+	.long	.LASF12
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF13
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x9
+	.long	.LASF14
+	.long	0xd8
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF15
+	.long	0xd8
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x7e
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x77
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF18
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF19
+	.uleb128 0x1d
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x5
+	.long	0x3c
+	.long	0x125
+	.uleb128 0xa
+	.long	0x125
+	.uleb128 0xa
+	.long	0xe6
+	.uleb128 0xa
+	.long	0x136
+	.uleb128 0xa
+	.long	0x13b
+	.byte	0
+	.uleb128 0xe
+	.long	0x12a
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF20
+	.uleb128 0x1e
+	.long	0x12a
+	.uleb128 0xe
+	.long	0x131
+	.uleb128 0xe
+	.long	0xa3
+	.uleb128 0x1f
+	.long	.LASF31
+	.byte	0x1
+	.byte	0x47
+	.byte	0x6
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2da
+	.uleb128 0x12
+	.long	.LASF21
+	.byte	0x47
+	.byte	0x21
+	.long	0x5d
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x12
+	.long	.LASF22
+	.byte	0x47
+	.byte	0x32
+	.long	0x136
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x20
+	.uleb128 0x21
+	.long	.LASF23
+	.byte	0x1
+	.byte	0x49
+	.byte	0xd
+	.long	0xda
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.uleb128 0x22
+	.string	"str"
+	.byte	0x1
+	.byte	0x4c
+	.byte	0xa
+	.long	0x2da
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x3
+	.long	0x2ea
+	.quad	.LBI110
+	.byte	.LVU131
+	.quad	.LBB110
+	.quad	.LBE110-.LBB110
+	.byte	0x51
+	.byte	0x5
+	.long	0x2b0
+	.uleb128 0x1
+	.long	0x300
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x7
+	.long	0x2f4
+	.uleb128 0x13
+	.long	0x30c
+	.quad	.LBB111
+	.quad	.LBE111-.LBB111
+	.uleb128 0x4
+	.long	0x30d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x14
+	.long	0x319
+	.long	.LLRL45
+	.byte	0x43
+	.uleb128 0x7
+	.long	0x32f
+	.uleb128 0x7
+	.long	0x323
+	.uleb128 0xb
+	.long	0x33a
+	.quad	.LBI114
+	.byte	.LVU139
+	.long	.LLRL46
+	.byte	0x37
+	.byte	0xc
+	.long	0x272
+	.uleb128 0x1
+	.long	0x34b
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x5
+	.long	0x62e
+	.quad	.LBI116
+	.byte	.LVU141
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.byte	0x32
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x63f
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x4
+	.long	0x64b
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x658
+	.quad	.LBI120
+	.byte	.LVU148
+	.quad	.LBB120
+	.quad	.LBE120-.LBB120
+	.byte	0x39
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL34
+	.long	0x100
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x12a
+	.long	0x2ea
+	.uleb128 0x11
+	.long	0x77
+	.byte	0xff
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF24
+	.byte	0x3c
+	.long	0x319
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x20
+	.long	0x5d
+	.uleb128 0xf
+	.string	"str"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x2c
+	.long	0x125
+	.uleb128 0x24
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x1
+	.byte	0x3e
+	.byte	0xe
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF25
+	.byte	0x35
+	.long	0x33a
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x1
+	.byte	0x35
+	.byte	0x1c
+	.long	0x5d
+	.uleb128 0xf
+	.string	"a"
+	.byte	0x1
+	.byte	0x35
+	.byte	0x27
+	.long	0x12a
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF27
+	.byte	0x1
+	.byte	0x30
+	.byte	0x5
+	.long	0x3c
+	.byte	0x1
+	.long	0x358
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x1
+	.byte	0x30
+	.byte	0x20
+	.long	0x5d
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF32
+	.byte	0x1
+	.byte	0x18
+	.byte	0x5
+	.long	0x3c
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x62e
+	.uleb128 0x27
+	.long	.LASF21
+	.byte	0x1
+	.byte	0x18
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI41
+	.byte	.LVU3
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.byte	0x1a
+	.byte	0x5
+	.long	0x3c7
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI43
+	.byte	.LVU8
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.byte	0x1b
+	.byte	0x5
+	.long	0x406
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI45
+	.byte	.LVU12
+	.quad	.LBB45
+	.quad	.LBE45-.LBB45
+	.byte	0x1c
+	.byte	0x5
+	.long	0x445
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI47
+	.byte	.LVU16
+	.quad	.LBB47
+	.quad	.LBE47-.LBB47
+	.byte	0x1d
+	.byte	0x5
+	.long	0x484
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI49
+	.byte	.LVU20
+	.quad	.LBB49
+	.quad	.LBE49-.LBB49
+	.byte	0x1e
+	.byte	0x5
+	.long	0x4c3
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0xb
+	.long	0x658
+	.quad	.LBI51
+	.byte	.LVU24
+	.long	.LLRL10
+	.byte	0x1f
+	.byte	0x5
+	.long	0x4f6
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI55
+	.byte	.LVU31
+	.quad	.LBB55
+	.quad	.LBE55-.LBB55
+	.byte	0x20
+	.byte	0x5
+	.long	0x535
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI57
+	.byte	.LVU35
+	.quad	.LBB57
+	.quad	.LBE57-.LBB57
+	.byte	0x21
+	.byte	0x5
+	.long	0x574
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x3
+	.long	0x658
+	.quad	.LBI59
+	.byte	.LVU39
+	.quad	.LBB59
+	.quad	.LBE59-.LBB59
+	.byte	0x22
+	.byte	0x5
+	.long	0x5b3
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x3
+	.long	0x62e
+	.quad	.LBI61
+	.byte	.LVU43
+	.quad	.LBB61
+	.quad	.LBE61-.LBB61
+	.byte	0x25
+	.byte	0x8
+	.long	0x5f2
+	.uleb128 0x1
+	.long	0x63f
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x4
+	.long	0x64b
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x5
+	.long	0x658
+	.quad	.LBI63
+	.byte	.LVU51
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.byte	0x2b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.string	"inb"
+	.byte	0x2
+	.byte	0x68
+	.byte	0x17
+	.long	0x4a
+	.byte	0x3
+	.long	0x658
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x2
+	.byte	0x68
+	.byte	0x24
+	.long	0x5d
+	.uleb128 0x16
+	.string	"ret"
+	.byte	0x2
+	.byte	0x6a
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF33
+	.byte	0x2
+	.byte	0x56
+	.byte	0x14
+	.byte	0x3
+	.long	0x67e
+	.uleb128 0x8
+	.long	.LASF21
+	.byte	0x2
+	.byte	0x56
+	.byte	0x22
+	.long	0x5d
+	.uleb128 0xf
+	.string	"val"
+	.byte	0x2
+	.byte	0x56
+	.byte	0x30
+	.long	0x4a
+	.byte	0
+	.uleb128 0x17
+	.long	0x33a
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6d7
+	.uleb128 0xd
+	.long	0x34b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2a
+	.long	0x62e
+	.quad	.LBI65
+	.byte	.LVU59
+	.long	.LLRL23
+	.byte	0x1
+	.byte	0x32
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x63f
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x2b
+	.long	.LLRL23
+	.uleb128 0x4
+	.long	0x64b
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x319
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79d
+	.uleb128 0xd
+	.long	0x323
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xd
+	.long	0x32f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xb
+	.long	0x33a
+	.quad	.LBI69
+	.byte	.LVU73
+	.long	.LLRL26
+	.byte	0x37
+	.byte	0xc
+	.long	0x761
+	.uleb128 0x1
+	.long	0x34b
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x5
+	.long	0x62e
+	.quad	.LBI71
+	.byte	.LVU75
+	.quad	.LBB71
+	.quad	.LBE71-.LBB71
+	.byte	0x32
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x63f
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x4
+	.long	0x64b
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x658
+	.quad	.LBI75
+	.byte	.LVU82
+	.quad	.LBB75
+	.quad	.LBE75-.LBB75
+	.byte	0x39
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x2ea
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	0x2f4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x300
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x13
+	.long	0x30c
+	.quad	.LBB86
+	.quad	.LBE86-.LBB86
+	.uleb128 0x4
+	.long	0x30d
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x14
+	.long	0x319
+	.long	.LLRL34
+	.byte	0x43
+	.uleb128 0x7
+	.long	0x32f
+	.uleb128 0x7
+	.long	0x323
+	.uleb128 0xb
+	.long	0x33a
+	.quad	.LBI89
+	.byte	.LVU96
+	.long	.LLRL35
+	.byte	0x37
+	.byte	0xc
+	.long	0x85f
+	.uleb128 0x1
+	.long	0x34b
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x5
+	.long	0x62e
+	.quad	.LBI91
+	.byte	.LVU98
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.byte	0x32
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x63f
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x4
+	.long	0x64b
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x658
+	.quad	.LBI95
+	.byte	.LVU105
+	.quad	.LBB95
+	.quad	.LBE95-.LBB95
+	.byte	0x39
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x671
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x665
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS41:
+	.uleb128 0
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-1-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU131
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -336
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 .LVU153
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x4f
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU139
+	.uleb128 .LVU145
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU141
+	.uleb128 .LVU145
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 5
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU144
+	.uleb128 .LVU145
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU148
+	.uleb128 .LVU150
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU148
+	.uleb128 .LVU150
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU8
+	.uleb128 .LVU10
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU8
+	.uleb128 .LVU10
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU24
+	.uleb128 .LVU28
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xc7
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU24
+	.uleb128 .LVU28
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU35
+	.uleb128 .LVU37
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x2
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU35
+	.uleb128 .LVU37
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xae
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU43
+	.uleb128 .LVU47
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU46
+	.uleb128 .LVU47
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU59
+	.uleb128 .LVU65
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 5
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU73
+	.uleb128 .LVU79
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU75
+	.uleb128 .LVU79
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 5
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 -256
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU89
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU110
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x9
+	.byte	0x74
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x100
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x9
+	.byte	0x74
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x101
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU96
+	.uleb128 .LVU102
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU98
+	.uleb128 .LVU102
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 5
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL23:
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB68-.Ltext0
+	.uleb128 .LBE68-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB74-.Ltext0
+	.uleb128 .LBE74-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL35:
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB94-.Ltext0
+	.uleb128 .LBE94-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB119-.Ltext0
+	.uleb128 .LBE119-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF27:
+	.string	"is_transmit_empty"
+.LASF17:
+	.string	"size_t"
+.LASF29:
+	.string	"__builtin_va_list"
+.LASF26:
+	.string	"vsnprintf"
+.LASF25:
+	.string	"write_serial"
+.LASF13:
+	.string	"fp_offset"
+.LASF31:
+	.string	"write_serial_strf"
+.LASF11:
+	.string	"__gnuc_va_list"
+.LASF5:
+	.string	"unsigned char"
+.LASF10:
+	.string	"long unsigned int"
+.LASF8:
+	.string	"short unsigned int"
+.LASF32:
+	.string	"init_serial"
+.LASF16:
+	.string	"va_list"
+.LASF12:
+	.string	"gp_offset"
+.LASF22:
+	.string	"format"
+.LASF33:
+	.string	"outb"
+.LASF9:
+	.string	"unsigned int"
+.LASF15:
+	.string	"reg_save_area"
+.LASF20:
+	.string	"char"
+.LASF6:
+	.string	"uint8_t"
+.LASF14:
+	.string	"overflow_arg_area"
+.LASF28:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF18:
+	.string	"long long int"
+.LASF21:
+	.string	"port"
+.LASF24:
+	.string	"write_serial_str"
+.LASF3:
+	.string	"short int"
+.LASF23:
+	.string	"args"
+.LASF7:
+	.string	"uint16_t"
+.LASF4:
+	.string	"long int"
+.LASF19:
+	.string	"long double"
+.LASF2:
+	.string	"signed char"
+.LASF30:
+	.string	"__va_list_tag"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/serial.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
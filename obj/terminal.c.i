@@ -0,0 +1,1701 @@
+# 0 "src/terminal.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/terminal.c"
+# 18 "src/terminal.c"
+# 1 "src/include/terminal.h" 1
+# 21 "src/include/terminal.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 22 "src/include/terminal.h" 2
+# 1 "src/include/ps2.h" 1
+# 22 "src/include/ps2.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/ps2.h" 2
+
+
+
+
+
+
+
+# 29 "src/include/ps2.h"
+typedef struct KeyEvent {
+    uint8_t scan_code;
+    uint8_t event_type;
+    char ascii;
+    
+# 33 "src/include/ps2.h" 3 4
+   _Bool 
+# 33 "src/include/ps2.h"
+        is_control;
+} KeyEvent_t;
+
+extern KeyEvent_t* scancode_map[];
+
+uint8_t ps2_read();
+uint8_t ps2_read_no_wait();
+void ps2_init();
+# 23 "src/include/terminal.h" 2
+
+
+
+
+void term_init();
+void tprintf(const char format[], ...);
+void term_fgcolor(uint32_t color);
+void term_bgcolor(uint32_t color);
+void term_keyevent(KeyEvent_t *ke);
+void term_cblink();
+void term_clear();
+# 19 "src/terminal.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 20 "src/terminal.c" 2
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 21 "src/terminal.c" 2
+# 1 "src/kernel.h" 1
+# 22 "src/kernel.h"
+# 1 "src/include/queue.h" 1
+# 22 "src/include/queue.h"
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 23 "src/include/queue.h" 2
+
+
+typedef struct {
+    volatile uint32_t read_i;
+    volatile uint32_t write_i;
+    uint32_t *buff;
+    uint32_t len;
+    volatile uint32_t num_items;
+    spinlock_t lock;
+} __attribute__((packed)) CQueue_t;
+
+CQueue_t* cqueue_create(uint32_t len);
+
+# 35 "src/include/queue.h" 3 4
+_Bool 
+# 35 "src/include/queue.h"
+           cqueue_write(CQueue_t *q, uint32_t val);
+uint32_t cqueue_read(CQueue_t *q);
+# 23 "src/kernel.h" 2
+
+void report_cpu_details();
+
+
+static inline void hcf(void)
+{
+    asm("cli");
+    for (;;) {
+        asm("hlt");
+    }
+}
+
+extern CQueue_t *q_keyboard;
+# 22 "src/terminal.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 23 "src/terminal.c" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 24 "src/terminal.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 25 "src/terminal.c" 2
+
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 43 "src/include/cpu.h" 2
+# 51 "src/include/cpu.h"
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 27 "src/terminal.c" 2
+
+# 1 "src/include/idt.h" 1
+# 22 "src/include/idt.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/idt.h" 2
+
+
+
+
+
+
+
+struct idt_entry
+{
+    uint16_t base_low;
+    uint16_t selector;
+    uint8_t ist;
+    uint8_t flags;
+    uint16_t base_mid;
+    uint32_t base_high;
+    uint32_t reserved;
+} __attribute__((packed));
+
+struct idt_ptr
+{
+    uint16_t limit;
+    uint64_t base;
+} __attribute__((packed));
+
+struct idt_frame {
+    uint64_t rip;
+    uint64_t cs;
+    uint64_t flags;
+    uint64_t rsp;
+    uint64_t ss;
+};
+
+void idt_init();
+
+extern volatile uint64_t kernel_timer_secs;
+# 29 "src/terminal.c" 2
+# 1 "src/include/alloc.h" 1
+# 21 "src/include/alloc.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/alloc.h" 2
+# 39 "src/include/alloc.h"
+void *malloc(size_t size);
+void free(void *ptr);
+void *realloc(void *ptr, size_t size);
+void *calloc(size_t count, size_t size);
+void *aligned_alloc(size_t alignment, size_t size);
+void alloc_profile_report();
+void alloc_profile_report_serial();
+
+
+void alloc_cpu_cache_drain();
+# 30 "src/terminal.c" 2
+# 1 "src/include/allocbench.h" 1
+# 30 "src/include/allocbench.h"
+void alloc_benchmark();
+# 31 "src/terminal.c" 2
+# 1 "src/include/slab.h" 1
+# 21 "src/include/slab.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "src/include/slab.h" 2
+# 43 "src/include/slab.h"
+struct SlabCache;
+
+void slab_init();
+void *slab_malloc(size_t size);
+void slab_free(void *ptr);
+size_t slab_usable_size(void *ptr);
+int slab_size_class(size_t size);
+int slab_object_class(void *ptr, uint32_t *pOwner);
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner);
+void slab_free_batch(void **ppObjects, uint32_t count);
+
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject));
+void *kmem_cache_alloc(struct SlabCache *pCache);
+void kmem_cache_free(struct SlabCache *pCache, void *ptr);
+void kmem_cache_report();
+# 32 "src/terminal.c" 2
+# 1 "src/include/vm.h" 1
+# 41 "src/include/vm.h"
+void vm_init();
+uint64_t walk_page_table(uint64_t virt_addr);
+
+# 43 "src/include/vm.h" 3 4
+_Bool 
+# 43 "src/include/vm.h"
+    vm_map(uint64_t virt_addr, uint64_t phys_addr, uint32_t flags);
+
+# 44 "src/include/vm.h" 3 4
+_Bool 
+# 44 "src/include/vm.h"
+    vm_map_range(uint64_t virt_addr, uint64_t phys_addr, uint64_t size, uint32_t flags);
+void vm_unmap(uint64_t virt_addr);
+void vm_unmap_range(uint64_t virt_addr, uint64_t size);
+
+# 47 "src/include/vm.h" 3 4
+_Bool 
+# 47 "src/include/vm.h"
+    vm_protect(uint64_t virt_addr, uint32_t flags);
+
+# 48 "src/include/vm.h" 3 4
+_Bool 
+# 48 "src/include/vm.h"
+    vm_protect_range(uint64_t virt_addr, uint64_t size, uint32_t flags);
+void vm_report();
+# 33 "src/terminal.c" 2
+
+typedef struct {
+    uint16_t magic;
+    uint8_t fontMode;
+    uint8_t char_height;
+} __attribute__((packed)) PSF1_Header;
+
+struct limine_module_request file_request = {
+    .id = { 0xc7b1dd30df4c8b88, 0x0a82e883a194f07b, 0x3e7e279702be32af, 0xca1c4f3bd1280cee },
+    .revision = 0};
+
+struct limine_framebuffer_request framebuffer_request = {
+    .id = { 0xc7b1dd30df4c8b88, 0x0a82e883a194f07b, 0x9d5827dcd881dd75, 0xa3148604f6fab11b },
+    .revision = 0};
+
+char *glyph_data = 
+# 48 "src/terminal.c" 3 4
+                  ((void *)0)
+# 48 "src/terminal.c"
+                      ;
+PSF1_Header *font_header = 
+# 49 "src/terminal.c" 3 4
+                          ((void *)0)
+# 49 "src/terminal.c"
+                              ;
+struct limine_framebuffer *frame_buffer = 
+# 50 "src/terminal.c" 3 4
+                                         ((void *)0)
+# 50 "src/terminal.c"
+                                             ;
+uint8_t glyph_padding = 1;
+uint32_t max_rows = 0;
+uint32_t max_cols = 0;
+uint32_t glyph_width = 0;
+uint32_t glyph_height = 0;
+
+# 56 "src/terminal.c" 3 4
+_Bool 
+# 56 "src/terminal.c"
+    is_ready = 
+# 56 "src/terminal.c" 3 4
+               0
+# 56 "src/terminal.c"
+                    ;
+uint32_t fgcolor = 0xCCCCCC;
+uint32_t bgcolor = 0x0;
+
+
+uint32_t render_x = 0;
+uint32_t render_y = 0;
+
+
+uint32_t input_render_x = 0;
+uint32_t input_render_y = 0;
+
+
+uint32_t cursor_x = 0;
+uint32_t cursor_y = 0;
+
+char input_str[256];
+spinlock_t _cursor_lock;
+
+# 74 "src/terminal.c" 3 4
+_Bool 
+# 74 "src/terminal.c"
+    cursor_visible;
+
+inline void term_fgcolor(uint32_t color)
+{
+    fgcolor = color;
+}
+
+inline void term_bgcolor(uint32_t color)
+{
+    bgcolor = color;
+}
+
+static inline uint32_t fbindex(uint32_t x, uint32_t y)
+{
+    return (y * (frame_buffer->pitch / 4)) + x;
+}
+
+static inline void _clear_screen()
+{
+
+    uint32_t *fb = frame_buffer->address;
+    uint32_t blank_start = fbindex(0, 0);
+    uint32_t blank_end = fbindex(frame_buffer->width, frame_buffer->height);
+    memset(&fb[blank_start], 0x00, (char*)&fb[blank_end] - (char*)&fb[blank_start]);
+}
+
+static inline void _put_pixel(uint32_t x, uint32_t y, uint32_t color)
+{
+    uint32_t *fb_ptr = frame_buffer->address;
+    uint32_t index = fbindex(x, y);
+    fb_ptr[index] = color;
+}
+
+void _shift_screen_up()
+{
+
+    uint32_t *fb = frame_buffer->address;
+    uint32_t start_pixel_index = fbindex(0, glyph_height);
+    uint32_t end_pixel_index = fbindex(frame_buffer->width, frame_buffer->height);
+
+    memmove(
+        frame_buffer->address,
+        &fb[start_pixel_index],
+        (char*)&fb[end_pixel_index] - (char*)&fb[start_pixel_index]);
+
+
+    uint32_t blank_start = fbindex(0, frame_buffer->height - glyph_height);
+    uint32_t blank_end = fbindex(frame_buffer->width, frame_buffer->height);
+    memset(&fb[blank_start], 0x00, (char*)&fb[blank_end] - (char*)&fb[blank_start]);
+}
+
+
+
+
+void _load_font()
+{
+    for (uint64_t i = 0; i < file_request.response->module_count; i++) {
+        if (memcmp("/Font.psf", file_request.response->modules[i]->path, 9) == 0) {
+
+            font_header = (PSF1_Header*)file_request.response->modules[i]->address;
+
+
+
+            if (font_header->magic != 0x0436) {
+                kprintf("FATAL: Failed to load font.");
+                hcf();
+            }
+
+
+
+
+            glyph_data = (char*)font_header + sizeof(PSF1_Header);
+            break;
+        }
+    }
+}
+
+
+
+
+void _render_glyph(char ch, uint32_t x, uint32_t y)
+{
+    uint8_t bytesPerGlyph = 1 * font_header->char_height;
+    uint32_t dataIndex = ch * bytesPerGlyph;
+
+
+    for (int glyphRow = 0; glyphRow < font_header->char_height; glyphRow++) {
+
+        char rowData = glyph_data[dataIndex++];
+
+        for (int bitIndex = 0; bitIndex < 8; bitIndex++) {
+            uint8_t bit_mask = 1 << (bitIndex % 8);
+            if (rowData & bit_mask) {
+
+                _put_pixel(x + (8 - bitIndex), y + glyphRow, fgcolor);
+            } else {
+
+                _put_pixel(x + (8 - bitIndex), y + glyphRow, bgcolor);
+            }
+        }
+    }
+}
+
+
+
+
+void _clear_cursor()
+{
+    for (uint32_t i = 0; i < glyph_height; i++) {
+        _put_pixel(cursor_x, cursor_y+i, bgcolor);
+    }
+}
+
+
+
+void _render_cursor()
+{
+    if (!cursor_visible) {
+        return;
+    }
+
+
+    for (uint32_t i = 0; i < glyph_height; i++) {
+        _put_pixel(input_render_x, input_render_y+i, 0xFFFFFF);
+    }
+
+    cursor_x = input_render_x;
+    cursor_y = input_render_y;
+}
+
+
+
+
+void term_cblink()
+{
+    disable_interrupts();
+    spinlock_lock(&_cursor_lock);
+
+    cursor_visible = !cursor_visible;
+    _clear_cursor();
+    _render_cursor();
+
+    spinlock_unlock(&_cursor_lock);
+    enable_interrupts();
+}
+
+
+
+
+void _render_input_line()
+{
+
+
+    input_render_x = 0;
+    input_render_y = render_x > 0 ? render_y + glyph_height : render_y;
+
+    char buffer[] = "# ";
+
+    char *ch = &buffer[0];
+
+    term_fgcolor(0x44AAFF);
+
+    do {
+        _render_glyph(*ch, input_render_x, input_render_y);
+        input_render_x += glyph_width;
+
+
+        ch++;
+    } while(*ch != '\0');
+
+    term_fgcolor(0xCCCCCC);
+
+    _render_cursor();
+}
+
+
+
+
+
+void _move_to_next_line()
+{
+    if (render_x == 0) {
+
+        uint32_t *fb = frame_buffer->address;
+        uint32_t blank_start =fbindex(0, render_y);
+        uint32_t blank_end = fbindex(frame_buffer->width, render_y + glyph_height);
+        memset(&fb[blank_start], 0x00, (char*)&fb[blank_end] - (char*)&fb[blank_start]);
+    }
+
+    render_x = 0;
+    render_y += glyph_height;
+
+
+    if (render_y > frame_buffer->height - glyph_height) {
+        _shift_screen_up();
+        render_y -= glyph_height;
+    }
+
+
+    uint32_t *fb = frame_buffer->address;
+    uint32_t blank_start =fbindex(0, render_y);
+    uint32_t blank_end = fbindex(frame_buffer->width, render_y + glyph_height);
+    memset(&fb[blank_start], 0x00, (char*)&fb[blank_end] - (char*)&fb[blank_start]);
+
+    _render_input_line();
+}
+
+void tprintf(const char format[], ...)
+{
+    if (!is_ready) {
+        return;
+    }
+
+    char buffer[256];
+
+    va_list args;
+    
+# 290 "src/terminal.c" 3 4
+   __builtin_va_start(
+# 290 "src/terminal.c"
+   args
+# 290 "src/terminal.c" 3 4
+   ,
+# 290 "src/terminal.c"
+   format
+# 290 "src/terminal.c" 3 4
+   )
+# 290 "src/terminal.c"
+                         ;
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    
+# 292 "src/terminal.c" 3 4
+   __builtin_va_end(
+# 292 "src/terminal.c"
+   args
+# 292 "src/terminal.c" 3 4
+   )
+# 292 "src/terminal.c"
+               ;
+
+
+    if (render_x == 0) {
+        uint32_t *fb = frame_buffer->address;
+        uint32_t blank_start = fbindex(0, render_y);
+        uint32_t blank_end = fbindex(frame_buffer->width, render_y + glyph_height);
+        memset(&fb[blank_start], 0x00, (char*)&fb[blank_end] - (char*)&fb[blank_start]);
+    }
+
+
+    char *ch = &buffer[0];
+
+    do {
+
+        if (*ch == '\n') {
+            _move_to_next_line();
+
+            ch++;
+            continue;
+        }
+
+        _render_glyph(*ch, render_x, render_y);
+
+
+        render_x += 8 + glyph_padding;
+
+        if (render_x > frame_buffer->width - glyph_width) {
+            _move_to_next_line();
+        }
+
+        ch++;
+    } while (*ch != '\0');
+}
+
+void term_init()
+{
+    frame_buffer = framebuffer_request.response->framebuffers[0];
+
+    _load_font();
+
+    max_rows = frame_buffer->height / (font_header->char_height + glyph_padding);
+    max_cols = frame_buffer->width / (8 + glyph_padding);
+
+    glyph_width = 8 + glyph_padding;
+    glyph_height = font_header->char_height + glyph_padding;
+
+    kprintf("Font: %dx%d\n", glyph_width - glyph_padding, glyph_height - glyph_padding);
+    kprintf("Resolution: %dx%d\n", frame_buffer->width, frame_buffer->height);
+    kprintf("BPP: %d\n", frame_buffer->bpp);
+    kprintf("Pitch: %d\n", frame_buffer->pitch);
+
+    _render_input_line();
+
+    is_ready = 
+# 346 "src/terminal.c" 3 4
+              1
+# 346 "src/terminal.c"
+                  ;
+}
+
+
+
+
+void term_clear()
+{
+    _clear_screen();
+    render_x = render_y = input_render_x = input_render_y = cursor_x = cursor_y = 0;
+    _render_input_line();
+}
+
+
+
+
+void _handle_cmd()
+{
+    if (strcmp(input_str, "hello") == 0) {
+        tprintf("World!\n");
+    } else if (strcmp(input_str, "cls") == 0) {
+        term_clear();
+    } else if (strcmp(input_str, "time") == 0) {
+        tprintf("Kerner Time: %lums\n", kernel_timer_secs);
+    } else if (strcmp(input_str, "stime") == 0) {
+        tprintf("Kerner Time: %lus\n", kernel_timer_secs / 1000);
+    } else if (strcmp(input_str, "memstat") == 0) {
+        kmem_report();
+    } else if (strcmp(input_str, "memdump") == 0) {
+        kmem_report_serial();
+        tprintf("PMM stats written to serial.\n");
+    } else if (strcmp(input_str, "membench") == 0) {
+        memops_benchmark();
+    } else if (strcmp(input_str, "colorbench") == 0) {
+        kmem_color_benchmark();
+    } else if (strcmp(input_str, "allocbench") == 0) {
+        alloc_benchmark();
+    } else if (strcmp(input_str, "vmstat") == 0) {
+        vm_report();
+    } else if (strcmp(input_str, "slabinfo") == 0) {
+        kmem_cache_report();
+    } else if (strcmp(input_str, "heapprof") == 0) {
+        alloc_profile_report();
+    } else if (strcmp(input_str, "heapdump") == 0) {
+        alloc_profile_report_serial();
+        tprintf("Heap profile written to serial.\n");
+    } else if (strcmp(input_str, "zeropool") == 0) {
+        uint64_t requests = zero_pool_hits + zero_pool_misses;
+        tprintf("Zero pool: %d pages, %lu hits, %lu misses, %lu percent hit rate\n",
+            kmem_zero_pool_count(), zero_pool_hits, zero_pool_misses,
+            requests > 0 ? zero_pool_hits * 100 / requests : 0);
+    } else {
+        tprintf("Unknown command.\n");
+    }
+}
+
+
+
+
+void term_keyevent(KeyEvent_t *ke)
+{
+    if (ke->event_type == 0 && ke->scan_code == 28) {
+
+        tprintf("# ");
+        tprintf(input_str);
+        tprintf("\n");
+        _handle_cmd();
+
+        input_str[0] = '\0';
+
+        return;
+    }
+
+    if (ke->event_type == 0 && ke->scan_code == 14) {
+        if (input_str[0] != '\0') {
+            input_str[strlen(input_str)-1] = '\0';
+
+            _clear_cursor();
+
+
+            uint32_t *fb = frame_buffer->address;
+            for (uint32_t y = 0; y < glyph_height; y++) {
+                uint32_t blank_start = fbindex(input_render_x - glyph_width, input_render_y+y);
+                uint32_t blank_end = fbindex(input_render_x, input_render_y+y);
+                memset(&fb[blank_start], 0, (char*)&fb[blank_end] - (char*)&fb[blank_start]);
+            }
+
+            input_render_x -= glyph_width;
+
+            _render_cursor();
+            return;
+        }
+    }
+
+    if (ke->event_type == 0 && ke->ascii != 0) {
+
+        _render_glyph(ke->ascii, input_render_x, input_render_y);
+        input_render_x += glyph_width;
+
+
+        size_t len = strlen(input_str);
+        input_str[len] = ke->ascii;
+        input_str[len+1] = '\0';
+
+        _clear_cursor();
+        _render_cursor();
+    }
+}
@@ -0,0 +1,9419 @@
+	.file	"terminal.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/terminal.c"
+	.p2align 4
+	.type	_render_cursor.part.0, @function
+_render_cursor.part.0:
+.LFB51:
+	.file 1 "src/terminal.c"
+	.loc 1 189 6 view -0
+	.cfi_startproc
+.LVL0:
+.LBB88:
+	.loc 1 196 28 view .LVU1
+	movl	glyph_height(%rip), %eax
+	testl	%eax, %eax
+	je	.L2
+.LBB89:
+.LBB90:
+	.loc 1 102 36 is_stmt 0 view .LVU2
+	movq	frame_buffer(%rip), %rax
+.LBE90:
+.LBE89:
+	.loc 1 196 19 view .LVU3
+	xorl	%edx, %edx
+.LBB102:
+.LBB99:
+.LBB91:
+.LBB92:
+	.loc 1 88 38 view .LVU4
+	movq	24(%rax), %rcx
+.LBE92:
+.LBE91:
+	.loc 1 102 15 view .LVU5
+	movq	(%rax), %rsi
+.LBB96:
+.LBB93:
+	.loc 1 88 38 view .LVU6
+	shrq	$2, %rcx
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 88 38 view .LVU7
+.LBE93:
+.LBE96:
+.LBE99:
+.LBE102:
+	.loc 1 197 9 is_stmt 1 view .LVU8
+.LBB103:
+.LBI89:
+	.loc 1 100 20 view .LVU9
+.LBB100:
+	.loc 1 102 5 view .LVU10
+	.loc 1 103 5 view .LVU11
+.LBB97:
+.LBI91:
+	.loc 1 86 24 view .LVU12
+.LBB94:
+	.loc 1 88 5 view .LVU13
+	.loc 1 88 5 is_stmt 0 view .LVU14
+.LBE94:
+.LBE97:
+	.loc 1 104 5 is_stmt 1 view .LVU15
+.LBE100:
+.LBE103:
+	.loc 1 197 9 is_stmt 0 view .LVU16
+	movl	input_render_y(%rip), %eax
+	addl	%edx, %eax
+.LVL2:
+	.loc 1 196 45 view .LVU17
+	addl	$1, %edx
+.LVL3:
+.LBB104:
+.LBB101:
+.LBB98:
+.LBB95:
+	.loc 1 88 44 view .LVU18
+	imull	%ecx, %eax
+.LVL4:
+	.loc 1 88 44 view .LVU19
+.LBE95:
+.LBE98:
+	.loc 1 104 11 view .LVU20
+	addl	input_render_x(%rip), %eax
+	.loc 1 104 19 view .LVU21
+	movl	$16777215, (%rsi,%rax,4)
+.LVL5:
+	.loc 1 104 19 view .LVU22
+.LBE101:
+.LBE104:
+	.loc 1 196 45 is_stmt 1 view .LVU23
+	.loc 1 196 28 view .LVU24
+	cmpl	glyph_height(%rip), %edx
+	jb	.L3
+.LVL6:
+.L2:
+	.loc 1 196 28 is_stmt 0 view .LVU25
+.LBE88:
+	.loc 1 200 5 is_stmt 1 view .LVU26
+	.loc 1 200 14 is_stmt 0 view .LVU27
+	movl	input_render_x(%rip), %eax
+	movl	%eax, cursor_x(%rip)
+	.loc 1 201 5 is_stmt 1 view .LVU28
+	.loc 1 201 14 is_stmt 0 view .LVU29
+	movl	input_render_y(%rip), %eax
+	movl	%eax, cursor_y(%rip)
+	.loc 1 202 1 view .LVU30
+	ret
+	.cfi_endproc
+.LFE51:
+	.size	_render_cursor.part.0, .-_render_cursor.part.0
+	.p2align 4
+	.globl	term_fgcolor
+	.type	term_fgcolor, @function
+term_fgcolor:
+.LVL7:
+.LFB33:
+	.loc 1 77 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 78 5 view .LVU32
+	.loc 1 78 13 is_stmt 0 view .LVU33
+	movl	%edi, fgcolor(%rip)
+	.loc 1 79 1 view .LVU34
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	term_fgcolor, .-term_fgcolor
+	.p2align 4
+	.globl	term_bgcolor
+	.type	term_bgcolor, @function
+term_bgcolor:
+.LVL8:
+.LFB34:
+	.loc 1 82 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 83 5 view .LVU36
+	.loc 1 83 13 is_stmt 0 view .LVU37
+	movl	%edi, bgcolor(%rip)
+	.loc 1 84 1 view .LVU38
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	term_bgcolor, .-term_bgcolor
+	.p2align 4
+	.globl	_shift_screen_up
+	.type	_shift_screen_up, @function
+_shift_screen_up:
+.LFB38:
+	.loc 1 108 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 110 5 view .LVU40
+	.loc 1 110 32 is_stmt 0 view .LVU41
+	movq	frame_buffer(%rip), %rax
+	.loc 1 108 1 view .LVU42
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB105:
+.LBB106:
+	.loc 1 88 38 view .LVU43
+	movq	24(%rax), %rdx
+.LBE106:
+.LBE105:
+	.loc 1 110 15 view .LVU44
+	movq	(%rax), %rbx
+.LVL9:
+	.loc 1 111 5 is_stmt 1 view .LVU45
+.LBB108:
+.LBI105:
+	.loc 1 86 24 view .LVU46
+.LBB107:
+	.loc 1 88 5 view .LVU47
+	.loc 1 88 38 is_stmt 0 view .LVU48
+	shrq	$2, %rdx
+.LVL10:
+	.loc 1 88 38 view .LVU49
+.LBE107:
+.LBE108:
+	.loc 1 112 5 is_stmt 1 view .LVU50
+.LBB109:
+.LBI109:
+	.loc 1 86 24 view .LVU51
+.LBB110:
+	.loc 1 88 5 view .LVU52
+	.loc 1 88 5 is_stmt 0 view .LVU53
+.LBE110:
+.LBE109:
+	.loc 1 114 5 is_stmt 1 view .LVU54
+	movq	%rbx, %rdi
+	.loc 1 117 49 is_stmt 0 view .LVU55
+	movl	%edx, %esi
+	imull	glyph_height(%rip), %esi
+.LBB112:
+.LBB111:
+	.loc 1 88 44 view .LVU56
+	imull	16(%rax), %edx
+.LVL11:
+	.loc 1 88 44 view .LVU57
+.LBE111:
+.LBE112:
+	.loc 1 117 19 view .LVU58
+	addl	8(%rax), %edx
+	salq	$2, %rdx
+	.loc 1 117 49 view .LVU59
+	salq	$2, %rsi
+	.loc 1 117 37 view .LVU60
+	subq	%rsi, %rdx
+	.loc 1 117 46 view .LVU61
+	addq	%rbx, %rsi
+	.loc 1 114 5 view .LVU62
+	call	memmove@PLT
+.LVL12:
+	.loc 1 120 5 is_stmt 1 view .LVU63
+	.loc 1 120 51 is_stmt 0 view .LVU64
+	movq	frame_buffer(%rip), %rcx
+	.loc 1 120 28 view .LVU65
+	movq	16(%rcx), %rsi
+.LVL13:
+.LBB113:
+.LBI113:
+	.loc 1 86 24 is_stmt 1 view .LVU66
+.LBB114:
+	.loc 1 88 5 view .LVU67
+	.loc 1 88 38 is_stmt 0 view .LVU68
+	movq	24(%rcx), %rdx
+.LBE114:
+.LBE113:
+	.loc 1 120 28 view .LVU69
+	movl	%esi, %eax
+.LBB116:
+.LBB115:
+	.loc 1 88 38 view .LVU70
+	shrq	$2, %rdx
+.LVL14:
+	.loc 1 88 38 view .LVU71
+.LBE115:
+.LBE116:
+	.loc 1 121 5 is_stmt 1 view .LVU72
+.LBB117:
+.LBI117:
+	.loc 1 86 24 view .LVU73
+.LBB118:
+	.loc 1 88 5 view .LVU74
+	.loc 1 88 5 is_stmt 0 view .LVU75
+.LBE118:
+.LBE117:
+	.loc 1 122 5 is_stmt 1 view .LVU76
+	.loc 1 120 28 is_stmt 0 view .LVU77
+	subl	glyph_height(%rip), %eax
+	.loc 1 122 70 view .LVU78
+	imull	%edx, %eax
+.LBB120:
+.LBB119:
+	.loc 1 88 44 view .LVU79
+	imull	%esi, %edx
+.LVL15:
+	.loc 1 88 44 view .LVU80
+.LBE119:
+.LBE120:
+	.loc 1 122 46 view .LVU81
+	addl	8(%rcx), %edx
+	.loc 1 122 5 view .LVU82
+	xorl	%esi, %esi
+.LVL16:
+	.loc 1 122 46 view .LVU83
+	salq	$2, %rdx
+	.loc 1 122 70 view .LVU84
+	salq	$2, %rax
+	.loc 1 122 67 view .LVU85
+	leaq	(%rbx,%rax), %rdi
+	.loc 1 122 58 view .LVU86
+	subq	%rax, %rdx
+	.loc 1 123 1 view .LVU87
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 122 5 view .LVU88
+	jmp	memset@PLT
+.LVL18:
+	.loc 1 122 5 view .LVU89
+	.cfi_endproc
+.LFE38:
+	.size	_shift_screen_up, .-_shift_screen_up
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"/Font.psf"
+.LC1:
+	.string	"FATAL: Failed to load font."
+	.text
+	.p2align 4
+	.globl	_load_font
+	.type	_load_font, @function
+_load_font:
+.LFB39:
+	.loc 1 129 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 130 5 view .LVU91
+.LBB124:
+	.loc 1 130 10 view .LVU92
+.LVL19:
+	.loc 1 130 28 view .LVU93
+	.loc 1 130 42 is_stmt 0 view .LVU94
+	movq	40+file_request(%rip), %rax
+	.loc 1 130 28 view .LVU95
+	cmpq	$0, 8(%rax)
+	je	.L19
+.LBE124:
+	.loc 1 129 1 view .LVU96
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	leaq	.LC0(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+.LBB127:
+	.loc 1 130 19 view .LVU97
+	xorl	%ebx, %ebx
+.LBE127:
+	.loc 1 129 1 view .LVU98
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L16
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+.LBB128:
+	.loc 1 130 68 is_stmt 1 discriminator 2 view .LVU99
+	.loc 1 130 42 is_stmt 0 discriminator 2 view .LVU100
+	movq	40+file_request(%rip), %rax
+	.loc 1 130 68 discriminator 2 view .LVU101
+	addq	$1, %rbx
+.LVL21:
+	.loc 1 130 28 is_stmt 1 discriminator 2 view .LVU102
+	cmpq	8(%rax), %rbx
+	jnb	.L10
+.LVL22:
+.L16:
+	.loc 1 131 9 view .LVU103
+	.loc 1 131 63 is_stmt 0 view .LVU104
+	movq	16(%rax), %rax
+	.loc 1 131 13 view .LVU105
+	movl	$9, %edx
+	movq	%rbp, %rdi
+	.loc 1 131 66 view .LVU106
+	movq	(%rax,%rbx,8), %rax
+	.loc 1 131 13 view .LVU107
+	movq	24(%rax), %rsi
+	call	memcmp@PLT
+.LVL23:
+	.loc 1 131 12 view .LVU108
+	testl	%eax, %eax
+	jne	.L12
+	.loc 1 133 13 is_stmt 1 view .LVU109
+	.loc 1 133 62 is_stmt 0 view .LVU110
+	movq	40+file_request(%rip), %rax
+	.loc 1 133 71 view .LVU111
+	movq	16(%rax), %rax
+	.loc 1 133 74 view .LVU112
+	movq	(%rax,%rbx,8), %rax
+	movq	8(%rax), %rax
+	.loc 1 137 16 view .LVU113
+	cmpw	$1078, (%rax)
+	.loc 1 133 25 view .LVU114
+	movq	%rax, font_header(%rip)
+	.loc 1 137 13 is_stmt 1 view .LVU115
+	.loc 1 137 16 is_stmt 0 view .LVU116
+	jne	.L22
+	.loc 1 145 13 is_stmt 1 view .LVU117
+	.loc 1 145 45 is_stmt 0 view .LVU118
+	addq	$4, %rax
+	movq	%rax, glyph_data(%rip)
+	.loc 1 146 13 is_stmt 1 view .LVU119
+.L10:
+	.loc 1 146 13 is_stmt 0 view .LVU120
+.LBE128:
+	.loc 1 149 1 view .LVU121
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+.LVL24:
+	.loc 1 149 1 view .LVU122
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+.LVL25:
+.L19:
+	.loc 1 149 1 view .LVU123
+	ret
+.LVL26:
+.L22:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -24
+	.cfi_offset 6, -16
+.LBB129:
+	.loc 1 138 17 is_stmt 1 view .LVU124
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL27:
+	.loc 1 139 17 view .LVU125
+.LBB125:
+.LBI125:
+	.file 2 "src/kernel.h"
+	.loc 2 27 20 view .LVU126
+.LBB126:
+	.loc 2 29 5 view .LVU127
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.L14:
+	.loc 2 30 5 view .LVU128
+	.loc 2 31 9 view .LVU129
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 2 30 5 view .LVU130
+#NO_APP
+	jmp	.L14
+.LBE126:
+.LBE125:
+.LBE129:
+	.cfi_endproc
+.LFE39:
+	.size	_load_font, .-_load_font
+	.p2align 4
+	.globl	_render_glyph
+	.type	_render_glyph, @function
+_render_glyph:
+.LVL28:
+.LFB40:
+	.loc 1 155 1 view -0
+	.cfi_startproc
+	.loc 1 156 5 view .LVU132
+	.loc 1 157 5 view .LVU133
+	.loc 1 155 1 is_stmt 0 view .LVU134
+	movl	%edx, %r10d
+	.loc 1 157 29 view .LVU135
+	movq	font_header(%rip), %rdx
+.LVL29:
+	.loc 1 155 1 view .LVU136
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+.LVL30:
+	.loc 1 157 29 view .LVU137
+	movsbl	%dil, %r11d
+	.loc 1 155 1 view .LVU138
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 157 29 view .LVU139
+	movzbl	3(%rdx), %ebx
+	imull	%ebx, %r11d
+.LVL31:
+	.loc 1 160 5 is_stmt 1 view .LVU140
+.LBB130:
+	.loc 1 160 10 view .LVU141
+	.loc 1 160 37 view .LVU142
+	testl	%ebx, %ebx
+	je	.L23
+	addl	%r10d, %ebx
+	leal	8(%rsi), %r12d
+	subl	%r10d, %r11d
+.LVL32:
+.LBB131:
+.LBB132:
+.LBB133:
+	.loc 1 165 34 is_stmt 0 view .LVU143
+	movl	$1, %r8d
+.LBB134:
+.LBB135:
+	.loc 1 102 36 view .LVU144
+	movq	frame_buffer(%rip), %rdx
+.LBE135:
+.LBE134:
+.LBE133:
+.LBE132:
+	.loc 1 162 34 view .LVU145
+	movq	glyph_data(%rip), %r13
+.LBB160:
+.LBB156:
+.LBB136:
+.LBB137:
+.LBB138:
+.LBB139:
+	.loc 1 88 38 view .LVU146
+	movq	24(%rdx), %rbp
+.LBE139:
+.LBE138:
+	.loc 1 102 15 view .LVU147
+	movq	(%rdx), %r9
+.LBB143:
+.LBB140:
+	.loc 1 88 38 view .LVU148
+	shrq	$2, %rbp
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 88 38 view .LVU149
+.LBE140:
+.LBE143:
+.LBE137:
+.LBE136:
+.LBE156:
+.LBE160:
+	.loc 1 162 9 is_stmt 1 view .LVU150
+	.loc 1 164 9 view .LVU151
+.LBB161:
+	.loc 1 164 14 view .LVU152
+	.loc 1 164 41 view .LVU153
+.LBB157:
+.LBB151:
+.LBB146:
+.LBB144:
+.LBB141:
+	.loc 1 88 44 is_stmt 0 view .LVU154
+	movl	%ebp, %esi
+.LBE141:
+.LBE144:
+.LBE146:
+.LBE151:
+.LBE157:
+.LBE161:
+	.loc 1 162 44 view .LVU155
+	leal	(%r11,%r10), %eax
+.LBB162:
+	.loc 1 164 18 view .LVU156
+	xorl	%ecx, %ecx
+.LBB158:
+.LBB152:
+.LBB147:
+.LBB145:
+.LBB142:
+	.loc 1 88 44 view .LVU157
+	imull	%r10d, %esi
+.LBE142:
+.LBE145:
+.LBE147:
+.LBE152:
+	.loc 1 166 25 view .LVU158
+	movsbl	0(%r13,%rax), %edi
+	addl	%r12d, %esi
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 165 13 is_stmt 1 view .LVU159
+	.loc 1 166 13 view .LVU160
+	.loc 1 165 34 is_stmt 0 view .LVU161
+	movl	%r8d, %eax
+.LBB153:
+.LBB148:
+	.loc 1 104 11 view .LVU162
+	movl	%esi, %edx
+.LBE148:
+.LBE153:
+	.loc 1 165 34 view .LVU163
+	sall	%cl, %eax
+.LBB154:
+.LBB149:
+	.loc 1 104 11 view .LVU164
+	subl	%ecx, %edx
+.LBE149:
+.LBE154:
+	.loc 1 171 17 view .LVU165
+	testl	%edi, %eax
+	movl	bgcolor(%rip), %eax
+	cmovne	fgcolor(%rip), %eax
+.LBE158:
+	.loc 1 164 54 view .LVU166
+	addl	$1, %ecx
+.LVL35:
+.LBB159:
+.LBB155:
+.LBB150:
+	.loc 1 104 19 view .LVU167
+	movl	%eax, (%r9,%rdx,4)
+.LBE150:
+.LBE155:
+.LBE159:
+	.loc 1 164 54 is_stmt 1 view .LVU168
+.LVL36:
+	.loc 1 164 41 view .LVU169
+	cmpl	$8, %ecx
+	jne	.L27
+.LBE162:
+.LBE131:
+	.loc 1 160 73 view .LVU170
+.LVL37:
+	.loc 1 160 37 view .LVU171
+	addl	$1, %r10d
+.LVL38:
+	.loc 1 160 37 is_stmt 0 view .LVU172
+	cmpl	%ebx, %r10d
+	jne	.L28
+.LVL39:
+.L23:
+	.loc 1 160 37 view .LVU173
+.LBE130:
+	.loc 1 175 1 view .LVU174
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	_render_glyph, .-_render_glyph
+	.p2align 4
+	.globl	_clear_cursor
+	.type	_clear_cursor, @function
+_clear_cursor:
+.LFB41:
+	.loc 1 181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU176
+.LBB163:
+	.loc 1 182 10 view .LVU177
+.LVL40:
+	.loc 1 182 28 view .LVU178
+	movl	glyph_height(%rip), %eax
+	testl	%eax, %eax
+	je	.L33
+.LBB164:
+.LBB165:
+	.loc 1 102 36 is_stmt 0 view .LVU179
+	movq	frame_buffer(%rip), %rax
+.LBE165:
+.LBE164:
+	.loc 1 182 19 view .LVU180
+	xorl	%edx, %edx
+.LBB178:
+.LBB174:
+.LBB166:
+.LBB167:
+	.loc 1 88 38 view .LVU181
+	movq	24(%rax), %rsi
+.LBE167:
+.LBE166:
+	.loc 1 102 15 view .LVU182
+	movq	(%rax), %rdi
+.LBB171:
+.LBB168:
+	.loc 1 88 38 view .LVU183
+	shrq	$2, %rsi
+.LVL41:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 88 38 view .LVU184
+.LBE168:
+.LBE171:
+.LBE174:
+.LBE178:
+	.loc 1 183 9 is_stmt 1 discriminator 3 view .LVU185
+.LBB179:
+.LBI164:
+	.loc 1 100 20 discriminator 3 view .LVU186
+.LBB175:
+	.loc 1 102 5 discriminator 3 view .LVU187
+	.loc 1 103 5 discriminator 3 view .LVU188
+.LBB172:
+.LBI166:
+	.loc 1 86 24 discriminator 3 view .LVU189
+.LBB169:
+	.loc 1 88 5 discriminator 3 view .LVU190
+	.loc 1 88 5 is_stmt 0 discriminator 3 view .LVU191
+.LBE169:
+.LBE172:
+	.loc 1 104 5 is_stmt 1 discriminator 3 view .LVU192
+.LBE175:
+.LBE179:
+	.loc 1 183 9 is_stmt 0 discriminator 3 view .LVU193
+	movl	cursor_y(%rip), %eax
+.LBB180:
+.LBB176:
+	.loc 1 104 19 discriminator 3 view .LVU194
+	movl	bgcolor(%rip), %ecx
+.LBE176:
+.LBE180:
+	.loc 1 183 9 discriminator 3 view .LVU195
+	addl	%edx, %eax
+.LVL42:
+	.loc 1 182 45 discriminator 3 view .LVU196
+	addl	$1, %edx
+.LVL43:
+.LBB181:
+.LBB177:
+.LBB173:
+.LBB170:
+	.loc 1 88 44 discriminator 3 view .LVU197
+	imull	%esi, %eax
+.LVL44:
+	.loc 1 88 44 discriminator 3 view .LVU198
+.LBE170:
+.LBE173:
+	.loc 1 104 11 discriminator 3 view .LVU199
+	addl	cursor_x(%rip), %eax
+	.loc 1 104 19 discriminator 3 view .LVU200
+	movl	%ecx, (%rdi,%rax,4)
+.LVL45:
+	.loc 1 104 19 discriminator 3 view .LVU201
+.LBE177:
+.LBE181:
+	.loc 1 182 45 is_stmt 1 discriminator 3 view .LVU202
+	.loc 1 182 28 discriminator 3 view .LVU203
+	cmpl	glyph_height(%rip), %edx
+	jb	.L35
+.LVL46:
+.L33:
+	.loc 1 182 28 is_stmt 0 discriminator 3 view .LVU204
+.LBE163:
+	.loc 1 185 1 view .LVU205
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	_clear_cursor, .-_clear_cursor
+	.p2align 4
+	.globl	_render_cursor
+	.type	_render_cursor, @function
+_render_cursor:
+.LFB42:
+	.loc 1 190 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 191 5 view .LVU207
+	.loc 1 191 8 is_stmt 0 view .LVU208
+	cmpb	$0, cursor_visible(%rip)
+	je	.L37
+	xorl	%eax, %eax
+	jmp	_render_cursor.part.0
+.LVL47:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.loc 1 202 1 view .LVU209
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	_render_cursor, .-_render_cursor
+	.p2align 4
+	.globl	term_cblink
+	.type	term_cblink, @function
+term_cblink:
+.LFB43:
+	.loc 1 208 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 209 5 view .LVU211
+.LBB192:
+.LBI192:
+	.file 3 "src/include/cpu.h"
+	.loc 3 284 20 view .LVU212
+.LBB193:
+	.loc 3 286 5 view .LVU213
+#APP
+# 286 "src/include/cpu.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.LBE193:
+.LBE192:
+	.loc 1 210 5 view .LVU214
+.LBB194:
+.LBI194:
+	.file 4 "src/include/atomic.h"
+	.loc 4 27 20 view .LVU215
+.LVL48:
+.LBB195:
+	.loc 4 29 12 is_stmt 0 view .LVU216
+	movl	$1, %edx
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.loc 4 31 5 is_stmt 1 view .LVU217
+	.loc 4 29 12 view .LVU218
+	movl	%edx, %eax
+	xchgb	_cursor_lock(%rip), %al
+	testb	%al, %al
+	jne	.L40
+.LVL49:
+	.loc 4 29 12 is_stmt 0 view .LVU219
+.LBE195:
+.LBE194:
+	.loc 1 212 5 is_stmt 1 view .LVU220
+	movzbl	cursor_visible(%rip), %r8d
+	xorl	$1, %r8d
+	.loc 1 212 20 is_stmt 0 view .LVU221
+	movb	%r8b, cursor_visible(%rip)
+	.loc 1 213 5 is_stmt 1 view .LVU222
+	call	_clear_cursor
+.LVL50:
+	.loc 1 214 5 view .LVU223
+.LBB196:
+.LBI196:
+	.loc 1 189 6 view .LVU224
+.LBB197:
+	.loc 1 191 5 view .LVU225
+	.loc 1 191 8 is_stmt 0 view .LVU226
+	testb	%r8b, %r8b
+	je	.L41
+	xorl	%eax, %eax
+	call	_render_cursor.part.0
+.LVL51:
+.L41:
+.LBE197:
+.LBE196:
+	.loc 1 216 5 is_stmt 1 view .LVU227
+.LBB198:
+.LBI198:
+	.loc 4 34 20 view .LVU228
+.LBB199:
+	.loc 4 36 5 view .LVU229
+	movb	$0, _cursor_lock(%rip)
+.LVL52:
+	.loc 4 36 5 is_stmt 0 view .LVU230
+.LBE199:
+.LBE198:
+	.loc 1 217 5 is_stmt 1 view .LVU231
+.LBB200:
+.LBI200:
+	.loc 3 289 20 view .LVU232
+.LBB201:
+	.loc 3 291 5 view .LVU233
+#APP
+# 291 "src/include/cpu.h" 1
+	sti
+# 0 "" 2
+#NO_APP
+.LBE201:
+.LBE200:
+	.loc 1 218 1 is_stmt 0 view .LVU234
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	term_cblink, .-term_cblink
+	.p2align 4
+	.globl	_render_input_line
+	.type	_render_input_line, @function
+_render_input_line:
+.LFB44:
+	.loc 1 224 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 227 5 view .LVU236
+	.loc 1 224 1 is_stmt 0 view .LVU237
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 228 61 view .LVU238
+	movl	render_x(%rip), %ecx
+	.loc 1 228 46 view .LVU239
+	movl	render_y(%rip), %edx
+	.loc 1 227 20 view .LVU240
+	movl	$0, input_render_x(%rip)
+	.loc 1 228 5 is_stmt 1 view .LVU241
+	.loc 1 228 61 is_stmt 0 view .LVU242
+	testl	%ecx, %ecx
+	je	.L47
+	.loc 1 228 61 discriminator 1 view .LVU243
+	addl	glyph_height(%rip), %edx
+.L47:
+	.loc 1 230 10 discriminator 4 view .LVU244
+	movl	$8227, %eax
+	.loc 1 228 20 discriminator 4 view .LVU245
+	movl	%edx, input_render_y(%rip)
+	.loc 1 230 5 is_stmt 1 discriminator 4 view .LVU246
+.LBB202:
+.LBB203:
+	.loc 1 79 1 is_stmt 0 discriminator 4 view .LVU247
+	xorl	%esi, %esi
+.LBE203:
+.LBE202:
+	.loc 1 232 11 discriminator 4 view .LVU248
+	leaq	13(%rsp), %rbx
+	.loc 1 230 10 discriminator 4 view .LVU249
+	movw	%ax, 13(%rsp)
+	movb	$0, 15(%rsp)
+	.loc 1 232 5 is_stmt 1 discriminator 4 view .LVU250
+.LVL53:
+	.loc 1 234 5 discriminator 4 view .LVU251
+.LBB205:
+.LBI202:
+	.loc 1 76 13 discriminator 4 view .LVU252
+.LBB204:
+	.loc 1 78 5 discriminator 4 view .LVU253
+	.loc 1 78 13 is_stmt 0 discriminator 4 view .LVU254
+	movl	$4500223, fgcolor(%rip)
+	.loc 1 79 1 discriminator 4 view .LVU255
+	jmp	.L49
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+	.loc 1 79 1 discriminator 4 view .LVU256
+.LBE204:
+.LBE205:
+	.loc 1 237 9 view .LVU257
+	movl	input_render_y(%rip), %edx
+.L49:
+	.loc 1 236 5 is_stmt 1 discriminator 1 view .LVU258
+	.loc 1 237 9 discriminator 1 view .LVU259
+	movsbl	(%rbx), %edi
+	.loc 1 241 11 is_stmt 0 discriminator 1 view .LVU260
+	addq	$1, %rbx
+.LVL55:
+	.loc 1 237 9 discriminator 1 view .LVU261
+	call	_render_glyph
+.LVL56:
+	.loc 1 238 9 is_stmt 1 discriminator 1 view .LVU262
+	.loc 1 238 24 is_stmt 0 discriminator 1 view .LVU263
+	movl	glyph_width(%rip), %esi
+	addl	input_render_x(%rip), %esi
+	.loc 1 242 17 discriminator 1 view .LVU264
+	cmpb	$0, (%rbx)
+	.loc 1 238 24 discriminator 1 view .LVU265
+	movl	%esi, input_render_x(%rip)
+	.loc 1 241 9 is_stmt 1 discriminator 1 view .LVU266
+.LVL57:
+	.loc 1 242 17 discriminator 1 view .LVU267
+	jne	.L52
+	.loc 1 244 5 view .LVU268
+.LVL58:
+.LBB206:
+.LBI206:
+	.loc 1 76 13 view .LVU269
+.LBB207:
+	.loc 1 78 5 view .LVU270
+.LBE207:
+.LBE206:
+.LBB209:
+.LBB210:
+	.loc 1 191 8 is_stmt 0 view .LVU271
+	cmpb	$0, cursor_visible(%rip)
+.LBE210:
+.LBE209:
+.LBB214:
+.LBB208:
+	.loc 1 78 13 view .LVU272
+	movl	$13421772, fgcolor(%rip)
+.LVL59:
+	.loc 1 78 13 view .LVU273
+.LBE208:
+.LBE214:
+	.loc 1 246 5 is_stmt 1 view .LVU274
+.LBB215:
+.LBI209:
+	.loc 1 189 6 view .LVU275
+.LBB211:
+	.loc 1 191 5 view .LVU276
+	.loc 1 191 8 is_stmt 0 view .LVU277
+	je	.L46
+.LBE211:
+.LBE215:
+	.loc 1 247 1 view .LVU278
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+.LBB216:
+.LBB212:
+	xorl	%eax, %eax
+.LBE212:
+.LBE216:
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL60:
+.LBB217:
+.LBB213:
+	.loc 1 247 1 view .LVU279
+	jmp	_render_cursor.part.0
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.cfi_restore_state
+	.loc 1 247 1 view .LVU280
+.LBE213:
+.LBE217:
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL62:
+	.loc 1 247 1 view .LVU281
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	_render_input_line, .-_render_input_line
+	.p2align 4
+	.globl	_move_to_next_line
+	.type	_move_to_next_line, @function
+_move_to_next_line:
+.LFB45:
+	.loc 1 254 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 255 5 view .LVU283
+	.loc 1 254 1 is_stmt 0 view .LVU284
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 255 8 view .LVU285
+	movl	render_x(%rip), %eax
+	testl	%eax, %eax
+	je	.L58
+.L54:
+	.loc 1 263 5 is_stmt 1 view .LVU286
+	.loc 1 267 32 is_stmt 0 view .LVU287
+	movq	frame_buffer(%rip), %rcx
+	.loc 1 264 14 view .LVU288
+	movl	render_y(%rip), %edi
+	.loc 1 263 14 view .LVU289
+	movl	$0, render_x(%rip)
+	.loc 1 264 5 is_stmt 1 view .LVU290
+	.loc 1 264 14 is_stmt 0 view .LVU291
+	movl	glyph_height(%rip), %r8d
+	.loc 1 267 41 view .LVU292
+	movq	16(%rcx), %rdx
+	.loc 1 264 14 view .LVU293
+	addl	%r8d, %edi
+	movq	%r8, %rax
+	.loc 1 267 18 view .LVU294
+	movl	%edi, %esi
+	.loc 1 267 41 view .LVU295
+	subq	%r8, %rdx
+	.loc 1 264 14 view .LVU296
+	movl	%edi, render_y(%rip)
+	.loc 1 267 5 is_stmt 1 view .LVU297
+	.loc 1 275 26 is_stmt 0 view .LVU298
+	addl	%edi, %eax
+	.loc 1 267 8 view .LVU299
+	cmpq	%rsi, %rdx
+	jb	.L59
+.L56:
+	.loc 1 273 5 is_stmt 1 view .LVU300
+.LVL63:
+	.loc 1 274 5 view .LVU301
+.LBB218:
+.LBI218:
+	.loc 1 86 24 view .LVU302
+.LBB219:
+	.loc 1 88 5 view .LVU303
+	.loc 1 88 38 is_stmt 0 view .LVU304
+	movq	24(%rcx), %rdx
+.LBE219:
+.LBE218:
+	.loc 1 276 5 view .LVU305
+	xorl	%esi, %esi
+.LBB221:
+.LBB220:
+	.loc 1 88 38 view .LVU306
+	shrq	$2, %rdx
+.LVL64:
+	.loc 1 88 38 view .LVU307
+.LBE220:
+.LBE221:
+	.loc 1 275 5 is_stmt 1 view .LVU308
+.LBB222:
+.LBI222:
+	.loc 1 86 24 view .LVU309
+.LBB223:
+	.loc 1 88 5 view .LVU310
+	.loc 1 88 5 is_stmt 0 view .LVU311
+.LBE223:
+.LBE222:
+	.loc 1 276 5 is_stmt 1 view .LVU312
+	.loc 1 276 70 is_stmt 0 view .LVU313
+	imull	%edx, %edi
+.LVL65:
+.LBB225:
+.LBB224:
+	.loc 1 88 44 view .LVU314
+	imull	%edx, %eax
+.LVL66:
+	.loc 1 88 44 view .LVU315
+.LBE224:
+.LBE225:
+	.loc 1 276 46 view .LVU316
+	addl	8(%rcx), %eax
+	leaq	0(,%rax,4), %rdx
+	.loc 1 276 70 view .LVU317
+	salq	$2, %rdi
+	.loc 1 276 58 view .LVU318
+	subq	%rdi, %rdx
+	.loc 1 276 67 view .LVU319
+	addq	(%rcx), %rdi
+	.loc 1 276 5 view .LVU320
+	call	memset@PLT
+.LVL67:
+	.loc 1 278 5 is_stmt 1 view .LVU321
+	xorl	%eax, %eax
+	.loc 1 279 1 is_stmt 0 view .LVU322
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 278 5 view .LVU323
+	jmp	_render_input_line
+.LVL68:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.cfi_restore_state
+.LBB226:
+	.loc 1 257 36 view .LVU324
+	movq	frame_buffer(%rip), %rsi
+	.loc 1 258 31 view .LVU325
+	movl	render_y(%rip), %eax
+	.loc 1 257 9 is_stmt 1 view .LVU326
+.LVL69:
+	.loc 1 258 9 view .LVU327
+.LBB227:
+.LBI227:
+	.loc 1 86 24 view .LVU328
+.LBB228:
+	.loc 1 88 5 view .LVU329
+	.loc 1 88 38 is_stmt 0 view .LVU330
+	movq	24(%rsi), %rcx
+.LBE228:
+.LBE227:
+	.loc 1 260 74 view .LVU331
+	movl	%eax, %edi
+	.loc 1 259 30 view .LVU332
+	addl	glyph_height(%rip), %eax
+.LVL70:
+	.loc 1 259 30 view .LVU333
+	movl	%eax, %edx
+.LBB230:
+.LBB229:
+	.loc 1 88 38 view .LVU334
+	shrq	$2, %rcx
+.LVL71:
+	.loc 1 88 38 view .LVU335
+.LBE229:
+.LBE230:
+	.loc 1 259 9 is_stmt 1 view .LVU336
+.LBB231:
+.LBI231:
+	.loc 1 86 24 view .LVU337
+.LBB232:
+	.loc 1 88 5 view .LVU338
+	.loc 1 88 5 is_stmt 0 view .LVU339
+.LBE232:
+.LBE231:
+	.loc 1 260 9 is_stmt 1 view .LVU340
+	.loc 1 260 74 is_stmt 0 view .LVU341
+	imull	%ecx, %edi
+.LBB234:
+.LBB233:
+	.loc 1 88 44 view .LVU342
+	imull	%ecx, %edx
+.LBE233:
+.LBE234:
+	.loc 1 260 50 view .LVU343
+	addl	8(%rsi), %edx
+	salq	$2, %rdx
+	.loc 1 260 74 view .LVU344
+	salq	$2, %rdi
+	.loc 1 260 62 view .LVU345
+	subq	%rdi, %rdx
+	.loc 1 260 71 view .LVU346
+	addq	(%rsi), %rdi
+	.loc 1 260 9 view .LVU347
+	xorl	%esi, %esi
+.LVL72:
+	.loc 1 260 9 view .LVU348
+	call	memset@PLT
+.LVL73:
+	.loc 1 260 9 view .LVU349
+	jmp	.L54
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 260 9 view .LVU350
+.LBE226:
+	.loc 1 268 9 is_stmt 1 view .LVU351
+	xorl	%eax, %eax
+	call	_shift_screen_up
+.LVL75:
+	.loc 1 269 9 view .LVU352
+	.loc 1 269 18 is_stmt 0 view .LVU353
+	movl	render_y(%rip), %eax
+	.loc 1 273 32 view .LVU354
+	movq	frame_buffer(%rip), %rcx
+	.loc 1 269 18 view .LVU355
+	movl	%eax, %edi
+	subl	glyph_height(%rip), %edi
+	movl	%edi, render_y(%rip)
+	jmp	.L56
+	.cfi_endproc
+.LFE45:
+	.size	_move_to_next_line, .-_move_to_next_line
+	.p2align 4
+	.globl	tprintf
+	.type	tprintf, @function
+tprintf:
+.LVL76:
+.LFB46:
+	.loc 1 282 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 283 5 view .LVU357
+	.loc 1 282 1 is_stmt 0 view .LVU358
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$336, %rsp
+	.cfi_def_cfa_offset 352
+	.loc 1 283 8 view .LVU359
+	cmpb	$0, is_ready(%rip)
+	.loc 1 282 1 view .LVU360
+	movq	%rsi, 296(%rsp)
+	movq	%rdx, 304(%rsp)
+	movq	%rcx, 312(%rsp)
+	movq	%r8, 320(%rsp)
+	movq	%r9, 328(%rsp)
+	.loc 1 283 8 view .LVU361
+	jne	.L71
+.LVL77:
+.L60:
+	.loc 1 325 1 view .LVU362
+	addq	$336, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	ret
+.LVL78:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.cfi_restore_state
+	.loc 1 287 5 is_stmt 1 view .LVU363
+	.loc 1 289 5 view .LVU364
+	.loc 1 290 4 view .LVU365
+	leaq	352(%rsp), %rax
+	.loc 1 291 5 is_stmt 0 view .LVU366
+	leaq	32(%rsp), %rbx
+	movq	%rdi, %rdx
+	movl	$256, %esi
+	.loc 1 290 4 view .LVU367
+	movq	%rax, 16(%rsp)
+	.loc 1 291 5 view .LVU368
+	leaq	8(%rsp), %rcx
+	.loc 1 290 4 view .LVU369
+	leaq	288(%rsp), %rax
+	.loc 1 291 5 view .LVU370
+	movq	%rbx, %rdi
+.LVL79:
+	.loc 1 290 4 view .LVU371
+	movl	$8, 8(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 291 5 is_stmt 1 view .LVU372
+	call	vsnprintf@PLT
+.LVL80:
+	.loc 1 292 4 view .LVU373
+	.loc 1 295 5 view .LVU374
+	.loc 1 295 8 is_stmt 0 view .LVU375
+	movl	render_x(%rip), %eax
+	testl	%eax, %eax
+	jne	.L66
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L64:
+.LVL81:
+	.loc 1 324 18 is_stmt 1 view .LVU376
+	cmpb	$0, (%rbx)
+	je	.L60
+.LVL82:
+.L66:
+	.loc 1 305 5 view .LVU377
+	.loc 1 307 9 view .LVU378
+	.loc 1 307 13 is_stmt 0 view .LVU379
+	movsbl	(%rbx), %edi
+	.loc 1 310 15 view .LVU380
+	addq	$1, %rbx
+.LVL83:
+	.loc 1 307 12 view .LVU381
+	cmpb	$10, %dil
+	je	.L70
+	.loc 1 314 9 is_stmt 1 view .LVU382
+	movl	render_y(%rip), %edx
+	movl	render_x(%rip), %esi
+	call	_render_glyph
+.LVL84:
+	.loc 1 317 9 view .LVU383
+	.loc 1 317 18 is_stmt 0 view .LVU384
+	movl	render_x(%rip), %edx
+	movzbl	glyph_padding(%rip), %eax
+	.loc 1 319 44 view .LVU385
+	movl	glyph_width(%rip), %ecx
+	.loc 1 317 18 view .LVU386
+	leal	8(%rdx,%rax), %eax
+	.loc 1 319 44 view .LVU387
+	movq	frame_buffer(%rip), %rdx
+	.loc 1 317 18 view .LVU388
+	movl	%eax, render_x(%rip)
+	.loc 1 319 9 is_stmt 1 view .LVU389
+	.loc 1 319 44 is_stmt 0 view .LVU390
+	movq	8(%rdx), %rdx
+	subq	%rcx, %rdx
+	.loc 1 319 12 view .LVU391
+	cmpq	%rax, %rdx
+	jnb	.L64
+.L70:
+	.loc 1 320 13 is_stmt 1 view .LVU392
+	xorl	%eax, %eax
+	call	_move_to_next_line
+.LVL85:
+	.loc 1 323 9 view .LVU393
+	.loc 1 323 9 is_stmt 0 view .LVU394
+	jmp	.L64
+.LVL86:
+	.p2align 4,,10
+	.p2align 3
+.L72:
+.LBB235:
+	.loc 1 296 9 is_stmt 1 view .LVU395
+	.loc 1 296 36 is_stmt 0 view .LVU396
+	movq	frame_buffer(%rip), %rsi
+.LVL87:
+	.loc 1 297 9 is_stmt 1 view .LVU397
+	.loc 1 297 32 is_stmt 0 view .LVU398
+	movl	render_y(%rip), %eax
+.LVL88:
+.LBB236:
+.LBI236:
+	.loc 1 86 24 is_stmt 1 view .LVU399
+.LBB237:
+	.loc 1 88 5 view .LVU400
+	.loc 1 88 38 is_stmt 0 view .LVU401
+	movq	24(%rsi), %rcx
+.LBE237:
+.LBE236:
+	.loc 1 299 74 view .LVU402
+	movl	%eax, %edi
+	.loc 1 298 30 view .LVU403
+	addl	glyph_height(%rip), %eax
+.LVL89:
+	.loc 1 298 30 view .LVU404
+	movl	%eax, %edx
+.LBB239:
+.LBB238:
+	.loc 1 88 38 view .LVU405
+	shrq	$2, %rcx
+.LVL90:
+	.loc 1 88 38 view .LVU406
+.LBE238:
+.LBE239:
+	.loc 1 298 9 is_stmt 1 view .LVU407
+.LBB240:
+.LBI240:
+	.loc 1 86 24 view .LVU408
+.LBB241:
+	.loc 1 88 5 view .LVU409
+	.loc 1 88 5 is_stmt 0 view .LVU410
+.LBE241:
+.LBE240:
+	.loc 1 299 9 is_stmt 1 view .LVU411
+	.loc 1 299 74 is_stmt 0 view .LVU412
+	imull	%ecx, %edi
+.LBB243:
+.LBB242:
+	.loc 1 88 44 view .LVU413
+	imull	%ecx, %edx
+.LBE242:
+.LBE243:
+	.loc 1 299 50 view .LVU414
+	addl	8(%rsi), %edx
+	salq	$2, %rdx
+	.loc 1 299 74 view .LVU415
+	salq	$2, %rdi
+	.loc 1 299 62 view .LVU416
+	subq	%rdi, %rdx
+	.loc 1 299 71 view .LVU417
+	addq	(%rsi), %rdi
+	.loc 1 299 9 view .LVU418
+	xorl	%esi, %esi
+.LVL91:
+	.loc 1 299 9 view .LVU419
+	call	memset@PLT
+.LVL92:
+	.loc 1 299 9 view .LVU420
+	jmp	.L66
+.LBE235:
+	.cfi_endproc
+.LFE46:
+	.size	tprintf, .-tprintf
+	.section	.rodata.str1.1
+.LC2:
+	.string	"Font: %dx%d\n"
+.LC3:
+	.string	"Resolution: %dx%d\n"
+.LC4:
+	.string	"BPP: %d\n"
+.LC5:
+	.string	"Pitch: %d\n"
+	.text
+	.p2align 4
+	.globl	term_init
+	.type	term_init, @function
+term_init:
+.LFB47:
+	.loc 1 328 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 329 5 view .LVU422
+	.loc 1 328 1 is_stmt 0 view .LVU423
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 329 48 view .LVU424
+	movq	40+framebuffer_request(%rip), %rax
+	.loc 1 329 62 view .LVU425
+	movq	16(%rax), %rax
+	movq	(%rax), %rax
+	.loc 1 329 18 view .LVU426
+	movq	%rax, frame_buffer(%rip)
+	.loc 1 331 5 is_stmt 1 view .LVU427
+	xorl	%eax, %eax
+	call	_load_font
+.LVL93:
+	.loc 1 333 5 view .LVU428
+	.loc 1 333 51 is_stmt 0 view .LVU429
+	movq	font_header(%rip), %rax
+	.loc 1 333 28 view .LVU430
+	movq	frame_buffer(%rip), %r9
+	.loc 1 333 37 view .LVU431
+	xorl	%edx, %edx
+	.loc 1 333 65 view .LVU432
+	movzbl	glyph_padding(%rip), %esi
+	.loc 1 333 51 view .LVU433
+	movzbl	3(%rax), %ecx
+	.loc 1 333 37 view .LVU434
+	movq	16(%r9), %rax
+	.loc 1 333 65 view .LVU435
+	addl	%esi, %ecx
+	movslq	%ecx, %rdi
+	.loc 1 337 18 view .LVU436
+	movl	%ecx, glyph_height(%rip)
+	.loc 1 339 5 view .LVU437
+	subl	%esi, %ecx
+	.loc 1 333 37 view .LVU438
+	divq	%rdi
+	.loc 1 334 41 view .LVU439
+	leal	8(%rsi), %edi
+	.loc 1 334 36 view .LVU440
+	xorl	%edx, %edx
+	.loc 1 339 5 view .LVU441
+	movl	$8, %esi
+	.loc 1 334 41 view .LVU442
+	movslq	%edi, %r8
+	.loc 1 336 17 view .LVU443
+	movl	%edi, glyph_width(%rip)
+	.loc 1 339 5 view .LVU444
+	leaq	.LC2(%rip), %rdi
+	.loc 1 333 14 view .LVU445
+	movl	%eax, max_rows(%rip)
+	.loc 1 334 5 is_stmt 1 view .LVU446
+	.loc 1 334 36 is_stmt 0 view .LVU447
+	movq	8(%r9), %rax
+	divq	%r8
+	.loc 1 339 5 view .LVU448
+	movl	%ecx, %edx
+	.loc 1 334 14 view .LVU449
+	movl	%eax, max_cols(%rip)
+	.loc 1 336 5 is_stmt 1 view .LVU450
+	.loc 1 337 5 view .LVU451
+	.loc 1 339 5 view .LVU452
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL94:
+	.loc 1 340 5 view .LVU453
+	.loc 1 340 69 is_stmt 0 view .LVU454
+	movq	frame_buffer(%rip), %rax
+	.loc 1 340 5 view .LVU455
+	leaq	.LC3(%rip), %rdi
+	movq	16(%rax), %rdx
+	movq	8(%rax), %rsi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL95:
+	.loc 1 341 5 is_stmt 1 view .LVU456
+	.loc 1 341 38 is_stmt 0 view .LVU457
+	movq	frame_buffer(%rip), %rax
+	.loc 1 341 5 view .LVU458
+	leaq	.LC4(%rip), %rdi
+	movzwl	32(%rax), %esi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL96:
+	.loc 1 342 5 is_stmt 1 view .LVU459
+	movq	frame_buffer(%rip), %rax
+	leaq	.LC5(%rip), %rdi
+	movq	24(%rax), %rsi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL97:
+	.loc 1 344 5 view .LVU460
+	xorl	%eax, %eax
+	call	_render_input_line
+.LVL98:
+	.loc 1 346 5 view .LVU461
+	.loc 1 346 14 is_stmt 0 view .LVU462
+	movb	$1, is_ready(%rip)
+	.loc 1 347 1 view .LVU463
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE47:
+	.size	term_init, .-term_init
+	.p2align 4
+	.globl	term_clear
+	.type	term_clear, @function
+term_clear:
+.LFB48:
+	.loc 1 353 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 354 5 view .LVU465
+.LBB250:
+.LBI250:
+	.loc 1 91 20 view .LVU466
+.LBB251:
+	.loc 1 94 5 view .LVU467
+.LBE251:
+.LBE250:
+	.loc 1 353 1 is_stmt 0 view .LVU468
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB263:
+.LBB262:
+	.loc 1 94 32 view .LVU469
+	movq	frame_buffer(%rip), %rax
+.LVL99:
+	.loc 1 95 5 is_stmt 1 view .LVU470
+.LBB252:
+.LBI252:
+	.loc 1 86 24 view .LVU471
+.LBB253:
+	.loc 1 88 5 view .LVU472
+	.loc 1 88 5 is_stmt 0 view .LVU473
+.LBE253:
+.LBE252:
+	.loc 1 96 5 is_stmt 1 view .LVU474
+.LBB256:
+.LBI256:
+	.loc 1 86 24 view .LVU475
+.LBB257:
+	.loc 1 88 5 view .LVU476
+	.loc 1 88 5 is_stmt 0 view .LVU477
+.LBE257:
+.LBE256:
+	.loc 1 97 5 is_stmt 1 view .LVU478
+	xorl	%esi, %esi
+.LBB259:
+.LBB254:
+	.loc 1 88 38 is_stmt 0 view .LVU479
+	movq	24(%rax), %rdx
+.LBE254:
+.LBE259:
+	.loc 1 97 5 view .LVU480
+	movq	(%rax), %rdi
+.LBB260:
+.LBB255:
+	.loc 1 88 38 view .LVU481
+	shrq	$2, %rdx
+.LBE255:
+.LBE260:
+.LBB261:
+.LBB258:
+	.loc 1 88 44 view .LVU482
+	imull	16(%rax), %edx
+.LBE258:
+.LBE261:
+	.loc 1 97 46 view .LVU483
+	addl	8(%rax), %edx
+	salq	$2, %rdx
+	.loc 1 97 5 view .LVU484
+	call	memset@PLT
+.LVL100:
+	.loc 1 97 5 view .LVU485
+.LBE262:
+.LBE263:
+	.loc 1 355 5 is_stmt 1 view .LVU486
+	.loc 1 356 5 is_stmt 0 view .LVU487
+	xorl	%eax, %eax
+	.loc 1 355 81 view .LVU488
+	movl	$0, cursor_y(%rip)
+	.loc 1 355 70 view .LVU489
+	movl	$0, cursor_x(%rip)
+	.loc 1 355 59 view .LVU490
+	movl	$0, input_render_y(%rip)
+	.loc 1 355 42 view .LVU491
+	movl	$0, input_render_x(%rip)
+	.loc 1 355 25 view .LVU492
+	movl	$0, render_y(%rip)
+	.loc 1 355 14 view .LVU493
+	movl	$0, render_x(%rip)
+	.loc 1 356 5 is_stmt 1 view .LVU494
+	.loc 1 357 1 is_stmt 0 view .LVU495
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 356 5 view .LVU496
+	jmp	_render_input_line
+.LVL101:
+	.cfi_endproc
+.LFE48:
+	.size	term_clear, .-term_clear
+	.section	.rodata.str1.1
+.LC6:
+	.string	"hello"
+.LC7:
+	.string	"World!\n"
+.LC8:
+	.string	"cls"
+.LC9:
+	.string	"time"
+.LC10:
+	.string	"Kerner Time: %lums\n"
+.LC11:
+	.string	"stime"
+.LC12:
+	.string	"Kerner Time: %lus\n"
+.LC13:
+	.string	"memstat"
+.LC14:
+	.string	"memdump"
+.LC15:
+	.string	"PMM stats written to serial.\n"
+.LC16:
+	.string	"membench"
+.LC17:
+	.string	"colorbench"
+.LC18:
+	.string	"allocbench"
+.LC19:
+	.string	"vmstat"
+.LC20:
+	.string	"slabinfo"
+.LC21:
+	.string	"heapprof"
+.LC22:
+	.string	"heapdump"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC23:
+	.string	"Heap profile written to serial.\n"
+	.section	.rodata.str1.1
+.LC24:
+	.string	"zeropool"
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"Zero pool: %d pages, %lu hits, %lu misses, %lu percent hit rate\n"
+	.section	.rodata.str1.1
+.LC26:
+	.string	"Unknown command.\n"
+	.text
+	.p2align 4
+	.globl	_handle_cmd
+	.type	_handle_cmd, @function
+_handle_cmd:
+.LFB49:
+	.loc 1 363 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 364 5 view .LVU498
+	.loc 1 363 1 is_stmt 0 view .LVU499
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 364 9 view .LVU500
+	leaq	.LC6(%rip), %rsi
+	.loc 1 363 1 view .LVU501
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 364 9 view .LVU502
+	leaq	input_str(%rip), %rbx
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL102:
+	.loc 1 364 8 view .LVU503
+	testl	%eax, %eax
+	jne	.L78
+	.loc 1 365 9 is_stmt 1 view .LVU504
+	.loc 1 400 1 is_stmt 0 view .LVU505
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	.loc 1 365 9 view .LVU506
+	leaq	.LC7(%rip), %rdi
+	.loc 1 400 1 view .LVU507
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	.loc 1 365 9 view .LVU508
+	jmp	tprintf
+.LVL103:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.cfi_restore_state
+	.loc 1 366 12 is_stmt 1 view .LVU509
+	.loc 1 366 16 is_stmt 0 view .LVU510
+	leaq	.LC8(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL104:
+	.loc 1 366 15 view .LVU511
+	testl	%eax, %eax
+	jne	.L79
+	.loc 1 367 9 is_stmt 1 view .LVU512
+	.loc 1 400 1 is_stmt 0 view .LVU513
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+	.loc 1 367 9 view .LVU514
+	jmp	term_clear
+.LVL105:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.cfi_restore_state
+.LBB267:
+.LBI267:
+	.loc 1 362 6 is_stmt 1 view .LVU515
+.LBB268:
+	.loc 1 368 12 view .LVU516
+	.loc 1 368 16 is_stmt 0 view .LVU517
+	leaq	.LC9(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL106:
+	.loc 1 368 15 view .LVU518
+	testl	%eax, %eax
+	je	.L98
+	.loc 1 370 12 is_stmt 1 view .LVU519
+	.loc 1 370 16 is_stmt 0 view .LVU520
+	leaq	.LC11(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL107:
+	.loc 1 370 15 view .LVU521
+	testl	%eax, %eax
+	jne	.L81
+	.loc 1 371 9 is_stmt 1 view .LVU522
+	movq	kernel_timer_secs(%rip), %rdx
+.LBE268:
+.LBE267:
+	.loc 1 400 1 is_stmt 0 view .LVU523
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LBB289:
+.LBB273:
+	.loc 1 371 9 view .LVU524
+	leaq	.LC12(%rip), %rdi
+	movabsq	$2361183241434822607, %rax
+.LBE273:
+.LBE289:
+	.loc 1 400 1 view .LVU525
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB290:
+.LBB274:
+	.loc 1 371 9 view .LVU526
+	shrq	$3, %rdx
+	mulq	%rdx
+	xorl	%eax, %eax
+	shrq	$4, %rdx
+	movq	%rdx, %rsi
+	jmp	tprintf
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.cfi_restore_state
+	.loc 1 369 9 is_stmt 1 view .LVU527
+	movq	kernel_timer_secs(%rip), %rsi
+.LBE274:
+.LBE290:
+	.loc 1 400 1 is_stmt 0 view .LVU528
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LBB291:
+.LBB275:
+	.loc 1 369 9 view .LVU529
+	leaq	.LC10(%rip), %rdi
+.LBE275:
+.LBE291:
+	.loc 1 400 1 view .LVU530
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB292:
+.LBB276:
+	.loc 1 369 9 view .LVU531
+	jmp	tprintf
+.LVL109:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.cfi_restore_state
+	.loc 1 372 12 is_stmt 1 view .LVU532
+	.loc 1 372 16 is_stmt 0 view .LVU533
+	leaq	.LC13(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL110:
+	.loc 1 372 15 view .LVU534
+	testl	%eax, %eax
+	je	.L99
+	.loc 1 374 12 is_stmt 1 view .LVU535
+	.loc 1 374 16 is_stmt 0 view .LVU536
+	leaq	.LC14(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL111:
+	.loc 1 374 15 view .LVU537
+	testl	%eax, %eax
+	jne	.L83
+	.loc 1 375 9 is_stmt 1 view .LVU538
+	call	kmem_report_serial@PLT
+.LVL112:
+	.loc 1 376 9 view .LVU539
+	leaq	.LC15(%rip), %rdi
+.L97:
+.LBE276:
+.LBE292:
+	.loc 1 400 1 is_stmt 0 view .LVU540
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LBB293:
+.LBB277:
+	.loc 1 398 9 view .LVU541
+	xorl	%eax, %eax
+.LBE277:
+.LBE293:
+	.loc 1 400 1 view .LVU542
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB294:
+.LBB278:
+	.loc 1 398 9 view .LVU543
+	jmp	tprintf
+.LVL113:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+	.loc 1 373 9 is_stmt 1 view .LVU544
+.LBE278:
+.LBE294:
+	.loc 1 400 1 is_stmt 0 view .LVU545
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB295:
+.LBB279:
+	.loc 1 373 9 view .LVU546
+	jmp	kmem_report@PLT
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	.cfi_restore_state
+	.loc 1 377 12 is_stmt 1 view .LVU547
+	.loc 1 377 16 is_stmt 0 view .LVU548
+	leaq	.LC16(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL115:
+	.loc 1 377 15 view .LVU549
+	testl	%eax, %eax
+	jne	.L84
+	.loc 1 378 9 is_stmt 1 view .LVU550
+.LBE279:
+.LBE295:
+	.loc 1 400 1 is_stmt 0 view .LVU551
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB296:
+.LBB280:
+	.loc 1 378 9 view .LVU552
+	jmp	memops_benchmark@PLT
+.LVL116:
+.L84:
+	.cfi_restore_state
+	.loc 1 379 12 is_stmt 1 view .LVU553
+	.loc 1 379 16 is_stmt 0 view .LVU554
+	leaq	.LC17(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL117:
+	.loc 1 379 15 view .LVU555
+	testl	%eax, %eax
+	jne	.L85
+	.loc 1 380 9 is_stmt 1 view .LVU556
+.LBE280:
+.LBE296:
+	.loc 1 400 1 is_stmt 0 view .LVU557
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB297:
+.LBB281:
+	.loc 1 380 9 view .LVU558
+	jmp	kmem_color_benchmark@PLT
+.LVL118:
+.L85:
+	.cfi_restore_state
+	.loc 1 381 12 is_stmt 1 view .LVU559
+	.loc 1 381 16 is_stmt 0 view .LVU560
+	leaq	.LC18(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL119:
+	.loc 1 381 15 view .LVU561
+	testl	%eax, %eax
+	jne	.L86
+	.loc 1 382 9 is_stmt 1 view .LVU562
+.LBE281:
+.LBE297:
+	.loc 1 400 1 is_stmt 0 view .LVU563
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB298:
+.LBB282:
+	.loc 1 382 9 view .LVU564
+	jmp	alloc_benchmark@PLT
+.LVL120:
+.L86:
+	.cfi_restore_state
+	.loc 1 383 12 is_stmt 1 view .LVU565
+	.loc 1 383 16 is_stmt 0 view .LVU566
+	leaq	.LC19(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL121:
+	.loc 1 383 15 view .LVU567
+	testl	%eax, %eax
+	jne	.L87
+	.loc 1 384 9 is_stmt 1 view .LVU568
+.LBE282:
+.LBE298:
+	.loc 1 400 1 is_stmt 0 view .LVU569
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB299:
+.LBB283:
+	.loc 1 384 9 view .LVU570
+	jmp	vm_report@PLT
+.LVL122:
+.L87:
+	.cfi_restore_state
+	.loc 1 385 12 is_stmt 1 view .LVU571
+	.loc 1 385 16 is_stmt 0 view .LVU572
+	leaq	.LC20(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL123:
+	.loc 1 385 15 view .LVU573
+	testl	%eax, %eax
+	jne	.L88
+	.loc 1 386 9 is_stmt 1 view .LVU574
+.LBE283:
+.LBE299:
+	.loc 1 400 1 is_stmt 0 view .LVU575
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB300:
+.LBB284:
+	.loc 1 386 9 view .LVU576
+	jmp	kmem_cache_report@PLT
+.LVL124:
+.L88:
+	.cfi_restore_state
+	.loc 1 387 12 is_stmt 1 view .LVU577
+	.loc 1 387 16 is_stmt 0 view .LVU578
+	leaq	.LC21(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL125:
+	.loc 1 387 15 view .LVU579
+	testl	%eax, %eax
+	jne	.L89
+	.loc 1 388 9 is_stmt 1 view .LVU580
+.LBE284:
+.LBE300:
+	.loc 1 400 1 is_stmt 0 view .LVU581
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB301:
+.LBB285:
+	.loc 1 388 9 view .LVU582
+	jmp	alloc_profile_report@PLT
+.LVL126:
+.L89:
+	.cfi_restore_state
+	.loc 1 389 12 is_stmt 1 view .LVU583
+	.loc 1 389 16 is_stmt 0 view .LVU584
+	leaq	.LC22(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL127:
+	.loc 1 389 15 view .LVU585
+	testl	%eax, %eax
+	jne	.L90
+	.loc 1 390 9 is_stmt 1 view .LVU586
+	call	alloc_profile_report_serial@PLT
+.LVL128:
+	.loc 1 391 9 view .LVU587
+	leaq	.LC23(%rip), %rdi
+	jmp	.L97
+.L90:
+	.loc 1 392 12 view .LVU588
+	.loc 1 392 16 is_stmt 0 view .LVU589
+	leaq	.LC24(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcmp@PLT
+.LVL129:
+	.loc 1 392 15 view .LVU590
+	testl	%eax, %eax
+	jne	.L91
+.LBB269:
+	.loc 1 393 9 is_stmt 1 view .LVU591
+	.loc 1 393 44 is_stmt 0 view .LVU592
+	movq	zero_pool_hits(%rip), %rbx
+	movq	zero_pool_misses(%rip), %rbp
+.LVL130:
+	.loc 1 394 9 is_stmt 1 view .LVU593
+	movq	%rbx, %r12
+	addq	%rbp, %r12
+.LVL131:
+	.loc 1 394 9 is_stmt 0 view .LVU594
+	je	.L92
+	.loc 1 396 43 view .LVU595
+	imulq	$100, %rbx, %rax
+	.loc 1 394 9 view .LVU596
+	xorl	%edx, %edx
+	divq	%r12
+	movq	%rax, %r12
+.LVL132:
+.L92:
+	.loc 1 394 9 view .LVU597
+	xorl	%eax, %eax
+	call	kmem_zero_pool_count@PLT
+.LVL133:
+	movq	%r12, %r8
+	movq	%rbp, %rcx
+	movq	%rbx, %rdx
+	movl	%eax, %esi
+.LBE269:
+.LBE285:
+.LBE301:
+	.loc 1 400 1 view .LVU598
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 24
+.LVL134:
+.LBB302:
+.LBB286:
+.LBB270:
+	.loc 1 394 9 view .LVU599
+	leaq	.LC25(%rip), %rdi
+.LBE270:
+.LBE286:
+.LBE302:
+	.loc 1 400 1 view .LVU600
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 16
+.LVL135:
+.LBB303:
+.LBB287:
+.LBB271:
+	.loc 1 394 9 view .LVU601
+	xorl	%eax, %eax
+.LBE271:
+.LBE287:
+.LBE303:
+	.loc 1 400 1 view .LVU602
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 8
+.LBB304:
+.LBB288:
+.LBB272:
+	.loc 1 394 9 view .LVU603
+	jmp	tprintf
+.LVL136:
+.L91:
+	.cfi_restore_state
+	.loc 1 394 9 view .LVU604
+.LBE272:
+	.loc 1 398 9 is_stmt 1 view .LVU605
+	leaq	.LC26(%rip), %rdi
+	jmp	.L97
+.LBE288:
+.LBE304:
+	.cfi_endproc
+.LFE49:
+	.size	_handle_cmd, .-_handle_cmd
+	.section	.rodata.str1.1
+.LC27:
+	.string	"# "
+.LC28:
+	.string	"\n"
+	.text
+	.p2align 4
+	.globl	term_keyevent
+	.type	term_keyevent, @function
+term_keyevent:
+.LVL137:
+.LFB50:
+	.loc 1 406 1 view -0
+	.cfi_startproc
+	.loc 1 407 5 view .LVU607
+	.loc 1 407 8 is_stmt 0 view .LVU608
+	cmpb	$0, 1(%rdi)
+	je	.L116
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.loc 1 406 1 discriminator 1 view .LVU609
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 407 34 discriminator 1 view .LVU610
+	movzbl	(%rdi), %eax
+	.loc 1 407 29 discriminator 1 view .LVU611
+	cmpb	$28, %al
+	je	.L117
+.LVL138:
+	.loc 1 419 5 is_stmt 1 discriminator 1 view .LVU612
+	.loc 1 419 29 is_stmt 0 discriminator 1 view .LVU613
+	cmpb	$14, %al
+	je	.L118
+.L104:
+	.loc 1 440 34 discriminator 1 view .LVU614
+	movsbl	2(%rbx), %edi
+	.loc 1 440 29 discriminator 1 view .LVU615
+	testb	%dil, %dil
+	jne	.L119
+.LVL139:
+.L100:
+	.loc 1 453 1 view .LVU616
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+	ret
+.LVL140:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.cfi_restore_state
+	.loc 1 409 9 is_stmt 1 view .LVU617
+	leaq	.LC27(%rip), %rdi
+	xorl	%eax, %eax
+	call	tprintf
+.LVL141:
+	.loc 1 410 9 view .LVU618
+	leaq	input_str(%rip), %rdi
+	xorl	%eax, %eax
+	call	tprintf
+.LVL142:
+	.loc 1 411 9 view .LVU619
+	leaq	.LC28(%rip), %rdi
+	xorl	%eax, %eax
+	call	tprintf
+.LVL143:
+	.loc 1 412 9 view .LVU620
+	xorl	%eax, %eax
+	call	_handle_cmd
+.LVL144:
+	.loc 1 414 9 view .LVU621
+	.loc 1 414 22 is_stmt 0 view .LVU622
+	movb	$0, input_str(%rip)
+	.loc 1 416 9 is_stmt 1 view .LVU623
+	jmp	.L100
+	.p2align 4,,10
+	.p2align 3
+.L118:
+	.loc 1 420 9 view .LVU624
+	.loc 1 420 12 is_stmt 0 view .LVU625
+	cmpb	$0, input_str(%rip)
+	.loc 1 420 22 view .LVU626
+	leaq	input_str(%rip), %rbp
+	.loc 1 420 12 view .LVU627
+	je	.L104
+.LBB305:
+	.loc 1 421 13 is_stmt 1 view .LVU628
+	.loc 1 421 23 is_stmt 0 view .LVU629
+	movq	%rbp, %rdi
+	call	strlen@PLT
+.LVL145:
+	.loc 1 421 44 view .LVU630
+	movb	$0, -1(%rbp,%rax)
+	.loc 1 423 13 is_stmt 1 view .LVU631
+	xorl	%eax, %eax
+	call	_clear_cursor
+.LVL146:
+	.loc 1 426 13 view .LVU632
+	.loc 1 426 40 is_stmt 0 view .LVU633
+	movq	frame_buffer(%rip), %rdx
+.LBB306:
+	.loc 1 427 36 view .LVU634
+	movl	glyph_height(%rip), %eax
+.LBE306:
+	.loc 1 426 23 view .LVU635
+	movq	(%rdx), %rbx
+.LVL147:
+	.loc 1 427 13 is_stmt 1 view .LVU636
+.LBB321:
+	.loc 1 427 18 view .LVU637
+	.loc 1 427 36 view .LVU638
+	testl	%eax, %eax
+	je	.L105
+	.loc 1 427 27 is_stmt 0 view .LVU639
+	xorl	%ebp, %ebp
+	jmp	.L106
+.LVL148:
+	.p2align 4,,10
+	.p2align 3
+.L120:
+.LBB307:
+.LBB308:
+.LBB309:
+	.loc 1 88 30 view .LVU640
+	movq	frame_buffer(%rip), %rdx
+.LVL149:
+.L106:
+	.loc 1 88 30 view .LVU641
+.LBE309:
+.LBE308:
+	.loc 1 428 17 is_stmt 1 discriminator 3 view .LVU642
+	.loc 1 428 40 is_stmt 0 discriminator 3 view .LVU643
+	movl	input_render_y(%rip), %eax
+.LBB314:
+.LBB310:
+	.loc 1 88 38 discriminator 3 view .LVU644
+	movq	24(%rdx), %rdx
+.LBE310:
+.LBE314:
+	.loc 1 430 17 discriminator 3 view .LVU645
+	xorl	%esi, %esi
+	.loc 1 428 40 discriminator 3 view .LVU646
+	movl	input_render_x(%rip), %ecx
+.LVL150:
+.LBB315:
+.LBI308:
+	.loc 1 86 24 is_stmt 1 discriminator 3 view .LVU647
+.LBB311:
+	.loc 1 88 5 discriminator 3 view .LVU648
+.LBE311:
+.LBE315:
+	.loc 1 428 40 is_stmt 0 discriminator 3 view .LVU649
+	addl	%ebp, %eax
+.LVL151:
+.LBB316:
+.LBB312:
+	.loc 1 88 38 discriminator 3 view .LVU650
+	shrq	$2, %rdx
+.LBE312:
+.LBE316:
+.LBE307:
+	.loc 1 427 53 discriminator 3 view .LVU651
+	addl	$1, %ebp
+.LVL152:
+.LBB320:
+.LBB317:
+.LBB313:
+	.loc 1 88 44 discriminator 3 view .LVU652
+	imull	%edx, %eax
+.LVL153:
+	.loc 1 88 44 discriminator 3 view .LVU653
+.LBE313:
+.LBE317:
+	.loc 1 429 17 is_stmt 1 discriminator 3 view .LVU654
+.LBB318:
+.LBI318:
+	.loc 1 86 24 discriminator 3 view .LVU655
+.LBB319:
+	.loc 1 88 5 discriminator 3 view .LVU656
+	.loc 1 88 5 is_stmt 0 discriminator 3 view .LVU657
+.LBE319:
+.LBE318:
+	.loc 1 430 17 is_stmt 1 discriminator 3 view .LVU658
+	.loc 1 428 40 is_stmt 0 discriminator 3 view .LVU659
+	movl	%ecx, %edx
+	subl	glyph_width(%rip), %edx
+	.loc 1 430 79 discriminator 3 view .LVU660
+	leal	(%rdx,%rax), %edi
+	.loc 1 430 55 discriminator 3 view .LVU661
+	leal	(%rcx,%rax), %edx
+	.loc 1 430 79 discriminator 3 view .LVU662
+	salq	$2, %rdi
+	.loc 1 430 55 discriminator 3 view .LVU663
+	salq	$2, %rdx
+	.loc 1 430 67 discriminator 3 view .LVU664
+	subq	%rdi, %rdx
+	.loc 1 430 76 discriminator 3 view .LVU665
+	addq	%rbx, %rdi
+	.loc 1 430 17 discriminator 3 view .LVU666
+	call	memset@PLT
+.LVL154:
+	.loc 1 430 17 discriminator 3 view .LVU667
+.LBE320:
+	.loc 1 427 53 is_stmt 1 discriminator 3 view .LVU668
+	.loc 1 427 36 discriminator 3 view .LVU669
+	cmpl	glyph_height(%rip), %ebp
+	jb	.L120
+.LVL155:
+.L105:
+	.loc 1 427 36 is_stmt 0 discriminator 3 view .LVU670
+.LBE321:
+	.loc 1 433 13 is_stmt 1 view .LVU671
+	.loc 1 433 28 is_stmt 0 view .LVU672
+	movl	glyph_width(%rip), %eax
+	subl	%eax, input_render_x(%rip)
+	.loc 1 435 13 is_stmt 1 view .LVU673
+.LBB322:
+.LBI322:
+	.loc 1 189 6 view .LVU674
+.LBB323:
+	.loc 1 191 5 view .LVU675
+	.loc 1 191 8 is_stmt 0 view .LVU676
+	cmpb	$0, cursor_visible(%rip)
+	jne	.L108
+	jmp	.L100
+.LVL156:
+	.p2align 4,,10
+	.p2align 3
+.L119:
+	.loc 1 191 8 view .LVU677
+.LBE323:
+.LBE322:
+.LBE305:
+.LBB328:
+	.loc 1 442 9 is_stmt 1 view .LVU678
+	movl	input_render_y(%rip), %edx
+	movl	input_render_x(%rip), %esi
+	.loc 1 446 22 is_stmt 0 view .LVU679
+	leaq	input_str(%rip), %rbp
+	.loc 1 442 9 view .LVU680
+	call	_render_glyph
+.LVL157:
+	.loc 1 443 9 is_stmt 1 view .LVU681
+	.loc 1 446 22 is_stmt 0 view .LVU682
+	movq	%rbp, %rdi
+	.loc 1 443 24 view .LVU683
+	movl	glyph_width(%rip), %eax
+	addl	%eax, input_render_x(%rip)
+	.loc 1 446 9 is_stmt 1 view .LVU684
+	.loc 1 446 22 is_stmt 0 view .LVU685
+	call	strlen@PLT
+.LVL158:
+	.loc 1 447 9 is_stmt 1 view .LVU686
+	.loc 1 447 28 is_stmt 0 view .LVU687
+	movzbl	2(%rbx), %edx
+	.loc 1 448 26 view .LVU688
+	movb	$0, 1(%rbp,%rax)
+	.loc 1 447 24 view .LVU689
+	movb	%dl, 0(%rbp,%rax)
+	.loc 1 448 9 is_stmt 1 view .LVU690
+	.loc 1 450 9 view .LVU691
+	xorl	%eax, %eax
+.LVL159:
+	.loc 1 450 9 is_stmt 0 view .LVU692
+	call	_clear_cursor
+.LVL160:
+	.loc 1 451 9 is_stmt 1 view .LVU693
+.LBB329:
+.LBI329:
+	.loc 1 189 6 view .LVU694
+.LBB330:
+	.loc 1 191 5 view .LVU695
+	.loc 1 191 8 is_stmt 0 view .LVU696
+	cmpb	$0, cursor_visible(%rip)
+	je	.L100
+.LVL161:
+.L108:
+	.loc 1 191 8 view .LVU697
+.LBE330:
+.LBE329:
+.LBE328:
+	.loc 1 453 1 view .LVU698
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+.LBB331:
+.LBB326:
+.LBB324:
+	xorl	%eax, %eax
+.LBE324:
+.LBE326:
+.LBE331:
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 8
+.LBB332:
+.LBB327:
+.LBB325:
+	jmp	_render_cursor.part.0
+.LVL162:
+.LBE325:
+.LBE327:
+.LBE332:
+	.cfi_endproc
+.LFE50:
+	.size	term_keyevent, .-term_keyevent
+	.globl	cursor_visible
+	.bss
+	.type	cursor_visible, @object
+	.size	cursor_visible, 1
+cursor_visible:
+	.zero	1
+	.globl	_cursor_lock
+	.type	_cursor_lock, @object
+	.size	_cursor_lock, 1
+_cursor_lock:
+	.zero	1
+	.globl	input_str
+	.align 32
+	.type	input_str, @object
+	.size	input_str, 256
+input_str:
+	.zero	256
+	.globl	cursor_y
+	.align 4
+	.type	cursor_y, @object
+	.size	cursor_y, 4
+cursor_y:
+	.zero	4
+	.globl	cursor_x
+	.align 4
+	.type	cursor_x, @object
+	.size	cursor_x, 4
+cursor_x:
+	.zero	4
+	.globl	input_render_y
+	.align 4
+	.type	input_render_y, @object
+	.size	input_render_y, 4
+input_render_y:
+	.zero	4
+	.globl	input_render_x
+	.align 4
+	.type	input_render_x, @object
+	.size	input_render_x, 4
+input_render_x:
+	.zero	4
+	.globl	render_y
+	.align 4
+	.type	render_y, @object
+	.size	render_y, 4
+render_y:
+	.zero	4
+	.globl	render_x
+	.align 4
+	.type	render_x, @object
+	.size	render_x, 4
+render_x:
+	.zero	4
+	.globl	bgcolor
+	.align 4
+	.type	bgcolor, @object
+	.size	bgcolor, 4
+bgcolor:
+	.zero	4
+	.globl	fgcolor
+	.data
+	.align 4
+	.type	fgcolor, @object
+	.size	fgcolor, 4
+fgcolor:
+	.long	13421772
+	.globl	is_ready
+	.bss
+	.type	is_ready, @object
+	.size	is_ready, 1
+is_ready:
+	.zero	1
+	.globl	glyph_height
+	.align 4
+	.type	glyph_height, @object
+	.size	glyph_height, 4
+glyph_height:
+	.zero	4
+	.globl	glyph_width
+	.align 4
+	.type	glyph_width, @object
+	.size	glyph_width, 4
+glyph_width:
+	.zero	4
+	.globl	max_cols
+	.align 4
+	.type	max_cols, @object
+	.size	max_cols, 4
+max_cols:
+	.zero	4
+	.globl	max_rows
+	.align 4
+	.type	max_rows, @object
+	.size	max_rows, 4
+max_rows:
+	.zero	4
+	.globl	glyph_padding
+	.data
+	.type	glyph_padding, @object
+	.size	glyph_padding, 1
+glyph_padding:
+	.byte	1
+	.globl	frame_buffer
+	.bss
+	.align 8
+	.type	frame_buffer, @object
+	.size	frame_buffer, 8
+frame_buffer:
+	.zero	8
+	.globl	font_header
+	.align 8
+	.type	font_header, @object
+	.size	font_header, 8
+font_header:
+	.zero	8
+	.globl	glyph_data
+	.align 8
+	.type	glyph_data, @object
+	.size	glyph_data, 8
+glyph_data:
+	.zero	8
+	.globl	framebuffer_request
+	.data
+	.align 32
+	.type	framebuffer_request, @object
+	.size	framebuffer_request, 48
+framebuffer_request:
+	.quad	-4057218587309601912
+	.quad	757423339400917115
+	.quad	-7108888182325650059
+	.quad	-6695579390111469285
+	.quad	0
+	.zero	8
+	.globl	file_request
+	.align 32
+	.type	file_request, @object
+	.size	file_request, 64
+file_request:
+	.quad	-4057218587309601912
+	.quad	757423339400917115
+	.quad	4503080206956638895
+	.quad	-3883141660369482514
+	.quad	0
+	.zero	24
+	.text
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 6 "src/include/ps2.h"
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 8 "src/include/limine.h"
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 10 "<built-in>"
+	.file 11 "src/include/mem.h"
+	.file 12 "src/include/idt.h"
+	.file 13 "src/include/alloc.h"
+	.file 14 "src/include/slab.h"
+	.file 15 "src/include/vm.h"
+	.file 16 "src/include/allocbench.h"
+	.file 17 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1c19
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3b
+	.long	.LASF161
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xc
+	.long	.LASF6
+	.byte	0x5
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xc
+	.long	.LASF7
+	.byte	0x5
+	.byte	0x31
+	.byte	0x1c
+	.long	0x69
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0xc
+	.long	.LASF9
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x7c
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF10
+	.uleb128 0xc
+	.long	.LASF11
+	.byte	0x5
+	.byte	0x37
+	.byte	0x1b
+	.long	0x94
+	.uleb128 0x3d
+	.long	0x83
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF12
+	.uleb128 0x15
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x10
+	.long	0xdd
+	.uleb128 0x2
+	.long	.LASF13
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF14
+	.byte	0x6
+	.byte	0x1f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x6
+	.byte	0x20
+	.byte	0xa
+	.long	0xdd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x21
+	.byte	0x9
+	.long	0xe9
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF17
+	.uleb128 0x3e
+	.long	0xdd
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF18
+	.uleb128 0xc
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x22
+	.byte	0x3
+	.long	0x9b
+	.uleb128 0x6
+	.long	0xf0
+	.uleb128 0xc
+	.long	.LASF20
+	.byte	0x7
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x94
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF21
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF22
+	.uleb128 0x15
+	.long	.LASF24
+	.byte	0x10
+	.byte	0x8
+	.byte	0x37
+	.byte	0x8
+	.long	0x151
+	.uleb128 0x16
+	.string	"a"
+	.byte	0x38
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x16
+	.string	"b"
+	.byte	0x39
+	.byte	0xe
+	.long	0x5d
+	.byte	0x4
+	.uleb128 0x16
+	.string	"c"
+	.byte	0x3a
+	.byte	0xe
+	.long	0x5d
+	.byte	0x6
+	.uleb128 0x16
+	.string	"d"
+	.byte	0x3b
+	.byte	0xd
+	.long	0x151
+	.byte	0x8
+	.byte	0
+	.uleb128 0x18
+	.long	0x4a
+	.long	0x161
+	.uleb128 0x19
+	.long	0x94
+	.byte	0x7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF25
+	.byte	0x70
+	.byte	0x8
+	.byte	0x42
+	.byte	0x8
+	.long	0x225
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x8
+	.byte	0x43
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x44
+	.byte	0xc
+	.long	0x225
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x45
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x46
+	.byte	0xc
+	.long	0x227
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x47
+	.byte	0xc
+	.long	0x227
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x48
+	.byte	0xe
+	.long	0x70
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x49
+	.byte	0xe
+	.long	0x70
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xe
+	.long	0x70
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xe
+	.long	0x70
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x4c
+	.byte	0xe
+	.long	0x70
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xe
+	.long	0x70
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x18
+	.long	0x11b
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x18
+	.long	0x11b
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x8
+	.byte	0x50
+	.byte	0x18
+	.long	0x11b
+	.byte	0x60
+	.byte	0
+	.uleb128 0x3f
+	.byte	0x8
+	.uleb128 0x6
+	.long	0xdd
+	.uleb128 0x18
+	.long	0x83
+	.long	0x23c
+	.uleb128 0x19
+	.long	0x94
+	.byte	0x3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF40
+	.byte	0x28
+	.byte	0x8
+	.byte	0x87
+	.byte	0x8
+	.long	0x2d8
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x88
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x89
+	.byte	0xe
+	.long	0x83
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x8a
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x16
+	.string	"bpp"
+	.byte	0x8b
+	.byte	0xe
+	.long	0x5d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x8c
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x8d
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x8e
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x8f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x90
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x91
+	.byte	0xd
+	.long	0x4a
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x92
+	.byte	0xd
+	.long	0x4a
+	.byte	0x20
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF51
+	.byte	0x50
+	.byte	0x8
+	.byte	0x95
+	.byte	0x8
+	.long	0x3c2
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x96
+	.byte	0xc
+	.long	0x225
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x97
+	.byte	0xe
+	.long	0x83
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x98
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x99
+	.byte	0xe
+	.long	0x83
+	.byte	0x18
+	.uleb128 0x16
+	.string	"bpp"
+	.byte	0x9a
+	.byte	0xe
+	.long	0x5d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x9b
+	.byte	0xd
+	.long	0x4a
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x9c
+	.byte	0xd
+	.long	0x4a
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x9d
+	.byte	0xd
+	.long	0x4a
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x9e
+	.byte	0xd
+	.long	0x4a
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x9f
+	.byte	0xd
+	.long	0x4a
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0x8
+	.byte	0xa0
+	.byte	0xd
+	.long	0x4a
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x8
+	.byte	0xa1
+	.byte	0xd
+	.long	0x4a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x8
+	.byte	0xa2
+	.byte	0xd
+	.long	0x3c2
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF52
+	.byte	0x8
+	.byte	0xa3
+	.byte	0xe
+	.long	0x83
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0x8
+	.byte	0xa4
+	.byte	0xc
+	.long	0x225
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0x8
+	.byte	0xa6
+	.byte	0xe
+	.long	0x83
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF55
+	.byte	0x8
+	.byte	0xa7
+	.byte	0x21
+	.long	0x3d2
+	.byte	0x48
+	.byte	0
+	.uleb128 0x18
+	.long	0x4a
+	.long	0x3d2
+	.uleb128 0x19
+	.long	0x94
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	0x3d7
+	.uleb128 0x6
+	.long	0x23c
+	.uleb128 0x15
+	.long	.LASF56
+	.byte	0x18
+	.byte	0x8
+	.byte	0xaa
+	.byte	0x8
+	.long	0x411
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x8
+	.byte	0xab
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF57
+	.byte	0x8
+	.byte	0xac
+	.byte	0xe
+	.long	0x83
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF58
+	.byte	0x8
+	.byte	0xad
+	.byte	0x22
+	.long	0x411
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	0x416
+	.uleb128 0x6
+	.long	0x2d8
+	.uleb128 0x15
+	.long	.LASF59
+	.byte	0x30
+	.byte	0x8
+	.byte	0xb0
+	.byte	0x8
+	.long	0x44e
+	.uleb128 0x16
+	.string	"id"
+	.byte	0xb1
+	.byte	0xe
+	.long	0x22c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x8
+	.byte	0xb2
+	.byte	0xe
+	.long	0x83
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0x8
+	.byte	0xb3
+	.byte	0x2a
+	.long	0x44e
+	.byte	0x28
+	.byte	0
+	.uleb128 0x6
+	.long	0x3dc
+	.uleb128 0x6
+	.long	0xe4
+	.uleb128 0x6
+	.long	0x161
+	.uleb128 0x26
+	.long	.LASF61
+	.byte	0x18
+	.value	0x1bb
+	.long	0x491
+	.uleb128 0xd
+	.long	.LASF29
+	.value	0x1bc
+	.byte	0x12
+	.long	0x453
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF30
+	.value	0x1bd
+	.byte	0x12
+	.long	0x453
+	.byte	0x8
+	.uleb128 0xd
+	.long	.LASF62
+	.value	0x1be
+	.byte	0xe
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF63
+	.byte	0x18
+	.value	0x1c1
+	.long	0x4c5
+	.uleb128 0xd
+	.long	.LASF26
+	.value	0x1c2
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF64
+	.value	0x1c3
+	.byte	0xe
+	.long	0x83
+	.byte	0x8
+	.uleb128 0xd
+	.long	.LASF65
+	.value	0x1c4
+	.byte	0x1b
+	.long	0x4c5
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	0x458
+	.uleb128 0x26
+	.long	.LASF66
+	.byte	0x40
+	.value	0x1c7
+	.long	0x518
+	.uleb128 0x40
+	.string	"id"
+	.byte	0x8
+	.value	0x1c8
+	.byte	0xe
+	.long	0x22c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF26
+	.value	0x1c9
+	.byte	0xe
+	.long	0x83
+	.byte	0x20
+	.uleb128 0xd
+	.long	.LASF60
+	.value	0x1ca
+	.byte	0x25
+	.long	0x518
+	.byte	0x28
+	.uleb128 0xd
+	.long	.LASF67
+	.value	0x1cd
+	.byte	0xe
+	.long	0x83
+	.byte	0x30
+	.uleb128 0xd
+	.long	.LASF68
+	.value	0x1ce
+	.byte	0x26
+	.long	0x51d
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	0x491
+	.uleb128 0x6
+	.long	0x522
+	.uleb128 0x6
+	.long	0x45d
+	.uleb128 0x30
+	.byte	0x1
+	.byte	0x4
+	.byte	0x17
+	.long	0x53d
+	.uleb128 0x2
+	.long	.LASF69
+	.byte	0x4
+	.byte	0x18
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF70
+	.byte	0x4
+	.byte	0x19
+	.byte	0x3
+	.long	0x527
+	.uleb128 0x6
+	.long	0x70
+	.uleb128 0xc
+	.long	.LASF71
+	.byte	0x9
+	.byte	0x28
+	.byte	0x1b
+	.long	0x55a
+	.uleb128 0x41
+	.long	.LASF162
+	.long	0x563
+	.uleb128 0x18
+	.long	0x573
+	.long	0x573
+	.uleb128 0x19
+	.long	0x94
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF163
+	.byte	0x18
+	.byte	0xa
+	.byte	0
+	.long	0x5a8
+	.uleb128 0x1e
+	.long	.LASF72
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF73
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x1e
+	.long	.LASF74
+	.long	0x225
+	.byte	0x8
+	.uleb128 0x1e
+	.long	.LASF75
+	.long	0x225
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF76
+	.byte	0x9
+	.byte	0x63
+	.byte	0x18
+	.long	0x54e
+	.uleb128 0x27
+	.long	.LASF77
+	.byte	0xb
+	.byte	0xb5
+	.byte	0x11
+	.long	0x83
+	.uleb128 0x27
+	.long	.LASF78
+	.byte	0xb
+	.byte	0xb6
+	.byte	0x11
+	.long	0x83
+	.uleb128 0x27
+	.long	.LASF79
+	.byte	0xc
+	.byte	0x39
+	.byte	0x1a
+	.long	0x8f
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x1
+	.byte	0x22
+	.long	0x608
+	.uleb128 0x2
+	.long	.LASF80
+	.byte	0x1
+	.byte	0x23
+	.byte	0xe
+	.long	0x5d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF81
+	.byte	0x1
+	.byte	0x24
+	.byte	0xd
+	.long	0x4a
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x25
+	.byte	0xd
+	.long	0x4a
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF83
+	.byte	0x1
+	.byte	0x26
+	.byte	0x1b
+	.long	0x5d8
+	.uleb128 0x5
+	.long	.LASF84
+	.byte	0x28
+	.byte	0x1e
+	.long	0x4ca
+	.uleb128 0x9
+	.byte	0x3
+	.quad	file_request
+	.uleb128 0x5
+	.long	.LASF85
+	.byte	0x2c
+	.byte	0x23
+	.long	0x41b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	framebuffer_request
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0x30
+	.byte	0x7
+	.long	0x227
+	.uleb128 0x9
+	.byte	0x3
+	.quad	glyph_data
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x31
+	.byte	0xe
+	.long	0x668
+	.uleb128 0x9
+	.byte	0x3
+	.quad	font_header
+	.uleb128 0x6
+	.long	0x608
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0x32
+	.byte	0x1c
+	.long	0x416
+	.uleb128 0x9
+	.byte	0x3
+	.quad	frame_buffer
+	.uleb128 0x5
+	.long	.LASF89
+	.byte	0x33
+	.byte	0x9
+	.long	0x4a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	glyph_padding
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0x34
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	max_rows
+	.uleb128 0x5
+	.long	.LASF91
+	.byte	0x35
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	max_cols
+	.uleb128 0x5
+	.long	.LASF92
+	.byte	0x36
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	glyph_width
+	.uleb128 0x5
+	.long	.LASF93
+	.byte	0x37
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	glyph_height
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0x38
+	.byte	0x5
+	.long	0xe9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	is_ready
+	.uleb128 0x5
+	.long	.LASF95
+	.byte	0x39
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fgcolor
+	.uleb128 0x5
+	.long	.LASF96
+	.byte	0x3a
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bgcolor
+	.uleb128 0x5
+	.long	.LASF97
+	.byte	0x3d
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	render_x
+	.uleb128 0x5
+	.long	.LASF98
+	.byte	0x3e
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	render_y
+	.uleb128 0x5
+	.long	.LASF99
+	.byte	0x41
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	input_render_x
+	.uleb128 0x5
+	.long	.LASF100
+	.byte	0x42
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	input_render_y
+	.uleb128 0x5
+	.long	.LASF101
+	.byte	0x45
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cursor_x
+	.uleb128 0x5
+	.long	.LASF102
+	.byte	0x46
+	.byte	0xa
+	.long	0x70
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cursor_y
+	.uleb128 0x18
+	.long	0xdd
+	.long	0x7b8
+	.uleb128 0x19
+	.long	0x94
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x48
+	.byte	0x6
+	.long	0x7a8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	input_str
+	.uleb128 0x5
+	.long	.LASF104
+	.byte	0x49
+	.byte	0xc
+	.long	0x53d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	_cursor_lock
+	.uleb128 0x5
+	.long	.LASF105
+	.byte	0x4a
+	.byte	0x5
+	.long	0xe9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cursor_visible
+	.uleb128 0x1a
+	.long	.LASF115
+	.byte	0x11
+	.byte	0x2b
+	.byte	0x8
+	.long	0x101
+	.long	0x80d
+	.uleb128 0x7
+	.long	0x453
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF118
+	.byte	0xb
+	.byte	0xc5
+	.byte	0xa
+	.long	0x70
+	.long	0x81f
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF106
+	.byte	0xd
+	.byte	0x2d
+	.long	0x82c
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF107
+	.byte	0xd
+	.byte	0x2c
+	.long	0x839
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF108
+	.byte	0xe
+	.byte	0x39
+	.long	0x846
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF109
+	.byte	0xf
+	.byte	0x31
+	.long	0x853
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF110
+	.byte	0x10
+	.byte	0x1e
+	.long	0x860
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF111
+	.byte	0xb
+	.byte	0xc9
+	.long	0x86d
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF112
+	.byte	0xb
+	.byte	0xdf
+	.long	0x87a
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF113
+	.byte	0xb
+	.byte	0xcc
+	.long	0x887
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF114
+	.byte	0xb
+	.byte	0xcb
+	.long	0x894
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF116
+	.byte	0x11
+	.byte	0x2c
+	.byte	0x5
+	.long	0x3c
+	.long	0x8af
+	.uleb128 0x7
+	.long	0x453
+	.uleb128 0x7
+	.long	0x453
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF117
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x5
+	.long	0x3c
+	.long	0x8d4
+	.uleb128 0x7
+	.long	0x227
+	.uleb128 0x7
+	.long	0x101
+	.uleb128 0x7
+	.long	0x453
+	.uleb128 0x7
+	.long	0x8d4
+	.byte	0
+	.uleb128 0x6
+	.long	0x573
+	.uleb128 0x44
+	.long	.LASF119
+	.byte	0x11
+	.byte	0x30
+	.byte	0x6
+	.long	0x8ec
+	.uleb128 0x7
+	.long	0x453
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF120
+	.byte	0xb
+	.byte	0xe3
+	.byte	0x5
+	.long	0x3c
+	.long	0x90c
+	.uleb128 0x7
+	.long	0x90c
+	.uleb128 0x7
+	.long	0x90c
+	.uleb128 0x7
+	.long	0x101
+	.byte	0
+	.uleb128 0x6
+	.long	0x911
+	.uleb128 0x45
+	.uleb128 0x1a
+	.long	.LASF121
+	.byte	0xb
+	.byte	0xe1
+	.byte	0x7
+	.long	0x225
+	.long	0x932
+	.uleb128 0x7
+	.long	0x225
+	.uleb128 0x7
+	.long	0x3c
+	.uleb128 0x7
+	.long	0x101
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF122
+	.byte	0xb
+	.byte	0xe2
+	.byte	0x7
+	.long	0x225
+	.long	0x952
+	.uleb128 0x7
+	.long	0x225
+	.uleb128 0x7
+	.long	0x90c
+	.uleb128 0x7
+	.long	0x101
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF128
+	.value	0x195
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xba7
+	.uleb128 0x46
+	.string	"ke"
+	.byte	0x1
+	.value	0x195
+	.byte	0x20
+	.long	0xfc
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x32
+	.long	.LLRL97
+	.long	0xabe
+	.uleb128 0x17
+	.string	"fb"
+	.value	0x1aa
+	.byte	0x17
+	.long	0x549
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x32
+	.long	.LLRL99
+	.long	0xa71
+	.uleb128 0x17
+	.string	"y"
+	.value	0x1ab
+	.byte	0x1b
+	.long	0x70
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x13
+	.long	.LLRL101
+	.uleb128 0x1f
+	.long	.LASF123
+	.value	0x1ac
+	.byte	0x1a
+	.long	0x70
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x1f
+	.long	.LASF124
+	.value	0x1ad
+	.byte	0x1a
+	.long	0x70
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI308
+	.byte	.LVU647
+	.long	.LLRL104
+	.value	0x1ac
+	.byte	0x28
+	.long	0xa1b
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.uleb128 0x47
+	.long	0x16ed
+	.quad	.LBI318
+	.byte	.LVU655
+	.quad	.LBB318
+	.quad	.LBE318-.LBB318
+	.byte	0x1
+	.value	0x1ad
+	.byte	0x26
+	.long	0xa5c
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL154
+	.long	0x912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x1235
+	.quad	.LBI322
+	.byte	.LVU674
+	.long	.LLRL109
+	.value	0x1b3
+	.byte	0xd
+	.long	0xa98
+	.uleb128 0x9
+	.quad	.LVL162
+	.long	0x17a3
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL145
+	.long	0x7f7
+	.long	0xab0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL146
+	.long	0x124e
+	.byte	0
+	.uleb128 0x28
+	.quad	.LBB328
+	.quad	.LBE328-.LBB328
+	.long	0xb3c
+	.uleb128 0x17
+	.string	"len"
+	.value	0x1be
+	.byte	0x10
+	.long	0x101
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x48
+	.long	0x1235
+	.quad	.LBI329
+	.byte	.LVU694
+	.quad	.LBB329
+	.quad	.LBE329-.LBB329
+	.byte	0x1
+	.value	0x1c3
+	.byte	0x9
+	.uleb128 0x8
+	.quad	.LVL157
+	.long	0x1319
+	.uleb128 0x4
+	.quad	.LVL158
+	.long	0x7f7
+	.long	0xb2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL160
+	.long	0x124e
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL141
+	.long	0xd60
+	.long	0xb5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL142
+	.long	0xd60
+	.long	0xb7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	input_str
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL143
+	.long	0xd60
+	.long	0xb99
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL144
+	.long	0xba7
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF125
+	.byte	0x1
+	.value	0x16a
+	.byte	0x6
+	.byte	0x1
+	.long	0xbc3
+	.uleb128 0x33
+	.uleb128 0x1d
+	.long	.LASF133
+	.value	0x189
+	.long	0x83
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF126
+	.value	0x160
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xca7
+	.uleb128 0xe
+	.long	0x16bf
+	.quad	.LBI250
+	.byte	.LVU466
+	.long	.LLRL84
+	.value	0x162
+	.byte	0x5
+	.long	0xc99
+	.uleb128 0x13
+	.long	.LLRL84
+	.uleb128 0x14
+	.long	0x16cc
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x4a
+	.long	0x16d6
+	.byte	0
+	.uleb128 0x14
+	.long	0x16e1
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x11
+	.long	0x16ed
+	.quad	.LBI252
+	.byte	.LVU471
+	.long	.LLRL87
+	.byte	0x5f
+	.byte	0x1c
+	.long	0xc51
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST88
+	.long	.LVUS88
+	.byte	0
+	.uleb128 0x11
+	.long	0x16ed
+	.quad	.LBI256
+	.byte	.LVU475
+	.long	.LLRL90
+	.byte	0x60
+	.byte	0x1a
+	.long	0xc84
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL100
+	.long	0x912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL101
+	.long	0x106b
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF127
+	.value	0x147
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd60
+	.uleb128 0x8
+	.quad	.LVL93
+	.long	0x1481
+	.uleb128 0x4
+	.quad	.LVL94
+	.long	0x8d9
+	.long	0xcf5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL95
+	.long	0x8d9
+	.long	0xd14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL96
+	.long	0x8d9
+	.long	0xd33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL97
+	.long	0x8d9
+	.long	0xd52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL98
+	.long	0x106b
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF129
+	.value	0x119
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xec0
+	.uleb128 0x4b
+	.long	.LASF130
+	.byte	0x1
+	.value	0x119
+	.byte	0x19
+	.long	0x453
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0xa
+	.uleb128 0x35
+	.long	.LASF131
+	.value	0x11f
+	.byte	0xa
+	.long	0x7a8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x35
+	.long	.LASF132
+	.value	0x121
+	.byte	0xd
+	.long	0x5a8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.uleb128 0x17
+	.string	"ch"
+	.value	0x12f
+	.byte	0xb
+	.long	0x227
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x28
+	.quad	.LBB235
+	.quad	.LBE235-.LBB235
+	.long	0xe78
+	.uleb128 0x17
+	.string	"fb"
+	.value	0x128
+	.byte	0x13
+	.long	0x549
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x1d
+	.long	.LASF123
+	.value	0x129
+	.long	0x70
+	.uleb128 0x1d
+	.long	.LASF124
+	.value	0x12a
+	.long	0x70
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI236
+	.byte	.LVU399
+	.long	.LLRL79
+	.value	0x129
+	.byte	0x20
+	.long	0xe38
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI240
+	.byte	.LVU408
+	.long	.LLRL82
+	.value	0x12a
+	.byte	0x1e
+	.long	0xe64
+	.uleb128 0x12
+	.long	0x1707
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL92
+	.long	0x912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL80
+	.long	0x8af
+	.long	0xea5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL84
+	.long	0x1319
+	.uleb128 0x8
+	.quad	.LVL85
+	.long	0xec0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF134
+	.byte	0xfd
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x106b
+	.uleb128 0x17
+	.string	"fb"
+	.value	0x111
+	.byte	0xf
+	.long	0x549
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1f
+	.long	.LASF123
+	.value	0x112
+	.byte	0xe
+	.long	0x70
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1f
+	.long	.LASF124
+	.value	0x113
+	.byte	0xe
+	.long	0x70
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x28
+	.quad	.LBB226
+	.quad	.LBE226-.LBB226
+	.long	0xfd1
+	.uleb128 0x17
+	.string	"fb"
+	.value	0x101
+	.byte	0x13
+	.long	0x549
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1d
+	.long	.LASF123
+	.value	0x102
+	.long	0x70
+	.uleb128 0x1d
+	.long	.LASF124
+	.value	0x103
+	.long	0x70
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI227
+	.byte	.LVU328
+	.long	.LLRL70
+	.value	0x102
+	.byte	0x1f
+	.long	0xf89
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI231
+	.byte	.LVU337
+	.long	.LLRL73
+	.value	0x103
+	.byte	0x1e
+	.long	0xfbd
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL73
+	.long	0x912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI218
+	.byte	.LVU302
+	.long	.LLRL63
+	.value	0x112
+	.byte	0x1b
+	.long	0x1005
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0xe
+	.long	0x16ed
+	.quad	.LBI222
+	.byte	.LVU309
+	.long	.LLRL66
+	.value	0x113
+	.byte	0x1a
+	.long	0x1039
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL67
+	.long	0x912
+	.long	0x1050
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL68
+	.long	0x106b
+	.uleb128 0x8
+	.quad	.LVL75
+	.long	0x150d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF135
+	.byte	0xdf
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1128
+	.uleb128 0x4c
+	.long	.LASF131
+	.byte	0x1
+	.byte	0xe6
+	.byte	0xa
+	.long	0x1128
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -19
+	.uleb128 0x20
+	.string	"ch"
+	.byte	0xe8
+	.byte	0xb
+	.long	0x227
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x11
+	.long	0x173d
+	.quad	.LBI202
+	.byte	.LVU252
+	.long	.LLRL55
+	.byte	0xea
+	.byte	0x5
+	.long	0x10ce
+	.uleb128 0x3
+	.long	0x174a
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x11
+	.long	0x173d
+	.quad	.LBI206
+	.byte	.LVU269
+	.long	.LLRL57
+	.byte	0xf4
+	.byte	0x5
+	.long	0x10f4
+	.uleb128 0x3
+	.long	0x174a
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.uleb128 0x11
+	.long	0x1235
+	.quad	.LBI209
+	.byte	.LVU275
+	.long	.LLRL59
+	.byte	0xf6
+	.byte	0x5
+	.long	0x111a
+	.uleb128 0x9
+	.quad	.LVL61
+	.long	0x17a3
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL56
+	.long	0x1319
+	.byte	0
+	.uleb128 0x18
+	.long	0xdd
+	.long	0x1138
+	.uleb128 0x19
+	.long	0x94
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF136
+	.byte	0xcf
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1235
+	.uleb128 0x29
+	.long	0x175e
+	.quad	.LBI192
+	.byte	.LVU212
+	.quad	.LBB192
+	.quad	.LBE192-.LBB192
+	.byte	0xd1
+	.byte	0x5
+	.uleb128 0x2a
+	.long	0x178b
+	.quad	.LBI194
+	.byte	.LVU215
+	.quad	.LBB194
+	.quad	.LBE194-.LBB194
+	.byte	0xd2
+	.long	0x11a5
+	.uleb128 0x3
+	.long	0x1796
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.uleb128 0x2a
+	.long	0x1235
+	.quad	.LBI196
+	.byte	.LVU224
+	.quad	.LBB196
+	.quad	.LBE196-.LBB196
+	.byte	0xd6
+	.long	0x11d6
+	.uleb128 0x8
+	.quad	.LVL51
+	.long	0x17a3
+	.byte	0
+	.uleb128 0x2a
+	.long	0x176e
+	.quad	.LBI198
+	.byte	.LVU228
+	.quad	.LBB198
+	.quad	.LBE198-.LBB198
+	.byte	0xd8
+	.long	0x1207
+	.uleb128 0x3
+	.long	0x1779
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x29
+	.long	0x1757
+	.quad	.LBI200
+	.byte	.LVU232
+	.quad	.LBB200
+	.quad	.LBE200-.LBB200
+	.byte	0xd9
+	.byte	0x5
+	.uleb128 0x8
+	.quad	.LVL50
+	.long	0x124e
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF137
+	.byte	0x1
+	.byte	0xbd
+	.byte	0x6
+	.byte	0x1
+	.long	0x124e
+	.uleb128 0x33
+	.uleb128 0x36
+	.string	"i"
+	.byte	0xc4
+	.byte	0x13
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF138
+	.byte	0xb4
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1319
+	.uleb128 0x2b
+	.quad	.LBB163
+	.quad	.LBE163-.LBB163
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xb6
+	.byte	0x13
+	.long	0x70
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x21
+	.long	0x167f
+	.quad	.LBI164
+	.byte	.LVU186
+	.long	.LLRL43
+	.byte	0xb7
+	.byte	0x9
+	.uleb128 0x3
+	.long	0x169c
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x3
+	.long	0x1693
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x3
+	.long	0x168a
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x13
+	.long	.LLRL43
+	.uleb128 0x14
+	.long	0x16a8
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x14
+	.long	0x16b3
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x21
+	.long	0x16ed
+	.quad	.LBI166
+	.byte	.LVU189
+	.long	.LLRL49
+	.byte	0x67
+	.byte	0x16
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF139
+	.byte	0x9a
+	.byte	0x6
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1481
+	.uleb128 0x2c
+	.string	"ch"
+	.byte	0x19
+	.long	0xdd
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x2c
+	.string	"x"
+	.byte	0x26
+	.long	0x70
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x2c
+	.string	"y"
+	.byte	0x32
+	.long	0x70
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xf
+	.long	.LASF140
+	.byte	0x9c
+	.byte	0xd
+	.long	0x4a
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xf
+	.long	.LASF141
+	.byte	0x9d
+	.byte	0xe
+	.long	0x70
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x2b
+	.quad	.LBB130
+	.quad	.LBE130-.LBB130
+	.uleb128 0xf
+	.long	.LASF142
+	.byte	0xa0
+	.byte	0xe
+	.long	0x3c
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x2b
+	.quad	.LBB131
+	.quad	.LBE131-.LBB131
+	.uleb128 0xf
+	.long	.LASF143
+	.byte	0xa2
+	.byte	0xe
+	.long	0xdd
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x13
+	.long	.LLRL36
+	.uleb128 0xf
+	.long	.LASF144
+	.byte	0xa4
+	.byte	0x12
+	.long	0x3c
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x13
+	.long	.LLRL38
+	.uleb128 0xf
+	.long	.LASF145
+	.byte	0xa5
+	.byte	0x15
+	.long	0x4a
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x4e
+	.long	0x167f
+	.quad	.LBB134
+	.quad	.LBE134-.LBB134
+	.byte	0x1
+	.byte	0xab
+	.byte	0x11
+	.long	0x143b
+	.uleb128 0x12
+	.long	0x169c
+	.uleb128 0x12
+	.long	0x1693
+	.uleb128 0x12
+	.long	0x168a
+	.uleb128 0x22
+	.long	0x16a8
+	.uleb128 0x22
+	.long	0x16b3
+	.byte	0
+	.uleb128 0x38
+	.long	0x167f
+	.long	.LLRL40
+	.byte	0xa8
+	.byte	0x11
+	.uleb128 0x12
+	.long	0x169c
+	.uleb128 0x12
+	.long	0x1693
+	.uleb128 0x12
+	.long	0x168a
+	.uleb128 0x13
+	.long	.LLRL40
+	.uleb128 0x22
+	.long	0x16a8
+	.uleb128 0x22
+	.long	0x16b3
+	.uleb128 0x38
+	.long	0x16ed
+	.long	.LLRL41
+	.byte	0x67
+	.byte	0x16
+	.uleb128 0x12
+	.long	0x1707
+	.uleb128 0x12
+	.long	0x16fe
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF146
+	.byte	0x80
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x150d
+	.uleb128 0x13
+	.long	.LLRL27
+	.uleb128 0x20
+	.string	"i"
+	.byte	0x82
+	.byte	0x13
+	.long	0x83
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x29
+	.long	0x1765
+	.quad	.LBI125
+	.byte	.LVU126
+	.quad	.LBB125
+	.quad	.LBE125-.LBB125
+	.byte	0x8b
+	.byte	0x11
+	.uleb128 0x4
+	.quad	.LVL23
+	.long	0x8ec
+	.long	0x14f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x39
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL27
+	.long	0x8d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF147
+	.byte	0x6b
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x167f
+	.uleb128 0x20
+	.string	"fb"
+	.byte	0x6e
+	.byte	0xf
+	.long	0x549
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xf
+	.long	.LASF148
+	.byte	0x6f
+	.byte	0xe
+	.long	0x70
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xf
+	.long	.LASF149
+	.byte	0x70
+	.byte	0xe
+	.long	0x70
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xf
+	.long	.LASF123
+	.byte	0x78
+	.byte	0xe
+	.long	0x70
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xf
+	.long	.LASF124
+	.byte	0x79
+	.byte	0xe
+	.long	0x70
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x11
+	.long	0x16ed
+	.quad	.LBI105
+	.byte	.LVU46
+	.long	.LLRL15
+	.byte	0x6f
+	.byte	0x22
+	.long	0x15ba
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x11
+	.long	0x16ed
+	.quad	.LBI109
+	.byte	.LVU51
+	.long	.LLRL18
+	.byte	0x70
+	.byte	0x20
+	.long	0x15ed
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x11
+	.long	0x16ed
+	.quad	.LBI113
+	.byte	.LVU66
+	.long	.LLRL21
+	.byte	0x78
+	.byte	0x1c
+	.long	0x1620
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x11
+	.long	0x16ed
+	.quad	.LBI117
+	.byte	.LVU73
+	.long	.LLRL24
+	.byte	0x79
+	.byte	0x1a
+	.long	0x1653
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL12
+	.long	0x932
+	.long	0x166b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x39
+	.quad	.LVL18
+	.long	0x912
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF157
+	.byte	0x1
+	.byte	0x64
+	.long	0x16bf
+	.uleb128 0x23
+	.string	"x"
+	.byte	0x64
+	.byte	0x28
+	.long	0x70
+	.uleb128 0x23
+	.string	"y"
+	.byte	0x64
+	.byte	0x34
+	.long	0x70
+	.uleb128 0x24
+	.long	.LASF150
+	.byte	0x1
+	.byte	0x64
+	.byte	0x40
+	.long	0x70
+	.uleb128 0x25
+	.long	.LASF151
+	.byte	0x66
+	.byte	0xf
+	.long	0x549
+	.uleb128 0x25
+	.long	.LASF152
+	.byte	0x67
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF164
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x14
+	.byte	0x3
+	.long	0x16ed
+	.uleb128 0x36
+	.string	"fb"
+	.byte	0x5e
+	.byte	0xf
+	.long	0x549
+	.uleb128 0x25
+	.long	.LASF123
+	.byte	0x5f
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x25
+	.long	.LASF124
+	.byte	0x60
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF165
+	.byte	0x1
+	.byte	0x56
+	.byte	0x18
+	.long	0x70
+	.byte	0x3
+	.long	0x1711
+	.uleb128 0x23
+	.string	"x"
+	.byte	0x56
+	.byte	0x29
+	.long	0x70
+	.uleb128 0x23
+	.string	"y"
+	.byte	0x56
+	.byte	0x35
+	.long	0x70
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF153
+	.byte	0x51
+	.byte	0xd
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x173d
+	.uleb128 0x51
+	.long	.LASF150
+	.byte	0x1
+	.byte	0x51
+	.byte	0x23
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF154
+	.byte	0x1
+	.byte	0x4c
+	.byte	0xd
+	.byte	0x3
+	.long	0x1757
+	.uleb128 0x24
+	.long	.LASF150
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x23
+	.long	0x70
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF155
+	.value	0x121
+	.uleb128 0x3a
+	.long	.LASF156
+	.value	0x11c
+	.uleb128 0x53
+	.string	"hcf"
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x2d
+	.long	.LASF158
+	.byte	0x4
+	.byte	0x22
+	.long	0x1786
+	.uleb128 0x24
+	.long	.LASF159
+	.byte	0x4
+	.byte	0x22
+	.byte	0x30
+	.long	0x1786
+	.byte	0
+	.uleb128 0x6
+	.long	0x53d
+	.uleb128 0x2d
+	.long	.LASF160
+	.byte	0x4
+	.byte	0x1b
+	.long	0x17a3
+	.uleb128 0x24
+	.long	.LASF159
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x1786
+	.byte	0
+	.uleb128 0x2e
+	.long	0x1235
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x186d
+	.uleb128 0x54
+	.long	0x1242
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.uleb128 0x14
+	.long	0x1243
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x21
+	.long	0x167f
+	.quad	.LBI89
+	.byte	.LVU9
+	.long	.LLRL1
+	.byte	0xc5
+	.byte	0x9
+	.uleb128 0x3
+	.long	0x169c
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3
+	.long	0x1693
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x3
+	.long	0x168a
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.long	.LLRL1
+	.uleb128 0x14
+	.long	0x16a8
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x14
+	.long	0x16b3
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x21
+	.long	0x16ed
+	.quad	.LBI91
+	.byte	.LVU12
+	.long	.LLRL7
+	.byte	0x67
+	.byte	0x16
+	.uleb128 0x3
+	.long	0x1707
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x3
+	.long	0x16fe
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x173d
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1890
+	.uleb128 0x55
+	.long	0x174a
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x2e
+	.long	0x1235
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18b9
+	.uleb128 0x9
+	.quad	.LVL47
+	.long	0x17a3
+	.byte	0
+	.uleb128 0x56
+	.long	0xba7
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xe
+	.long	0xba7
+	.quad	.LBI267
+	.byte	.LVU515
+	.long	.LLRL93
+	.value	0x16a
+	.byte	0x6
+	.long	0x1ba5
+	.uleb128 0x57
+	.long	0xbb5
+	.long	.LLRL94
+	.long	0x192c
+	.uleb128 0x14
+	.long	0xbb6
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x8
+	.quad	.LVL133
+	.long	0x80d
+	.uleb128 0x39
+	.quad	.LVL136
+	.long	0xd60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL106
+	.long	0x894
+	.long	0x1951
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL107
+	.long	0x894
+	.long	0x1976
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL108
+	.long	0xd60
+	.long	0x1995
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL109
+	.long	0xd60
+	.long	0x19b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL110
+	.long	0x894
+	.long	0x19d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL111
+	.long	0x894
+	.long	0x19fe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL112
+	.long	0x87a
+	.uleb128 0x9
+	.quad	.LVL113
+	.long	0xd60
+	.uleb128 0x9
+	.quad	.LVL114
+	.long	0x887
+	.uleb128 0x4
+	.quad	.LVL115
+	.long	0x894
+	.long	0x1a4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL116
+	.long	0x86d
+	.uleb128 0x4
+	.quad	.LVL117
+	.long	0x894
+	.long	0x1a7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL118
+	.long	0x860
+	.uleb128 0x4
+	.quad	.LVL119
+	.long	0x894
+	.long	0x1aae
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL120
+	.long	0x853
+	.uleb128 0x4
+	.quad	.LVL121
+	.long	0x894
+	.long	0x1ae0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL122
+	.long	0x846
+	.uleb128 0x4
+	.quad	.LVL123
+	.long	0x894
+	.long	0x1b12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL124
+	.long	0x839
+	.uleb128 0x4
+	.quad	.LVL125
+	.long	0x894
+	.long	0x1b44
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL126
+	.long	0x82c
+	.uleb128 0x4
+	.quad	.LVL127
+	.long	0x894
+	.long	0x1b76
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL128
+	.long	0x81f
+	.uleb128 0x1b
+	.quad	.LVL129
+	.long	0x894
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL102
+	.long	0x894
+	.long	0x1bca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL103
+	.long	0xd60
+	.long	0x1be9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL104
+	.long	0x894
+	.long	0x1c0e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL105
+	.long	0xbc3
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 154
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS96:
+	.uleb128 0
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU677
+	.uleb128 .LVU677
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 0
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LFE50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU636
+	.uleb128 .LVU677
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU638
+	.uleb128 .LVU640
+	.uleb128 .LVU640
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU669
+	.uleb128 .LVU669
+	.uleb128 .LVU670
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU653
+	.uleb128 .LVU667
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 0x12
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x3
+	.quad	glyph_width
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU657
+	.uleb128 .LVU667
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU647
+	.uleb128 .LVU650
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU647
+	.uleb128 .LVU653
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0xf
+	.byte	0x72
+	.sleb128 0
+	.byte	0x3
+	.quad	glyph_width
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU655
+	.uleb128 .LVU657
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x11
+	.byte	0x76
+	.sleb128 0
+	.byte	0x3
+	.quad	input_render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU655
+	.uleb128 .LVU657
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU686
+	.uleb128 .LVU692
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU470
+	.uleb128 .LVU485
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU477
+	.uleb128 .LVU485
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x10
+	.byte	0x70
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x70
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU471
+	.uleb128 .LVU473
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU475
+	.uleb128 .LVU477
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU475
+	.uleb128 .LVU477
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 8
+	.byte	0
+.LVUS76:
+	.uleb128 0
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU371
+	.uleb128 .LVU371
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 0
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU376
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU395
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU397
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 .LVU420
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	frame_buffer
+	.byte	0x6
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU399
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 .LVU406
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU399
+	.uleb128 .LVU406
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU408
+	.uleb128 .LVU410
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU301
+	.uleb128 .LVU321
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL67-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU307
+	.uleb128 .LVU314
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU311
+	.uleb128 .LVU315
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x72
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU327
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU349
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	frame_buffer
+	.byte	0x6
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU328
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU328
+	.uleb128 .LVU335
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU337
+	.uleb128 .LVU339
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0xf
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU337
+	.uleb128 .LVU339
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	render_y
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU309
+	.uleb128 .LVU311
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x18
+	.byte	0x3
+	.quad	render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU309
+	.uleb128 .LVU311
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 8
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU251
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU279
+	.uleb128 .LVU280
+	.uleb128 .LVU281
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU252
+	.uleb128 .LVU256
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x44aaff
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU269
+	.uleb128 .LVU273
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xcccccc
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_cursor_lock
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU228
+	.uleb128 .LVU230
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_cursor_lock
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU178
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU204
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU186
+	.uleb128 .LVU201
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bgcolor
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU186
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU201
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0xf
+	.byte	0x3
+	.quad	cursor_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x11
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	cursor_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU186
+	.uleb128 .LVU201
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cursor_x
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU188
+	.uleb128 .LVU201
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	frame_buffer
+	.byte	0x6
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU191
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU201
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1e
+	.byte	0x3
+	.quad	cursor_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x3
+	.quad	cursor_x
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x20
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	cursor_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x3
+	.quad	cursor_x
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU189
+	.uleb128 .LVU191
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0xf
+	.byte	0x3
+	.quad	cursor_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU189
+	.uleb128 .LVU191
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cursor_x
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE40-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU133
+	.uleb128 .LVU137
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0xc
+	.byte	0x3
+	.quad	font_header
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU140
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0x3
+	.quad	font_header
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x6
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU142
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x7
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x9
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x7
+	.byte	0x7a
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU151
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU173
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0xe
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU153
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU173
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU160
+	.uleb128 .LVU167
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x5
+	.byte	0x31
+	.byte	0x72
+	.sleb128 0
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU93
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE39-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU45
+	.uleb128 .LVU88
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU49
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU63
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0xf
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x12
+	.byte	0x70
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU53
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU63
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-1-.Ltext0
+	.uleb128 0x10
+	.byte	0x70
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x70
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU71
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU89
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x12
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x15
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x72
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x72
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU75
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU89
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0xb
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x72
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0xe
+	.byte	0x72
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x72
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x10
+	.byte	0x72
+	.sleb128 24
+	.byte	0x6
+	.byte	0x32
+	.byte	0x25
+	.byte	0x72
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x72
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 16
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 8
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU66
+	.uleb128 .LVU71
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0xf
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	glyph_height
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU66
+	.uleb128 .LVU71
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 8
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU1
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU9
+	.uleb128 .LVU22
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xffffff
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU9
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU22
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0xf
+	.byte	0x3
+	.quad	input_render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x11
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	input_render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU9
+	.uleb128 .LVU22
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	input_render_x
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU11
+	.uleb128 .LVU22
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	frame_buffer
+	.byte	0x6
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU14
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU22
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1e
+	.byte	0x3
+	.quad	input_render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x3
+	.quad	input_render_x
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x20
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	input_render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x3
+	.quad	input_render_x
+	.byte	0x94
+	.byte	0x4
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0xf
+	.byte	0x3
+	.quad	input_render_y
+	.byte	0x94
+	.byte	0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	input_render_x
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU593
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 .LVU597
+	.uleb128 .LVU597
+	.uleb128 .LVU599
+	.uleb128 .LVU599
+	.uleb128 .LVU601
+	.uleb128 .LVU601
+	.uleb128 .LVU604
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB102-.Ltext0
+	.uleb128 .LBE102-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB103-.Ltext0
+	.uleb128 .LBE103-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB91-.Ltext0
+	.uleb128 .LBE91-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB96-.Ltext0
+	.uleb128 .LBE96-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB97-.Ltext0
+	.uleb128 .LBE97-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB98-.Ltext0
+	.uleb128 .LBE98-.Ltext0
+	.byte	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0
+.LLRL18:
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0
+.LLRL24:
+	.byte	0x4
+	.uleb128 .LBB117-.Ltext0
+	.uleb128 .LBE117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB120-.Ltext0
+	.uleb128 .LBE120-.Ltext0
+	.byte	0
+.LLRL27:
+	.byte	0x4
+	.uleb128 .LBB124-.Ltext0
+	.uleb128 .LBE124-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB127-.Ltext0
+	.uleb128 .LBE127-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB128-.Ltext0
+	.uleb128 .LBE128-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB129-.Ltext0
+	.uleb128 .LBE129-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB132-.Ltext0
+	.uleb128 .LBE132-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB152-.Ltext0
+	.uleb128 .LBE152-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB153-.Ltext0
+	.uleb128 .LBE153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB155-.Ltext0
+	.uleb128 .LBE155-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB138-.Ltext0
+	.uleb128 .LBE138-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB205-.Ltext0
+	.uleb128 .LBE205-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB214-.Ltext0
+	.uleb128 .LBE214-.Ltext0
+	.byte	0
+.LLRL59:
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB215-.Ltext0
+	.uleb128 .LBE215-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0
+.LLRL63:
+	.byte	0x4
+	.uleb128 .LBB218-.Ltext0
+	.uleb128 .LBE218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB222-.Ltext0
+	.uleb128 .LBE222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB227-.Ltext0
+	.uleb128 .LBE227-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB231-.Ltext0
+	.uleb128 .LBE231-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB236-.Ltext0
+	.uleb128 .LBE236-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB239-.Ltext0
+	.uleb128 .LBE239-.Ltext0
+	.byte	0
+.LLRL82:
+	.byte	0x4
+	.uleb128 .LBB240-.Ltext0
+	.uleb128 .LBE240-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB243-.Ltext0
+	.uleb128 .LBE243-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB250-.Ltext0
+	.uleb128 .LBE250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB252-.Ltext0
+	.uleb128 .LBE252-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB259-.Ltext0
+	.uleb128 .LBE259-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB260-.Ltext0
+	.uleb128 .LBE260-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB256-.Ltext0
+	.uleb128 .LBE256-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB261-.Ltext0
+	.uleb128 .LBE261-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB267-.Ltext0
+	.uleb128 .LBE267-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB289-.Ltext0
+	.uleb128 .LBE289-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB290-.Ltext0
+	.uleb128 .LBE290-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB291-.Ltext0
+	.uleb128 .LBE291-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB292-.Ltext0
+	.uleb128 .LBE292-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB293-.Ltext0
+	.uleb128 .LBE293-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB294-.Ltext0
+	.uleb128 .LBE294-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB295-.Ltext0
+	.uleb128 .LBE295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB296-.Ltext0
+	.uleb128 .LBE296-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB297-.Ltext0
+	.uleb128 .LBE297-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB298-.Ltext0
+	.uleb128 .LBE298-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB299-.Ltext0
+	.uleb128 .LBE299-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB300-.Ltext0
+	.uleb128 .LBE300-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB301-.Ltext0
+	.uleb128 .LBE301-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB302-.Ltext0
+	.uleb128 .LBE302-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB303-.Ltext0
+	.uleb128 .LBE303-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB304-.Ltext0
+	.uleb128 .LBE304-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB269-.Ltext0
+	.uleb128 .LBE269-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB271-.Ltext0
+	.uleb128 .LBE271-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB272-.Ltext0
+	.uleb128 .LBE272-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB305-.Ltext0
+	.uleb128 .LBE305-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB331-.Ltext0
+	.uleb128 .LBE331-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB332-.Ltext0
+	.uleb128 .LBE332-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB306-.Ltext0
+	.uleb128 .LBE306-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB321-.Ltext0
+	.uleb128 .LBE321-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB307-.Ltext0
+	.uleb128 .LBE307-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB320-.Ltext0
+	.uleb128 .LBE320-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB308-.Ltext0
+	.uleb128 .LBE308-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB314-.Ltext0
+	.uleb128 .LBE314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB315-.Ltext0
+	.uleb128 .LBE315-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB316-.Ltext0
+	.uleb128 .LBE316-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB317-.Ltext0
+	.uleb128 .LBE317-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB322-.Ltext0
+	.uleb128 .LBE322-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB326-.Ltext0
+	.uleb128 .LBE326-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB327-.Ltext0
+	.uleb128 .LBE327-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF99:
+	.string	"input_render_x"
+.LASF100:
+	.string	"input_render_y"
+.LASF116:
+	.string	"strcmp"
+.LASF20:
+	.string	"size_t"
+.LASF11:
+	.string	"uint64_t"
+.LASF164:
+	.string	"_clear_screen"
+.LASF72:
+	.string	"gp_offset"
+.LASF26:
+	.string	"revision"
+.LASF25:
+	.string	"limine_file"
+.LASF76:
+	.string	"va_list"
+.LASF29:
+	.string	"path"
+.LASF46:
+	.string	"red_mask_shift"
+.LASF157:
+	.string	"_put_pixel"
+.LASF65:
+	.string	"modules"
+.LASF56:
+	.string	"limine_framebuffer_response"
+.LASF125:
+	.string	"_handle_cmd"
+.LASF108:
+	.string	"kmem_cache_report"
+.LASF123:
+	.string	"blank_start"
+.LASF111:
+	.string	"kmem_color_benchmark"
+.LASF54:
+	.string	"mode_count"
+.LASF60:
+	.string	"response"
+.LASF21:
+	.string	"long long int"
+.LASF2:
+	.string	"signed char"
+.LASF144:
+	.string	"bitIndex"
+.LASF47:
+	.string	"green_mask_size"
+.LASF143:
+	.string	"rowData"
+.LASF28:
+	.string	"size"
+.LASF98:
+	.string	"render_y"
+.LASF24:
+	.string	"limine_uuid"
+.LASF55:
+	.string	"modes"
+.LASF63:
+	.string	"limine_module_response"
+.LASF33:
+	.string	"tftp_ip"
+.LASF84:
+	.string	"file_request"
+.LASF4:
+	.string	"long int"
+.LASF80:
+	.string	"magic"
+.LASF148:
+	.string	"start_pixel_index"
+.LASF162:
+	.string	"__builtin_va_list"
+.LASF97:
+	.string	"render_x"
+.LASF87:
+	.string	"font_header"
+.LASF70:
+	.string	"spinlock_t"
+.LASF7:
+	.string	"uint16_t"
+.LASF138:
+	.string	"_clear_cursor"
+.LASF104:
+	.string	"_cursor_lock"
+.LASF137:
+	.string	"_render_cursor"
+.LASF127:
+	.string	"term_init"
+.LASF140:
+	.string	"bytesPerGlyph"
+.LASF134:
+	.string	"_move_to_next_line"
+.LASF78:
+	.string	"zero_pool_misses"
+.LASF109:
+	.string	"vm_report"
+.LASF149:
+	.string	"end_pixel_index"
+.LASF94:
+	.string	"is_ready"
+.LASF53:
+	.string	"edid"
+.LASF48:
+	.string	"green_mask_shift"
+.LASF161:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF10:
+	.string	"unsigned int"
+.LASF136:
+	.string	"term_cblink"
+.LASF112:
+	.string	"memops_benchmark"
+.LASF115:
+	.string	"strlen"
+.LASF141:
+	.string	"dataIndex"
+.LASF74:
+	.string	"overflow_arg_area"
+.LASF12:
+	.string	"long unsigned int"
+.LASF36:
+	.string	"mbr_disk_id"
+.LASF126:
+	.string	"term_clear"
+.LASF35:
+	.string	"partition_index"
+.LASF58:
+	.string	"framebuffers"
+.LASF45:
+	.string	"red_mask_size"
+.LASF117:
+	.string	"vsnprintf"
+.LASF42:
+	.string	"width"
+.LASF106:
+	.string	"alloc_profile_report_serial"
+.LASF19:
+	.string	"KeyEvent_t"
+.LASF8:
+	.string	"short unsigned int"
+.LASF52:
+	.string	"edid_size"
+.LASF59:
+	.string	"limine_framebuffer_request"
+.LASF155:
+	.string	"enable_interrupts"
+.LASF154:
+	.string	"term_fgcolor"
+.LASF37:
+	.string	"gpt_disk_uuid"
+.LASF68:
+	.string	"internal_modules"
+.LASF133:
+	.string	"requests"
+.LASF79:
+	.string	"kernel_timer_secs"
+.LASF150:
+	.string	"color"
+.LASF40:
+	.string	"limine_video_mode"
+.LASF95:
+	.string	"fgcolor"
+.LASF67:
+	.string	"internal_module_count"
+.LASF32:
+	.string	"unused"
+.LASF81:
+	.string	"fontMode"
+.LASF22:
+	.string	"long double"
+.LASF44:
+	.string	"memory_model"
+.LASF27:
+	.string	"address"
+.LASF71:
+	.string	"__gnuc_va_list"
+.LASF93:
+	.string	"glyph_height"
+.LASF102:
+	.string	"cursor_y"
+.LASF129:
+	.string	"tprintf"
+.LASF41:
+	.string	"pitch"
+.LASF107:
+	.string	"alloc_profile_report"
+.LASF50:
+	.string	"blue_mask_shift"
+.LASF90:
+	.string	"max_rows"
+.LASF142:
+	.string	"glyphRow"
+.LASF13:
+	.string	"scan_code"
+.LASF151:
+	.string	"fb_ptr"
+.LASF103:
+	.string	"input_str"
+.LASF82:
+	.string	"char_height"
+.LASF110:
+	.string	"alloc_benchmark"
+.LASF96:
+	.string	"bgcolor"
+.LASF146:
+	.string	"_load_font"
+.LASF119:
+	.string	"kprintf"
+.LASF18:
+	.string	"_Bool"
+.LASF5:
+	.string	"unsigned char"
+.LASF159:
+	.string	"pLock"
+.LASF85:
+	.string	"framebuffer_request"
+.LASF88:
+	.string	"frame_buffer"
+.LASF3:
+	.string	"short int"
+.LASF113:
+	.string	"kmem_report_serial"
+.LASF160:
+	.string	"spinlock_lock"
+.LASF16:
+	.string	"is_control"
+.LASF61:
+	.string	"limine_internal_module"
+.LASF31:
+	.string	"media_type"
+.LASF83:
+	.string	"PSF1_Header"
+.LASF75:
+	.string	"reg_save_area"
+.LASF130:
+	.string	"format"
+.LASF39:
+	.string	"part_uuid"
+.LASF124:
+	.string	"blank_end"
+.LASF114:
+	.string	"kmem_report"
+.LASF158:
+	.string	"spinlock_unlock"
+.LASF9:
+	.string	"uint32_t"
+.LASF105:
+	.string	"cursor_visible"
+.LASF101:
+	.string	"cursor_x"
+.LASF139:
+	.string	"_render_glyph"
+.LASF91:
+	.string	"max_cols"
+.LASF17:
+	.string	"char"
+.LASF153:
+	.string	"term_bgcolor"
+.LASF156:
+	.string	"disable_interrupts"
+.LASF165:
+	.string	"fbindex"
+.LASF152:
+	.string	"index"
+.LASF89:
+	.string	"glyph_padding"
+.LASF131:
+	.string	"buffer"
+.LASF30:
+	.string	"cmdline"
+.LASF120:
+	.string	"memcmp"
+.LASF64:
+	.string	"module_count"
+.LASF92:
+	.string	"glyph_width"
+.LASF135:
+	.string	"_render_input_line"
+.LASF38:
+	.string	"gpt_part_uuid"
+.LASF132:
+	.string	"args"
+.LASF118:
+	.string	"kmem_zero_pool_count"
+.LASF121:
+	.string	"memset"
+.LASF49:
+	.string	"blue_mask_size"
+.LASF15:
+	.string	"ascii"
+.LASF34:
+	.string	"tftp_port"
+.LASF122:
+	.string	"memmove"
+.LASF6:
+	.string	"uint8_t"
+.LASF14:
+	.string	"event_type"
+.LASF73:
+	.string	"fp_offset"
+.LASF145:
+	.string	"bit_mask"
+.LASF62:
+	.string	"flags"
+.LASF128:
+	.string	"term_keyevent"
+.LASF66:
+	.string	"limine_module_request"
+.LASF86:
+	.string	"glyph_data"
+.LASF57:
+	.string	"framebuffer_count"
+.LASF23:
+	.string	"KeyEvent"
+.LASF43:
+	.string	"height"
+.LASF77:
+	.string	"zero_pool_hits"
+.LASF69:
+	.string	"lock"
+.LASF147:
+	.string	"_shift_screen_up"
+.LASF51:
+	.string	"limine_framebuffer"
+.LASF163:
+	.string	"__va_list_tag"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/terminal.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
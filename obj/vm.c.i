@@ -0,0 +1,1807 @@
+# 0 "src/vm.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "src/vm.c"
+# 21 "src/vm.c"
+# 1 "src/include/vm.h" 1
+# 21 "src/include/vm.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h" 3 4
+typedef signed char int8_t;
+
+
+typedef short int int16_t;
+
+
+typedef int int32_t;
+
+
+typedef long int int64_t;
+
+
+typedef unsigned char uint8_t;
+
+
+typedef short unsigned int uint16_t;
+
+
+typedef unsigned int uint32_t;
+
+
+typedef long unsigned int uint64_t;
+
+
+
+
+typedef signed char int_least8_t;
+typedef short int int_least16_t;
+typedef int int_least32_t;
+typedef long int int_least64_t;
+typedef unsigned char uint_least8_t;
+typedef short unsigned int uint_least16_t;
+typedef unsigned int uint_least32_t;
+typedef long unsigned int uint_least64_t;
+
+
+
+typedef signed char int_fast8_t;
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+typedef unsigned char uint_fast8_t;
+typedef long unsigned int uint_fast16_t;
+typedef long unsigned int uint_fast32_t;
+typedef long unsigned int uint_fast64_t;
+
+
+
+
+typedef long int intptr_t;
+
+
+typedef long unsigned int uintptr_t;
+
+
+
+
+typedef long int intmax_t;
+typedef long unsigned int uintmax_t;
+# 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 22 "src/include/vm.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 23 "src/include/vm.h" 2
+# 41 "src/include/vm.h"
+
+# 41 "src/include/vm.h"
+void vm_init();
+uint64_t walk_page_table(uint64_t virt_addr);
+
+# 43 "src/include/vm.h" 3 4
+_Bool 
+# 43 "src/include/vm.h"
+    vm_map(uint64_t virt_addr, uint64_t phys_addr, uint32_t flags);
+
+# 44 "src/include/vm.h" 3 4
+_Bool 
+# 44 "src/include/vm.h"
+    vm_map_range(uint64_t virt_addr, uint64_t phys_addr, uint64_t size, uint32_t flags);
+void vm_unmap(uint64_t virt_addr);
+void vm_unmap_range(uint64_t virt_addr, uint64_t size);
+
+# 47 "src/include/vm.h" 3 4
+_Bool 
+# 47 "src/include/vm.h"
+    vm_protect(uint64_t virt_addr, uint32_t flags);
+
+# 48 "src/include/vm.h" 3 4
+_Bool 
+# 48 "src/include/vm.h"
+    vm_protect_range(uint64_t virt_addr, uint64_t size, uint32_t flags);
+void vm_report();
+# 22 "src/vm.c" 2
+# 1 "src/include/str.h" 1
+# 22 "src/include/str.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 23 "src/include/str.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+# 24 "src/include/str.h" 2
+# 37 "src/include/str.h"
+
+# 37 "src/include/str.h"
+void reverse(char str[], size_t length);
+
+size_t itoa(int num, char str[], size_t base);
+size_t ltoa(int64_t num, char str[], size_t base);
+size_t ultoa(uint64_t num, char str[], size_t base);
+
+size_t strlen(const char *str);
+int strcmp(const char *l, const char *r);
+
+int snprintf(char buffer[], size_t size, const char format[], ...);
+int vsnprintf(char buffer[], size_t size, const char format[], va_list args);
+void kprintf(const char format[], ...);
+
+void sprint_binary8(char s[], uint8_t ch);
+void sprint_binary16(char s[], uint16_t ch);
+void sprint_binary32(char buff[], uint32_t ch);
+void sprint_binary64(char buff[], uint64_t ch);
+# 23 "src/vm.c" 2
+# 1 "src/include/cpu.h" 1
+# 42 "src/include/cpu.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 43 "src/include/cpu.h" 2
+# 51 "src/include/cpu.h"
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;
+    uint32_t lapic_id;
+    uint32_t node;
+} __attribute__((aligned(64)));
+
+extern uint32_t bsp_lapic_id;
+extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[64];
+
+extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+
+
+
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(
+# 71 "src/include/cpu.h" 3 4
+                                                         __builtin_offsetof (
+# 71 "src/include/cpu.h"
+                                                         struct cpu_local
+# 71 "src/include/cpu.h" 3 4
+                                                         , 
+# 71 "src/include/cpu.h"
+                                                         index
+# 71 "src/include/cpu.h" 3 4
+                                                         )
+# 71 "src/include/cpu.h"
+                                                                                          ));
+    return index;
+}
+
+
+
+
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(
+# 81 "src/include/cpu.h" 3 4
+                                                        __builtin_offsetof (
+# 81 "src/include/cpu.h"
+                                                        struct cpu_local
+# 81 "src/include/cpu.h" 3 4
+                                                        , 
+# 81 "src/include/cpu.h"
+                                                        node
+# 81 "src/include/cpu.h" 3 4
+                                                        )
+# 81 "src/include/cpu.h"
+                                                                                        ));
+    return node;
+}
+
+
+static inline void outb(uint16_t port, uint8_t val)
+{
+    asm volatile("outb %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outw(uint16_t port, uint16_t val)
+{
+    asm volatile("outw %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline void outl(uint16_t port, uint32_t val)
+{
+    asm volatile("outl %0, %1" : : "a"(val), "nd"(port) : "memory");
+}
+
+
+static inline uint8_t inb(uint16_t port)
+{
+    uint8_t ret;
+    asm volatile("inb %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint16_t inw(uint16_t port)
+{
+    uint16_t ret;
+    asm volatile("inw %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+
+static inline uint32_t inl(uint16_t port)
+{
+    uint32_t ret;
+    asm volatile("inl %1, %0"
+                 : "=a"(ret)
+                 : "Nd"(port)
+                 : "memory");
+    return ret;
+}
+
+static inline uint64_t get_rax()
+{
+    uint64_t val;
+    asm volatile ("movq %%rax, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_rax(uint64_t val)
+{
+    asm volatile ("movq %0, %%rax" :: "r"(val) : "memory");
+}
+
+static inline uint64_t read_msr(uint32_t msr_id)
+{
+    uint32_t low, high;
+
+    asm volatile (
+        "rdmsr" :
+        "=a"(low), "=d"(high) :
+        "c"(msr_id)
+    );
+
+    return ((uint64_t) high << 32) | low;
+}
+
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+# 203 "src/include/cpu.h"
+static inline uint64_t get_cr0()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr0, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr3()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr3, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline uint64_t get_cr4()
+{
+    uint64_t val;
+    asm volatile ("movq %%cr4, %0" : "=r"(val) :: "memory");
+    return val;
+}
+
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
+static inline void cpuid(int code, uint32_t *a, uint32_t *d)
+{
+    asm volatile (
+        "cpuid"
+        : "=a"(*a), "=d"(*d)
+        : "O"(code)
+        : "ebx", "ecx"
+        );
+}
+
+static inline uint64_t cpu_get_address_widths()
+{
+    uint64_t eax = 0x80000008;
+    asm volatile (
+        "cpuid"
+        : "=a"(eax)
+        : "a" (eax)
+    );
+
+    return eax;
+}
+
+static inline int is_paging_enabled()
+{
+
+    uint64_t bitmask = 0x80000000;
+
+    if (get_cr0() & bitmask) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline void set_cr0(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr0" :: "r"(val) : "memory");
+}
+
+static inline void lidt(void* idt_ptr)
+{
+    asm volatile("lidt (%0)" :: "r"(idt_ptr) : "memory");
+}
+
+static inline void disable_interrupts()
+{
+    asm("cli");
+}
+
+static inline void enable_interrupts()
+{
+    asm("sti");
+}
+
+static inline 
+# 294 "src/include/cpu.h" 3 4
+             _Bool 
+# 294 "src/include/cpu.h"
+                  interrupt_state()
+{
+    unsigned long flags;
+
+    asm volatile ("pushfq\n\t"
+                  "pop %0\n\t"
+                  : "=rm" (flags)
+                  :
+                  : "memory");
+
+    return (flags & (1 << 9)) != 0;
+}
+
+
+
+
+static inline 
+# 310 "src/include/cpu.h" 3 4
+             _Bool 
+# 310 "src/include/cpu.h"
+                  set_interrupt_state(
+# 310 "src/include/cpu.h" 3 4
+                                      _Bool 
+# 310 "src/include/cpu.h"
+                                           enabled)
+{
+    
+# 312 "src/include/cpu.h" 3 4
+   _Bool 
+# 312 "src/include/cpu.h"
+        state = interrupt_state();
+
+    if (enabled) {
+        enable_interrupts();
+    } else {
+        disable_interrupts();
+    }
+
+    return state;
+}
+
+
+
+
+static inline void isr_save()
+{
+    asm(
+        "push %%r15\n\t"
+        "push %%r14\n\t"
+        "push %%r13\n\t"
+        "push %%r12\n\t"
+        "push %%r11\n\t"
+        "push %%r10\n\t"
+        "push %%r9\n\t"
+        "push %%r8\n\t"
+        "push %%rbp\n\t"
+        "push %%rdi\n\t"
+        "push %%rsi\n\t"
+        "push %%rdx\n\t"
+        "push %%rcx\n\t"
+        "push %%rbx\n\t"
+        "push %%rax\n\t"
+        "mov %%es, %%eax\n\t"
+        "push %%rax\n\t"
+        "mov %%ds, %%eax\n\t"
+        "push %%rax\n\t"
+        :
+        :
+        : "memory"
+    );
+}
+
+
+
+
+static inline void isr_restore()
+{
+    asm(
+        "pop %%rax\n\t"
+        "mov %%eax, %%ds\n\t"
+        "pop %%rax\n\t"
+        "mov %%eax, %%es\n\t"
+        "pop %%rax\n\t"
+        "pop %%rbx\n\t"
+        "pop %%rcx\n\t"
+        "pop %%rdx\n\t"
+        "pop %%rsi\n\t"
+        "pop %%rdi\n\t"
+        "pop %%rbp\n\t"
+        "pop %%r8\n\t"
+        "pop %%r9\n\t"
+        "pop %%r10\n\t"
+        "pop %%r11\n\t"
+        "pop %%r12\n\t"
+        "pop %%r13\n\t"
+        "pop %%r14\n\t"
+        "pop %%r15\n\t"
+        "add $8, %%rsp\n\t"
+        "iretq"
+        :
+        :
+        : "memory"
+    );
+}
+# 24 "src/vm.c" 2
+# 1 "src/include/math.h" 1
+# 25 "src/vm.c" 2
+# 1 "src/include/mem.h" 1
+# 22 "src/include/mem.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 23 "src/include/mem.h" 2
+
+# 1 "src/include/limine.h" 1
+# 25 "src/include/limine.h"
+# 1 "src/include/serial.h" 1
+# 25 "src/include/serial.h"
+int init_serial(uint16_t port);
+void write_serial(uint16_t port, char a);
+void write_serial_str(uint16_t port, char *str);
+void write_serial_strf(uint16_t port, const char format[], ...);
+# 26 "src/include/limine.h" 2
+# 55 "src/include/limine.h"
+struct limine_uuid {
+    uint32_t a;
+    uint16_t b;
+    uint16_t c;
+    uint8_t d[8];
+};
+
+
+
+
+
+struct limine_file {
+    uint64_t revision;
+    void * address;
+    uint64_t size;
+    char * path;
+    char * cmdline;
+    uint32_t media_type;
+    uint32_t unused;
+    uint32_t tftp_ip;
+    uint32_t tftp_port;
+    uint32_t partition_index;
+    uint32_t mbr_disk_id;
+    struct limine_uuid gpt_disk_uuid;
+    struct limine_uuid gpt_part_uuid;
+    struct limine_uuid part_uuid;
+};
+
+
+
+
+
+struct limine_bootloader_info_response {
+    uint64_t revision;
+    char * name;
+    char * version;
+};
+
+struct limine_bootloader_info_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_bootloader_info_response * response;
+};
+
+
+
+
+
+struct limine_stack_size_response {
+    uint64_t revision;
+};
+
+struct limine_stack_size_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_stack_size_response * response;
+    uint64_t stack_size;
+};
+
+
+
+
+
+struct limine_hhdm_response {
+    uint64_t revision;
+    uint64_t offset;
+};
+
+struct limine_hhdm_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_hhdm_response * response;
+};
+
+
+
+
+
+
+
+struct limine_video_mode {
+    uint64_t pitch;
+    uint64_t width;
+    uint64_t height;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+};
+
+struct limine_framebuffer {
+    void * address;
+    uint64_t width;
+    uint64_t height;
+    uint64_t pitch;
+    uint16_t bpp;
+    uint8_t memory_model;
+    uint8_t red_mask_size;
+    uint8_t red_mask_shift;
+    uint8_t green_mask_size;
+    uint8_t green_mask_shift;
+    uint8_t blue_mask_size;
+    uint8_t blue_mask_shift;
+    uint8_t unused[7];
+    uint64_t edid_size;
+    void * edid;
+
+    uint64_t mode_count;
+    struct limine_video_mode ** modes;
+};
+
+struct limine_framebuffer_response {
+    uint64_t revision;
+    uint64_t framebuffer_count;
+    struct limine_framebuffer ** framebuffers;
+};
+
+struct limine_framebuffer_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_framebuffer_response * response;
+};
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 213 "src/include/limine.h"
+
+# 213 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 213 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_terminal;
+
+typedef void (*limine_terminal_write)(struct limine_terminal *, const char *, uint64_t);
+typedef void (*limine_terminal_callback)(struct limine_terminal *, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct __attribute__((__deprecated__)) limine_terminal {
+    uint64_t columns;
+    uint64_t rows;
+    struct limine_framebuffer * framebuffer;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_response {
+    uint64_t revision;
+    uint64_t terminal_count;
+    struct limine_terminal ** terminals;
+    limine_terminal_write write;
+};
+
+struct __attribute__((__deprecated__)) limine_terminal_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_terminal_response * response;
+    limine_terminal_callback callback;
+};
+
+
+# 240 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 240 "src/include/limine.h"
+
+# 266 "src/include/limine.h"
+struct limine_paging_mode_response {
+    uint64_t revision;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+struct limine_paging_mode_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_paging_mode_response * response;
+    uint64_t mode;
+    uint64_t flags;
+};
+
+
+
+
+
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic push
+# 284 "src/include/limine.h"
+
+# 284 "src/include/limine.h"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+# 284 "src/include/limine.h"
+
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_response {
+    uint64_t revision;
+};
+
+struct __attribute__((__deprecated__)) limine_5_level_paging_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_5_level_paging_response * response;
+};
+
+
+# 296 "src/include/limine.h"
+#pragma GCC diagnostic pop
+# 296 "src/include/limine.h"
+
+
+
+
+
+
+struct limine_smp_info;
+
+typedef void (*limine_goto_address)(struct limine_smp_info *);
+
+
+
+
+
+struct limine_smp_info {
+    uint32_t processor_id;
+    uint32_t lapic_id;
+    uint64_t reserved;
+    limine_goto_address goto_address;
+    uint64_t extra_argument;
+};
+
+struct limine_smp_response {
+    uint64_t revision;
+    uint32_t flags;
+    uint32_t bsp_lapic_id;
+    uint64_t cpu_count;
+    struct limine_smp_info ** cpus;
+};
+# 367 "src/include/limine.h"
+struct limine_smp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smp_response * response;
+    uint64_t flags;
+};
+# 387 "src/include/limine.h"
+struct limine_memmap_entry {
+    uint64_t base;
+    uint64_t length;
+    uint64_t type;
+};
+
+struct limine_memmap_response {
+    uint64_t revision;
+    uint64_t entry_count;
+    struct limine_memmap_entry ** entries;
+};
+
+struct limine_memmap_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_memmap_response * response;
+};
+
+
+
+
+
+typedef void (*limine_entry_point)(void);
+
+struct limine_entry_point_response {
+    uint64_t revision;
+};
+
+struct limine_entry_point_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_entry_point_response * response;
+    limine_entry_point entry;
+};
+
+
+
+
+
+struct limine_kernel_file_response {
+    uint64_t revision;
+    struct limine_file * kernel_file;
+};
+
+struct limine_kernel_file_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_file_response * response;
+};
+
+
+
+
+
+
+
+struct limine_internal_module {
+    const char * path;
+    const char * cmdline;
+    uint64_t flags;
+};
+
+struct limine_module_response {
+    uint64_t revision;
+    uint64_t module_count;
+    struct limine_file ** modules;
+};
+
+struct limine_module_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_module_response * response;
+
+
+    uint64_t internal_module_count;
+    struct limine_internal_module ** internal_modules;
+};
+
+
+
+
+
+struct limine_rsdp_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_rsdp_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_rsdp_response * response;
+};
+
+
+
+
+
+struct limine_smbios_response {
+    uint64_t revision;
+    void * entry_32;
+    void * entry_64;
+};
+
+struct limine_smbios_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_smbios_response * response;
+};
+
+
+
+
+
+struct limine_efi_system_table_response {
+    uint64_t revision;
+    void * address;
+};
+
+struct limine_efi_system_table_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_efi_system_table_response * response;
+};
+
+
+
+
+
+struct limine_boot_time_response {
+    uint64_t revision;
+    int64_t boot_time;
+};
+
+struct limine_boot_time_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_boot_time_response * response;
+};
+
+
+
+
+
+struct limine_kernel_address_response {
+    uint64_t revision;
+    uint64_t physical_base;
+    uint64_t virtual_base;
+};
+
+struct limine_kernel_address_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_kernel_address_response * response;
+};
+
+
+
+
+
+struct limine_dtb_response {
+    uint64_t revision;
+    void * dtb_ptr;
+};
+
+struct limine_dtb_request {
+    uint64_t id[4];
+    uint64_t revision;
+    struct limine_dtb_response * response;
+};
+# 25 "src/include/mem.h" 2
+# 121 "src/include/mem.h"
+struct page {
+    void *pOwner;
+    uint32_t pages_allocated;
+    uint32_t refcount;
+    uint32_t lru_next;
+    uint32_t lru_prev;
+    uint16_t flags;
+    uint32_t index;
+} __attribute__((aligned(32)));
+
+
+
+
+struct page_mover {
+    
+# 135 "src/include/mem.h" 3 4
+   _Bool 
+# 135 "src/include/mem.h"
+        (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+
+
+
+
+
+
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;
+    uint64_t pcp_pages;
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[2];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;
+    uint64_t desc_pages;
+    uint64_t desc_chunks;
+    uint64_t largest_free_run;
+    uint64_t free_runs[64];
+    uint64_t free_blocks[18 + 1];
+};
+
+extern volatile struct limine_memmap_response *memmap;
+
+extern uint64_t total_memory_bytes;
+extern uint64_t max_pages_available;
+extern uint64_t num_pages_available;
+extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
+
+void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
+void* memmap_alloc(size_t length);
+void* kalloc(size_t numBytes);
+void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
+void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
+
+void memdumps(void *location, uint64_t len_bytes);
+void memdumpx32(void *location, uint64_t len_bytes);
+void memdumpx64(void *location, uint64_t len_bytes);
+
+void memops_init();
+void memops_benchmark();
+
+void *memset(void *s, int c, size_t n);
+void *memmove(void *dest, const void *src, size_t n);
+int memcmp(const void *s1, const void *s2, size_t n);
+# 26 "src/vm.c" 2
+# 1 "src/include/atomic.h" 1
+# 23 "src/include/atomic.h"
+typedef struct {
+    uint8_t lock;
+} spinlock_t;
+
+static inline void spinlock_lock(spinlock_t *pLock)
+{
+    while (__sync_lock_test_and_set(&pLock->lock, 1)) {
+
+    }
+}
+
+static inline void spinlock_unlock(spinlock_t *pLock)
+{
+    __sync_lock_release(&pLock->lock);
+}
+# 27 "src/vm.c" 2
+# 1 "src/kernel.h" 1
+# 22 "src/kernel.h"
+# 1 "src/include/queue.h" 1
+# 25 "src/include/queue.h"
+typedef struct {
+    volatile uint32_t read_i;
+    volatile uint32_t write_i;
+    uint32_t *buff;
+    uint32_t len;
+    volatile uint32_t num_items;
+    spinlock_t lock;
+} __attribute__((packed)) CQueue_t;
+
+CQueue_t* cqueue_create(uint32_t len);
+
+# 35 "src/include/queue.h" 3 4
+_Bool 
+# 35 "src/include/queue.h"
+           cqueue_write(CQueue_t *q, uint32_t val);
+uint32_t cqueue_read(CQueue_t *q);
+# 23 "src/kernel.h" 2
+
+void report_cpu_details();
+
+
+static inline void hcf(void)
+{
+    asm("cli");
+    for (;;) {
+        asm("hlt");
+    }
+}
+
+extern CQueue_t *q_keyboard;
+# 28 "src/vm.c" 2
+# 60 "src/vm.c"
+uint32_t maxphyaddr;
+uint32_t maxlinaddr;
+
+
+static uint64_t *pKernelPml4 = 
+# 64 "src/vm.c" 3 4
+                              ((void *)0)
+# 64 "src/vm.c"
+                                  ;
+static spinlock_t vm_lock = {0};
+static 
+# 66 "src/vm.c" 3 4
+      _Bool 
+# 66 "src/vm.c"
+           nx_enabled = 
+# 66 "src/vm.c" 3 4
+                        0
+# 66 "src/vm.c"
+                             ;
+
+
+static uint64_t vm_table_pages = 0;
+static uint64_t vm_split_pages = 0;
+static uint64_t vm_invlpgs = 0;
+static uint64_t vm_full_flushes = 0;
+
+
+
+
+
+struct VmFlush {
+    uint32_t count;
+    uint64_t pages[32];
+};
+
+
+
+
+uint64_t walk_page_table(uint64_t virt_addr)
+{
+# 96 "src/vm.c"
+    uint64_t cr3 = get_cr3();
+
+
+
+
+
+    uint64_t addrmask = (((uint64_t)1 << maxphyaddr) - 1) << 12;
+    uint64_t pml4addr = cr3 & addrmask;
+    uint64_t *pml4 = (uint64_t*)((void*)((uint64_t)(pml4addr) + vmm_higher_half_offset));
+
+
+
+    uint64_t pml4e = pml4[(((virt_addr) >> 39) & 0x1FF)];
+    if (!(pml4e & 0x1)) {
+
+        return 0;
+    }
+
+
+
+    uint64_t *pdpt = (uint64_t*)((void*)((uint64_t)(pml4e & addrmask) + vmm_higher_half_offset));
+
+
+    uint64_t pdpte = pdpt[(((virt_addr) >> 30) & 0x1FF)];
+    if (!(pdpte & 0x1)) {
+        return 0;
+    }
+
+
+    if (pdpte & 0x80) {
+        return (pdpte & addrmask & ~(((uint64_t)1 << (12 + 9 * ((3) - 1))) - 1)) | (virt_addr & (((uint64_t)1 << (12 + 9 * ((3) - 1))) - 1));
+    }
+
+
+    uint64_t *pd = (uint64_t*)((void*)((uint64_t)(pdpte & addrmask) + vmm_higher_half_offset));
+
+
+    uint64_t pde = pd[(((virt_addr) >> 21) & 0x1FF)];
+    if (!(pde & 0x1)) {
+        return 0;
+    }
+
+
+    if (pde & 0x80) {
+        return (pde & addrmask & ~(((uint64_t)1 << (12 + 9 * ((2) - 1))) - 1)) | (virt_addr & (((uint64_t)1 << (12 + 9 * ((2) - 1))) - 1));
+    }
+
+
+    uint64_t *pt = (uint64_t*)((void*)((uint64_t)(pde & addrmask) + vmm_higher_half_offset));
+
+
+    uint64_t pte = pt[(((virt_addr) >> 12) & 0x1FF)];
+
+    if (!(pte & 0x1)) {
+        return 0;
+    }
+
+
+
+
+    uint64_t phys_addr = (pte & addrmask) | ((virt_addr) & 0xFFF);
+    return phys_addr;
+}
+
+static void _vm_flush_add(struct VmFlush *pFlush, uint64_t virt)
+{
+    if (pFlush->count < 32) {
+        pFlush->pages[pFlush->count] = virt;
+    }
+
+    pFlush->count++;
+}
+
+
+
+
+
+
+static void _vm_flush(struct VmFlush *pFlush)
+{
+    if (pFlush->count == 0) {
+        return;
+    }
+
+    if (pFlush->count > 32) {
+        uint64_t cr4 = get_cr4();
+        if (cr4 & 0x80) {
+            set_cr4(cr4 & ~0x80);
+            set_cr4(cr4);
+        } else {
+            set_cr3(get_cr3());
+        }
+        vm_full_flushes++;
+    } else {
+        for (uint32_t i = 0; i < pFlush->count; i++) {
+            invlpg(pFlush->pages[i]);
+        }
+        vm_invlpgs += pFlush->count;
+    }
+
+    pFlush->count = 0;
+}
+
+
+static uint64_t _vm_attrs(uint32_t flags)
+{
+    uint64_t attrs = 0x1;
+
+    if (flags & 0x1) attrs |= 0x2;
+    if (flags & 0x4) attrs |= 0x4;
+    if (flags & 0x8) attrs |= 0x8;
+    if (flags & 0x10) attrs |= 0x10;
+    if (flags & 0x20) attrs |= 0x100;
+    if (!(flags & 0x2) && nx_enabled) attrs |= 0x8000000000000000;
+
+    return attrs;
+}
+
+
+static uint64_t _vm_alloc_table()
+{
+    void *pTable = kalloc_zone(4096, 0x2);
+    if (!pTable) {
+        kprintf("VMM: Out of memory for page tables.\n");
+        return 0;
+    }
+
+    vm_table_pages++;
+    return ((uint64_t)(pTable) - vmm_higher_half_offset);
+}
+
+
+
+
+
+
+static uint64_t* _vm_find(uint64_t virt, uint32_t *pLevel, uint64_t parent)
+{
+    uint64_t *pTable = pKernelPml4;
+
+    for (uint32_t level = 4; ; level--) {
+        uint64_t *pEntry = &pTable[(((virt) >> (12 + 9 * ((level) - 1))) & 0x1FF)];
+        *pLevel = level;
+
+        if (!(*pEntry & 0x1)) {
+            return 
+# 241 "src/vm.c" 3 4
+                  ((void *)0)
+# 241 "src/vm.c"
+                      ;
+        }
+
+        if (level == 1 || (level <= 3 && (*pEntry & 0x80))) {
+            return pEntry;
+        }
+
+        *pEntry |= parent;
+        pTable = (uint64_t*)((void*)((uint64_t)(*pEntry & 0x000FFFFFFFFFF000) + vmm_higher_half_offset));
+    }
+}
+
+
+
+
+
+static 
+# 257 "src/vm.c" 3 4
+      _Bool 
+# 257 "src/vm.c"
+           _vm_split(uint64_t *pEntry, uint32_t level, uint64_t virt)
+{
+    uint64_t table = _vm_alloc_table();
+    if (!table) {
+        return 
+# 261 "src/vm.c" 3 4
+              0
+# 261 "src/vm.c"
+                   ;
+    }
+
+    uint64_t entry = *pEntry;
+    uint64_t *pTable = (uint64_t*)((void*)((uint64_t)(table) + vmm_higher_half_offset));
+    uint64_t step = ((uint64_t)1 << (12 + 9 * ((level - 1) - 1)));
+    uint64_t base = entry & 0x000FFFFFFFFFF000 & ~(((uint64_t)1 << (12 + 9 * ((level) - 1))) - 1);
+    uint64_t attrs = entry & ~0x000FFFFFFFFFF000;
+    
+# 269 "src/vm.c" 3 4
+   _Bool 
+# 269 "src/vm.c"
+        pat = entry & 0x1000;
+
+    if (level == 2) {
+
+        attrs &= ~0x80;
+        if (pat) attrs |= 0x80;
+    } else if (pat) {
+        attrs |= 0x1000;
+    }
+
+    for (uint64_t i = 0; i < 512; i++) {
+        pTable[i] = (base + i * step) | attrs;
+    }
+
+
+    *pEntry = table | 0x1 | 0x2 | 0x200 | (entry & 0x4);
+    vm_split_pages++;
+
+
+
+
+    invlpg(virt);
+    vm_invlpgs++;
+
+    return 
+# 293 "src/vm.c" 3 4
+          1
+# 293 "src/vm.c"
+              ;
+}
+
+static 
+# 296 "src/vm.c" 3 4
+      _Bool 
+# 296 "src/vm.c"
+           _vm_map_page(uint64_t virt, uint64_t phys, uint64_t attrs)
+{
+    uint64_t *pTable = pKernelPml4;
+    uint64_t parent = attrs & 0x4;
+
+    for (uint32_t level = 4; level > 1; level--) {
+        uint64_t *pEntry = &pTable[(((virt) >> (12 + 9 * ((level) - 1))) & 0x1FF)];
+
+        if (!(*pEntry & 0x1)) {
+            uint64_t table = _vm_alloc_table();
+            if (!table) {
+                return 
+# 307 "src/vm.c" 3 4
+                      0
+# 307 "src/vm.c"
+                           ;
+            }
+            *pEntry = table | 0x1 | 0x2 | 0x200 | parent;
+        } else if (level <= 3 && (*pEntry & 0x80)) {
+            kprintf("VMM: 0x%X is already mapped by a large page.\n", virt);
+            return 
+# 312 "src/vm.c" 3 4
+                  0
+# 312 "src/vm.c"
+                       ;
+        } else {
+            *pEntry |= parent;
+        }
+
+        pTable = (uint64_t*)((void*)((uint64_t)(*pEntry & 0x000FFFFFFFFFF000) + vmm_higher_half_offset));
+    }
+
+    uint64_t *pPte = &pTable[(((virt) >> 12) & 0x1FF)];
+    if (*pPte & 0x1) {
+        kprintf("VMM: 0x%X is already mapped.\n", virt);
+        return 
+# 323 "src/vm.c" 3 4
+              0
+# 323 "src/vm.c"
+                   ;
+    }
+
+
+    *pPte = phys | attrs;
+    return 
+# 328 "src/vm.c" 3 4
+          1
+# 328 "src/vm.c"
+              ;
+}
+
+
+
+
+
+static 
+# 335 "src/vm.c" 3 4
+      _Bool 
+# 335 "src/vm.c"
+           _vm_update(uint64_t virt, uint64_t end, 
+# 335 "src/vm.c" 3 4
+                                                   _Bool 
+# 335 "src/vm.c"
+                                                        unmap, uint64_t attrs, struct VmFlush *pFlush)
+{
+    uint64_t parent = unmap ? 0 : attrs & 0x4;
+
+    while (virt < end) {
+        uint32_t level;
+        uint64_t *pEntry = _vm_find(virt, &level, parent);
+        uint64_t size = ((uint64_t)1 << (12 + 9 * ((level) - 1)));
+        uint64_t next = (virt & ~(size - 1)) + size;
+
+        if (pEntry && level > 1 && (virt & (size - 1) || end < next)) {
+            if (!_vm_split(pEntry, level, virt)) {
+                return 
+# 347 "src/vm.c" 3 4
+                      0
+# 347 "src/vm.c"
+                           ;
+            }
+            continue;
+        }
+
+        if (pEntry) {
+            if (unmap) {
+                *pEntry = 0;
+            } else {
+
+                *pEntry = (*pEntry & (0x000FFFFFFFFFF000 | 0x80)) | attrs;
+            }
+            _vm_flush_add(pFlush, virt);
+        }
+
+        if (next <= virt) {
+            break;
+        }
+        virt = next;
+    }
+
+    return 
+# 368 "src/vm.c" 3 4
+          1
+# 368 "src/vm.c"
+              ;
+}
+
+
+
+
+
+
+
+static 
+# 377 "src/vm.c" 3 4
+      _Bool 
+# 377 "src/vm.c"
+           _vm_prune(uint64_t *pTable, uint32_t level, uint64_t virt, uint64_t end, uint64_t **ppFree,
+    struct VmFlush *pFlush)
+{
+    if (level > 1) {
+        uint64_t size = ((uint64_t)1 << (12 + 9 * ((level) - 1)));
+
+        while (virt < end) {
+            uint64_t next = (virt & ~(size - 1)) + size;
+            uint64_t *pEntry = &pTable[(((virt) >> (12 + 9 * ((level) - 1))) & 0x1FF)];
+
+            if ((*pEntry & (0x1 | 0x80)) == 0x1) {
+                uint64_t *pChild = (uint64_t*)((void*)((uint64_t)(*pEntry & 0x000FFFFFFFFFF000) + vmm_higher_half_offset));
+                if (_vm_prune(pChild, level - 1, virt, next < virt ? end : ((next) < (end) ? (next) : (end)), ppFree, pFlush) &&
+                    (*pEntry & 0x200)) {
+                    *pEntry = 0;
+                    *pChild = (uint64_t)*ppFree;
+                    *ppFree = pChild;
+                    vm_table_pages--;
+
+
+                    _vm_flush_add(pFlush, virt);
+                }
+            }
+
+            if (next <= virt) {
+                break;
+            }
+            virt = next;
+        }
+    }
+
+    for (uint32_t i = 0; i < 512; i++) {
+        if (pTable[i]) {
+            return 
+# 410 "src/vm.c" 3 4
+                  0
+# 410 "src/vm.c"
+                       ;
+        }
+    }
+
+    return 
+# 414 "src/vm.c" 3 4
+          1
+# 414 "src/vm.c"
+              ;
+}
+
+
+static void _vm_free_tables(uint64_t *pFree)
+{
+    while (pFree) {
+        uint64_t *pNext = (uint64_t*)*pFree;
+        kfree(pFree);
+        pFree = pNext;
+    }
+}
+
+
+
+
+
+
+
+# 432 "src/vm.c" 3 4
+_Bool 
+# 432 "src/vm.c"
+    vm_map_range(uint64_t virt_addr, uint64_t phys_addr, uint64_t size, uint32_t flags)
+{
+    if (!pKernelPml4) {
+        kprintf("VMM: Mapping before vm_init().\n");
+        return 
+# 436 "src/vm.c" 3 4
+              0
+# 436 "src/vm.c"
+                   ;
+    }
+
+    if (((virt_addr) & 0xFFF) || ((phys_addr) & 0xFFF)) {
+        kprintf("VMM: Unaligned map of 0x%X to 0x%X.\n", virt_addr, phys_addr);
+        return 
+# 441 "src/vm.c" 3 4
+              0
+# 441 "src/vm.c"
+                   ;
+    }
+
+    size = (((size) + (4096) - 1) / (4096)) * (4096);
+    uint64_t end = virt_addr + size;
+    if (size == 0 || end <= virt_addr) {
+        return 
+# 447 "src/vm.c" 3 4
+              0
+# 447 "src/vm.c"
+                   ;
+    }
+
+    uint64_t attrs = _vm_attrs(flags);
+    uint64_t virt = virt_addr;
+
+    spinlock_lock(&vm_lock);
+
+    for (; virt < end; virt += 4096, phys_addr += 4096) {
+        if (!_vm_map_page(virt, phys_addr, attrs)) {
+            break;
+        }
+    }
+
+    uint64_t *pFree = 
+# 461 "src/vm.c" 3 4
+                     ((void *)0)
+# 461 "src/vm.c"
+                         ;
+    
+# 462 "src/vm.c" 3 4
+   _Bool 
+# 462 "src/vm.c"
+        mapped = virt == end;
+    if (!mapped) {
+
+        struct VmFlush flush = {0};
+        _vm_update(virt_addr, virt, 
+# 466 "src/vm.c" 3 4
+                                   1
+# 466 "src/vm.c"
+                                       , 0, &flush);
+        _vm_prune(pKernelPml4, 4, virt_addr, virt + 4096, &pFree, &flush);
+        _vm_flush(&flush);
+    }
+
+    spinlock_unlock(&vm_lock);
+
+    _vm_free_tables(pFree);
+
+    return mapped;
+}
+
+
+# 478 "src/vm.c" 3 4
+_Bool 
+# 478 "src/vm.c"
+    vm_map(uint64_t virt_addr, uint64_t phys_addr, uint32_t flags)
+{
+    return vm_map_range(virt_addr, phys_addr, 4096, flags);
+}
+
+
+
+
+
+void vm_unmap_range(uint64_t virt_addr, uint64_t size)
+{
+    if (!pKernelPml4) {
+        return;
+    }
+
+    uint64_t virt = (((virt_addr) / (4096)) * (4096));
+    uint64_t end = (((virt_addr + size) + (4096) - 1) / (4096)) * (4096);
+    if (end <= virt) {
+        return;
+    }
+
+    struct VmFlush flush = {0};
+    uint64_t *pFree = 
+# 500 "src/vm.c" 3 4
+                     ((void *)0)
+# 500 "src/vm.c"
+                         ;
+
+    spinlock_lock(&vm_lock);
+
+    if (!_vm_update(virt, end, 
+# 504 "src/vm.c" 3 4
+                              1
+# 504 "src/vm.c"
+                                  , 0, &flush)) {
+        kprintf("VMM: Unmap of 0x%X stopped early, a large page couldn't be split.\n", virt_addr);
+    }
+    _vm_prune(pKernelPml4, 4, virt, end, &pFree, &flush);
+
+
+    _vm_flush(&flush);
+
+    spinlock_unlock(&vm_lock);
+
+    _vm_free_tables(pFree);
+}
+
+void vm_unmap(uint64_t virt_addr)
+{
+    vm_unmap_range(virt_addr, 4096);
+}
+
+
+
+
+
+
+
+# 527 "src/vm.c" 3 4
+_Bool 
+# 527 "src/vm.c"
+    vm_protect_range(uint64_t virt_addr, uint64_t size, uint32_t flags)
+{
+    if (!pKernelPml4) {
+        return 
+# 530 "src/vm.c" 3 4
+              0
+# 530 "src/vm.c"
+                   ;
+    }
+
+    uint64_t virt = (((virt_addr) / (4096)) * (4096));
+    uint64_t end = (((virt_addr + size) + (4096) - 1) / (4096)) * (4096);
+    if (end <= virt) {
+        return 
+# 536 "src/vm.c" 3 4
+              0
+# 536 "src/vm.c"
+                   ;
+    }
+
+    struct VmFlush flush = {0};
+
+    spinlock_lock(&vm_lock);
+    
+# 542 "src/vm.c" 3 4
+   _Bool 
+# 542 "src/vm.c"
+        done = _vm_update(virt, end, 
+# 542 "src/vm.c" 3 4
+                                     0
+# 542 "src/vm.c"
+                                          , _vm_attrs(flags), &flush);
+    _vm_flush(&flush);
+    spinlock_unlock(&vm_lock);
+
+    return done;
+}
+
+
+# 549 "src/vm.c" 3 4
+_Bool 
+# 549 "src/vm.c"
+    vm_protect(uint64_t virt_addr, uint32_t flags)
+{
+    return vm_protect_range(virt_addr, 4096, flags);
+}
+
+void vm_report()
+{
+    kprintf("Kernel PML4: 0x%X\n", pKernelPml4 ? ((uint64_t)(pKernelPml4) - vmm_higher_half_offset) : 0);
+    kprintf("NX: %s\n", nx_enabled ? "enabled" : "disabled");
+    kprintf("Page tables allocated: %lu\n", vm_table_pages);
+    kprintf("Large pages split: %lu\n", vm_split_pages);
+    kprintf("Pages invalidated with invlpg: %lu\n", vm_invlpgs);
+    kprintf("Full TLB flushes: %lu\n", vm_full_flushes);
+}
+
+void vm_init()
+{
+    kprintf("Initializing virtual memory...\n");
+
+    if (is_paging_enabled()) {
+        kprintf("Paging enabled.\n");
+    } else {
+        kprintf("Paging disabled.\n");
+    }
+
+
+    uint64_t cr4 = get_cr4();
+
+    if (!(cr4 & 0x20)) {
+        kprintf("32-bit paging mode.\n");
+    }
+
+    if (cr4 & 0x20 && !(cr4 & 0x1000)) {
+        kprintf("4-level paging mode.\n");
+    }
+
+    if (cr4 & 0x20 && cr4 & 0x1000) {
+        kprintf("5-level paging mode.\n");
+    }
+
+
+    uint64_t val = cpu_get_address_widths();
+    maxphyaddr = val & 0xFF;
+    maxlinaddr = val >> 8 & 0xFF;
+    kprintf("MAXPHYADDR: %d bits\n", maxphyaddr);
+    kprintf("MAXLINADDR: %d bits\n", maxlinaddr);
+
+    walk_page_table(0);
+
+    if (cr4 & 0x1000) {
+        kprintf("VMM: 5-level paging isn't supported, staying on the bootloader's page tables.\n");
+        return;
+    }
+
+    nx_enabled = read_msr(0xC0000080) & 0x800;
+
+
+
+
+    uint64_t pml4 = _vm_alloc_table();
+    if (!pml4) {
+        kprintf("*FATAL*: No memory for the kernel PML4.\n");
+        hcf();
+    }
+
+    uint64_t *pBootPml4 = (uint64_t*)((void*)((uint64_t)(get_cr3() & 0x000FFFFFFFFFF000) + vmm_higher_half_offset));
+    pKernelPml4 = (uint64_t*)((void*)((uint64_t)(pml4) + vmm_higher_half_offset));
+    for (uint32_t i = 0; i < 512; i++) {
+        pKernelPml4[i] = pBootPml4[i];
+    }
+
+    set_cr3(pml4);
+    kprintf("VMM: Kernel PML4 at 0x%X, NX %s.\n", pml4, nx_enabled ? "enabled" : "disabled");
+}
@@ -0,0 +1,10523 @@
+	.file	"vm.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/vm.c"
+	.p2align 4
+	.type	_vm_flush, @function
+_vm_flush:
+.LVL0:
+.LFB35:
+	.file 1 "src/vm.c"
+	.loc 1 175 1 view -0
+	.cfi_startproc
+	.loc 1 176 5 view .LVU1
+	.loc 1 176 15 is_stmt 0 view .LVU2
+	movl	(%rdi), %eax
+	.loc 1 176 8 view .LVU3
+	testl	%eax, %eax
+	je	.L1
+	.loc 1 180 5 is_stmt 1 view .LVU4
+	.loc 1 180 8 is_stmt 0 view .LVU5
+	cmpl	$32, %eax
+	ja	.L13
+.LBB60:
+	.loc 1 190 23 view .LVU6
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L3:
+.LVL1:
+	.loc 1 191 13 is_stmt 1 discriminator 3 view .LVU7
+.LBB61:
+.LBI61:
+	.file 2 "src/include/cpu.h"
+	.loc 2 235 20 discriminator 3 view .LVU8
+.LBB62:
+	.loc 2 237 5 discriminator 3 view .LVU9
+.LBE62:
+.LBE61:
+	.loc 1 191 13 is_stmt 0 discriminator 3 view .LVU10
+	movl	%eax, %edx
+.LVL2:
+.LBB64:
+.LBB63:
+	.loc 2 237 5 discriminator 3 view .LVU11
+	movq	8(%rdi,%rdx,8), %rdx
+.LVL3:
+	.loc 2 237 5 discriminator 3 view .LVU12
+#APP
+# 237 "src/include/cpu.h" 1
+	invlpg (%rdx)
+# 0 "" 2
+.LVL4:
+	.loc 2 237 5 discriminator 3 view .LVU13
+#NO_APP
+.LBE63:
+.LBE64:
+	.loc 1 190 50 is_stmt 1 discriminator 3 view .LVU14
+	.loc 1 190 40 is_stmt 0 discriminator 3 view .LVU15
+	movl	(%rdi), %edx
+	.loc 1 190 50 discriminator 3 view .LVU16
+	addl	$1, %eax
+.LVL5:
+	.loc 1 190 32 is_stmt 1 discriminator 3 view .LVU17
+	cmpl	%edx, %eax
+	jb	.L3
+.LBE60:
+	.loc 1 193 9 view .LVU18
+	.loc 1 193 20 is_stmt 0 view .LVU19
+	addq	%rdx, vm_invlpgs(%rip)
+.LVL6:
+.L6:
+	.loc 1 196 5 is_stmt 1 view .LVU20
+	.loc 1 196 19 is_stmt 0 view .LVU21
+	movl	$0, (%rdi)
+.L1:
+	.loc 1 197 1 view .LVU22
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L13:
+.LBB65:
+	.loc 1 181 9 is_stmt 1 view .LVU23
+.LBB66:
+.LBI66:
+	.loc 2 217 24 view .LVU24
+.LBB67:
+	.loc 2 219 5 view .LVU25
+	.loc 2 220 5 view .LVU26
+#APP
+# 220 "src/include/cpu.h" 1
+	movq %cr4, %rax
+# 0 "" 2
+.LVL7:
+	.loc 2 221 5 view .LVU27
+	.loc 2 221 5 is_stmt 0 view .LVU28
+#NO_APP
+.LBE67:
+.LBE66:
+	.loc 1 182 9 is_stmt 1 view .LVU29
+	.loc 1 182 12 is_stmt 0 view .LVU30
+	testb	$-128, %al
+	jne	.L14
+	.loc 1 186 13 is_stmt 1 view .LVU31
+.LBB68:
+.LBI68:
+	.loc 2 210 24 view .LVU32
+.LBB69:
+	.loc 2 212 5 view .LVU33
+	.loc 2 213 5 view .LVU34
+#APP
+# 213 "src/include/cpu.h" 1
+	movq %cr3, %rax
+# 0 "" 2
+.LVL8:
+	.loc 2 214 5 view .LVU35
+	.loc 2 214 5 is_stmt 0 view .LVU36
+#NO_APP
+.LBE69:
+.LBE68:
+.LBB70:
+.LBI70:
+	.loc 2 224 20 is_stmt 1 view .LVU37
+.LBB71:
+	.loc 2 226 5 view .LVU38
+#APP
+# 226 "src/include/cpu.h" 1
+	movq %rax, %cr3
+# 0 "" 2
+.LVL9:
+#NO_APP
+.L5:
+	.loc 2 226 5 is_stmt 0 view .LVU39
+.LBE71:
+.LBE70:
+	.loc 1 188 9 is_stmt 1 view .LVU40
+	.loc 1 188 24 is_stmt 0 view .LVU41
+	addq	$1, vm_full_flushes(%rip)
+.LBE65:
+	jmp	.L6
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+.LBB78:
+	.loc 1 183 13 is_stmt 1 view .LVU42
+.LBB72:
+.LBI72:
+	.loc 2 229 20 view .LVU43
+.LBB73:
+	.loc 2 231 5 view .LVU44
+.LBE73:
+.LBE72:
+	.loc 1 183 13 is_stmt 0 view .LVU45
+	movq	%rax, %rdx
+	andb	$127, %dl
+.LBB75:
+.LBB74:
+	.loc 2 231 5 view .LVU46
+#APP
+# 231 "src/include/cpu.h" 1
+	movq %rdx, %cr4
+# 0 "" 2
+.LVL11:
+	.loc 2 231 5 view .LVU47
+#NO_APP
+.LBE74:
+.LBE75:
+	.loc 1 184 13 is_stmt 1 view .LVU48
+.LBB76:
+.LBI76:
+	.loc 2 229 20 view .LVU49
+.LBB77:
+	.loc 2 231 5 view .LVU50
+#APP
+# 231 "src/include/cpu.h" 1
+	movq %rax, %cr4
+# 0 "" 2
+	.loc 2 232 1 is_stmt 0 view .LVU51
+#NO_APP
+	jmp	.L5
+.LBE77:
+.LBE76:
+.LBE78:
+	.cfi_endproc
+.LFE35:
+	.size	_vm_flush, .-_vm_flush
+	.p2align 4
+	.type	_vm_attrs, @function
+_vm_attrs:
+.LVL12:
+.LFB36:
+	.loc 1 201 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 202 5 view .LVU53
+	.loc 1 204 5 view .LVU54
+	.loc 1 204 15 is_stmt 0 view .LVU55
+	movl	%edi, %eax
+	andl	$1, %eax
+	.loc 1 204 28 view .LVU56
+	cmpl	$1, %eax
+	sbbq	%rax, %rax
+	andq	$-2, %rax
+	addq	$3, %rax
+.LVL13:
+	.loc 1 205 5 is_stmt 1 view .LVU57
+	.loc 1 205 28 is_stmt 0 view .LVU58
+	movq	%rax, %rdx
+	orq	$4, %rdx
+	testb	$4, %dil
+	cmovne	%rdx, %rax
+.LVL14:
+	.loc 1 206 5 is_stmt 1 view .LVU59
+	.loc 1 206 28 is_stmt 0 view .LVU60
+	movq	%rax, %rdx
+	orq	$8, %rdx
+	testb	$8, %dil
+	cmovne	%rdx, %rax
+.LVL15:
+	.loc 1 207 5 is_stmt 1 view .LVU61
+	.loc 1 207 29 is_stmt 0 view .LVU62
+	movq	%rax, %rdx
+	orq	$16, %rdx
+	testb	$16, %dil
+	cmovne	%rdx, %rax
+.LVL16:
+	.loc 1 208 5 is_stmt 1 view .LVU63
+	.loc 1 208 29 is_stmt 0 view .LVU64
+	movq	%rax, %rdx
+	orb	$1, %dh
+	testb	$32, %dil
+	cmovne	%rdx, %rax
+.LVL17:
+	.loc 1 209 5 is_stmt 1 view .LVU65
+	.loc 1 209 8 is_stmt 0 view .LVU66
+	andl	$2, %edi
+.LVL18:
+	.loc 1 209 8 view .LVU67
+	jne	.L15
+	.loc 1 209 24 discriminator 1 view .LVU68
+	cmpb	$0, nx_enabled(%rip)
+	je	.L15
+	.loc 1 209 39 is_stmt 1 discriminator 2 view .LVU69
+	.loc 1 209 45 is_stmt 0 discriminator 2 view .LVU70
+	btsq	$63, %rax
+.LVL19:
+	.loc 1 211 5 is_stmt 1 discriminator 2 view .LVU71
+.L15:
+	.loc 1 212 1 is_stmt 0 view .LVU72
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	_vm_attrs, .-_vm_attrs
+	.p2align 4
+	.type	_vm_prune, @function
+_vm_prune:
+.LVL20:
+.LFB42:
+	.loc 1 379 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 380 5 view .LVU74
+	.loc 1 379 1 is_stmt 0 view .LVU75
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	.loc 1 380 8 view .LVU76
+	cmpl	$1, %esi
+	je	.L40
+.LBB79:
+	.loc 1 381 45 view .LVU77
+	leal	3(%rsi,%rsi,8), %r15d
+	movq	%rcx, %r13
+	.loc 1 381 9 is_stmt 1 view .LVU78
+	movq	%rdx, %r12
+	movl	%esi, 36(%rsp)
+	.loc 1 381 18 is_stmt 0 view .LVU79
+	movl	%r15d, %ecx
+.LVL21:
+	.loc 1 381 18 view .LVU80
+	movl	$1, %r14d
+	movl	%r15d, %ebx
+	movq	%rdi, %r10
+	salq	%cl, %r14
+.LVL22:
+	.loc 1 383 9 is_stmt 1 view .LVU81
+	movq	%r14, %r15
+	movq	%r13, %r14
+.LVL23:
+	.loc 1 383 21 view .LVU82
+	cmpq	%r14, %r12
+	jnb	.L52
+.LVL24:
+.L41:
+.LBB80:
+	.loc 1 384 13 view .LVU83
+	.loc 1 385 49 is_stmt 0 view .LVU84
+	movq	%r12, %rax
+	movl	%ebx, %ecx
+	.loc 1 384 37 view .LVU85
+	movq	%r15, %rbp
+	.loc 1 385 49 view .LVU86
+	shrq	%cl, %rax
+	.loc 1 384 37 view .LVU87
+	negq	%rbp
+	.loc 1 385 78 view .LVU88
+	andl	$511, %eax
+	.loc 1 384 35 view .LVU89
+	andq	%r12, %rbp
+	.loc 1 385 23 view .LVU90
+	leaq	(%r10,%rax,8), %r13
+	.loc 1 384 22 view .LVU91
+	addq	%r15, %rbp
+.LVL25:
+	.loc 1 385 13 is_stmt 1 view .LVU92
+	.loc 1 387 13 view .LVU93
+	.loc 1 387 18 is_stmt 0 view .LVU94
+	movq	0(%r13), %rax
+	.loc 1 387 26 view .LVU95
+	movq	%rax, %rdx
+	andl	$129, %edx
+	.loc 1 387 16 view .LVU96
+	cmpq	$1, %rdx
+	je	.L54
+.L36:
+	.loc 1 401 13 is_stmt 1 view .LVU97
+	.loc 1 401 16 is_stmt 0 view .LVU98
+	cmpq	%rbp, %r12
+	jnb	.L52
+	movq	%rbp, %r12
+.LVL26:
+	.loc 1 401 16 view .LVU99
+.LBE80:
+	.loc 1 383 21 is_stmt 1 view .LVU100
+	cmpq	%r14, %r12
+	jb	.L41
+.LVL27:
+.L52:
+	.loc 1 383 21 is_stmt 0 view .LVU101
+	movq	%r10, %rbx
+.LVL28:
+.L40:
+	.loc 1 383 21 view .LVU102
+	movq	%rbx, %rax
+	leaq	4096(%rbx), %rdx
+	jmp	.L33
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 383 21 view .LVU103
+.LBE79:
+.LBB87:
+	.loc 1 408 36 is_stmt 1 discriminator 2 view .LVU104
+	.loc 1 408 28 discriminator 2 view .LVU105
+	addq	$8, %rax
+.LVL30:
+	.loc 1 408 28 is_stmt 0 discriminator 2 view .LVU106
+	cmpq	%rax, %rdx
+	je	.L55
+.LVL31:
+.L33:
+	.loc 1 409 9 is_stmt 1 view .LVU107
+	.loc 1 409 12 is_stmt 0 view .LVU108
+	cmpq	$0, (%rax)
+	je	.L56
+.LBE87:
+	.loc 1 415 1 view .LVU109
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB88:
+	.loc 1 410 19 view .LVU110
+	xorl	%eax, %eax
+.LVL32:
+	.loc 1 410 19 view .LVU111
+.LBE88:
+	.loc 1 415 1 view .LVU112
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.cfi_restore_state
+.LBB89:
+.LBB86:
+.LBB81:
+	.loc 1 388 56 view .LVU113
+	movabsq	$4503599627366400, %rsi
+	.loc 1 389 21 view .LVU114
+	movq	%rbp, %rcx
+	movq	%r12, %rdx
+	movq	%r10, 24(%rsp)
+	.loc 1 388 17 is_stmt 1 view .LVU115
+	.loc 1 388 56 is_stmt 0 view .LVU116
+	andq	%rsi, %rax
+	.loc 1 388 97 view .LVU117
+	addq	vmm_higher_half_offset(%rip), %rax
+	.loc 1 389 21 view .LVU118
+	cmpq	%rbp, %r14
+	movq	%r9, 16(%rsp)
+	cmovbe	%r14, %rcx
+	.loc 1 388 97 view .LVU119
+	movq	%rax, %rdi
+.LVL34:
+	.loc 1 389 17 is_stmt 1 view .LVU120
+	.loc 1 389 21 is_stmt 0 view .LVU121
+	cmpq	%r12, %rbp
+	movl	36(%rsp), %eax
+.LVL35:
+	.loc 1 389 21 view .LVU122
+	movq	%r8, 8(%rsp)
+	cmovb	%r14, %rcx
+	leal	-1(%rax), %esi
+	movq	%rdi, 40(%rsp)
+	call	_vm_prune
+.LVL36:
+	.loc 1 389 20 view .LVU123
+	movq	8(%rsp), %r8
+	movq	16(%rsp), %r9
+	testb	%al, %al
+	movq	24(%rsp), %r10
+	je	.L36
+	.loc 1 389 127 discriminator 5 view .LVU124
+	testq	$512, 0(%r13)
+	je	.L36
+	.loc 1 391 21 is_stmt 1 view .LVU125
+	.loc 1 392 29 is_stmt 0 view .LVU126
+	movq	(%r8), %rax
+	movq	40(%rsp), %rdi
+	.loc 1 391 29 view .LVU127
+	movq	$0, 0(%r13)
+	.loc 1 392 21 is_stmt 1 view .LVU128
+	.loc 1 394 35 is_stmt 0 view .LVU129
+	subq	$1, vm_table_pages(%rip)
+	.loc 1 392 29 view .LVU130
+	movq	%rax, (%rdi)
+	.loc 1 393 21 is_stmt 1 view .LVU131
+.LBB82:
+.LBB83:
+	.loc 1 162 15 is_stmt 0 view .LVU132
+	movl	(%r9), %eax
+.LBE83:
+.LBE82:
+	.loc 1 393 29 view .LVU133
+	movq	%rdi, (%r8)
+	.loc 1 394 21 is_stmt 1 view .LVU134
+	.loc 1 397 21 view .LVU135
+.LVL37:
+.LBB85:
+.LBI82:
+	.loc 1 160 13 view .LVU136
+.LBB84:
+	.loc 1 162 5 view .LVU137
+	.loc 1 162 8 is_stmt 0 view .LVU138
+	cmpl	$31, %eax
+	ja	.L39
+	.loc 1 163 9 is_stmt 1 view .LVU139
+	.loc 1 163 38 is_stmt 0 view .LVU140
+	movl	%eax, %edx
+	movq	%r12, 8(%r9,%rdx,8)
+.L39:
+	.loc 1 166 5 is_stmt 1 view .LVU141
+	.loc 1 166 18 is_stmt 0 view .LVU142
+	addl	$1, %eax
+	movl	%eax, (%r9)
+	.loc 1 167 1 view .LVU143
+	jmp	.L36
+.LVL38:
+.L55:
+	.loc 1 167 1 view .LVU144
+.LBE84:
+.LBE85:
+.LBE81:
+.LBE86:
+.LBE89:
+	.loc 1 415 1 view .LVU145
+	addq	$56, %rsp
+	.cfi_def_cfa_offset 56
+	.loc 1 414 11 view .LVU146
+	movl	$1, %eax
+.LVL39:
+	.loc 1 415 1 view .LVU147
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	_vm_prune, .-_vm_prune
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"VMM: Out of memory for page tables.\n"
+	.text
+	.p2align 4
+	.type	_vm_update, @function
+_vm_update:
+.LVL40:
+.LFB41:
+	.loc 1 336 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 337 5 view .LVU149
+	.loc 1 336 1 is_stmt 0 view .LVU150
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 337 33 view .LVU151
+	xorl	%eax, %eax
+	.loc 1 336 1 view .LVU152
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 336 1 view .LVU153
+	movq	%rcx, 24(%rsp)
+	.loc 1 337 33 view .LVU154
+	andl	$4, %ecx
+.LVL41:
+	.loc 1 337 33 view .LVU155
+	testb	%dl, %dl
+	movq	%rcx, %r14
+	.loc 1 336 1 view .LVU156
+	movb	%dl, 3(%rsp)
+	.loc 1 337 33 view .LVU157
+	cmovne	%rax, %r14
+.LVL42:
+	.loc 1 339 5 is_stmt 1 view .LVU158
+	.loc 1 339 17 view .LVU159
+	cmpq	%rsi, %rdi
+	jnb	.L59
+.LBB104:
+.LBB105:
+.LBB106:
+.LBB107:
+.LBB108:
+	.loc 1 249 38 is_stmt 0 view .LVU160
+	movabsq	$4503599627366400, %r15
+.LBE108:
+.LBE107:
+.LBE106:
+.LBE105:
+	.loc 1 357 36 view .LVU161
+	movq	%r14, %r12
+	movq	%rsi, %r9
+	movq	%rdi, %r14
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 340 9 is_stmt 1 view .LVU162
+	.loc 1 341 9 view .LVU163
+.LBB115:
+.LBI105:
+	.loc 1 232 18 view .LVU164
+.LBB114:
+	.loc 1 234 5 view .LVU165
+	.loc 1 236 5 view .LVU166
+.LBB113:
+	.loc 1 236 10 view .LVU167
+.LBB109:
+	.loc 1 237 9 view .LVU168
+	.loc 1 237 74 is_stmt 0 view .LVU169
+	movq	%r14, %r13
+.LBE109:
+	.loc 1 236 19 view .LVU170
+	movl	$4, %r11d
+.LBB110:
+	.loc 1 237 52 view .LVU171
+	movl	$39, %ecx
+	.loc 1 237 74 view .LVU172
+	shrq	$36, %r13
+	.loc 1 237 35 view .LVU173
+	andl	$4088, %r13d
+	.loc 1 237 19 view .LVU174
+	addq	pKernelPml4(%rip), %r13
+.LVL44:
+	.loc 1 238 9 is_stmt 1 view .LVU175
+	.loc 1 240 9 view .LVU176
+	.loc 1 240 15 is_stmt 0 view .LVU177
+	movq	0(%r13), %rax
+	.loc 1 240 12 view .LVU178
+	testb	$1, %al
+	je	.L95
+.LVL45:
+.L60:
+	.loc 1 248 9 is_stmt 1 view .LVU179
+	movl	%ecx, %ebx
+	.loc 1 237 45 is_stmt 0 view .LVU180
+	movq	%r14, %rdx
+	.loc 1 237 52 view .LVU181
+	leal	-9(%rcx), %ecx
+	.loc 1 248 17 view .LVU182
+	orq	%r12, %rax
+	.loc 1 237 45 view .LVU183
+	shrq	%cl, %rdx
+	.loc 1 248 17 view .LVU184
+	movq	%rax, 0(%r13)
+	.loc 1 249 9 is_stmt 1 view .LVU185
+.LVL46:
+	.loc 1 249 9 is_stmt 0 view .LVU186
+.LBE110:
+	.loc 1 236 37 is_stmt 1 view .LVU187
+.LBB111:
+	.loc 1 249 38 is_stmt 0 view .LVU188
+	andq	%r15, %rax
+.LVL47:
+	.loc 1 249 38 view .LVU189
+.LBE111:
+	.loc 1 236 37 view .LVU190
+	subl	$1, %r11d
+.LVL48:
+	.loc 1 236 5 is_stmt 1 view .LVU191
+.LBB112:
+	.loc 1 237 9 view .LVU192
+	.loc 1 249 79 is_stmt 0 view .LVU193
+	addq	vmm_higher_half_offset(%rip), %rax
+	.loc 1 237 74 view .LVU194
+	andl	$511, %edx
+	.loc 1 237 19 view .LVU195
+	leaq	(%rax,%rdx,8), %r13
+.LVL49:
+	.loc 1 238 9 is_stmt 1 view .LVU196
+	.loc 1 240 9 view .LVU197
+	.loc 1 240 15 is_stmt 0 view .LVU198
+	movq	0(%r13), %rax
+	.loc 1 240 12 view .LVU199
+	testb	$1, %al
+	je	.L96
+	.loc 1 244 9 is_stmt 1 view .LVU200
+	.loc 1 244 12 is_stmt 0 view .LVU201
+	cmpl	$1, %r11d
+	je	.L62
+.LVL50:
+	.loc 1 244 39 view .LVU202
+	testb	$-128, %al
+	je	.L60
+.LVL51:
+	.loc 1 244 39 view .LVU203
+.LBE112:
+.LBE113:
+.LBE114:
+.LBE115:
+	.loc 1 342 9 is_stmt 1 view .LVU204
+	.loc 1 342 18 is_stmt 0 view .LVU205
+	movl	$1, %edx
+	salq	%cl, %rdx
+.LVL52:
+	.loc 1 343 9 is_stmt 1 view .LVU206
+	.loc 1 343 33 is_stmt 0 view .LVU207
+	movq	%rdx, %rbp
+	negq	%rbp
+	.loc 1 343 31 view .LVU208
+	movq	%rbp, %rax
+	andq	%r14, %rax
+	.loc 1 343 18 view .LVU209
+	addq	%rdx, %rax
+.LVL53:
+	.loc 1 345 9 is_stmt 1 view .LVU210
+	.loc 1 345 50 is_stmt 0 view .LVU211
+	subq	$1, %rdx
+.LVL54:
+	.loc 1 345 55 view .LVU212
+	testq	%r14, %rdx
+	jne	.L66
+	cmpq	%rax, %r9
+	jnb	.L67
+.L66:
+.LBB116:
+.LBB117:
+.LBB118:
+.LBB119:
+	.loc 1 217 20 view .LVU213
+	movl	$2, %esi
+	movl	$4096, %edi
+	movq	%r8, 16(%rsp)
+	movq	%r9, 8(%rsp)
+	movl	%r11d, 4(%rsp)
+.LBE119:
+.LBE118:
+.LBE117:
+.LBE116:
+	.loc 1 346 13 is_stmt 1 view .LVU214
+.LVL55:
+.LBB130:
+.LBI116:
+	.loc 1 257 12 view .LVU215
+.LBB127:
+	.loc 1 259 5 view .LVU216
+.LBB122:
+.LBI118:
+	.loc 1 215 17 view .LVU217
+.LBB120:
+	.loc 1 217 5 view .LVU218
+	.loc 1 217 20 is_stmt 0 view .LVU219
+	call	kalloc_zone@PLT
+.LVL56:
+	.loc 1 218 8 view .LVU220
+	movl	4(%rsp), %r11d
+	movq	8(%rsp), %r9
+	testq	%rax, %rax
+	movq	16(%rsp), %r8
+	.loc 1 217 20 view .LVU221
+	movq	%rax, %rsi
+.LVL57:
+	.loc 1 218 5 is_stmt 1 view .LVU222
+	.loc 1 218 8 is_stmt 0 view .LVU223
+	je	.L97
+	.loc 1 223 5 is_stmt 1 view .LVU224
+	.loc 1 223 19 is_stmt 0 view .LVU225
+	addq	$1, vm_table_pages(%rip)
+	.loc 1 224 5 is_stmt 1 view .LVU226
+.LVL58:
+	.loc 1 224 5 is_stmt 0 view .LVU227
+.LBE120:
+.LBE122:
+	.loc 1 260 5 is_stmt 1 view .LVU228
+	.loc 1 260 8 is_stmt 0 view .LVU229
+	movq	%rax, %r10
+	subq	vmm_higher_half_offset(%rip), %r10
+.LVL59:
+	.loc 1 260 8 view .LVU230
+	je	.L70
+	.loc 1 264 5 is_stmt 1 view .LVU231
+	.loc 1 264 14 is_stmt 0 view .LVU232
+	movq	0(%r13), %rdi
+.LVL60:
+	.loc 1 265 5 is_stmt 1 view .LVU233
+	.loc 1 266 5 view .LVU234
+	.loc 1 267 48 is_stmt 0 view .LVU235
+	movq	%rbp, %rdx
+	.loc 1 266 41 view .LVU236
+	leal	-18(%rbx), %ecx
+.LVL61:
+	.loc 1 267 5 is_stmt 1 view .LVU237
+	.loc 1 267 14 is_stmt 0 view .LVU238
+	movabsq	$4503599627366400, %rax
+.LVL62:
+	.loc 1 267 48 view .LVU239
+	andq	%rdi, %rdx
+	.loc 1 267 14 view .LVU240
+	andq	%rax, %rdx
+.LVL63:
+	.loc 1 268 5 is_stmt 1 view .LVU241
+	.loc 1 269 4 view .LVU242
+	.loc 1 269 21 is_stmt 0 view .LVU243
+	movq	%rdi, %rax
+	andl	$4096, %eax
+.LVL64:
+	.loc 1 271 5 is_stmt 1 view .LVU244
+	.loc 1 271 8 is_stmt 0 view .LVU245
+	cmpl	$2, %r11d
+	je	.L98
+	.loc 1 268 14 view .LVU246
+	movabsq	$-4503599627366401, %rbx
+	andq	%rdi, %rbx
+.LVL65:
+	.loc 1 275 12 is_stmt 1 view .LVU247
+	.loc 1 276 15 is_stmt 0 view .LVU248
+	movq	%rbx, %r11
+	orq	$4096, %r11
+	testq	%rax, %rax
+	cmovne	%r11, %rbx
+.LVL66:
+.L72:
+	.loc 1 279 5 is_stmt 1 view .LVU249
+.LBB123:
+	.loc 1 279 10 view .LVU250
+	.loc 1 279 28 view .LVU251
+	.loc 1 279 19 is_stmt 0 view .LVU252
+	xorl	%r11d, %r11d
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.loc 1 280 9 is_stmt 1 view .LVU253
+	.loc 1 280 31 is_stmt 0 view .LVU254
+	movq	%r11, %rax
+	salq	%cl, %rax
+	.loc 1 280 27 view .LVU255
+	addq	%rdx, %rax
+	.loc 1 280 39 view .LVU256
+	orq	%rbx, %rax
+	movq	%rax, (%rsi,%r11,8)
+	.loc 1 279 36 is_stmt 1 view .LVU257
+	addq	$1, %r11
+.LVL68:
+	.loc 1 279 28 view .LVU258
+	cmpq	$512, %r11
+	jne	.L73
+.LBE123:
+	.loc 1 284 5 view .LVU259
+	.loc 1 284 50 is_stmt 0 view .LVU260
+	andl	$4, %edi
+.LVL69:
+	.loc 1 285 19 view .LVU261
+	addq	$1, vm_split_pages(%rip)
+	.loc 1 284 41 view .LVU262
+	orq	%r10, %rdi
+	orq	$515, %rdi
+	movq	%rdi, 0(%r13)
+	.loc 1 285 5 is_stmt 1 view .LVU263
+	.loc 1 290 5 view .LVU264
+.LVL70:
+.LBB124:
+.LBI124:
+	.loc 2 235 20 view .LVU265
+.LBB125:
+	.loc 2 237 5 view .LVU266
+#APP
+# 237 "src/include/cpu.h" 1
+	invlpg (%r14)
+# 0 "" 2
+.LVL71:
+	.loc 2 237 5 is_stmt 0 view .LVU267
+#NO_APP
+.LBE125:
+.LBE124:
+	.loc 1 291 5 is_stmt 1 view .LVU268
+	.loc 1 291 15 is_stmt 0 view .LVU269
+	addq	$1, vm_invlpgs(%rip)
+	.loc 1 293 5 is_stmt 1 view .LVU270
+.LVL72:
+.L74:
+	.loc 1 293 5 is_stmt 0 view .LVU271
+.LBE127:
+.LBE130:
+.LBE104:
+	.loc 1 339 17 is_stmt 1 view .LVU272
+	cmpq	%r9, %r14
+	jb	.L78
+.LVL73:
+.L59:
+	.loc 1 369 1 is_stmt 0 view .LVU273
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 368 11 view .LVU274
+	movl	$1, %eax
+	.loc 1 369 1 view .LVU275
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.cfi_restore_state
+.LBB135:
+	.loc 1 342 9 is_stmt 1 view .LVU276
+	.loc 1 342 18 is_stmt 0 view .LVU277
+	movl	$1, %edx
+	salq	%cl, %rdx
+.LVL75:
+	.loc 1 343 9 is_stmt 1 view .LVU278
+	.loc 1 343 33 is_stmt 0 view .LVU279
+	movq	%rdx, %rax
+	negq	%rax
+	.loc 1 343 31 view .LVU280
+	andq	%r14, %rax
+	.loc 1 343 18 view .LVU281
+	addq	%rdx, %rax
+.LVL76:
+	.loc 1 345 9 is_stmt 1 view .LVU282
+.L67:
+	.loc 1 352 9 view .LVU283
+	.loc 1 353 13 view .LVU284
+	.loc 1 354 25 is_stmt 0 view .LVU285
+	xorl	%edx, %edx
+	.loc 1 353 16 view .LVU286
+	cmpb	$0, 3(%rsp)
+	jne	.L75
+	.loc 1 357 17 is_stmt 1 view .LVU287
+	.loc 1 357 36 is_stmt 0 view .LVU288
+	movabsq	$4503599627366528, %rdx
+	.loc 1 357 67 view .LVU289
+	movq	24(%rsp), %rdi
+	.loc 1 357 36 view .LVU290
+	andq	0(%r13), %rdx
+	.loc 1 357 67 view .LVU291
+	orq	%rdi, %rdx
+.L75:
+	.loc 1 357 67 view .LVU292
+	movq	%rdx, 0(%r13)
+	.loc 1 359 13 is_stmt 1 view .LVU293
+.LVL77:
+.LBB131:
+.LBI131:
+	.loc 1 160 13 view .LVU294
+.LBB132:
+	.loc 1 162 5 view .LVU295
+	.loc 1 162 15 is_stmt 0 view .LVU296
+	movl	(%r8), %edx
+	.loc 1 162 8 view .LVU297
+	cmpl	$31, %edx
+	ja	.L76
+	.loc 1 163 9 is_stmt 1 view .LVU298
+	.loc 1 163 38 is_stmt 0 view .LVU299
+	movl	%edx, %ecx
+	movq	%r14, 8(%r8,%rcx,8)
+.L76:
+	.loc 1 166 5 is_stmt 1 view .LVU300
+	.loc 1 166 18 is_stmt 0 view .LVU301
+	addl	$1, %edx
+	movl	%edx, (%r8)
+.LVL78:
+.L61:
+	.loc 1 166 18 view .LVU302
+.LBE132:
+.LBE131:
+	.loc 1 362 9 is_stmt 1 view .LVU303
+	.loc 1 362 12 is_stmt 0 view .LVU304
+	cmpq	%rax, %r14
+	jnb	.L59
+	.loc 1 362 12 view .LVU305
+	movq	%rax, %r14
+.LVL79:
+	.loc 1 362 12 view .LVU306
+	jmp	.L74
+.LVL80:
+.L96:
+	.loc 1 342 9 is_stmt 1 view .LVU307
+	.loc 1 342 18 is_stmt 0 view .LVU308
+	movl	$1, %edx
+	salq	%cl, %rdx
+.LVL81:
+	.loc 1 343 9 is_stmt 1 view .LVU309
+	.loc 1 343 33 is_stmt 0 view .LVU310
+	movq	%rdx, %rax
+	negq	%rax
+	.loc 1 343 31 view .LVU311
+	andq	%r14, %rax
+	.loc 1 343 18 view .LVU312
+	addq	%rdx, %rax
+.LVL82:
+	.loc 1 345 9 is_stmt 1 view .LVU313
+	jmp	.L61
+.LVL83:
+.L98:
+.LBB133:
+.LBB128:
+	.loc 1 273 9 view .LVU314
+	.loc 1 273 15 is_stmt 0 view .LVU315
+	movabsq	$-4503599627366529, %rbx
+	andq	%rdi, %rbx
+.LVL84:
+	.loc 1 274 9 is_stmt 1 view .LVU316
+	.loc 1 274 24 is_stmt 0 view .LVU317
+	movq	%rbx, %r11
+	orb	$-128, %r11b
+	testq	%rax, %rax
+	cmovne	%r11, %rbx
+.LVL85:
+	.loc 1 274 24 view .LVU318
+	jmp	.L72
+.LVL86:
+.L95:
+	.loc 1 274 24 view .LVU319
+.LBE128:
+.LBE133:
+	.loc 1 342 9 is_stmt 1 view .LVU320
+	.loc 1 343 9 view .LVU321
+	.loc 1 343 31 is_stmt 0 view .LVU322
+	movabsq	$-549755813888, %rax
+	.loc 1 343 18 view .LVU323
+	movabsq	$549755813888, %rdx
+	.loc 1 343 31 view .LVU324
+	andq	%r14, %rax
+	.loc 1 343 18 view .LVU325
+	addq	%rdx, %rax
+.LVL87:
+	.loc 1 345 9 is_stmt 1 view .LVU326
+	jmp	.L61
+.LVL88:
+.L97:
+.LBB134:
+.LBB129:
+.LBB126:
+.LBB121:
+	.loc 1 219 9 view .LVU327
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+.LVL89:
+	.loc 1 219 9 is_stmt 0 view .LVU328
+	call	kprintf@PLT
+.LVL90:
+	.loc 1 220 9 is_stmt 1 view .LVU329
+	.loc 1 220 9 is_stmt 0 view .LVU330
+.LBE121:
+.LBE126:
+	.loc 1 260 5 is_stmt 1 view .LVU331
+.L70:
+	.loc 1 260 5 is_stmt 0 view .LVU332
+.LBE129:
+.LBE134:
+.LBE135:
+	.loc 1 369 1 view .LVU333
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 56
+.LBB136:
+	.loc 1 347 23 view .LVU334
+	xorl	%eax, %eax
+.LBE136:
+	.loc 1 369 1 view .LVU335
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+.LVL91:
+	.loc 1 369 1 view .LVU336
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+.LVL92:
+	.loc 1 369 1 view .LVU337
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+.LVL93:
+	.loc 1 369 1 view .LVU338
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+.LVL94:
+	.loc 1 369 1 view .LVU339
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	_vm_update, .-_vm_update
+	.p2align 4
+	.globl	walk_page_table
+	.type	walk_page_table, @function
+walk_page_table:
+.LVL95:
+.LFB33:
+	.loc 1 87 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 96 5 view .LVU341
+.LBB137:
+.LBI137:
+	.loc 2 210 24 view .LVU342
+.LBB138:
+	.loc 2 212 5 view .LVU343
+	.loc 2 213 5 view .LVU344
+.LBE138:
+.LBE137:
+	.loc 1 87 1 is_stmt 0 view .LVU345
+	movq	%rdi, %rsi
+.LBB140:
+.LBB139:
+	.loc 2 213 5 view .LVU346
+#APP
+# 213 "src/include/cpu.h" 1
+	movq %cr3, %rax
+# 0 "" 2
+.LVL96:
+	.loc 2 214 5 is_stmt 1 view .LVU347
+	.loc 2 214 5 is_stmt 0 view .LVU348
+#NO_APP
+.LBE139:
+.LBE140:
+	.loc 1 102 5 is_stmt 1 view .LVU349
+	.loc 1 102 39 is_stmt 0 view .LVU350
+	movl	maxphyaddr(%rip), %ecx
+	movl	$1, %edx
+	.loc 1 104 63 view .LVU351
+	movq	vmm_higher_half_offset(%rip), %rdi
+.LVL97:
+	.loc 1 102 39 view .LVU352
+	salq	%cl, %rdx
+	.loc 1 102 54 view .LVU353
+	subq	$1, %rdx
+	.loc 1 102 14 view .LVU354
+	salq	$12, %rdx
+.LVL98:
+	.loc 1 103 5 is_stmt 1 view .LVU355
+	.loc 1 104 5 view .LVU356
+	.loc 1 108 5 view .LVU357
+	.loc 1 103 14 is_stmt 0 view .LVU358
+	andq	%rdx, %rax
+.LVL99:
+	.loc 1 103 14 view .LVU359
+	movq	%rax, %rcx
+	.loc 1 108 48 view .LVU360
+	movq	%rsi, %rax
+.LVL100:
+	.loc 1 108 48 view .LVU361
+	shrq	$36, %rax
+	.loc 1 108 14 view .LVU362
+	andl	$4088, %eax
+	addq	%rdi, %rax
+	movq	(%rax,%rcx), %rcx
+.LVL101:
+	.loc 1 109 5 is_stmt 1 view .LVU363
+	.loc 1 109 8 is_stmt 0 view .LVU364
+	movq	%rcx, %rax
+	andl	$1, %eax
+	je	.L99
+	.loc 1 116 5 is_stmt 1 view .LVU365
+.LVL102:
+	.loc 1 119 5 view .LVU366
+	.loc 1 119 48 is_stmt 0 view .LVU367
+	movq	%rsi, %rax
+	.loc 1 116 59 view .LVU368
+	andq	%rdx, %rcx
+.LVL103:
+	.loc 1 119 48 view .LVU369
+	shrq	$27, %rax
+	.loc 1 119 14 view .LVU370
+	andl	$4088, %eax
+	addq	%rdi, %rax
+	movq	(%rax,%rcx), %rcx
+.LVL104:
+	.loc 1 120 5 is_stmt 1 view .LVU371
+	.loc 1 120 8 is_stmt 0 view .LVU372
+	movq	%rcx, %rax
+	andl	$1, %eax
+	je	.L99
+	.loc 1 125 5 is_stmt 1 view .LVU373
+	.loc 1 126 23 is_stmt 0 view .LVU374
+	movq	%rdx, %rax
+	andq	%rcx, %rax
+	.loc 1 125 8 view .LVU375
+	andl	$128, %ecx
+.LVL105:
+	.loc 1 125 8 view .LVU376
+	jne	.L115
+	.loc 1 130 5 is_stmt 1 view .LVU377
+.LVL106:
+	.loc 1 133 5 view .LVU378
+	.loc 1 133 44 is_stmt 0 view .LVU379
+	movq	%rsi, %rcx
+	shrq	$18, %rcx
+	.loc 1 133 14 view .LVU380
+	andl	$4088, %ecx
+	addq	%rdi, %rcx
+	movq	(%rcx,%rax), %rcx
+.LVL107:
+	.loc 1 134 5 is_stmt 1 view .LVU381
+	.loc 1 134 8 is_stmt 0 view .LVU382
+	movq	%rcx, %rax
+.LVL108:
+	.loc 1 134 8 view .LVU383
+	andl	$1, %eax
+	je	.L99
+	.loc 1 139 5 is_stmt 1 view .LVU384
+	.loc 1 140 21 is_stmt 0 view .LVU385
+	movq	%rdx, %rax
+	andq	%rcx, %rax
+	.loc 1 139 8 view .LVU386
+	andl	$128, %ecx
+.LVL109:
+	.loc 1 139 8 view .LVU387
+	jne	.L116
+	.loc 1 144 5 is_stmt 1 view .LVU388
+.LVL110:
+	.loc 1 147 5 view .LVU389
+	.loc 1 147 44 is_stmt 0 view .LVU390
+	movq	%rsi, %rcx
+	shrq	$9, %rcx
+	.loc 1 147 14 view .LVU391
+	andl	$4088, %ecx
+	addq	%rdi, %rcx
+	movq	(%rcx,%rax), %rcx
+.LVL111:
+	.loc 1 149 5 is_stmt 1 view .LVU392
+	.loc 1 149 8 is_stmt 0 view .LVU393
+	movq	%rcx, %rax
+.LVL112:
+	.loc 1 149 8 view .LVU394
+	andl	$1, %eax
+	je	.L99
+	.loc 1 156 5 is_stmt 1 view .LVU395
+	.loc 1 156 31 is_stmt 0 view .LVU396
+	andq	%rcx, %rdx
+.LVL113:
+	.loc 1 156 58 view .LVU397
+	andl	$4095, %esi
+.LVL114:
+	.loc 1 156 14 view .LVU398
+	movq	%rdx, %rax
+	orq	%rsi, %rax
+.LVL115:
+	.loc 1 157 5 is_stmt 1 view .LVU399
+.L99:
+	.loc 1 158 1 is_stmt 0 view .LVU400
+	ret
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.loc 1 126 9 is_stmt 1 view .LVU401
+	.loc 1 126 34 is_stmt 0 view .LVU402
+	andq	$-1073741824, %rax
+	.loc 1 126 95 view .LVU403
+	andl	$1073741823, %esi
+.LVL117:
+	.loc 1 126 82 view .LVU404
+	orq	%rsi, %rax
+	ret
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.loc 1 140 9 is_stmt 1 view .LVU405
+	.loc 1 140 32 is_stmt 0 view .LVU406
+	andq	$-2097152, %rax
+	.loc 1 140 93 view .LVU407
+	andl	$2097151, %esi
+.LVL119:
+	.loc 1 140 80 view .LVU408
+	orq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	walk_page_table, .-walk_page_table
+	.section	.rodata.str1.8
+	.align 8
+.LC1:
+	.string	"VMM: Mapping before vm_init().\n"
+	.align 8
+.LC2:
+	.string	"VMM: Unaligned map of 0x%X to 0x%X.\n"
+	.align 8
+.LC3:
+	.string	"VMM: 0x%X is already mapped by a large page.\n"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC4:
+	.string	"VMM: 0x%X is already mapped.\n"
+	.text
+	.p2align 4
+	.globl	vm_map_range
+	.type	vm_map_range, @function
+vm_map_range:
+.LVL120:
+.LFB44:
+	.loc 1 433 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 434 5 view .LVU410
+	.loc 1 433 1 is_stmt 0 view .LVU411
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	.loc 1 434 8 view .LVU412
+	cmpq	$0, pKernelPml4(%rip)
+	je	.L147
+	.loc 1 439 31 view .LVU413
+	movq	%rdi, %rax
+	movq	%rdi, %r15
+	movq	%rsi, %r8
+	.loc 1 439 5 is_stmt 1 view .LVU414
+	.loc 1 439 31 is_stmt 0 view .LVU415
+	orq	%rsi, %rax
+	testl	$4095, %eax
+	jne	.L148
+	.loc 1 444 5 is_stmt 1 view .LVU416
+	.loc 1 444 30 is_stmt 0 view .LVU417
+	addq	$4095, %rdx
+.LVL121:
+	.loc 1 444 10 view .LVU418
+	andq	$-4096, %rdx
+.LVL122:
+	.loc 1 445 5 is_stmt 1 view .LVU419
+	.loc 1 445 14 is_stmt 0 view .LVU420
+	leaq	(%rdi,%rdx), %rax
+	movq	%rax, 16(%rsp)
+.LVL123:
+	.loc 1 446 5 is_stmt 1 view .LVU421
+	.loc 1 446 8 is_stmt 0 view .LVU422
+	je	.L119
+	cmpq	%rax, %rdi
+	jnb	.L119
+	.loc 1 450 5 is_stmt 1 view .LVU423
+	.loc 1 450 22 is_stmt 0 view .LVU424
+	movl	%ecx, %edi
+.LVL124:
+	.loc 1 450 22 view .LVU425
+	call	_vm_attrs
+.LVL125:
+.LBB156:
+.LBB157:
+	.file 3 "src/include/atomic.h"
+	.loc 3 29 12 view .LVU426
+	movl	$1, %edx
+.LBE157:
+.LBE156:
+	.loc 1 450 22 view .LVU427
+	movq	%rax, 24(%rsp)
+.LVL126:
+	.loc 1 451 5 is_stmt 1 view .LVU428
+	.loc 1 453 5 view .LVU429
+.LBB159:
+.LBI156:
+	.loc 3 27 20 view .LVU430
+	.p2align 4,,10
+	.p2align 3
+.L121:
+.LBB158:
+	.loc 3 31 5 view .LVU431
+	.loc 3 29 12 view .LVU432
+	movl	%edx, %eax
+	xchgb	vm_lock(%rip), %al
+	testb	%al, %al
+	jne	.L121
+.LVL127:
+	.loc 3 29 12 is_stmt 0 view .LVU433
+.LBE158:
+.LBE159:
+	.loc 1 455 17 is_stmt 1 view .LVU434
+.LBB160:
+.LBB161:
+	.loc 1 299 14 is_stmt 0 view .LVU435
+	movq	24(%rsp), %r12
+	movq	%r15, %r14
+.LBB162:
+.LBB163:
+	.loc 1 317 38 view .LVU436
+	movabsq	$4503599627366400, %r13
+.LBE163:
+.LBE162:
+	.loc 1 299 14 view .LVU437
+	andl	$4, %r12d
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	.loc 1 299 14 view .LVU438
+	movq	%r8, %rbp
+	.loc 1 298 15 view .LVU439
+	movq	pKernelPml4(%rip), %rax
+.LBB179:
+	.loc 1 301 19 view .LVU440
+	movl	$4, %ebx
+	subq	%r15, %rbp
+	addq	%r14, %rbp
+.LVL129:
+	.loc 1 301 19 view .LVU441
+.LBE179:
+.LBE161:
+.LBE160:
+	.loc 1 456 9 is_stmt 1 view .LVU442
+.LBB187:
+.LBI160:
+	.loc 1 296 12 view .LVU443
+.LBB183:
+	.loc 1 298 5 view .LVU444
+	.loc 1 299 5 view .LVU445
+	.loc 1 301 5 view .LVU446
+.LBB180:
+	.loc 1 301 10 view .LVU447
+	.loc 1 301 36 view .LVU448
+.L130:
+.LBB174:
+	.loc 1 302 9 view .LVU449
+	.loc 1 302 52 is_stmt 0 view .LVU450
+	leal	3(%rbx,%rbx,8), %ecx
+	.loc 1 302 45 view .LVU451
+	movq	%r14, %rsi
+	shrq	%cl, %rsi
+	movq	%rsi, %rcx
+	.loc 1 302 74 view .LVU452
+	andl	$511, %ecx
+	.loc 1 302 19 view .LVU453
+	leaq	(%rax,%rcx,8), %rcx
+.LVL130:
+	.loc 1 304 9 is_stmt 1 view .LVU454
+	.loc 1 304 15 is_stmt 0 view .LVU455
+	movq	(%rcx), %rax
+.LVL131:
+	.loc 1 304 12 view .LVU456
+	testb	$1, %al
+	je	.L149
+	.loc 1 310 16 is_stmt 1 view .LVU457
+	.loc 1 310 19 is_stmt 0 view .LVU458
+	cmpl	$4, %ebx
+	je	.L126
+	.loc 1 310 31 view .LVU459
+	testb	$-128, %al
+	jne	.L150
+	.loc 1 314 13 is_stmt 1 view .LVU460
+	.loc 1 314 21 is_stmt 0 view .LVU461
+	orq	%r12, %rax
+.LVL132:
+.L125:
+	.loc 1 314 21 view .LVU462
+.LBE174:
+	.loc 1 301 46 view .LVU463
+	subl	$1, %ebx
+.LVL133:
+.LBB175:
+.LBB164:
+	.loc 1 309 21 view .LVU464
+	movq	%rax, (%rcx)
+.LBE164:
+	.loc 1 317 9 is_stmt 1 view .LVU465
+	.loc 1 317 38 is_stmt 0 view .LVU466
+	andq	%r13, %rax
+	.loc 1 317 79 view .LVU467
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL134:
+	.loc 1 317 79 view .LVU468
+.LBE175:
+	.loc 1 301 46 is_stmt 1 view .LVU469
+	.loc 1 301 36 view .LVU470
+	cmpl	$1, %ebx
+	jne	.L130
+.LBE180:
+	.loc 1 320 5 view .LVU471
+	.loc 1 320 46 is_stmt 0 view .LVU472
+	movq	%r14, %rcx
+	shrq	$9, %rcx
+	.loc 1 320 29 view .LVU473
+	andl	$4088, %ecx
+	.loc 1 320 15 view .LVU474
+	addq	%rcx, %rax
+.LVL135:
+	.loc 1 321 5 is_stmt 1 view .LVU475
+	.loc 1 321 8 is_stmt 0 view .LVU476
+	testb	$1, (%rax)
+	jne	.L151
+	.loc 1 327 5 is_stmt 1 view .LVU477
+	.loc 1 327 18 is_stmt 0 view .LVU478
+	movq	24(%rsp), %rdx
+.LBE183:
+.LBE187:
+	.loc 1 455 29 view .LVU479
+	addq	$4096, %r14
+.LVL136:
+.LBB188:
+.LBB184:
+	.loc 1 327 18 view .LVU480
+	orq	%rdx, %rbp
+.LVL137:
+	.loc 1 327 18 view .LVU481
+	movq	%rbp, (%rax)
+	.loc 1 328 5 is_stmt 1 view .LVU482
+.LVL138:
+	.loc 1 328 5 is_stmt 0 view .LVU483
+.LBE184:
+.LBE188:
+	.loc 1 455 36 is_stmt 1 view .LVU484
+	.loc 1 455 17 view .LVU485
+	movq	16(%rsp), %rax
+	cmpq	%rax, %r14
+	jb	.L132
+.LVL139:
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	.loc 1 461 5 view .LVU486
+	.loc 1 461 15 is_stmt 0 view .LVU487
+	movq	$0, 32(%rsp)
+	.loc 1 462 4 is_stmt 1 view .LVU488
+	.loc 1 462 9 is_stmt 0 view .LVU489
+	cmpq	%r14, 16(%rsp)
+	sete	%bpl
+.LVL140:
+	.loc 1 463 5 is_stmt 1 view .LVU490
+	.loc 1 463 8 is_stmt 0 view .LVU491
+	jne	.L152
+.L133:
+	.loc 1 471 5 is_stmt 1 view .LVU492
+.LVL141:
+.LBB189:
+.LBI189:
+	.loc 3 34 20 view .LVU493
+.LBB190:
+	.loc 3 36 5 view .LVU494
+	movb	$0, vm_lock(%rip)
+.LVL142:
+	.loc 3 36 5 is_stmt 0 view .LVU495
+.LBE190:
+.LBE189:
+	.loc 1 473 5 is_stmt 1 view .LVU496
+	movq	32(%rsp), %rbx
+.LVL143:
+.LBB191:
+.LBI191:
+	.loc 1 418 13 view .LVU497
+.LBB192:
+	.loc 1 420 12 view .LVU498
+	testq	%rbx, %rbx
+	je	.L117
+	.p2align 4,,10
+	.p2align 3
+.L135:
+.LBB193:
+	.loc 1 421 9 view .LVU499
+	movq	%rbx, %rdi
+	.loc 1 421 19 is_stmt 0 view .LVU500
+	movq	(%rbx), %rbx
+.LVL144:
+	.loc 1 422 9 is_stmt 1 view .LVU501
+	call	kfree@PLT
+.LVL145:
+	.loc 1 423 9 view .LVU502
+	.loc 1 423 9 is_stmt 0 view .LVU503
+.LBE193:
+	.loc 1 420 12 is_stmt 1 view .LVU504
+	testq	%rbx, %rbx
+	jne	.L135
+	jmp	.L117
+.LVL146:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.loc 1 420 12 is_stmt 0 view .LVU505
+.LBE192:
+.LBE191:
+	.loc 1 440 9 is_stmt 1 view .LVU506
+	movq	%rsi, %rdx
+.LVL147:
+	.loc 1 440 9 is_stmt 0 view .LVU507
+	xorl	%eax, %eax
+	movq	%rdi, %rsi
+.LVL148:
+	.loc 1 440 9 view .LVU508
+	leaq	.LC2(%rip), %rdi
+.LVL149:
+	.loc 1 440 9 view .LVU509
+	call	kprintf@PLT
+.LVL150:
+	.loc 1 441 9 is_stmt 1 view .LVU510
+.L119:
+	.loc 1 436 15 is_stmt 0 view .LVU511
+	xorl	%ebp, %ebp
+.LVL151:
+.L117:
+	.loc 1 476 1 view .LVU512
+	addq	$312, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_restore 14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_restore 15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	.cfi_restore_state
+.LBB194:
+.LBB185:
+.LBB181:
+.LBB176:
+.LBB171:
+.LBB165:
+.LBB166:
+	.loc 1 217 20 view .LVU513
+	movl	$2, %esi
+	movl	$4096, %edi
+	movq	%r8, 8(%rsp)
+	movq	%rcx, (%rsp)
+.LBE166:
+.LBE165:
+	.loc 1 305 13 is_stmt 1 view .LVU514
+.LBB169:
+.LBI165:
+	.loc 1 215 17 view .LVU515
+.LBB167:
+	.loc 1 217 5 view .LVU516
+	.loc 1 217 20 is_stmt 0 view .LVU517
+	call	kalloc_zone@PLT
+.LVL153:
+	.loc 1 218 5 is_stmt 1 view .LVU518
+	.loc 1 218 8 is_stmt 0 view .LVU519
+	movq	(%rsp), %rcx
+	movq	8(%rsp), %r8
+	testq	%rax, %rax
+	je	.L153
+	.loc 1 223 5 is_stmt 1 view .LVU520
+	.loc 1 223 19 is_stmt 0 view .LVU521
+	addq	$1, vm_table_pages(%rip)
+	.loc 1 224 5 is_stmt 1 view .LVU522
+.LVL154:
+	.loc 1 224 5 is_stmt 0 view .LVU523
+.LBE167:
+.LBE169:
+	.loc 1 306 13 is_stmt 1 view .LVU524
+	.loc 1 306 16 is_stmt 0 view .LVU525
+	subq	vmm_higher_half_offset(%rip), %rax
+.LVL155:
+	.loc 1 306 16 view .LVU526
+	je	.L124
+	.loc 1 309 13 is_stmt 1 view .LVU527
+	.loc 1 309 49 is_stmt 0 view .LVU528
+	orq	%r12, %rax
+.LVL156:
+	.loc 1 309 49 view .LVU529
+	orq	$515, %rax
+.LBE171:
+	jmp	.L125
+.LVL157:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.loc 1 314 13 is_stmt 1 view .LVU530
+	.loc 1 314 21 is_stmt 0 view .LVU531
+	orq	%r12, %rax
+.LBE176:
+	.loc 1 301 46 view .LVU532
+	movl	$3, %ebx
+.LVL158:
+.LBB177:
+.LBB172:
+	.loc 1 309 21 view .LVU533
+	movq	%rax, (%rcx)
+.LBE172:
+	.loc 1 317 9 is_stmt 1 view .LVU534
+	.loc 1 317 38 is_stmt 0 view .LVU535
+	andq	%r13, %rax
+	.loc 1 317 79 view .LVU536
+	addq	vmm_higher_half_offset(%rip), %rax
+.LVL159:
+	.loc 1 317 79 view .LVU537
+.LBE177:
+	.loc 1 301 46 is_stmt 1 view .LVU538
+	.loc 1 301 36 view .LVU539
+	jmp	.L130
+.LVL160:
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.loc 1 301 36 is_stmt 0 view .LVU540
+.LBE181:
+	.loc 1 322 9 is_stmt 1 view .LVU541
+	movq	%r14, %rsi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+.LVL161:
+	.loc 1 322 9 is_stmt 0 view .LVU542
+	call	kprintf@PLT
+.LVL162:
+	.loc 1 323 9 is_stmt 1 view .LVU543
+	.loc 1 323 9 is_stmt 0 view .LVU544
+	jmp	.L124
+.LVL163:
+	.p2align 4,,10
+	.p2align 3
+.L152:
+	.loc 1 323 9 view .LVU545
+.LBE185:
+.LBE194:
+.LBB195:
+	.loc 1 465 9 is_stmt 1 view .LVU546
+	.loc 1 465 24 is_stmt 0 view .LVU547
+	xorl	%eax, %eax
+	leaq	40(%rsp), %rdi
+	movl	$33, %ecx
+	.loc 1 466 9 view .LVU548
+	movq	%r14, %rsi
+	.loc 1 465 24 view .LVU549
+	rep stosq
+	.loc 1 466 9 is_stmt 1 view .LVU550
+	leaq	40(%rsp), %rbx
+	movq	%r15, %rdi
+	movl	$1, %edx
+	movq	%rbx, %r8
+	call	_vm_update
+.LVL164:
+	.loc 1 467 9 view .LVU551
+	movq	%rbx, %r9
+	leaq	32(%rsp), %r8
+	movq	%r15, %rdx
+	movq	pKernelPml4(%rip), %rdi
+	leaq	4096(%r14), %rcx
+	movl	$4, %esi
+	call	_vm_prune
+.LVL165:
+	.loc 1 468 9 view .LVU552
+	movq	%rbx, %rdi
+	call	_vm_flush
+.LVL166:
+	jmp	.L133
+.LVL167:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	.loc 1 468 9 is_stmt 0 view .LVU553
+.LBE195:
+.LBB196:
+.LBB186:
+.LBB182:
+.LBB178:
+.LBB173:
+.LBB170:
+.LBB168:
+	.loc 1 219 9 is_stmt 1 view .LVU554
+	leaq	.LC0(%rip), %rdi
+	call	kprintf@PLT
+.LVL168:
+	.loc 1 220 9 view .LVU555
+	.loc 1 220 9 is_stmt 0 view .LVU556
+.LBE168:
+.LBE170:
+	.loc 1 306 13 is_stmt 1 view .LVU557
+	jmp	.L124
+.LVL169:
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.loc 1 306 13 is_stmt 0 view .LVU558
+.LBE173:
+	.loc 1 311 13 is_stmt 1 view .LVU559
+	movq	%r14, %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL170:
+	.loc 1 312 13 view .LVU560
+	.loc 1 312 13 is_stmt 0 view .LVU561
+	jmp	.L124
+.LVL171:
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	.loc 1 312 13 view .LVU562
+.LBE178:
+.LBE182:
+.LBE186:
+.LBE196:
+	.loc 1 435 9 is_stmt 1 view .LVU563
+	leaq	.LC1(%rip), %rdi
+.LVL172:
+	.loc 1 435 9 is_stmt 0 view .LVU564
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL173:
+	.loc 1 436 9 is_stmt 1 view .LVU565
+	.loc 1 436 15 is_stmt 0 view .LVU566
+	jmp	.L119
+	.cfi_endproc
+.LFE44:
+	.size	vm_map_range, .-vm_map_range
+	.p2align 4
+	.globl	vm_map
+	.type	vm_map, @function
+vm_map:
+.LVL174:
+.LFB45:
+	.loc 1 479 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 480 5 view .LVU568
+	.loc 1 479 1 is_stmt 0 view .LVU569
+	movl	%edx, %ecx
+	.loc 1 480 12 view .LVU570
+	movl	$4096, %edx
+.LVL175:
+	.loc 1 480 12 view .LVU571
+	jmp	vm_map_range
+.LVL176:
+	.loc 1 480 12 view .LVU572
+	.cfi_endproc
+.LFE45:
+	.size	vm_map, .-vm_map
+	.section	.rodata.str1.8
+	.align 8
+.LC5:
+	.string	"VMM: Unmap of 0x%X stopped early, a large page couldn't be split.\n"
+	.text
+	.p2align 4
+	.globl	vm_unmap_range
+	.type	vm_unmap_range, @function
+vm_unmap_range:
+.LVL177:
+.LFB46:
+	.loc 1 488 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 489 5 view .LVU574
+	.loc 1 489 8 is_stmt 0 view .LVU575
+	cmpq	$0, pKernelPml4(%rip)
+	je	.L166
+	.loc 1 488 1 view .LVU576
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	.loc 1 493 14 view .LVU577
+	movq	%rdi, %r12
+	.loc 1 488 1 view .LVU578
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	.loc 1 494 50 view .LVU579
+	leaq	4095(%rdi,%rsi), %rbp
+	.loc 1 493 14 view .LVU580
+	andq	$-4096, %r12
+	.loc 1 488 1 view .LVU581
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 494 14 view .LVU582
+	andq	$-4096, %rbp
+	movq	%rdi, %rbx
+	.loc 1 493 5 is_stmt 1 view .LVU583
+.LVL178:
+	.loc 1 494 5 view .LVU584
+	.loc 1 495 5 view .LVU585
+	.loc 1 488 1 is_stmt 0 view .LVU586
+	subq	$280, %rsp
+	.cfi_def_cfa_offset 320
+	.loc 1 495 8 view .LVU587
+	cmpq	%rbp, %r12
+	jb	.L169
+.LVL179:
+.L155:
+	.loc 1 515 1 view .LVU588
+	addq	$280, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL180:
+	.loc 1 515 1 view .LVU589
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+.LVL181:
+	.loc 1 515 1 view .LVU590
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL182:
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	.cfi_restore_state
+	.loc 1 499 5 is_stmt 1 view .LVU591
+	.loc 1 499 20 is_stmt 0 view .LVU592
+	leaq	8(%rsp), %r13
+	movl	$33, %ecx
+	xorl	%eax, %eax
+	.loc 1 500 15 view .LVU593
+	movq	$0, (%rsp)
+	.loc 1 499 20 view .LVU594
+	movq	%r13, %rdi
+.LBB204:
+.LBB205:
+	.loc 3 29 12 view .LVU595
+	movl	$1, %edx
+.LBE205:
+.LBE204:
+	.loc 1 499 20 view .LVU596
+	rep stosq
+	.loc 1 500 5 is_stmt 1 view .LVU597
+	.loc 1 502 5 view .LVU598
+.LBB207:
+.LBI204:
+	.loc 3 27 20 view .LVU599
+.LVL183:
+	.p2align 4,,10
+	.p2align 3
+.L157:
+.LBB206:
+	.loc 3 31 5 view .LVU600
+	.loc 3 29 12 view .LVU601
+	movl	%edx, %eax
+	xchgb	vm_lock(%rip), %al
+	testb	%al, %al
+	jne	.L157
+.LVL184:
+	.loc 3 29 12 is_stmt 0 view .LVU602
+.LBE206:
+.LBE207:
+	.loc 1 504 5 is_stmt 1 view .LVU603
+	.loc 1 504 10 is_stmt 0 view .LVU604
+	xorl	%ecx, %ecx
+	movq	%r13, %r8
+	movl	$1, %edx
+	movq	%rbp, %rsi
+.LVL185:
+	.loc 1 504 10 view .LVU605
+	movq	%r12, %rdi
+	call	_vm_update
+.LVL186:
+	.loc 1 504 8 view .LVU606
+	testb	%al, %al
+	je	.L170
+.L158:
+	.loc 1 507 5 is_stmt 1 view .LVU607
+	movq	pKernelPml4(%rip), %rdi
+	movq	%r12, %rdx
+	movq	%r13, %r9
+	movq	%rsp, %r8
+	movq	%rbp, %rcx
+	movl	$4, %esi
+	call	_vm_prune
+.LVL187:
+	.loc 1 510 5 view .LVU608
+	movq	%r13, %rdi
+	call	_vm_flush
+.LVL188:
+	.loc 1 512 5 view .LVU609
+.LBB208:
+.LBI208:
+	.loc 3 34 20 view .LVU610
+.LBB209:
+	.loc 3 36 5 view .LVU611
+	movb	$0, vm_lock(%rip)
+.LVL189:
+	.loc 3 36 5 is_stmt 0 view .LVU612
+.LBE209:
+.LBE208:
+	.loc 1 514 5 is_stmt 1 view .LVU613
+	movq	(%rsp), %rbx
+.LVL190:
+.LBB210:
+.LBI210:
+	.loc 1 418 13 view .LVU614
+.LBB211:
+	.loc 1 420 12 view .LVU615
+	testq	%rbx, %rbx
+	je	.L155
+	.p2align 4,,10
+	.p2align 3
+.L159:
+.LBB212:
+	.loc 1 421 9 view .LVU616
+	movq	%rbx, %rdi
+	.loc 1 421 19 is_stmt 0 view .LVU617
+	movq	(%rbx), %rbx
+.LVL191:
+	.loc 1 422 9 is_stmt 1 view .LVU618
+	call	kfree@PLT
+.LVL192:
+	.loc 1 423 9 view .LVU619
+	.loc 1 423 9 is_stmt 0 view .LVU620
+.LBE212:
+	.loc 1 420 12 is_stmt 1 view .LVU621
+	testq	%rbx, %rbx
+	jne	.L159
+.LBE211:
+.LBE210:
+	.loc 1 515 1 is_stmt 0 view .LVU622
+	addq	$280, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 32
+.LVL193:
+	.loc 1 515 1 view .LVU623
+	popq	%rbp
+	.cfi_restore 6
+	.cfi_def_cfa_offset 24
+.LVL194:
+	.loc 1 515 1 view .LVU624
+	popq	%r12
+	.cfi_restore 12
+	.cfi_def_cfa_offset 16
+.LVL195:
+	.loc 1 515 1 view .LVU625
+	popq	%r13
+	.cfi_restore 13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL196:
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	.loc 1 515 1 view .LVU626
+	ret
+.LVL197:
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.cfi_def_cfa_offset 320
+	.cfi_offset 3, -40
+	.cfi_offset 6, -32
+	.cfi_offset 12, -24
+	.cfi_offset 13, -16
+	.loc 1 505 9 is_stmt 1 view .LVU627
+	movq	%rbx, %rsi
+	leaq	.LC5(%rip), %rdi
+	call	kprintf@PLT
+.LVL198:
+	jmp	.L158
+	.cfi_endproc
+.LFE46:
+	.size	vm_unmap_range, .-vm_unmap_range
+	.p2align 4
+	.globl	vm_unmap
+	.type	vm_unmap, @function
+vm_unmap:
+.LVL199:
+.LFB47:
+	.loc 1 518 1 view -0
+	.cfi_startproc
+	.loc 1 519 5 view .LVU629
+	movl	$4096, %esi
+	jmp	vm_unmap_range
+.LVL200:
+	.loc 1 519 5 is_stmt 0 view .LVU630
+	.cfi_endproc
+.LFE47:
+	.size	vm_unmap, .-vm_unmap
+	.p2align 4
+	.globl	vm_protect_range
+	.type	vm_protect_range, @function
+vm_protect_range:
+.LVL201:
+.LFB48:
+	.loc 1 528 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 529 5 view .LVU632
+	.loc 1 529 8 is_stmt 0 view .LVU633
+	cmpq	$0, pKernelPml4(%rip)
+	je	.L175
+	.loc 1 533 5 is_stmt 1 view .LVU634
+	.loc 1 533 14 is_stmt 0 view .LVU635
+	movq	%rdi, %r9
+	.loc 1 534 50 view .LVU636
+	leaq	4095(%rdi,%rsi), %rsi
+.LVL202:
+	.loc 1 530 15 view .LVU637
+	xorl	%ecx, %ecx
+	.loc 1 533 14 view .LVU638
+	andq	$-4096, %r9
+.LVL203:
+	.loc 1 534 5 is_stmt 1 view .LVU639
+	.loc 1 534 14 is_stmt 0 view .LVU640
+	andq	$-4096, %rsi
+.LVL204:
+	.loc 1 535 5 is_stmt 1 view .LVU641
+	.loc 1 535 8 is_stmt 0 view .LVU642
+	cmpq	%rsi, %r9
+	jb	.L182
+	.loc 1 547 1 view .LVU643
+	movl	%ecx, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L182:
+	.loc 1 528 1 view .LVU644
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 539 20 view .LVU645
+	movl	$33, %ecx
+	xorl	%eax, %eax
+	movl	%edx, %r8d
+	.loc 1 539 5 is_stmt 1 view .LVU646
+.LBB217:
+.LBB218:
+	.loc 3 29 12 is_stmt 0 view .LVU647
+	movl	$1, %edx
+.LVL205:
+	.loc 3 29 12 view .LVU648
+.LBE218:
+.LBE217:
+	.loc 1 528 1 view .LVU649
+	subq	$272, %rsp
+	.cfi_def_cfa_offset 288
+	.loc 1 539 20 view .LVU650
+	leaq	8(%rsp), %rbx
+	movq	%rbx, %rdi
+.LVL206:
+	.loc 1 539 20 view .LVU651
+	rep stosq
+	.loc 1 541 5 is_stmt 1 view .LVU652
+.LBB220:
+.LBI217:
+	.loc 3 27 20 view .LVU653
+.LVL207:
+	.p2align 4,,10
+	.p2align 3
+.L174:
+.LBB219:
+	.loc 3 31 5 view .LVU654
+	.loc 3 29 12 view .LVU655
+	movl	%edx, %eax
+	xchgb	vm_lock(%rip), %al
+	testb	%al, %al
+	jne	.L174
+.LVL208:
+	.loc 3 29 12 is_stmt 0 view .LVU656
+.LBE219:
+.LBE220:
+	.loc 1 542 4 is_stmt 1 view .LVU657
+	.loc 1 542 16 is_stmt 0 view .LVU658
+	movl	%r8d, %edi
+	movq	%rbx, %r8
+.LVL209:
+	.loc 1 542 16 view .LVU659
+	call	_vm_attrs
+.LVL210:
+	.loc 1 542 16 view .LVU660
+	xorl	%edx, %edx
+	movq	%r9, %rdi
+	movq	%rax, %rcx
+	call	_vm_update
+.LVL211:
+	.loc 1 543 5 view .LVU661
+	movq	%rbx, %rdi
+	.loc 1 542 16 view .LVU662
+	movl	%eax, %ecx
+.LVL212:
+	.loc 1 543 5 is_stmt 1 view .LVU663
+	call	_vm_flush
+.LVL213:
+	.loc 1 544 5 view .LVU664
+.LBB221:
+.LBI221:
+	.loc 3 34 20 view .LVU665
+.LBB222:
+	.loc 3 36 5 view .LVU666
+.LBE222:
+.LBE221:
+	.loc 1 547 1 is_stmt 0 view .LVU667
+	movl	%ecx, %eax
+.LBB224:
+.LBB223:
+	.loc 3 36 5 view .LVU668
+	movb	$0, vm_lock(%rip)
+.LVL214:
+	.loc 3 36 5 view .LVU669
+.LBE223:
+.LBE224:
+	.loc 1 546 5 is_stmt 1 view .LVU670
+	.loc 1 547 1 is_stmt 0 view .LVU671
+	addq	$272, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	ret
+.LVL215:
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	.loc 1 530 15 view .LVU672
+	xorl	%ecx, %ecx
+	.loc 1 547 1 view .LVU673
+	movl	%ecx, %eax
+	ret
+	.cfi_endproc
+.LFE48:
+	.size	vm_protect_range, .-vm_protect_range
+	.p2align 4
+	.globl	vm_protect
+	.type	vm_protect, @function
+vm_protect:
+.LVL216:
+.LFB49:
+	.loc 1 550 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 551 5 view .LVU675
+	.loc 1 550 1 is_stmt 0 view .LVU676
+	movl	%esi, %edx
+	.loc 1 551 12 view .LVU677
+	movl	$4096, %esi
+.LVL217:
+	.loc 1 551 12 view .LVU678
+	jmp	vm_protect_range
+.LVL218:
+	.loc 1 551 12 view .LVU679
+	.cfi_endproc
+.LFE49:
+	.size	vm_protect, .-vm_protect
+	.section	.rodata.str1.1
+.LC6:
+	.string	"enabled"
+.LC7:
+	.string	"disabled"
+.LC8:
+	.string	"Kernel PML4: 0x%X\n"
+.LC9:
+	.string	"NX: %s\n"
+.LC10:
+	.string	"Page tables allocated: %lu\n"
+.LC11:
+	.string	"Large pages split: %lu\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC12:
+	.string	"Pages invalidated with invlpg: %lu\n"
+	.section	.rodata.str1.1
+.LC13:
+	.string	"Full TLB flushes: %lu\n"
+	.text
+	.p2align 4
+	.globl	vm_report
+	.type	vm_report, @function
+vm_report:
+.LFB50:
+	.loc 1 555 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 556 5 view .LVU681
+	.loc 1 555 1 is_stmt 0 view .LVU682
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 556 48 view .LVU683
+	movq	pKernelPml4(%rip), %rax
+	xorl	%esi, %esi
+	.loc 1 556 5 view .LVU684
+	testq	%rax, %rax
+	je	.L185
+	.loc 1 556 5 discriminator 1 view .LVU685
+	subq	vmm_higher_half_offset(%rip), %rax
+	movq	%rax, %rsi
+.L185:
+	.loc 1 556 5 discriminator 4 view .LVU686
+	xorl	%eax, %eax
+	leaq	.LC8(%rip), %rdi
+	call	kprintf@PLT
+.LVL219:
+	.loc 1 557 5 is_stmt 1 discriminator 4 view .LVU687
+	cmpb	$0, nx_enabled(%rip)
+	leaq	.LC6(%rip), %rax
+	leaq	.LC7(%rip), %rsi
+	cmovne	%rax, %rsi
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL220:
+	.loc 1 558 5 discriminator 4 view .LVU688
+	movq	vm_table_pages(%rip), %rsi
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL221:
+	.loc 1 559 5 discriminator 4 view .LVU689
+	movq	vm_split_pages(%rip), %rsi
+	leaq	.LC11(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL222:
+	.loc 1 560 5 discriminator 4 view .LVU690
+	movq	vm_invlpgs(%rip), %rsi
+	leaq	.LC12(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL223:
+	.loc 1 561 5 discriminator 4 view .LVU691
+	movq	vm_full_flushes(%rip), %rsi
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 562 1 is_stmt 0 discriminator 4 view .LVU692
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 561 5 discriminator 4 view .LVU693
+	jmp	kprintf@PLT
+.LVL224:
+	.cfi_endproc
+.LFE50:
+	.size	vm_report, .-vm_report
+	.section	.rodata.str1.8
+	.align 8
+.LC14:
+	.string	"Initializing virtual memory...\n"
+	.section	.rodata.str1.1
+.LC15:
+	.string	"Paging disabled.\n"
+.LC16:
+	.string	"Paging enabled.\n"
+.LC17:
+	.string	"32-bit paging mode.\n"
+.LC18:
+	.string	"4-level paging mode.\n"
+.LC19:
+	.string	"5-level paging mode.\n"
+.LC20:
+	.string	"MAXPHYADDR: %d bits\n"
+.LC21:
+	.string	"MAXLINADDR: %d bits\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"VMM: 5-level paging isn't supported, staying on the bootloader's page tables.\n"
+	.align 8
+.LC23:
+	.string	"*FATAL*: No memory for the kernel PML4.\n"
+	.align 8
+.LC24:
+	.string	"VMM: Kernel PML4 at 0x%X, NX %s.\n"
+	.text
+	.p2align 4
+	.globl	vm_init
+	.type	vm_init, @function
+vm_init:
+.LFB51:
+	.loc 1 565 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 566 5 view .LVU695
+	.loc 1 565 1 is_stmt 0 view .LVU696
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 566 5 view .LVU697
+	leaq	.LC14(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL225:
+	.loc 1 568 5 is_stmt 1 view .LVU698
+.LBB244:
+.LBI244:
+	.loc 2 262 19 view .LVU699
+.LBB245:
+	.loc 2 265 5 view .LVU700
+	.loc 2 267 5 view .LVU701
+.LBB246:
+.LBI246:
+	.loc 2 203 24 view .LVU702
+.LBB247:
+	.loc 2 205 5 view .LVU703
+	.loc 2 206 5 view .LVU704
+#APP
+# 206 "src/include/cpu.h" 1
+	movq %cr0, %rax
+# 0 "" 2
+.LVL226:
+	.loc 2 207 5 view .LVU705
+	.loc 2 207 5 is_stmt 0 view .LVU706
+#NO_APP
+.LBE247:
+.LBE246:
+	.loc 2 267 8 view .LVU707
+	testl	$2147483648, %eax
+	jne	.L193
+.LBE245:
+.LBE244:
+	.loc 1 571 9 is_stmt 1 view .LVU708
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL227:
+.L194:
+	.loc 1 575 5 view .LVU709
+.LBB249:
+.LBI249:
+	.loc 2 217 24 view .LVU710
+.LBB250:
+	.loc 2 219 5 view .LVU711
+	.loc 2 220 5 view .LVU712
+#APP
+# 220 "src/include/cpu.h" 1
+	movq %cr4, %rbx
+# 0 "" 2
+.LVL228:
+	.loc 2 221 5 view .LVU713
+	.loc 2 221 5 is_stmt 0 view .LVU714
+#NO_APP
+.LBE250:
+.LBE249:
+	.loc 1 577 5 is_stmt 1 view .LVU715
+	.loc 1 577 8 is_stmt 0 view .LVU716
+	testb	$32, %bl
+	je	.L208
+	.loc 1 581 5 is_stmt 1 view .LVU717
+	.loc 1 581 20 is_stmt 0 view .LVU718
+	movq	%rbx, %rax
+	andl	$4128, %eax
+	.loc 1 581 8 view .LVU719
+	cmpq	$32, %rax
+	je	.L209
+.L196:
+	.loc 1 585 5 is_stmt 1 view .LVU720
+	.loc 1 585 8 is_stmt 0 view .LVU721
+	cmpq	$4128, %rax
+	je	.L210
+.L197:
+	.loc 1 590 5 is_stmt 1 view .LVU722
+.LBB251:
+.LBI251:
+	.loc 2 250 24 view .LVU723
+.LBB252:
+	.loc 2 252 5 view .LVU724
+.LVL229:
+	.loc 2 253 5 view .LVU725
+	movl	$2147483656, %eax
+#APP
+# 253 "src/include/cpu.h" 1
+	cpuid
+# 0 "" 2
+.LVL230:
+	.loc 2 259 5 view .LVU726
+	.loc 2 259 5 is_stmt 0 view .LVU727
+#NO_APP
+.LBE252:
+.LBE251:
+	.loc 1 591 5 is_stmt 1 view .LVU728
+	.loc 1 591 22 is_stmt 0 view .LVU729
+	movzbl	%al, %esi
+	.loc 1 592 27 view .LVU730
+	movzbl	%ah, %eax
+.LVL231:
+	.loc 1 593 5 view .LVU731
+	leaq	.LC20(%rip), %rdi
+	.loc 1 592 27 view .LVU732
+	movl	%eax, maxlinaddr(%rip)
+	.loc 1 593 5 view .LVU733
+	xorl	%eax, %eax
+	.loc 1 591 16 view .LVU734
+	movl	%esi, maxphyaddr(%rip)
+	.loc 1 592 5 is_stmt 1 view .LVU735
+	.loc 1 593 5 view .LVU736
+	call	kprintf@PLT
+.LVL232:
+	.loc 1 594 5 view .LVU737
+	movl	maxlinaddr(%rip), %esi
+	leaq	.LC21(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL233:
+	.loc 1 596 5 view .LVU738
+	xorl	%edi, %edi
+	call	walk_page_table
+.LVL234:
+	.loc 1 598 5 view .LVU739
+	.loc 1 598 8 is_stmt 0 view .LVU740
+	andb	$16, %bh
+.LVL235:
+	.loc 1 598 8 view .LVU741
+	jne	.L211
+	.loc 1 603 5 is_stmt 1 view .LVU742
+.LVL236:
+.LBB253:
+.LBI253:
+	.loc 2 148 24 view .LVU743
+.LBB254:
+	.loc 2 150 5 view .LVU744
+	.loc 2 152 5 view .LVU745
+	movl	$-1073741696, %ecx
+#APP
+# 152 "src/include/cpu.h" 1
+	rdmsr
+# 0 "" 2
+.LVL237:
+	.loc 2 158 5 view .LVU746
+	.loc 2 158 5 is_stmt 0 view .LVU747
+#NO_APP
+.LBE254:
+.LBE253:
+	.loc 1 603 39 view .LVU748
+	shrq	$11, %rax
+.LBB255:
+.LBB256:
+	.loc 1 217 20 view .LVU749
+	movl	$2, %esi
+	movl	$4096, %edi
+.LBE256:
+.LBE255:
+	.loc 1 603 39 view .LVU750
+	andl	$1, %eax
+	movb	%al, nx_enabled(%rip)
+	.loc 1 608 5 is_stmt 1 view .LVU751
+.LBB259:
+.LBI255:
+	.loc 1 215 17 view .LVU752
+.LBB257:
+	.loc 1 217 5 view .LVU753
+	.loc 1 217 20 is_stmt 0 view .LVU754
+	call	kalloc_zone@PLT
+.LVL238:
+	.loc 1 218 5 is_stmt 1 view .LVU755
+	.loc 1 218 8 is_stmt 0 view .LVU756
+	testq	%rax, %rax
+	je	.L212
+	.loc 1 223 5 is_stmt 1 view .LVU757
+	.loc 1 223 19 is_stmt 0 view .LVU758
+	addq	$1, vm_table_pages(%rip)
+	.loc 1 224 5 is_stmt 1 view .LVU759
+.LVL239:
+	.loc 1 224 5 is_stmt 0 view .LVU760
+.LBE257:
+.LBE259:
+	.loc 1 609 5 is_stmt 1 view .LVU761
+	.loc 1 609 8 is_stmt 0 view .LVU762
+	subq	vmm_higher_half_offset(%rip), %rax
+.LVL240:
+	.loc 1 609 8 view .LVU763
+	je	.L200
+	.loc 1 614 5 is_stmt 1 view .LVU764
+.LBB260:
+.LBI260:
+	.loc 2 210 24 view .LVU765
+.LBB261:
+	.loc 2 212 5 view .LVU766
+	.loc 2 213 5 view .LVU767
+#APP
+# 213 "src/include/cpu.h" 1
+	movq %cr3, %rcx
+# 0 "" 2
+.LVL241:
+	.loc 2 214 5 view .LVU768
+	.loc 2 214 5 is_stmt 0 view .LVU769
+#NO_APP
+.LBE261:
+.LBE260:
+	.loc 1 614 90 view .LVU770
+	movq	vmm_higher_half_offset(%rip), %rsi
+	.loc 1 614 47 view .LVU771
+	movabsq	$4503599627366400, %rdx
+	andq	%rdx, %rcx
+	.loc 1 614 90 view .LVU772
+	leaq	(%rcx,%rsi), %rdx
+.LVL242:
+	.loc 1 615 5 is_stmt 1 view .LVU773
+	.loc 1 615 56 is_stmt 0 view .LVU774
+	addq	%rax, %rsi
+	movq	%rsi, pKernelPml4(%rip)
+	.loc 1 616 5 is_stmt 1 view .LVU775
+.LBB262:
+	.loc 1 616 10 view .LVU776
+.LVL243:
+	.loc 1 616 28 view .LVU777
+	.loc 1 617 20 is_stmt 0 view .LVU778
+	movq	%rax, %rsi
+	leaq	4096(%rdx), %rdi
+	subq	%rcx, %rsi
+.LVL244:
+	.p2align 4,,10
+	.p2align 3
+.L203:
+	.loc 1 617 9 is_stmt 1 discriminator 3 view .LVU779
+	.loc 1 617 35 is_stmt 0 discriminator 3 view .LVU780
+	movq	(%rdx), %rcx
+	.loc 1 617 24 discriminator 3 view .LVU781
+	movq	%rcx, (%rsi,%rdx)
+	.loc 1 616 36 is_stmt 1 discriminator 3 view .LVU782
+.LVL245:
+	.loc 1 616 28 discriminator 3 view .LVU783
+	addq	$8, %rdx
+	cmpq	%rdi, %rdx
+	jne	.L203
+.LBE262:
+	.loc 1 620 5 view .LVU784
+.LVL246:
+.LBB263:
+.LBI263:
+	.loc 2 224 20 view .LVU785
+.LBB264:
+	.loc 2 226 5 view .LVU786
+#APP
+# 226 "src/include/cpu.h" 1
+	movq %rax, %cr3
+# 0 "" 2
+.LVL247:
+	.loc 2 226 5 is_stmt 0 view .LVU787
+#NO_APP
+.LBE264:
+.LBE263:
+	.loc 1 621 5 is_stmt 1 view .LVU788
+	cmpb	$0, nx_enabled(%rip)
+	leaq	.LC7(%rip), %rdx
+	.loc 1 622 1 is_stmt 0 view .LVU789
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	.loc 1 621 5 view .LVU790
+	movq	%rax, %rsi
+	leaq	.LC6(%rip), %rcx
+	leaq	.LC24(%rip), %rdi
+.LVL248:
+	.loc 1 621 5 view .LVU791
+	cmovne	%rcx, %rdx
+	xorl	%eax, %eax
+.LVL249:
+	.loc 1 621 5 view .LVU792
+	jmp	kprintf@PLT
+.LVL250:
+.L193:
+	.cfi_restore_state
+.LBB265:
+.LBB248:
+	.loc 2 268 9 is_stmt 1 view .LVU793
+.LBE248:
+.LBE265:
+	.loc 1 569 9 view .LVU794
+	leaq	.LC16(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL251:
+	jmp	.L194
+.LVL252:
+.L211:
+	.loc 1 599 9 view .LVU795
+	leaq	.LC22(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 622 1 is_stmt 0 view .LVU796
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+	.loc 1 599 9 view .LVU797
+	jmp	kprintf@PLT
+.LVL253:
+.L208:
+	.cfi_restore_state
+	.loc 1 578 9 is_stmt 1 view .LVU798
+	xorl	%eax, %eax
+	leaq	.LC17(%rip), %rdi
+	call	kprintf@PLT
+.LVL254:
+	.loc 1 581 5 view .LVU799
+	.loc 1 581 20 is_stmt 0 view .LVU800
+	movq	%rbx, %rax
+	andl	$4128, %eax
+	.loc 1 581 8 view .LVU801
+	cmpq	$32, %rax
+	jne	.L196
+.L209:
+	.loc 1 582 9 is_stmt 1 view .LVU802
+	leaq	.LC18(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL255:
+	.loc 1 585 5 view .LVU803
+	jmp	.L197
+.L210:
+	.loc 1 586 9 view .LVU804
+	leaq	.LC19(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL256:
+	jmp	.L197
+.LVL257:
+.L212:
+.LBB266:
+.LBB258:
+	.loc 1 219 9 view .LVU805
+	leaq	.LC0(%rip), %rdi
+	call	kprintf@PLT
+.LVL258:
+	.loc 1 220 9 view .LVU806
+	.loc 1 220 9 is_stmt 0 view .LVU807
+.LBE258:
+.LBE266:
+	.loc 1 609 5 is_stmt 1 view .LVU808
+.L200:
+	.loc 1 610 9 view .LVU809
+	leaq	.LC23(%rip), %rdi
+	xorl	%eax, %eax
+	call	kprintf@PLT
+.LVL259:
+	.loc 1 611 9 view .LVU810
+.LBB267:
+.LBI267:
+	.file 4 "src/kernel.h"
+	.loc 4 27 20 view .LVU811
+.LBB268:
+	.loc 4 29 5 view .LVU812
+#APP
+# 29 "src/kernel.h" 1
+	cli
+# 0 "" 2
+#NO_APP
+.L202:
+	.loc 4 30 5 view .LVU813
+	.loc 4 31 9 view .LVU814
+#APP
+# 31 "src/kernel.h" 1
+	hlt
+# 0 "" 2
+	.loc 4 30 5 view .LVU815
+#NO_APP
+	jmp	.L202
+.LBE268:
+.LBE267:
+	.cfi_endproc
+.LFE51:
+	.size	vm_init, .-vm_init
+	.local	vm_full_flushes
+	.comm	vm_full_flushes,8,8
+	.local	vm_invlpgs
+	.comm	vm_invlpgs,8,8
+	.local	vm_split_pages
+	.comm	vm_split_pages,8,8
+	.local	vm_table_pages
+	.comm	vm_table_pages,8,8
+	.local	nx_enabled
+	.comm	nx_enabled,1,1
+	.local	vm_lock
+	.comm	vm_lock,1,1
+	.local	pKernelPml4
+	.comm	pKernelPml4,8,8
+	.globl	maxlinaddr
+	.bss
+	.align 4
+	.type	maxlinaddr, @object
+	.size	maxlinaddr, 4
+maxlinaddr:
+	.zero	4
+	.globl	maxphyaddr
+	.align 4
+	.type	maxphyaddr, @object
+	.size	maxphyaddr, 4
+maxphyaddr:
+	.zero	4
+	.text
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint-gcc.h"
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 "src/include/mem.h"
+	.file 8 "src/include/str.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1a72
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x34
+	.long	.LASF100
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x16
+	.long	.LASF7
+	.byte	0x5
+	.byte	0x2e
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x16
+	.long	.LASF8
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x70
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF9
+	.uleb128 0x16
+	.long	.LASF10
+	.byte	0x5
+	.byte	0x37
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x16
+	.long	.LASF12
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF13
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0x36
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0x37
+	.long	0xa6
+	.uleb128 0x14
+	.long	0xad
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF16
+	.uleb128 0x38
+	.long	.LASF18
+	.byte	0x7
+	.byte	0xb2
+	.byte	0x11
+	.long	0x77
+	.uleb128 0x39
+	.byte	0x1
+	.byte	0x3
+	.byte	0x17
+	.byte	0x9
+	.long	0xe1
+	.uleb128 0x1e
+	.long	.LASF28
+	.byte	0x3
+	.byte	0x18
+	.byte	0xd
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x19
+	.byte	0x3
+	.long	0xca
+	.uleb128 0x14
+	.long	0x64
+	.uleb128 0x22
+	.long	.LASF19
+	.byte	0x3c
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	maxphyaddr
+	.uleb128 0x22
+	.long	.LASF20
+	.byte	0x3d
+	.long	0x64
+	.uleb128 0x9
+	.byte	0x3
+	.quad	maxlinaddr
+	.uleb128 0xf
+	.long	.LASF21
+	.byte	0x40
+	.byte	0x12
+	.long	0x12f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pKernelPml4
+	.uleb128 0x14
+	.long	0x77
+	.uleb128 0xf
+	.long	.LASF22
+	.byte	0x41
+	.byte	0x13
+	.long	0xe1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vm_lock
+	.uleb128 0xf
+	.long	.LASF23
+	.byte	0x42
+	.byte	0xc
+	.long	0xb7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	nx_enabled
+	.uleb128 0xf
+	.long	.LASF24
+	.byte	0x45
+	.byte	0x11
+	.long	0x77
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vm_table_pages
+	.uleb128 0xf
+	.long	.LASF25
+	.byte	0x46
+	.byte	0x11
+	.long	0x77
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vm_split_pages
+	.uleb128 0xf
+	.long	.LASF26
+	.byte	0x47
+	.byte	0x11
+	.long	0x77
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vm_invlpgs
+	.uleb128 0xf
+	.long	.LASF27
+	.byte	0x48
+	.byte	0x11
+	.long	0x77
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vm_full_flushes
+	.uleb128 0x3a
+	.long	.LASF101
+	.value	0x108
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x8
+	.long	0x1db
+	.uleb128 0x1e
+	.long	.LASF29
+	.byte	0x1
+	.byte	0x4f
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF30
+	.byte	0x1
+	.byte	0x50
+	.byte	0xe
+	.long	0x1db
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3b
+	.long	0x77
+	.long	0x1eb
+	.uleb128 0x3c
+	.long	0x83
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF31
+	.byte	0x7
+	.byte	0xd6
+	.long	0x1fc
+	.uleb128 0x1b
+	.long	0xa4
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF102
+	.byte	0x7
+	.byte	0xc1
+	.byte	0x7
+	.long	0xa4
+	.long	0x217
+	.uleb128 0x1b
+	.long	0x8a
+	.uleb128 0x1b
+	.long	0x64
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x30
+	.long	0x229
+	.uleb128 0x1b
+	.long	0xb2
+	.uleb128 0x3e
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF35
+	.value	0x234
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x619
+	.uleb128 0x10
+	.string	"cr4"
+	.value	0x23f
+	.byte	0xe
+	.long	0x77
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x10
+	.string	"val"
+	.value	0x24e
+	.byte	0xe
+	.long	0x77
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x6
+	.long	.LASF33
+	.value	0x260
+	.byte	0xe
+	.long	0x77
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x6
+	.long	.LASF34
+	.value	0x266
+	.byte	0xf
+	.long	0x12f
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x25
+	.quad	.LBB262
+	.quad	.LBE262-.LBB262
+	.long	0x2be
+	.uleb128 0x10
+	.string	"i"
+	.value	0x268
+	.byte	0x13
+	.long	0x64
+	.long	.LLST147
+	.long	.LVUS147
+	.byte	0
+	.uleb128 0x9
+	.long	0x196b
+	.quad	.LBI244
+	.byte	.LVU699
+	.long	.LLRL138
+	.value	0x238
+	.byte	0x9
+	.long	0x317
+	.uleb128 0xa
+	.long	.LLRL138
+	.uleb128 0x3f
+	.long	0x197d
+	.long	0x80000000
+	.uleb128 0x1f
+	.long	0x1a29
+	.quad	.LBI246
+	.byte	.LVU702
+	.quad	.LBB246
+	.quad	.LBE246-.LBB246
+	.byte	0x2
+	.value	0x10b
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x1a3a
+	.long	.LLST139
+	.long	.LVUS139
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x19f1
+	.quad	.LBI249
+	.byte	.LVU710
+	.quad	.LBB249
+	.quad	.LBE249-.LBB249
+	.value	0x23f
+	.byte	0x14
+	.long	0x34a
+	.uleb128 0x2
+	.long	0x1a02
+	.long	.LLST140
+	.long	.LVUS140
+	.byte	0
+	.uleb128 0xc
+	.long	0x198b
+	.quad	.LBI251
+	.byte	.LVU723
+	.quad	.LBB251
+	.quad	.LBE251-.LBB251
+	.value	0x24e
+	.byte	0x14
+	.long	0x37d
+	.uleb128 0x2
+	.long	0x199c
+	.long	.LLST141
+	.long	.LVUS141
+	.byte	0
+	.uleb128 0xc
+	.long	0x1a45
+	.quad	.LBI253
+	.byte	.LVU743
+	.quad	.LBB253
+	.quad	.LBE253-.LBB253
+	.value	0x25b
+	.byte	0x12
+	.long	0x3c2
+	.uleb128 0x3
+	.long	0x1a52
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x2
+	.long	0x1a5e
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x40
+	.long	0x1a68
+	.byte	0
+	.uleb128 0x9
+	.long	0x15e1
+	.quad	.LBI255
+	.byte	.LVU752
+	.long	.LLRL144
+	.value	0x260
+	.byte	0x15
+	.long	0x428
+	.uleb128 0xa
+	.long	.LLRL144
+	.uleb128 0x2
+	.long	0x15f2
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x4
+	.quad	.LVL238
+	.long	0x1fc
+	.long	0x40b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL258
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1a0d
+	.quad	.LBI260
+	.byte	.LVU765
+	.quad	.LBB260
+	.quad	.LBE260-.LBB260
+	.value	0x266
+	.byte	0x3a
+	.long	0x45b
+	.uleb128 0x2
+	.long	0x1a1e
+	.long	.LLST146
+	.long	.LVUS146
+	.byte	0
+	.uleb128 0xc
+	.long	0x19d9
+	.quad	.LBI263
+	.byte	.LVU785
+	.quad	.LBB263
+	.quad	.LBE263-.LBB263
+	.value	0x26c
+	.byte	0x5
+	.long	0x48e
+	.uleb128 0x3
+	.long	0x19e6
+	.long	.LLST148
+	.long	.LVUS148
+	.byte	0
+	.uleb128 0x41
+	.long	0x1929
+	.quad	.LBI267
+	.byte	.LVU811
+	.quad	.LBB267
+	.quad	.LBE267-.LBB267
+	.byte	0x1
+	.value	0x263
+	.byte	0x9
+	.uleb128 0x4
+	.quad	.LVL225
+	.long	0x217
+	.long	0x4cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL227
+	.long	0x217
+	.long	0x4ee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC15
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL232
+	.long	0x217
+	.long	0x50d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL233
+	.long	0x217
+	.long	0x52c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL234
+	.long	0x17e9
+	.long	0x543
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL250
+	.long	0x217
+	.long	0x562
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL251
+	.long	0x217
+	.long	0x581
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL253
+	.long	0x217
+	.long	0x5a0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL254
+	.long	0x217
+	.long	0x5bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL255
+	.long	0x217
+	.long	0x5de
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL256
+	.long	0x217
+	.long	0x5fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL259
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF36
+	.value	0x22a
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6ed
+	.uleb128 0x4
+	.quad	.LVL219
+	.long	0x217
+	.long	0x655
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL220
+	.long	0x217
+	.long	0x674
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL221
+	.long	0x217
+	.long	0x693
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL222
+	.long	0x217
+	.long	0x6b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL223
+	.long	0x217
+	.long	0x6d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.byte	0
+	.uleb128 0x1c
+	.quad	.LVL224
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF39
+	.value	0x225
+	.long	0xb7
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x75a
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x225
+	.byte	0x19
+	.long	0x77
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x225
+	.byte	0x2d
+	.long	0x64
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x1c
+	.quad	.LVL218
+	.long	0x75a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF40
+	.value	0x20f
+	.long	0xb7
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8a7
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x20f
+	.byte	0x1f
+	.long	0x77
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x5
+	.long	.LASF41
+	.value	0x20f
+	.byte	0x33
+	.long	0x77
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x20f
+	.byte	0x42
+	.long	0x64
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x6
+	.long	.LASF42
+	.value	0x215
+	.byte	0xe
+	.long	0x77
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x10
+	.string	"end"
+	.value	0x216
+	.byte	0xe
+	.long	0x77
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x17
+	.long	.LASF43
+	.value	0x21b
+	.byte	0x14
+	.long	0x1b2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -280
+	.uleb128 0x6
+	.long	.LASF44
+	.value	0x21e
+	.byte	0x9
+	.long	0xb7
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x9
+	.long	0x1951
+	.quad	.LBI217
+	.byte	.LVU653
+	.long	.LLRL128
+	.value	0x21d
+	.byte	0x5
+	.long	0x82a
+	.uleb128 0x3
+	.long	0x195e
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0x9
+	.long	0x1932
+	.quad	.LBI221
+	.byte	.LVU665
+	.long	.LLRL130
+	.value	0x220
+	.byte	0x5
+	.long	0x851
+	.uleb128 0x3
+	.long	0x193f
+	.long	.LLST131
+	.long	.LVUS131
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL210
+	.long	0x15ff
+	.long	0x86a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL211
+	.long	0x1153
+	.long	0x892
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL213
+	.long	0x1648
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF45
+	.value	0x205
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f5
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x205
+	.byte	0x18
+	.long	0x77
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1c
+	.quad	.LVL200
+	.long	0x8f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF46
+	.value	0x1e7
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xad7
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x1e7
+	.byte	0x1e
+	.long	0x77
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x5
+	.long	.LASF41
+	.value	0x1e7
+	.byte	0x32
+	.long	0x77
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x6
+	.long	.LASF42
+	.value	0x1ed
+	.byte	0xe
+	.long	0x77
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x10
+	.string	"end"
+	.value	0x1ee
+	.byte	0xe
+	.long	0x77
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x17
+	.long	.LASF43
+	.value	0x1f3
+	.byte	0x14
+	.long	0x1b2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -312
+	.uleb128 0x17
+	.long	.LASF47
+	.value	0x1f4
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x9
+	.long	0x1951
+	.quad	.LBI204
+	.byte	.LVU599
+	.long	.LLRL116
+	.value	0x1f6
+	.byte	0x5
+	.long	0x9a9
+	.uleb128 0x3
+	.long	0x195e
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0xc
+	.long	0x1932
+	.quad	.LBI208
+	.byte	.LVU610
+	.quad	.LBB208
+	.quad	.LBE208-.LBB208
+	.value	0x200
+	.byte	0x5
+	.long	0x9dc
+	.uleb128 0x3
+	.long	0x193f
+	.long	.LLST118
+	.long	.LVUS118
+	.byte	0
+	.uleb128 0xc
+	.long	0xf46
+	.quad	.LBI210
+	.byte	.LVU614
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.value	0x202
+	.byte	0x5
+	.long	0xa3f
+	.uleb128 0x3
+	.long	0xf54
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x28
+	.long	0xf60
+	.quad	.LBB212
+	.quad	.LBE212-.LBB212
+	.uleb128 0x2
+	.long	0xf61
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x29
+	.quad	.LVL192
+	.long	0x1eb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL186
+	.long	0x1153
+	.long	0xa6d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL187
+	.long	0xf70
+	.long	0xa9d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL188
+	.long	0x1648
+	.long	0xab5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL198
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF48
+	.value	0x1de
+	.long	0xb7
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb5f
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x1de
+	.byte	0x15
+	.long	0x77
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x5
+	.long	.LASF49
+	.value	0x1de
+	.byte	0x29
+	.long	0x77
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x1de
+	.byte	0x3d
+	.long	0x64
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x1c
+	.quad	.LVL176
+	.long	0xb5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF50
+	.value	0x1b0
+	.long	0xb7
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf46
+	.uleb128 0x5
+	.long	.LASF37
+	.value	0x1b0
+	.byte	0x1b
+	.long	0x77
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x5
+	.long	.LASF49
+	.value	0x1b0
+	.byte	0x2f
+	.long	0x77
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x5
+	.long	.LASF41
+	.value	0x1b0
+	.byte	0x43
+	.long	0x77
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x5
+	.long	.LASF38
+	.value	0x1b0
+	.byte	0x52
+	.long	0x64
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x10
+	.string	"end"
+	.value	0x1bd
+	.byte	0xe
+	.long	0x77
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x6
+	.long	.LASF51
+	.value	0x1c2
+	.byte	0xe
+	.long	0x77
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x6
+	.long	.LASF42
+	.value	0x1c3
+	.byte	0xe
+	.long	0x77
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x17
+	.long	.LASF47
+	.value	0x1cd
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x6
+	.long	.LASF52
+	.value	0x1ce
+	.byte	0x9
+	.long	0xb7
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x25
+	.quad	.LBB195
+	.quad	.LBE195-.LBB195
+	.long	0xcc9
+	.uleb128 0x17
+	.long	.LASF43
+	.value	0x1d1
+	.byte	0x18
+	.long	0x1b2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x4
+	.quad	.LVL164
+	.long	0x1153
+	.long	0xc83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL165
+	.long	0xf70
+	.long	0xcb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 4096
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL166
+	.long	0x1648
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x1951
+	.quad	.LBI156
+	.byte	.LVU430
+	.long	.LLRL89
+	.value	0x1c5
+	.byte	0x5
+	.long	0xcf0
+	.uleb128 0x3
+	.long	0x195e
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.uleb128 0x9
+	.long	0x1461
+	.quad	.LBI160
+	.byte	.LVU443
+	.long	.LLRL91
+	.value	0x1c8
+	.byte	0xe
+	.long	0xe50
+	.uleb128 0x3
+	.long	0x1488
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x3
+	.long	0x147c
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x3
+	.long	0x1470
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0xa
+	.long	.LLRL91
+	.uleb128 0x2
+	.long	0x1494
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x2
+	.long	0x14a1
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x2
+	.long	0x14ae
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x2a
+	.long	0x14bb
+	.long	.LLRL98
+	.long	0xe2d
+	.uleb128 0x2
+	.long	0x14bc
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x20
+	.long	0x14c9
+	.long	.LLRL100
+	.uleb128 0x2
+	.long	0x14ca
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x2a
+	.long	0x14d7
+	.long	.LLRL102
+	.long	0xe0a
+	.uleb128 0x2
+	.long	0x14d8
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x42
+	.long	0x15e1
+	.quad	.LBI165
+	.byte	.LVU515
+	.long	.LLRL104
+	.byte	0x1
+	.value	0x131
+	.byte	0x1e
+	.uleb128 0xa
+	.long	.LLRL104
+	.uleb128 0x2
+	.long	0x15f2
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x4
+	.quad	.LVL153
+	.long	0x1fc
+	.long	0xdec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL168
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL170
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL162
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1932
+	.quad	.LBI189
+	.byte	.LVU493
+	.quad	.LBB189
+	.quad	.LBE189-.LBB189
+	.value	0x1d7
+	.byte	0x5
+	.long	0xe83
+	.uleb128 0x3
+	.long	0x193f
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.uleb128 0xc
+	.long	0xf46
+	.quad	.LBI191
+	.byte	.LVU497
+	.quad	.LBB191
+	.quad	.LBE191-.LBB191
+	.value	0x1d9
+	.byte	0x5
+	.long	0xee6
+	.uleb128 0x3
+	.long	0xf54
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x28
+	.long	0xf60
+	.quad	.LBB193
+	.quad	.LBE193-.LBB193
+	.uleb128 0x2
+	.long	0xf61
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x29
+	.quad	.LVL145
+	.long	0x1eb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL125
+	.long	0x15ff
+	.long	0xefe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL150
+	.long	0x217
+	.long	0xf2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL173
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF75
+	.byte	0x1
+	.value	0x1a2
+	.byte	0xd
+	.byte	0x1
+	.long	0xf70
+	.uleb128 0x11
+	.long	.LASF47
+	.value	0x1a2
+	.byte	0x27
+	.long	0x12f
+	.uleb128 0x12
+	.uleb128 0x7
+	.long	.LASF65
+	.byte	0x1
+	.value	0x1a5
+	.byte	0x13
+	.long	0x12f
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF60
+	.value	0x179
+	.long	0xb7
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1149
+	.uleb128 0x5
+	.long	.LASF53
+	.value	0x179
+	.byte	0x20
+	.long	0x12f
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x5
+	.long	.LASF54
+	.value	0x179
+	.byte	0x31
+	.long	0x64
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x5
+	.long	.LASF42
+	.value	0x179
+	.byte	0x41
+	.long	0x77
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2c
+	.string	"end"
+	.value	0x179
+	.byte	0x50
+	.long	0x77
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x5
+	.long	.LASF55
+	.value	0x179
+	.byte	0x60
+	.long	0x1149
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x5
+	.long	.LASF56
+	.value	0x17a
+	.byte	0x15
+	.long	0x114e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x2d
+	.long	.LLRL19
+	.long	0x1130
+	.uleb128 0x6
+	.long	.LASF41
+	.value	0x17d
+	.byte	0x12
+	.long	0x77
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xa
+	.long	.LLRL21
+	.uleb128 0x6
+	.long	.LASF57
+	.value	0x180
+	.byte	0x16
+	.long	0x77
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x6
+	.long	.LASF58
+	.value	0x181
+	.byte	0x17
+	.long	0x12f
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x2e
+	.quad	.LBB81
+	.quad	.LBE81-.LBB81
+	.uleb128 0x6
+	.long	.LASF59
+	.value	0x184
+	.byte	0x1b
+	.long	0x12f
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x9
+	.long	0x17c3
+	.quad	.LBI82
+	.byte	.LVU136
+	.long	.LLRL25
+	.value	0x18d
+	.byte	0x15
+	.long	0x10ac
+	.uleb128 0x3
+	.long	0x17dc
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x3
+	.long	0x17d0
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL36
+	.long	0xf70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x94
+	.byte	0x4
+	.byte	0x31
+	.byte	0x1c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x46
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x76
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LLRL28
+	.uleb128 0x10
+	.string	"i"
+	.value	0x198
+	.byte	0x13
+	.long	0x64
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x12f
+	.uleb128 0x14
+	.long	0x1b2
+	.uleb128 0x2b
+	.long	.LASF61
+	.value	0x14f
+	.long	0xb7
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1461
+	.uleb128 0x5
+	.long	.LASF42
+	.value	0x14f
+	.byte	0x20
+	.long	0x77
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x2c
+	.string	"end"
+	.value	0x14f
+	.byte	0x2f
+	.long	0x77
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x5
+	.long	.LASF62
+	.value	0x14f
+	.byte	0x39
+	.long	0xb7
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x5
+	.long	.LASF51
+	.value	0x14f
+	.byte	0x49
+	.long	0x77
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x5
+	.long	.LASF56
+	.value	0x14f
+	.byte	0x60
+	.long	0x114e
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x6
+	.long	.LASF63
+	.value	0x151
+	.byte	0xe
+	.long	0x77
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xa
+	.long	.LLRL36
+	.uleb128 0x6
+	.long	.LASF54
+	.value	0x154
+	.byte	0x12
+	.long	0x64
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x6
+	.long	.LASF58
+	.value	0x155
+	.byte	0x13
+	.long	0x12f
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x6
+	.long	.LASF41
+	.value	0x156
+	.byte	0x12
+	.long	0x77
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x6
+	.long	.LASF57
+	.value	0x157
+	.byte	0x12
+	.long	0x77
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x9
+	.long	0x1583
+	.quad	.LBI105
+	.byte	.LVU164
+	.long	.LLRL41
+	.value	0x155
+	.byte	0x1c
+	.long	0x12c3
+	.uleb128 0x3
+	.long	0x15ac
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x3
+	.long	0x15a0
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x3
+	.long	0x1594
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xa
+	.long	.LLRL41
+	.uleb128 0x2
+	.long	0x15b8
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x20
+	.long	0x15c4
+	.long	.LLRL41
+	.uleb128 0x2
+	.long	0x15c5
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x20
+	.long	0x15d1
+	.long	.LLRL47
+	.uleb128 0x2
+	.long	0x15d2
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x14e9
+	.quad	.LBI116
+	.byte	.LVU215
+	.long	.LLRL49
+	.value	0x15a
+	.byte	0x12
+	.long	0x1422
+	.uleb128 0x3
+	.long	0x1510
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x3
+	.long	0x1504
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x3
+	.long	0x14f8
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xa
+	.long	.LLRL49
+	.uleb128 0x2
+	.long	0x151c
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x2
+	.long	0x1529
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x2
+	.long	0x1536
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x2
+	.long	0x1543
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x2
+	.long	0x1550
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x2
+	.long	0x155d
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2
+	.long	0x156a
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x9
+	.long	0x15e1
+	.quad	.LBI118
+	.byte	.LVU217
+	.long	.LLRL60
+	.value	0x103
+	.byte	0x16
+	.long	0x13c9
+	.uleb128 0xa
+	.long	.LLRL60
+	.uleb128 0x2
+	.long	0x15f2
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x4
+	.quad	.LVL56
+	.long	0x1fc
+	.long	0x13ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL90
+	.long	0x217
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	0x1576
+	.quad	.LBB123
+	.quad	.LBE123-.LBB123
+	.long	0x13f0
+	.uleb128 0x2
+	.long	0x1577
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.uleb128 0x1f
+	.long	0x19a7
+	.quad	.LBI124
+	.byte	.LVU265
+	.quad	.LBB124
+	.quad	.LBE124-.LBB124
+	.byte	0x1
+	.value	0x122
+	.byte	0x5
+	.uleb128 0x3
+	.long	0x19b4
+	.long	.LLST63
+	.long	.LVUS63
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x17c3
+	.quad	.LBI131
+	.byte	.LVU294
+	.quad	.LBB131
+	.quad	.LBE131-.LBB131
+	.byte	0x1
+	.value	0x167
+	.byte	0xd
+	.uleb128 0x3
+	.long	0x17dc
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x3
+	.long	0x17d0
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF68
+	.value	0x128
+	.long	0xb7
+	.long	0x14e9
+	.uleb128 0x11
+	.long	.LASF42
+	.value	0x128
+	.byte	0x22
+	.long	0x77
+	.uleb128 0x11
+	.long	.LASF64
+	.value	0x128
+	.byte	0x31
+	.long	0x77
+	.uleb128 0x11
+	.long	.LASF51
+	.value	0x128
+	.byte	0x40
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF53
+	.byte	0x1
+	.value	0x12a
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x7
+	.long	.LASF63
+	.byte	0x1
+	.value	0x12b
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF66
+	.byte	0x1
+	.value	0x140
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x12
+	.uleb128 0x7
+	.long	.LASF54
+	.byte	0x1
+	.value	0x12d
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x12
+	.uleb128 0x7
+	.long	.LASF58
+	.byte	0x1
+	.value	0x12e
+	.byte	0x13
+	.long	0x12f
+	.uleb128 0x12
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x1
+	.value	0x131
+	.byte	0x16
+	.long	0x77
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF69
+	.value	0x101
+	.long	0xb7
+	.long	0x1583
+	.uleb128 0x11
+	.long	.LASF58
+	.value	0x101
+	.byte	0x20
+	.long	0x12f
+	.uleb128 0x11
+	.long	.LASF54
+	.value	0x101
+	.byte	0x31
+	.long	0x64
+	.uleb128 0x11
+	.long	.LASF42
+	.value	0x101
+	.byte	0x41
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF67
+	.byte	0x1
+	.value	0x103
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF70
+	.byte	0x1
+	.value	0x108
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF53
+	.byte	0x1
+	.value	0x109
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x7
+	.long	.LASF71
+	.byte	0x1
+	.value	0x10a
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF72
+	.byte	0x1
+	.value	0x10b
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x1
+	.value	0x10c
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x30
+	.string	"pat"
+	.value	0x10d
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x12
+	.uleb128 0x30
+	.string	"i"
+	.value	0x117
+	.byte	0x13
+	.long	0x77
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF73
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x12
+	.long	0x12f
+	.byte	0x1
+	.long	0x15e1
+	.uleb128 0xd
+	.long	.LASF42
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x24
+	.long	0x77
+	.uleb128 0xd
+	.long	.LASF74
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x34
+	.long	0xed
+	.uleb128 0xd
+	.long	.LASF63
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x45
+	.long	0x77
+	.uleb128 0x18
+	.long	.LASF53
+	.byte	0x1
+	.byte	0xea
+	.byte	0xf
+	.long	0x12f
+	.uleb128 0x12
+	.uleb128 0x18
+	.long	.LASF54
+	.byte	0x1
+	.byte	0xec
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x12
+	.uleb128 0x18
+	.long	.LASF58
+	.byte	0x1
+	.byte	0xed
+	.byte	0x13
+	.long	0x12f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF76
+	.byte	0x1
+	.byte	0xd7
+	.byte	0x11
+	.long	0x77
+	.byte	0x1
+	.long	0x15ff
+	.uleb128 0x18
+	.long	.LASF53
+	.byte	0x1
+	.byte	0xd9
+	.byte	0xb
+	.long	0xa4
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF77
+	.byte	0x1
+	.byte	0xc8
+	.byte	0x11
+	.long	0x77
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1648
+	.uleb128 0x31
+	.long	.LASF38
+	.byte	0xc8
+	.byte	0x24
+	.long	0x64
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xe
+	.long	.LASF51
+	.byte	0xca
+	.byte	0xe
+	.long	0x77
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF103
+	.byte	0x1
+	.byte	0xae
+	.byte	0xd
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17c3
+	.uleb128 0x48
+	.long	.LASF56
+	.byte	0x1
+	.byte	0xae
+	.byte	0x27
+	.long	0x114e
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2d
+	.long	.LLRL3
+	.long	0x177d
+	.uleb128 0x13
+	.string	"cr4"
+	.byte	0xb5
+	.byte	0x12
+	.long	0x77
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x21
+	.long	0x19f1
+	.quad	.LBI66
+	.byte	.LVU24
+	.quad	.LBB66
+	.quad	.LBE66-.LBB66
+	.byte	0xb5
+	.byte	0x18
+	.long	0x16c2
+	.uleb128 0x2
+	.long	0x1a02
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x21
+	.long	0x1a0d
+	.quad	.LBI68
+	.byte	.LVU32
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0xba
+	.byte	0xd
+	.long	0x16f4
+	.uleb128 0x2
+	.long	0x1a1e
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x21
+	.long	0x19d9
+	.quad	.LBI70
+	.byte	.LVU37
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0xba
+	.byte	0xd
+	.long	0x1726
+	.uleb128 0x3
+	.long	0x19e6
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.uleb128 0x49
+	.long	0x19c1
+	.quad	.LBI72
+	.byte	.LVU43
+	.long	.LLRL8
+	.byte	0x1
+	.byte	0xb7
+	.byte	0xd
+	.long	0x174d
+	.uleb128 0x3
+	.long	0x19ce
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x4a
+	.long	0x19c1
+	.quad	.LBI76
+	.byte	.LVU49
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.byte	0x1
+	.byte	0xb8
+	.byte	0xd
+	.uleb128 0x3
+	.long	0x19ce
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xbe
+	.byte	0x17
+	.long	0x64
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x32
+	.long	0x19a7
+	.quad	.LBI61
+	.byte	.LVU8
+	.long	.LLRL1
+	.byte	0xbf
+	.byte	0xd
+	.uleb128 0x3
+	.long	0x19b4
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF78
+	.byte	0x1
+	.byte	0xa0
+	.byte	0xd
+	.byte	0x1
+	.long	0x17e9
+	.uleb128 0xd
+	.long	.LASF56
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x2b
+	.long	0x114e
+	.uleb128 0xd
+	.long	.LASF42
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x3c
+	.long	0x77
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF79
+	.byte	0x1
+	.byte	0x56
+	.byte	0xa
+	.long	0x77
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1929
+	.uleb128 0x31
+	.long	.LASF37
+	.byte	0x56
+	.byte	0x23
+	.long	0x77
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x13
+	.string	"cr3"
+	.byte	0x60
+	.byte	0xe
+	.long	0x77
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xe
+	.long	.LASF80
+	.byte	0x66
+	.byte	0xe
+	.long	0x77
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0xe
+	.long	.LASF81
+	.byte	0x67
+	.byte	0xe
+	.long	0x77
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0xe
+	.long	.LASF33
+	.byte	0x68
+	.byte	0xf
+	.long	0x12f
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0xe
+	.long	.LASF82
+	.byte	0x6c
+	.byte	0xe
+	.long	0x77
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0xe
+	.long	.LASF83
+	.byte	0x74
+	.byte	0xf
+	.long	0x12f
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0xe
+	.long	.LASF84
+	.byte	0x77
+	.byte	0xe
+	.long	0x77
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x13
+	.string	"pd"
+	.byte	0x82
+	.byte	0xf
+	.long	0x12f
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x13
+	.string	"pde"
+	.byte	0x85
+	.byte	0xe
+	.long	0x77
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x13
+	.string	"pt"
+	.byte	0x90
+	.byte	0xf
+	.long	0x12f
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x13
+	.string	"pte"
+	.byte	0x93
+	.byte	0xe
+	.long	0x77
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0xe
+	.long	.LASF49
+	.byte	0x9c
+	.byte	0xe
+	.long	0x77
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x32
+	.long	0x1a0d
+	.quad	.LBI137
+	.byte	.LVU342
+	.long	.LLRL79
+	.byte	0x60
+	.byte	0x14
+	.uleb128 0xa
+	.long	.LLRL79
+	.uleb128 0x2
+	.long	0x1a1e
+	.long	.LLST80
+	.long	.LVUS80
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.string	"hcf"
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.uleb128 0x15
+	.long	.LASF85
+	.byte	0x3
+	.byte	0x22
+	.byte	0x14
+	.byte	0x3
+	.long	0x194c
+	.uleb128 0xd
+	.long	.LASF86
+	.byte	0x3
+	.byte	0x22
+	.byte	0x30
+	.long	0x194c
+	.byte	0
+	.uleb128 0x14
+	.long	0xe1
+	.uleb128 0x15
+	.long	.LASF87
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.long	0x196b
+	.uleb128 0xd
+	.long	.LASF86
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x194c
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF88
+	.byte	0x2
+	.value	0x106
+	.byte	0x13
+	.long	0x3c
+	.byte	0x3
+	.long	0x198b
+	.uleb128 0x7
+	.long	.LASF89
+	.byte	0x2
+	.value	0x109
+	.byte	0xe
+	.long	0x77
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF90
+	.byte	0x2
+	.byte	0xfa
+	.byte	0x18
+	.long	0x77
+	.byte	0x3
+	.long	0x19a7
+	.uleb128 0x1a
+	.string	"eax"
+	.byte	0xfc
+	.long	0x77
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF91
+	.byte	0x2
+	.byte	0xeb
+	.byte	0x14
+	.byte	0x3
+	.long	0x19c1
+	.uleb128 0xd
+	.long	.LASF37
+	.byte	0x2
+	.byte	0xeb
+	.byte	0x24
+	.long	0x77
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF92
+	.byte	0x2
+	.byte	0xe5
+	.byte	0x14
+	.byte	0x3
+	.long	0x19d9
+	.uleb128 0x33
+	.string	"val"
+	.byte	0xe5
+	.long	0x77
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF93
+	.byte	0x2
+	.byte	0xe0
+	.byte	0x14
+	.byte	0x3
+	.long	0x19f1
+	.uleb128 0x33
+	.string	"val"
+	.byte	0xe0
+	.long	0x77
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF94
+	.byte	0x2
+	.byte	0xd9
+	.byte	0x18
+	.long	0x77
+	.byte	0x3
+	.long	0x1a0d
+	.uleb128 0x1a
+	.string	"val"
+	.byte	0xdb
+	.long	0x77
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF95
+	.byte	0x2
+	.byte	0xd2
+	.byte	0x18
+	.long	0x77
+	.byte	0x3
+	.long	0x1a29
+	.uleb128 0x1a
+	.string	"val"
+	.byte	0xd4
+	.long	0x77
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF96
+	.byte	0x2
+	.byte	0xcb
+	.byte	0x18
+	.long	0x77
+	.byte	0x3
+	.long	0x1a45
+	.uleb128 0x1a
+	.string	"val"
+	.byte	0xcd
+	.long	0x77
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF97
+	.byte	0x2
+	.byte	0x94
+	.byte	0x18
+	.long	0x77
+	.byte	0x3
+	.uleb128 0xd
+	.long	.LASF98
+	.byte	0x2
+	.byte	0x94
+	.byte	0x2a
+	.long	0x64
+	.uleb128 0x1a
+	.string	"low"
+	.byte	0x96
+	.long	0x64
+	.uleb128 0x18
+	.long	.LASF99
+	.byte	0x2
+	.byte	0x96
+	.byte	0x13
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS134:
+	.uleb128 .LVU714
+	.uleb128 .LVU741
+	.uleb128 .LVU798
+	.uleb128 .LVU805
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU727
+	.uleb128 .LVU731
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU763
+	.uleb128 .LVU792
+	.uleb128 .LVU792
+	.uleb128 .LVU793
+	.uleb128 .LVU807
+	.uleb128 .LVU809
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL250-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU773
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 .LVU791
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 -4096
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU777
+	.uleb128 .LVU783
+	.uleb128 .LVU783
+	.uleb128 .LVU793
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU705
+	.uleb128 .LVU706
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU713
+	.uleb128 .LVU714
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU725
+	.uleb128 .LVU726
+	.uleb128 .LVU726
+	.uleb128 .LVU727
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x80000008
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU743
+	.uleb128 .LVU747
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0xc0000080
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU746
+	.uleb128 .LVU747
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU755
+	.uleb128 .LVU760
+	.uleb128 .LVU805
+	.uleb128 .LVU806
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU768
+	.uleb128 .LVU769
+.LLST146:
+	.byte	0x4
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 .LVL241-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU785
+	.uleb128 .LVU787
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS132:
+	.uleb128 0
+	.uleb128 .LVU679
+	.uleb128 .LVU679
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL218-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL218-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 0
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU679
+	.uleb128 .LVU679
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL218-1-.Ltext0
+	.uleb128 .LFE49-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 0
+	.uleb128 .LVU651
+	.uleb128 .LVU651
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS124:
+	.uleb128 0
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 .LVU659
+	.uleb128 .LVU659
+	.uleb128 .LVU660
+	.uleb128 .LVU660
+	.uleb128 .LVU672
+	.uleb128 .LVU672
+	.uleb128 0
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL210-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL210-1-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LFE48-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU639
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU672
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU641
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU672
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL211-1-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0xf
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU663
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU672
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL213-1-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU654
+	.uleb128 .LVU656
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	vm_lock
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU665
+	.uleb128 .LVU669
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	vm_lock
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 0
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL200-1-.Ltext0
+	.uleb128 .LFE47-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU588
+	.uleb128 .LVU588
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU626
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU588
+	.uleb128 .LVU588
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU605
+	.uleb128 .LVU605
+	.uleb128 .LVU626
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+	.uleb128 .LVU627
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU584
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU625
+	.uleb128 .LVU625
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU585
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU591
+	.uleb128 .LVU591
+	.uleb128 .LVU624
+	.uleb128 .LVU624
+	.uleb128 .LVU626
+	.uleb128 .LVU627
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0xf
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 0xf
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LFE46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU600
+	.uleb128 .LVU602
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	vm_lock
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU610
+	.uleb128 .LVU612
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	vm_lock
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU614
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 .LVU619
+	.uleb128 .LVU620
+	.uleb128 .LVU623
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU618
+	.uleb128 .LVU623
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 0
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU572
+	.uleb128 .LVU572
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 .LFE45-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU425
+	.uleb128 .LVU425
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU513
+	.uleb128 .LVU513
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU438
+	.uleb128 .LVU441
+	.uleb128 .LVU481
+	.uleb128 .LVU485
+	.uleb128 .LVU486
+	.uleb128 .LVU505
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU512
+	.uleb128 .LVU513
+	.uleb128 .LVU545
+	.uleb128 .LVU553
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x9
+	.byte	0x78
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 0
+	.uleb128 .LVU418
+	.uleb128 .LVU418
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU507
+	.uleb128 .LVU507
+	.uleb128 .LVU511
+	.uleb128 .LVU513
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 0
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 -4095
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0xb
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0xb
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 0
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 .LVU565
+	.uleb128 .LVU565
+	.uleb128 0
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL150-1-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL173-1-.Ltext0
+	.uleb128 .LFE44-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU421
+	.uleb128 .LVU426
+	.uleb128 .LVU426
+	.uleb128 .LVU431
+	.uleb128 .LVU431
+	.uleb128 .LVU505
+	.uleb128 .LVU513
+	.uleb128 .LVU562
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL125-1-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x23
+	.uleb128 0xfff
+	.byte	0xb
+	.value	0xf000
+	.byte	0x1a
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU428
+	.uleb128 .LVU431
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU429
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU505
+	.uleb128 .LVU513
+	.uleb128 .LVU562
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 -4096
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU490
+	.uleb128 .LVU505
+	.uleb128 .LVU545
+	.uleb128 .LVU553
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU431
+	.uleb128 .LVU433
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	vm_lock
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU443
+	.uleb128 .LVU483
+	.uleb128 .LVU513
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+	.uleb128 .LVU561
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU443
+	.uleb128 .LVU481
+	.uleb128 .LVU513
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+	.uleb128 .LVU561
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU443
+	.uleb128 .LVU480
+	.uleb128 .LVU480
+	.uleb128 .LVU483
+	.uleb128 .LVU513
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+	.uleb128 .LVU561
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 -4096
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU445
+	.uleb128 .LVU456
+	.uleb128 .LVU468
+	.uleb128 .LVU475
+	.uleb128 .LVU537
+	.uleb128 .LVU540
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU446
+	.uleb128 .LVU483
+	.uleb128 .LVU513
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+	.uleb128 .LVU561
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -344
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -344
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -344
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU475
+	.uleb128 .LVU483
+	.uleb128 .LVU540
+	.uleb128 .LVU542
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU448
+	.uleb128 .LVU449
+	.uleb128 .LVU449
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 .LVU483
+	.uleb128 .LVU513
+	.uleb128 .LVU533
+	.uleb128 .LVU539
+	.uleb128 .LVU540
+	.uleb128 .LVU540
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+	.uleb128 .LVU561
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU454
+	.uleb128 .LVU462
+	.uleb128 .LVU513
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU540
+	.uleb128 .LVU553
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU560
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL153-1-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL170-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU526
+	.uleb128 .LVU529
+	.uleb128 .LVU556
+	.uleb128 .LVU558
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU518
+	.uleb128 .LVU523
+	.uleb128 .LVU553
+	.uleb128 .LVU555
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	vm_lock
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU497
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU501
+	.uleb128 .LVU505
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU102
+	.uleb128 .LVU113
+	.uleb128 .LVU144
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LFE42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU102
+	.uleb128 .LVU113
+	.uleb128 .LVU144
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU92
+	.uleb128 .LVU101
+	.uleb128 .LVU113
+	.uleb128 .LVU144
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU93
+	.uleb128 .LVU101
+	.uleb128 .LVU113
+	.uleb128 .LVU144
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU144
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU136
+	.uleb128 .LVU144
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU136
+	.uleb128 .LVU144
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU103
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+	.uleb128 .LVU144
+	.uleb128 .LVU147
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU306
+	.uleb128 .LVU307
+	.uleb128 .LVU339
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -93
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU337
+	.uleb128 .LVU337
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x14
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x91
+	.sleb128 -93
+	.byte	0x94
+	.byte	0x1
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x15
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x91
+	.sleb128 -93
+	.byte	0x94
+	.byte	0x1
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU176
+	.uleb128 .LVU179
+	.uleb128 .LVU197
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 0
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE41-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU203
+	.uleb128 .LVU271
+	.uleb128 .LVU276
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU338
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU206
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU271
+	.uleb128 .LVU278
+	.uleb128 .LVU283
+	.uleb128 .LVU309
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU321
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU336
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x5
+	.byte	0x40
+	.byte	0x8
+	.byte	0x23
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x4
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU210
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU271
+	.uleb128 .LVU282
+	.uleb128 .LVU307
+	.uleb128 .LVU313
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU326
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU336
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-1-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU164
+	.uleb128 .LVU203
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU164
+	.uleb128 .LVU203
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+4593
+	.sleb128 0
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU164
+	.uleb128 .LVU203
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU166
+	.uleb128 .LVU179
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pKernelPml4
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pKernelPml4
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU168
+	.uleb128 .LVU179
+	.uleb128 .LVU191
+	.uleb128 .LVU203
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU175
+	.uleb128 .LVU179
+	.uleb128 .LVU196
+	.uleb128 .LVU203
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU215
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU215
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU215
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU230
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU330
+	.uleb128 .LVU332
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU233
+	.uleb128 .LVU261
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU234
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU237
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0xb
+	.byte	0x31
+	.byte	0x72
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0xb
+	.byte	0x31
+	.byte	0x72
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU241
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU242
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU271
+	.uleb128 .LVU314
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU319
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0x11
+	.sleb128 -4503599627366401
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0x11
+	.sleb128 -4503599627366401
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0x11
+	.sleb128 -4503599627366529
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU244
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU261
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x9
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa
+	.value	0x1000
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU222
+	.uleb128 .LVU227
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 .LVU329
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU251
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU271
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU265
+	.uleb128 .LVU267
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU294
+	.uleb128 .LVU302
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU294
+	.uleb128 .LVU302
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE36-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU28
+	.uleb128 .LVU35
+	.uleb128 .LVU42
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU27
+	.uleb128 .LVU28
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU35
+	.uleb128 .LVU36
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU36
+	.uleb128 .LVU39
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU43
+	.uleb128 .LVU47
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0xb
+	.value	0xff7f
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE35-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU7
+	.uleb128 .LVU20
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU8
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU398
+	.uleb128 .LVU398
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU348
+	.uleb128 .LVU359
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU355
+	.uleb128 .LVU397
+	.uleb128 .LVU397
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x15
+	.byte	0x31
+	.byte	0x3
+	.quad	maxphyaddr
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LFE33-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU356
+	.uleb128 .LVU359
+	.uleb128 .LVU359
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU357
+	.uleb128 .LVU359
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU363
+	.uleb128 .LVU369
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU366
+	.uleb128 .LVU369
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU371
+	.uleb128 .LVU376
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU378
+	.uleb128 .LVU383
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU381
+	.uleb128 .LVU387
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU389
+	.uleb128 .LVU394
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU392
+	.uleb128 .LVU400
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU399
+	.uleb128 .LVU400
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU347
+	.uleb128 .LVU348
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB61-.Ltext0
+	.uleb128 .LBE61-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB64-.Ltext0
+	.uleb128 .LBE64-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB72-.Ltext0
+	.uleb128 .LBE72-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB79-.Ltext0
+	.uleb128 .LBE79-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB89-.Ltext0
+	.uleb128 .LBE89-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB80-.Ltext0
+	.uleb128 .LBE80-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB86-.Ltext0
+	.uleb128 .LBE86-.Ltext0
+	.byte	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB85-.Ltext0
+	.uleb128 .LBE85-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB104-.Ltext0
+	.uleb128 .LBE104-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB135-.Ltext0
+	.uleb128 .LBE135-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB136-.Ltext0
+	.uleb128 .LBE136-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB115-.Ltext0
+	.uleb128 .LBE115-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB109-.Ltext0
+	.uleb128 .LBE109-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB112-.Ltext0
+	.uleb128 .LBE112-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB116-.Ltext0
+	.uleb128 .LBE116-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB130-.Ltext0
+	.uleb128 .LBE130-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB133-.Ltext0
+	.uleb128 .LBE133-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB134-.Ltext0
+	.uleb128 .LBE134-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB118-.Ltext0
+	.uleb128 .LBE118-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB126-.Ltext0
+	.uleb128 .LBE126-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB137-.Ltext0
+	.uleb128 .LBE137-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB140-.Ltext0
+	.uleb128 .LBE140-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB188-.Ltext0
+	.uleb128 .LBE188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB194-.Ltext0
+	.uleb128 .LBE194-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0
+.LLRL98:
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB174-.Ltext0
+	.uleb128 .LBE174-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB175-.Ltext0
+	.uleb128 .LBE175-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB164-.Ltext0
+	.uleb128 .LBE164-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB165-.Ltext0
+	.uleb128 .LBE165-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0
+.LLRL116:
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0
+.LLRL128:
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0
+.LLRL130:
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB224-.Ltext0
+	.uleb128 .LBE224-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB244-.Ltext0
+	.uleb128 .LBE244-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB265-.Ltext0
+	.uleb128 .LBE265-.Ltext0
+	.byte	0
+.LLRL144:
+	.byte	0x4
+	.uleb128 .LBB255-.Ltext0
+	.uleb128 .LBE255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB259-.Ltext0
+	.uleb128 .LBE259-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF66:
+	.string	"pPte"
+.LASF24:
+	.string	"vm_table_pages"
+.LASF47:
+	.string	"pFree"
+.LASF75:
+	.string	"_vm_free_tables"
+.LASF12:
+	.string	"size_t"
+.LASF83:
+	.string	"pdpt"
+.LASF42:
+	.string	"virt"
+.LASF78:
+	.string	"_vm_flush_add"
+.LASF10:
+	.string	"uint64_t"
+.LASF84:
+	.string	"pdpte"
+.LASF65:
+	.string	"pNext"
+.LASF30:
+	.string	"pages"
+.LASF68:
+	.string	"_vm_map_page"
+.LASF44:
+	.string	"done"
+.LASF70:
+	.string	"entry"
+.LASF102:
+	.string	"kalloc_zone"
+.LASF57:
+	.string	"next"
+.LASF53:
+	.string	"pTable"
+.LASF34:
+	.string	"pBootPml4"
+.LASF13:
+	.string	"long long int"
+.LASF2:
+	.string	"signed char"
+.LASF91:
+	.string	"invlpg"
+.LASF63:
+	.string	"parent"
+.LASF4:
+	.string	"long int"
+.LASF81:
+	.string	"pml4addr"
+.LASF17:
+	.string	"spinlock_t"
+.LASF98:
+	.string	"msr_id"
+.LASF40:
+	.string	"vm_protect_range"
+.LASF73:
+	.string	"_vm_find"
+.LASF31:
+	.string	"kfree"
+.LASF29:
+	.string	"count"
+.LASF36:
+	.string	"vm_report"
+.LASF96:
+	.string	"get_cr0"
+.LASF95:
+	.string	"get_cr3"
+.LASF94:
+	.string	"get_cr4"
+.LASF39:
+	.string	"vm_protect"
+.LASF100:
+	.string	"GNU C11 12.2.0 -m64 -march=x86-64 -mno-80387 -mno-mmx -mno-sse -mno-sse2 -mno-red-zone -g -g -ggdb -O2 -std=gnu11 -ffreestanding -fno-stack-protector -fstack-check=no -fno-lto -fPIE -fasynchronous-unwind-tables"
+.LASF9:
+	.string	"unsigned int"
+.LASF11:
+	.string	"long unsigned int"
+.LASF82:
+	.string	"pml4e"
+.LASF50:
+	.string	"vm_map_range"
+.LASF54:
+	.string	"level"
+.LASF41:
+	.string	"size"
+.LASF6:
+	.string	"short unsigned int"
+.LASF76:
+	.string	"_vm_alloc_table"
+.LASF59:
+	.string	"pChild"
+.LASF18:
+	.string	"vmm_higher_half_offset"
+.LASF21:
+	.string	"pKernelPml4"
+.LASF25:
+	.string	"vm_split_pages"
+.LASF101:
+	.string	"VmFlush"
+.LASF62:
+	.string	"unmap"
+.LASF61:
+	.string	"_vm_update"
+.LASF72:
+	.string	"base"
+.LASF64:
+	.string	"phys"
+.LASF14:
+	.string	"long double"
+.LASF52:
+	.string	"mapped"
+.LASF35:
+	.string	"vm_init"
+.LASF88:
+	.string	"is_paging_enabled"
+.LASF97:
+	.string	"read_msr"
+.LASF89:
+	.string	"bitmask"
+.LASF22:
+	.string	"vm_lock"
+.LASF46:
+	.string	"vm_unmap_range"
+.LASF56:
+	.string	"pFlush"
+.LASF23:
+	.string	"nx_enabled"
+.LASF16:
+	.string	"_Bool"
+.LASF5:
+	.string	"unsigned char"
+.LASF86:
+	.string	"pLock"
+.LASF71:
+	.string	"step"
+.LASF80:
+	.string	"addrmask"
+.LASF3:
+	.string	"short int"
+.LASF67:
+	.string	"table"
+.LASF87:
+	.string	"spinlock_lock"
+.LASF19:
+	.string	"maxphyaddr"
+.LASF79:
+	.string	"walk_page_table"
+.LASF49:
+	.string	"phys_addr"
+.LASF85:
+	.string	"spinlock_unlock"
+.LASF8:
+	.string	"uint32_t"
+.LASF26:
+	.string	"vm_invlpgs"
+.LASF33:
+	.string	"pml4"
+.LASF15:
+	.string	"char"
+.LASF93:
+	.string	"set_cr3"
+.LASF92:
+	.string	"set_cr4"
+.LASF74:
+	.string	"pLevel"
+.LASF90:
+	.string	"cpu_get_address_widths"
+.LASF99:
+	.string	"high"
+.LASF37:
+	.string	"virt_addr"
+.LASF20:
+	.string	"maxlinaddr"
+.LASF58:
+	.string	"pEntry"
+.LASF60:
+	.string	"_vm_prune"
+.LASF43:
+	.string	"flush"
+.LASF45:
+	.string	"vm_unmap"
+.LASF103:
+	.string	"_vm_flush"
+.LASF55:
+	.string	"ppFree"
+.LASF7:
+	.string	"uint8_t"
+.LASF51:
+	.string	"attrs"
+.LASF38:
+	.string	"flags"
+.LASF32:
+	.string	"kprintf"
+.LASF77:
+	.string	"_vm_attrs"
+.LASF69:
+	.string	"_vm_split"
+.LASF27:
+	.string	"vm_full_flushes"
+.LASF28:
+	.string	"lock"
+.LASF48:
+	.string	"vm_map"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/vm.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
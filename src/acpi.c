@@ -32,10 +32,17 @@
 #define ICS_ID_IO_APIC 1
 #define ICS_ID_ISO 2
 
+// Static Resource Affinity Structure Types
+#define SRAT_ID_LAPIC 0
+#define SRAT_ID_MEM 1
+#define SRAT_ID_X2APIC 2
+
 // Signature strings
 #define SDT_APIC_SIG    "APIC"
 #define SDT_APIC_HPET   "HPET"
 #define SDT_APIC_MCFG   "MCFG"
+#define SDT_APIC_SRAT   "SRAT"
+#define SDT_APIC_SLIT   "SLIT"
 
 struct limine_rsdp_request rsdp_request = {
     .id = LIMINE_RSDP_REQUEST,
@@ -95,6 +102,7 @@ struct xsdt *xsdt = NULL;
 struct madt *pMadt = NULL;
 struct hpet *hpet = NULL;
 struct mcfg_entry *mcfg = NULL;
+struct slit *slit = NULL;
 uint32_t entry_size;
 
 /*
@@ -102,6 +110,16 @@ uint32_t entry_size;
 */
 struct ioapic *ioapic_list[IOAPIC_LIST_LEN] = {0};
 struct iso *iso_list[ISO_LIST_LEN] = {0};
+struct srat_mem_affinity *srat_mem_list[SRAT_MEM_LIST_LEN] = {0};
+struct numa_cpu numa_cpu_list[SRAT_CPU_LIST_LEN] = {0};
+uint32_t numa_cpu_count = 0;
+
+/*
+ * NUMA nodes are numbered densely from 0 in the order we find their proximity domains,
+ * as the domain numbers themselves can be anything.
+*/
+uint32_t numa_domains[NUMA_MAX_NODES] = {0};
+uint32_t numa_node_count = 0;
 
 void add_ioapic(struct ioapic *pIOApic)
 {
@@ -124,6 +142,121 @@ void add_iso(struct iso *pIso)
     }
 }
 
+/*
+ * Returns the NUMA node for a proximity domain, giving it the next node number if we haven't seen it.
+ * Domains past NUMA_MAX_NODES are folded in to node 0.
+*/
+uint32_t acpi_numa_node(uint32_t proximity_domain)
+{
+    for (uint32_t i = 0; i < numa_node_count; i++) {
+        if (numa_domains[i] == proximity_domain) {
+            return i;
+        }
+    }
+
+    if (numa_node_count == NUMA_MAX_NODES) {
+        kprintf("NUMA: Too many proximity domains, domain %d is using node 0.\n", proximity_domain);
+        return 0;
+    }
+
+    numa_domains[numa_node_count] = proximity_domain;
+    return numa_node_count++;
+}
+
+/*
+ * Returns the NUMA node of the CPU with the specified APIC ID, or node 0 if the SRAT didn't list it.
+*/
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id)
+{
+    for (uint32_t i = 0; i < numa_cpu_count; i++) {
+        if (numa_cpu_list[i].apic_id == apic_id) {
+            return numa_cpu_list[i].node;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Returns the relative distance between two NUMA nodes from the SLIT, where 10 is local.
+ * Without a SLIT, every other node is assumed to be twice as far.
+*/
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node)
+{
+    if (from_node == to_node) {
+        return NUMA_LOCAL_DISTANCE;
+    }
+
+    if (slit == NULL ||
+        numa_domains[from_node] >= slit->num_localities ||
+        numa_domains[to_node] >= slit->num_localities) {
+        return NUMA_REMOTE_DISTANCE;
+    }
+
+    return slit->entries[numa_domains[from_node] * slit->num_localities + numa_domains[to_node]];
+}
+
+void add_numa_cpu(uint32_t apic_id, uint32_t proximity_domain)
+{
+    if (numa_cpu_count == SRAT_CPU_LIST_LEN) {
+        return;
+    }
+
+    numa_cpu_list[numa_cpu_count].apic_id = apic_id;
+    numa_cpu_list[numa_cpu_count].node = acpi_numa_node(proximity_domain);
+    numa_cpu_count++;
+}
+
+void add_numa_mem(struct srat_mem_affinity *pMem)
+{
+    for (int i = 0; i < SRAT_MEM_LIST_LEN; i++) {
+        if (srat_mem_list[i] == NULL) {
+            srat_mem_list[i] = pMem;
+            kprintf("NUMA: Memory 0x%X - 0x%X in node %d\n", pMem->base, pMem->base + pMem->range_length, acpi_numa_node(pMem->proximity_domain));
+            return;
+        }
+    }
+}
+
+/*
+ * Walks the System Resource Affinity Table, recording which NUMA node each CPU and memory range belongs to.
+*/
+void _parse_srat(struct sysdesc *desc)
+{
+    // The affinity structures start after the header and 12 reserved bytes.
+    char *pItem = (char*)desc + sizeof(struct sysdesc) + 12;
+    char *pEnd = (char*)desc + desc->length;
+
+    while (pItem < pEnd && pItem[1] > 0) {
+        if (*pItem == SRAT_ID_LAPIC) {
+            struct srat_lapic_affinity *pCpu = (struct srat_lapic_affinity*)pItem;
+
+            if (pCpu->flags & 1) {
+                uint32_t domain = pCpu->proximity_domain_low |
+                    (uint32_t)pCpu->proximity_domain_high[0] << 8 |
+                    (uint32_t)pCpu->proximity_domain_high[1] << 16 |
+                    (uint32_t)pCpu->proximity_domain_high[2] << 24;
+
+                add_numa_cpu(pCpu->apic_id, domain);
+            }
+        } else if (*pItem == SRAT_ID_X2APIC) {
+            struct srat_x2apic_affinity *pCpu = (struct srat_x2apic_affinity*)pItem;
+
+            if (pCpu->flags & 1) {
+                add_numa_cpu(pCpu->x2apic_id, pCpu->proximity_domain);
+            }
+        } else if (*pItem == SRAT_ID_MEM) {
+            struct srat_mem_affinity *pMem = (struct srat_mem_affinity*)pItem;
+
+            if (pMem->flags & 1) {
+                add_numa_mem(pMem);
+            }
+        }
+
+        pItem += (uint8_t)pItem[1];
+    }
+}
+
 void _parse_madt(struct sysdesc *desc)
 {
     // Found the APIC entry. Parse this MADT structure to find the I/O APIC address.
@@ -215,6 +348,17 @@ void acpi_init()
             continue;
         }
 
+        if (memcmp(desc->signature, SDT_APIC_SRAT, 4) == 0) {
+            _parse_srat(desc);
+            continue;
+        }
+
+        if (memcmp(desc->signature, SDT_APIC_SLIT, 4) == 0) {
+            slit = (struct slit*)desc;
+            kprintf("NUMA: SLIT with %lu localities.\n", slit->num_localities);
+            continue;
+        }
+
         if (memcmp(desc->signature, SDT_APIC_MCFG, 4) == 0) {
             mcfg = (struct mcfg_entry*)desc;
             kprintf("BAR: 0x%X\n", mcfg->mmio_base);
@@ -226,6 +370,13 @@ void acpi_init()
         kprintf("Found ACPI Table: %c%c%c%c\n", desc->signature[0], desc->signature[1], desc->signature[2], desc->signature[3]);
     }
 
+    if (numa_node_count == 0) {
+        // No SRAT, everything is in the one node.
+        numa_node_count = 1;
+    }
+
+    kprintf("NUMA Nodes: %d\n", numa_node_count);
+
     if (!mcfg) {
         kprintf("MCFG table not found - MMIO support for PCI not found - quitting.\n");
         hcf();
@@ -18,29 +18,660 @@
 #include <alloc.h>
 #include <bump.h>
 #include <slob.h>
+#include <slab.h>
 #include <str.h>
+#include <mem.h>
+#include <cpu.h>
+#include <atomic.h>
+#include <serial.h>
+#include <math.h>
+#include <string.h>
 
 #ifdef ALLOC_USESLOB
-void *malloc(size_t size)
+static inline void *_heap_malloc(size_t size)
 {
     return slob_malloc(size);
 }
 
-void free(void *ptr)
+static inline void _heap_free(void *ptr)
 {
     slob_free(ptr);
 }
+
+static inline size_t _heap_usable_size(void *ptr)
+{
+    return slob_usable_size(ptr);
+}
+
+static inline bool _heap_grow_in_place(void *ptr, size_t size)
+{
+    return slob_grow_in_place(ptr, size);
+}
+
+static inline void *_heap_zalloc(size_t size)
+{
+    void *ptr = slob_malloc(size);
+    if (ptr != NULL) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+static inline void *_heap_aligned_alloc(size_t alignment, size_t size)
+{
+    // Allocations sit 8 bytes after a block boundary, so that's all slob can promise.
+    if (alignment > 8) {
+        kprintf("Alignment of %lu isn't supported by the slob heap.\n", alignment);
+        return NULL;
+    }
+    return slob_malloc(size);
+}
 #endif
 
 #ifdef ALLOC_USEBUMP
-void *malloc(size_t size)
+static inline void *_heap_malloc(size_t size)
 {
     return bump_malloc(size);
 }
 
-void free(void *ptr)
+static inline void _heap_free(void *ptr)
 {
     bump_free(ptr);
 }
+
+static inline size_t _heap_usable_size(void *ptr)
+{
+    // Nothing is ever freed, so there's no size to give back.
+    (void)ptr;
+    return 0;
+}
+
+static inline bool _heap_grow_in_place(void *ptr, size_t size)
+{
+    (void)ptr;
+    (void)size;
+    return false;
+}
+
+static inline void *_heap_zalloc(size_t size)
+{
+    void *ptr = bump_malloc(size);
+    if (ptr != NULL) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+static inline void *_heap_aligned_alloc(size_t alignment, size_t size)
+{
+    if (alignment > ARENA_ALIGN) {
+        kprintf("Alignment of %lu isn't supported by the bump heap.\n", alignment);
+        return NULL;
+    }
+    return bump_malloc(size);
+}
 #endif
 
+#ifdef ALLOC_USESLAB
+/*
+    Per-CPU caches in front of the slab allocator.
+
+    Each CPU keeps a small stack of free objects for every size class. Allocations pop from it
+    and frees push on to it with interrupts disabled and no lock taken; the slab allocator's
+    class lock is only taken to refill or flush a stack, ALLOC_CPU_CACHE_BATCH objects at a time.
+
+    The slabs an object comes from are owned by the CPU that last took a batch from them. An object
+    freed on another CPU is held in that CPU's remote buffer, and once ALLOC_REMOTE_BATCH of them
+    have gathered they are handed back to their owners, a list per owner and size class pushed on to
+    the owner's inbox with a single compare and swap. A CPU empties its inbox in to its own stack
+    before going to the slab allocator.
+*/
+struct CpuClassCache {
+    uint32_t            count;
+    void               *objects[ALLOC_CPU_CACHE_SIZE];
+};
+
+struct CpuCache {
+    struct CpuClassCache classes[SLAB_NUM_CLASSES];
+    uint32_t            remote_count;
+    void               *remote[ALLOC_REMOTE_BATCH];
+} __attribute__((aligned(64)));
+
+static struct CpuCache cpu_caches[MAX_CPUS];
+
+/* Objects freed by other CPUs, waiting for their owner. Each is a list threaded through the objects. */
+static void *remote_inbox[MAX_CPUS][SLAB_NUM_CLASSES];
+
+/*
+ * Frees the oldest 'count' objects of a CPU's stack back to the slab allocator.
+*/
+static void _cpu_cache_flush(struct CpuClassCache *pCache, uint32_t count)
+{
+    slab_free_batch(pCache->objects, count);
+
+    pCache->count -= count;
+    memmove(pCache->objects, pCache->objects + count, pCache->count * sizeof(void*));
+}
+
+/*
+ * Refills an empty stack, first from what other CPUs have handed back to this one and then
+ * with a batch from the slab allocator.
+*/
+static void _cpu_cache_refill(uint32_t cpu, int class, struct CpuClassCache *pCache)
+{
+    void *pList = __atomic_exchange_n(&remote_inbox[cpu][class], NULL, __ATOMIC_ACQUIRE);
+
+    while (pList != NULL) {
+        void *pNext = *(void**)pList;
+
+        if (pCache->count == ALLOC_CPU_CACHE_SIZE) {
+            _cpu_cache_flush(pCache, ALLOC_CPU_CACHE_BATCH);
+        }
+
+        pCache->objects[pCache->count++] = pList;
+        pList = pNext;
+    }
+
+    if (pCache->count == 0) {
+        pCache->count = slab_alloc_batch(class, pCache->objects, ALLOC_CPU_CACHE_BATCH, cpu);
+    }
+}
+
+/*
+ * Hands the objects in a CPU's remote buffer back to the CPUs that own them. Objects with the
+ * same owner and size class are linked together and pushed on to the owner's inbox in one go.
+*/
+static void _cpu_cache_flush_remote(struct CpuCache *pCpuCache)
+{
+    for (uint32_t i = 0; i < pCpuCache->remote_count; i++) {
+        void *pFirst = pCpuCache->remote[i];
+        if (pFirst == NULL) {
+            continue;
+        }
+
+        uint32_t owner;
+        int class = slab_object_class(pFirst, &owner);
+        void *pLast = pFirst;
+
+        for (uint32_t j = i + 1; j < pCpuCache->remote_count; j++) {
+            void *ptr = pCpuCache->remote[j];
+            uint32_t other_owner;
+
+            if (ptr != NULL && slab_object_class(ptr, &other_owner) == class && other_owner == owner) {
+                *(void**)pLast = ptr;
+                pLast = ptr;
+                pCpuCache->remote[j] = NULL;
+            }
+        }
+
+        void **ppInbox = &remote_inbox[owner][class];
+        void *pHead = __atomic_load_n(ppInbox, __ATOMIC_RELAXED);
+
+        do {
+            *(void**)pLast = pHead;
+        } while (!__atomic_compare_exchange_n(ppInbox, &pHead, pFirst, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    }
+
+    pCpuCache->remote_count = 0;
+}
+
+static void *_heap_malloc(size_t size)
+{
+    int class = slab_size_class(size);
+    if (class < 0) {
+        return slab_malloc(size);
+    }
+
+    bool istate = set_interrupt_state(false);
+
+    uint32_t cpu = cpu_index();
+    struct CpuClassCache *pCache = &cpu_caches[cpu].classes[class];
+
+    if (pCache->count == 0) {
+        _cpu_cache_refill(cpu, class, pCache);
+    }
+
+    void *ptr = NULL;
+    if (pCache->count > 0) {
+        ptr = pCache->objects[--pCache->count];
+    }
+
+    set_interrupt_state(istate);
+
+    if (ptr == NULL) {
+        kprintf("Allocation of %lu bytes failed.\n", size);
+    }
+
+    return ptr;
+}
+
+static void _heap_free(void *ptr)
+{
+    uint32_t owner;
+    int class = slab_object_class(ptr, &owner);
+    if (class < 0) {
+        slab_free(ptr);
+        return;
+    }
+
+    bool istate = set_interrupt_state(false);
+
+    uint32_t cpu = cpu_index();
+    struct CpuCache *pCpuCache = &cpu_caches[cpu];
+
+    if (owner == cpu) {
+        struct CpuClassCache *pCache = &pCpuCache->classes[class];
+
+        if (pCache->count == ALLOC_CPU_CACHE_SIZE) {
+            _cpu_cache_flush(pCache, ALLOC_CPU_CACHE_BATCH);
+        }
+
+        pCache->objects[pCache->count++] = ptr;
+    } else {
+        pCpuCache->remote[pCpuCache->remote_count++] = ptr;
+
+        if (pCpuCache->remote_count == ALLOC_REMOTE_BATCH) {
+            _cpu_cache_flush_remote(pCpuCache);
+        }
+    }
+
+    set_interrupt_state(istate);
+}
+
+static inline size_t _heap_usable_size(void *ptr)
+{
+    return slab_usable_size(ptr);
+}
+
+static inline bool _heap_grow_in_place(void *ptr, size_t size)
+{
+    // A slot or run of pages can't grow past its usable size.
+    (void)ptr;
+    (void)size;
+    return false;
+}
+
+/*
+ * Allocates zeroed memory. Allocations too big for a size class come from the PMM's zero
+ * pool when they can, as those pages have already been cleared.
+*/
+static void *_heap_zalloc(size_t size)
+{
+    if (size > SLAB_MAX_SIZE) {
+        return kalloc_zone(size, KALLOC_ZERO);
+    }
+
+    void *ptr = _heap_malloc(size);
+    if (ptr != NULL) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+/*
+ * Allocates memory aligned to 'alignment'. Power of two size classes are aligned to their size,
+ * so a request is rounded up to the class that is big enough for both. Bigger alignments come
+ * from the PMM, which gives page aligned memory, or huge page aligned memory for more than that.
+*/
+static void *_heap_aligned_alloc(size_t alignment, size_t size)
+{
+    if (alignment <= 16) {
+        return _heap_malloc(size);
+    }
+
+    size_t class_size = 1ULL << (64 - __builtin_clzl(MAX(size, alignment) - 1));
+
+    if (class_size <= SLAB_MAX_SIZE) {
+        return _heap_malloc(class_size);
+    }
+
+    if (alignment <= PAGE_SIZE) {
+        return kalloc(size);
+    }
+
+    return kalloc_huge(size, __builtin_ctzl(alignment / PAGE_SIZE));
+}
+
+/*
+    Gives everything cached on this CPU back: remote frees go to their owners, and the stacks and
+    inbox of every size class are freed to the slab allocator so empty slabs can return to the PMM.
+*/
+void alloc_cpu_cache_drain()
+{
+    bool istate = set_interrupt_state(false);
+
+    uint32_t cpu = cpu_index();
+    struct CpuCache *pCpuCache = &cpu_caches[cpu];
+
+    _cpu_cache_flush_remote(pCpuCache);
+
+    for (int class = 0; class < SLAB_NUM_CLASSES; class++) {
+        struct CpuClassCache *pCache = &pCpuCache->classes[class];
+
+        _cpu_cache_flush(pCache, pCache->count);
+
+        void *pList = __atomic_exchange_n(&remote_inbox[cpu][class], NULL, __ATOMIC_ACQUIRE);
+        while (pList != NULL) {
+            void *pNext = *(void**)pList;
+            slab_free(pList);
+            pList = pNext;
+        }
+    }
+
+    set_interrupt_state(istate);
+}
+#endif
+
+#ifdef ALLOC_PROFILE
+/*
+    Heap profiling.
+
+    Every malloc() is counted in a histogram of request sizes, bucket i holding sizes from
+    2^(i-1) up to 2^i - 1, and against the call site it came from, found from the return
+    address. Live bytes count what the heap really handed out, the usable size, so they go
+    back down by the same amount on free().
+*/
+struct AllocSite {
+    void               *pCaller;
+    uint64_t            allocs;
+    uint64_t            bytes;
+};
+
+static spinlock_t profile_lock;
+static uint64_t profile_allocs;
+static uint64_t profile_frees;
+static uint64_t profile_failures;
+static uint64_t profile_total_bytes;
+static uint64_t profile_live_bytes;
+static uint64_t profile_peak_bytes;
+static uint64_t profile_sites_dropped;     // Allocations from call sites that didn't fit in the table.
+static uint64_t profile_sizes[ALLOC_PROFILE_BUCKETS];
+static struct AllocSite profile_sites[ALLOC_PROFILE_SITES];
+
+/*
+ * Records an allocation of 'size' bytes made from 'pCaller'.
+*/
+static void _profile_alloc(size_t size, void *ptr, void *pCaller)
+{
+    int bucket = size ? 64 - __builtin_clzl(size) : 0;
+    bucket = MIN(bucket, ALLOC_PROFILE_BUCKETS - 1);
+
+    size_t usable = ptr ? _heap_usable_size(ptr) : 0;
+
+    bool istate = set_interrupt_state(false);
+    spinlock_lock(&profile_lock);
+
+    if (ptr == NULL) {
+        profile_failures++;
+    } else {
+        profile_allocs++;
+        profile_total_bytes += size;
+        profile_live_bytes += usable;
+        profile_peak_bytes = MAX(profile_peak_bytes, profile_live_bytes);
+    }
+
+    profile_sizes[bucket]++;
+
+    // Open addressing on the return address, the table never shrinks.
+    uint64_t slot = ((uint64_t)pCaller * 0x9E3779B97F4A7C15ULL) >> 32;
+    uint32_t i;
+
+    for (i = 0; i < ALLOC_PROFILE_SITES; i++) {
+        struct AllocSite *pSite = &profile_sites[(slot + i) % ALLOC_PROFILE_SITES];
+
+        if (pSite->pCaller == NULL) {
+            pSite->pCaller = pCaller;
+        }
+
+        if (pSite->pCaller == pCaller) {
+            pSite->allocs++;
+            pSite->bytes += size;
+            break;
+        }
+    }
+
+    if (i == ALLOC_PROFILE_SITES) {
+        profile_sites_dropped++;
+    }
+
+    spinlock_unlock(&profile_lock);
+    set_interrupt_state(istate);
+}
+
+/*
+ * Records a free of the allocation at 'ptr'.
+*/
+static void _profile_free(void *ptr)
+{
+    size_t usable = _heap_usable_size(ptr);
+
+    bool istate = set_interrupt_state(false);
+    spinlock_lock(&profile_lock);
+
+    profile_frees++;
+    profile_live_bytes -= MIN(usable, profile_live_bytes);
+
+    spinlock_unlock(&profile_lock);
+    set_interrupt_state(istate);
+}
+
+/*
+    Prints the heap profile: totals, the size histogram and the call sites that allocated the most bytes.
+*/
+void alloc_profile_report()
+{
+    kprintf("Heap: %lu allocs, %lu frees, %lu failed, %lu bytes requested.\n",
+        profile_allocs, profile_frees, profile_failures, profile_total_bytes);
+    kprintf("Heap: %lu bytes live, %lu peak.\n", profile_live_bytes, profile_peak_bytes);
+
+    kprintf("Sizes:");
+    for (int i = 0; i < ALLOC_PROFILE_BUCKETS; i++) {
+        if (profile_sizes[i] > 0) {
+            kprintf(" %lu+:%lu", i ? (uint64_t)1 << (i - 1) : 0, profile_sizes[i]);
+        }
+    }
+    kprintf("\n");
+
+    // Pick out the biggest sites one at a time rather than sorting the table under the lock.
+    uint64_t last_bytes = UINT64_MAX;
+    void *pLastCaller = NULL;
+
+    for (int n = 0; n < ALLOC_PROFILE_TOP_SITES; n++) {
+        struct AllocSite *pBest = NULL;
+
+        for (uint32_t i = 0; i < ALLOC_PROFILE_SITES; i++) {
+            struct AllocSite *pSite = &profile_sites[i];
+
+            if (pSite->pCaller == NULL) {
+                continue;
+            }
+
+            // Sites come out in order of bytes, then address, so ties are still visited once.
+            bool after_last = pSite->bytes < last_bytes ||
+                (pSite->bytes == last_bytes && pSite->pCaller > pLastCaller);
+            bool before_best = pBest == NULL || pSite->bytes > pBest->bytes ||
+                (pSite->bytes == pBest->bytes && pSite->pCaller < pBest->pCaller);
+
+            if (after_last && before_best) {
+                pBest = pSite;
+            }
+        }
+
+        if (pBest == NULL) {
+            break;
+        }
+
+        kprintf("Site 0x%X: %lu allocs, %lu bytes.\n", pBest->pCaller, pBest->allocs, pBest->bytes);
+        last_bytes = pBest->bytes;
+        pLastCaller = pBest->pCaller;
+    }
+
+    if (profile_sites_dropped > 0) {
+        kprintf("Heap: %lu allocs from untracked sites.\n", profile_sites_dropped);
+    }
+}
+
+/*
+    Writes the whole heap profile to the serial port as one key=value pair per line, between
+    HEAP_PROFILE_BEGIN and HEAP_PROFILE_END, for scripts to pick up.
+*/
+void alloc_profile_report_serial()
+{
+    write_serial_strf(PORT_COM1, "HEAP_PROFILE_BEGIN\n");
+    write_serial_strf(PORT_COM1, "tsc=%lu\n", rdtsc());
+    write_serial_strf(PORT_COM1, "allocs=%lu\n", profile_allocs);
+    write_serial_strf(PORT_COM1, "frees=%lu\n", profile_frees);
+    write_serial_strf(PORT_COM1, "failures=%lu\n", profile_failures);
+    write_serial_strf(PORT_COM1, "total_bytes=%lu\n", profile_total_bytes);
+    write_serial_strf(PORT_COM1, "live_bytes=%lu\n", profile_live_bytes);
+    write_serial_strf(PORT_COM1, "peak_bytes=%lu\n", profile_peak_bytes);
+    write_serial_strf(PORT_COM1, "sites_dropped=%lu\n", profile_sites_dropped);
+
+    for (int i = 0; i < ALLOC_PROFILE_BUCKETS; i++) {
+        write_serial_strf(PORT_COM1, "sizes.%d=%lu\n", i, profile_sizes[i]);
+    }
+
+    for (uint32_t i = 0; i < ALLOC_PROFILE_SITES; i++) {
+        struct AllocSite *pSite = &profile_sites[i];
+
+        if (pSite->pCaller != NULL) {
+            write_serial_strf(PORT_COM1, "site.0x%x=%lu,%lu\n", pSite->pCaller, pSite->allocs, pSite->bytes);
+        }
+    }
+
+    write_serial_strf(PORT_COM1, "HEAP_PROFILE_END\n");
+}
+#else
+void alloc_profile_report()
+{
+    kprintf("Heap profiling is off, define ALLOC_PROFILE in alloc.h to turn it on.\n");
+}
+
+void alloc_profile_report_serial()
+{
+    alloc_profile_report();
+}
+#endif
+
+/*
+ * Allocates with _heap_malloc() and records the allocation against the caller.
+*/
+static inline void *_malloc_from(size_t size, void *pCaller)
+{
+    void *ptr = _heap_malloc(size);
+
+#ifdef ALLOC_PROFILE
+    _profile_alloc(size, ptr, pCaller);
+#else
+    (void)pCaller;
+#endif
+
+    return ptr;
+}
+
+void *malloc(size_t size)
+{
+    return _malloc_from(size, __builtin_return_address(0));
+}
+
+void free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+#ifdef ALLOC_PROFILE
+    _profile_free(ptr);
+#endif
+
+    _heap_free(ptr);
+}
+
+/*
+    Resizes an allocation. It stays where it is if it already has room, or if the heap can grow
+    it in to free memory after it; otherwise it's copied to a new allocation. The old memory is
+    left alone if that fails.
+*/
+void *realloc(void *ptr, size_t size)
+{
+    void *pCaller = __builtin_return_address(0);
+
+    if (ptr == NULL) {
+        return _malloc_from(size, pCaller);
+    }
+
+    if (size == 0) {
+        free(ptr);
+        return NULL;
+    }
+
+    size_t usable = _heap_usable_size(ptr);
+
+    if (usable == 0) {
+        kprintf("realloc isn't supported by this heap.\n");
+        return NULL;
+    }
+
+    if (size <= usable) {
+        return ptr;
+    }
+
+    if (_heap_grow_in_place(ptr, size)) {
+#ifdef ALLOC_PROFILE
+        _profile_free(ptr);
+        _profile_alloc(size, ptr, pCaller);
+#endif
+        return ptr;
+    }
+
+    void *pNew = _malloc_from(size, pCaller);
+    if (pNew == NULL) {
+        return NULL;
+    }
+
+    memcpy(pNew, ptr, usable);
+    free(ptr);
+
+    return pNew;
+}
+
+/*
+    Allocates zeroed memory for 'count' elements of 'size' bytes.
+*/
+void *calloc(size_t count, size_t size)
+{
+    size_t total;
+
+    if (__builtin_mul_overflow(count, size, &total)) {
+        kprintf("calloc of %lu x %lu bytes overflows.\n", count, size);
+        return NULL;
+    }
+
+    void *ptr = _heap_zalloc(total);
+
+#ifdef ALLOC_PROFILE
+    _profile_alloc(total, ptr, __builtin_return_address(0));
+#endif
+
+    return ptr;
+}
+
+/*
+    Allocates memory starting on a multiple of 'alignment', which must be a power of two.
+    Freed with free() like any other allocation.
+*/
+void *aligned_alloc(size_t alignment, size_t size)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        kprintf("Alignment of %lu isn't a power of two.\n", alignment);
+        return NULL;
+    }
+
+    void *ptr = _heap_aligned_alloc(alignment, size);
+
+#ifdef ALLOC_PROFILE
+    _profile_alloc(size, ptr, __builtin_return_address(0));
+#endif
+
+    return ptr;
+}
@@ -0,0 +1,348 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+    Allocator benchmark.
+
+    Runs the same scenarios against each heap allocator so they can be compared on equal terms:
+
+    random      Allocs and frees at random over a set of slots, mostly small sizes with the odd
+                big one, like a general kernel heap sees.
+    fifo        A producer/consumer queue, memory is freed in the order it was allocated.
+    aging       Fills the slots, frees every other allocation and refills the holes with bigger
+                sizes, over and over, to see how well freed space gets reused.
+
+    Each allocator reports ops per second, the 50th, 90th and 99th percentile latency of a single
+    malloc or free in cycles, and how much of the memory it took from the PMM held live data when
+    the scenario was at its fullest. The arena has no free so its frees cost nothing, it's reset
+    after each scenario instead.
+
+    Besides the allocbench shell command, "make allocbench-host" builds this along with the PMM and
+    the allocators as a Linux program and runs it there, see host/allocbench.c.
+*/
+#include <allocbench.h>
+#include <alloc.h>
+#include <slab.h>
+#include <slob.h>
+#include <bump.h>
+#include <mem.h>
+#include <str.h>
+#include <cpu.h>
+#include <idt.h>
+#include <math.h>
+
+struct BenchAllocator {
+    const char         *pName;
+    void             *(*alloc)(size_t size);
+    void              (*free)(void *ptr);
+};
+
+struct BenchState {
+    void               *pSlots[ALLOC_BENCH_SLOTS];
+    size_t              sizes[ALLOC_BENCH_SLOTS];
+    uint32_t           *pLatencies;                // Cycles taken by each op.
+    uint32_t            ops;
+    uint64_t            live_bytes;
+    uint64_t            peak_live_bytes;
+    uint64_t            start_free_pages;
+    uint64_t            peak_used_pages;
+    uint64_t            seed;
+};
+
+static struct Arena bench_arena;
+
+static void *_bench_arena_alloc(size_t size)
+{
+    return arena_alloc(&bench_arena, size);
+}
+
+static void _bench_arena_free(void *ptr)
+{
+    (void)ptr;
+}
+
+static const struct BenchAllocator bench_allocators[] = {
+    { "malloc", malloc,             free },
+    { "slab",   slab_malloc,        slab_free },
+    { "slob",   slob_malloc,        slob_free },
+    { "arena",  _bench_arena_alloc, _bench_arena_free },
+};
+
+/*
+ * xorshift64, the benchmark just needs the same sequence every run.
+*/
+static uint64_t _bench_rand(struct BenchState *pState)
+{
+    uint64_t x = pState->seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    pState->seed = x;
+    return x;
+}
+
+/*
+ * Picks an allocation size: mostly small objects, some medium and the odd page sized or bigger one.
+*/
+static size_t _bench_size(struct BenchState *pState)
+{
+    uint64_t r = _bench_rand(pState);
+    uint32_t pick = r % 100;
+
+    r >>= 8;
+    if (pick < 90) {
+        return 8 + r % 248;
+    } else if (pick < 99) {
+        return 256 + r % 1792;
+    }
+    return 2048 + r % 14336;
+}
+
+/*
+ * Pages the PMM has handed out, counting pages held in per-CPU magazines and the zero pool as free.
+*/
+static uint64_t _bench_free_pages()
+{
+    struct kmem_stats stats;
+    kmem_get_stats(&stats);
+    return stats.free_pages + stats.pcp_pages + stats.zero_pool_pages;
+}
+
+static void _bench_alloc(const struct BenchAllocator *pAlloc, struct BenchState *pState, uint32_t slot, size_t size)
+{
+    uint64_t start = rdtsc();
+    void *ptr = pAlloc->alloc(size);
+    uint64_t end = rdtsc();
+
+    pState->pLatencies[pState->ops++] = (uint32_t)MIN(end - start, UINT32_MAX);
+    if (ptr == NULL) {
+        return;
+    }
+
+    // Touch the memory so allocators that hand out untouched memory don't look better than they are.
+    *(volatile uint8_t*)ptr = 0;
+
+    pState->pSlots[slot] = ptr;
+    pState->sizes[slot] = size;
+    pState->live_bytes += size;
+
+    if (pState->live_bytes > pState->peak_live_bytes) {
+        pState->peak_live_bytes = pState->live_bytes;
+
+        uint64_t free_pages = _bench_free_pages();
+        uint64_t used = pState->start_free_pages > free_pages ? pState->start_free_pages - free_pages : 0;
+        pState->peak_used_pages = MAX(pState->peak_used_pages, used);
+    }
+}
+
+static void _bench_free(const struct BenchAllocator *pAlloc, struct BenchState *pState, uint32_t slot)
+{
+    uint64_t start = rdtsc();
+    pAlloc->free(pState->pSlots[slot]);
+    uint64_t end = rdtsc();
+
+    pState->pLatencies[pState->ops++] = (uint32_t)MIN(end - start, UINT32_MAX);
+    pState->live_bytes -= pState->sizes[slot];
+    pState->pSlots[slot] = NULL;
+}
+
+static void _bench_random(const struct BenchAllocator *pAlloc, struct BenchState *pState)
+{
+    while (pState->ops < ALLOC_BENCH_OPS) {
+        uint32_t slot = _bench_rand(pState) % ALLOC_BENCH_SLOTS;
+
+        if (pState->pSlots[slot] != NULL) {
+            _bench_free(pAlloc, pState, slot);
+        } else {
+            _bench_alloc(pAlloc, pState, slot, _bench_size(pState));
+        }
+    }
+}
+
+static void _bench_fifo(const struct BenchAllocator *pAlloc, struct BenchState *pState)
+{
+    uint32_t head = 0;
+
+    // Each pass can take a free and an alloc.
+    while (pState->ops + 2 <= ALLOC_BENCH_OPS) {
+        uint32_t slot = head % ALLOC_BENCH_QUEUE;
+
+        // The consumer frees the oldest entry once the queue is full.
+        if (pState->pSlots[slot] != NULL) {
+            _bench_free(pAlloc, pState, slot);
+        }
+
+        _bench_alloc(pAlloc, pState, slot, _bench_size(pState));
+        head++;
+    }
+}
+
+static void _bench_aging(const struct BenchAllocator *pAlloc, struct BenchState *pState)
+{
+    uint32_t round = 0;
+
+    while (pState->ops + ALLOC_BENCH_SLOTS * 2 <= ALLOC_BENCH_OPS) {
+        for (uint32_t slot = round & 1; slot < ALLOC_BENCH_SLOTS; slot += 2) {
+            if (pState->pSlots[slot] != NULL) {
+                _bench_free(pAlloc, pState, slot);
+            }
+        }
+
+        // Refill the holes a little bigger each round.
+        for (uint32_t slot = 0; slot < ALLOC_BENCH_SLOTS; slot++) {
+            if (pState->pSlots[slot] == NULL) {
+                _bench_alloc(pAlloc, pState, slot, _bench_size(pState) + round * 16);
+            }
+        }
+
+        round++;
+    }
+}
+
+/*
+ * Sorts the latencies so percentiles can be read straight out.
+*/
+static void _bench_sort(uint32_t *pValues, uint32_t count)
+{
+    // Shell sort with Ciura's gaps, good enough for a few tens of thousands of values.
+    static const uint32_t gaps[] = { 8929, 3905, 1750, 701, 301, 132, 57, 23, 10, 4, 1 };
+
+    for (size_t g = 0; g < sizeof(gaps) / sizeof(gaps[0]); g++) {
+        uint32_t gap = gaps[g];
+
+        for (uint32_t i = gap; i < count; i++) {
+            uint32_t value = pValues[i];
+            uint32_t j = i;
+
+            while (j >= gap && pValues[j - gap] > value) {
+                pValues[j] = pValues[j - gap];
+                j -= gap;
+            }
+
+            pValues[j] = value;
+        }
+    }
+}
+
+/*
+ * Measures TSC cycles per millisecond against the timer tick. Returns 0 if the timer isn't ticking.
+*/
+static uint64_t _bench_tsc_per_ms()
+{
+    uint64_t timeout = rdtsc() + (1ULL << 32);
+    uint64_t tick = kernel_timer_secs;
+
+    while (kernel_timer_secs == tick) {
+        if (rdtsc() > timeout) {
+            return 0;
+        }
+    }
+
+    uint64_t start = rdtsc();
+    tick = kernel_timer_secs;
+
+    while (kernel_timer_secs < tick + 10) {
+        if (rdtsc() > timeout) {
+            return 0;
+        }
+    }
+
+    return (rdtsc() - start) / 10;
+}
+
+static void _bench_run(const struct BenchAllocator *pAlloc, struct BenchState *pState, const char *pScenario,
+    void (*scenario)(const struct BenchAllocator*, struct BenchState*), uint64_t tsc_per_ms)
+{
+    memset(pState->pSlots, 0, sizeof(pState->pSlots));
+    pState->ops = 0;
+    pState->live_bytes = 0;
+    pState->peak_live_bytes = 0;
+    pState->peak_used_pages = 0;
+    pState->seed = 0x2545F4914F6CDD1DULL;
+    pState->start_free_pages = _bench_free_pages();
+
+    scenario(pAlloc, pState);
+
+    for (uint32_t slot = 0; slot < ALLOC_BENCH_SLOTS; slot++) {
+        if (pState->pSlots[slot] != NULL) {
+            pAlloc->free(pState->pSlots[slot]);
+            pState->pSlots[slot] = NULL;
+        }
+    }
+
+    arena_destroy(&bench_arena);
+
+    uint64_t cycles = 0;
+    for (uint32_t i = 0; i < pState->ops; i++) {
+        cycles += pState->pLatencies[i];
+    }
+
+    _bench_sort(pState->pLatencies, pState->ops);
+
+    kprintf("%s %s: ", pAlloc->pName, pScenario);
+    if (tsc_per_ms > 0 && cycles > 0) {
+        kprintf("%lu ops/s, ", pState->ops * tsc_per_ms * 1000 / cycles);
+    } else {
+        kprintf("%lu cycles/op, ", cycles / MAX(pState->ops, 1));
+    }
+
+    kprintf("p50 %d p90 %d p99 %d cycles, ",
+        pState->pLatencies[pState->ops / 2],
+        pState->pLatencies[pState->ops * 9 / 10],
+        pState->pLatencies[pState->ops * 99 / 100]);
+
+    uint64_t used_bytes = pState->peak_used_pages * PAGE_SIZE;
+    if (used_bytes > 0) {
+        kprintf("%lu percent of %lu KB used live\n",
+            MIN(pState->peak_live_bytes * 100 / used_bytes, 100), used_bytes / 1024);
+    } else {
+        // Everything fitted in memory the allocator already had.
+        kprintf("no new pages used\n");
+    }
+}
+
+/*
+    Runs every scenario against every allocator and prints the results.
+*/
+void alloc_benchmark()
+{
+    static struct BenchState state;
+
+    state.pLatencies = kpalloc(DIV_ROUNDUP(ALLOC_BENCH_OPS * sizeof(uint32_t), PAGE_SIZE));
+    if (state.pLatencies == NULL) {
+        kprintf("Allocator benchmark couldn't allocate its buffers.\n");
+        return;
+    }
+
+    arena_init(&bench_arena, 0);
+
+    // Only the heap's own backend is set up at boot, so SLOB gets its first pages here instead of in its first timed op.
+    slob_init();
+    uint64_t tsc_per_ms = _bench_tsc_per_ms();
+
+    kprintf("Allocator benchmark, %d ops per scenario:\n", ALLOC_BENCH_OPS);
+
+    for (size_t i = 0; i < sizeof(bench_allocators) / sizeof(bench_allocators[0]); i++) {
+        const struct BenchAllocator *pAlloc = &bench_allocators[i];
+
+        _bench_run(pAlloc, &state, "random", _bench_random, tsc_per_ms);
+        _bench_run(pAlloc, &state, "fifo", _bench_fifo, tsc_per_ms);
+        _bench_run(pAlloc, &state, "aging", _bench_aging, tsc_per_ms);
+    }
+
+    kfree(state.pLatencies);
+}
@@ -16,14 +16,18 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 /*
-    A really simple forward only, no freeing, memory allocator.
-    The fact that this can't free up memory is bad, but if you perform allocations
-    over the page size, all the existing memory remaining in the current page is
-    skipped and never used.
-
-    With that said, this IS better than just allocating pages using kpalloc/kalloc as
-    it saves you constantly allocating pages per call and lets you consume smaller
-    chunks inside a single page.
+    Arenas, a forward only allocator where nothing is freed on its own.
+
+    An arena hands out memory by bumping a cursor through a chunk of pages from the PMM, and
+    when the chunk runs out it gets another. Everything allocated from it is let go at once,
+    either by resetting it to be filled again or by destroying it, which gives its chunks back.
+    That suits memory with a clear lifetime, like tables built while parsing at boot or scratch
+    space for a single request.
+
+    A request too big to fit in a normal chunk gets a chunk of its own. It's linked in behind
+    the current chunk so whatever space was left in that one is still used.
+
+    bump_malloc() allocates from a global arena that's never reset, for memory that lives forever.
 */
 #include <bump.h>
 #include <str.h>
@@ -31,52 +35,131 @@
 #include <vm.h>
 #include <math.h>
 
-// State for tracking where we are in the page we have allocated.
-void *_cursor;
-uint16_t _offset;       // 0 is the start of the page, 4094 is the last byte in the page.
+// The arena behind bump_malloc().
+static struct Arena bump_arena = { .chunk_pages = ARENA_DEFAULT_CHUNK_PAGES };
 
-void *bump_malloc(size_t size)
+/*
+ * Gets a chunk of 'pages' pages from the PMM and links it after 'pPrev', or at the front of the
+ * arena's list if that's NULL.
+*/
+static struct ArenaChunk* _arena_add_chunk(struct Arena *pArena, struct ArenaChunk *pPrev, size_t pages)
+{
+    struct ArenaChunk *pChunk = (struct ArenaChunk*)kpalloc(pages);
+    if (pChunk == NULL) {
+        return NULL;
+    }
+
+    pChunk->pages = pages;
+
+    if (pPrev == NULL) {
+        pChunk->pNext = pArena->pChunks;
+        pArena->pChunks = pChunk;
+    } else {
+        pChunk->pNext = pPrev->pNext;
+        pPrev->pNext = pChunk;
+    }
+
+    return pChunk;
+}
+
+/*
+ * Gives every chunk from 'pChunk' onwards back to the PMM.
+*/
+static void _arena_free_chunks(struct ArenaChunk *pChunk)
+{
+    while (pChunk != NULL) {
+        struct ArenaChunk *pNext = pChunk->pNext;
+        kfree(pChunk);
+        pChunk = pNext;
+    }
+}
+
+/*
+    Sets up an empty arena that grows in chunks of 'chunk_pages' pages. No memory is taken
+    until the first allocation.
+*/
+void arena_init(struct Arena *pArena, size_t chunk_pages)
+{
+    pArena->pChunks = NULL;
+    pArena->pCursor = NULL;
+    pArena->pEnd = NULL;
+    pArena->chunk_pages = chunk_pages ? chunk_pages : ARENA_DEFAULT_CHUNK_PAGES;
+}
+
+/*
+    Allocates 'size' bytes from the arena, aligned to ARENA_ALIGN.
+*/
+void *arena_alloc(struct Arena *pArena, size_t size)
 {
-    // How many pages are we requesting?
-    uint64_t numPages = DIV_ROUNDUP(size, PAGE_SIZE);
-    
-    if (numPages > 1) {
-        // We need a batch of allocated pages to fit this request.
-        // We can't include the current page at all because it may not be
-        // contiguous with the next pages we request from the PM.
-        void *startAddr = kpalloc(numPages);
-        
-        // Offset in to the last page of the chunk.
-        _offset = (numPages * PAGE_SIZE) - size;
-
-        // Set the cursor to the next free byte in the last page.
-        _cursor = (char*)startAddr + size;
-
-        return startAddr;
+    size = ALIGN_UP(MAX(size, 1), ARENA_ALIGN);
+
+    if (size <= (size_t)(pArena->pEnd - pArena->pCursor)) {
+        void *ptr = pArena->pCursor;
+        pArena->pCursor += size;
+        return ptr;
+    }
+
+    size_t needed = DIV_ROUNDUP(ARENA_CHUNK_HEADER_SIZE + size, PAGE_SIZE);
+
+    if (needed > pArena->chunk_pages && pArena->pChunks != NULL) {
+        // Too big for a normal chunk. Give it one of its own and keep bumping through the current chunk.
+        struct ArenaChunk *pChunk = _arena_add_chunk(pArena, pArena->pChunks, needed);
+        if (pChunk == NULL) {
+            kprintf("Arena allocation of %lu bytes failed.\n", size);
+            return NULL;
+        }
+
+        return (uint8_t*)pChunk + ARENA_CHUNK_HEADER_SIZE;
     }
 
-    // First allocation.
-    if (_cursor == 0) {
-        _cursor = kpalloc(1);
-        _offset = 0;
+    struct ArenaChunk *pChunk = _arena_add_chunk(pArena, NULL, MAX(needed, pArena->chunk_pages));
+    if (pChunk == NULL) {
+        kprintf("Arena allocation of %lu bytes failed.\n", size);
+        return NULL;
     }
 
-    // If the request doesnt fit inside the remaining page space, get a new page.
-    if (size > (size_t)PAGE_SIZE - _offset) {
-        _cursor = kpalloc(1);
-        _offset = 0;
+    uint8_t *ptr = (uint8_t*)pChunk + ARENA_CHUNK_HEADER_SIZE;
+    pArena->pCursor = ptr + size;
+    pArena->pEnd = (uint8_t*)pChunk + pChunk->pages * PAGE_SIZE;
+
+    return ptr;
+}
+
+/*
+    Frees everything allocated from the arena. The newest chunk is kept so the arena can be
+    filled again without going back to the PMM, the rest are given back.
+*/
+void arena_reset(struct Arena *pArena)
+{
+    struct ArenaChunk *pChunk = pArena->pChunks;
+    if (pChunk == NULL) {
+        return;
     }
 
-    // Now reserve the space from the pointed to page and advance the cursor.
-    void *startAddr = _cursor;
-    _cursor = (char*)_cursor + size;
-    _offset += size;
+    _arena_free_chunks(pChunk->pNext);
+    pChunk->pNext = NULL;
+
+    pArena->pCursor = (uint8_t*)pChunk + ARENA_CHUNK_HEADER_SIZE;
+    pArena->pEnd = (uint8_t*)pChunk + pChunk->pages * PAGE_SIZE;
+}
+
+/*
+    Frees everything allocated from the arena and gives all of its chunks back to the PMM.
+    The arena is left empty and can still be used.
+*/
+void arena_destroy(struct Arena *pArena)
+{
+    _arena_free_chunks(pArena->pChunks);
+    arena_init(pArena, pArena->chunk_pages);
+}
 
-    return startAddr;
+void *bump_malloc(size_t size)
+{
+    return arena_alloc(&bump_arena, size);
 }
 
 void bump_free(void *ptr)
 {
     (void)ptr;
     // No frees! Muhahah.
-}
\ No newline at end of file
+}
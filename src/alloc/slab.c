@@ -0,0 +1,607 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+    A slab allocator with fixed size classes.
+
+    Every allocation is rounded up to one of the size classes, and each class carves its objects
+    out of slabs, runs of pages from the PMM split in to equal sized objects. The free objects
+    of a slab are kept on a list threaded through the objects themselves, so allocating and freeing
+    is a matter of popping or pushing that list.
+
+    Each class keeps its slabs on three lists: partial slabs that have free objects, full slabs that
+    don't, and empty slabs with nothing allocated. Allocations come from a partial slab first, so the
+    objects in use are packed in to as few slabs as possible. The page descriptor of every page in a
+    slab points back at the slab, which is how slab_free() finds it without searching.
+
+    Named caches from kmem_cache_create() work the same way for a single type of object, with an
+    optional constructor run on each object when its slab is made. Objects go back to the cache
+    still constructed, so the free list link for those is kept after the object rather than in it.
+*/
+#include <slab.h>
+#include <str.h>
+#include <mem.h>
+#include <math.h>
+#include <atomic.h>
+#include <stdbool.h>
+
+struct Slab {
+    struct Slab        *pNext;
+    struct Slab        *pPrev;
+    struct SlabCache   *pCache;
+    void               *pFree;      // First free object, each free object holds a pointer to the next.
+    uint32_t            inuse;
+    uint32_t            capacity;
+    uint32_t            owner;      // CPU that last took a batch of objects from the slab.
+};
+
+struct SlabCache {
+    spinlock_t          lock;
+    size_t              object_size;
+    uint32_t            slab_pages;
+    uint32_t            objects_per_slab;
+    uint32_t            objects_offset;     // Where the first object starts in a slab.
+    size_t              stride;             // Bytes from one object to the next.
+    uint32_t            free_offset;        // Where a free object holds the link to the next.
+    const char         *pName;              // NULL for the size classes.
+    void              (*ctor)(void *pObject);
+    struct Slab        *pPartial;
+    struct Slab        *pFull;
+    struct Slab        *pEmpty;
+    uint32_t            num_empty;
+    uint32_t            num_slabs;
+    uint64_t            allocs;
+    uint64_t            frees;
+    struct SlabCache   *pNextCache;         // Next named cache.
+};
+
+/*
+    Objects start after the slab header, at an alignment every size class is a multiple of.
+    Power of two classes start at a multiple of their size instead, so their objects are
+    aligned to their size. That costs no objects for any of the classes.
+*/
+#define SLAB_HEADER_SIZE ALIGN_UP(sizeof(struct Slab), 16)
+
+/*
+    The size classes. Powers of two with a class half way between each, so no more than a third
+    of an allocation is wasted by rounding up. Bigger objects get bigger slabs so the space left
+    over at the end of each slab stays small.
+*/
+static struct SlabCache size_classes[] = {
+    { .object_size = 16,   .slab_pages = 1 },
+    { .object_size = 32,   .slab_pages = 1 },
+    { .object_size = 48,   .slab_pages = 1 },
+    { .object_size = 64,   .slab_pages = 1 },
+    { .object_size = 96,   .slab_pages = 1 },
+    { .object_size = 128,  .slab_pages = 1 },
+    { .object_size = 192,  .slab_pages = 1 },
+    { .object_size = 256,  .slab_pages = 1 },
+    { .object_size = 384,  .slab_pages = 2 },
+    { .object_size = 512,  .slab_pages = 2 },
+    { .object_size = 768,  .slab_pages = 4 },
+    { .object_size = 1024, .slab_pages = 4 },
+    { .object_size = 1536, .slab_pages = 8 },
+    { .object_size = 2048, .slab_pages = 8 },
+};
+
+_Static_assert(sizeof(size_classes) / sizeof(size_classes[0]) == SLAB_NUM_CLASSES, "SLAB_NUM_CLASSES is out of date");
+
+#define NUM_SIZE_CLASSES SLAB_NUM_CLASSES
+
+/* Size class for every 16 byte step up to SLAB_MAX_SIZE, so finding the class is a single lookup. */
+static uint8_t size_class_index[SLAB_MAX_SIZE / 16];
+
+static bool _slab_ready = false;
+
+// Named caches, newest first.
+static struct SlabCache *pNamedCaches = NULL;
+static spinlock_t named_caches_lock;
+
+/*
+ * Pushes a slab on to the front of one of the cache's lists.
+*/
+static inline void _slab_list_push(struct Slab **ppList, struct Slab *pSlab)
+{
+    pSlab->pPrev = NULL;
+    pSlab->pNext = *ppList;
+
+    if (*ppList != NULL) {
+        (*ppList)->pPrev = pSlab;
+    }
+
+    *ppList = pSlab;
+}
+
+/*
+ * Unlinks a slab from the cache list it's on.
+*/
+static inline void _slab_list_remove(struct Slab **ppList, struct Slab *pSlab)
+{
+    if (pSlab->pPrev != NULL) {
+        pSlab->pPrev->pNext = pSlab->pNext;
+    } else {
+        *ppList = pSlab->pNext;
+    }
+
+    if (pSlab->pNext != NULL) {
+        pSlab->pNext->pPrev = pSlab->pPrev;
+    }
+}
+
+/*
+ * Gets a new slab of pages from the PMM and threads all of its objects on to its free list.
+ * Every page of the slab is marked as belonging to it.
+*/
+static struct Slab* _slab_create(struct SlabCache *pCache)
+{
+    uint8_t *pPages = kpalloc(pCache->slab_pages);
+    if (pPages == NULL) {
+        return NULL;
+    }
+
+    struct Slab *pSlab = (struct Slab*)pPages;
+    pSlab->pCache = pCache;
+    pSlab->inuse = 0;
+    pSlab->owner = 0;
+    pSlab->capacity = pCache->objects_per_slab;
+    pSlab->pFree = NULL;
+
+    // Thread the list backwards so the objects are handed out in address order.
+    uint8_t *pObjects = pPages + pCache->objects_offset;
+    for (uint32_t i = pSlab->capacity; i > 0; i--) {
+        uint8_t *pObject = pObjects + (i - 1) * pCache->stride;
+
+        if (pCache->ctor != NULL) {
+            pCache->ctor(pObject);
+        }
+
+        *(void**)(pObject + pCache->free_offset) = pSlab->pFree;
+        pSlab->pFree = pObject;
+    }
+
+    for (uint32_t i = 0; i < pCache->slab_pages; i++) {
+        struct page *pPage = kmem_page(pPages + i * PAGE_SIZE);
+        pPage->flags |= PAGE_SLAB;
+        pPage->pOwner = pSlab;
+    }
+
+    pCache->num_slabs++;
+    return pSlab;
+}
+
+/*
+ * Gives the pages of an empty slab back to the PMM.
+*/
+static void _slab_destroy(struct SlabCache *pCache, struct Slab *pSlab)
+{
+    uint8_t *pPages = (uint8_t*)pSlab;
+
+    for (uint32_t i = 0; i < pCache->slab_pages; i++) {
+        struct page *pPage = kmem_page(pPages + i * PAGE_SIZE);
+        pPage->flags &= ~PAGE_SLAB;
+        pPage->pOwner = NULL;
+    }
+
+    pCache->num_slabs--;
+    kfree(pSlab);
+}
+
+/*
+ * Takes an object from the cache, returning its slab in 'ppSlab'. A partial slab is used if there
+ * is one, then an empty slab, and only then is a new slab made. Must be called with the cache lock held.
+*/
+static void* _slab_take(struct SlabCache *pCache, struct Slab **ppSlab)
+{
+    struct Slab *pSlab = pCache->pPartial;
+
+    if (pSlab == NULL) {
+        pSlab = pCache->pEmpty;
+
+        if (pSlab != NULL) {
+            _slab_list_remove(&pCache->pEmpty, pSlab);
+            pCache->num_empty--;
+        } else {
+            pSlab = _slab_create(pCache);
+
+            if (pSlab == NULL) {
+                return NULL;
+            }
+        }
+
+        _slab_list_push(&pCache->pPartial, pSlab);
+    }
+
+    uint8_t *pObject = pSlab->pFree;
+    pSlab->pFree = *(void**)(pObject + pCache->free_offset);
+    pSlab->inuse++;
+    pCache->allocs++;
+
+    if (pSlab->inuse == pSlab->capacity) {
+        _slab_list_remove(&pCache->pPartial, pSlab);
+        _slab_list_push(&pCache->pFull, pSlab);
+    }
+
+    *ppSlab = pSlab;
+    return pObject;
+}
+
+/*
+ * Allocates an object from the cache.
+*/
+static void* _slab_cache_alloc(struct SlabCache *pCache)
+{
+    struct Slab *pSlab;
+
+    spinlock_lock(&pCache->lock);
+    void *ptr = _slab_take(pCache, &pSlab);
+    spinlock_unlock(&pCache->lock);
+
+    return ptr;
+}
+
+/*
+ * Returns an object to its slab, moving the slab between the cache's lists as it fills up
+ * and empties. Empty slabs beyond SLAB_MAX_EMPTY are given back to the PMM.
+ * Must be called with the cache lock held.
+*/
+static void _slab_put(struct Slab *pSlab, void *ptr)
+{
+    struct SlabCache *pCache = pSlab->pCache;
+
+    *(void**)((uint8_t*)ptr + pCache->free_offset) = pSlab->pFree;
+    pSlab->pFree = ptr;
+    pCache->frees++;
+
+    if (pSlab->inuse == pSlab->capacity) {
+        _slab_list_remove(&pCache->pFull, pSlab);
+        _slab_list_push(&pCache->pPartial, pSlab);
+    }
+
+    pSlab->inuse--;
+
+    if (pSlab->inuse == 0) {
+        _slab_list_remove(&pCache->pPartial, pSlab);
+
+        if (pCache->num_empty < SLAB_MAX_EMPTY) {
+            _slab_list_push(&pCache->pEmpty, pSlab);
+            pCache->num_empty++;
+        } else {
+            _slab_destroy(pCache, pSlab);
+        }
+    }
+}
+
+/*
+ * Returns an object to its slab.
+*/
+static void _slab_cache_free(struct Slab *pSlab, void *ptr)
+{
+    struct SlabCache *pCache = pSlab->pCache;
+
+    spinlock_lock(&pCache->lock);
+    _slab_put(pSlab, ptr);
+    spinlock_unlock(&pCache->lock);
+}
+
+/*
+    Works out how many objects fit in each size class's slabs and builds the size lookup table.
+*/
+void slab_init()
+{
+    if (_slab_ready) {
+        return;
+    }
+
+    uint32_t class = 0;
+
+    for (uint32_t i = 0; i < NUM_SIZE_CLASSES; i++) {
+        struct SlabCache *pCache = &size_classes[i];
+        size_t size = pCache->object_size;
+
+        pCache->stride = size;
+        pCache->objects_offset = (size & (size - 1)) == 0 ? ALIGN_UP(SLAB_HEADER_SIZE, size) : SLAB_HEADER_SIZE;
+        pCache->objects_per_slab = (pCache->slab_pages * PAGE_SIZE - pCache->objects_offset) / size;
+    }
+
+    for (uint32_t i = 0; i < SLAB_MAX_SIZE / 16; i++) {
+        while (size_classes[class].object_size < (i + 1) * 16) {
+            class++;
+        }
+
+        size_class_index[i] = class;
+    }
+
+    _slab_ready = true;
+}
+
+/*
+    Allocates memory from the smallest size class that fits. Anything bigger than SLAB_MAX_SIZE
+    comes straight from the PMM as whole pages.
+*/
+void *slab_malloc(size_t size)
+{
+    if (!_slab_ready) {
+        slab_init();
+    }
+
+    if (size > SLAB_MAX_SIZE) {
+        return kalloc(size);
+    }
+
+    struct SlabCache *pCache = &size_classes[slab_size_class(size)];
+    void *ptr = _slab_cache_alloc(pCache);
+
+    if (ptr == NULL) {
+        kprintf("Slab allocation of %lu bytes failed.\n", size);
+    }
+
+    return ptr;
+}
+
+/*
+    Frees memory from slab_malloc(). The page descriptor says whether it's in a slab or a
+    page allocation of its own.
+*/
+void slab_free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+    struct page *pPage = kmem_page(ptr);
+
+    // Pages without a descriptor were never handed out.
+    if (pPage == NULL) {
+        kprintf("Slab: Free of unallocated address 0x%X ignored.\n", ptr);
+        return;
+    }
+
+    if (pPage->flags & PAGE_SLAB) {
+        _slab_cache_free((struct Slab*)pPage->pOwner, ptr);
+    } else {
+        kfree(ptr);
+    }
+}
+
+/*
+    Returns the size class an allocation of 'size' bytes comes from, or -1 if it's too big for one.
+*/
+int slab_size_class(size_t size)
+{
+    if (size > SLAB_MAX_SIZE) {
+        return -1;
+    }
+
+    return size_class_index[(MAX(size, 1) - 1) / 16];
+}
+
+/*
+    Returns the size class of an object from slab_malloc() and the CPU that owns its slab, see
+    slab_alloc_batch(). Returns -1 if the memory isn't in a slab.
+*/
+int slab_object_class(void *ptr, uint32_t *pOwner)
+{
+    struct page *pPage = kmem_page(ptr);
+
+    if (pPage == NULL || !(pPage->flags & PAGE_SLAB)) {
+        return -1;
+    }
+
+    struct Slab *pSlab = (struct Slab*)pPage->pOwner;
+    if (pSlab->pCache < size_classes || pSlab->pCache >= size_classes + NUM_SIZE_CLASSES) {
+        // From a named cache.
+        return -1;
+    }
+
+    *pOwner = pSlab->owner;
+
+    return pSlab->pCache - size_classes;
+}
+
+/*
+    Allocates up to 'count' objects from a size class in to 'ppObjects' while taking the class
+    lock only once, returning how many it got. The slabs they come from are marked as owned by
+    'owner', the CPU that will cache them.
+*/
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner)
+{
+    if (!_slab_ready) {
+        slab_init();
+    }
+
+    struct SlabCache *pCache = &size_classes[class];
+    struct Slab *pSlab;
+    uint32_t taken = 0;
+
+    spinlock_lock(&pCache->lock);
+
+    while (taken < count) {
+        void *ptr = _slab_take(pCache, &pSlab);
+        if (ptr == NULL) {
+            break;
+        }
+
+        pSlab->owner = owner;
+        ppObjects[taken++] = ptr;
+    }
+
+    spinlock_unlock(&pCache->lock);
+
+    return taken;
+}
+
+/*
+    Frees 'count' objects of the same size class while taking the class lock only once.
+*/
+void slab_free_batch(void **ppObjects, uint32_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    struct SlabCache *pCache = ((struct Slab*)kmem_page(ppObjects[0])->pOwner)->pCache;
+
+    spinlock_lock(&pCache->lock);
+
+    for (uint32_t i = 0; i < count; i++) {
+        _slab_put((struct Slab*)kmem_page(ppObjects[i])->pOwner, ppObjects[i]);
+    }
+
+    spinlock_unlock(&pCache->lock);
+}
+
+/*
+    Returns how many bytes can be used at 'ptr', from slab_malloc(). That's the object size of
+    its class, or the whole run of pages for allocations too big for a class.
+*/
+size_t slab_usable_size(void *ptr)
+{
+    struct page *pPage = kmem_page(ptr);
+
+    if (pPage == NULL) {
+        return 0;
+    }
+
+    if (pPage->flags & PAGE_SLAB) {
+        return ((struct Slab*)pPage->pOwner)->pCache->object_size;
+    }
+
+    return (size_t)pPage->pages_allocated * PAGE_SIZE;
+}
+
+/*
+    Creates a named cache of objects of 'size' bytes, each aligned to 'align', which is rounded up
+    to a power of two of at least 8. Use SLAB_CACHE_LINE_SIZE to keep objects from sharing cache
+    lines. 'ctor', if given, sets up each object once when its slab is made, and objects must be
+    freed back to the cache in that same state so they come out ready to use again.
+*/
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject))
+{
+    align = MAX(align, 8);
+    if ((align & (align - 1)) != 0) {
+        align = 1ULL << (64 - __builtin_clzl(align));
+    }
+
+    struct SlabCache *pCache = slab_malloc(sizeof(struct SlabCache));
+    if (pCache == NULL) {
+        return NULL;
+    }
+
+    memset(pCache, 0, sizeof(struct SlabCache));
+    pCache->pName = pName;
+    pCache->ctor = ctor;
+    pCache->object_size = size;
+
+    // Constructed objects keep their contents while free, so the free link goes after them.
+    if (ctor != NULL) {
+        pCache->free_offset = ALIGN_UP(size, sizeof(void*));
+        pCache->stride = ALIGN_UP(pCache->free_offset + sizeof(void*), align);
+    } else {
+        pCache->stride = ALIGN_UP(MAX(size, sizeof(void*)), align);
+    }
+
+    pCache->objects_offset = ALIGN_UP(SLAB_HEADER_SIZE, align);
+
+    // Make the slabs big enough for a few objects each.
+    pCache->slab_pages = 1;
+    while ((pCache->slab_pages * PAGE_SIZE - pCache->objects_offset) / pCache->stride < SLAB_CACHE_MIN_OBJECTS &&
+        pCache->slab_pages < SLAB_CACHE_MAX_PAGES) {
+        pCache->slab_pages *= 2;
+    }
+
+    if (pCache->slab_pages * PAGE_SIZE < pCache->objects_offset + pCache->stride) {
+        kprintf("Slab cache %s: objects of %lu bytes are too big.\n", pName, size);
+        slab_free(pCache);
+        return NULL;
+    }
+
+    pCache->objects_per_slab = (pCache->slab_pages * PAGE_SIZE - pCache->objects_offset) / pCache->stride;
+
+    spinlock_lock(&named_caches_lock);
+    pCache->pNextCache = pNamedCaches;
+    pNamedCaches = pCache;
+    spinlock_unlock(&named_caches_lock);
+
+    return pCache;
+}
+
+/*
+    Allocates an object from a named cache.
+*/
+void *kmem_cache_alloc(struct SlabCache *pCache)
+{
+    void *ptr = _slab_cache_alloc(pCache);
+
+    if (ptr == NULL) {
+        kprintf("Slab cache %s: allocation failed.\n", pCache->pName);
+    }
+
+    return ptr;
+}
+
+/*
+    Gives an object back to the named cache it came from.
+*/
+void kmem_cache_free(struct SlabCache *pCache, void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+    struct page *pPage = kmem_page(ptr);
+
+    if (pPage == NULL || !(pPage->flags & PAGE_SLAB) || ((struct Slab*)pPage->pOwner)->pCache != pCache) {
+        kprintf("Slab cache %s: 0x%X doesn't belong to it.\n", pCache->pName, ptr);
+        return;
+    }
+
+    _slab_cache_free((struct Slab*)pPage->pOwner, ptr);
+}
+
+/*
+ * Prints one line of stats for a cache.
+*/
+static void _kmem_cache_print(struct SlabCache *pCache)
+{
+    if (pCache->pName != NULL) {
+        kprintf("%s", pCache->pName);
+    } else {
+        kprintf("size-%lu", pCache->object_size);
+    }
+
+    kprintf(": %lu bytes, %lu active, %d slabs of %d, %lu allocs, %lu frees\n",
+        pCache->object_size, pCache->allocs - pCache->frees, pCache->num_slabs,
+        pCache->objects_per_slab, pCache->allocs, pCache->frees);
+}
+
+/*
+    Prints the stats of every size class and named cache.
+*/
+void kmem_cache_report()
+{
+    for (uint32_t i = 0; i < NUM_SIZE_CLASSES; i++) {
+        _kmem_cache_print(&size_classes[i]);
+    }
+
+    spinlock_lock(&named_caches_lock);
+
+    for (struct SlabCache *pCache = pNamedCaches; pCache != NULL; pCache = pCache->pNextCache) {
+        _kmem_cache_print(pCache);
+    }
+
+    spinlock_unlock(&named_caches_lock);
+}
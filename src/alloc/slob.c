@@ -17,123 +17,252 @@
 */
 /*
     An implementation of the SLOB algorithm.
-    Merges sibling nodes when memory is freed to help with fragmentation.
+
+    Free memory is kept on a single list sorted by address, with each list node stored at the start
+    of the free block it describes, so freeing never needs to allocate. Allocations are carved from
+    the end of the first free block big enough. When memory is freed, it's merged with the free blocks
+    either side of it if they touch, which keeps the list short and the free blocks large.
 */
 #include <slob.h>
 #include <str.h>
 #include <mem.h>
+#include <math.h>
+#include <atomic.h>
+#include <stdbool.h>
 
+/* A free block, this lives in the first bytes of the block itself. */
 struct SlobEntry {
-    struct SlobEntry   *pNext;
-    uint64_t            base;
-    size_t              length;
-} __attribute__((packed));
+    struct SlobEntry   *pNext;      // Next free block up in memory.
+    size_t              length;     // Length of the block in bytes, including this entry.
+};
 
+/* Sits in front of every allocation. */
 struct SlobHeader {
-    uint64_t            length;
+    uint64_t            length;     // Length of the block in bytes, including this header.
 } __attribute__((packed));
 
-uint8_t _init = 0;
+/* Pages requested from the PMM each time the heap needs to grow. */
+#define SLOB_CHUNK_PAGES 64
+
+/* Blocks are a multiple of this, so any block can be turned back in to a free entry. */
+#define SLOB_BLOCK_ALIGN sizeof(struct SlobEntry)
+
+static uint8_t _init = 0;
 struct SlobEntry *pHead = 0;
+spinlock_t slob_lock = {0};
 
 /*
-    Intializes the intial slob entries according to available areas of RAM in the Limine memory map.
+    Puts a block on the free list at its place in address order, merging it with the free
+    blocks before and after it if they touch. Must be called with the lock held.
 */
-void slob_init()
+void _slob_insert(void *pBlock, size_t length)
 {
-    int numEntries = 0;
+    struct SlobEntry *pEntry = (struct SlobEntry*)pBlock;
+    struct SlobEntry *pPrev = 0;
+    struct SlobEntry *pNext = pHead;
 
-    // How many entries will we need to create?
-    for (size_t i = 0; i < memmap->entry_count; i++) {
-        struct limine_memmap_entry *entry = memmap->entries[i];
+    while (pNext != 0 && pNext < pEntry) {
+        pPrev = pNext;
+        pNext = pNext->pNext;
+    }
 
-        if (entry->type == LIMINE_MEMMAP_USABLE) {
-            numEntries++;
-        }
+    pEntry->length = length;
+    pEntry->pNext = pNext;
+
+    // Absorb the following block if it starts where we end.
+    if (pNext != 0 && (uint8_t*)pEntry + pEntry->length == (uint8_t*)pNext) {
+        pEntry->length += pNext->length;
+        pEntry->pNext = pNext->pNext;
     }
 
-    // Allocate enough room for all the initial slob entries.
-    pHead = (struct SlobEntry*)memmap_alloc(sizeof(struct SlobEntry) * numEntries);
-    
-    // Initialize the entries.
-    int entryIndex = 0;
+    // Let the previous block absorb us if it ends where we start.
+    if (pPrev != 0 && (uint8_t*)pPrev + pPrev->length == (uint8_t*)pEntry) {
+        pPrev->length += pEntry->length;
+        pPrev->pNext = pEntry->pNext;
+    } else if (pPrev != 0) {
+        pPrev->pNext = pEntry;
+    } else {
+        pHead = pEntry;
+    }
+}
 
-    for (size_t i = 0; i < memmap->entry_count; i++) {
-        struct limine_memmap_entry *entry = memmap->entries[i];
+/*
+    Grows the heap by a chunk of pages from the PMM, big enough to hold at least 'length' bytes.
+    Must be called with the lock held.
+*/
+bool _slob_grow(size_t length)
+{
+    uint64_t numPages = MAX(DIV_ROUNDUP(length, PAGE_SIZE), SLOB_CHUNK_PAGES);
 
-        if (entry->type == LIMINE_MEMMAP_USABLE) {
-            pHead[entryIndex].length = entry->length;
-            pHead[entryIndex].base = entry->base;
+    void *pChunk = kpalloc(numPages);
+    if (pChunk == NULL) {
+        return false;
+    }
 
-            if (entryIndex < numEntries-1)
-                pHead[entryIndex].pNext = &pHead[entryIndex+1];
-            else
-                pHead[entryIndex].pNext = 0;    // End entry has no next.
+    _slob_insert(pChunk, numPages * PAGE_SIZE);
+    return true;
+}
 
-            entryIndex++;
-        }
+/*
+    Intializes the intial slob entry with a chunk of memory from the PMM.
+    The heap can't be carved straight from the Limine memory map as those pages belong to the PMM.
+*/
+void slob_init()
+{
+    spinlock_lock(&slob_lock);
+
+    if (_init == 0) {
+        _init = 1;
+        _slob_grow(0);
     }
+
+    spinlock_unlock(&slob_lock);
 }
 
 /*
-    Allocates a new slob entry in the first available slob entry we can find that fits our new
-    allocation size. We split the found entry and insert our new entry at the start of it.
+    Allocates from the first free block we can find that fits our new allocation size. The allocation
+    is taken from the end of the block, so the block's entry stays where it is and only shrinks.
+    If nothing fits, the heap is grown with more pages from the PMM.
 */
 void *slob_malloc(size_t size)
 {
     if (_init == 0) {
         slob_init();
-        _init = 1;
     }
-    
-    struct SlobEntry *pNext = pHead;
-    while(pNext != 0) {
 
-        if (size + sizeof(struct SlobHeader) <= pNext->length) {
-            // Found an entry that can fit our request, lets split the node.
-            uint64_t totalSize = sizeof(struct SlobHeader) + size;
-            
-            // Setup the new chunk thats now split from the existing chunk that we've found.
-            struct SlobHeader *pHeader = (struct SlobHeader*)(pNext->base + vmm_higher_half_offset);
-            pHeader->length = totalSize;
+    uint64_t totalSize = ALIGN_UP(sizeof(struct SlobHeader) + size, SLOB_BLOCK_ALIGN);
+
+    spinlock_lock(&slob_lock);
+
+    while (true) {
+        struct SlobEntry *pPrev = 0;
+        struct SlobEntry *pNext = pHead;
+
+        while (pNext != 0 && pNext->length < totalSize) {
+            pPrev = pNext;
+            pNext = pNext->pNext;
+        }
+
+        if (pNext == 0) {
+            // Nothing fits, grow the heap and look again.
+            if (!_slob_grow(totalSize)) {
+                break;
+            }
+
+            continue;
+        }
 
-            // Get the users memory location after the slob entry header.
-            void *pAlloc = (void*)(pNext->base + sizeof(struct SlobHeader) + vmm_higher_half_offset);
+        uint8_t *pBlock;
 
-            // Move the base of the entry up by our new allocation size.
-            pNext->base += totalSize;
+        if (pNext->length - totalSize < sizeof(struct SlobEntry)) {
+            // The rest of the block would be too small to track, so hand over all of it.
+            totalSize = pNext->length;
+            pBlock = (uint8_t*)pNext;
+
+            if (pPrev != 0) {
+                pPrev->pNext = pNext->pNext;
+            } else {
+                pHead = pNext->pNext;
+            }
+        } else {
             pNext->length -= totalSize;
-            
-            return pAlloc;
+            pBlock = (uint8_t*)pNext + pNext->length;
         }
 
-        pNext = pNext->pNext;
+        spinlock_unlock(&slob_lock);
+
+        struct SlobHeader *pHeader = (struct SlobHeader*)pBlock;
+        pHeader->length = totalSize;
+
+        // Give the user the memory after the header.
+        return pBlock + sizeof(struct SlobHeader);
     }
 
+    spinlock_unlock(&slob_lock);
+
     kprintf("No memory available!\n");
     return 0;
 }
 
 /*
-    Free takes the allocated entry and makes it available by creating a new slob entry and pre-pending it to the
-    list of free entries.
-
-    Over-time, theres going to be a lot of small available entries as memory is freed until we implement
-    merging/defragging of the entries.
+    Free puts the allocated block back on the free list, using the block itself to hold its entry,
+    and merges it with any free neighbours.
 */
 void slob_free(void *ptr)
 {
-    // TODO: Need a spinklock to protect the structure change for multi-core.
+    if (ptr == 0) {
+        return;
+    }
 
     // Grab the header from the previous bytes of this memory location.
-    struct SlobHeader *pHeader = (struct SlobHeader*)(ptr - sizeof(struct SlobHeader));
+    struct SlobHeader *pHeader = (struct SlobHeader*)((uint8_t*)ptr - sizeof(struct SlobHeader));
+
+    spinlock_lock(&slob_lock);
+    _slob_insert(pHeader, pHeader->length);
+    spinlock_unlock(&slob_lock);
+}
+
+/*
+    Returns how many bytes can be used at 'ptr', from slob_malloc().
+*/
+size_t slob_usable_size(void *ptr)
+{
+    struct SlobHeader *pHeader = (struct SlobHeader*)((uint8_t*)ptr - sizeof(struct SlobHeader));
+    return pHeader->length - sizeof(struct SlobHeader);
+}
+
+/*
+    Tries to grow the allocation at 'ptr' to hold 'size' bytes without moving it, by taking
+    the front of the free block that follows it. Returns false if there's no room to grow.
+*/
+bool slob_grow_in_place(void *ptr, size_t size)
+{
+    struct SlobHeader *pHeader = (struct SlobHeader*)((uint8_t*)ptr - sizeof(struct SlobHeader));
+    uint64_t totalSize = ALIGN_UP(sizeof(struct SlobHeader) + size, SLOB_BLOCK_ALIGN);
+
+    if (totalSize <= pHeader->length) {
+        return true;
+    }
+
+    uint64_t extra = totalSize - pHeader->length;
+    struct SlobEntry *pEnd = (struct SlobEntry*)((uint8_t*)pHeader + pHeader->length);
+
+    spinlock_lock(&slob_lock);
 
-    // Create the new entry.
-    struct SlobEntry *pEntry = (struct SlobEntry*)slob_malloc(sizeof(struct SlobEntry));
-    pEntry->base = (uint64_t)pHeader - vmm_higher_half_offset;
-    pEntry->length = pHeader->length;
+    struct SlobEntry *pPrev = 0;
+    struct SlobEntry *pNext = pHead;
+
+    while (pNext != 0 && pNext < pEnd) {
+        pPrev = pNext;
+        pNext = pNext->pNext;
+    }
 
-    // Pre-pend the new entry to the list.
-    pEntry->pNext = pHead;
-    pHead = pEntry;
-}
\ No newline at end of file
+    if (pNext != pEnd || pNext->length < extra) {
+        spinlock_unlock(&slob_lock);
+        return false;
+    }
+
+    struct SlobEntry *pFollowing = pNext->pNext;
+    size_t remaining = pNext->length - extra;
+
+    if (remaining < sizeof(struct SlobEntry)) {
+        // Too little would be left to track, take the whole block.
+        pHeader->length += pNext->length;
+    } else {
+        // Move the free block's entry up past the memory we take.
+        pNext = (struct SlobEntry*)((uint8_t*)pEnd + extra);
+        pNext->length = remaining;
+        pNext->pNext = pFollowing;
+        pFollowing = pNext;
+        pHeader->length = totalSize;
+    }
+
+    if (pPrev != 0) {
+        pPrev->pNext = pFollowing;
+    } else {
+        pHead = pFollowing;
+    }
+
+    spinlock_unlock(&slob_lock);
+    return true;
+}
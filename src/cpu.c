@@ -21,6 +21,8 @@
 #include <str.h>
 #include <atomic.h>
 #include <lapic.h>
+#include <mem.h>
+#include <acpi.h>
 
 volatile struct limine_smp_request smp_request = {
     .id = LIMINE_SMP_REQUEST,
@@ -30,9 +32,35 @@ volatile struct limine_smp_request smp_request = {
 uint32_t bsp_lapic_id;      // Bootstrap processor APIC ID.
 uint64_t cpu_count;
 
+struct cpu_local cpu_locals[MAX_CPUS];
+
 volatile uint64_t _cpus_awake = 1;   // The first is the BSP core.
 spinlock_t _cpu_lock;
 
+/*
+ * Sets up the per-CPU state for the calling core and points its GS base at it.
+ * This has to be done after the GDT is loaded as reloading GS resets the base.
+*/
+void cpu_local_init(uint32_t index)
+{
+    uint32_t eax, ebx, ecx, edx;
+
+    // The initial APIC ID is in bits 24-31 of EBX for leaf 1.
+    asm volatile (
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(1)
+    );
+
+    struct cpu_local *pLocal = &cpu_locals[index];
+    pLocal->self = pLocal;
+    pLocal->index = index;
+    pLocal->lapic_id = ebx >> 24;
+    pLocal->node = acpi_numa_node_of_apic(pLocal->lapic_id);
+
+    write_msr(IA32_GS_BASE_MSR, (uint64_t)pLocal);
+}
+
 /*
  * Each CPU core starts in this function.
 */
@@ -46,6 +74,11 @@ void _cpu_awake(struct limine_smp_info *smp_info)
     // PAT - wrmsr(0x277
     // Sched...
 
+    cpu_local_init(__sync_fetch_and_add(&_cpus_awake, 1));
+
+    // Help set up the memory the PMM deferred at boot.
+    kmem_init_deferred();
+
     lapic_init();
 
     spinlock_lock(&_cpu_lock);
@@ -53,7 +86,6 @@ void _cpu_awake(struct limine_smp_info *smp_info)
     kprintf("LAPIC ID: %d\n", smp_info->lapic_id);
     kprintf("Processor ID: %d\n", smp_info->processor_id);
 
-    _cpus_awake++;
     kprintf("Cores Online: %d\n", _cpus_awake);
     spinlock_unlock(&_cpu_lock);
     asm("hlt");
@@ -67,6 +99,11 @@ void cpu_init()
     kprintf("BSP LAPIC ID: %d\n", bsp_lapic_id);
     kprintf("CPU Count: %d\n", cpu_count);
 
+    if (cpu_count > MAX_CPUS) {
+        kprintf("Only the first %d CPU cores will be used.\n", MAX_CPUS);
+        cpu_count = MAX_CPUS;
+    }
+
     /*
     // Wake the cores up...
     for (uint64_t i = 0; i < cpu_count; i++) {
@@ -83,4 +120,7 @@ void cpu_init()
 
     kprintf("All CPU cores online.\n");
     */
+
+    // Any cores woken above join in from _cpu_awake().
+    kmem_init_deferred();
 }
\ No newline at end of file
@@ -92,12 +92,74 @@ struct mcfg_entry {
     uint32_t reserved2;
 } __attribute__((packed));
 
+// Processor Local APIC Affinity structure in the SRAT (ID 0).
+struct srat_lapic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint8_t proximity_domain_low;       // Bits 0-7 of the proximity domain.
+    uint8_t apic_id;
+    uint32_t flags;                     // Bit 0 - enabled.
+    uint8_t sapic_eid;
+    uint8_t proximity_domain_high[3];   // Bits 8-31 of the proximity domain.
+    uint32_t clock_domain;
+} __attribute__((packed));
+
+// Memory Affinity structure in the SRAT (ID 1).
+struct srat_mem_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint32_t proximity_domain;
+    uint16_t reserved1;
+    uint64_t base;
+    uint64_t range_length;
+    uint32_t reserved2;
+    uint32_t flags;                     // Bit 0 - enabled, bit 1 - hot pluggable, bit 2 - non-volatile.
+    uint64_t reserved3;
+} __attribute__((packed));
+
+// Processor Local x2APIC Affinity structure in the SRAT (ID 2).
+struct srat_x2apic_affinity {
+    uint8_t type;
+    uint8_t length;
+    uint16_t reserved1;
+    uint32_t proximity_domain;
+    uint32_t x2apic_id;
+    uint32_t flags;                     // Bit 0 - enabled.
+    uint32_t clock_domain;
+    uint32_t reserved2;
+} __attribute__((packed));
+
+// System Locality Information Table (SLIT), a matrix of relative distances between proximity domains.
+struct slit {
+    struct sysdesc desc;
+    uint64_t num_localities;
+    uint8_t entries[];                  // num_localities * num_localities distances, 10 is local.
+} __attribute__((packed));
+
 #define IOAPIC_LIST_LEN 32
 #define ISO_LIST_LEN 128
+#define SRAT_MEM_LIST_LEN 64
+#define SRAT_CPU_LIST_LEN 256
+
+#define NUMA_MAX_NODES 8
+#define NUMA_LOCAL_DISTANCE 10
+#define NUMA_REMOTE_DISTANCE 20
+
+// Maps a CPU's APIC ID to the NUMA node it belongs to.
+struct numa_cpu {
+    uint32_t apic_id;
+    uint32_t node;
+};
 
 extern struct ioapic *ioapic_list[];
 extern struct iso *iso_list[];
 extern struct hpet *hpet;
 extern struct mcfg_entry *mcfg;
+extern struct srat_mem_affinity *srat_mem_list[];
+extern uint32_t numa_node_count;
+
+uint32_t acpi_numa_node(uint32_t proximity_domain);
+uint32_t acpi_numa_node_of_apic(uint32_t apic_id);
+uint8_t acpi_numa_distance(uint32_t from_node, uint32_t to_node);
 
 #endif
\ No newline at end of file
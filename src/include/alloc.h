@@ -21,9 +21,31 @@
 #include <stddef.h>
 
 //#define ALLOC_USEBUMP
-#define ALLOC_USESLOB
+//#define ALLOC_USESLOB
+#define ALLOC_USESLAB
+
+/* Per-CPU object caches in front of the slab allocator. */
+#define ALLOC_CPU_CACHE_SIZE    32      // Objects cached per size class on each CPU.
+#define ALLOC_CPU_CACHE_BATCH   16      // Objects moved to or from the slab allocator at a time.
+#define ALLOC_REMOTE_BATCH      32      // Objects owned by other CPUs held before handing them back.
+#define ALLOC_CPU_CACHE_DRAIN_PAGES 4096 // Free PMM pages below which an idle CPU gives its cached objects back.
+
+/* Heap profiling, request sizes and call sites of every malloc(). */
+//#define ALLOC_PROFILE
+#define ALLOC_PROFILE_BUCKETS   32      // Power of two size buckets.
+#define ALLOC_PROFILE_SITES     256     // Call sites tracked.
+#define ALLOC_PROFILE_TOP_SITES 10      // Call sites shown by alloc_profile_report().
 
 void *malloc(size_t size);
 void free(void *ptr);
+void *realloc(void *ptr, size_t size);
+void *calloc(size_t count, size_t size);
+void *aligned_alloc(size_t alignment, size_t size);
+void alloc_profile_report();
+void alloc_profile_report_serial();
+
+#ifdef ALLOC_USESLAB
+void alloc_cpu_cache_drain();
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,32 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef _BLOREOS_ALLOCBENCH_H
+#define _BLOREOS_ALLOCBENCH_H
+
+/* Allocations or frees each benchmark scenario runs. */
+#define ALLOC_BENCH_OPS         20000
+
+/* Allocations a scenario can have live at once. */
+#define ALLOC_BENCH_SLOTS       1024
+
+/* Allocations between producer and consumer in the producer/consumer scenario. */
+#define ALLOC_BENCH_QUEUE       256
+
+void alloc_benchmark();
+
+#endif
@@ -28,6 +28,10 @@
     00000000 01000000
 
     It's very useful for indicating what pages in the memory map are taken.
+
+    The range and search functions work on whole 64-bit words at a time, so bitmaps used with
+    them must be 8 byte aligned and sized to a multiple of 8 bytes. Bits past the end of the
+    bitmap in the last word should be kept set so they are never found as clear.
 */
 #ifndef _BLOREOS_BITMAP_H
 #define _BLOREOS_BITMAP_H
@@ -60,4 +64,180 @@ static inline void bitmap_off(void *bitmap, size_t bit) {
 }
 
 
+/* Returns a mask of 'count' bits starting at bit 'shift' in a 64-bit word. */
+static inline uint64_t _bitmap_word_mask(size_t shift, size_t count) {
+    return (count == 64) ? ~(uint64_t)0 : ((((uint64_t)1 << count) - 1) << shift);
+}
+
+/* Sets 'count' bits to 1 starting at bit 'start'. Whole words are written in one go. */
+static inline void bitmap_set_range(void *bitmap, size_t start, size_t count) {
+    uint64_t *words = (uint64_t*)bitmap;
+    size_t end = start + count;
+
+    while (start < end) {
+        size_t shift = start % 64;
+        size_t bits = (64 - shift < end - start) ? 64 - shift : end - start;
+
+        words[start / 64] |= _bitmap_word_mask(shift, bits);
+        start += bits;
+    }
+}
+
+/* Clears 'count' bits to 0 starting at bit 'start'. Whole words are written in one go. */
+static inline void bitmap_clear_range(void *bitmap, size_t start, size_t count) {
+    uint64_t *words = (uint64_t*)bitmap;
+    size_t end = start + count;
+
+    while (start < end) {
+        size_t shift = start % 64;
+        size_t bits = (64 - shift < end - start) ? 64 - shift : end - start;
+
+        words[start / 64] &= ~_bitmap_word_mask(shift, bits);
+        start += bits;
+    }
+}
+
+/*
+ * Returns the index of the first bit set to 0 in the range 'start' to 'end', or 'end' if there isn't one.
+ * Each word is tested whole and the bit found with tzcnt/bsf.
+*/
+static inline size_t bitmap_find_clear(const void *bitmap, size_t start, size_t end) {
+    const uint64_t *words = (const uint64_t*)bitmap;
+
+    while (start < end) {
+        uint64_t word = ~words[start / 64] & (~(uint64_t)0 << (start % 64));
+
+        if (word != 0) {
+            size_t bit = (start & ~(size_t)63) + __builtin_ctzll(word);
+            return bit < end ? bit : end;
+        }
+
+        start = (start & ~(size_t)63) + 64;
+    }
+
+    return end;
+}
+
+/* Returns the index of the first bit set to 1 in the range 'start' to 'end', or 'end' if there isn't one. */
+static inline size_t bitmap_find_set(const void *bitmap, size_t start, size_t end) {
+    const uint64_t *words = (const uint64_t*)bitmap;
+
+    while (start < end) {
+        uint64_t word = words[start / 64] & (~(uint64_t)0 << (start % 64));
+
+        if (word != 0) {
+            size_t bit = (start & ~(size_t)63) + __builtin_ctzll(word);
+            return bit < end ? bit : end;
+        }
+
+        start = (start & ~(size_t)63) + 64;
+    }
+
+    return end;
+}
+
+/*
+    A bitmap with a summary level on top. The summary holds a bit per 64-bit word of 'bits',
+    set when every bit in that word is set. Searching for a clear bit skips 64 full words
+    for every summary word it reads, so searches through mostly full bitmaps stay quick.
+*/
+struct summary_bitmap {
+    uint64_t *bits;
+    uint64_t *summary;
+    size_t num_bits;
+};
+
+/* Recalculates the summary bits for the words 'first' to 'last' (inclusive). */
+static inline void _sbitmap_update(struct summary_bitmap *sb, size_t first, size_t last) {
+    for (size_t word = first; word <= last; word++) {
+        if (sb->bits[word] == ~(uint64_t)0) {
+            bitmap_on(sb->summary, word);
+        } else {
+            bitmap_off(sb->summary, word);
+        }
+    }
+}
+
+static inline bool sbitmap_test(const struct summary_bitmap *sb, size_t bit) {
+    return bitmap_test(sb->bits, bit);
+}
+
+/* Sets 'count' bits to 1 starting at 'start', filling in the summary for any words that become full. */
+static inline void sbitmap_set_range(struct summary_bitmap *sb, size_t start, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    bitmap_set_range(sb->bits, start, count);
+
+    size_t first = start / 64;
+    size_t last = (start + count - 1) / 64;
+
+    // Words entirely inside the range are now full, only the partial words at the edges need checking.
+    _sbitmap_update(sb, first, first);
+    _sbitmap_update(sb, last, last);
+
+    if (last > first + 1) {
+        bitmap_set_range(sb->summary, first + 1, last - first - 1);
+    }
+}
+
+/* Clears 'count' bits to 0 starting at 'start'. Every word touched now has a clear bit. */
+static inline void sbitmap_clear_range(struct summary_bitmap *sb, size_t start, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    bitmap_clear_range(sb->bits, start, count);
+    bitmap_clear_range(sb->summary, start / 64, ((start + count - 1) / 64) - (start / 64) + 1);
+}
+
+/* Returns the index of the first clear bit at or after 'start', or 'num_bits' if there isn't one. */
+static inline size_t sbitmap_find_clear(const struct summary_bitmap *sb, size_t start) {
+    if (start >= sb->num_bits) {
+        return sb->num_bits;
+    }
+
+    // Check what's left of the word we start in.
+    size_t num_words = (sb->num_bits + 63) / 64;
+    size_t word = start / 64;
+    size_t bit = bitmap_find_clear(sb->bits, start, (word + 1) * 64);
+
+    if (bit < (word + 1) * 64) {
+        return bit < sb->num_bits ? bit : sb->num_bits;
+    }
+
+    // Then let the summary tell us the next word with anything clear in it.
+    word = bitmap_find_clear(sb->summary, word + 1, num_words);
+    if (word == num_words) {
+        return sb->num_bits;
+    }
+
+    bit = (word * 64) + __builtin_ctzll(~sb->bits[word]);
+    return bit < sb->num_bits ? bit : sb->num_bits;
+}
+
+/*
+ * Returns the index of the first run of 'count' clear bits at or after 'start',
+ * or 'num_bits' if there isn't a run long enough.
+*/
+static inline size_t sbitmap_find_clear_run(const struct summary_bitmap *sb, size_t start, size_t count) {
+    while (start < sb->num_bits) {
+        size_t run_start = sbitmap_find_clear(sb, start);
+
+        if (run_start + count > sb->num_bits) {
+            break;
+        }
+
+        size_t run_end = bitmap_find_set(sb->bits, run_start, run_start + count);
+        if (run_end == run_start + count) {
+            return run_start;
+        }
+
+        start = run_end;
+    }
+
+    return sb->num_bits;
+}
+
 #endif
\ No newline at end of file
@@ -19,9 +19,35 @@
 #define _BLOREOS_BUMP_H
 
 #include <stddef.h>
+#include <stdint.h>
+
+/* Pages an arena gets from the PMM each time it runs out, unless a request needs more. */
+#define ARENA_DEFAULT_CHUNK_PAGES 4
+
+/* Alignment of every arena allocation. */
+#define ARENA_ALIGN 16
+
+struct ArenaChunk {
+    struct ArenaChunk  *pNext;
+    size_t              pages;
+};
+
+/* Allocations start after the chunk header. */
+#define ARENA_CHUNK_HEADER_SIZE ((sizeof(struct ArenaChunk) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+struct Arena {
+    struct ArenaChunk  *pChunks;    // Newest chunk first, the cursor is in this one.
+    uint8_t            *pCursor;
+    uint8_t            *pEnd;
+    size_t              chunk_pages;
+};
+
+void arena_init(struct Arena *pArena, size_t chunk_pages);
+void *arena_alloc(struct Arena *pArena, size_t size);
+void arena_reset(struct Arena *pArena);
+void arena_destroy(struct Arena *pArena);
 
 void *bump_malloc(size_t size);
 void bump_free(void *ptr);
 
-
 #endif
\ No newline at end of file
@@ -30,14 +30,57 @@
 #define CR4_CET     0x800000    // [23]
 #define CR4_PKS     0x1000000   // [24]
 
+#define IA32_EFER_MSR       0xC0000080
+#define IA32_GS_BASE_MSR    0xC0000101
+
+#define EFER_NXE    0x800       // [11]
+
+// Maximum number of CPU cores we keep per-CPU state for.
+#define MAX_CPUS    64
+
 #include <stdint.h>
+#include <stddef.h>
 #include <str.h>
 #include <stdbool.h>
 
+/*
+    State private to a single CPU core. The IA32_GS_BASE MSR of each core points at its own
+    entry, so a core can find its state with a single GS relative load.
+    Entries are cache line aligned so cores never share a line.
+*/
+struct cpu_local {
+    struct cpu_local *self;
+    uint32_t index;         // Dense 0-based index of this CPU, the BSP is 0.
+    uint32_t lapic_id;
+    uint32_t node;          // NUMA node this CPU belongs to.
+} __attribute__((aligned(64)));
+
 extern uint32_t bsp_lapic_id;      // Bootstrap processor APIC ID.
 extern uint64_t cpu_count;
+extern struct cpu_local cpu_locals[MAX_CPUS];
 
 extern void cpu_init();
+extern void cpu_local_init(uint32_t index);
+
+/*
+ * Returns the index of the CPU we are running on. cpu_local_init() must have been called on this CPU.
+*/
+static inline uint32_t cpu_index()
+{
+    uint32_t index;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(index) : "i"(offsetof(struct cpu_local, index)));
+    return index;
+}
+
+/*
+ * Returns the NUMA node of the CPU we are running on.
+*/
+static inline uint32_t cpu_node()
+{
+    uint32_t node;
+    asm volatile ("movl %%gs:%c1, %0" : "=r"(node) : "i"(offsetof(struct cpu_local, node)));
+    return node;
+}
 
 /* Sends a 8-bit value to a I/O location */
 static inline void outb(uint16_t port, uint8_t val)
@@ -115,6 +158,22 @@ static inline uint64_t read_msr(uint32_t msr_id)
     return ((uint64_t) high << 32) | low;
 }
 
+/* Reads the time stamp counter. */
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    asm volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static inline void write_msr(uint32_t msr_id, uint64_t val)
+{
+    asm volatile (
+        "wrmsr" ::
+        "a"((uint32_t)val), "d"((uint32_t)(val >> 32)), "c"(msr_id)
+    );
+}
+
 /*
     Control registers, only available in ring-0.
 
@@ -162,6 +221,22 @@ static inline uint64_t get_cr4()
     return val;
 }
 
+static inline void set_cr3(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr3" :: "r"(val) : "memory");
+}
+
+static inline void set_cr4(uint64_t val)
+{
+    asm volatile ("movq %0, %%cr4" :: "r"(val) : "memory");
+}
+
+// Drops the TLB entry (of any page size) and the paging-structure caches covering the address.
+static inline void invlpg(uint64_t virt_addr)
+{
+    asm volatile ("invlpg (%0)" :: "r"(virt_addr) : "memory");
+}
+
 static inline void cpuid(int code, uint32_t *a, uint32_t *d)
 {
     asm volatile (
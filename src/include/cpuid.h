@@ -19,6 +19,7 @@
 #define _BLOREOS_CPUID_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 static inline void get_cpu_vendor(char *buffer)
 {
@@ -105,4 +106,94 @@ static inline void get_cpu_frequency(uint32_t *baseFrequencyMHz, uint32_t *maxFr
     *busFrequencyMHz = ecx & 0xFFFF;
 }
 
+/*
+ * Returns true if the CPU supports Enhanced REP MOVSB/STOSB (CPUID leaf 7, EBX bit 9).
+*/
+static inline bool cpu_has_erms() {
+    uint32_t eax, ebx, ecx, edx;
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0)
+    );
+
+    if (eax < 7) {
+        return false;
+    }
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(7), "c"(0)
+    );
+
+    return (ebx >> 9) & 1;
+}
+
+/* Cache types reported by CPUID leaf 4. */
+#define CPU_CACHE_NULL          0
+#define CPU_CACHE_DATA          1
+#define CPU_CACHE_INSTRUCTION   2
+#define CPU_CACHE_UNIFIED       3
+
+/*
+ * Geometry of a cache, see get_cpu_cache().
+*/
+struct cpu_cache {
+    uint32_t type;          // CPU_CACHE_ type.
+    uint32_t level;
+    uint32_t line_size;     // Bytes per line.
+    uint32_t partitions;    // Lines per tag.
+    uint32_t ways;
+    uint32_t sets;
+    uint64_t size;          // Bytes in total.
+};
+
+/*
+ * Reads the geometry of cache 'index' from CPUID leaf 4 (deterministic cache parameters), or from
+ * leaf 0x8000001D on AMD, which has the same layout. Returns false once 'index' is past the last cache.
+*/
+static inline bool get_cpu_cache(uint32_t index, struct cpu_cache *pCache) {
+    uint32_t eax, ebx, ecx, edx;
+    uint32_t leaf = 4;
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(0)
+    );
+
+    // "AuthenticAMD" starts with "Auth" in EBX.
+    if (ebx == 0x68747541) {
+        leaf = 0x8000001D;
+
+        asm volatile(
+            "cpuid"
+            : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+            : "a"(0x80000000)
+        );
+    }
+
+    if (eax < leaf) {
+        return false;
+    }
+
+    asm volatile(
+        "cpuid"
+        : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+        : "a"(leaf), "c"(index)
+    );
+
+    pCache->type = eax & 0x1F;
+    pCache->level = (eax >> 5) & 0x7;
+    pCache->line_size = (ebx & 0xFFF) + 1;
+    pCache->partitions = ((ebx >> 12) & 0x3FF) + 1;
+    pCache->ways = ((ebx >> 22) & 0x3FF) + 1;
+    pCache->sets = ecx + 1;
+    pCache->size = (uint64_t)pCache->line_size * pCache->partitions * pCache->ways * pCache->sets;
+
+    return pCache->type != CPU_CACHE_NULL;
+}
+
 #endif
\ No newline at end of file
@@ -20,27 +20,208 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <limine.h>
 
 #define PAGE_SIZE 4096
 
+/* Order of the largest block the buddy allocator manages, 2^18 pages (1 GiB). */
+#define BUDDY_MAX_ORDER 18
+
+/* Block orders of the large page sizes, for use with kalloc_huge(). */
+#define HUGE_PAGE_2M_ORDER  9
+#define HUGE_PAGE_1G_ORDER  18
+#define HUGE_PAGE_2M_SIZE   (PAGE_SIZE << HUGE_PAGE_2M_ORDER)
+#define HUGE_PAGE_1G_SIZE   ((uint64_t)PAGE_SIZE << HUGE_PAGE_1G_ORDER)
+
+/* Memory zones. DMA32 holds the memory below 4 GiB for devices limited to 32-bit addresses. */
+#define MEM_ZONE_DMA32      0
+#define MEM_ZONE_NORMAL     1
+#define MEM_ZONE_COUNT      2
+#define ZONE_DMA32_LIMIT    0x100000000
+
+/* Flags for kalloc_zone(). */
+#define KALLOC_DMA32        0x1
+#define KALLOC_ZERO         0x2
+#define KALLOC_COLOR        0x4     // Start each allocation on the next cache color, for hot data.
+
+/*
+    Most page colors tracked, and the free pages kept per color for single page KALLOC_COLOR
+    allocations. The colors come from the L2 cache geometry, see kmem_page_colors().
+*/
+#define PMM_MAX_COLORS          128
+#define PMM_COLOR_LIST_PAGES    8
+
+/* Rounds over its pages kmem_color_benchmark() times, reading every PMM_COLOR_BENCH_STRIDE bytes. */
+#define PMM_COLOR_BENCH_ROUNDS  2000
+#define PMM_COLOR_BENCH_STRIDE  64
+
+/* Pre-zeroed page pool size, pages zeroed per kmem_zero_pool_fill() call, and the free pages it leaves alone. */
+#define ZERO_POOL_CAPACITY          512
+#define ZERO_POOL_BATCH             16
+#define ZERO_POOL_MIN_FREE_PAGES    4096
+
+/* Buffer size from which the mem* functions switch to the ERMS string instructions. */
+#define MEMOPS_ERMS_THRESHOLD   256
+
+/* Bytes moved per size bucket by memops_benchmark(), and its largest bucket. */
+#define MEMOPS_BENCH_BYTES      (16 * 1024 * 1024)
+#define MEMOPS_BENCH_MAX_SIZE   (1024 * 1024)
+
+/* Per-CPU page magazine size and default watermarks, see kmem_pcp_tune(). */
+#define PCP_CAPACITY        256
+#define PCP_DEFAULT_LOW     64
+#define PCP_DEFAULT_HIGH    192
+
+/* Maximum number of page ranges the NUMA nodes can be split in to. */
+#define MEM_MAX_RANGES 32
+
+/* Pages made available during kmem_init() (64 MiB), the rest waits for kmem_init_deferred(). */
+#define PMM_BOOT_PAGES          16384
+
+/* Pages set up per chunk by kmem_init_deferred(), a multiple of the 4096 pages a bitmap summary word covers. */
+#define PMM_DEFER_CHUNK_PAGES   32768
+
+/*
+    Physical memory is tracked in sections of 2^PMM_SECTION_SHIFT pages, the size of the largest
+    buddy block (1 GiB). Sections without usable memory get no bitmap or page descriptors.
+*/
+#define PMM_SECTION_SHIFT       BUDDY_MAX_ORDER
+#define PMM_SECTION_PAGES       ((uint64_t)1 << PMM_SECTION_SHIFT)
+
+/*
+    Page descriptors are allocated in blocks covering 2^PMM_DESC_CHUNK_SHIFT pages (2 MiB), once the
+    first page they describe is allocated. A block of descriptors takes 2^PMM_DESC_BLOCK_ORDER pages,
+    carved out of a per-node pool of 2^PMM_DESC_POOL_ORDER pages so they stay out of each other's way.
+*/
+#define PMM_DESC_CHUNK_SHIFT    9
+#define PMM_DESC_CHUNK_PAGES    ((uint64_t)1 << PMM_DESC_CHUNK_SHIFT)
+#define PMM_DESC_BLOCK_ORDER    2
+#define PMM_DESC_POOL_ORDER     9
+
+/* struct page flags. */
+#define PAGE_SLAB       0x02    // Owned by a slab cache.
+#define PAGE_CACHE      0x04    // Holds cached data, pOwner is the cache.
+#define PAGE_PINNED     0x08    // Must stay at this physical address, e.g. for DMA.
+#define PAGE_DIRTY      0x10    // Changed since it was last written back.
+#define PAGE_MOVABLE    0x20    // Can be migrated by compaction, pOwner is its struct page_mover.
+
+/* Smallest order background compaction tries to keep a free block of (2 MiB), and how often it may run. */
+#define PMM_COMPACT_ORDER       9
+#define PMM_COMPACT_INTERVAL    (1ULL << 31)
+
+/* Value of an LRU link that doesn't point at a page. */
+#define PAGE_LRU_NONE   0xFFFFFFFF
+
+/*
+    Descriptor of a physical page. An allocation is described by the descriptor of its first page,
+    and only allocations of up to PMM_DESC_CHUNK_PAGES pages are sure to have descriptors for the
+    rest of their pages. Free memory has none. Kept to 32 bytes so two fit in a cache line.
+*/
+struct page {
+    void *pOwner;               // Whoever the flags say owns the page, such as a slab or cache.
+    uint32_t pages_allocated;   // Number of pages allocated starting at this page.
+    uint32_t refcount;          // References to the allocation, it's freed when this drops to 0.
+    uint32_t lru_next;          // Page indexes of the neighbours in a page_list, or PAGE_LRU_NONE.
+    uint32_t lru_prev;
+    uint16_t flags;             // PAGE_ flags.
+    uint32_t index;             // Index of the page this describes.
+} __attribute__((aligned(32)));
+
+/*
+    Owner of movable pages, see kmem_set_movable(). Usually embedded in a bigger structure.
+*/
+struct page_mover {
+    bool (*migrate)(struct page_mover *pMover, void *pOld, void *pNew);
+};
+
+/* A list of pages linked through their descriptors, oldest first. Initialise with PAGE_LIST_INIT. */
+struct page_list {
+    uint32_t head;
+    uint32_t tail;
+    uint64_t count;
+};
+
+#define PAGE_LIST_INIT { PAGE_LRU_NONE, PAGE_LRU_NONE, 0 }
+
+/* Buckets in the free run histogram, bucket n counts runs of 2^n up to 2^(n+1) - 1 pages. */
+#define KMEM_RUN_BUCKETS 64
+
+/* Snapshot of the PMM taken by kmem_get_stats(). */
+struct kmem_stats {
+    uint64_t total_pages;
+    uint64_t free_pages;                            // Pages held by the buddy allocator.
+    uint64_t pcp_pages;                             // Free pages sitting in per-CPU magazines.
+    uint64_t zero_pool_pages;
+    uint64_t zero_pool_hits;
+    uint64_t zero_pool_misses;
+    uint64_t zone_free_pages[MEM_ZONE_COUNT];
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t alloc_failures;
+    uint64_t compact_runs;
+    uint64_t compact_successes;
+    uint64_t compact_pages_migrated;
+    uint64_t color_pages;                           // Free pages sitting in the color lists.
+    uint64_t desc_pages;                            // Pages set aside for page descriptors.
+    uint64_t desc_chunks;                           // Chunks of PMM_DESC_CHUNK_PAGES pages with descriptors.
+    uint64_t largest_free_run;                      // Pages in the largest run of contiguous free pages.
+    uint64_t free_runs[KMEM_RUN_BUCKETS];           // Histogram of contiguous free run sizes.
+    uint64_t free_blocks[BUDDY_MAX_ORDER + 1];      // Free buddy blocks at each order.
+};
+
 extern volatile struct limine_memmap_response *memmap;
 
 extern uint64_t total_memory_bytes;
 extern uint64_t max_pages_available;
 extern uint64_t num_pages_available;
 extern uint64_t vmm_higher_half_offset;
+extern uint32_t pcp_low_watermark;
+extern uint32_t pcp_high_watermark;
+extern uint64_t zero_pool_hits;
+extern uint64_t zero_pool_misses;
 
 void kmem_init();
+void kmem_init_deferred();
+void kmem_numa_init();
 void* memmap_alloc(size_t length);
 void* kalloc(size_t numBytes);
 void* kpalloc(size_t numPages);
+void* kalloc_node(uint32_t node, size_t numBytes);
+void* kpalloc_node(uint32_t node, size_t numPages);
+void* kalloc_huge(size_t numBytes, uint8_t order);
+void* kalloc_zone(size_t numBytes, uint32_t flags);
+uint64_t kmem_zone_free_pages(uint32_t zone);
+void kmem_zero_pool_fill();
+void kmem_zero_pool_drain();
+uint32_t kmem_zero_pool_count();
+uint32_t kmem_page_colors();
+uint32_t kmem_page_color(void *ptr);
+void kmem_color_drain();
+void kmem_color_benchmark();
+void kmem_get_stats(struct kmem_stats *pStats);
+void kmem_report();
+void kmem_report_serial();
+void kmem_set_movable(void *ptr, struct page_mover *pMover);
+void kmem_compact_background();
+struct page* kmem_page(void *ptr);
+void* kmem_page_addr(struct page *pPage);
+void page_get(struct page *pPage);
+void page_put(struct page *pPage);
+void page_list_add(struct page_list *pList, struct page *pPage);
+void page_list_remove(struct page_list *pList, struct page *pPage);
+struct page* page_list_pop(struct page_list *pList);
 void kfree(void *ptr);
+void kmem_pcp_drain();
+void kmem_pcp_tune(uint32_t low, uint32_t high);
 
 void memdumps(void *location, uint64_t len_bytes);
 void memdumpx32(void *location, uint64_t len_bytes);
 void memdumpx64(void *location, uint64_t len_bytes);
 
+void memops_init();
+void memops_benchmark();
+
 void *memset(void *s, int c, size_t n);
 void *memmove(void *dest, const void *src, size_t n);
 int memcmp(const void *s1, const void *s2, size_t n);
@@ -0,0 +1,44 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef _BLOREOS_MEMBLOCK_H
+#define _BLOREOS_MEMBLOCK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/* Most separate reserved regions the early allocator can track. Neighbouring regions are merged. */
+#define MEMBLOCK_MAX_REGIONS    128
+
+/* Smallest alignment handed out, anything smaller is rounded up to this. */
+#define MEMBLOCK_MIN_ALIGN      8
+
+/* Alignment for tables the PMM reads all the time, so they start on a cache line. */
+#define MEMBLOCK_CACHE_LINE_SIZE 64
+
+/* Upper address limit for memblock_alloc_range() that places no limit. */
+#define MEMBLOCK_ALLOC_ANYWHERE UINT64_MAX
+
+void* memblock_alloc(size_t size, size_t align);
+void* memblock_alloc_range(size_t size, size_t align, uint64_t min_addr, uint64_t max_addr);
+void memblock_free(void *ptr, size_t size);
+bool memblock_find_free(uint64_t base, uint64_t end, uint64_t *pStart, uint64_t *pEnd);
+uint64_t memblock_reserved_pages();
+void memblock_seal();
+
+#endif
@@ -0,0 +1,59 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef _BLOREOS_SLAB_H
+#define _BLOREOS_SLAB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    Largest allocation served from a size class, anything bigger gets whole pages from the PMM.
+    Every size class from 16 up to this in powers of two has objects aligned to their size.
+*/
+#define SLAB_MAX_SIZE 2048
+
+/* Number of size classes, see size_classes in slab.c. */
+#define SLAB_NUM_CLASSES 14
+
+/* Empty slabs a size class keeps around before giving them back to the PMM. */
+#define SLAB_MAX_EMPTY 2
+
+/* Alignment that keeps objects of a named cache on cache lines of their own. */
+#define SLAB_CACHE_LINE_SIZE 64
+
+/* Named caches use slabs of up to SLAB_CACHE_MAX_PAGES pages to fit at least this many objects. */
+#define SLAB_CACHE_MIN_OBJECTS 8
+#define SLAB_CACHE_MAX_PAGES 16
+
+struct SlabCache;
+
+void slab_init();
+void *slab_malloc(size_t size);
+void slab_free(void *ptr);
+size_t slab_usable_size(void *ptr);
+int slab_size_class(size_t size);
+int slab_object_class(void *ptr, uint32_t *pOwner);
+uint32_t slab_alloc_batch(int class, void **ppObjects, uint32_t count, uint32_t owner);
+void slab_free_batch(void **ppObjects, uint32_t count);
+
+struct SlabCache *kmem_cache_create(const char *pName, size_t size, size_t align, void (*ctor)(void *pObject));
+void *kmem_cache_alloc(struct SlabCache *pCache);
+void kmem_cache_free(struct SlabCache *pCache, void *ptr);
+void kmem_cache_report();
+
+#endif
@@ -19,10 +19,13 @@
 #define _BLOREOS_SLOB_H
 
 #include <stddef.h>
+#include <stdbool.h>
 
 void slob_init();
 void *slob_malloc(size_t size);
 void slob_free(void *ptr);
+size_t slob_usable_size(void *ptr);
+bool slob_grow_in_place(void *ptr, size_t size);
 
 
 #endif
\ No newline at end of file
@@ -19,7 +19,33 @@
 #define _BLOREOS_VM_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Flags for vm_map() and vm_protect(). A mapping is always readable, anything else is opt-in.
+    VM_EXEC is only enforced when the CPU has NX enabled.
+*/
+#define VM_WRITE            0x1
+#define VM_EXEC             0x2
+#define VM_USER             0x4
+#define VM_WRITETHROUGH     0x8
+#define VM_NOCACHE          0x10
+#define VM_GLOBAL           0x20
+
+/*
+    Pages an operation can change before the TLB is flushed whole instead of page by page with invlpg.
+    Past this a single CR3 reload (or CR4.PGE toggle) is cheaper than the invlpgs and refilling the TLB.
+*/
+#define VM_FLUSH_THRESHOLD  32
 
 void vm_init();
+uint64_t walk_page_table(uint64_t virt_addr);
+bool vm_map(uint64_t virt_addr, uint64_t phys_addr, uint32_t flags);
+bool vm_map_range(uint64_t virt_addr, uint64_t phys_addr, uint64_t size, uint32_t flags);
+void vm_unmap(uint64_t virt_addr);
+void vm_unmap_range(uint64_t virt_addr, uint64_t size);
+bool vm_protect(uint64_t virt_addr, uint32_t flags);
+bool vm_protect_range(uint64_t virt_addr, uint64_t size, uint32_t flags);
+void vm_report();
 
-#endif
\ No newline at end of file
+#endif
@@ -26,6 +26,7 @@
 #include <cpuid.h>
 #include <mem.h>
 #include <slob.h>
+#include <slab.h>
 #include <alloc.h>
 #include <vm.h>
 #include <gdt.h>
@@ -65,10 +66,12 @@ void kernel_main(void)
     term_fgcolor(TERM_DEFAULT_FGCOLOR);
 
     report_cpu_details();
+    memops_init();
 
     disable_interrupts();
 
     init_gdt();
+    cpu_local_init(0);
     idt_init();
     pit_disable_timer();
 
@@ -77,11 +80,17 @@ void kernel_main(void)
     kprintf("GDT/IDT initialized.\n");
 
     kmem_init();
+#ifdef ALLOC_USESLOB
     slob_init();
+#endif
+#ifdef ALLOC_USESLAB
+    slab_init();
+#endif
 
     kprintf("PMM Available Pages: %lu\n", num_pages_available);
 
     acpi_init();
+    kmem_numa_init();
     
     hpet_init();
 
@@ -124,6 +133,16 @@ void kernel_main(void)
             if (pKE != NULL) {
                 term_keyevent(pKE);
             }
+        } else {
+            // Nothing to do, get some pages zeroed ahead of time and tidy up free memory.
+#ifdef ALLOC_USESLAB
+            // With memory running low, hand back the objects this CPU has cached so their slabs can be freed.
+            if (num_pages_available < ALLOC_CPU_CACHE_DRAIN_PAGES) {
+                alloc_cpu_cache_drain();
+            }
+#endif
+            kmem_zero_pool_fill();
+            kmem_compact_background();
         }
     }
 
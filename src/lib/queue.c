@@ -23,25 +23,46 @@
 #include <str.h>
 #include <kernel.h>
 #include <atomic.h>
+#include <slab.h>
+
+static struct SlabCache *cqueue_cache;
+
+/*
+ * Puts a queue from the cache in its empty state. Queues are freed back in this state.
+*/
+static void _cqueue_ctor(void *pObject)
+{
+    CQueue_t *q = (CQueue_t*)pObject;
+    q->buff = NULL;
+    q->len = 0;
+    q->read_i = 0;
+    q->write_i = 0;
+    q->num_items = 0;
+    q->lock.lock = 0;
+}
 
 /*
  * Creates a new cqueue with the specified internal buffer length.
- * Try to keep the len < the memory page size of 4096 bytes, which
- * would mean that len at maximum would be 1017 to fit in to 1 page.
+ * The queue comes ready emptied from its cache, only the buffer is allocated.
 */
 CQueue_t* cqueue_create(uint32_t len)
 {
-    // Allocate the struct and buffer next to each other to ensure
-    // at least a single page is used in the PMM.
-    char *mem = (char*)malloc(sizeof(CQueue_t) + (sizeof(uint32_t) * len));
+    if (cqueue_cache == NULL) {
+        cqueue_cache = kmem_cache_create("cqueue", sizeof(CQueue_t), SLAB_CACHE_LINE_SIZE, _cqueue_ctor);
+    }
+
+    CQueue_t *q = (CQueue_t*)kmem_cache_alloc(cqueue_cache);
+    if (q == NULL) {
+        return NULL;
+    }
+
+    q->buff = (uint32_t*)malloc(sizeof(uint32_t) * len);
+    if (q->buff == NULL) {
+        kmem_cache_free(cqueue_cache, q);
+        return NULL;
+    }
 
-    CQueue_t *q = (CQueue_t*)mem;
-    uint32_t *buff = (uint32_t*)&mem[sizeof(CQueue_t)];
-    q->buff = buff;
     q->len = len;
-    q->read_i = 0;
-    q->write_i = 0;
-    q->num_items = 0;
     return q;
 }
 
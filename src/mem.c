@@ -17,6 +17,13 @@
 */
 /*
     This is the physical memory manager, dealing with physical available memory only.
+
+    Free memory is managed by a binary buddy allocator. Free blocks are always a power of two
+    pages in size (the block "order") and naturally aligned to their size. Each order has its
+    own free list, with the list links stored inside the free blocks themselves, so finding a
+    block is a matter of popping the first list with something in it and splitting it down.
+    When a block is freed, it is merged with its buddy (the neighbouring block of the same
+    order) for as long as the buddy is also free, keeping large contiguous runs available.
 */
 #include <stdint.h>
 #include <stdarg.h>
@@ -29,6 +36,11 @@
 #include <math.h>
 #include <bitmap.h>
 #include <kernel.h>
+#include <cpu.h>
+#include <acpi.h>
+#include <cpuid.h>
+#include <serial.h>
+#include <memblock.h>
 
 spinlock_t lock = {0};
 
@@ -56,64 +68,290 @@ uint64_t highest_address = 0;
 uint64_t lowest_address = 0;
 
 /*
-    Number of pages found between the lowest and highest memory locations
-    reported in the memory map entries.
+    Number of pages with metadata, the pages of every section holding usable memory.
+    Page indexes count through those sections one after another, skipping the holes between them.
 */
 static uint64_t num_pages_in_map = 0;
 
+/*
+    Sections with usable memory, in address order. Page index 'page' lives in section
+    page >> PMM_SECTION_SHIFT, which starts at section_base[] physically. section_index[] maps
+    every section from lowest_address to highest_address back to its place in section_base[];
+    a hole gives the next section after it, so an address in a hole rounds up to that section.
+*/
+static uint64_t *section_base;
+static uint32_t *section_index;
+static uint64_t num_sections = 0;
+static uint64_t num_section_slots = 0;
+
 /*
     The page bitmap tracks all pages in the entire memory map from lowest and highest points
-    in the memory map. A bit value of 0 marks a free page.
+    in the memory map. A bit value of 0 marks a free page held by the buddy allocator.
+    Its summary level marks every 64 page word that is entirely in use, for quick free run searches.
 */
-static uint8_t *page_bitmap = NULL;
+static struct summary_bitmap page_bitmap = {0};
 
 /* The location in virtual memory to the higher-half offset where the physical memory is mapped. */
 uint64_t vmm_higher_half_offset = 0;
 
+uint64_t num_pages_available = 0;
+
 /*
-    The cursor tracks the last page index where we last allocated memory from.
-    To save finding pages, we allocate forwards from this and loop back around
-    if we go past the last page.
+    Radix index of the page descriptors, see struct page. Each entry points at the descriptors of
+    PMM_DESC_CHUNK_PAGES pages, or is NULL until one of those pages is allocated. That costs 8 bytes
+    per 2 MiB of memory, with the descriptors themselves growing with the memory actually in use.
 */
-uint64_t allocation_cursor = 0;
+static struct page **page_chunks;
+static uint64_t num_page_chunks = 0;
+static uint64_t num_desc_chunks = 0;
+static uint64_t num_desc_pages = 0;
 
-uint64_t num_pages_available = 0;
+/*
+    Pages set aside for a node's page descriptors. Descriptors never move or go away, so taking
+    them from one large block keeps them from breaking up the free memory around them.
+*/
+struct DescPool {
+    uint64_t next_page;
+    uint64_t end_page;
+};
 
-// The PageEntry helps us determine how pages our allocations reserve when they do a kalloc.
-// This helps know how many pages to free when we come to free that memory.
-// At 4 bytes per entry, the cost of this metadata is approx. 2MB for a 2GB system.
-struct PageEntry {
-    uint32_t pages_allocated;  // Number of pages allocated starting at this entry.
-} __attribute__((packed));
+static struct DescPool desc_pools[NUMA_MAX_NODES];
 
-// Contains a PageEntry item per page in memory.
-struct PageEntry* entry_map;
+/*
+    Has a bit set for the first page of every free buddy block, the order of the block is kept
+    in its struct FreeBlock. Free memory needs no page descriptors that way.
+*/
+static uint64_t *free_heads;
 
-// GCC and Clang reserve the right to generate calls to the following
-// 4 functions even if they are not directly called.
-// Implement them as the C specification mandates.
-// DO NOT remove or rename these functions, or stuff will eventually break!
-void *memcpy(void *dest, const void *src, size_t n)
+/*
+    Free block list node. This lives in the first bytes of every free block, so the free
+    lists cost us no memory of their own.
+*/
+struct FreeBlock {
+    struct FreeBlock *pNext;
+    struct FreeBlock *pPrev;
+    uint8_t order;
+};
+
+/*
+    A zone of a node's memory. Memory below 4 GiB is kept in the DMA32 zone for devices that can
+    only address 32 bits, and is only handed out for other uses once the NORMAL zone runs dry.
+*/
+struct MemZone {
+    struct FreeBlock *free_lists[BUDDY_MAX_ORDER + 1];  // A free list per block order, order n holds blocks of 2^n pages.
+    uint64_t free_counts[BUDDY_MAX_ORDER + 1];          // Number of blocks held in each free list.
+    uint64_t free_pages;
+};
+
+/*
+    A NUMA node's share of the buddy allocator. Every node has its own free lists so memory can be
+    handed out from the node closest to the CPU asking for it. Until the ACPI tables are parsed
+    everything belongs to node 0.
+*/
+struct MemNode {
+    struct MemZone zones[MEM_ZONE_COUNT];
+    uint32_t fallback[NUMA_MAX_NODES];                  // Nodes to allocate from, nearest first, starting with this one.
+};
+
+static struct MemNode mem_nodes[NUMA_MAX_NODES];
+static uint32_t mem_node_count = 1;
+
+/*
+    The page ranges each node owns, sorted and covering the whole map. Ranges are split at the
+    4 GiB zone boundary too, and buddy blocks never span two ranges, so a block always belongs
+    to a single node and zone.
+*/
+struct MemRange {
+    uint64_t start_page;
+    uint64_t end_page;
+    uint32_t node;
+    uint32_t zone;
+};
+
+static struct MemRange mem_ranges[MEM_MAX_RANGES];
+static uint32_t num_mem_ranges = 0;
+
+/* First page above the DMA32 zone. */
+static uint64_t dma32_end_page = 0;
+
+/*
+    Per-CPU magazine of free single pages. Single page allocations and frees are served from
+    the magazine of the CPU making the call without taking the global lock. The magazine is
+    refilled from the buddy allocator up to the low watermark when it runs dry, and drained back
+    down to the low watermark when it goes over the high watermark, so the lock is only taken
+    once per batch of pages.
+
+    Pages held in a magazine are marked as used in the bitmap and are not counted in num_pages_available.
+*/
+struct PageMagazine {
+    uint32_t count;
+    uint64_t allocs;        // Calls to allocate pages made on this CPU, kept here so counting them is free of contention.
+    uint64_t frees;         // Calls to free pages made on this CPU.
+    uint64_t pages[PCP_CAPACITY];
+} __attribute__((aligned(64)));
+
+static struct PageMagazine page_magazines[MAX_CPUS];
+
+uint32_t pcp_low_watermark = PCP_DEFAULT_LOW;
+uint32_t pcp_high_watermark = PCP_DEFAULT_HIGH;
+
+/*
+    Pool of single pages that have already been zeroed, filled by kmem_zero_pool_fill() while the
+    kernel is idle so KALLOC_ZERO allocations don't have to clear the page themselves. Pages in the
+    pool are allocated as far as the rest of the PMM is concerned.
+*/
+static spinlock_t zero_pool_lock = {0};
+static void *zero_pool[ZERO_POOL_CAPACITY];
+static uint32_t zero_pool_count = 0;
+
+uint64_t zero_pool_hits = 0;
+uint64_t zero_pool_misses = 0;
+
+/*
+    Page coloring. Pages whose physical addresses are a multiple of 'page_colors' pages apart map
+    to the same sets of the L2 cache, so data spread over pages of a single color can only use a
+    1 / page_colors share of it. KALLOC_COLOR allocations start on successive colors to avoid that.
+    Sections start on 1 GiB boundaries, so a page index has the same color as its physical address.
+
+    Single pages come from a list of free pages per color, refilled a block of 'page_colors' pages
+    at a time. Pages in the lists are used in the bitmap and not counted in num_pages_available.
+*/
+static uint32_t page_colors = 1;
+static uint32_t color_cache_level = 0;
+static uint32_t color_cache_ways = 0;
+static uint64_t color_cache_size = 0;
+static uint32_t next_color = 0;
+static uint64_t color_lists[PMM_MAX_COLORS][PMM_COLOR_LIST_PAGES];
+static uint32_t color_counts[PMM_MAX_COLORS];
+static uint64_t color_list_pages = 0;
+
+/*
+    Only the usable pages below 'deferred_start_page' are set up during kmem_init(), which is
+    enough to boot. The rest is set up in chunks of PMM_DEFER_CHUNK_PAGES by kmem_init_deferred(),
+    which any number of CPUs can run at once, each claiming the next chunk from 'deferred_next_page'.
+    Chunks are aligned so no two chunks share a word of the bitmap, its summary, or the free head bitmap.
+*/
+static uint64_t deferred_start_page = 0;
+static volatile uint64_t deferred_next_page = 0;
+static volatile uint64_t deferred_chunks_done = 0;
+static volatile uint64_t deferred_pages_freed = 0;
+static volatile uint64_t deferred_cpus = 0;
+static uint64_t boot_init_cycles = 0;
+
+/* Allocations that couldn't be satisfied. */
+static uint64_t alloc_failures = 0;
+
+/* Compaction counters, see _compact(). */
+static uint64_t compact_runs = 0;
+static uint64_t compact_successes = 0;
+static uint64_t compact_pages_migrated = 0;
+static uint64_t compact_last_tsc = 0;
+
+/*
+    The mem* functions below pick between three ways of doing the work. Small buffers use plain
+    8 byte word loops, which beat the startup cost of the string instructions. Larger buffers use
+    'rep movsb' and 'rep stosq' when the CPU has Enhanced REP MOVSB/STOSB (ERMS), where the
+    microcode moves whole cache lines at a time. memops_init() checks for ERMS at boot, until then
+    the word loops are used for everything.
+*/
+static bool memops_erms = false;
+
+/* A uint64_t that can be read or written at any alignment without upsetting the compiler. */
+typedef uint64_t __attribute__((may_alias, aligned(1))) unaligned_u64;
+
+static void _memcpy_bytes(void *dest, const void *src, size_t n)
 {
     uint8_t *pdest = (uint8_t *)dest;
     const uint8_t *psrc = (const uint8_t *)src;
 
-    for (size_t i = 0; i < n; i++)
-    {
+    for (size_t i = 0; i < n; i++) {
         pdest[i] = psrc[i];
     }
+}
 
-    return dest;
+static void _memcpy_words(void *dest, const void *src, size_t n)
+{
+    uint8_t *pdest = (uint8_t *)dest;
+    const uint8_t *psrc = (const uint8_t *)src;
+
+    for (; n >= 8; n -= 8, pdest += 8, psrc += 8) {
+        *(unaligned_u64 *)pdest = *(const unaligned_u64 *)psrc;
+    }
+
+    for (; n > 0; n--) {
+        *pdest++ = *psrc++;
+    }
 }
 
-void *memset(void *s, int c, size_t n)
+static void _memcpy_erms(void *dest, const void *src, size_t n)
+{
+    asm volatile ("rep movsb" : "+D"(dest), "+S"(src), "+c"(n) : : "memory");
+}
+
+static void _memset_bytes(void *s, int c, size_t n)
 {
     uint8_t *p = (uint8_t *)s;
 
-    for (size_t i = 0; i < n; i++)
-    {
+    for (size_t i = 0; i < n; i++) {
         p[i] = (uint8_t)c;
     }
+}
+
+static void _memset_words(void *s, int c, size_t n)
+{
+    uint8_t *p = (uint8_t *)s;
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)c;
+
+    for (; n >= 8; n -= 8, p += 8) {
+        *(unaligned_u64 *)p = pattern;
+    }
+
+    for (; n > 0; n--) {
+        *p++ = (uint8_t)c;
+    }
+}
+
+static void _memset_stosq(void *s, int c, size_t n)
+{
+    uint64_t pattern = 0x0101010101010101ULL * (uint8_t)c;
+    size_t words = n / 8;
+    size_t tail = n % 8;
+
+    asm volatile ("rep stosq" : "+D"(s), "+c"(words) : "a"(pattern) : "memory");
+    asm volatile ("rep stosb" : "+D"(s), "+c"(tail) : "a"(pattern) : "memory");
+}
+
+/*
+    Checks which mem* implementations this CPU is best suited to.
+*/
+void memops_init()
+{
+    memops_erms = cpu_has_erms();
+    kprintf("Memory ops: %s\n", memops_erms ? "ERMS rep movsb/stosq" : "8 byte words");
+}
+
+// GCC and Clang reserve the right to generate calls to the following
+// 4 functions even if they are not directly called.
+// Implement them as the C specification mandates.
+// DO NOT remove or rename these functions, or stuff will eventually break!
+void *memcpy(void *dest, const void *src, size_t n)
+{
+    if (memops_erms && n >= MEMOPS_ERMS_THRESHOLD) {
+        _memcpy_erms(dest, src, n);
+    } else {
+        _memcpy_words(dest, src, n);
+    }
+
+    return dest;
+}
+
+void *memset(void *s, int c, size_t n)
+{
+    if (memops_erms && n >= MEMOPS_ERMS_THRESHOLD) {
+        _memset_stosq(s, c, n);
+    } else {
+        _memset_words(s, c, n);
+    }
 
     return s;
 }
@@ -123,19 +361,19 @@ void *memmove(void *dest, const void *src, size_t n)
     uint8_t *pdest = (uint8_t *)dest;
     const uint8_t *psrc = (const uint8_t *)src;
 
-    if (src > dest)
-    {
-        for (size_t i = 0; i < n; i++)
-        {
-            pdest[i] = psrc[i];
-        }
+    // Copying forwards is safe whenever the destination starts below the source or the two
+    // don't overlap, since we never write over source bytes we haven't read yet.
+    if (pdest <= psrc || pdest >= psrc + n) {
+        return memcpy(dest, src, n);
     }
-    else if (src < dest)
-    {
-        for (size_t i = n; i > 0; i--)
-        {
-            pdest[i - 1] = psrc[i - 1];
-        }
+
+    // Overlapping with the destination above the source, copy backwards.
+    for (; n >= 8; n -= 8) {
+        *(unaligned_u64 *)(pdest + n - 8) = *(const unaligned_u64 *)(psrc + n - 8);
+    }
+
+    for (; n > 0; n--) {
+        pdest[n - 1] = psrc[n - 1];
     }
 
     return dest;
@@ -145,8 +383,16 @@ int memcmp(const void *s1, const void *s2, size_t n)
 {
     const uint8_t *p1 = (const uint8_t *)s1;
     const uint8_t *p2 = (const uint8_t *)s2;
+    size_t i = 0;
+
+    // Skip over the matching words, the bytes of the first one that differs are compared below.
+    for (; i + 8 <= n; i += 8) {
+        if (*(const unaligned_u64 *)(p1 + i) != *(const unaligned_u64 *)(p2 + i)) {
+            break;
+        }
+    }
 
-    for (size_t i = 0; i < n; i++)
+    for (; i < n; i++)
     {
         if (p1[i] != p2[i])
         {
@@ -157,6 +403,83 @@ int memcmp(const void *s1, const void *s2, size_t n)
     return 0;
 }
 
+/*
+ * Prints a rate of bytes per cycle held as hundredths.
+*/
+static void _print_rate(const char *name, uint64_t rate)
+{
+    kprintf(" %s %lu.%d%d", name, rate / 100, (int)(rate / 10 % 10), (int)(rate % 10));
+}
+
+/*
+ * Runs a copy or fill function over 'size' bytes enough times to move MEMOPS_BENCH_BYTES,
+ * returning the bytes per cycle in hundredths. Fill functions are passed the source as their value.
+*/
+static uint64_t _bench_memop(void (*fn)(void*, const void*, size_t), void *pDest, const void *pSrc, size_t size)
+{
+    uint64_t iterations = MAX(MEMOPS_BENCH_BYTES / size, 1);
+
+    // Warm the caches and TLB first so the first size bucket isn't penalised.
+    fn(pDest, pSrc, size);
+
+    uint64_t start = rdtsc();
+
+    for (uint64_t i = 0; i < iterations; i++) {
+        fn(pDest, pSrc, size);
+    }
+
+    uint64_t cycles = MAX(rdtsc() - start, 1);
+
+    return size * iterations * 100 / cycles;
+}
+
+static void _bench_memset_bytes(void *pDest, const void *pSrc, size_t n) { _memset_bytes(pDest, (int)(uint64_t)pSrc, n); }
+static void _bench_memset_words(void *pDest, const void *pSrc, size_t n) { _memset_words(pDest, (int)(uint64_t)pSrc, n); }
+static void _bench_memset_stosq(void *pDest, const void *pSrc, size_t n) { _memset_stosq(pDest, (int)(uint64_t)pSrc, n); }
+
+/*
+    Measures the bytes per cycle of each mem* implementation over a range of buffer sizes.
+*/
+void memops_benchmark()
+{
+    static const size_t sizes[] = { 64, 512, 4096, 65536, 1048576 };
+
+    uint8_t *pSrc = kpalloc(MEMOPS_BENCH_MAX_SIZE / PAGE_SIZE);
+    uint8_t *pDest = kpalloc(MEMOPS_BENCH_MAX_SIZE / PAGE_SIZE);
+
+    if (pSrc == NULL || pDest == NULL) {
+        kprintf("Memory ops benchmark couldn't allocate its buffers.\n");
+        kfree(pSrc);
+        kfree(pDest);
+        return;
+    }
+
+    _memset_words(pSrc, 0xA5, MEMOPS_BENCH_MAX_SIZE);
+
+    kprintf("Memory ops benchmark (bytes/cycle):\n");
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        kprintf("memcpy %lu:", sizes[i]);
+        _print_rate("bytes", _bench_memop(_memcpy_bytes, pDest, pSrc, sizes[i]));
+        _print_rate("words", _bench_memop(_memcpy_words, pDest, pSrc, sizes[i]));
+        if (memops_erms) {
+            _print_rate("erms", _bench_memop(_memcpy_erms, pDest, pSrc, sizes[i]));
+        }
+        kprintf("\n");
+
+        kprintf("memset %lu:", sizes[i]);
+        _print_rate("bytes", _bench_memop(_bench_memset_bytes, pDest, (void*)0x5A, sizes[i]));
+        _print_rate("words", _bench_memop(_bench_memset_words, pDest, (void*)0x5A, sizes[i]));
+        if (memops_erms) {
+            _print_rate("stosq", _bench_memop(_bench_memset_stosq, pDest, (void*)0x5A, sizes[i]));
+        }
+        kprintf("\n");
+    }
+
+    kfree(pSrc);
+    kfree(pDest);
+}
+
 /*
  * Prints the state of the bitmap at the specified indices.
 */
@@ -164,150 +487,192 @@ void _print_bitmap(uint64_t start, uint64_t len)
 {
     kprintf("Bitmap (%d-%d): ", start, start+len);
     for (uint64_t i = start; i < start+len; i++) {
-        kprintf(bitmap_test(page_bitmap, i) ? "1" : "0");
+        kprintf(sbitmap_test(&page_bitmap, i) ? "1" : "0");
     }
     kprintf("\n");
 }
 
 /*
- * Walks the memory map entries, setting the state of the bitmap with what it finds as usable memory. 
+ * Zeroes whole pages with non-temporal stores, which go straight to memory instead of
+ * filling the cache with lines nobody is going to read any time soon.
 */
-void _get_free_pages()
+static void _zero_pages_nt(void *pPages, uint64_t pages)
 {
-    kprintf("Searching for free memory pages...\n");
+    uint64_t *pData = (uint64_t*)pPages;
+    uint64_t *pEnd = pData + (pages * PAGE_SIZE / sizeof(uint64_t));
+
+    for (; pData < pEnd; pData += 4) {
+        asm volatile (
+            "movnti %1, 0(%0)\n"
+            "movnti %1, 8(%0)\n"
+            "movnti %1, 16(%0)\n"
+            "movnti %1, 24(%0)\n"
+            : : "r"(pData), "r"((uint64_t)0) : "memory");
+    }
 
-    // So we have a memory map allocated and its all full. Let's walk through the memory map entries again
-    // and start making pages available.
-    for (size_t i = 0; i < memmap->entry_count; i++) {
-        struct limine_memmap_entry *entry = memmap->entries[i];
+    // Non-temporal stores are weakly ordered, make sure they land before anyone uses the pages.
+    asm volatile ("sfence" : : : "memory");
+}
 
-        if (entry->type != LIMINE_MEMMAP_USABLE) {
-            kprintf(
-                "Memory Region Unusable: type %d, %d pages (%d mb)\n",
-                entry->type,
-                entry->length / PAGE_SIZE,
-                entry->length / 1024 / 1024);
+/*
+    Allocates zeroed whole pages from the early boot allocator, see memblock_alloc().
+    Only usable until the PMM has taken over the free memory in kmem_init().
+*/
+void* memmap_alloc(size_t length)
+{
+    void *pData = memblock_alloc(ALIGN_UP(length, PAGE_SIZE), PAGE_SIZE);
+    _zero_pages_nt(pData, DIV_ROUNDUP(length, PAGE_SIZE));
+    return pData;
+}
 
-            continue;
-        } else {
-            kprintf(
-                "Memory Region Usable: %d pages (%d mb)\n",
-                entry->length / PAGE_SIZE,
-                entry->length / 1024 / 1024);
-        }
+/*
+ * Splits any range that crosses the 4 GiB boundary in two and sets the zone of every range.
+*/
+static void _split_zone_ranges()
+{
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->start_page < dma32_end_page && pRange->end_page > dma32_end_page) {
+            // Ranges don't overlap so only one can cross, the callers leave a slot free for it.
+            if (num_mem_ranges == MEM_MAX_RANGES) {
+                kprintf("*FATAL*: No memory range slot left to split the range crossing 4 GiB.\n");
+                hcf();
+            }
 
-        // Find the page this entry refers to in our bitmap.
-        uint64_t start_bit = (entry->base - lowest_address) / PAGE_SIZE;
-        uint64_t pages_free = entry->length / PAGE_SIZE;
+            for (uint32_t j = num_mem_ranges; j > i + 1; j--) {
+                mem_ranges[j] = mem_ranges[j - 1];
+            }
 
-        // Marks all the pages as free for the size of this memory map entry.
-        for (uint64_t i = start_bit; i < start_bit + pages_free; i++) {
-            bitmap_off(page_bitmap, i);
-            num_pages_available++;
+            mem_ranges[i + 1] = *pRange;
+            mem_ranges[i + 1].start_page = dma32_end_page;
+            pRange->end_page = dma32_end_page;
+            num_mem_ranges++;
         }
+
+        pRange->zone = pRange->start_page < dma32_end_page ? MEM_ZONE_DMA32 : MEM_ZONE_NORMAL;
     }
 }
 
 /*
-    Finds space in the first memory map we can find and allocate space from it, adjusting
-    the limine mem map entry. 'length' is rounded up to the nearest page size.
+ * Allocates the page descriptor index and the free block head bitmap. No descriptors exist yet,
+ * and the bitmap is cleared as the pages it covers are set up.
 */
-void* memmap_alloc(size_t length)
+void _create_page_map()
 {
-    uint64_t size = ALIGN_UP(length, PAGE_SIZE);
+    num_page_chunks = DIV_ROUNDUP(num_pages_in_map, PMM_DESC_CHUNK_PAGES);
 
-    for (size_t i = 0; i < memmap->entry_count; i++) {
-        struct limine_memmap_entry *entry = memmap->entries[i];
+    uint64_t index_size = num_page_chunks * sizeof(struct page*);
+    uint64_t heads_size = DIV_ROUNDUP(num_pages_in_map, 64) * 8;
 
-        if (entry->type != LIMINE_MEMMAP_USABLE) {
-            continue;
-        }
+    kprintf("Page Descriptor Index Size: %lu Kib\n", DIV_ROUNDUP(index_size + heads_size, 1024));
 
-        if (entry->length >= size) {
-            // We've got a spot, lets point there.
-            void *pData = (void*)(entry->base + vmm_higher_half_offset);
+    page_chunks = (struct page**)memblock_alloc(index_size, MEMBLOCK_CACHE_LINE_SIZE);
+    memset(page_chunks, 0, index_size);
 
-            memset(pData, 0, size);
+    free_heads = (uint64_t*)memblock_alloc(heads_size, MEMBLOCK_CACHE_LINE_SIZE);
+}
 
-            // Change the values in the limine map as this part of mem is now permanently allocated to our kernel.
-            entry->length -= size;
-            entry->base += size;
-            max_pages_available -= (size / PAGE_SIZE);
-            
-            return pData;
-        }
-    }
+void _create_page_bitmap()
+{
+    // Convert page numbers (bits) to bytes (8 bits), rounded up to whole 64-bit words.
+    // The summary level follows with a bit per word of the bitmap.
+    // The block size for the bitmap aligns to the page size even though we might not need that much.
+    uint64_t bits_size = DIV_ROUNDUP(num_pages_in_map, 64) * 8;
+    uint64_t summary_size = DIV_ROUNDUP(bits_size / 8, 64) * 8;
+    uint64_t bitmap_size = ALIGN_UP(bits_size + summary_size, PAGE_SIZE);
 
-    kprintf("Couldn't allocate memory!");
-    hcf();
-    return 0;
+    kprintf("Page Bitmap Size: %lu Kib\n", bitmap_size / 1024);
+
+    // It's searched on every allocation that misses the free lists, so give it pages of its own.
+    page_bitmap.bits = (uint64_t*)memblock_alloc(bitmap_size, PAGE_SIZE);
+    page_bitmap.summary = (uint64_t*)((char*)page_bitmap.bits + bits_size);
+    page_bitmap.num_bits = num_pages_in_map;
+
+    // Now set all the bits to 1 in the map to mark everything as taken to start with.
+    // This includes the summary, as every word starts out full.
+    memset(page_bitmap.bits, 0xFF, bitmap_size);
 }
 
 /*
- * Finds memory to store the entry map, allocates it, and store a pointer to it.
+ * Returns the page index of a physical address. An address in a hole between sections gives the
+ * first page of the section after it, and one past the end of memory gives num_pages_in_map.
 */
-void _create_entry_map()
+static uint64_t _phys_to_page(uint64_t phys)
 {
-    uint64_t map_size = ALIGN_UP(sizeof(struct PageEntry) * num_pages_in_map, PAGE_SIZE);
-    kprintf("PageEntry Size: %lu bytes\n", map_size);
+    if (phys < lowest_address) {
+        return 0;
+    }
 
-    for (size_t i = 0; i < memmap->entry_count; i++) {
-        struct limine_memmap_entry *entry = memmap->entries[i];
+    uint64_t slot = (phys - lowest_address) / (PMM_SECTION_PAGES * PAGE_SIZE);
 
-        if (entry->type != LIMINE_MEMMAP_USABLE) {
-            continue;
-        }
+    if (slot >= num_section_slots) {
+        return num_pages_in_map;
+    }
 
-        if (entry->length >= map_size) {
-            // We've got a spot, lets point there.
-            entry_map = (struct PageEntry*)(entry->base + vmm_higher_half_offset);
+    uint64_t section = section_index[slot];
+    uint64_t section_start = lowest_address + slot * PMM_SECTION_PAGES * PAGE_SIZE;
 
-            memset(entry_map, 0, map_size);
+    if (section == num_sections) {
+        return num_pages_in_map;
+    }
 
-            // Change the values in the limine map as this part of mem is now permanently allocated to our kernel.
-            entry->length -= map_size;
-            entry->base += map_size;
-            max_pages_available -= (map_size / PAGE_SIZE);
-            break;
-        }
+    if (section_base[section] != section_start) {
+        return section << PMM_SECTION_SHIFT;
     }
+
+    return MIN((section << PMM_SECTION_SHIFT) + (phys - section_start) / PAGE_SIZE, num_pages_in_map);
 }
 
-void _create_page_bitmap()
+/*
+ * Finds the sections holding usable memory and numbers their pages. The last section only
+ * gets pages up to the end of memory.
+*/
+static void _init_sections()
 {
-    // Convert page numbers (bits) to bytes (8 bits).
-    // The block size for the bitmap aligns to the page size even though we might not need that much.
-    uint64_t bitmap_size = ALIGN_UP(num_pages_in_map / 8, PAGE_SIZE);
+    uint64_t section_bytes = PMM_SECTION_PAGES * PAGE_SIZE;
+    num_section_slots = DIV_ROUNDUP(highest_address - lowest_address, section_bytes);
 
-    kprintf("Page Bitmap Size: %lu Kib\n", bitmap_size / 1024);
+    section_index = (uint32_t*)memblock_alloc(num_section_slots * sizeof(uint32_t), MEMBLOCK_CACHE_LINE_SIZE);
+    memset(section_index, 0, num_section_slots * sizeof(uint32_t));
 
-    kprintf("Locating space for bitmap...\n");
-    
-    // Now we know how big our page map needs to be, let's find a spare place in memory
-    // to keep it.
+    // Mark the slots with usable memory, then number them.
     for (size_t i = 0; i < memmap->entry_count; i++) {
         struct limine_memmap_entry *entry = memmap->entries[i];
 
-        if (entry->type != LIMINE_MEMMAP_USABLE) {
+        if (entry->type != LIMINE_MEMMAP_USABLE || entry->length == 0) {
             continue;
         }
 
-        // Is this entry big enough to contain our bitmap?
-        if (entry->length >= bitmap_size) {
-            // We've got a spot, lets point there.
-            // We have to use the HHDM offset to correctly point to this physical place in virtual memory.
-            page_bitmap = (uint8_t*)(entry->base + vmm_higher_half_offset);
+        uint64_t first = (entry->base - lowest_address) / section_bytes;
+        uint64_t last = (entry->base + entry->length - 1 - lowest_address) / section_bytes;
+
+        for (uint64_t slot = first; slot <= last; slot++) {
+            section_index[slot] = 1;
+        }
+    }
+
+    for (uint64_t slot = 0; slot < num_section_slots; slot++) {
+        num_sections += section_index[slot];
+    }
 
-            // Now set all the bits to 1 in the map to mark everything as taken to start with.
-            memset(page_bitmap, 0xFF, bitmap_size);
+    section_base = (uint64_t*)memblock_alloc(num_sections * sizeof(uint64_t), MEMBLOCK_CACHE_LINE_SIZE);
 
-            // Change the values in the limine map as this part of mem is now permanently allocated to our kernel.
-            entry->length -= bitmap_size;
-            entry->base += bitmap_size;
-            max_pages_available -= (bitmap_size / PAGE_SIZE);
-            break;
+    // Walk down so each hole can point at the section above it.
+    uint64_t section = num_sections;
+    for (uint64_t slot = num_section_slots; slot > 0; slot--) {
+        if (section_index[slot - 1]) {
+            section--;
+            section_base[section] = lowest_address + (slot - 1) * section_bytes;
         }
+
+        section_index[slot - 1] = section;
     }
+
+    uint64_t last_pages = DIV_ROUNDUP(highest_address - section_base[num_sections - 1], PAGE_SIZE);
+    num_pages_in_map = ((num_sections - 1) << PMM_SECTION_SHIFT) + last_pages;
+
+    kprintf("PMM: %lu of %lu sections hold usable memory.\n", num_sections, num_section_slots);
 }
 
 void _init_stats()
@@ -337,119 +702,1640 @@ void _init_stats()
         }
     }
 
-    uint64_t map_size_bytes = highest_address - lowest_address;
-    num_pages_in_map = map_size_bytes / PAGE_SIZE;
+    // Buddy blocks are aligned by their page index, so start the map on a boundary of the
+    // largest block to make those indexes line up with the physical addresses too.
+    lowest_address = ALIGN_DOWN(lowest_address, (uint64_t)PAGE_SIZE << BUDDY_MAX_ORDER);
+
+    _init_sections();
+
+    // The 4 GiB boundary is a multiple of the largest block, so no block can straddle the zones.
+    if (lowest_address < ZONE_DMA32_LIMIT) {
+        dma32_end_page = _phys_to_page(ZONE_DMA32_LIMIT);
+    }
+
+    // Everything belongs to node 0 until kmem_numa_init() says otherwise.
+    mem_ranges[0].start_page = 0;
+    mem_ranges[0].end_page = num_pages_in_map;
+    mem_ranges[0].node = 0;
+    num_mem_ranges = 1;
+
+    _split_zone_ranges();
 }
 
-inline void* _get_addr_from_page(uint64_t page)
+static inline void* _get_addr_from_page(uint64_t page)
 {
-    return (void*)(lowest_address + (page * PAGE_SIZE) + vmm_higher_half_offset);
+    uint64_t offset = (page & (PMM_SECTION_PAGES - 1)) * PAGE_SIZE;
+    return (void*)(section_base[page >> PMM_SECTION_SHIFT] + offset + vmm_higher_half_offset);
 }
 
-inline uint64_t _get_page_from_addr(void* addr)
+/*
+ * Returns the page index of an address in the higher half. Addresses outside the map, or in a
+ * hole between sections, give an index past num_pages_in_map.
+*/
+static inline uint64_t _get_page_from_addr(void* addr)
 {
-    return ((uint64_t)addr - lowest_address - vmm_higher_half_offset) / PAGE_SIZE;
+    uint64_t offset = (uint64_t)addr - vmm_higher_half_offset - lowest_address;
+    uint64_t slot = (offset / PAGE_SIZE) >> PMM_SECTION_SHIFT;
+
+    if (slot >= num_section_slots) {
+        return UINT64_MAX;
+    }
+
+    // A hole's slot points at the section above it, which starts somewhere else.
+    uint64_t section = section_index[slot];
+    if (section == num_sections || section_base[section] != lowest_address + (slot << PMM_SECTION_SHIFT) * PAGE_SIZE) {
+        return UINT64_MAX;
+    }
+
+    return (section << PMM_SECTION_SHIFT) | ((offset / PAGE_SIZE) & (PMM_SECTION_PAGES - 1));
 }
 
 void _reserve_pages(uint64_t startPage, uint64_t pages)
 {
-    for (uint64_t i = startPage; i < startPage + pages; i++) {
-        bitmap_on(page_bitmap, i);
-    }
+    sbitmap_set_range(&page_bitmap, startPage, pages);
+}
+
+void _release_pages(uint64_t startPage, uint64_t pages)
+{
+    sbitmap_clear_range(&page_bitmap, startPage, pages);
 }
 
 /*
-    Allocates a requested amount of contiguous pages of physical memory.
-    
-    If the amount of pages could not be allocated contiguously, the call will fail
-    returning NULL. But this does not mean that we are out of memory. It may be that
-    the remaining pages of memory are fragmented in blocks that only allow for small
-    amounts of contiguous page allocation. You would have to look in to the memory map
-    entries to determine this.
+ * Returns the smallest block order that holds the requested amount of pages.
 */
-void* kalloc(size_t numBytes)
+static inline uint8_t _pages_to_order(uint64_t pages)
 {
-    spinlock_lock(&lock);
+    uint8_t order = 0;
+    while (((uint64_t)1 << order) < pages) {
+        order++;
+    }
 
-    uint64_t pages_to_alloc = DIV_ROUNDUP(numBytes, PAGE_SIZE);
-    uint64_t start_alloc_page = 0;
-    uint64_t allocated_pages = 0;
-    bool looped = false;
-    bool allocating = false;
-    bool page_state = false;
-
-    // Try and allocate pages starting from the cursor.
-    while(true) {
-        page_state = bitmap_test(page_bitmap, allocation_cursor);
-
-        if (!allocating) {
-            if (!page_state) {
-                // Found a memory slot, lets start trying to allocate from here.
-                start_alloc_page = allocation_cursor;
-                allocating = true;
-                allocated_pages = 1;
-            }
-        } else {
-            if (page_state) {
-                // This page is taken, back to seeking.
-                allocating = false;
+    return order;
+}
+
+/*
+ * Returns the range the page belongs to.
+*/
+static struct MemRange* _page_range(uint64_t page)
+{
+    for (uint32_t i = 0; i < num_mem_ranges - 1; i++) {
+        if (page < mem_ranges[i].end_page) {
+            return &mem_ranges[i];
+        }
+    }
+
+    return &mem_ranges[num_mem_ranges - 1];
+}
+
+/*
+ * Returns the zone that the free blocks of a range are kept in.
+*/
+static inline struct MemZone* _range_zone(struct MemRange *pRange)
+{
+    return &mem_nodes[pRange->node].zones[pRange->zone];
+}
+
+/*
+ * Pushes the block starting at 'page' on to the zone's free list for its order.
+*/
+static void _free_list_add(struct MemZone *pZone, uint64_t page, uint8_t order)
+{
+    struct FreeBlock *pBlock = (struct FreeBlock*)_get_addr_from_page(page);
+
+    pBlock->pPrev = NULL;
+    pBlock->pNext = pZone->free_lists[order];
+
+    if (pZone->free_lists[order] != NULL) {
+        pZone->free_lists[order]->pPrev = pBlock;
+    }
+
+    pZone->free_lists[order] = pBlock;
+    pZone->free_counts[order]++;
+    pZone->free_pages += (uint64_t)1 << order;
+    pBlock->order = order;
+    bitmap_on(free_heads, page);
+}
+
+/*
+ * Unlinks the free block starting at 'page' from the zone's free list for its order.
+*/
+static void _free_list_remove(struct MemZone *pZone, uint64_t page, uint8_t order)
+{
+    struct FreeBlock *pBlock = (struct FreeBlock*)_get_addr_from_page(page);
+
+    if (pBlock->pPrev != NULL) {
+        pBlock->pPrev->pNext = pBlock->pNext;
+    } else {
+        pZone->free_lists[order] = pBlock->pNext;
+    }
+
+    if (pBlock->pNext != NULL) {
+        pBlock->pNext->pPrev = pBlock->pPrev;
+    }
+
+    pZone->free_counts[order]--;
+    pZone->free_pages -= (uint64_t)1 << order;
+    bitmap_off(free_heads, page);
+}
+
+/*
+ * Frees a single block of 2^order pages inside 'pRange', merging it with its buddy for as long as
+ * the buddy is also free and inside the same range.
+*/
+static void _buddy_free_block(struct MemRange *pRange, uint64_t page, uint8_t order)
+{
+    struct MemZone *pZone = _range_zone(pRange);
+
+    while (order < BUDDY_MAX_ORDER) {
+        uint64_t buddy = page ^ ((uint64_t)1 << order);
+
+        // Pages that aren't free are set in the bitmap. Testing that first also keeps us away
+        // from head bits in chunks that kmem_init_deferred() hasn't set up yet.
+        if (buddy < pRange->start_page || buddy >= pRange->end_page ||
+            sbitmap_test(&page_bitmap, buddy) ||
+            !bitmap_test(free_heads, buddy) ||
+            ((struct FreeBlock*)_get_addr_from_page(buddy))->order != order) {
+            break;
+        }
+
+        // The buddy is free at the same order, absorb it and try again one order up.
+        _free_list_remove(pZone, buddy, order);
+        page = MIN(page, buddy);
+        order++;
+    }
+
+    _free_list_add(pZone, page, order);
+}
+
+/*
+ * Frees an arbitrary run of pages by breaking it up in to the largest aligned blocks it contains,
+ * splitting it wherever it crosses from one range to another.
+*/
+static void _buddy_free_range(uint64_t page, uint64_t count)
+{
+    while (count > 0) {
+        struct MemRange *pRange = _page_range(page);
+        uint64_t end = page + MIN(count, pRange->end_page - page);
+
+        count -= end - page;
+
+        while (page < end) {
+            uint8_t order = 0;
+
+            while (order < BUDDY_MAX_ORDER &&
+                   (page & (((uint64_t)1 << (order + 1)) - 1)) == 0 &&
+                   page + ((uint64_t)1 << (order + 1)) <= end) {
+                order++;
+            }
+
+            _buddy_free_block(pRange, page, order);
+            page += (uint64_t)1 << order;
+        }
+    }
+}
+
+/*
+ * Takes a block of 2^order pages from the zone's free lists, splitting a larger block if needed.
+ * Returns false if there is no block large enough.
+*/
+static bool _buddy_alloc(struct MemZone *pZone, uint8_t order, uint64_t *pPage)
+{
+    uint8_t found = order;
+
+    while (found <= BUDDY_MAX_ORDER && pZone->free_lists[found] == NULL) {
+        found++;
+    }
+
+    if (found > BUDDY_MAX_ORDER) {
+        return false;
+    }
+
+    uint64_t page = _get_page_from_addr(pZone->free_lists[found]);
+    _free_list_remove(pZone, page, found);
+
+    // Split the block in half until we get down to the order asked for, giving
+    // the upper halves back to the free lists.
+    while (found > order) {
+        found--;
+        _free_list_add(pZone, page + ((uint64_t)1 << found), found);
+    }
+
+    *pPage = page;
+    return true;
+}
+
+/*
+ * Hands the usable pages with page indexes from 'first' up to 'last' that the early allocator
+ * hasn't reserved to the buddy allocator, returning how many pages that was. Pages only partly
+ * reserved stay out. Must be called with the lock held.
+*/
+static uint64_t _free_usable_pages(uint64_t first, uint64_t last)
+{
+    uint64_t freed = 0;
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type != LIMINE_MEMMAP_USABLE) {
+            continue;
+        }
+
+        uint64_t base = entry->base;
+        uint64_t end = entry->base + entry->length;
+        uint64_t free_start = 0;
+        uint64_t free_end = 0;
+
+        while (memblock_find_free(base, end, &free_start, &free_end)) {
+            base = free_end;
+
+            // Find the pages of this free part that fall in the range.
+            uint64_t start_bit = MAX(_phys_to_page(ALIGN_UP(free_start, PAGE_SIZE)), first);
+            uint64_t end_bit = MIN(_phys_to_page(ALIGN_DOWN(free_end, PAGE_SIZE)), last);
+
+            if (start_bit >= end_bit) {
+                continue;
+            }
+
+            // Marks all the pages as free and hand them to the buddy allocator.
+            _release_pages(start_bit, end_bit - start_bit);
+            _buddy_free_range(start_bit, end_bit - start_bit);
+            freed += end_bit - start_bit;
+        }
+    }
+
+    num_pages_available += freed;
+    return freed;
+}
+
+/*
+ * Walks the memory map entries, setting the state of the bitmap with what it finds as usable memory.
+ * Only enough memory to boot is made available here, the rest is left to kmem_init_deferred().
+*/
+void _get_free_pages()
+{
+    kprintf("Searching for free memory pages...\n");
+
+    uint64_t boot_pages = 0;
+    deferred_start_page = num_pages_in_map;
+
+    // So we have a memory map allocated and its all full. Let's walk through the memory map entries again
+    // and find where we have enough pages to boot.
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type != LIMINE_MEMMAP_USABLE) {
+            kprintf(
+                "Memory Region Unusable: type %d, %d pages (%d mb)\n",
+                entry->type,
+                entry->length / PAGE_SIZE,
+                entry->length / 1024 / 1024);
+
+            continue;
+        } else {
+            kprintf(
+                "Memory Region Usable: %d pages (%d mb)\n",
+                entry->length / PAGE_SIZE,
+                entry->length / 1024 / 1024);
+        }
+
+        uint64_t start_bit = _phys_to_page(entry->base);
+        uint64_t pages_free = entry->length / PAGE_SIZE;
+
+        if (boot_pages < PMM_BOOT_PAGES && boot_pages + pages_free >= PMM_BOOT_PAGES) {
+            uint64_t boot_end = start_bit + (PMM_BOOT_PAGES - boot_pages);
+            deferred_start_page = MIN(ALIGN_UP(boot_end, PMM_DEFER_CHUNK_PAGES), num_pages_in_map);
+        }
+
+        boot_pages += pages_free;
+    }
+
+    // The head bits for the deferred chunks are cleared by whoever sets each chunk up.
+    memset(free_heads, 0, DIV_ROUNDUP(deferred_start_page, 64) * 8);
+
+    // Everything the early allocator hasn't reserved belongs to the buddy allocator from here on.
+    memblock_seal();
+    max_pages_available -= memblock_reserved_pages();
+
+    _free_usable_pages(0, deferred_start_page);
+    deferred_next_page = deferred_start_page;
+}
+
+/*
+ * Sets up the memory that kmem_init() left for later. Each CPU that calls this claims chunks
+ * until there are none left, so calling it on every core splits the work between them.
+ * The BSP waits for all chunks to finish so everything is available when it returns.
+*/
+void kmem_init_deferred()
+{
+    uint64_t num_chunks = DIV_ROUNDUP(num_pages_in_map - deferred_start_page, PMM_DEFER_CHUNK_PAGES);
+    uint64_t start_cycles = rdtsc();
+    bool worked = false;
+
+    while (true) {
+        uint64_t first = __sync_fetch_and_add(&deferred_next_page, PMM_DEFER_CHUNK_PAGES);
+        if (first >= num_pages_in_map) {
+            break;
+        }
+
+        uint64_t last = MIN(first + PMM_DEFER_CHUNK_PAGES, num_pages_in_map);
+
+        if (!worked) {
+            worked = true;
+            __sync_fetch_and_add(&deferred_cpus, 1);
+        }
+
+        // Nothing looks at the head bits of a chunk until its pages are free, so this can run in parallel.
+        // Chunks are a multiple of 64 pages, so no two CPUs share a word.
+        memset(&free_heads[first / 64], 0, DIV_ROUNDUP(last - first, 64) * 8);
+
+        spinlock_lock(&lock);
+        uint64_t freed = _free_usable_pages(first, last);
+        spinlock_unlock(&lock);
+
+        __sync_fetch_and_add(&deferred_pages_freed, freed);
+        __sync_fetch_and_add(&deferred_chunks_done, 1);
+    }
+
+    if (cpu_index() != 0) {
+        return;
+    }
+
+    while (deferred_chunks_done < num_chunks) {
+        // Wait for the other cores to finish their chunks.
+        asm volatile("pause");
+    }
+
+    uint64_t cycles = rdtsc() - start_cycles;
+
+    kprintf("PMM: Boot init took %lu cycles.\n", boot_init_cycles);
+    kprintf("PMM: Deferred init freed %lu pages in %lu cycles across %lu CPUs.\n", deferred_pages_freed, cycles, deferred_cpus);
+    kprintf("PMM Available Pages: %lu\n", num_pages_available);
+    kprintf("PMM: Free pages in zone DMA32 %lu, NORMAL %lu.\n", kmem_zone_free_pages(MEM_ZONE_DMA32), kmem_zone_free_pages(MEM_ZONE_NORMAL));
+}
+
+/*
+ * Finds the free block that contains 'page'. Returns false if the page isn't in a free block.
+*/
+static bool _buddy_find_block(uint64_t page, uint64_t *pHead, uint8_t *pOrder)
+{
+    for (uint8_t order = 0; order <= BUDDY_MAX_ORDER; order++) {
+        uint64_t head = page & ~(((uint64_t)1 << order) - 1);
+
+        if (bitmap_test(free_heads, head) && ((struct FreeBlock*)_get_addr_from_page(head))->order == order) {
+            *pHead = head;
+            *pOrder = order;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Takes an exact run of free pages out of the buddy allocator, whatever blocks it spans.
+ * The parts of those blocks outside the run go back on the free lists.
+*/
+static void _buddy_take_range(uint64_t page, uint64_t count)
+{
+    uint64_t end = page + count;
+    uint64_t head = 0;
+    uint8_t order = 0;
+
+    while (page < end) {
+        if (!_buddy_find_block(page, &head, &order)) {
+            kprintf("*FATAL*: PMM page %lu is marked free but isn't in a free block.\n", page);
+            hcf();
+        }
+
+        uint64_t block_end = head + ((uint64_t)1 << order);
+
+        _free_list_remove(_range_zone(_page_range(head)), head, order);
+        _buddy_free_range(head, page - head);
+
+        if (block_end > end) {
+            _buddy_free_range(end, block_end - end);
+        }
+
+        page = MIN(block_end, end);
+    }
+}
+
+/*
+ * Returns the descriptor of a page, or NULL if it doesn't have one.
+*/
+static inline struct page* _page_find(uint64_t page)
+{
+    struct page *pChunk = page_chunks[page >> PMM_DESC_CHUNK_SHIFT];
+    return pChunk != NULL ? &pChunk[page & (PMM_DESC_CHUNK_PAGES - 1)] : NULL;
+}
+
+/*
+ * Returns the descriptor of a page that is known to have one.
+*/
+static inline struct page* _page(uint64_t page)
+{
+    return &page_chunks[page >> PMM_DESC_CHUNK_SHIFT][page & (PMM_DESC_CHUNK_PAGES - 1)];
+}
+
+/*
+ * Returns the number of pages allocated starting at 'page', 0 if it doesn't start an allocation.
+*/
+static inline uint64_t _page_allocated(uint64_t page)
+{
+    struct page *pPage = _page_find(page);
+    return pPage != NULL ? pPage->pages_allocated : 0;
+}
+
+/*
+ * Takes a block of 2^PMM_DESC_BLOCK_ORDER pages for descriptors from the node's pool, filling the
+ * pool from the node, or the nearest node with memory, when it runs out. Falls back to a single
+ * block when there's nothing as big as a pool left. Must be called with the lock held.
+*/
+static bool _page_desc_block(uint32_t node, uint64_t *pBlock)
+{
+    struct DescPool *pPool = &desc_pools[node];
+
+    if (pPool->next_page == pPool->end_page) {
+        uint64_t page = 0;
+        bool found = false;
+        uint8_t order = PMM_DESC_POOL_ORDER;
+
+        while (!found) {
+            // Keep out of DMA32 while we can.
+            for (uint32_t i = 0; i < mem_node_count * MEM_ZONE_COUNT && !found; i++) {
+                struct MemNode *pNode = &mem_nodes[mem_nodes[node].fallback[i / MEM_ZONE_COUNT]];
+                found = _buddy_alloc(&pNode->zones[MEM_ZONE_COUNT - 1 - (i % MEM_ZONE_COUNT)], order, &page);
+            }
+
+            if (!found && order == PMM_DESC_BLOCK_ORDER) {
+                return false;
+            }
+
+            if (!found) {
+                order = PMM_DESC_BLOCK_ORDER;
+            }
+        }
+
+        uint64_t pages = (uint64_t)1 << order;
+        _reserve_pages(page, pages);
+        num_pages_available -= pages;
+        num_desc_pages += pages;
+
+        pPool->next_page = page;
+        pPool->end_page = page + pages;
+    }
+
+    *pBlock = pPool->next_page;
+    pPool->next_page += (uint64_t)1 << PMM_DESC_BLOCK_ORDER;
+
+    return true;
+}
+
+/*
+ * Makes sure the allocation of 'pages' pages starting at 'page' has the descriptors it needs,
+ * taking blocks for the missing ones from the node the pages belong to. Allocations larger than
+ * a chunk only get a descriptor for their first page. Returns false if there was no memory for
+ * them. Must be called with the lock held.
+*/
+static bool _page_desc_ensure(uint64_t page, uint64_t pages)
+{
+    uint64_t last = (page + MIN(pages, PMM_DESC_CHUNK_PAGES) - 1) >> PMM_DESC_CHUNK_SHIFT;
+
+    for (uint64_t chunk = page >> PMM_DESC_CHUNK_SHIFT; chunk <= last; chunk++) {
+        if (page_chunks[chunk] != NULL) {
+            continue;
+        }
+
+        uint64_t block = 0;
+
+        if (!_page_desc_block(_page_range(chunk << PMM_DESC_CHUNK_SHIFT)->node, &block)) {
+            return false;
+        }
+
+        struct page *pChunk = (struct page*)_get_addr_from_page(block);
+        memset(pChunk, 0, sizeof(struct page) * PMM_DESC_CHUNK_PAGES);
+
+        for (uint64_t i = 0; i < PMM_DESC_CHUNK_PAGES; i++) {
+            pChunk[i].index = (chunk << PMM_DESC_CHUNK_SHIFT) + i;
+            pChunk[i].lru_next = PAGE_LRU_NONE;
+            pChunk[i].lru_prev = PAGE_LRU_NONE;
+        }
+
+        // Readers outside the lock only look up pages they were handed, which come after this.
+        __atomic_store_n(&page_chunks[chunk], pChunk, __ATOMIC_RELEASE);
+        num_desc_chunks++;
+    }
+
+    return true;
+}
+
+/*
+ * Sets up the descriptor of the first page of a new allocation of 'pages' pages, with a single reference.
+ * The descriptor must already exist, see _page_desc_ensure().
+*/
+static inline void _page_init_alloc(uint64_t page, uint64_t pages)
+{
+    struct page *pPage = _page(page);
+
+    pPage->pOwner = NULL;
+    pPage->pages_allocated = pages;
+    pPage->refcount = 1;
+    pPage->lru_next = PAGE_LRU_NONE;
+    pPage->lru_prev = PAGE_LRU_NONE;
+    pPage->flags = 0;
+}
+
+/*
+ * Fills the magazine up to the low watermark from the buddy allocator, taking the largest
+ * blocks we can so the refill costs as few free list operations as possible.
+*/
+static void _pcp_refill(struct PageMagazine *pMag, uint32_t node)
+{
+    spinlock_lock(&lock);
+
+    uint64_t page = 0;
+
+    // Prefer the CPU's own node, then the nearest others, and keep out of DMA32 while we can.
+    for (uint32_t i = 0; i < mem_node_count * MEM_ZONE_COUNT && pMag->count < pcp_low_watermark; i++) {
+        struct MemNode *pNode = &mem_nodes[mem_nodes[node].fallback[i / MEM_ZONE_COUNT]];
+        struct MemZone *pZone = &pNode->zones[MEM_ZONE_COUNT - 1 - (i % MEM_ZONE_COUNT)];
+        uint8_t order = BUDDY_MAX_ORDER;
+
+        while (pMag->count < pcp_low_watermark) {
+            uint64_t needed = pcp_low_watermark - pMag->count;
+
+            while (((uint64_t)1 << order) > needed) {
+                order--;
+            }
+
+            if (!_buddy_alloc(pZone, order, &page)) {
+                if (order == 0) {
+                    break;
+                }
+
+                order--;
+                continue;
+            }
+
+            uint64_t pages = (uint64_t)1 << order;
+            _reserve_pages(page, pages);
+
+            // Magazine pages are handed out without the lock, so they get their descriptors now.
+            if (!_page_desc_ensure(page, pages)) {
+                _release_pages(page, pages);
+                _buddy_free_range(page, pages);
+                spinlock_unlock(&lock);
+                return;
+            }
+
+            num_pages_available -= pages;
+
+            for (uint64_t p = 0; p < pages; p++) {
+                pMag->pages[pMag->count++] = page + p;
+            }
+        }
+    }
+
+    spinlock_unlock(&lock);
+}
+
+/*
+ * Gives pages from the magazine back to the buddy allocator until it is down to 'target' pages.
+*/
+static void _pcp_drain(struct PageMagazine *pMag, uint32_t target)
+{
+    spinlock_lock(&lock);
+
+    while (pMag->count > target) {
+        uint64_t page = pMag->pages[--pMag->count];
+        _release_pages(page, 1);
+        _buddy_free_block(_page_range(page), page, 0);
+        num_pages_available++;
+    }
+
+    spinlock_unlock(&lock);
+}
+
+/*
+ * Takes a single page from this CPU's magazine. Returns NULL if the magazine couldn't be refilled.
+*/
+static void* _pcp_alloc()
+{
+    // An ISR on this CPU could also allocate, so keep interrupts off while we touch the magazine.
+    bool istate = set_interrupt_state(false);
+
+    struct PageMagazine *pMag = &page_magazines[cpu_index()];
+
+    if (pMag->count == 0) {
+        _pcp_refill(pMag, cpu_node());
+
+        if (pMag->count == 0) {
+            set_interrupt_state(istate);
+            return NULL;
+        }
+    }
+
+    uint64_t page = pMag->pages[--pMag->count];
+    _page_init_alloc(page, 1);
+
+    set_interrupt_state(istate);
+
+    return _get_addr_from_page(page);
+}
+
+/*
+ * Returns a single page to this CPU's magazine.
+*/
+static void _pcp_free(uint64_t page)
+{
+    bool istate = set_interrupt_state(false);
+
+    struct PageMagazine *pMag = &page_magazines[cpu_index()];
+
+    _page(page)->pages_allocated = 0;
+    pMag->pages[pMag->count++] = page;
+
+    if (pMag->count >= pcp_high_watermark) {
+        _pcp_drain(pMag, pcp_low_watermark);
+    }
+
+    set_interrupt_state(istate);
+}
+
+/*
+ * Gives all the pages held in this CPU's magazine back to the buddy allocator.
+*/
+void kmem_pcp_drain()
+{
+    bool istate = set_interrupt_state(false);
+    _pcp_drain(&page_magazines[cpu_index()], 0);
+    set_interrupt_state(istate);
+}
+
+/*
+ * Sets the per-CPU magazine watermarks. The low watermark is how many pages a magazine is filled
+ * to when it runs dry, the high watermark is the count that triggers draining back to the low watermark.
+*/
+void kmem_pcp_tune(uint32_t low, uint32_t high)
+{
+    high = MIN(MAX(high, 2), PCP_CAPACITY);
+    low = MIN(MAX(low, 1), high - 1);
+
+    pcp_low_watermark = low;
+    pcp_high_watermark = high;
+
+    kprintf("PMM: Per-CPU page watermarks low %d, high %d.\n", low, high);
+}
+
+/*
+ * Takes 'pages' contiguous pages out of a node's zone in the buddy allocator, starting on a multiple
+ * of 2^align_order pages. The buddy allocator hands out naturally aligned power of two blocks, so any
+ * pages in the block beyond what was asked for are given straight back. If there's no block big
+ * enough, the bitmap is searched for an aligned run of free pages in the zone that straddles blocks.
+ * 'pages' must be a multiple of 2^align_order. Must be called with the lock held.
+*/
+static bool _take_pages(uint32_t node, uint32_t zone, uint64_t pages, uint8_t align_order, uint64_t *pPage)
+{
+    uint8_t order = _pages_to_order(pages);
+
+    if (order <= BUDDY_MAX_ORDER && _buddy_alloc(&mem_nodes[node].zones[zone], order, pPage)) {
+        _buddy_free_range(*pPage + pages, ((uint64_t)1 << order) - pages);
+        return true;
+    }
+
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->node != node || pRange->zone != zone) {
+            continue;
+        }
+
+        uint64_t align = (uint64_t)1 << align_order;
+        uint64_t page = ALIGN_UP(pRange->start_page, align);
+
+        // Nothing aligned can start before the first run found, so keep moving up to the next
+        // aligned page until the run starts on one. The first aligned run is the only one that could fit.
+        while (page < pRange->end_page) {
+            uint64_t run = sbitmap_find_clear_run(&page_bitmap, page, pages);
+            if (run == page) {
+                break;
+            }
+
+            page = ALIGN_UP(run, align);
+        }
+
+        if (page + pages > pRange->end_page) {
+            continue;
+        }
+
+        _buddy_take_range(page, pages);
+        *pPage = page;
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Takes 'pages' contiguous pages from the node, or from the nearest node that has them. Each node's
+ * zones are tried from 'max_zone' down. Must be called with the lock held.
+*/
+static bool _take_pages_nearest(uint32_t node, uint32_t max_zone, uint64_t pages, uint8_t align_order, uint64_t *pPage)
+{
+    for (uint32_t i = 0; i < mem_node_count; i++) {
+        for (int32_t zone = max_zone; zone >= 0; zone--) {
+            if (_take_pages(mem_nodes[node].fallback[i], zone, pages, align_order, pPage)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Returns the number of pages from the start of the map that have been set up, which is all of them
+ * once kmem_init_deferred() is finished.
+*/
+static uint64_t _initialised_pages()
+{
+    uint64_t num_chunks = DIV_ROUNDUP(num_pages_in_map - deferred_start_page, PMM_DEFER_CHUNK_PAGES);
+    return deferred_chunks_done == num_chunks ? num_pages_in_map : deferred_start_page;
+}
+
+/*
+ * Works out how many pages would have to be migrated to free the 'count' pages starting at 'first'.
+ * Returns UINT64_MAX if any page in there is in use by something that can't be moved, or by an
+ * allocation that doesn't lie entirely inside. Must be called with the lock held.
+*/
+static uint64_t _compact_cost(uint64_t first, uint64_t count)
+{
+    uint64_t last = first + count;
+    uint64_t used = 0;
+    uint64_t page = bitmap_find_set(page_bitmap.bits, first, last);
+
+    while (page < last) {
+        struct page *pPage = _page_find(page);
+
+        if (pPage == NULL || pPage->pages_allocated == 0 ||
+            (pPage->flags & (PAGE_MOVABLE | PAGE_PINNED)) != PAGE_MOVABLE ||
+            pPage->refcount != 1 ||
+            page + pPage->pages_allocated > last) {
+            return UINT64_MAX;
+        }
+
+        used += pPage->pages_allocated;
+        page = bitmap_find_set(page_bitmap.bits, page + pPage->pages_allocated, last);
+    }
+
+    return used;
+}
+
+/*
+ * Moves the allocation starting at 'page' to free pages elsewhere in the node's zone and lets its
+ * owner know. Returns false if there wasn't room or the owner has let go of it, in which case it
+ * stays put. Must be called with the lock held.
+*/
+static bool _compact_migrate(uint32_t node, uint32_t zone, uint64_t page)
+{
+    struct page *pOld = _page(page);
+    uint64_t pages = pOld->pages_allocated;
+    uint64_t dest = 0;
+
+    if (!_take_pages(node, zone, pages, 0, &dest)) {
+        return false;
+    }
+
+    _reserve_pages(dest, pages);
+
+    if (!_page_desc_ensure(dest, pages)) {
+        _release_pages(dest, pages);
+        _buddy_free_range(dest, pages);
+        return false;
+    }
+
+    memcpy(_get_addr_from_page(dest), _get_addr_from_page(page), pages * PAGE_SIZE);
+
+    struct page *pNew = _page(dest);
+    *pNew = *pOld;
+    pNew->index = dest;
+
+    struct page_mover *pMover = (struct page_mover*)pOld->pOwner;
+
+    if (!pMover->migrate(pMover, _get_addr_from_page(page), _get_addr_from_page(dest))) {
+        pNew->pages_allocated = 0;
+        pNew->flags = 0;
+        _release_pages(dest, pages);
+        _buddy_free_range(dest, pages);
+        return false;
+    }
+
+    // The old pages are now only in the way, they're released along with the rest of the block.
+    pOld->pOwner = NULL;
+    pOld->pages_allocated = 0;
+    pOld->refcount = 0;
+    pOld->flags = 0;
+
+    num_pages_available -= pages;
+    compact_pages_migrated += pages;
+
+    return true;
+}
+
+/*
+ * Tries to free a naturally aligned block of 2^order pages in a node's zone by migrating the movable
+ * pages out of it. The block needing the fewest pages moved is picked. Must be called with the lock held.
+*/
+static bool _compact_zone(uint32_t node, uint32_t zone, uint8_t order)
+{
+    uint64_t block = (uint64_t)1 << order;
+    uint64_t best = 0;
+    uint64_t best_cost = UINT64_MAX;
+
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->node != node || pRange->zone != zone) {
+            continue;
+        }
+
+        // Pages kmem_init_deferred() hasn't got to yet have no descriptors to look at.
+        uint64_t end = MIN(pRange->end_page, _initialised_pages());
+
+        for (uint64_t first = ALIGN_UP(pRange->start_page, block); first + block <= end; first += block) {
+            uint64_t cost = _compact_cost(first, block);
+
+            if (cost < best_cost) {
+                best = first;
+                best_cost = cost;
+            }
+        }
+    }
+
+    // Moving the pages out needs that many free pages outside the block.
+    struct MemZone *pZone = &mem_nodes[node].zones[zone];
+    if (best_cost == UINT64_MAX || best_cost == 0 || pZone->free_pages < block) {
+        return false;
+    }
+
+    compact_runs++;
+
+    // Take the free pages of the block out of the buddy allocator so nothing migrates in to it.
+    uint64_t last = best + block;
+    uint64_t page = sbitmap_find_clear(&page_bitmap, best);
+
+    while (page < last) {
+        uint64_t end = bitmap_find_set(page_bitmap.bits, page, last);
+
+        _buddy_take_range(page, end - page);
+        _reserve_pages(page, end - page);
+        num_pages_available -= end - page;
+
+        page = sbitmap_find_clear(&page_bitmap, end);
+    }
+
+    bool moved_all = true;
+
+    for (page = best; page < last; page++) {
+        uint64_t pages = _page_allocated(page);
+
+        if (pages > 0) {
+            if (!_compact_migrate(node, zone, page)) {
+                moved_all = false;
+            }
+
+            page += pages - 1;
+        }
+    }
+
+    // Give back everything in the block that isn't still allocated, which merges it back together.
+    page = best;
+
+    while (page < last) {
+        if (_page_allocated(page) > 0) {
+            page += _page_allocated(page);
+            continue;
+        }
+
+        uint64_t end = page + 1;
+        while (end < last && _page_allocated(end) == 0) {
+            end++;
+        }
+
+        _release_pages(page, end - page);
+        _buddy_free_range(page, end - page);
+        num_pages_available += end - page;
+
+        page = end;
+    }
+
+    if (moved_all) {
+        compact_successes++;
+    }
+
+    return moved_all;
+}
+
+/*
+ * Compacts the nearest zone it can to make room for 'pages' contiguous pages aligned to
+ * 2^align_order pages. Must be called with the lock held.
+*/
+static bool _compact(uint32_t node, uint32_t max_zone, uint64_t pages, uint8_t align_order)
+{
+    uint8_t order = MAX(_pages_to_order(pages), align_order);
+
+    if (order > BUDDY_MAX_ORDER) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < mem_node_count; i++) {
+        for (int32_t zone = max_zone; zone >= 0; zone--) {
+            if (_compact_zone(mem_nodes[node].fallback[i], zone, order)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/*
+    Allocates a requested amount of contiguous pages of physical memory.
+    
+    If the amount of pages could not be allocated contiguously, the call will fail
+    returning NULL. But this does not mean that we are out of memory. It may be that
+    the remaining pages of memory are fragmented in blocks that only allow for small
+    amounts of contiguous page allocation. You would have to look in to the memory map
+    entries to determine this.
+
+    Memory comes from the NUMA node of the calling CPU where possible.
+*/
+void* kalloc(size_t numBytes)
+{
+    return kalloc_node(cpu_node(), numBytes);
+}
+
+/*
+ * Allocates 'pages_to_alloc' contiguous pages aligned to 2^align_order pages from the node,
+ * or the nearest node that has them. 'flags' are the KALLOC_ flags.
+*/
+static void* _kalloc_pages(uint32_t node, uint64_t pages_to_alloc, uint8_t align_order, uint32_t flags)
+{
+    uint64_t start_alloc_page = 0;
+    uint32_t max_zone = (flags & KALLOC_DMA32) ? MEM_ZONE_DMA32 : MEM_ZONE_NORMAL;
+
+    if (node >= mem_node_count) {
+        node = 0;
+    }
+
+    page_magazines[cpu_index()].allocs++;
+
+    // The common single page case doesn't need the global lock. Magazines can hold pages
+    // from any zone, so they're no use to a DMA32 allocation.
+    if (pages_to_alloc == 1 && node == cpu_node() && max_zone == MEM_ZONE_NORMAL) {
+        void *pPage = _pcp_alloc();
+        if (pPage != NULL) {
+            return pPage;
+        }
+    }
+
+    spinlock_lock(&lock);
+
+    if (!_take_pages_nearest(node, max_zone, pages_to_alloc, align_order, &start_alloc_page)) {
+        spinlock_unlock(&lock);
+
+        // Pages sitting in the zero pool, color lists or this CPU's magazine might be what's stopping the blocks merging.
+        kmem_zero_pool_drain();
+        kmem_color_drain();
+        kmem_pcp_drain();
+        spinlock_lock(&lock);
+
+        // There may be enough free pages, just scattered. Try moving some out of the way.
+        if (!_take_pages_nearest(node, max_zone, pages_to_alloc, align_order, &start_alloc_page) &&
+            (!_compact(node, max_zone, pages_to_alloc, align_order) ||
+             !_take_pages_nearest(node, max_zone, pages_to_alloc, align_order, &start_alloc_page))) {
+            spinlock_unlock(&lock);
+            __sync_fetch_and_add(&alloc_failures, 1);
+            kprintf("PMM Allocation failed.\n");
+            return NULL;
+        }
+    }
+
+    // Reserve it in the map and update the descriptor to track how many pages we allocated from here.
+    _reserve_pages(start_alloc_page, pages_to_alloc);
+
+    if (!_page_desc_ensure(start_alloc_page, pages_to_alloc)) {
+        _release_pages(start_alloc_page, pages_to_alloc);
+        _buddy_free_range(start_alloc_page, pages_to_alloc);
+        spinlock_unlock(&lock);
+        __sync_fetch_and_add(&alloc_failures, 1);
+        kprintf("PMM Allocation failed, no memory for page descriptors.\n");
+        return NULL;
+    }
+
+    _page_init_alloc(start_alloc_page, pages_to_alloc);
+
+    num_pages_available -= pages_to_alloc;
+    spinlock_unlock(&lock);
+
+    return _get_addr_from_page(start_alloc_page);
+}
+
+/*
+    Allocates contiguous pages from the specified NUMA node. If the node can't satisfy the
+    request, the other nodes are tried in order of distance from it.
+*/
+void* kalloc_node(uint32_t node, size_t numBytes)
+{
+    return _kalloc_pages(node, MAX(DIV_ROUNDUP(numBytes, PAGE_SIZE), 1), 0, 0);
+}
+
+/*
+ * Returns the cache color of a page.
+*/
+static inline uint32_t _page_color(uint64_t page)
+{
+    return page & (page_colors - 1);
+}
+
+/*
+ * Takes 'pages' contiguous pages from a node's zone starting on a page of the given color.
+ * Must be called with the lock held.
+*/
+static bool _take_pages_colored(uint32_t node, uint32_t zone, uint64_t pages, uint32_t color, uint64_t *pPage)
+{
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        struct MemRange *pRange = &mem_ranges[i];
+
+        if (pRange->node != node || pRange->zone != zone) {
+            continue;
+        }
+
+        uint64_t page = ALIGN_DOWN(pRange->start_page, page_colors) + color;
+        if (page < pRange->start_page) {
+            page += page_colors;
+        }
+
+        // Move up to the next page of the color each time the run found starts somewhere else.
+        while (page + pages <= pRange->end_page) {
+            uint64_t run = sbitmap_find_clear_run(&page_bitmap, page, pages);
+
+            if (run == page) {
+                _buddy_take_range(page, pages);
+                *pPage = page;
+                return true;
+            }
+
+            if (run + pages > pRange->end_page) {
+                break;
+            }
+
+            page = ALIGN_DOWN(run, page_colors) + color;
+            if (page < run) {
+                page += page_colors;
+            }
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Fills the color lists with a block of one page of each color. Pages for colors whose lists
+ * are full go straight back. Returns false if there was no block. Must be called with the lock held.
+*/
+static bool _color_refill(uint32_t node)
+{
+    uint64_t block = 0;
+    uint8_t order = _pages_to_order(page_colors);
+
+    if (!_take_pages_nearest(node, MEM_ZONE_NORMAL, page_colors, order, &block)) {
+        return false;
+    }
+
+    _reserve_pages(block, page_colors);
+
+    // Pages in the lists are handed out with only a quick trip through the lock, so they need descriptors now.
+    if (!_page_desc_ensure(block, page_colors)) {
+        _release_pages(block, page_colors);
+        _buddy_free_range(block, page_colors);
+        return false;
+    }
+
+    for (uint64_t page = block; page < block + page_colors; page++) {
+        uint32_t color = _page_color(page);
+
+        if (color_counts[color] < PMM_COLOR_LIST_PAGES) {
+            color_lists[color][color_counts[color]++] = page;
+            color_list_pages++;
+            num_pages_available--;
+        } else {
+            _release_pages(page, 1);
+            _buddy_free_block(_page_range(page), page, 0);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Allocates 'pages' pages starting on a page of the given color, from the node or the nearest node
+ * that has them. Returns NULL if there's no such run, the caller falls back to any color.
+*/
+static void* _kalloc_colored(uint32_t node, uint64_t pages, uint32_t color)
+{
+    uint64_t page = 0;
+    bool found = false;
+
+    if (node >= mem_node_count) {
+        node = 0;
+    }
+
+    spinlock_lock(&lock);
+
+    if (pages == 1) {
+        if (color_counts[color] == 0) {
+            _color_refill(node);
+        }
+
+        if (color_counts[color] > 0) {
+            page = color_lists[color][--color_counts[color]];
+            color_list_pages--;
+            _page_init_alloc(page, 1);
+            found = true;
+        }
+    } else {
+        for (uint32_t i = 0; i < mem_node_count * MEM_ZONE_COUNT && !found; i++) {
+            uint32_t zone = MEM_ZONE_COUNT - 1 - (i % MEM_ZONE_COUNT);
+            found = _take_pages_colored(mem_nodes[node].fallback[i / MEM_ZONE_COUNT], zone, pages, color, &page);
+        }
+
+        if (found) {
+            _reserve_pages(page, pages);
+
+            if (_page_desc_ensure(page, pages)) {
+                _page_init_alloc(page, pages);
+                num_pages_available -= pages;
             } else {
-                // Free page.
-                allocated_pages++;
+                _release_pages(page, pages);
+                _buddy_free_range(page, pages);
+                found = false;
+            }
+        }
+    }
+
+    spinlock_unlock(&lock);
+
+    if (!found) {
+        return NULL;
+    }
+
+    // Failures aren't counted, the caller falls back to _kalloc_pages() which counts them.
+    page_magazines[cpu_index()].allocs++;
+    return _get_addr_from_page(page);
+}
+
+/*
+    Gives the free pages held in the color lists back to the buddy allocator.
+*/
+void kmem_color_drain()
+{
+    spinlock_lock(&lock);
+
+    for (uint32_t color = 0; color < page_colors; color++) {
+        while (color_counts[color] > 0) {
+            uint64_t page = color_lists[color][--color_counts[color]];
+            _release_pages(page, 1);
+            _buddy_free_block(_page_range(page), page, 0);
+            num_pages_available++;
+        }
+    }
+
+    color_list_pages = 0;
+
+    spinlock_unlock(&lock);
+}
+
+/*
+    Returns the number of page colors, 1 if page coloring is off.
+*/
+uint32_t kmem_page_colors()
+{
+    return page_colors;
+}
+
+/*
+    Returns the cache color of the page holding 'ptr'.
+*/
+uint32_t kmem_page_color(void *ptr)
+{
+    return _page_color(_get_page_from_addr(ptr));
+}
+
+/*
+ * Works out the page colors from the L2 cache, or the last level cache if there's no L2.
+ * Colors are the pages one way of the cache covers, kept to a power of two no more than PMM_MAX_COLORS.
+*/
+static void _init_colors()
+{
+    struct cpu_cache cache;
+    struct cpu_cache chosen = {0};
+
+    for (uint32_t i = 0; get_cpu_cache(i, &cache); i++) {
+        // Stop at the L2, otherwise keep going up to the last level.
+        if (cache.type != CPU_CACHE_INSTRUCTION && chosen.level != 2 && cache.level > chosen.level) {
+            chosen = cache;
+        }
+    }
+
+    if (chosen.level == 0) {
+        kprintf("PMM: No cache geometry, page coloring is off.\n");
+        return;
+    }
+
+    uint64_t colors = (uint64_t)chosen.line_size * chosen.partitions * chosen.sets / PAGE_SIZE;
+
+    while (page_colors * 2 <= MIN(colors, PMM_MAX_COLORS)) {
+        page_colors *= 2;
+    }
+
+    color_cache_level = chosen.level;
+    color_cache_ways = chosen.ways;
+    color_cache_size = chosen.size;
+
+    kprintf("PMM: L%d cache %lu KiB, %d ways, %d page colors.\n",
+        chosen.level, chosen.size / 1024, chosen.ways, page_colors);
+}
+
+/*
+ * Reads every cache line of the pages PMM_COLOR_BENCH_ROUNDS times over, returning the hundredths
+ * of a cycle each read took.
+*/
+static uint64_t _color_bench_pass(uint8_t **ppPages, uint32_t count)
+{
+    uint64_t start = rdtsc();
+
+    for (uint32_t round = 0; round < PMM_COLOR_BENCH_ROUNDS; round++) {
+        for (uint32_t i = 0; i < count; i++) {
+            for (uint32_t line = 0; line < PAGE_SIZE; line += PMM_COLOR_BENCH_STRIDE) {
+                (void)*(volatile uint64_t*)(ppPages[i] + line);
+            }
+        }
+    }
+
+    uint64_t reads = (uint64_t)PMM_COLOR_BENCH_ROUNDS * count * (PAGE_SIZE / PMM_COLOR_BENCH_STRIDE);
+    return (rdtsc() - start) * 100 / reads;
+}
+
+/*
+    Shows what page coloring buys. Twice as many pages as the cache has ways are read over and over,
+    first with every page on the same color, which only fits 'ways' of them in the cache at once,
+    then with the pages spread over the colors by KALLOC_COLOR, which fits them all.
+*/
+void kmem_color_benchmark()
+{
+    static uint8_t *same[PMM_MAX_COLORS];
+    static uint8_t *spread[PMM_MAX_COLORS];
+
+    if (page_colors <= 1) {
+        kprintf("Page coloring is off, there's nothing to compare.\n");
+        return;
+    }
+
+    uint32_t count = MIN(color_cache_ways * 2, PMM_MAX_COLORS);
+    uint32_t got = 0;
+
+    while (got < count) {
+        same[got] = _kalloc_colored(cpu_node(), 1, 0);
+        spread[got] = kalloc_zone(PAGE_SIZE, KALLOC_COLOR);
+
+        if (same[got] == NULL || spread[got] == NULL) {
+            if (same[got] != NULL) {
+                kfree(same[got]);
             }
+
+            if (spread[got] != NULL) {
+                kfree(spread[got]);
+            }
+
+            break;
+        }
+
+        memset(same[got], 1, PAGE_SIZE);
+        memset(spread[got], 1, PAGE_SIZE);
+        got++;
+    }
+
+    if (got == count) {
+        kprintf("Page color benchmark, %d pages, L%d %lu KiB, %d ways, %d colors (cycles/read):\n",
+            count, color_cache_level, color_cache_size / 1024, color_cache_ways, page_colors);
+
+        uint64_t same_rate = _color_bench_pass(same, count);
+        uint64_t spread_rate = _color_bench_pass(spread, count);
+
+        kprintf("Colors:");
+        _print_rate("same", same_rate);
+        _print_rate("spread", spread_rate);
+        kprintf("\n");
+    } else {
+        kprintf("Page color benchmark couldn't allocate its pages.\n");
+    }
+
+    for (uint32_t i = 0; i < got; i++) {
+        kfree(same[i]);
+        kfree(spread[i]);
+    }
+}
+
+/*
+ * Follows a zero pool page to its new home when compaction moves it. A page that has already left
+ * the pool isn't found, so compaction leaves it where it is.
+*/
+static bool _zero_pool_migrate(struct page_mover *pMover, void *pOld, void *pNew)
+{
+    (void)pMover;
+    bool found = false;
+
+    spinlock_lock(&zero_pool_lock);
+
+    for (uint32_t i = 0; i < zero_pool_count; i++) {
+        if (zero_pool[i] == pOld) {
+            zero_pool[i] = pNew;
+            found = true;
+            break;
+        }
+    }
+
+    spinlock_unlock(&zero_pool_lock);
+
+    return found;
+}
+
+static struct page_mover zero_pool_mover = { _zero_pool_migrate };
+
+/*
+ * Takes a page from the zero pool, or returns NULL if it's empty.
+*/
+static void* _zero_pool_take()
+{
+    void *pPage = NULL;
+
+    // Compaction reads the flags with the PMM lock held and calls _zero_pool_migrate() under it, so
+    // take both in that order. A page is then either in the pool and movable, or handed out and not.
+    spinlock_lock(&lock);
+    spinlock_lock(&zero_pool_lock);
+
+    if (zero_pool_count > 0) {
+        pPage = zero_pool[--zero_pool_count];
+
+        // Whoever gets it won't expect it to move.
+        kmem_page(pPage)->flags &= ~PAGE_MOVABLE;
+    }
+
+    spinlock_unlock(&zero_pool_lock);
+    spinlock_unlock(&lock);
+
+    return pPage;
+}
+
+/*
+    Allocates contiguous pages with KALLOC_ flags controlling where they come from.
+    KALLOC_DMA32 asks for memory below 4 GiB, for devices that can only address 32 bits.
+    KALLOC_ZERO clears the memory, single pages come ready cleared from the zero pool when it has any.
+    KALLOC_COLOR starts the memory on the next cache color, see kmem_page_colors(). Use it for hot
+    structures that would otherwise all start on the same color, such as page aligned buffers.
+*/
+void* kalloc_zone(size_t numBytes, uint32_t flags)
+{
+    uint64_t pages = MAX(DIV_ROUNDUP(numBytes, PAGE_SIZE), 1);
+
+    // The pool pages could be from any zone.
+    if ((flags & KALLOC_ZERO) && pages == 1 && !(flags & KALLOC_DMA32)) {
+        void *pPage = _zero_pool_take();
+        if (pPage != NULL) {
+            __sync_fetch_and_add(&zero_pool_hits, 1);
+            return pPage;
+        }
+    }
+
+    void *pData = NULL;
+
+    if ((flags & KALLOC_COLOR) && page_colors > 1 && !(flags & KALLOC_DMA32)) {
+        pData = _kalloc_colored(cpu_node(), pages, __sync_fetch_and_add(&next_color, 1) & (page_colors - 1));
+    }
+
+    if (pData == NULL) {
+        pData = _kalloc_pages(cpu_node(), pages, 0, flags);
+    }
+
+    if (pData != NULL && (flags & KALLOC_ZERO)) {
+        __sync_fetch_and_add(&zero_pool_misses, 1);
+        _zero_pages_nt(pData, pages);
+    }
+
+    return pData;
+}
+
+/*
+    Allocates physical memory for mapping with large pages. The memory starts on a multiple of
+    2^order pages and is rounded up to a whole number of them, so use HUGE_PAGE_2M_ORDER for
+    2 MiB pages or HUGE_PAGE_1G_ORDER for 1 GiB pages. The allocation is tracked as a single
+    unit like any other and is given back with kfree().
+*/
+void* kalloc_huge(size_t numBytes, uint8_t order)
+{
+    if (order > BUDDY_MAX_ORDER) {
+        kprintf("PMM: Huge page order %d is larger than the maximum of %d.\n", order, BUDDY_MAX_ORDER);
+        return NULL;
+    }
+
+    uint64_t align = (uint64_t)1 << order;
+    uint64_t pages = MAX(DIV_ROUNDUP(numBytes, PAGE_SIZE), 1);
+
+    return _kalloc_pages(cpu_node(), ALIGN_UP(pages, align), order, 0);
+}
+
+/*
+    Allocates a number of contiguous pages.
+*/
+void* kpalloc(size_t numPages) {
+    return kalloc(PAGE_SIZE * numPages);
+}
+
+/*
+    Allocates a number of contiguous pages from the specified NUMA node.
+*/
+void* kpalloc_node(uint32_t node, size_t numPages) {
+    return kalloc_node(node, PAGE_SIZE * numPages);
+}
+
+/*
+    Returns the number of free pages held by the buddy allocator in a zone across all nodes.
+    Pages sitting in the per-CPU magazines aren't counted.
+*/
+uint64_t kmem_zone_free_pages(uint32_t zone)
+{
+    uint64_t pages = 0;
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        pages += mem_nodes[node].zones[zone].free_pages;
+    }
+
+    return pages;
+}
+
+/*
+ * Builds the node ranges from the memory affinity structures in the SRAT. Usable memory the SRAT
+ * doesn't cover stays with node 0. Must be called with the lock held.
+*/
+static void _numa_build_ranges()
+{
+    struct MemRange ranges[SRAT_MEM_LIST_LEN];
+    uint32_t count = 0;
+
+    for (int i = 0; i < SRAT_MEM_LIST_LEN && srat_mem_list[i] != NULL; i++) {
+        struct srat_mem_affinity *pMem = srat_mem_list[i];
+
+        // Ranges that only cover holes between sections come out empty.
+        uint64_t start_page = _phys_to_page(pMem->base);
+        uint64_t end_page = _phys_to_page(ALIGN_UP(pMem->base + pMem->range_length, PAGE_SIZE));
+
+        if (start_page >= end_page) {
+            continue;
         }
 
-        if (allocated_pages == pages_to_alloc) {
-            // We have enough memory now.
-            // Advance the cursor for the next alloc start.
-            allocation_cursor++;
-            if (allocation_cursor == max_pages_available) {
-                allocation_cursor = 0;
-            }
+        // Insert it sorted by start page.
+        uint32_t pos = count++;
+        while (pos > 0 && ranges[pos - 1].start_page > start_page) {
+            ranges[pos] = ranges[pos - 1];
+            pos--;
+        }
 
-            // Reserve it in the map and return the location.
-            _reserve_pages(start_alloc_page, allocated_pages);
-            
-            // Update the entry map to track how many pages we allocated from here.
-            entry_map[start_alloc_page].pages_allocated = allocated_pages;
+        ranges[pos].start_page = start_page;
+        ranges[pos].end_page = end_page;
+        ranges[pos].node = acpi_numa_node(pMem->proximity_domain);
+    }
 
-            num_pages_available -= allocated_pages;
-            spinlock_unlock(&lock);
-            return _get_addr_from_page(start_alloc_page);
+    // Lay the ranges out over the whole map, filling any gaps with node 0.
+    // Each pass adds up to two ranges, and one slot is kept for the tail and one for _split_zone_ranges().
+    uint64_t page = 0;
+    num_mem_ranges = 0;
+
+    for (uint32_t i = 0; i < count && num_mem_ranges < MEM_MAX_RANGES - 3; i++) {
+        if (ranges[i].end_page <= page) {
+            continue;
         }
 
-        // Forward the cursor and bounds check.
-        allocation_cursor++;
+        if (ranges[i].start_page > page) {
+            mem_ranges[num_mem_ranges].start_page = page;
+            mem_ranges[num_mem_ranges].end_page = ranges[i].start_page;
+            mem_ranges[num_mem_ranges].node = 0;
+            num_mem_ranges++;
+            page = ranges[i].start_page;
+        }
 
-        if (allocation_cursor == max_pages_available) {
-            allocation_cursor = 0;
+        mem_ranges[num_mem_ranges].start_page = page;
+        mem_ranges[num_mem_ranges].end_page = ranges[i].end_page;
+        mem_ranges[num_mem_ranges].node = ranges[i].node;
+        num_mem_ranges++;
+        page = ranges[i].end_page;
+    }
 
-            if (looped) {
-                // If we've looped around already, we failed to find
-                // a suitable hole in the memory map.
-                break;
+    if (page < num_pages_in_map) {
+        mem_ranges[num_mem_ranges].start_page = page;
+        mem_ranges[num_mem_ranges].end_page = num_pages_in_map;
+        mem_ranges[num_mem_ranges].node = 0;
+        num_mem_ranges++;
+    }
+
+    _split_zone_ranges();
+}
+
+/*
+ * Moves every free block out of node 0 and frees it again now the node ranges are known, which
+ * splits blocks at node boundaries and files them under the right node. Must be called with the lock held.
+*/
+static void _numa_redistribute()
+{
+    struct FreeBlock *lists[MEM_ZONE_COUNT][BUDDY_MAX_ORDER + 1];
+
+    // Take the lists off node 0 and forget the blocks are free, so they can't be merged with
+    // each other until they've been freed again.
+    for (uint32_t zone = 0; zone < MEM_ZONE_COUNT; zone++) {
+        struct MemZone *pZone = &mem_nodes[0].zones[zone];
+
+        for (uint8_t order = 0; order <= BUDDY_MAX_ORDER; order++) {
+            lists[zone][order] = pZone->free_lists[order];
+            pZone->free_lists[order] = NULL;
+            pZone->free_counts[order] = 0;
+
+            for (struct FreeBlock *pBlock = lists[zone][order]; pBlock != NULL; pBlock = pBlock->pNext) {
+                bitmap_off(free_heads, _get_page_from_addr(pBlock));
             }
-            
-            // Start looking from the start and back to seeking
-            // as we break the contiguous allocation.
-            looped = true;
-            allocating = false;
         }
-    }
 
-    // Failed to allocate getting this far.
-    spinlock_unlock(&lock);
+        pZone->free_pages = 0;
+    }
 
-    kprintf("PMM Allocation failed.\n");
+    for (uint32_t zone = 0; zone < MEM_ZONE_COUNT; zone++) {
+        for (uint8_t order = 0; order <= BUDDY_MAX_ORDER; order++) {
+            struct FreeBlock *pBlock = lists[zone][order];
 
-    return NULL;
+            while (pBlock != NULL) {
+                struct FreeBlock *pNext = pBlock->pNext;
+                _buddy_free_range(_get_page_from_addr(pBlock), (uint64_t)1 << order);
+                pBlock = pNext;
+            }
+        }
+    }
 }
 
 /*
-    Allocates a number of contiguous pages.
+    Splits the PMM in to the NUMA nodes described by the ACPI SRAT and SLIT. This has to run after
+    acpi_init() and before kmem_init_deferred(). Without a SRAT everything stays in node 0.
 */
-void* kpalloc(size_t numPages) {
-    return kalloc(PAGE_SIZE * numPages);
+void kmem_numa_init()
+{
+    cpu_locals[cpu_index()].node = acpi_numa_node_of_apic(cpu_locals[cpu_index()].lapic_id);
+
+    if (numa_node_count <= 1) {
+        kprintf("PMM: Single NUMA node.\n");
+        return;
+    }
+
+    spinlock_lock(&lock);
+
+    _numa_build_ranges();
+
+    // Work out the order each node falls back to the others, nearest first.
+    for (uint32_t node = 0; node < numa_node_count; node++) {
+        uint32_t *fallback = mem_nodes[node].fallback;
+
+        for (uint32_t i = 0; i < numa_node_count; i++) {
+            uint32_t pos = i;
+
+            while (pos > 0 && acpi_numa_distance(node, fallback[pos - 1]) > acpi_numa_distance(node, i)) {
+                fallback[pos] = fallback[pos - 1];
+                pos--;
+            }
+
+            fallback[pos] = i;
+        }
+    }
+
+    mem_node_count = numa_node_count;
+    _numa_redistribute();
+
+    spinlock_unlock(&lock);
+
+    for (uint32_t i = 0; i < num_mem_ranges; i++) {
+        kprintf("PMM: Pages %lu - %lu in node %d.\n", mem_ranges[i].start_page, mem_ranges[i].end_page, mem_ranges[i].node);
+    }
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        struct MemZone *pZones = mem_nodes[node].zones;
+        kprintf("PMM: Node %d has %lu free pages.\n", node, pZones[MEM_ZONE_DMA32].free_pages + pZones[MEM_ZONE_NORMAL].free_pages);
+    }
 }
 
 /*
@@ -459,6 +2345,8 @@ void kmem_init()
 {
     kprintf("Initialzing PMM...\n");
 
+    uint64_t start_cycles = rdtsc();
+
     _init_stats();
 
     kprintf("Total Memory: %lu Mib\n", total_memory_bytes / 1024 / 1024);
@@ -467,40 +2355,469 @@ void kmem_init()
     kprintf("Lowest Memory Addr: 0x%X\n", lowest_address);
     
     _create_page_bitmap();
-    
-    // Allocate memory for the page entry entries.
-    entry_map = (struct PageEntry*)memmap_alloc(ALIGN_UP(sizeof(struct PageEntry) * num_pages_in_map, PAGE_SIZE));
+    _create_page_map();
+    _init_colors();
 
     _get_free_pages();
 
-    kprintf("PMM initialized.\n");
+    boot_init_cycles = rdtsc() - start_cycles;
+
+    kprintf("PMM initialized, %lu pages deferred.\n", num_pages_in_map - deferred_start_page);
 }
 
 /*
- * Frees the pages allocated from a previous kalloc() call.
+ * Drops a reference to the pages allocated from a previous kalloc() call, freeing them once
+ * the last reference is gone. Without page_get() there's only the one reference, so this frees.
+ * NULL is ignored like free() does, so error paths can hand back whatever they did get.
 */
 void kfree(void *ptr)
 {
-    spinlock_lock(&lock);
+    if (ptr == NULL) {
+        return;
+    }
 
     uint64_t page_index = _get_page_from_addr(ptr);
     
-    if (page_index >= max_pages_available) {
+    if (page_index >= num_pages_in_map) {
         kprintf("*FATAL*: Page index lookup resulted in out of bounds value of %lu from address 0x%X.\n", page_index, ptr);
         hcf();
     }
 
-    // Turn off all the bits for all of the pages that were allocated.
-    for (uint64_t i = page_index; i < page_index + entry_map[page_index].pages_allocated; i++) {
-        bitmap_off(page_bitmap, i);
+    struct page *pPage = _page_find(page_index);
+    uint64_t pages = pPage != NULL ? pPage->pages_allocated : 0;
+
+    if (pages == 0) {
+        kprintf("PMM: Free of unallocated address 0x%X ignored.\n", ptr);
+        return;
+    }
+
+    // Still shared with someone else.
+    if (__sync_sub_and_fetch(&pPage->refcount, 1) > 0) {
+        return;
+    }
+
+    page_magazines[cpu_index()].frees++;
+
+    pPage->flags = 0;
+    pPage->pOwner = NULL;
+
+    // Single pages go to this CPU's magazine, unless they belong to another node.
+    if (pages == 1 && (mem_node_count == 1 || _page_range(page_index)->node == cpu_node())) {
+        _pcp_free(page_index);
+        return;
+    }
+
+    spinlock_lock(&lock);
+
+    // Turn off all the bits for all of the pages that were allocated and give them back to the buddy allocator.
+    _release_pages(page_index, pages);
+    _buddy_free_range(page_index, pages);
+
+    // Update the descriptor.
+    pPage->pages_allocated = 0;
+    num_pages_available += pages;
+
+    spinlock_unlock(&lock);
+}
+
+/*
+    Zeroes up to ZERO_POOL_BATCH pages in to the zero pool. This is meant to be called whenever the
+    kernel has nothing better to do, so it only does a little work each time and stops topping up
+    the pool when free memory runs low.
+*/
+void kmem_zero_pool_fill()
+{
+    for (uint32_t i = 0; i < ZERO_POOL_BATCH; i++) {
+        if (zero_pool_count >= ZERO_POOL_CAPACITY || num_pages_available < ZERO_POOL_MIN_FREE_PAGES) {
+            return;
+        }
+
+        void *pPage = kalloc(PAGE_SIZE);
+        if (pPage == NULL) {
+            return;
+        }
+
+        _zero_pages_nt(pPage, 1);
+        kmem_set_movable(pPage, &zero_pool_mover);
+
+        spinlock_lock(&zero_pool_lock);
+
+        if (zero_pool_count < ZERO_POOL_CAPACITY) {
+            zero_pool[zero_pool_count++] = pPage;
+            pPage = NULL;
+        }
+
+        spinlock_unlock(&zero_pool_lock);
+
+        // Another CPU filled the pool while we were zeroing.
+        if (pPage != NULL) {
+            spinlock_lock(&lock);
+            kmem_page(pPage)->flags &= ~PAGE_MOVABLE;
+            spinlock_unlock(&lock);
+            kfree(pPage);
+            return;
+        }
+    }
+}
+
+/*
+    Gives every page in the zero pool back to the PMM.
+*/
+void kmem_zero_pool_drain()
+{
+    void *pPage;
+
+    while ((pPage = _zero_pool_take()) != NULL) {
+        kfree(pPage);
+    }
+}
+
+/*
+    Returns the number of zeroed pages waiting in the zero pool.
+*/
+uint32_t kmem_zero_pool_count()
+{
+    return zero_pool_count;
+}
+
+/*
+ * Walks the runs of free pages between 'first' and 'last', adding them to the run histogram and
+ * largest run in 'pStats' if it's given. Returns the number of free pages found.
+ * Must be called with the lock held.
+*/
+static uint64_t _scan_free_runs(uint64_t first, uint64_t last, struct kmem_stats *pStats)
+{
+    uint64_t free = 0;
+    uint64_t page = sbitmap_find_clear(&page_bitmap, first);
+
+    while (page < last) {
+        uint64_t end = bitmap_find_set(page_bitmap.bits, page, last);
+        uint64_t run = end - page;
+
+        if (pStats != NULL) {
+            pStats->free_runs[63 - __builtin_clzll(run)]++;
+            pStats->largest_free_run = MAX(pStats->largest_free_run, run);
+        }
+
+        free += run;
+        page = sbitmap_find_clear(&page_bitmap, end);
+    }
+
+    return free;
+}
+
+/*
+    Takes a snapshot of the state of the PMM.
+*/
+void kmem_get_stats(struct kmem_stats *pStats)
+{
+    memset(pStats, 0, sizeof(struct kmem_stats));
+
+    pStats->total_pages = max_pages_available;
+    pStats->zero_pool_pages = zero_pool_count;
+    pStats->color_pages = color_list_pages;
+    pStats->zero_pool_hits = zero_pool_hits;
+    pStats->zero_pool_misses = zero_pool_misses;
+    pStats->alloc_failures = alloc_failures;
+    pStats->compact_runs = compact_runs;
+    pStats->compact_successes = compact_successes;
+    pStats->compact_pages_migrated = compact_pages_migrated;
+    pStats->desc_chunks = num_desc_chunks;
+    pStats->desc_pages = num_desc_pages;
+
+    for (uint32_t cpu = 0; cpu < MAX_CPUS; cpu++) {
+        pStats->pcp_pages += page_magazines[cpu].count;
+        pStats->allocs += page_magazines[cpu].allocs;
+        pStats->frees += page_magazines[cpu].frees;
+    }
+
+    spinlock_lock(&lock);
+
+    pStats->free_pages = num_pages_available;
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        for (uint32_t zone = 0; zone < MEM_ZONE_COUNT; zone++) {
+            struct MemZone *pZone = &mem_nodes[node].zones[zone];
+
+            pStats->zone_free_pages[zone] += pZone->free_pages;
+
+            for (uint8_t order = 0; order <= BUDDY_MAX_ORDER; order++) {
+                pStats->free_blocks[order] += pZone->free_counts[order];
+            }
+        }
+    }
+
+    _scan_free_runs(0, num_pages_in_map, pStats);
+
+    spinlock_unlock(&lock);
+}
+
+/*
+ * Returns the number of free pages in a memory map entry.
+*/
+static uint64_t _region_free_pages(struct limine_memmap_entry *entry)
+{
+    uint64_t first = _phys_to_page(entry->base);
+    uint64_t last = _phys_to_page(entry->base + entry->length);
+
+    spinlock_lock(&lock);
+    uint64_t free = _scan_free_runs(first, last, NULL);
+    spinlock_unlock(&lock);
+
+    return free;
+}
+
+/*
+    Prints a report of memory usage and fragmentation. The run histogram counts the runs of
+    contiguous free pages by size, the block counts are what the buddy allocator holds at each order.
+*/
+void kmem_report()
+{
+    struct kmem_stats stats;
+    kmem_get_stats(&stats);
+
+    kprintf("PMM: %lu of %lu pages free, %lu in per-CPU magazines, %lu in the zero pool.\n",
+        stats.free_pages, stats.total_pages, stats.pcp_pages, stats.zero_pool_pages);
+    kprintf("PMM: Zone DMA32 %lu free, NORMAL %lu free.\n",
+        stats.zone_free_pages[MEM_ZONE_DMA32], stats.zone_free_pages[MEM_ZONE_NORMAL]);
+    kprintf("PMM: %lu allocs, %lu frees, %lu failed.\n", stats.allocs, stats.frees, stats.alloc_failures);
+    kprintf("PMM: Largest free run %lu pages.\n", stats.largest_free_run);
+    kprintf("PMM: %lu compactions, %lu succeeded, %lu pages migrated.\n",
+        stats.compact_runs, stats.compact_successes, stats.compact_pages_migrated);
+    kprintf("PMM: %d page colors, %lu pages in the color lists.\n", page_colors, stats.color_pages);
+    kprintf("PMM: Page descriptors use %lu pages for %lu of %lu chunks.\n",
+        stats.desc_pages, stats.desc_chunks, num_page_chunks);
+
+    kprintf("Free runs:");
+    for (int i = 0; i < KMEM_RUN_BUCKETS; i++) {
+        if (stats.free_runs[i] > 0) {
+            kprintf(" %lu+:%lu", (uint64_t)1 << i, stats.free_runs[i]);
+        }
+    }
+    kprintf("\n");
+
+    kprintf("Free blocks:");
+    for (int order = 0; order <= BUDDY_MAX_ORDER; order++) {
+        if (stats.free_blocks[order] > 0) {
+            kprintf(" o%d:%lu", order, stats.free_blocks[order]);
+        }
+    }
+    kprintf("\n");
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type == LIMINE_MEMMAP_USABLE) {
+            uint64_t pages = entry->length / PAGE_SIZE;
+            uint64_t free = _region_free_pages(entry);
+            kprintf("Region 0x%X: %lu pages, %lu used, %lu free.\n", entry->base, pages, pages - free, free);
+        }
+    }
+}
+
+/*
+    Writes the same report as kmem_report() to the serial port as one key=value pair per line,
+    between PMM_STATS_BEGIN and PMM_STATS_END, for scripts to pick up.
+*/
+void kmem_report_serial()
+{
+    struct kmem_stats stats;
+    kmem_get_stats(&stats);
+
+    write_serial_strf(PORT_COM1, "PMM_STATS_BEGIN\n");
+    write_serial_strf(PORT_COM1, "tsc=%lu\n", rdtsc());
+    write_serial_strf(PORT_COM1, "total_pages=%lu\n", stats.total_pages);
+    write_serial_strf(PORT_COM1, "free_pages=%lu\n", stats.free_pages);
+    write_serial_strf(PORT_COM1, "pcp_pages=%lu\n", stats.pcp_pages);
+    write_serial_strf(PORT_COM1, "zero_pool_pages=%lu\n", stats.zero_pool_pages);
+    write_serial_strf(PORT_COM1, "zero_pool_hits=%lu\n", stats.zero_pool_hits);
+    write_serial_strf(PORT_COM1, "zero_pool_misses=%lu\n", stats.zero_pool_misses);
+    write_serial_strf(PORT_COM1, "zone_dma32_free=%lu\n", stats.zone_free_pages[MEM_ZONE_DMA32]);
+    write_serial_strf(PORT_COM1, "zone_normal_free=%lu\n", stats.zone_free_pages[MEM_ZONE_NORMAL]);
+    write_serial_strf(PORT_COM1, "allocs=%lu\n", stats.allocs);
+    write_serial_strf(PORT_COM1, "frees=%lu\n", stats.frees);
+    write_serial_strf(PORT_COM1, "alloc_failures=%lu\n", stats.alloc_failures);
+    write_serial_strf(PORT_COM1, "largest_free_run=%lu\n", stats.largest_free_run);
+    write_serial_strf(PORT_COM1, "compact_runs=%lu\n", stats.compact_runs);
+    write_serial_strf(PORT_COM1, "compact_successes=%lu\n", stats.compact_successes);
+    write_serial_strf(PORT_COM1, "compact_pages_migrated=%lu\n", stats.compact_pages_migrated);
+    write_serial_strf(PORT_COM1, "color_pages=%lu\n", stats.color_pages);
+    write_serial_strf(PORT_COM1, "desc_pages=%lu\n", stats.desc_pages);
+    write_serial_strf(PORT_COM1, "desc_chunks=%lu\n", stats.desc_chunks);
+
+    for (int i = 0; i < KMEM_RUN_BUCKETS; i++) {
+        write_serial_strf(PORT_COM1, "free_runs.%d=%lu\n", i, stats.free_runs[i]);
+    }
+
+    for (int order = 0; order <= BUDDY_MAX_ORDER; order++) {
+        write_serial_strf(PORT_COM1, "free_blocks.%d=%lu\n", order, stats.free_blocks[order]);
+    }
+
+    for (size_t i = 0; i < memmap->entry_count; i++) {
+        struct limine_memmap_entry *entry = memmap->entries[i];
+
+        if (entry->type == LIMINE_MEMMAP_USABLE) {
+            write_serial_strf(PORT_COM1, "region.%d=0x%x,%lu,%lu\n",
+                (int)i, entry->base, entry->length / PAGE_SIZE, _region_free_pages(entry));
+        }
+    }
+
+    write_serial_strf(PORT_COM1, "PMM_STATS_END\n");
+}
+
+/*
+    Marks an allocation as movable, so compaction can migrate it to build larger free runs.
+    When it's moved, pMover->migrate() is called with the old and new addresses once the contents
+    have been copied, so the owner can update its pointers. It's called with the PMM lock held so it
+    mustn't allocate or free pages, and it returns false if the owner no longer holds the allocation.
+    Movable allocations must not be on a page_list.
+*/
+void kmem_set_movable(void *ptr, struct page_mover *pMover)
+{
+    struct page *pPage = kmem_page(ptr);
+
+    spinlock_lock(&lock);
+    pPage->pOwner = pMover;
+    pPage->flags |= PAGE_MOVABLE;
+    spinlock_unlock(&lock);
+}
+
+/*
+    Compacts memory while the kernel is idle. When a zone has plenty of free pages but no free
+    block of PMM_COMPACT_ORDER or above, a block that size is put back together. This runs at
+    most once every PMM_COMPACT_INTERVAL cycles, so repeated failures don't hog the CPU.
+*/
+void kmem_compact_background()
+{
+    uint64_t now = rdtsc();
+
+    if (now - compact_last_tsc < PMM_COMPACT_INTERVAL) {
+        return;
     }
 
-    // Update the entry.
-    entry_map[page_index].pages_allocated = 0;
+    compact_last_tsc = now;
+
+    spinlock_lock(&lock);
+
+    for (uint32_t node = 0; node < mem_node_count; node++) {
+        for (uint32_t zone = 0; zone < MEM_ZONE_COUNT; zone++) {
+            struct MemZone *pZone = &mem_nodes[node].zones[zone];
+            bool has_block = false;
+
+            for (uint8_t order = PMM_COMPACT_ORDER; order <= BUDDY_MAX_ORDER; order++) {
+                if (pZone->free_counts[order] > 0) {
+                    has_block = true;
+                    break;
+                }
+            }
+
+            if (!has_block && pZone->free_pages >= ((uint64_t)2 << PMM_COMPACT_ORDER)) {
+                _compact_zone(node, zone, PMM_COMPACT_ORDER);
+            }
+        }
+    }
 
     spinlock_unlock(&lock);
 }
 
+/*
+    Returns the descriptor of the page holding 'ptr', which must be a higher half address of RAM.
+    NULL if the page doesn't have one, see struct page.
+*/
+struct page* kmem_page(void *ptr)
+{
+    uint64_t page_index = _get_page_from_addr(ptr);
+
+    if (page_index >= num_pages_in_map) {
+        return NULL;
+    }
+
+    return _page_find(page_index);
+}
+
+/*
+    Returns the higher half address of the page a descriptor describes.
+*/
+void* kmem_page_addr(struct page *pPage)
+{
+    return _get_addr_from_page(pPage->index);
+}
+
+/*
+    Takes another reference to an allocation, given the descriptor of its first page. Each
+    reference is dropped with page_put() or kfree(), the pages are freed when none are left.
+*/
+void page_get(struct page *pPage)
+{
+    __sync_fetch_and_add(&pPage->refcount, 1);
+}
+
+/*
+    Drops a reference to an allocation, given the descriptor of its first page.
+*/
+void page_put(struct page *pPage)
+{
+    kfree(kmem_page_addr(pPage));
+}
+
+/*
+    Appends a page to the tail of a list, using the LRU links in its descriptor. A page can only
+    be on one list at a time.
+*/
+void page_list_add(struct page_list *pList, struct page *pPage)
+{
+    uint32_t index = pPage->index;
+
+    pPage->lru_next = PAGE_LRU_NONE;
+    pPage->lru_prev = pList->tail;
+
+    if (pList->tail != PAGE_LRU_NONE) {
+        _page(pList->tail)->lru_next = index;
+    } else {
+        pList->head = index;
+    }
+
+    pList->tail = index;
+    pList->count++;
+}
+
+/*
+    Unlinks a page from the list it's on.
+*/
+void page_list_remove(struct page_list *pList, struct page *pPage)
+{
+    if (pPage->lru_prev != PAGE_LRU_NONE) {
+        _page(pPage->lru_prev)->lru_next = pPage->lru_next;
+    } else {
+        pList->head = pPage->lru_next;
+    }
+
+    if (pPage->lru_next != PAGE_LRU_NONE) {
+        _page(pPage->lru_next)->lru_prev = pPage->lru_prev;
+    } else {
+        pList->tail = pPage->lru_prev;
+    }
+
+    pPage->lru_next = PAGE_LRU_NONE;
+    pPage->lru_prev = PAGE_LRU_NONE;
+    pList->count--;
+}
+
+/*
+    Removes and returns the page at the head of a list, the least recently added. NULL if it's empty.
+*/
+struct page* page_list_pop(struct page_list *pList)
+{
+    if (pList->head == PAGE_LRU_NONE) {
+        return NULL;
+    }
+
+    struct page *pPage = _page(pList->head);
+    page_list_remove(pList, pPage);
+
+    return pPage;
+}
+
 // Dumps contents of the specified memory location in char format.
 void memdumps(void *location, uint64_t len_bytes)
 {
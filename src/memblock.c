@@ -0,0 +1,273 @@
+/*
+    BloreOS - Operating System
+    Copyright (C) 2023 Martin Blore
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+    This is the early boot allocator, used for the PMM's own tables before the PMM exists.
+
+    Allocations are recorded as reserved regions of physical memory, kept sorted and merged, and the
+    Limine memory map is left exactly as the firmware gave it to us. Memory is taken top-down, from
+    the highest usable address that fits, which keeps boot data clear of the low memory that devices
+    limited to 32 bits depend on. Once the PMM takes over it calls memblock_seal() and hands every
+    usable page that isn't reserved to the buddy allocator in one go, see memblock_find_free().
+*/
+#include <memblock.h>
+#include <mem.h>
+#include <limine.h>
+#include <str.h>
+#include <math.h>
+#include <kernel.h>
+
+/*
+    A reserved range of physical memory.
+*/
+struct MemblockRegion {
+    uint64_t base;
+    uint64_t size;
+};
+
+static struct MemblockRegion regions[MEMBLOCK_MAX_REGIONS];
+static uint32_t num_regions = 0;
+
+// Set once the PMM owns the free memory, after which nothing more can be allocated here.
+static bool sealed = false;
+
+/*
+ * Removes the region at 'index', moving the ones above it down.
+*/
+static void _region_remove(uint32_t index)
+{
+    for (uint32_t i = index; i + 1 < num_regions; i++) {
+        regions[i] = regions[i + 1];
+    }
+
+    num_regions--;
+}
+
+/*
+ * Records [base, base + size) as reserved, merging it with any region it touches.
+*/
+static void _region_add(uint64_t base, uint64_t size)
+{
+    uint64_t end = base + size;
+    uint32_t index = 0;
+
+    while (index < num_regions && regions[index].base + regions[index].size < base) {
+        index++;
+    }
+
+    // Swallow every region that overlaps or touches the new one.
+    while (index < num_regions && regions[index].base <= end) {
+        base = MIN(base, regions[index].base);
+        end = MAX(end, regions[index].base + regions[index].size);
+        _region_remove(index);
+    }
+
+    if (num_regions == MEMBLOCK_MAX_REGIONS) {
+        kprintf("*FATAL*: Memblock ran out of regions.\n");
+        hcf();
+    }
+
+    for (uint32_t i = num_regions; i > index; i--) {
+        regions[i] = regions[i - 1];
+    }
+
+    regions[index].base = base;
+    regions[index].size = end - base;
+    num_regions++;
+}
+
+/*
+ * Returns a region that overlaps [base, end), or NULL if that range is free.
+*/
+static struct MemblockRegion* _region_overlap(uint64_t base, uint64_t end)
+{
+    for (uint32_t i = 0; i < num_regions && regions[i].base < end; i++) {
+        if (regions[i].base + regions[i].size > base) {
+            return &regions[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Allocates 'size' bytes aligned to 'align', a power of two, from the highest usable memory
+    between 'min_addr' and 'max_addr'. Returns the higher half address, or NULL if nothing fits.
+    The memory is not cleared.
+*/
+void* memblock_alloc_range(size_t size, size_t align, uint64_t min_addr, uint64_t max_addr)
+{
+    if (sealed) {
+        kprintf("Memblock: Allocation of %lu bytes after the PMM took over.\n", size);
+        return NULL;
+    }
+
+    align = MAX(align, MEMBLOCK_MIN_ALIGN);
+    size = ALIGN_UP(MAX(size, 1), MEMBLOCK_MIN_ALIGN);
+
+    // The entries are sorted by address, so walking them backwards goes top-down.
+    for (size_t i = memmap->entry_count; i > 0; i--) {
+        struct limine_memmap_entry *entry = memmap->entries[i - 1];
+
+        if (entry->type != LIMINE_MEMMAP_USABLE) {
+            continue;
+        }
+
+        uint64_t bottom = MAX(entry->base, min_addr);
+        uint64_t top = MIN(entry->base + entry->length, max_addr);
+
+        while (top >= bottom + size) {
+            uint64_t start = ALIGN_DOWN(top - size, align);
+            if (start < bottom) {
+                break;
+            }
+
+            // Anything in the way means trying again below it.
+            struct MemblockRegion *pRegion = _region_overlap(start, start + size);
+            if (pRegion == NULL) {
+                _region_add(start, size);
+                return (void*)(start + vmm_higher_half_offset);
+            }
+
+            top = pRegion->base;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Allocates 'size' bytes aligned to 'align' from anywhere in usable memory, see memblock_alloc_range().
+    Only meant for what the kernel can't boot without, so running out is fatal.
+*/
+void* memblock_alloc(size_t size, size_t align)
+{
+    void *pData = memblock_alloc_range(size, align, 0, MEMBLOCK_ALLOC_ANYWHERE);
+
+    if (pData == NULL) {
+        kprintf("Couldn't allocate memory!");
+        hcf();
+    }
+
+    return pData;
+}
+
+/*
+    Gives back memory from memblock_alloc() before the PMM takes over, so it's handed to the PMM
+    along with the rest. Anything freed after that stays reserved.
+*/
+void memblock_free(void *ptr, size_t size)
+{
+    if (sealed) {
+        kprintf("Memblock: Free of 0x%X after the PMM took over ignored.\n", ptr);
+        return;
+    }
+
+    uint64_t base = (uint64_t)ptr - vmm_higher_half_offset;
+    uint64_t end = base + ALIGN_UP(MAX(size, 1), MEMBLOCK_MIN_ALIGN);
+    uint32_t i = 0;
+
+    while (i < num_regions) {
+        struct MemblockRegion *pRegion = &regions[i];
+        uint64_t region_end = pRegion->base + pRegion->size;
+
+        if (region_end <= base || pRegion->base >= end) {
+            i++;
+            continue;
+        }
+
+        if (pRegion->base < base) {
+            // Keep the part below, and above as a region of its own if the free was from the middle.
+            pRegion->size = base - pRegion->base;
+
+            if (region_end > end) {
+                _region_add(end, region_end - end);
+            }
+
+            i++;
+        } else if (region_end > end) {
+            pRegion->base = end;
+            pRegion->size = region_end - end;
+            i++;
+        } else {
+            _region_remove(i);
+        }
+    }
+}
+
+/*
+    Finds the first part of [base, end) that isn't reserved, returning false if there is none.
+    Calling this again from the end of each part walks all the free memory in a range.
+*/
+bool memblock_find_free(uint64_t base, uint64_t end, uint64_t *pStart, uint64_t *pEnd)
+{
+    for (uint32_t i = 0; i < num_regions && base < end; i++) {
+        uint64_t region_end = regions[i].base + regions[i].size;
+
+        if (region_end <= base) {
+            continue;
+        }
+
+        if (regions[i].base > base) {
+            *pStart = base;
+            *pEnd = MIN(regions[i].base, end);
+            return true;
+        }
+
+        base = region_end;
+    }
+
+    if (base < end) {
+        *pStart = base;
+        *pEnd = end;
+        return true;
+    }
+
+    return false;
+}
+
+/*
+    Returns the number of pages that hold any reserved memory.
+*/
+uint64_t memblock_reserved_pages()
+{
+    uint64_t pages = 0;
+    uint64_t next_page = 0;
+
+    for (uint32_t i = 0; i < num_regions; i++) {
+        uint64_t first = MAX(regions[i].base / PAGE_SIZE, next_page);
+        uint64_t end = DIV_ROUNDUP(regions[i].base + regions[i].size, PAGE_SIZE);
+
+        if (end > first) {
+            pages += end - first;
+        }
+
+        next_page = MAX(next_page, end);
+    }
+
+    return pages;
+}
+
+/*
+    Stops any more allocations, called by the PMM as it takes over the free memory.
+*/
+void memblock_seal()
+{
+    sealed = true;
+
+    kprintf("Memblock: %d regions reserving %lu pages handed over to the PMM.\n", num_regions, memblock_reserved_pages());
+}
@@ -21,10 +21,13 @@
 #include <acpi.h>
 #include <mem.h>
 #include <alloc.h>
+#include <slab.h>
 
 struct pci_device *pci_devices[32];
 uint8_t pci_device_cnt = 0;
 
+static struct SlabCache *pci_device_cache;
+
 /*
  * Gets the device string represenation of the specified class and sub-class codes.
 */
@@ -192,7 +195,7 @@ void _check_function(uint8_t bus, uint8_t device, uint8_t function, uint16_t hea
     uint8_t progif = _pci_mm_read_prog_if(bus, device, function);
 
     // Create the new device and store it in the device list.
-    struct pci_device *dev = (struct pci_device*)malloc(sizeof(struct pci_device));
+    struct pci_device *dev = (struct pci_device*)kmem_cache_alloc(pci_device_cache);
     pci_devices[pci_device_cnt++] = dev;
     dev->class_code = classcode;
     dev->sub_class_code = subclass;
@@ -247,6 +250,7 @@ void _scan_all_buses()
 
 void pci_init()
 {
+    pci_device_cache = kmem_cache_create("pci_device", sizeof(struct pci_device), SLAB_CACHE_LINE_SIZE, NULL);
     _scan_all_buses();
     kprintf("PCI: Found %d PCI devices.\n", pci_device_cnt);
     kprintf("PCI: Initialized.\n");
@@ -26,6 +26,10 @@
 #include <cpu.h>
 #include <atomic.h>
 #include <idt.h>
+#include <alloc.h>
+#include <allocbench.h>
+#include <slab.h>
+#include <vm.h>
 
 typedef struct {
     uint16_t magic;         // Magic bytes for identification.
@@ -365,6 +369,31 @@ void _handle_cmd()
         tprintf("Kerner Time: %lums\n", kernel_timer_secs);
     } else if (strcmp(input_str, "stime") == 0) {
         tprintf("Kerner Time: %lus\n", kernel_timer_secs / 1000);
+    } else if (strcmp(input_str, "memstat") == 0) {
+        kmem_report();
+    } else if (strcmp(input_str, "memdump") == 0) {
+        kmem_report_serial();
+        tprintf("PMM stats written to serial.\n");
+    } else if (strcmp(input_str, "membench") == 0) {
+        memops_benchmark();
+    } else if (strcmp(input_str, "colorbench") == 0) {
+        kmem_color_benchmark();
+    } else if (strcmp(input_str, "allocbench") == 0) {
+        alloc_benchmark();
+    } else if (strcmp(input_str, "vmstat") == 0) {
+        vm_report();
+    } else if (strcmp(input_str, "slabinfo") == 0) {
+        kmem_cache_report();
+    } else if (strcmp(input_str, "heapprof") == 0) {
+        alloc_profile_report();
+    } else if (strcmp(input_str, "heapdump") == 0) {
+        alloc_profile_report_serial();
+        tprintf("Heap profile written to serial.\n");
+    } else if (strcmp(input_str, "zeropool") == 0) {
+        uint64_t requests = zero_pool_hits + zero_pool_misses;
+        tprintf("Zero pool: %d pages, %lu hits, %lu misses, %lu percent hit rate\n",
+            kmem_zero_pool_count(), zero_pool_hits, zero_pool_misses,
+            requests > 0 ? zero_pool_hits * 100 / requests : 0);
     } else {
         tprintf("Unknown command.\n");
     }
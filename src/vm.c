@@ -23,10 +23,27 @@
 #include <cpu.h>
 #include <math.h>
 #include <mem.h>
+#include <atomic.h>
+#include <kernel.h>
 
 #define PAGE_PRESENT    0x1
 #define PAGE_RW         0x2
 #define PAGE_USER       0x4
+#define PAGE_PWT        0x8
+#define PAGE_PCD        0x10
+#define PAGE_LARGE      0x80        // PS in a PDPT/PD entry, 1GB/2MB page.
+#define PAGE_PAT        0x80        // PAT in a PT entry.
+#define PAGE_GLOBAL     0x100
+#define PAGE_OWNED      0x200       // Available to software: the table this entry points to was allocated by the VMM.
+#define PAGE_PAT_LARGE  0x1000      // PAT in a PDPT/PD entry.
+#define PAGE_NX         0x8000000000000000
+
+// Address bits of an entry, bit 12 doubles as PAT in large page entries and is carried along with the address.
+#define VM_ADDR_MASK    0x000FFFFFFFFFF000
+
+// Table index and bytes covered by an entry at a paging level (1 = PT ... 4 = PML4).
+#define VM_INDEX(va, level) (((va) >> (12 + 9 * ((level) - 1))) & 0x1FF)
+#define VM_LEVEL_SIZE(level) ((uint64_t)1 << (12 + 9 * ((level) - 1)))
 
 // Macros for extracting page entry indexes from a virtual address (table 4.2 in intel SDM vol-3).
 // Note: Remember, virtual addresses are just encoded page entries, containing the 4 keys in the virtual map lookup.
@@ -38,10 +55,31 @@
 
 // Converts a physical address to the virtual direct memory map address.
 #define PHYS_TO_VIRT(addr) ((void*)((uint64_t)(addr) + vmm_higher_half_offset))
+#define VIRT_TO_PHYS(addr) ((uint64_t)(addr) - vmm_higher_half_offset)
 
 uint32_t maxphyaddr;
 uint32_t maxlinaddr;
 
+// The kernel's own PML4, loaded in to CR3 by vm_init().
+static uint64_t *pKernelPml4 = NULL;
+static spinlock_t vm_lock = {0};
+static bool nx_enabled = false;
+
+// Stats.
+static uint64_t vm_table_pages = 0;
+static uint64_t vm_split_pages = 0;
+static uint64_t vm_invlpgs = 0;
+static uint64_t vm_full_flushes = 0;
+
+/*
+    TLB invalidations gathered while an operation edits the tables and issued once at the end.
+    Only the first VM_FLUSH_THRESHOLD addresses are kept, more than that turns in to a full flush.
+*/
+struct VmFlush {
+    uint32_t count;
+    uint64_t pages[VM_FLUSH_THRESHOLD];
+};
+
 /*
     Given a virtual address, walks the page tables stored at CR3 to resolve the address to a physical address.
 */
@@ -55,8 +93,6 @@ uint64_t walk_page_table(uint64_t virt_addr)
     // Meaning, the CR3 is the START of the entire virtual memory layout starting at the 4th level of paging.
     // Note how the keys in to the tables are being extracted from the 'virt_addr'.
 
-    // No support for 1GB or 2MB pages.
-
     uint64_t cr3 = get_cr3();
 
     // According to the Intel SDM, bits 12 to 12+(MAXPHYADDR-1), so bits 12 to 51 in QEmu that reports a 40 MAXPHYADDR.
@@ -85,6 +121,11 @@ uint64_t walk_page_table(uint64_t virt_addr)
         return 0;
     }
 
+    // Same for a 1GB page, with a 30 bit offset.
+    if (pdpte & PAGE_LARGE) {
+        return (pdpte & addrmask & ~(VM_LEVEL_SIZE(3) - 1)) | (virt_addr & (VM_LEVEL_SIZE(3) - 1));
+    }
+
     // Now we can find the physical location of the next 2nd level (PD) table.
     uint64_t *pd = (uint64_t*)PHYS_TO_VIRT(pdpte & addrmask);
 
@@ -94,6 +135,11 @@ uint64_t walk_page_table(uint64_t virt_addr)
         return 0;
     }
 
+    // A 2MB page ends the walk here, the lower 21 bits of the address are the offset in to it.
+    if (pde & PAGE_LARGE) {
+        return (pde & addrmask & ~(VM_LEVEL_SIZE(2) - 1)) | (virt_addr & (VM_LEVEL_SIZE(2) - 1));
+    }
+
     // On to the 1st level (PT) table.
     uint64_t *pt = (uint64_t*)PHYS_TO_VIRT(pde & addrmask);
 
@@ -111,6 +157,410 @@ uint64_t walk_page_table(uint64_t virt_addr)
     return phys_addr;
 }
 
+static void _vm_flush_add(struct VmFlush *pFlush, uint64_t virt)
+{
+    if (pFlush->count < VM_FLUSH_THRESHOLD) {
+        pFlush->pages[pFlush->count] = virt;
+    }
+
+    pFlush->count++;
+}
+
+/*
+    Invalidates everything gathered in 'pFlush'. A handful of pages get an invlpg each, past the threshold
+    the whole TLB goes. Toggling CR4.PGE also drops global entries, which a CR3 reload would leave behind.
+    Note: Only the calling CPU is flushed, the APs are never started so there's nobody to shoot down yet.
+*/
+static void _vm_flush(struct VmFlush *pFlush)
+{
+    if (pFlush->count == 0) {
+        return;
+    }
+
+    if (pFlush->count > VM_FLUSH_THRESHOLD) {
+        uint64_t cr4 = get_cr4();
+        if (cr4 & CR4_PGE) {
+            set_cr4(cr4 & ~CR4_PGE);
+            set_cr4(cr4);
+        } else {
+            set_cr3(get_cr3());
+        }
+        vm_full_flushes++;
+    } else {
+        for (uint32_t i = 0; i < pFlush->count; i++) {
+            invlpg(pFlush->pages[i]);
+        }
+        vm_invlpgs += pFlush->count;
+    }
+
+    pFlush->count = 0;
+}
+
+// Converts VM_* flags in to the bits of a present leaf entry.
+static uint64_t _vm_attrs(uint32_t flags)
+{
+    uint64_t attrs = PAGE_PRESENT;
+
+    if (flags & VM_WRITE) attrs |= PAGE_RW;
+    if (flags & VM_USER) attrs |= PAGE_USER;
+    if (flags & VM_WRITETHROUGH) attrs |= PAGE_PWT;
+    if (flags & VM_NOCACHE) attrs |= PAGE_PCD;
+    if (flags & VM_GLOBAL) attrs |= PAGE_GLOBAL;
+    if (!(flags & VM_EXEC) && nx_enabled) attrs |= PAGE_NX;
+
+    return attrs;
+}
+
+// Allocates a zeroed page table, returning its physical address or 0.
+static uint64_t _vm_alloc_table()
+{
+    void *pTable = kalloc_zone(PAGE_SIZE, KALLOC_ZERO);
+    if (!pTable) {
+        kprintf("VMM: Out of memory for page tables.\n");
+        return 0;
+    }
+
+    vm_table_pages++;
+    return VIRT_TO_PHYS(pTable);
+}
+
+/*
+    Finds the leaf entry mapping 'virt', which is a PT entry or a large page entry further up.
+    *pLevel gets the level the walk stopped at, when nothing is mapped NULL is returned and *pLevel
+    tells how big the hole is. 'parent' bits are OR'd in to the tables on the way down.
+*/
+static uint64_t* _vm_find(uint64_t virt, uint32_t *pLevel, uint64_t parent)
+{
+    uint64_t *pTable = pKernelPml4;
+
+    for (uint32_t level = 4; ; level--) {
+        uint64_t *pEntry = &pTable[VM_INDEX(virt, level)];
+        *pLevel = level;
+
+        if (!(*pEntry & PAGE_PRESENT)) {
+            return NULL;
+        }
+
+        if (level == 1 || (level <= 3 && (*pEntry & PAGE_LARGE))) {
+            return pEntry;
+        }
+
+        *pEntry |= parent;
+        pTable = (uint64_t*)PHYS_TO_VIRT(*pEntry & VM_ADDR_MASK);
+    }
+}
+
+/*
+    Breaks the 1GB or 2MB page entry at 'level' that maps 'virt' up in to a table of the next size
+    down with the same translations and attributes, so part of it can be changed.
+*/
+static bool _vm_split(uint64_t *pEntry, uint32_t level, uint64_t virt)
+{
+    uint64_t table = _vm_alloc_table();
+    if (!table) {
+        return false;
+    }
+
+    uint64_t entry = *pEntry;
+    uint64_t *pTable = (uint64_t*)PHYS_TO_VIRT(table);
+    uint64_t step = VM_LEVEL_SIZE(level - 1);
+    uint64_t base = entry & VM_ADDR_MASK & ~(VM_LEVEL_SIZE(level) - 1);
+    uint64_t attrs = entry & ~VM_ADDR_MASK;
+    bool pat = entry & PAGE_PAT_LARGE;
+
+    if (level == 2) {
+        // 4KB entries have PAT where PS used to be.
+        attrs &= ~PAGE_LARGE;
+        if (pat) attrs |= PAGE_PAT;
+    } else if (pat) {
+        attrs |= PAGE_PAT_LARGE;
+    }
+
+    for (uint64_t i = 0; i < 512; i++) {
+        pTable[i] = (base + i * step) | attrs;
+    }
+
+    // Permissions are decided by the leaf entries, the table entry only lets them through.
+    *pEntry = table | PAGE_PRESENT | PAGE_RW | PAGE_OWNED | (entry & PAGE_USER);
+    vm_split_pages++;
+
+    // The large TLB entry has to go before any of the new entries change. Otherwise the TLB can hold
+    // it alongside smaller entries with other attributes, which the Intel SDM warns against and
+    // which trips AMD errata.
+    invlpg(virt);
+    vm_invlpgs++;
+
+    return true;
+}
+
+static bool _vm_map_page(uint64_t virt, uint64_t phys, uint64_t attrs)
+{
+    uint64_t *pTable = pKernelPml4;
+    uint64_t parent = attrs & PAGE_USER;
+
+    for (uint32_t level = 4; level > 1; level--) {
+        uint64_t *pEntry = &pTable[VM_INDEX(virt, level)];
+
+        if (!(*pEntry & PAGE_PRESENT)) {
+            uint64_t table = _vm_alloc_table();
+            if (!table) {
+                return false;
+            }
+            *pEntry = table | PAGE_PRESENT | PAGE_RW | PAGE_OWNED | parent;
+        } else if (level <= 3 && (*pEntry & PAGE_LARGE)) {
+            kprintf("VMM: 0x%X is already mapped by a large page.\n", virt);
+            return false;
+        } else {
+            *pEntry |= parent;
+        }
+
+        pTable = (uint64_t*)PHYS_TO_VIRT(*pEntry & VM_ADDR_MASK);
+    }
+
+    uint64_t *pPte = &pTable[PT_INDEX(virt)];
+    if (*pPte & PAGE_PRESENT) {
+        kprintf("VMM: 0x%X is already mapped.\n", virt);
+        return false;
+    }
+
+    // The entry wasn't present so the TLB can't be holding it, no flush needed.
+    *pPte = phys | attrs;
+    return true;
+}
+
+/*
+    Unmaps [virt, end) when 'unmap' is set, otherwise gives everything mapped in it 'attrs'.
+    Large pages the range only partly covers are split first. Holes are skipped.
+*/
+static bool _vm_update(uint64_t virt, uint64_t end, bool unmap, uint64_t attrs, struct VmFlush *pFlush)
+{
+    uint64_t parent = unmap ? 0 : attrs & PAGE_USER;
+
+    while (virt < end) {
+        uint32_t level;
+        uint64_t *pEntry = _vm_find(virt, &level, parent);
+        uint64_t size = VM_LEVEL_SIZE(level);
+        uint64_t next = (virt & ~(size - 1)) + size;
+
+        if (pEntry && level > 1 && (virt & (size - 1) || end < next)) {
+            if (!_vm_split(pEntry, level, virt)) {
+                return false;
+            }
+            continue;
+        }
+
+        if (pEntry) {
+            if (unmap) {
+                *pEntry = 0;
+            } else {
+                // Keeps the address, PS in large entries and PAT in 4KB ones.
+                *pEntry = (*pEntry & (VM_ADDR_MASK | PAGE_LARGE)) | attrs;
+            }
+            _vm_flush_add(pFlush, virt);
+        }
+
+        if (next <= virt) {
+            break;
+        }
+        virt = next;
+    }
+
+    return true;
+}
+
+/*
+    Unlinks the tables below 'pTable' (at 'level') that the VMM allocated and that no longer map anything in
+    [virt, end), chaining them on to *ppFree through their first entry. A kernel pointer has bit 0 clear so
+    the link still reads as not present. Tables from the bootloader are walked through but never freed.
+    Returns true when 'pTable' itself ended up empty.
+*/
+static bool _vm_prune(uint64_t *pTable, uint32_t level, uint64_t virt, uint64_t end, uint64_t **ppFree,
+    struct VmFlush *pFlush)
+{
+    if (level > 1) {
+        uint64_t size = VM_LEVEL_SIZE(level);
+
+        while (virt < end) {
+            uint64_t next = (virt & ~(size - 1)) + size;
+            uint64_t *pEntry = &pTable[VM_INDEX(virt, level)];
+
+            if ((*pEntry & (PAGE_PRESENT | PAGE_LARGE)) == PAGE_PRESENT) {
+                uint64_t *pChild = (uint64_t*)PHYS_TO_VIRT(*pEntry & VM_ADDR_MASK);
+                if (_vm_prune(pChild, level - 1, virt, next < virt ? end : MIN(next, end), ppFree, pFlush) &&
+                    (*pEntry & PAGE_OWNED)) {
+                    *pEntry = 0;
+                    *pChild = (uint64_t)*ppFree;
+                    *ppFree = pChild;
+                    vm_table_pages--;
+
+                    // The paging-structure caches may still point at the table.
+                    _vm_flush_add(pFlush, virt);
+                }
+            }
+
+            if (next <= virt) {
+                break;
+            }
+            virt = next;
+        }
+    }
+
+    for (uint32_t i = 0; i < 512; i++) {
+        if (pTable[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Gives the tables chained up by _vm_prune() back to the PMM.
+static void _vm_free_tables(uint64_t *pFree)
+{
+    while (pFree) {
+        uint64_t *pNext = (uint64_t*)*pFree;
+        kfree(pFree);
+        pFree = pNext;
+    }
+}
+
+/*
+    Maps 'size' bytes at 'virt_addr' to physical memory starting at 'phys_addr' with 4KB pages.
+    Both addresses must be page aligned and nothing in the range may be mapped already.
+    On failure whatever was mapped is undone and false is returned.
+*/
+bool vm_map_range(uint64_t virt_addr, uint64_t phys_addr, uint64_t size, uint32_t flags)
+{
+    if (!pKernelPml4) {
+        kprintf("VMM: Mapping before vm_init().\n");
+        return false;
+    }
+
+    if (PAGE_OFFSET(virt_addr) || PAGE_OFFSET(phys_addr)) {
+        kprintf("VMM: Unaligned map of 0x%X to 0x%X.\n", virt_addr, phys_addr);
+        return false;
+    }
+
+    size = ALIGN_UP(size, PAGE_SIZE);
+    uint64_t end = virt_addr + size;
+    if (size == 0 || end <= virt_addr) {
+        return false;
+    }
+
+    uint64_t attrs = _vm_attrs(flags);
+    uint64_t virt = virt_addr;
+
+    spinlock_lock(&vm_lock);
+
+    for (; virt < end; virt += PAGE_SIZE, phys_addr += PAGE_SIZE) {
+        if (!_vm_map_page(virt, phys_addr, attrs)) {
+            break;
+        }
+    }
+
+    uint64_t *pFree = NULL;
+    bool mapped = virt == end;
+    if (!mapped) {
+        // The page that failed may have got some of its tables before running out.
+        struct VmFlush flush = {0};
+        _vm_update(virt_addr, virt, true, 0, &flush);
+        _vm_prune(pKernelPml4, 4, virt_addr, virt + PAGE_SIZE, &pFree, &flush);
+        _vm_flush(&flush);
+    }
+
+    spinlock_unlock(&vm_lock);
+
+    _vm_free_tables(pFree);
+
+    return mapped;
+}
+
+bool vm_map(uint64_t virt_addr, uint64_t phys_addr, uint32_t flags)
+{
+    return vm_map_range(virt_addr, phys_addr, PAGE_SIZE, flags);
+}
+
+/*
+    Removes every mapping in the range and frees page tables the VMM allocated that are left empty.
+    The physical memory behind the mappings belongs to the caller and is left alone.
+*/
+void vm_unmap_range(uint64_t virt_addr, uint64_t size)
+{
+    if (!pKernelPml4) {
+        return;
+    }
+
+    uint64_t virt = ALIGN_DOWN(virt_addr, PAGE_SIZE);
+    uint64_t end = ALIGN_UP(virt_addr + size, PAGE_SIZE);
+    if (end <= virt) {
+        return;
+    }
+
+    struct VmFlush flush = {0};
+    uint64_t *pFree = NULL;
+
+    spinlock_lock(&vm_lock);
+
+    if (!_vm_update(virt, end, true, 0, &flush)) {
+        kprintf("VMM: Unmap of 0x%X stopped early, a large page couldn't be split.\n", virt_addr);
+    }
+    _vm_prune(pKernelPml4, 4, virt, end, &pFree, &flush);
+
+    // Tables can only be reused once no CPU can walk in to them.
+    _vm_flush(&flush);
+
+    spinlock_unlock(&vm_lock);
+
+    _vm_free_tables(pFree);
+}
+
+void vm_unmap(uint64_t virt_addr)
+{
+    vm_unmap_range(virt_addr, PAGE_SIZE);
+}
+
+/*
+    Replaces the attributes of everything mapped in the range with 'flags'.
+    Returns false if a large page needed splitting and there was no memory for it, the range is
+    then only changed up to that page.
+*/
+bool vm_protect_range(uint64_t virt_addr, uint64_t size, uint32_t flags)
+{
+    if (!pKernelPml4) {
+        return false;
+    }
+
+    uint64_t virt = ALIGN_DOWN(virt_addr, PAGE_SIZE);
+    uint64_t end = ALIGN_UP(virt_addr + size, PAGE_SIZE);
+    if (end <= virt) {
+        return false;
+    }
+
+    struct VmFlush flush = {0};
+
+    spinlock_lock(&vm_lock);
+    bool done = _vm_update(virt, end, false, _vm_attrs(flags), &flush);
+    _vm_flush(&flush);
+    spinlock_unlock(&vm_lock);
+
+    return done;
+}
+
+bool vm_protect(uint64_t virt_addr, uint32_t flags)
+{
+    return vm_protect_range(virt_addr, PAGE_SIZE, flags);
+}
+
+void vm_report()
+{
+    kprintf("Kernel PML4: 0x%X\n", pKernelPml4 ? VIRT_TO_PHYS(pKernelPml4) : 0);
+    kprintf("NX: %s\n", nx_enabled ? "enabled" : "disabled");
+    kprintf("Page tables allocated: %lu\n", vm_table_pages);
+    kprintf("Large pages split: %lu\n", vm_split_pages);
+    kprintf("Pages invalidated with invlpg: %lu\n", vm_invlpgs);
+    kprintf("Full TLB flushes: %lu\n", vm_full_flushes);
+}
+
 void vm_init()
 {
     kprintf("Initializing virtual memory...\n");
@@ -144,4 +594,29 @@ void vm_init()
     kprintf("MAXLINADDR: %d bits\n", maxlinaddr);
 
     walk_page_table(0);
-}
\ No newline at end of file
+
+    if (cr4 & CR4_LA57) {
+        kprintf("VMM: 5-level paging isn't supported, staying on the bootloader's page tables.\n");
+        return;
+    }
+
+    nx_enabled = read_msr(IA32_EFER_MSR) & EFER_NXE;
+
+    // Take the tables over from the bootloader. Copying the top level keeps every mapping
+    // (the HHDM, the kernel image, the framebuffer) as is, the tables below are shared until
+    // something changes them, and only tables the VMM allocates itself are ever freed.
+    uint64_t pml4 = _vm_alloc_table();
+    if (!pml4) {
+        kprintf("*FATAL*: No memory for the kernel PML4.\n");
+        hcf();
+    }
+
+    uint64_t *pBootPml4 = (uint64_t*)PHYS_TO_VIRT(get_cr3() & VM_ADDR_MASK);
+    pKernelPml4 = (uint64_t*)PHYS_TO_VIRT(pml4);
+    for (uint32_t i = 0; i < 512; i++) {
+        pKernelPml4[i] = pBootPml4[i];
+    }
+
+    set_cr3(pml4);
+    kprintf("VMM: Kernel PML4 at 0x%X, NX %s.\n", pml4, nx_enabled ? "enabled" : "disabled");
+}